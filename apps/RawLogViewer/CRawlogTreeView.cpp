@@ -190,6 +190,42 @@ void CRawlogTreeView::reloadFromRawlog()
   SetScrollbars(ROW_HEIGHT, ROW_HEIGHT, 50, ly);
 }
 
+/* ------------------------------------------------------------
+            setFromIndexMetadata
+   ------------------------------------------------------------ */
+void CRawlogTreeView::setFromIndexMetadata(
+    const std::vector<mrpt::obs::CRawlogStreamReader::TEntryIndex>& entries)
+{
+  m_tree_nodes.clear();
+
+  m_rawlog_start = INVALID_TIMESTAMP;
+  m_rawlog_last = INVALID_TIMESTAMP;
+
+  // Root:
+  m_tree_nodes.emplace_back().level = 0;
+
+  size_t rawlog_index = 0;
+  for (const auto& e : entries)
+  {
+    TNodeData& dEntry = m_tree_nodes.emplace_back();
+    dEntry.level = 1;
+    dEntry.index = rawlog_index++;
+    dEntry.className = e.className;
+    if (!e.sensorLabel.empty()) dEntry.sensorLabel = e.sensorLabel;
+    if (e.timestamp != INVALID_TIMESTAMP)
+    {
+      dEntry.timestamp = e.timestamp;
+      m_rawlog_last = e.timestamp;
+      if (m_rawlog_start == INVALID_TIMESTAMP) m_rawlog_start = e.timestamp;
+    }
+  }
+
+  // Set new size:
+  int ly = m_tree_nodes.size();
+  SetScrollbars(ROW_HEIGHT, ROW_HEIGHT, 50, ly);
+  Refresh();
+}
+
 /* ------------------------------------------------------------
             reloadFromRawlog
    ------------------------------------------------------------ */
@@ -301,11 +337,11 @@ void CRawlogTreeView::OnDrawImpl(wxDC& dc)
     }
     else
     {
-      // According to class ID:
-      m_rawlog->getAsGeneric(d.index);  // Just to assure it's on memory
-
       if (d.data)
       {
+        // According to class ID:
+        m_rawlog->getAsGeneric(d.index);  // Just to assure it's on memory
+
         // Icon:
         icon = iconIndexFromClass(d.data->GetRuntimeClass());
 
@@ -322,6 +358,16 @@ void CRawlogTreeView::OnDrawImpl(wxDC& dc)
           if (!obs->sensorLabel.empty()) s << wxT(" : ") << obs->sensorLabel.c_str();
         }
       }
+      else if (d.className.has_value())
+      {
+        // Not deserialized yet: render from the side-car index metadata:
+        if (auto* cid = mrpt::rtti::findRegisteredClass(*d.className); cid)
+          icon = iconIndexFromClass(cid);
+
+        if (d.level == 1) s << "[" << std::to_string(d.index) << "] ";
+        s << shortenClassName(*d.className);
+        if (d.sensorLabel && !d.sensorLabel->empty()) s << wxT(" : ") << d.sensorLabel->c_str();
+      }
     }
 
     // Draw text and icon:
@@ -357,10 +403,13 @@ void CRawlogTreeView::OnDrawImpl(wxDC& dc)
   {
     TNodeData& d = m_tree_nodes[i];
 
-    if (!d.data) continue;
-
     TTimeStamp t_this = INVALID_TIMESTAMP;
-    if (auto obs = std::dynamic_pointer_cast<CObservation>(d.data); obs) t_this = obs->timestamp;
+    if (d.data)
+    {
+      if (auto obs = std::dynamic_pointer_cast<CObservation>(d.data); obs) t_this = obs->timestamp;
+    }
+    else if (d.timestamp.has_value())
+      t_this = *d.timestamp;  // from the side-car index metadata
 
     if (t_this == INVALID_TIMESTAMP) continue;
 
@@ -482,6 +531,12 @@ void CRawlogTreeView::SetSelectedItem(int sel_item, bool force_refresh)
     if (sel_item != m_selectedItem || force_refresh)
     {
       m_selectedItem = sel_item;
+
+      // On-demand deserialization of entries not loaded yet (index-backed
+      // fast open path):
+      if (sel_item > 0 && !m_tree_nodes[sel_item].data && m_lazy_load_cb)
+        m_tree_nodes[sel_item].data = m_lazy_load_cb(m_tree_nodes[sel_item].index);
+
       Refresh();
 
       if (m_event_select_change && m_win_parent)
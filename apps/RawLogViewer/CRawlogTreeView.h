@@ -11,6 +11,7 @@
 #define CRawlogTreeView_H
 
 #include <mrpt/obs/CRawlog.h>
+#include <mrpt/obs/CRawlogStreamReader.h>
 #include <wx/button.h>
 #include <wx/menu.h>
 #include <wx/notebook.h>
@@ -76,6 +77,23 @@ class CRawlogTreeView : public wxScrolledWindow
    * refresh the view */
   void reloadFromRawlog();
 
+  /** Fills the tree directly from a side-car rawlog index (see
+   * mrpt::obs::CRawlogStreamReader), without any deserialized objects:
+   * rows show class name, sensor label and timestamp from the index
+   * metadata. Rows stay flat (sensory frames are not expanded) until the
+   * objects are available in memory and reloadFromRawlog() is called. */
+  void setFromIndexMetadata(
+      const std::vector<mrpt::obs::CRawlogStreamReader::TEntryIndex>& entries);
+
+  /** If set, invoked upon selecting a row whose object has not been
+   * deserialized yet (data==nullptr, see setFromIndexMetadata()); must
+   * return the deserialized entry, which is then cached in the node. */
+  void setLazyLoadCallback(
+      const std::function<mrpt::serialization::CSerializable::Ptr(size_t entryIndex)>& cb)
+  {
+    m_lazy_load_cb = cb;
+  }
+
   /** Sets a handler for the event of selected item changes.
    */
   void ConnectSelectedItemChange(const wxRawlogTreeEventFunction& func);
@@ -109,6 +127,10 @@ class CRawlogTreeView : public wxScrolledWindow
 
     std::optional<mrpt::Clock::time_point> timestamp;
     std::optional<std::string> sensorLabel;
+
+    /** Class name from the side-car index, for rows whose object has not
+     * been deserialized yet (data==nullptr). */
+    std::optional<std::string> className;
   };
 
   size_t m_firstVisibleItem = 0, m_lastVisibleItem = 0;
@@ -130,6 +152,7 @@ class CRawlogTreeView : public wxScrolledWindow
   /** File name */
   std::string m_rawlog_name;
   wxRawlogTreeEventFunction m_event_select_change;
+  std::function<mrpt::serialization::CSerializable::Ptr(size_t)> m_lazy_load_cb;
   wxWindow* m_win_parent{nullptr};
 
   std::string m_last_exported_rawlog_file;
@@ -328,6 +328,7 @@ static const long ID_MENUITEM49 = wxNewId();
 static const long ID_MENUITEM50 = wxNewId();
 static const long ID_MENUITEM48 = wxNewId();
 static const long ID_TIMER1 = wxNewId();
+static const long ID_TIMER_BGLOAD = wxNewId();
 static const long ID_MENUITEM_RENAME_BY_SF_IDX = wxNewId();
 static const long ID_SCROLLEDWINDOW2 = wxNewId();
 static const long ID_TXT_SELECTED_INFO = wxNewId();
@@ -1206,6 +1207,7 @@ xRawLogViewerFrame::xRawLogViewerFrame(wxWindow* parent, wxWindowID id) :
 
   timAutoLoad.SetOwner(this, ID_TIMER1);
   timAutoLoad.Start(50, true);
+  timBgLoad.SetOwner(this, ID_TIMER_BGLOAD);
 
   // ----------------
   // Events
@@ -1297,6 +1299,7 @@ xRawLogViewerFrame::xRawLogViewerFrame(wxWindow* parent, wxWindowID id) :
   Bind(wxEVT_MENU, &This::OnMenuItem46Selected, this, ID_MENUITEM49);
   Bind(wxEVT_MENU, &This::OnMenuItem47Selected, this, ID_MENUITEM50);
   Bind(wxEVT_TIMER, &This::OntimAutoLoadTrigger, this, ID_TIMER1);
+  Bind(wxEVT_TIMER, &This::OntimBgLoadTrigger, this, ID_TIMER_BGLOAD);
   //*)
 
   Bind(wxEVT_NOTEBOOK_PAGE_CHANGED, &This::On3DObsPagesChange, this, ID_NOTEBOOK_3DOBS);
@@ -1391,6 +1394,8 @@ xRawLogViewerFrame::~xRawLogViewerFrame()
   //(*Destroy(xRawLogViewerFrame)
   //*)
 
+  stopBackgroundLoad();
+
   // Destroy dialogs:
   delete formRawMap;
   formRawMap = nullptr;
@@ -1644,6 +1649,14 @@ void xRawLogViewerFrame::loadRawlogFile(const string& str, int first, int last)
 #endif
   // ToolBar1->Realize();
 
+  // Cancel any background load still running from a previous open:
+  stopBackgroundLoad();
+
+  // Index-backed fast path: for whole-file loads of plain (non-gz) rawlogs,
+  // fill the tree view instantly from the side-car `.idx` metadata and
+  // deserialize the objects in a background thread (see loadRawlogViaIndex).
+  if (first == 0 && last == -1 && loadRawlogViaIndex(str)) return;
+
   wxBusyCursor waitCursor;
 
   CFileGZInputStream fil(str);
@@ -1841,6 +1854,177 @@ void xRawLogViewerFrame::loadRawlogFile(const string& str, int first, int last)
   WX_END_TRY
 }
 
+//------------------------------------------------------------------------
+// Inserts one deserialized rawlog entry into "rl", applying the same
+// per-class conversions as the blocking loop in loadRawlogFile() above.
+//------------------------------------------------------------------------
+static void insertLoadedEntry(CRawlog& rl, const CSerializable::Ptr& newObj)
+{
+  if (!newObj) return;
+
+  if (newObj->GetRuntimeClass() == CLASS_ID(CSensoryFrame))
+    rl.insert(std::dynamic_pointer_cast<CSensoryFrame>(newObj));
+  else if (newObj->GetRuntimeClass() == CLASS_ID(CActionCollection))
+    rl.insert(std::dynamic_pointer_cast<CActionCollection>(newObj));
+  else if (newObj->GetRuntimeClass()->derivedFrom(CLASS_ID(CObservation)))
+    rl.insert(std::dynamic_pointer_cast<CObservation>(newObj));
+  else if (newObj->GetRuntimeClass() == CLASS_ID(CPose2D))
+  {
+    // Backward compatibility: CPose2D => odometry-based action (see above)
+    CPose2D::Ptr poseChange = std::dynamic_pointer_cast<CPose2D>(newObj);
+    CActionCollection::Ptr temp = std::make_shared<CActionCollection>();
+    CActionRobotMovement2D action;
+    CActionRobotMovement2D::TMotionModelOptions options;
+    action.computeFromOdometry(*poseChange, options);
+    temp->insert(action);
+    rl.insert(temp);
+  }
+  else if (newObj->GetRuntimeClass() == CLASS_ID(CRawlog))
+  {
+    CRawlog::Ptr rw = std::dynamic_pointer_cast<CRawlog>(newObj);
+    for (size_t i = 0; i < rw->size(); i++) rl.insert(rw->getAsGeneric(i));
+  }
+  else
+    rl.insert(newObj);
+}
+
+//------------------------------------------------------------------------
+// Fast open path: fills the tree view from the side-car metadata index of
+// the rawlog (see mrpt::obs::CRawlogStreamReader) so the UI is usable
+// right away, then deserializes the objects into a staging rawlog in a
+// background thread. A timer (OntimBgLoadTrigger) reports progress and,
+// upon completion, swaps the staging rawlog in and rebuilds the full tree.
+// Returns false (caller falls back to the blocking loader) for
+// gz-compressed inputs or if the index cannot be built.
+//------------------------------------------------------------------------
+bool xRawLogViewerFrame::loadRawlogViaIndex(const std::string& fileName)
+{
+  auto reader = std::make_unique<mrpt::obs::CRawlogStreamReader>();
+  try
+  {
+    if (!reader->open(fileName)) return false;
+  }
+  catch (const std::exception&)
+  {
+    // e.g. gz-compressed input: the regular loader handles it.
+    return false;
+  }
+  if (reader->empty()) return false;
+
+  loadedFileName = fileName;
+  StatusBar1->SetStatusText(mrpt::format("Loading file: %s", fileName.c_str()).c_str());
+
+  crono_Loading.Tic();
+
+  rawlog.clear();
+  m_bgLoadStaging.clear();
+  m_bgLoadStop = false;
+  m_bgLoadDone = false;
+  m_bgLoadCount = 0;
+
+  // Populate the tree view instantly from the index metadata:
+  std::vector<mrpt::obs::CRawlogStreamReader::TEntryIndex> entries;
+  entries.reserve(reader->size());
+  for (size_t i = 0; i < reader->size(); i++) entries.push_back(reader->entry(i));
+
+  m_indexedReader = std::move(reader);
+
+  m_treeView->setRawlogName(loadedFileName);
+  m_treeView->setRawlogSource(&rawlog);  // empty until the bg load ends
+  m_treeView->setFromIndexMetadata(entries);
+
+  // On-demand deserialization of entries the user clicks on while the
+  // background load is still running:
+  m_treeView->setLazyLoadCallback(
+      [this](size_t entryIdx) -> CSerializable::Ptr
+      {
+        try
+        {
+          std::lock_guard<std::mutex> lck(m_bgLoadMtx);
+          if (!m_indexedReader) return {};
+          return m_indexedReader->getAsGeneric(entryIdx);
+        }
+        catch (const std::exception&)
+        {
+          return {};
+        }
+      });
+
+  // Deserialize everything into the staging rawlog in the background:
+  m_bgLoadThread = std::thread(
+      [this]()
+      {
+        const size_t n = m_indexedReader->size();
+        for (size_t i = 0; i < n && !m_bgLoadStop; i++)
+        {
+          CSerializable::Ptr obj;
+          try
+          {
+            std::lock_guard<std::mutex> lck(m_bgLoadMtx);
+            obj = m_indexedReader->getAsGeneric(i);
+          }
+          catch (const std::exception&)
+          {
+            // Skip unreadable entries; the legacy loader would stop here.
+          }
+          insertLoadedEntry(m_bgLoadStaging, obj);
+          m_bgLoadCount = i + 1;
+        }
+        m_bgLoadDone = true;
+      });
+
+  timBgLoad.Start(250, false /* periodic */);
+  return true;
+}
+
+void xRawLogViewerFrame::OntimBgLoadTrigger(wxTimerEvent&)
+{
+  WX_START_TRY
+
+  if (!m_indexedReader)
+  {
+    timBgLoad.Stop();
+    return;
+  }
+
+  if (!m_bgLoadDone)
+  {
+    StatusBar1->SetStatusText(
+        mrpt::format(
+            "Background loading: %u / %u entries...", static_cast<unsigned>(m_bgLoadCount.load()),
+            static_cast<unsigned>(m_indexedReader->size()))
+            .c_str());
+    return;
+  }
+
+  // Done: swap the fully-loaded rawlog in and leave the metadata-only mode:
+  timBgLoad.Stop();
+  if (m_bgLoadThread.joinable()) m_bgLoadThread.join();
+
+  rawlog = std::move(m_bgLoadStaging);
+  m_bgLoadStaging.clear();
+
+  m_treeView->setLazyLoadCallback({});
+  m_indexedReader.reset();
+
+  timeToLoad = crono_Loading.Tac();
+  rebuildTreeView();
+
+  WX_END_TRY
+}
+
+void xRawLogViewerFrame::stopBackgroundLoad()
+{
+  m_bgLoadStop = true;
+  if (m_bgLoadThread.joinable()) m_bgLoadThread.join();
+  timBgLoad.Stop();
+
+  m_indexedReader.reset();
+  m_bgLoadStaging.clear();
+  m_bgLoadDone = false;
+  m_bgLoadStop = false;
+}
+
 //------------------------------------------------------------------------
 //           Rebuilds the tree view with data in "rawlog"
 //------------------------------------------------------------------------
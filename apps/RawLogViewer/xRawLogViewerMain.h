@@ -40,8 +40,12 @@
 #include <wx/scrolbar.h>
 #include <wx/simplebook.h>
 
+#include <atomic>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 
 #include "ViewOptions3DPoints.h"
 
@@ -140,6 +144,32 @@ class xRawLogViewerFrame : public wxFrame
    */
   void loadRawlogFile(const std::string& str, int first = 0, int last = -1);
 
+  /** Index-backed fast-open path: for whole-file loads of plain (non-gz)
+   * rawlogs, opens the file via its side-car metadata index (see
+   * mrpt::obs::CRawlogStreamReader), so the tree view is usable at once,
+   * and deserializes the actual objects into "rawlog" in a background
+   * thread; on-screen entries are deserialized on demand when selected.
+   * \return false if this file cannot be indexed (e.g. gz-compressed), so
+   * the caller should use the regular blocking load. */
+  bool loadRawlogViaIndex(const std::string& fileName);
+
+  /** Stops and joins the background loader thread, if running. */
+  void stopBackgroundLoad();
+
+  void OntimBgLoadTrigger(wxTimerEvent& event);
+
+  std::unique_ptr<mrpt::obs::CRawlogStreamReader> m_indexedReader;
+  /** Serializes seeks/reads on m_indexedReader between the GUI thread and
+   * the background loader. */
+  std::mutex m_bgLoadMtx;
+  std::thread m_bgLoadThread;
+  std::atomic_bool m_bgLoadStop{false}, m_bgLoadDone{false};
+  std::atomic<size_t> m_bgLoadCount{0};
+  /** Filled by the background loader; moved into "rawlog" upon completion
+   * (from the GUI thread, see OntimBgLoadTrigger()). */
+  mrpt::obs::CRawlog m_bgLoadStaging;
+  wxTimer timBgLoad;
+
   /** Rebuilds the tree view with the data in "rawlog".
    */
   void rebuildTreeView();
@@ -59,6 +59,15 @@ TCLAP::ValueArg<int> arg_gz_level(
     "0: none, 1-9: min-max",
     cmd);
 
+TCLAP::ValueArg<unsigned int> arg_threads(
+    "t",
+    "threads",
+    "Number of parsing/compression threads (optional)",
+    false,
+    0,
+    "0: auto, 1: single-threaded",
+    cmd);
+
 TCLAP::ValueArg<double> arg_obs_period(
     "p",
     "period",
@@ -102,19 +111,19 @@ int main(int argc, char** argv)
     VERBOSE_COUT << "Output rawlog    : " << output_rawlog
                  << " (Compression level: " << compress_level << ")\n";
 
-    // Open I/O streams:
-    std::ifstream input_stream(input_log.c_str());
-    if (!input_stream.is_open())
-      throw runtime_error(format("Error opening for read: '%s'", input_log.c_str()));
+    // Open output stream (compression runs on worker threads, like the
+    // parsing):
+    const unsigned int numThreads = arg_threads.getValue();
 
     mrpt::io::CFileGZOutputStream out_rawlog;
-    if (!out_rawlog.open(output_rawlog, compress_level))
+    if (!out_rawlog.open(
+            output_rawlog, compress_level, std::nullopt, mrpt::io::OpenMode::TRUNCATE,
+            numThreads))
       throw runtime_error(format("Error opening for write: '%s'", output_rawlog.c_str()));
 
     // --------------------------------
     // The main loop
     // --------------------------------
-    vector<CObservation::Ptr> importedObservations;
     map<TTimeStamp, TPose2D> groundTruthPoses;  // If found...
     unsigned int nSavedObs = 0;
     const double dt = arg_obs_period.getValue();
@@ -122,50 +131,54 @@ int main(int argc, char** argv)
 
     const mrpt::system::TTimeStamp base_timestamp = mrpt::Clock::now();
 
-    const uint64_t totalInFileSize = mrpt::system::getFileSize(input_log);
     int decimateUpdateConsole = 0;
 
-    while (carmen_log_parse_line(input_stream, importedObservations, base_timestamp))
-    {
-      // fix timestamps. Carmen logs did not store timing information:
-      for (auto& o : importedObservations) o->timestamp = mrpt::Clock::fromDouble(tim);
-
-      tim += dt;  // for the next carmen line
-
-      // save them:
-      for (size_t i = 0; i < importedObservations.size(); i++)
-      {
-        mrpt::serialization::archiveFrom(out_rawlog) << *importedObservations[i];
-        nSavedObs++;
-
-        // by the way: if we have an "odometry" observation but it's not
-        // alone, it's probably
-        //  a "corrected" odometry from some SLAM program, so save it as
-        //  ground truth:
-        if (importedObservations.size() > 1 &&
-            IS_CLASS(*importedObservations[i], CObservationOdometry))
+    TCarmenLogImportOptions importOpts;
+    importOpts.numberOfThreads = numThreads;
+
+    carmen_log_import(
+        input_log,
+        [&](size_t lineIdx, size_t lineCount, vector<CObservation::Ptr>& importedObservations)
         {
-          CObservationOdometry::Ptr odo =
-              std::dynamic_pointer_cast<CObservationOdometry>(importedObservations[i]);
-          groundTruthPoses[odo->timestamp] = odo->odometry.asTPose();
-        }
-      }
-
-      // Update progress in the console:
-      // ----------------------------------
-      if (verbose && ++decimateUpdateConsole > 10)
-      {
-        decimateUpdateConsole = 0;
-
-        const std::streampos curPos = input_stream.tellg();
-        const double progress_ratio = double(curPos) / double(totalInFileSize);
-        static const int nBlocksTotal = 50;
-        const int nBlocks = progress_ratio * nBlocksTotal;
-        cout << "\rProgress: [" << string(nBlocks, '#') << string(nBlocksTotal - nBlocks, ' ')
-             << format("] %6.02f%% (%u objects)", progress_ratio * 100, nSavedObs);
-        cout.flush();
-      }
-    };
+          // fix timestamps. Carmen logs did not store timing information:
+          for (auto& o : importedObservations) o->timestamp = mrpt::Clock::fromDouble(tim);
+
+          tim += dt;  // for the next carmen line
+
+          // save them:
+          for (size_t i = 0; i < importedObservations.size(); i++)
+          {
+            mrpt::serialization::archiveFrom(out_rawlog) << *importedObservations[i];
+            nSavedObs++;
+
+            // by the way: if we have an "odometry" observation but it's not
+            // alone, it's probably
+            //  a "corrected" odometry from some SLAM program, so save it as
+            //  ground truth:
+            if (importedObservations.size() > 1 &&
+                IS_CLASS(*importedObservations[i], CObservationOdometry))
+            {
+              CObservationOdometry::Ptr odo =
+                  std::dynamic_pointer_cast<CObservationOdometry>(importedObservations[i]);
+              groundTruthPoses[odo->timestamp] = odo->odometry.asTPose();
+            }
+          }
+
+          // Update progress in the console:
+          // ----------------------------------
+          if (verbose && ++decimateUpdateConsole > 10)
+          {
+            decimateUpdateConsole = 0;
+
+            const double progress_ratio = double(lineIdx + 1) / double(lineCount);
+            static const int nBlocksTotal = 50;
+            const int nBlocks = progress_ratio * nBlocksTotal;
+            cout << "\rProgress: [" << string(nBlocks, '#') << string(nBlocksTotal - nBlocks, ' ')
+                 << format("] %6.02f%% (%u objects)", progress_ratio * 100, nSavedObs);
+            cout.flush();
+          }
+        },
+        base_timestamp, importOpts);
     cout << "\n";
 
     // If we had ground-truth robot poses, save to file:
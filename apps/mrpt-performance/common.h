@@ -35,16 +35,19 @@ void register_tests_grids();
 void register_tests_grid3D();
 void register_tests_pointmaps();
 void register_tests_random();
+void register_tests_serialization();
 void register_tests_math();
 void register_tests_image();
 void register_tests_scan_matching();
 void register_tests_feature_extraction();
 void register_tests_feature_matching();
 void register_tests_graph();
+void register_tests_nav();
 void register_tests_graphslam();
 void register_tests_CObservation3DRangeScan();
 void register_tests_atan2lut();
 void register_tests_strings();
+void register_tests_voxelmaps();
 void register_tests_octomaps();
 void register_tests_system();
 void register_tests_yaml();
@@ -95,6 +95,35 @@ double atan2_lut_multires_test_query(int, int)
   return tictac.Tac() / step;
 }
 
+double atan2_lut_multires_test_query_batch(int, int)
+{
+  const unsigned int step = 1000000;
+  mrpt::system::CTicTac tictac;
+  mrpt::math::CAtan2LookUpTableMultiRes atan2lut;
+
+  std::map<double, double> res2extension;
+  res2extension[0.001] = 0.8;  // 0.1 cm resolution
+  res2extension[0.01] = 2.0;   // 1.0 cm resolution
+  res2extension[0.02] = 5.0;   // 2.0 cm resolution
+  res2extension[0.05] = 11.0;  // 5.0 cm resolution
+  atan2lut.resize(res2extension);
+
+  std::vector<double> xs(step), ys(step), outs(step);
+  double x = -9.0, y = -8.0;
+  const double dx = 18.0 / step, dy = 12.5 / step;
+  for (unsigned int i = 0; i < step; i++)
+  {
+    x += dx;
+    y += dy;
+    xs[i] = x;
+    ys[i] = y;
+  }
+
+  tictac.Tic();
+  atan2lut.atan2Many(step, ys.data(), xs.data(), outs.data());
+  return tictac.Tac() / step;
+}
+
 double atan2_raw_test_query(int, int)
 {
   const unsigned int step = 1000000;
@@ -127,6 +156,8 @@ void register_tests_atan2lut()
 
   lstTests.emplace_back("CAtan2LUTMultiRes: 22x22m,build", atan2_lut_multires_test_build);
   lstTests.emplace_back("CAtan2LUTMultiRes: 22x22m,query", atan2_lut_multires_test_query);
+  lstTests.emplace_back(
+      "CAtan2LUTMultiRes: 22x22m,query batch", atan2_lut_multires_test_query_batch);
 
   lstTests.emplace_back("CAtan2LUT: raw ::atan2() call", atan2_raw_test_query);
 }
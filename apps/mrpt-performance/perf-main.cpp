@@ -13,6 +13,7 @@
   ---------------------------------------------------------------*/
 
 #include <mrpt/3rdparty/tclap/CmdLine.h>
+#include <mrpt/core/cpu.h>
 #include <mrpt/io/CFileInputStream.h>
 #include <mrpt/io/CFileOutputStream.h>
 #include <mrpt/io/CMemoryStream.h>
@@ -22,6 +23,12 @@
 #include <mrpt/serialization/stl_serialization.h>
 #include <mrpt/version.h>
 
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <optional>
+#include <regex>
+
 #include "common.h"
 
 using namespace mrpt;
@@ -40,6 +47,82 @@ const std::string PERF_DATA_DIR;
 
 vector<pair<string, double>> all_perf_data;  // pair: description, time
 
+// Macros to create strings with the compiler version:
+#define ___STR2__(x)                    #x
+#define ___STR1__(x)                    ___STR2__(x)
+#define COMP_VER(NAME, MAJ, MIN, PATCH) NAME ___STR1__(MAJ) ___STR1__(MIN) ___STR1__(PATCH)
+
+#if defined(_MSC_VER)
+#if _MSC_VER == 1700
+const char* compiler_name = "MSVC2012";
+#elif _MSC_VER == 1800
+const char* compiler_name = "MSVC2013";
+#elif _MSC_VER == 1900
+const char* compiler_name = "MSVC2015";
+#elif (_MSC_VER >= 1910) && (_MSC_VER <= 1919)
+const char* compiler_name = "MSVC2017";
+#else
+const char* compiler_name = "MSVC";
+#endif
+#elif defined(__clang__)
+const char* compiler_name =
+    COMP_VER("CLANG", __clang_major__, __clang_minor__, __clang_patchlevel__);
+#elif defined(__GNUC__)
+const char* compiler_name = COMP_VER("GCC", __GNUC__, __GNUC_MINOR__, __GNUC_PATCHLEVEL__);
+#else
+const char* compiler_name = "unknowncompiler";
+#endif
+
+// Per-test statistics over the repeated runs (see --runs):
+struct TestRunStats
+{
+  std::string name;
+  double mean_time = 0, std_time = 0;
+  unsigned int runs = 0;
+};
+
+namespace
+{
+std::string json_escape(const std::string& s)
+{
+  std::string r;
+  r.reserve(s.size());
+  for (const char c : s)
+  {
+    if (c == '"' || c == '\\') r += '\\';
+    r += c;
+  }
+  return r;
+}
+
+// Loads the per-test lines of a JSON file formerly written by this program
+// (--output-json). One result object per line, so a line regex suffices and
+// no JSON dependency is needed:
+std::map<std::string, TestRunStats> load_baseline_json(const std::string& fil)
+{
+  std::map<std::string, TestRunStats> ret;
+  std::ifstream f(fil);
+  ASSERTMSG_(f.good(), mrpt::format("Cannot open baseline file: '%s'", fil.c_str()));
+
+  const std::regex re(
+      "\"name\":\\s*\"(.*)\",\\s*\"mean_time\":\\s*([0-9.eE+-]+),"
+      "\\s*\"std_time\":\\s*([0-9.eE+-]+),\\s*\"runs\":\\s*([0-9]+)");
+  std::string line;
+  while (std::getline(f, line))
+  {
+    std::smatch m;
+    if (!std::regex_search(line, m, re)) continue;
+    TestRunStats st;
+    st.name = m[1];
+    st.mean_time = std::stod(m[2]);
+    st.std_time = std::stod(m[3]);
+    st.runs = std::stoul(m[4]);
+    ret[st.name] = st;
+  }
+  return ret;
+}
+}  // namespace
+
 // All this mess is to avoid the smart compiler optimizer to remove "code with
 // no effect" in some test functions...
 void dummy_do_nothing_with_string(const std::string& s)
@@ -68,6 +151,32 @@ int main(int argc, char** argv)
         "c", "match-contains", "Run only the tests containing the given substring", false, "NAME",
         "NAME", cmd);
 
+    TCLAP::ValueArg<std::string> arg_match_re(
+        "e", "match-re", "Run only the tests whose name matches the given regular expression",
+        false, "REGEX", "REGEX", cmd);
+
+    TCLAP::ValueArg<unsigned int> arg_runs(
+        "n", "runs",
+        "Number of repeated runs of each test, used to estimate the "
+        "per-test variance (Default: 1)",
+        false, 1, "N", cmd);
+
+    TCLAP::ValueArg<std::string> arg_json(
+        "j", "output-json",
+        "Save the results, with CPU/build metadata, to a machine-readable "
+        "JSON file",
+        false, "", "results.json", cmd);
+
+    TCLAP::ValueArg<std::string> arg_csv(
+        "", "output-csv", "Save the results to a CSV file", false, "", "results.csv", cmd);
+
+    TCLAP::ValueArg<std::string> arg_compare(
+        "", "compare",
+        "Compare the results against a baseline JSON file (written by a "
+        "former run with --output-json) and flag statistically-significant "
+        "regressions. Exits with return code 2 if any is found.",
+        false, "", "baseline.json", cmd);
+
     TCLAP::SwitchArg arg_build_tables(
         "t", "tables",
         "Don't run any test, instead build the tables of compared "
@@ -90,6 +199,15 @@ int main(int argc, char** argv)
       match_contains = arg_contains.getValue();
     }
 
+    std::optional<std::regex> match_re;
+    if (arg_match_re.isSet())
+    {
+      cout << "Using regex match filter: " << arg_match_re.getValue() << endl;
+      match_re.emplace(arg_match_re.getValue());
+    }
+
+    const unsigned int numRuns = std::max(1U, arg_runs.getValue());
+
     bool doLog = true;
     bool HAVE_PERF_DATA_DIR =
         !PERF_DATA_DIR.empty() && mrpt::system::directoryExists(PERF_DATA_DIR);
@@ -124,6 +242,7 @@ int main(int argc, char** argv)
     register_tests_grids();
     register_tests_grid3D();
     register_tests_pointmaps();
+    register_tests_voxelmaps();
     register_tests_random();
     register_tests_math();
     register_tests_image();
@@ -131,10 +250,12 @@ int main(int argc, char** argv)
     register_tests_feature_extraction();
     register_tests_feature_matching();
     register_tests_graph();
+    register_tests_nav();
     register_tests_graphslam();
     register_tests_CObservation3DRangeScan();
     register_tests_atan2lut();
     register_tests_strings();
+    register_tests_serialization();
     register_tests_octomaps();
     register_tests_system();
     register_tests_yaml();
@@ -149,6 +270,8 @@ int main(int argc, char** argv)
           "<td align=\"center\"><b>Execution rate (Hz)</b></td> </tr>\n");
     }
 
+    std::vector<TestRunStats> all_run_stats;
+
     for (auto it = lstTests.begin(); it != lstTests.end(); it++)
     {
       // Filter tests?
@@ -156,12 +279,31 @@ int main(int argc, char** argv)
         if (string::npos == string(it->name).find(match_contains))
           continue;  // doesn't have the substring
 
+      if (match_re && !std::regex_search(string(it->name), *match_re)) continue;
+
       printf("%-60s", it->name);
       cout.flush();
 
       try
       {
-        const double t = it->func(it->arg1, it->arg2);  // Run it.
+        // Run it (possibly several times, to estimate the variance):
+        double sum = 0, sumSq = 0;
+        for (unsigned int run = 0; run < numRuns; run++)
+        {
+          const double t_i = it->func(it->arg1, it->arg2);
+          sum += t_i;
+          sumSq += t_i * t_i;
+        }
+        const double t = sum / numRuns;
+
+        TestRunStats st;
+        st.name = it->name;
+        st.mean_time = t;
+        st.std_time =
+            numRuns > 1 ? std::sqrt(std::max(0.0, (sumSq - sum * sum / numRuns) / (numRuns - 1)))
+                        : 0.0;
+        st.runs = numRuns;
+        all_run_stats.push_back(st);
 
         mrpt::system::consoleColorAndStyle(mrpt::system::ConsoleForegroundColor::GREEN);
 
@@ -224,37 +366,102 @@ int main(int argc, char** argv)
       cout << endl << "Checkout the logfile: " << filName << endl;
     }
 
+    // Machine-readable outputs:
+    if (arg_json.isSet())
+    {
+      std::ofstream fj(arg_json.getValue());
+      ASSERTMSG_(
+          fj.good(), mrpt::format("Cannot open for writing: '%s'", arg_json.getValue().c_str()));
+
+      fj << "{\n";
+      fj << "\"mrpt_version\": \"" << json_escape(MRPT_getVersion()) << "\",\n";
+      fj << "\"build_date\": \"" << json_escape(MRPT_getCompilationDate()) << "\",\n";
+      fj << "\"compiler\": \"" << json_escape(compiler_name) << "\",\n";
+      fj << "\"word_size\": " << int(MRPT_WORD_SIZE) << ",\n";
+      fj << "\"cpu_features\": \"" << json_escape(mrpt::cpu::features_as_string()) << "\",\n";
+      fj << "\"runs_per_test\": " << numRuns << ",\n";
+      fj << "\"results\": [\n";
+      for (size_t i = 0; i < all_run_stats.size(); i++)
+      {
+        const auto& st = all_run_stats[i];
+        // Keep each result in one line: the --compare parser relies on it.
+        fj << mrpt::format(
+            "{\"name\": \"%s\", \"mean_time\": %.6e, \"std_time\": %.6e, "
+            "\"runs\": %u}%s\n",
+            json_escape(st.name).c_str(), st.mean_time, st.std_time, st.runs,
+            i + 1 < all_run_stats.size() ? "," : "");
+      }
+      fj << "]\n}\n";
+      cout << "Results saved to: " << arg_json.getValue() << endl;
+    }
+
+    if (arg_csv.isSet())
+    {
+      std::ofstream fc(arg_csv.getValue());
+      ASSERTMSG_(
+          fc.good(), mrpt::format("Cannot open for writing: '%s'", arg_csv.getValue().c_str()));
+
+      fc << "name;mean_time;std_time;runs\n";
+      for (const auto& st : all_run_stats)
+        fc << mrpt::format(
+            "\"%s\";%.6e;%.6e;%u\n", st.name.c_str(), st.mean_time, st.std_time, st.runs);
+      cout << "Results saved to: " << arg_csv.getValue() << endl;
+    }
+
+    // A/B comparison against a baseline run?
+    int retCode = 0;
+    if (arg_compare.isSet())
+    {
+      const auto baseline = load_baseline_json(arg_compare.getValue());
+      cout << endl
+           << "Comparing " << all_run_stats.size() << " results against " << baseline.size()
+           << " baseline entries from: " << arg_compare.getValue() << endl;
+
+      size_t numRegressions = 0;
+      for (const auto& st : all_run_stats)
+      {
+        const auto itB = baseline.find(json_escape(st.name));
+        if (itB == baseline.end()) continue;
+        const auto& b = itB->second;
+
+        // Welch-like significance test on the difference of means; with a
+        // single run per test the std estimates are 0 and only the ratio
+        // threshold applies:
+        const double diff = st.mean_time - b.mean_time;
+        const double se = std::sqrt(
+            mrpt::square(st.std_time) / std::max(1U, st.runs) +
+            mrpt::square(b.std_time) / std::max(1U, b.runs));
+        const bool significant = std::abs(diff) > 3.0 * se;
+        const double ratio = b.mean_time > 0 ? st.mean_time / b.mean_time : 1.0;
+
+        if (significant && ratio > 1.05)
+        {
+          numRegressions++;
+          mrpt::system::consoleColorAndStyle(mrpt::system::ConsoleForegroundColor::RED);
+          printf(
+              "REGRESSION %-55s %s -> %s (x%.02f)\n", st.name.c_str(),
+              mrpt::system::intervalFormat(b.mean_time).c_str(),
+              mrpt::system::intervalFormat(st.mean_time).c_str(), ratio);
+        }
+        else if (significant && ratio < 0.95)
+        {
+          mrpt::system::consoleColorAndStyle(mrpt::system::ConsoleForegroundColor::GREEN);
+          printf(
+              "IMPROVED   %-55s %s -> %s (x%.02f)\n", st.name.c_str(),
+              mrpt::system::intervalFormat(b.mean_time).c_str(),
+              mrpt::system::intervalFormat(st.mean_time).c_str(), ratio);
+        }
+        mrpt::system::consoleColorAndStyle(mrpt::system::ConsoleForegroundColor::DEFAULT);
+      }
+      cout << "Found " << numRegressions << " significant regression(s)." << endl;
+      if (numRegressions) retCode = 2;
+    }
+
     // Save to perf-data dir?
     if (HAVE_PERF_DATA_DIR)
     {
       const char* version_postfix = arg_release.isSet() ? "" : "dev";
 
-// Macros to create strings with the compiler version:
-#define ___STR2__(x)                    #x
-#define ___STR1__(x)                    ___STR2__(x)
-#define COMP_VER(NAME, MAJ, MIN, PATCH) NAME ___STR1__(MAJ) ___STR1__(MIN) ___STR1__(PATCH)
-
-#if defined(_MSC_VER)
-#if _MSC_VER == 1700
-      const char* compiler_name = "MSVC2012";
-#elif _MSC_VER == 1800
-      const char* compiler_name = "MSVC2013";
-#elif _MSC_VER == 1900
-      const char* compiler_name = "MSVC2015";
-#elif (_MSC_VER >= 1910) && (_MSC_VER <= 1919)
-      const char* compiler_name = "MSVC2017";
-#else
-      const char* compiler_name = "MSVC";
-#endif
-#elif defined(__clang__)
-      const char* compiler_name =
-          COMP_VER("CLANG", __clang_major__, __clang_minor__, __clang_patchlevel__);
-#elif defined(__GNUC__)
-      const char* compiler_name = COMP_VER("GCC", __GNUC__, __GNUC_MINOR__, __GNUC_PATCHLEVEL__);
-#else
-      const char* compiler_name = "unknowncompiler";
-#endif
-
       const string fil_name =
           PERF_DATA_DIR + mrpt::format(
                               "/perf-results-%i.%i.%i%s-%s-%ibit.dat",
@@ -267,7 +474,7 @@ int main(int argc, char** argv)
       arch << all_perf_data;
     }
 
-    return 0;
+    return retCode;
   }
   catch (const std::exception& e)
   {
@@ -0,0 +1,89 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <mrpt/nav/tpspace/CPTG_DiffDrive_C.h>
+#include <mrpt/nav/tpspace/CPTG_Holo_Blend.h>
+#include <mrpt/random.h>
+
+#include "common.h"
+
+double nav_test_ptg_initialize(int a1, int a2)
+{
+  // Trajectory simulation + collision grid build, without a cache file.
+  // This is the dominant start-up cost of a reactive navigator:
+  mrpt::nav::CPTG_DiffDrive_C ptg;
+  ptg.loadDefaultParams();
+
+  CTicTac tictac;
+  ptg.initialize(std::string(), false /*verbose*/);
+  return tictac.Tac();
+}
+
+double nav_test_tp_obstacles(int numObstacles, int a2)
+{
+  auto& rn = mrpt::random::getRandomGenerator();
+  rn.randomize(333);
+
+  mrpt::nav::CPTG_Holo_Blend ptg;
+  ptg.loadDefaultParams();
+  ptg.initialize(std::string(), false /*verbose*/);
+
+  std::vector<double> tp_obstacles;
+
+  const long N = 200;
+  CTicTac tictac;
+  for (long i = 0; i < N; i++)
+  {
+    // One reactive-cycle worth of work: reset + project all WS obstacles
+    // into TP-Space:
+    ptg.initTPObstacles(tp_obstacles);
+    for (int j = 0; j < numObstacles; j++)
+      ptg.updateTPObstacle(rn.drawUniform(-10.0, 10.0), rn.drawUniform(-10.0, 10.0), tp_obstacles);
+  }
+  return tictac.Tac() / N;
+}
+
+double nav_test_ws2tp(int numPoints, int a2)
+{
+  auto& rn = mrpt::random::getRandomGenerator();
+  rn.randomize(333);
+
+  mrpt::nav::CPTG_Holo_Blend ptg;
+  ptg.loadDefaultParams();
+  ptg.initialize(std::string(), false /*verbose*/);
+
+  int k = 0;
+  double d = 0, accum = 0;
+
+  const long N = 200;
+  CTicTac tictac;
+  for (long i = 0; i < N; i++)
+  {
+    for (int j = 0; j < numPoints; j++)
+    {
+      if (ptg.inverseMap_WS2TP(rn.drawUniform(-10.0, 10.0), rn.drawUniform(-10.0, 10.0), k, d))
+        accum += d;
+    }
+  }
+  const double t = tictac.Tac() / N;
+  dummy_do_nothing_with_string(mrpt::format("%f", accum));
+  return t;
+}
+
+// ------------------------------------------------------
+// register_tests_nav
+// ------------------------------------------------------
+void register_tests_nav()
+{
+  // clang-format off
+	lstTests.emplace_back("nav: CPTG_DiffDrive_C initialize (no cache)", nav_test_ptg_initialize);
+	lstTests.emplace_back("nav: TP-obstacle cycle (500 obstacles)", nav_test_tp_obstacles, 500);
+	lstTests.emplace_back("nav: inverseMap_WS2TP (x500)", nav_test_ws2tp, 500);
+  // clang-format on
+}
@@ -0,0 +1,116 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <mrpt/io/CMemoryStream.h>
+#include <mrpt/maps/CSimplePointsMap.h>
+#include <mrpt/obs/CObservation2DRangeScan.h>
+#include <mrpt/obs/CObservationIMU.h>
+#include <mrpt/obs/CObservationOdometry.h>
+#include <mrpt/obs/CSensoryFrame.h>
+#include <mrpt/obs/stock_observations.h>
+#include <mrpt/random.h>
+#include <mrpt/serialization/CArchive.h>
+
+#include "common.h"
+
+// A sensory frame mixing the typical per-timestep observations of a wheeled
+// robot: 2D lidar + 9-axis IMU + odometry.
+mrpt::obs::CSensoryFrame synth_mixed_sensory_frame()
+{
+  mrpt::obs::CSensoryFrame sf;
+
+  auto scan = mrpt::obs::CObservation2DRangeScan::Create();
+  mrpt::obs::stock_observations::example2DRangeScan(*scan);
+  sf.insert(scan);
+
+  auto imu = mrpt::obs::CObservationIMU::Create();
+  for (size_t i = 0; i < mrpt::obs::COUNT_IMU_DATA_FIELDS; i++)
+    imu->set(static_cast<mrpt::obs::TIMUDataIndex>(i), 0.1 * i);
+  sf.insert(imu);
+
+  auto odo = mrpt::obs::CObservationOdometry::Create();
+  odo->odometry = mrpt::poses::CPose2D(1.0, 2.0, 0.3);
+  sf.insert(odo);
+
+  return sf;
+}
+
+double serialization_test_write_sf(int a1, int a2)
+{
+  const auto sf = synth_mixed_sensory_frame();
+
+  mrpt::io::CMemoryStream buf;
+  auto arch = archiveFrom(buf);
+
+  const long N = 2000;
+  CTicTac tictac;
+  for (long i = 0; i < N; i++)
+  {
+    buf.Seek(0);
+    arch << sf;
+  }
+  return tictac.Tac() / N;
+}
+
+double serialization_test_read_sf(int a1, int a2)
+{
+  const auto sf = synth_mixed_sensory_frame();
+
+  mrpt::io::CMemoryStream buf;
+  auto arch = archiveFrom(buf);
+  arch << sf;
+
+  mrpt::obs::CSensoryFrame sf2;
+
+  const long N = 2000;
+  CTicTac tictac;
+  for (long i = 0; i < N; i++)
+  {
+    buf.Seek(0);
+    arch >> sf2;
+  }
+  return tictac.Tac() / N;
+}
+
+double serialization_test_points_map(int numPts_K, int a2)
+{
+  auto& rn = mrpt::random::getRandomGenerator();
+  rn.randomize(333);
+
+  mrpt::maps::CSimplePointsMap pts;
+  pts.reserve(1000U * numPts_K);
+  for (long i = 0; i < 1000L * numPts_K; i++)
+    pts.insertPoint(
+        rn.drawUniform(-50.0, 50.0), rn.drawUniform(-50.0, 50.0), rn.drawUniform(-5.0, 5.0));
+
+  mrpt::io::CMemoryStream buf;
+  auto arch = archiveFrom(buf);
+
+  const long N = 20;
+  CTicTac tictac;
+  for (long i = 0; i < N; i++)
+  {
+    buf.Seek(0);
+    arch << pts;
+  }
+  return tictac.Tac() / N;
+}
+
+// ------------------------------------------------------
+// register_tests_serialization
+// ------------------------------------------------------
+void register_tests_serialization()
+{
+  // clang-format off
+	lstTests.emplace_back("serialization: write mixed sensory frame", serialization_test_write_sf);
+	lstTests.emplace_back("serialization: read mixed sensory frame", serialization_test_read_sf);
+	lstTests.emplace_back("serialization: write points map (100K pts)", serialization_test_points_map, 100);
+	lstTests.emplace_back("serialization: write points map (1M pts)", serialization_test_points_map, 1000);
+  // clang-format on
+}
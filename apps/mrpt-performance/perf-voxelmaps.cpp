@@ -0,0 +1,121 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <mrpt/maps/CSimplePointsMap.h>
+#include <mrpt/maps/CVoxelMap.h>
+#include <mrpt/poses/CPose3D.h>
+#include <mrpt/random.h>
+
+#include "common.h"
+
+// Synthesizes one frame of a 128-beam rotating lidar (128 rings x `cols`
+// azimuth steps, random ranges) as a point cloud in the sensor frame:
+void synth_lidar128_scan(mrpt::maps::CSimplePointsMap& pts, const size_t cols = 512)
+{
+  auto& rn = mrpt::random::getRandomGenerator();
+
+  pts.clear();
+  pts.reserve(128 * cols);
+  for (size_t r = 0; r < 128; r++)
+  {
+    const double pitch = mrpt::DEG2RAD(-22.5 + 45.0 * r / 127.0);
+    for (size_t c = 0; c < cols; c++)
+    {
+      const double yaw = 2 * M_PI * c / cols;
+      const double range = rn.drawUniform(3.0, 40.0);
+      pts.insertPoint(
+          range * cos(yaw) * cos(pitch), range * sin(yaw) * cos(pitch), range * sin(pitch));
+    }
+  }
+}
+
+double voxelmap_test_insert_rays(int res_cm, int a2)
+{
+  auto& rn = mrpt::random::getRandomGenerator();
+  rn.randomize(333);
+
+  mrpt::maps::CSimplePointsMap pts;
+  synth_lidar128_scan(pts);
+
+  mrpt::maps::CVoxelMap vm(0.01 * res_cm);
+
+  const long N = 10;
+  CTicTac tictac;
+  for (long i = 0; i < N; i++)
+  {
+    const mrpt::poses::CPose3D pose(
+        rn.drawUniform(-1.0, 1.0), rn.drawUniform(-1.0, 1.0), 0, rn.drawUniform(-M_PI, M_PI), 0, 0);
+
+    vm.insertPointCloudAsRays(pts, pose.translation(), pose);
+  }
+  return tictac.Tac() / N;
+}
+
+double voxelmap_test_insert_endpoints(int res_cm, int a2)
+{
+  auto& rn = mrpt::random::getRandomGenerator();
+  rn.randomize(333);
+
+  mrpt::maps::CSimplePointsMap pts;
+  synth_lidar128_scan(pts);
+
+  mrpt::maps::CVoxelMap vm(0.01 * res_cm);
+
+  const long N = 25;
+  CTicTac tictac;
+  for (long i = 0; i < N; i++)
+  {
+    const mrpt::poses::CPose3D pose(
+        rn.drawUniform(-1.0, 1.0), rn.drawUniform(-1.0, 1.0), 0, rn.drawUniform(-M_PI, M_PI), 0, 0);
+
+    vm.insertPointCloudAsEndPoints(pts, pose.translation(), pose);
+  }
+  return tictac.Tac() / N;
+}
+
+double voxelmap_test_query(int res_cm, int a2)
+{
+  auto& rn = mrpt::random::getRandomGenerator();
+  rn.randomize(333);
+
+  mrpt::maps::CSimplePointsMap pts;
+  synth_lidar128_scan(pts);
+
+  mrpt::maps::CVoxelMap vm(0.01 * res_cm);
+  vm.insertPointCloudAsEndPoints(pts, {0, 0, 0});
+
+  const long N = 1000000;
+  double occ = 0, accum = 0;
+
+  CTicTac tictac;
+  for (long i = 0; i < N; i++)
+  {
+    if (vm.getPointOccupancy(
+            rn.drawUniform(-40.0, 40.0), rn.drawUniform(-40.0, 40.0), rn.drawUniform(-20.0, 20.0),
+            occ))
+      accum += occ;
+  }
+  const double t = tictac.Tac() / N;
+  dummy_do_nothing_with_string(mrpt::format("%f", accum));
+  return t;
+}
+
+// ------------------------------------------------------
+// register_tests_voxelmaps
+// ------------------------------------------------------
+void register_tests_voxelmaps()
+{
+  // clang-format off
+	lstTests.emplace_back("voxelmap: insert 128-beam scan as rays (voxels=10cm)", voxelmap_test_insert_rays, 10);
+	lstTests.emplace_back("voxelmap: insert 128-beam scan as rays (voxels=20cm)", voxelmap_test_insert_rays, 20);
+	lstTests.emplace_back("voxelmap: insert 128-beam scan as endpoints (voxels=10cm)", voxelmap_test_insert_endpoints, 10);
+	lstTests.emplace_back("voxelmap: insert 128-beam scan as endpoints (voxels=20cm)", voxelmap_test_insert_endpoints, 20);
+	lstTests.emplace_back("voxelmap: getPointOccupancy (voxels=10cm)", voxelmap_test_query, 10);
+  // clang-format on
+}
@@ -118,6 +118,34 @@ double yaml_FromText(int, int)
   return r;
 }
 
+// A synthetic, large strict-JSON document (exercises the JSON fast path):
+static std::string buildBigJsonBlock()
+{
+  std::string s = "{\n";
+  for (int i = 0; i < 2000; i++)
+    s += mrpt::format(
+        "\"entry_%04i\": {\"name\": \"sensor %i\", \"enabled\": %s, "
+        "\"pose\": [%i.5, -%i.25, 0.0], \"rate_hz\": %i.0},\n",
+        i, i, (i & 1) ? "true" : "false", i, i, 10 + i);
+  s += "\"total\": 2000}\n";
+  return s;
+}
+
+double yaml_FromText_json(int, int)
+{
+  const auto jsonBlock = buildBigJsonBlock();
+  mrpt::system::CTimeLogger tl;
+  for (unsigned int i = 0; i < 100; i++)
+  {
+    tl.enter("t");
+    auto doc = mrpt::containers::yaml::FromText(jsonBlock);
+    tl.leave("t");
+  }
+  double r = tl.getMeanTime("t");
+  tl.clear(true);  // deep clear to silent dtor stats
+  return r;
+}
+
 double yaml_query(int, int)
 {
   if (!prepareYamlTestFile()) return 0;
@@ -261,6 +289,7 @@ void register_tests_yaml()
   lstTests.emplace_back("yaml: FromFile() big file", &yaml_FromFile);
   lstTests.emplace_back("yaml: loadFromText() small", &yaml_loadFromText);
   lstTests.emplace_back("yaml: FromText() small", &yaml_FromText);
+  lstTests.emplace_back("yaml: FromText() big JSON doc", &yaml_FromText_json);
   lstTests.emplace_back("yaml: query in a big doc", &yaml_query);
   lstTests.emplace_back("yaml: iterate a big doc", &yaml_iterate);
 
@@ -17,6 +17,7 @@
 #include <mrpt/gui/about_box.h>
 #include <mrpt/io/CFileGZInputStream.h>
 #include <mrpt/io/CFileGZOutputStream.h>
+#include <mrpt/io/CFileInputStream.h>
 #include <mrpt/math/TLine3D.h>
 #include <mrpt/math/TObject3D.h>
 #include <mrpt/math/geometry.h>  // intersect()
@@ -361,23 +362,38 @@ void NavlogViewerApp::loadLogfile(const std::string& fileName)
   m_openedFileName = fileName;
   m_winMain->setTitle("Control ["s + mrpt::system::extractFileName(fileName) + "]"s);
 
-  mrpt::io::CFileGZInputStream f(fileName);
-
-  m_logdata.clear();
+  m_logRecordOffsets.clear();
+  m_logRecordCache.clear();
   m_logdata_ptg_paths.clear();
   m_pastPoses.clear();
 
+  // Plain files are read via a seekable CFileInputStream so getLogRecord()
+  // can jump straight to any record; gzip-compressed ones (sniffed from the
+  // magic bytes) must be decompressed sequentially:
+  {
+    mrpt::io::CFileInputStream fRaw(fileName);
+    uint8_t magic[2] = {0, 0};
+    fRaw.Read(magic, sizeof(magic));
+    m_logFileIsGZ = (magic[0] == 0x1f && magic[1] == 0x8b);
+  }
+  resetLogStream();
+
   mrpt::rtti::CListOfClasses validClasses;
   validClasses.insert(CLASS_ID(mrpt::nav::CLogFileRecord));
 
   m_log_first_tim = INVALID_TIMESTAMP;
   m_log_last_tim = INVALID_TIMESTAMP;
 
-  auto arch = archiveFrom(f);
+  // Indexing pass: each record must be deserialized once to locate the next
+  // one (the serialization format does not store object lengths), but only
+  // its stream offset and timing/PTG metadata are kept, so memory usage
+  // stays O(1) regardless of the log size.
+  auto arch = archiveFrom(*m_logStream);
   for (;;)
   {
     try
     {
+      const auto offset = static_cast<uint64_t>(m_logStream->getPosition());
       CSerializable::Ptr obj = arch.ReadObject();
       if (!validClasses.contains(obj->GetRuntimeClass()))
       {
@@ -387,7 +403,7 @@ void NavlogViewerApp::loadLogfile(const std::string& fileName)
             format("Unexpected class found: %s", obj->GetRuntimeClass()->className));
         break;
       }
-      m_logdata.push_back(obj);
+      m_logRecordOffsets.push_back(offset);
 
       // generate time stats:
       if (IS_CLASS(*obj, CLogFileRecord))
@@ -429,12 +445,85 @@ void NavlogViewerApp::loadLogfile(const std::string& fileName)
       throw;
     }
   }
+  m_logStreamPos = static_cast<uint64_t>(m_logStream->getPosition());
   NANOGUI_END_TRY(*m_win)
 
   // Update stats, etc...
   updateInfoFromLoadedLog();
 }
 
+void NavlogViewerApp::resetLogStream()
+{
+  if (m_logFileIsGZ)
+    m_logStream = std::make_unique<mrpt::io::CFileGZInputStream>(m_openedFileName);
+  else
+    m_logStream = std::make_unique<mrpt::io::CFileInputStream>(m_openedFileName);
+  m_logStreamPos = 0;
+}
+
+mrpt::serialization::CSerializable::Ptr NavlogViewerApp::getLogRecord(size_t idx)
+{
+  using namespace mrpt::nav;
+  using mrpt::serialization::archiveFrom;
+
+  ASSERT_LT_(idx, m_logRecordOffsets.size());
+
+  if (auto itCache = m_logRecordCache.find(idx); itCache != m_logRecordCache.end())
+  {
+    itCache->second.lastAccess = ++m_logCacheAccessCounter;
+    return itCache->second.obj;
+  }
+
+  // Position the stream at the start of the record:
+  const uint64_t target = m_logRecordOffsets[idx];
+  if (!m_logStream || (m_logFileIsGZ && target < m_logStreamPos)) resetLogStream();
+
+  if (!m_logFileIsGZ)
+  {
+    m_logStream->Seek(target);
+    m_logStreamPos = target;
+  }
+  else
+  {
+    // gzip streams cannot seek; skip forward by bulk reads instead:
+    std::vector<uint8_t> skipBuf;
+    while (m_logStreamPos < target)
+    {
+      skipBuf.resize(std::min<uint64_t>(target - m_logStreamPos, 1UL << 20));
+      const size_t nRead = m_logStream->Read(skipBuf.data(), skipBuf.size());
+      ASSERT_GT_(nRead, 0UL);
+      m_logStreamPos += nRead;
+    }
+  }
+
+  auto arch = archiveFrom(*m_logStream);
+  mrpt::serialization::CSerializable::Ptr obj = arch.ReadObject();
+  m_logStreamPos = static_cast<uint64_t>(m_logStream->getPosition());
+
+  // Records after the first one are stored without the (identical) PTG
+  // definitions; re-attach the shared ones, as the load loop used to do:
+  if (auto logptr = std::dynamic_pointer_cast<CLogFileRecord>(obj); logptr)
+  {
+    const size_t nPTGs = std::min(logptr->infoPerPTG.size(), m_logdata_ptg_paths.size());
+    for (size_t i = 0; i < nPTGs; i++)
+      if (!logptr->infoPerPTG[i].ptg) logptr->infoPerPTG[i].ptg = m_logdata_ptg_paths[i];
+  }
+
+  // Insert into the cache, evicting the least-recently used entry if full:
+  if (m_logRecordCache.size() >= LOG_CACHE_MAX_ENTRIES)
+  {
+    auto itOldest = m_logRecordCache.begin();
+    for (auto it = m_logRecordCache.begin(); it != m_logRecordCache.end(); ++it)
+      if (it->second.lastAccess < itOldest->second.lastAccess) itOldest = it;
+    m_logRecordCache.erase(itOldest);
+  }
+  auto& entry = m_logRecordCache[idx];
+  entry.obj = obj;
+  entry.lastAccess = ++m_logCacheAccessCounter;
+
+  return obj;
+}
+
 void NavlogViewerApp::OnMainIdleLoop()
 {
   // Idle loop tasks:
@@ -523,7 +612,7 @@ bool NavlogViewerApp::OnKeyboardCallback(
 
 void NavlogViewerApp::updateInfoFromLoadedLog()
 {
-  const size_t N = m_logdata.size();
+  const size_t N = logRecordCount();
 
   if (N > 0)
   {
@@ -556,10 +645,10 @@ void NavlogViewerApp::updateVisualization()
   updateManualPickControls();
 
   const int log_idx = mrpt::round(slidLog->value());
-  if (log_idx >= int(m_logdata.size())) return;
+  if (log_idx >= int(logRecordCount())) return;
   // In the future, we could handle more log classes. For now, only
   // "CLogFileRecord::Ptr":
-  auto logptr = std::dynamic_pointer_cast<CLogFileRecord>(m_logdata[log_idx]);
+  auto logptr = std::dynamic_pointer_cast<CLogFileRecord>(getLogRecord(log_idx));
   const CLogFileRecord& log = *logptr;
 
   txtSelectedPTG->setValue(
@@ -567,7 +656,7 @@ void NavlogViewerApp::updateVisualization()
 
   {
     std::string timeIndexStr = "Time index: "s + std::to_string(log_idx) + " / "s +
-                               std::to_string(std::max<size_t>(1U, m_logdata.size()) - 1);
+                               std::to_string(std::max<size_t>(1U, logRecordCount()) - 1);
 
     if (auto itTim = log.timestamps.find("tim_start_iteration"); itTim != log.timestamps.end())
     {
@@ -613,7 +702,7 @@ void NavlogViewerApp::updateVisualization()
         // instant as a reference, such that the obtained
         // coordinates closely match those expected in the "map"
         // frame:
-        auto log0ptr = mrpt::ptr_cast<CLogFileRecord>::from(m_logdata[0]);
+        auto log0ptr = mrpt::ptr_cast<CLogFileRecord>::from(getLogRecord(0));
         ASSERT_(log0ptr.get());
         const auto curPose =
             log0ptr->robotPoseLocalization + (log.robotPoseOdometry - log0ptr->robotPoseOdometry);
@@ -1515,10 +1604,10 @@ void NavlogViewerApp::OnmnuMatlabPlotsSelected()
   std::vector<float> X, Y;    // Obstacles
   std::vector<float> TX, TY;  // Target over time
 
-  const size_t N = m_logdata.size();
+  const size_t N = logRecordCount();
   for (size_t i = 0; i < N; i++)
   {
-    const CLogFileRecord::Ptr logsptr = std::dynamic_pointer_cast<CLogFileRecord>(m_logdata[i]);
+    const CLogFileRecord::Ptr logsptr = std::dynamic_pointer_cast<CLogFileRecord>(getLogRecord(i));
     const CLogFileRecord* logptr = logsptr.get();
 
     const auto robotPose = logptr->robotPoseLocalization;
@@ -1651,10 +1740,10 @@ void NavlogViewerApp::OnmnuGenerateOdometryVsLocalizationReport()
 
   std::optional<mrpt::math::TPose2D> lastOdo, lastLocPose;
 
-  const size_t N = m_logdata.size();
+  const size_t N = logRecordCount();
   for (size_t i = 0; i < N; i++)
   {
-    const CLogFileRecord::Ptr logsptr = std::dynamic_pointer_cast<CLogFileRecord>(m_logdata[i]);
+    const CLogFileRecord::Ptr logsptr = std::dynamic_pointer_cast<CLogFileRecord>(getLogRecord(i));
     const CLogFileRecord* logptr = logsptr.get();
     if (!logptr) continue;
     const auto& log = *logptr;
@@ -1695,10 +1784,10 @@ void NavlogViewerApp::OnmnuSaveScoreMatrixSelected()
       true /*save*/);
   if (fileName.empty()) return;
 
-  const size_t N = m_logdata.size();
+  const size_t N = logRecordCount();
   for (size_t i = 0; i < N; i++)
   {
-    const CLogFileRecord::Ptr logsptr = std::dynamic_pointer_cast<CLogFileRecord>(m_logdata[i]);
+    const CLogFileRecord::Ptr logsptr = std::dynamic_pointer_cast<CLogFileRecord>(getLogRecord(i));
     const CLogFileRecord* logptr = logsptr.get();
 
     for (size_t iPTG = 0; iPTG < logptr->infoPerPTG.size(); iPTG++)
@@ -1724,8 +1813,8 @@ void NavlogViewerApp::OnmnuSaveCurrentObstacles()
   NANOGUI_START_TRY
 
   const int log_idx = mrpt::round(slidLog->value());
-  if (log_idx >= int(m_logdata.size())) return;
-  auto logptr = std::dynamic_pointer_cast<CLogFileRecord>(m_logdata[log_idx]);
+  if (log_idx >= int(logRecordCount())) return;
+  auto logptr = std::dynamic_pointer_cast<CLogFileRecord>(getLogRecord(log_idx));
   const CLogFileRecord& log = *logptr;
 
   const std::string fileName = nanogui::file_dialog(
@@ -1772,8 +1861,8 @@ void NavlogViewerApp::OnmnuExportSelected(std::string filename)
   NANOGUI_START_TRY;
 
   const int log_idx = mrpt::round(slidLog->value());
-  if (log_idx >= int(m_logdata.size())) return;
-  auto logptr = std::dynamic_pointer_cast<CLogFileRecord>(m_logdata[log_idx]);
+  if (log_idx >= int(logRecordCount())) return;
+  auto logptr = std::dynamic_pointer_cast<CLogFileRecord>(getLogRecord(log_idx));
   const CLogFileRecord& log = *logptr;
 
   if (filename.empty())
@@ -1797,7 +1886,7 @@ void NavlogViewerApp::OnmnuMatlabExportPaths()
 {
   NANOGUI_START_TRY;
 
-  const size_t N = m_logdata.size();
+  const size_t N = logRecordCount();
   ASSERTMSG_(N > 0, "Log is empty! Load a valid log first...");
 
   const std::string fileName = nanogui::file_dialog(
@@ -1841,7 +1930,7 @@ void NavlogViewerApp::OnmnuMatlabExportPaths()
 
   for (size_t i = 0; i < N; i++)
   {
-    const CLogFileRecord::Ptr logsptr = std::dynamic_pointer_cast<CLogFileRecord>(m_logdata[i]);
+    const CLogFileRecord::Ptr logsptr = std::dynamic_pointer_cast<CLogFileRecord>(getLogRecord(i));
     const CLogFileRecord* logptr = logsptr.get();
 
     {
@@ -2147,9 +2236,9 @@ void NavlogViewerApp::updateManualPickControls()
   m_btnManualPickAppendYaml->setEnabled(manualPickEnabled);
 
   const int log_idx = mrpt::round(slidLog->value());
-  if (log_idx >= int(m_logdata.size())) return;
+  if (log_idx >= int(logRecordCount())) return;
 
-  auto logptr = std::dynamic_pointer_cast<CLogFileRecord>(m_logdata[log_idx]);
+  auto logptr = std::dynamic_pointer_cast<CLogFileRecord>(getLogRecord(log_idx));
   const CLogFileRecord& log = *logptr;
 
   m_slidPtgIndex->setRange({0, log.nPTGs - 1});
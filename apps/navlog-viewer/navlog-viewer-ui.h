@@ -10,9 +10,12 @@
 #pragma once
 
 #include <mrpt/gui/CDisplayWindowGUI.h>
+#include <mrpt/io/CStream.h>
 #include <mrpt/nav.h>
 #include <mrpt/system/CTicTac.h>
 
+#include <memory>
+
 class NavlogViewerApp
 {
  public:
@@ -55,8 +58,29 @@ class NavlogViewerApp
   // ============ app data ===============
   std::string m_openedFileName = "UNNAMED";
 
-  std::vector<mrpt::serialization::CSerializable::Ptr> m_logdata;
-  // Retrieved from the first entry in m_logdata when loading
+  // Log records are NOT kept in memory: loadLogfile() runs a single
+  // indexing pass over the file recording the stream offset of each record,
+  // and entries are deserialized on demand (with a small LRU cache) via
+  // getLogRecord(), so multi-GB logs can be opened and scrubbed instantly.
+  std::vector<uint64_t> m_logRecordOffsets;
+  bool m_logFileIsGZ = false;
+  std::unique_ptr<mrpt::io::CStream> m_logStream;
+  uint64_t m_logStreamPos = 0;  //!< Uncompressed position of m_logStream
+
+  struct CachedLogRecord
+  {
+    mrpt::serialization::CSerializable::Ptr obj;
+    uint64_t lastAccess = 0;
+  };
+  std::map<size_t, CachedLogRecord> m_logRecordCache;
+  uint64_t m_logCacheAccessCounter = 0;
+  constexpr static size_t LOG_CACHE_MAX_ENTRIES = 256;
+
+  size_t logRecordCount() const { return m_logRecordOffsets.size(); }
+  mrpt::serialization::CSerializable::Ptr getLogRecord(size_t idx);
+  void resetLogStream();
+
+  // Retrieved from the first entry of the log when loading
   std::vector<mrpt::nav::CParameterizedTrajectoryGenerator::Ptr> m_logdata_ptg_paths;
 
   struct VizPTG
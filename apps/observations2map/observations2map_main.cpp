@@ -22,6 +22,7 @@
 #include <mrpt/maps/COccupancyGridMap2D.h>
 #include <mrpt/maps/CSimpleMap.h>
 #include <mrpt/serialization/CArchive.h>
+#include <mrpt/slam/parallel_map_build.h>
 #include <mrpt/system/filesystem.h>
 #include <mrpt/system/os.h>
 
@@ -52,13 +53,27 @@ int main(int argc, char** argv)
         "-\n");
 
     // Process arguments:
-    if ((argc != 4 && argc != 6) || (argc == 6 && 0 != mrpt::system::os::_strcmp(argv[4], "-s")))
+    bool args_ok = (argc == 4 || argc == 6 || argc == 8);
+    int numThreads = -1;  // -1: serial (default); 0: one thread per core
+    for (int i = 4; args_ok && i + 1 < argc; i += 2)
+    {
+      if (0 == mrpt::system::os::_strcmp(argv[i], "-s"))
+        METRIC_MAP_CONFIG_SECTION = string(argv[i + 1]);
+      else if (0 == mrpt::system::os::_strcmp(argv[i], "-t"))
+        numThreads = atoi(argv[i + 1]);
+      else
+        args_ok = false;
+    }
+    if (!args_ok)
     {
       cout << "Use: observations2map <config_file.ini> "
               "<observations.simplemap> <outputmap_prefix> [-s "
-              "INI_FILE_SECTION_NAME] "
+              "INI_FILE_SECTION_NAME] [-t NUM_THREADS]"
            << endl;
       cout << "  Default: INI_FILE_SECTION_NAME = MappingApplication" << endl;
+      cout << "  -t NUM_THREADS: build partial maps in parallel and merge "
+              "them (0 = one thread per CPU core)."
+           << endl;
       cout << "Push any key to exit..." << endl;
       return 1;
     }
@@ -67,11 +82,6 @@ int main(int argc, char** argv)
     string inputFile = std::string(argv[2]);
     string outprefix = std::string(argv[3]);
 
-    if (argc > 4)
-    {
-      METRIC_MAP_CONFIG_SECTION = string(argv[5]);
-    }
-
     // Load simplemap:
     cout << "Loading simplemap...";
     mrpt::maps::CSimpleMap simplemap;
@@ -88,12 +98,19 @@ int main(int argc, char** argv)
     mapCfg.loadFromConfigFile(cfg, METRIC_MAP_CONFIG_SECTION);
 
     CMultiMetricMap metricMap;
-    metricMap.setListOfMaps(mapCfg);
 
     // Build metric maps:
     cout << "Building metric maps..." << std::endl;
 
-    metricMap.loadFromSimpleMap(simplemap);
+    if (numThreads >= 0)
+    {
+      mrpt::slam::buildMetricMapFromSimpleMapParallel(metricMap, simplemap, mapCfg, numThreads);
+    }
+    else
+    {
+      metricMap.setListOfMaps(mapCfg);
+      metricMap.loadFromSimpleMap(simplemap);
+    }
 
     cout << "done." << endl;
 
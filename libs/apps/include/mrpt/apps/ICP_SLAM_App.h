@@ -75,6 +75,13 @@ class ICP_SLAM_App_Base :
   std::map<mrpt::system::TTimeStamp, mrpt::math::TPose3D> out_estimated_path;
 
   /** @} */
+
+ protected:
+  /** Called by run() after each observation has been fed to the map builder,
+   * with the measured processing time (in seconds). Default: does nothing.
+   * Used by ICP_SLAM_App_Live to close the loop of its scan governor.
+   * \note [New in MRPT 2.14.5] */
+  virtual void impl_on_observation_processed([[maybe_unused]] double processingTimeSec) {}
 };
 
 /** Instance of ICP_SLAM_App_Base to run mapping from an offline dataset file.
@@ -97,6 +104,30 @@ class ICP_SLAM_App_Live : public ICP_SLAM_App_Base
   ICP_SLAM_App_Live();
   virtual ~ICP_SLAM_App_Live() override;
 
+  /** Runtime metrics of the deadline-aware scan governor (see
+   * `governor_max_latency_ms` in the `[MappingApplication]` config section).
+   * \sa governorStats()
+   * \note [New in MRPT 2.14.5] */
+  struct TGovernorStats
+  {
+    /** Cost of processing the last scan fed to the map builder [ms] */
+    double lastProcessingTimeMs = 0;
+    /** Smoothed (EWMA) per-scan processing cost [ms] */
+    double avgProcessingTimeMs = 0;
+    /** Age of the last delivered scan when handed to the builder [ms] */
+    double lastLatencyMs = 0;
+    /** Pending observations in the grabbing queue at the last poll */
+    size_t queueDepth = 0;
+    /** Total number of backlogged scans skipped so far */
+    size_t droppedScans = 0;
+    /** Ray decimation currently applied to delivered scans (1=none) */
+    unsigned int currentDecimation = 1;
+  };
+
+  /** Returns a snapshot of the scan governor metrics. Thread-safe.
+   * \note [New in MRPT 2.14.5] */
+  TGovernorStats governorStats() const;
+
  protected:
   void impl_initialize(int argc, const char** argv) override;
   std::string impl_get_usage() const override { return "icp-slam-live <config_file>"; }
@@ -106,6 +137,8 @@ class ICP_SLAM_App_Live : public ICP_SLAM_App_Base
       mrpt::obs::CSensoryFrame::Ptr& observations,
       mrpt::obs::CObservation::Ptr& observation) override;
 
+  void impl_on_observation_processed(double processingTimeSec) override;
+
   struct TThreadParams
   {
     mrpt::config::CConfigFileBase* cfgFile;
@@ -117,6 +150,16 @@ class ICP_SLAM_App_Live : public ICP_SLAM_App_Base
   mrpt::hwdrivers::CGenericSensor::TListObservations m_global_list_obs;
   std::mutex m_cs_global_list_obs;
   std::atomic_bool m_allThreadsMustExit = false;
+
+  /** Soft per-scan latency budget [ms] of the scan governor; 0 = disabled.
+   * Loaded from `governor_max_latency_ms` in impl_initialize(). */
+  double m_governor_max_latency_ms = 0;
+  /** Upper bound for the adaptive ray decimation (`governor_max_decimation`
+   * in the config file). */
+  unsigned int m_governor_max_decimation = 8;
+
+  TGovernorStats m_governorStats;
+  mutable std::mutex m_cs_governorStats;
 };
 
 }  // namespace mrpt::apps
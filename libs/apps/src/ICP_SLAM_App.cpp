@@ -15,6 +15,7 @@
 #include <mrpt/io/CFileOutputStream.h>
 #include <mrpt/io/vector_loadsave.h>
 #include <mrpt/maps/COccupancyGridMap2D.h>
+#include <mrpt/obs/CObservation2DRangeScan.h>
 #include <mrpt/obs/CObservationOdometry.h>
 #include <mrpt/opengl/CGridPlaneXY.h>
 #include <mrpt/opengl/CPlanarLaserScan.h>  // from lib [mrpt-maps]
@@ -256,6 +257,10 @@ void ICP_SLAM_App_Base::run()
     t_exec = tictac.Tac();
     MRPT_LOG_INFO_FMT("Map building executed in %.03fms", 1000.0f * t_exec);
 
+    // Feed the measured cost back to the data source (e.g. the live-mode
+    // scan governor):
+    impl_on_observation_processed(t_exec);
+
     // Info log:
     // -----------
     f_log.printf("%f %i\n", 1000.0f * t_exec, mapBuilder.getCurrentlyBuiltMapSize());
@@ -450,6 +455,26 @@ void ICP_SLAM_App_Rawlog::impl_initialize(int argc, const char** argv)
 // ---------------------------------------
 //   ICP_SLAM_App_Live
 // ---------------------------------------
+
+/** Returns a copy of the scan keeping only 1 out of "decimation" rays (first
+ * and last rays always kept, so the aperture is preserved). */
+static mrpt::obs::CObservation2DRangeScan::Ptr decimate_scan_rays(
+    const mrpt::obs::CObservation2DRangeScan& scan, unsigned int decimation)
+{
+  const size_t n = scan.getScanSize();
+  auto out = mrpt::obs::CObservation2DRangeScan::Create(scan);
+  const size_t nOut = 1 + (n - 1) / decimation;
+  out->resizeScan(nOut);
+  for (size_t j = 0; j < nOut; j++)
+  {
+    const size_t i = (j * (n - 1)) / (nOut - 1);
+    out->setScanRange(j, scan.getScanRange(i));
+    out->setScanRangeValidity(j, scan.getScanRangeValidity(i));
+    if (scan.hasIntensity()) out->setScanIntensity(j, scan.getScanIntensity(i));
+  }
+  return out;
+}
+
 ICP_SLAM_App_Live::ICP_SLAM_App_Live() { this->setLoggerName("ICP_SLAM_App_Live"); }
 
 ICP_SLAM_App_Live::~ICP_SLAM_App_Live() = default;
@@ -465,6 +490,16 @@ void ICP_SLAM_App_Live::impl_initialize(int argc, const char** argv)
 
   // Config file already loaded into "params".
 
+  // Optional deadline-aware scan governor:
+  m_governor_max_latency_ms = params.read_double(sect, "governor_max_latency_ms", 0.0);
+  m_governor_max_decimation =
+      params.read_int(sect, "governor_max_decimation", m_governor_max_decimation);
+  ASSERT_GE_(m_governor_max_decimation, 1U);
+  if (m_governor_max_latency_ms > 0)
+    MRPT_LOG_INFO_FMT(
+        "Scan governor enabled: latency budget=%.1f ms, max ray decimation=%u",
+        m_governor_max_latency_ms, m_governor_max_decimation);
+
   // Load sensor params from section: "LIDAR_SENSOR"
   std::thread hSensorThread;
   {
@@ -506,6 +541,7 @@ bool ICP_SLAM_App_Live::impl_get_next_observations(
   while (mrpt::system::timeDifference(t0, mrpt::Clock::now()) < 2.0)
   {
     CObservation2DRangeScan::Ptr new_obs;
+    size_t queueDepth = 0, skippedScans = 0;
     {
       mrpt::hwdrivers::CGenericSensor::TListObservations obs_copy;
       {
@@ -513,14 +549,54 @@ bool ICP_SLAM_App_Live::impl_get_next_observations(
         obs_copy = m_global_list_obs;
         m_global_list_obs.clear();
       }
-      // Keep the most recent laser scan:
-      for (auto it = obs_copy.rbegin(); !new_obs && it != obs_copy.rend(); ++it)
+      queueDepth = obs_copy.size();
+      // Keep the most recent laser scan, counting the backlogged ones we
+      // skip (they are redundant: superseded by a fresher scan):
+      for (auto it = obs_copy.rbegin(); it != obs_copy.rend(); ++it)
         if (it->second && IS_CLASS(*it->second, CObservation2DRangeScan))
-          new_obs = std::dynamic_pointer_cast<CObservation2DRangeScan>(it->second);
+        {
+          if (!new_obs)
+            new_obs = std::dynamic_pointer_cast<CObservation2DRangeScan>(it->second);
+          else
+            skippedScans++;
+        }
     }
 
     if (new_obs)
     {
+      // Closed-loop scan governor: when the map builder cannot keep up with
+      // the sensor rate, increase ray decimation so the worst-case pose
+      // latency stays bounded; back off once there is headroom again.
+      const double latency_ms =
+          1e3 * mrpt::system::timeDifference(new_obs->timestamp, mrpt::Clock::now());
+      unsigned int decim;
+      {
+        std::lock_guard<std::mutex> lck(m_cs_governorStats);
+        m_governorStats.queueDepth = queueDepth;
+        m_governorStats.droppedScans += skippedScans;
+        m_governorStats.lastLatencyMs = latency_ms;
+        decim = m_governorStats.currentDecimation;
+        if (m_governor_max_latency_ms > 0)
+        {
+          const double budget = m_governor_max_latency_ms;
+          const double cost = m_governorStats.avgProcessingTimeMs;
+          if (cost > budget || latency_ms > budget)
+            decim = std::min(2 * decim, m_governor_max_decimation);
+          else if (decim > 1 && cost < 0.4 * budget && latency_ms < 0.5 * budget)
+            decim /= 2;
+          if (decim != m_governorStats.currentDecimation)
+            MRPT_LOG_DEBUG_FMT(
+                "[governor] ray decimation %u -> %u (cost=%.1f ms, "
+                "latency=%.1f ms, budget=%.1f ms, queue=%u)",
+                m_governorStats.currentDecimation, decim, cost, latency_ms, budget,
+                static_cast<unsigned int>(queueDepth));
+          m_governorStats.currentDecimation = decim;
+        }
+      }
+
+      if (decim > 1 && new_obs->getScanSize() >= 2 * decim)
+        new_obs = decimate_scan_rays(*new_obs, decim);
+
       observation = std::move(new_obs);
       return true;
     }
@@ -538,6 +614,25 @@ bool ICP_SLAM_App_Live::impl_get_next_observations(
   MRPT_END
 }
 
+void ICP_SLAM_App_Live::impl_on_observation_processed(double processingTimeSec)
+{
+  const double t_ms = 1e3 * processingTimeSec;
+  std::lock_guard<std::mutex> lck(m_cs_governorStats);
+  m_governorStats.lastProcessingTimeMs = t_ms;
+  // Smoothed per-scan cost (EWMA), so one slow ICP step does not make the
+  // governor overreact:
+  constexpr double alpha = 0.2;
+  m_governorStats.avgProcessingTimeMs = m_governorStats.avgProcessingTimeMs == 0
+      ? t_ms
+      : (1 - alpha) * m_governorStats.avgProcessingTimeMs + alpha * t_ms;
+}
+
+ICP_SLAM_App_Live::TGovernorStats ICP_SLAM_App_Live::governorStats() const
+{
+  std::lock_guard<std::mutex> lck(m_cs_governorStats);
+  return m_governorStats;
+}
+
 void ICP_SLAM_App_Live::SensorThread(ICP_SLAM_App_Live::TThreadParams tp)
 {
   using namespace mrpt::hwdrivers;
@@ -189,7 +189,7 @@ void RBPF_SLAM_App_Base::run()
     for (auto& m_particle : mapBuilder->mapPDF.m_particles)
     {
       CRBPFParticleData* part_d = m_particle.d.get();
-      CMultiMetricMap& mmap = part_d->mapTillNow;
+      CMultiMetricMap& mmap = part_d->mapTillNow.write();
       mrpt::maps::COccupancyGridMap2D::Ptr it_grid =
           mmap.mapByClass<mrpt::maps::COccupancyGridMap2D>();
       ASSERTMSG_(
@@ -27,9 +27,14 @@
 //
 #include <mrpt/3rdparty/tclap/CmdLine.h>
 #include <mrpt/apps/RawlogEditApp.h>
+#include <mrpt/io/CFileInputStream.h>
+#include <mrpt/io/lazy_load_path.h>
+#include <mrpt/obs/CRawlogStreamReader.h>
 #include <mrpt/system/os.h>
 
 #include <memory>
+#include <set>
+#include <thread>
 
 #include "rawlog-edit-declarations.h"
 
@@ -209,6 +214,197 @@ TCLAP::ValueArg<std::string> arg_select_label(
 
 TCLAP::SwitchArg arg_quiet("q", "quiet", "Terse output", cmd, false);
 
+TCLAP::ValueArg<unsigned int> arg_parallel(
+    "",
+    "parallel",
+    "Process the rawlog with N parallel worker threads (N=0: one per CPU "
+    "core). The input is split at entry boundaries using the side-car rawlog "
+    "index (see mrpt::obs::CRawlogStreamReader), each shard is processed "
+    "concurrently, and the per-shard outputs are merged back in order.\n"
+    "Only honored by per-entry operations that write an output rawlog "
+    "(e.g. --externalize, --remove-label); operations needing cross-entry "
+    "state (e.g. --cut) always run serially, as does any gz-compressed "
+    "input, which cannot be sharded.",
+    false,
+    0,
+    "N",
+    cmd);
+
+// See rawlog-edit-declarations.h
+thread_local std::string TParallelWorkerContext::output_file_override;
+thread_local std::string TParallelWorkerContext::external_dir_override;
+
+// Ops safe for the sharded --parallel pipeline: per-entry, stateless
+// transforms whose only cross-entry interaction is the output rawlog stream,
+// which the coordinator re-merges in input order. Anything with cross-entry
+// state (--cut) or with per-sensor output files (the exporters) stays on the
+// serial path.
+static bool opSupportsParallel(const std::string& op)
+{
+  static const std::set<std::string> whitelist = {
+      "externalize",   "remove-label",  "keep-label",
+      "remap-timestamps", "camera-params", "sensors-pose",
+      "generate-3d-pointclouds", "undistort"};
+  return whitelist.count(op) != 0;
+}
+
+static void copyFileRange(
+    mrpt::io::CFileInputStream& in, const uint64_t nBytes, mrpt::io::CFileOutputStream& out)
+{
+  std::vector<uint8_t> buf(1 << 20);
+  uint64_t remaining = nBytes;
+  while (remaining != 0)
+  {
+    const auto toRead = static_cast<size_t>(std::min<uint64_t>(buf.size(), remaining));
+    const size_t nRead = in.Read(buf.data(), toRead);
+    ASSERT_(nRead > 0);
+    out.Write(buf.data(), nRead);
+    remaining -= nRead;
+  }
+}
+
+// The sharded --parallel pipeline. Returns false if the input cannot be
+// sharded (e.g. a gz-compressed rawlog), so the caller falls back to the
+// serial path:
+static bool runParallelPipeline(
+    TOperationFunctor op,
+    const string& selected_op,
+    const string& input_rawlog,
+    const unsigned int requestedThreads,
+    bool verbose)
+{
+  using namespace mrpt::obs;
+
+  // Entry-boundary byte offsets, from the side-car rawlog index:
+  CRawlogStreamReader idx;
+  try
+  {
+    if (!idx.open(input_rawlog)) return false;
+  }
+  catch (const std::exception& e)
+  {
+    VERBOSE_COUT << "--parallel: cannot index the input (" << e.what()
+                 << "); falling back to serial processing.\n";
+    return false;
+  }
+  const size_t nEntries = idx.size();
+
+  size_t numThreads =
+      requestedThreads != 0 ? requestedThreads : std::max(1u, std::thread::hardware_concurrency());
+  numThreads = std::min(numThreads, nEntries);
+  if (numThreads <= 1) return false;  // nothing to gain
+
+  // Replicate the TOutputRawlogCreator checks, which the workers bypass:
+  if (!arg_output_file.isSet())
+    throw runtime_error(
+        "This operation requires an output file. Use '-o file' or "
+        "'--output file'.");
+  const string out_filename = arg_output_file.getValue();
+  if (fileExists(out_filename) && !arg_overwrite.getValue())
+    throw runtime_error(
+        string("*ABORTING*: Output file already exists: ") + out_filename +
+        string("\n. Select a different output path, remove the file or "
+               "force overwrite with '-w' or '--overwrite'."));
+
+  // For --externalize: pre-create the external files directory, shared by
+  // all the shards (the serial op ctor does this; see TParallelWorkerContext)
+  string externalDir;
+  if (selected_op == "externalize")
+  {
+    const string out_basedir = extractFileDirectory(out_filename);
+    externalDir = (out_basedir.empty() ? string() : (out_basedir + "/")) +
+                  extractFileName(out_filename) + string("_Images");
+    if (directoryExists(externalDir))
+      throw runtime_error(
+          string("*ABORTING*: Output directory for images already "
+                 "exists: ") +
+          externalDir +
+          string("\n. Select a different output path or remove the "
+                 "directory."));
+    mrpt::system::createDirectory(externalDir);
+    if (!fileExists(externalDir))
+      throw runtime_error(string("*ABORTING*: Couldn't create directory: ") + externalDir);
+    externalDir += "/";
+    mrpt::io::setLazyLoadPathBase(externalDir);
+  }
+
+  // Split the input at entry boundaries into per-shard temporary files:
+  const uint64_t inFileSize = mrpt::system::getFileSize(input_rawlog);
+  std::vector<uint64_t> shardBegin(numThreads), shardEnd(numThreads);
+  for (size_t k = 0; k < numThreads; k++)
+  {
+    const size_t firstEntry = (nEntries * k) / numThreads;
+    const size_t endEntry = (nEntries * (k + 1)) / numThreads;
+    shardBegin[k] = idx.entry(firstEntry).offset;
+    shardEnd[k] = (endEntry == nEntries) ? inFileSize : idx.entry(endEntry).offset;
+  }
+  idx.close();
+
+  VERBOSE_COUT << "--parallel: processing " << nEntries << " entries with " << numThreads
+               << " worker threads...\n";
+
+  std::vector<string> shardInFile(numThreads), shardOutFile(numThreads);
+  {
+    mrpt::io::CFileInputStream fin(input_rawlog);
+    for (size_t k = 0; k < numThreads; k++)
+    {
+      shardInFile[k] = mrpt::system::getTempFileName() + mrpt::format("_shard%03u.rawlog", (unsigned)k);
+      shardOutFile[k] = shardInFile[k] + ".out";
+      mrpt::io::CFileOutputStream fo(shardInFile[k]);
+      fin.Seek(shardBegin[k]);
+      copyFileRange(fin, shardEnd[k] - shardBegin[k], fo);
+    }
+  }
+
+  // Run the unmodified per-entry operation on each shard concurrently, each
+  // worker writing to its own temporary output via the thread-local
+  // overrides (workers run quietly to avoid interleaved console output):
+  std::vector<std::thread> workers;
+  std::vector<std::exception_ptr> errors(numThreads);
+  for (size_t k = 0; k < numThreads; k++)
+  {
+    workers.emplace_back(
+        [&, k]()
+        {
+          try
+          {
+            TParallelWorkerContext::output_file_override = shardOutFile[k];
+            TParallelWorkerContext::external_dir_override = externalDir;
+            CFileGZInputStream in_shard(shardInFile[k]);
+            op(in_shard, cmd, false /*verbose*/);
+          }
+          catch (...)
+          {
+            errors[k] = std::current_exception();
+          }
+        });
+  }
+  for (auto& t : workers) t.join();
+
+  for (size_t k = 0; k < numThreads; k++) mrpt::system::deleteFile(shardInFile[k]);
+  for (size_t k = 0; k < numThreads; k++)
+  {
+    if (!errors[k]) continue;
+    for (size_t j = 0; j < numThreads; j++) mrpt::system::deleteFile(shardOutFile[j]);
+    std::rethrow_exception(errors[k]);
+  }
+
+  // Ordered merge of the shard outputs (concatenated gzip members form a
+  // valid gzip stream, so this is a plain byte-wise concatenation):
+  {
+    mrpt::io::CFileOutputStream fout(out_filename);
+    for (size_t k = 0; k < numThreads; k++)
+    {
+      mrpt::io::CFileInputStream fi(shardOutFile[k]);
+      copyFileRange(fi, fi.getTotalBytesCount(), fout);
+    }
+  }
+  for (size_t k = 0; k < numThreads; k++) mrpt::system::deleteFile(shardOutFile[k]);
+
+  VERBOSE_COUT << "--parallel: done, merged output saved to: " << out_filename << "\n";
+  return true;
+}
+
 void RawlogEditApp::run(int argc, const char** argv)
 {
   vector<std::unique_ptr<TCLAP::Arg>> arg_ops;
@@ -586,6 +782,24 @@ void RawlogEditApp::run(int argc, const char** argv)
       ops_functors.find(selected_op) != ops_functors.end(),
       "Internal error: Unknown operation functor!");
 
+  // Sharded multi-threaded pipeline?
+  if (arg_parallel.isSet())
+  {
+    if (opSupportsParallel(selected_op))
+    {
+      if (runParallelPipeline(
+              ops_functors[selected_op], selected_op, input_rawlog, arg_parallel.getValue(),
+              verbose))
+        return;  // done.
+      // else: could not shard the input; fall through to the serial path.
+    }
+    else
+    {
+      VERBOSE_COUT << "--parallel: operation '" << selected_op
+                   << "' needs cross-entry state; running serially.\n";
+    }
+  }
+
   // Call the selected functor:
   ops_functors[selected_op](fil_input, cmd, verbose);
 
@@ -597,17 +811,26 @@ void RawlogEditApp::run(int argc, const char** argv)
 // ======================================================================
 TOutputRawlogCreator::TOutputRawlogCreator()
 {
-  if (!arg_output_file.isSet())
-    throw runtime_error(
-        "This operation requires an output file. Use '-o file' or "
-        "'--output file'.");
-
-  out_rawlog_filename = arg_output_file.getValue();
-  if (fileExists(out_rawlog_filename) && !arg_overwrite.getValue())
-    throw runtime_error(
-        string("*ABORTING*: Output file already exists: ") + out_rawlog_filename +
-        string("\n. Select a different output path, remove the file or "
-               "force overwrite with '-w' or '--overwrite'."));
+  if (!TParallelWorkerContext::output_file_override.empty())
+  {
+    // --parallel worker thread: write to a per-shard temporary file; the
+    // coordinator already ran the checks below on the final output name.
+    out_rawlog_filename = TParallelWorkerContext::output_file_override;
+  }
+  else
+  {
+    if (!arg_output_file.isSet())
+      throw runtime_error(
+          "This operation requires an output file. Use '-o file' or "
+          "'--output file'.");
+
+    out_rawlog_filename = arg_output_file.getValue();
+    if (fileExists(out_rawlog_filename) && !arg_overwrite.getValue())
+      throw runtime_error(
+          string("*ABORTING*: Output file already exists: ") + out_rawlog_filename +
+          string("\n. Select a different output path, remove the file or "
+                 "force overwrite with '-w' or '--overwrite'."));
+  }
 
   if (!out_rawlog_io.open(out_rawlog_filename))
     throw runtime_error(string("*ABORTING*: Cannot open output file: ") + out_rawlog_filename);
@@ -35,6 +35,23 @@ struct TOutputRawlogCreator
   TOutputRawlogCreator();
 };
 
+/** Per-worker-thread overrides used by the `--parallel` sharded pipeline
+ * (see RawlogEditApp.cpp). Empty strings mean the normal, serial behavior.
+ */
+struct TParallelWorkerContext
+{
+  /** If non-empty, TOutputRawlogCreator writes here (a per-shard temporary
+   * file, merged in order by the coordinator) instead of to the `-o`
+   * argument, and skips the already-exists checks. */
+  static thread_local std::string output_file_override;
+
+  /** If non-empty, ops that create a directory of external files
+   * (--externalize) reuse this already-created directory, shared by all the
+   * shards, instead of deriving and creating one from the output file name.
+   * Must end in `/`. */
+  static thread_local std::string external_dir_override;
+};
+
 // ======================================================================
 //  Search for a specific command-line argument.
 // Return false if not not set, an exception if args doesn't exist
@@ -55,6 +55,15 @@ DECLARE_OP_FUNCTION(op_externalize)
 
       mrpt::obs::CObservation3DRangeScan::EXTERNALS_AS_TEXT(m_external_txt);
 
+      // Sharded --parallel run? The coordinator already created the
+      // directory, shared by all the worker threads, and set the lazy-load
+      // path base:
+      if (!TParallelWorkerContext::external_dir_override.empty())
+      {
+        outDir = TParallelWorkerContext::external_dir_override;
+        return;
+      }
+
       // Create the default "/Images" directory.
       const string out_rawlog_basedir = extractFileDirectory(outrawlog.out_rawlog_filename);
 
@@ -538,6 +538,24 @@ class CKalmanFilterCapable : public mrpt::system::COutputLogger
     // Do nothing in this base class.
   }
 
+  /** If this returns true, the EKF update stage (only for kfEKFNaive) is
+   * restricted to the state entries marked in out_active_mask (resized by the
+   * callee to the current state length): the mean and the covariance block of
+   * the active entries are corrected, while cross-covariances towards the
+   * inactive part of the state are left untouched until a later full update.
+   * This turns the per-step cost from O(N²) into O(local²) in large SLAM
+   * problems where observations only involve a local submap; see
+   * CRangeBearingKFSLAM::TOptions::submapConditionalUpdates for a user of
+   * this hook. The entries actually involved in the observation (vehicle and
+   * observed landmarks) are always forced into the active set.
+   * Default implementation returns false: full dense update.
+   * \note [New in MRPT 2.14.5]
+   */
+  virtual bool OnGetUpdateStateMask([[maybe_unused]] std::vector<bool>& out_active_mask) const
+  {
+    return false;  // Do nothing in this base class.
+  }
+
   /** This method is called after the prediction and after the update, to give
    * the user an opportunity to normalize the state vector (eg, keep angles
    * within -pi,pi range) if the application requires it.
@@ -585,6 +603,12 @@ class CKalmanFilterCapable : public mrpt::system::COutputLogger
   KFMatrix m_S_1;          // Inverse of m_S
   KFMatrix m_dh_dx_full_obs;
   KFMatrix m_aux_K_dh_dx;
+  KFVector m_ytilde;        // Stacked innovations (FULL KF update)
+  KFMatrix m_S_observed;    // Reordered subset of m_S (FULL KF update)
+  std::vector<size_t> m_S_idxs;
+  KFMatrix m_aux_pkk;       // Scratch for the covariance update
+  KFVector m_Kij;           // Per-scalar Kalman gain (kfEKFAlaDavison)
+  vector_KFArray_OBS m_pred_obs;
 
  protected:
   /** The main entry point, executes one complete step: prediction + update.
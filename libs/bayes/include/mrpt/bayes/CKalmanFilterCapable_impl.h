@@ -381,7 +381,7 @@ void CKalmanFilterCapable<VEH_SIZE, OBS_SIZE, FEAT_SIZE, ACT_SIZE, KFTYPE>::runO
       ASSERTDEB_(N_pred == 1);
       ASSERTDEB_(m_S.cols() == OBS_SIZE);
 
-      m_S = m_Hxs[0].asEigen() * m_pkk.asEigen() * m_Hxs[0].asEigen().transpose() + R.asEigen();
+      m_S = m_Hxs[0] * m_pkk * m_Hxs[0].transpose() + R;
     }
 
     m_timLogger.leave("KF:6.build m_S");
@@ -469,7 +469,7 @@ void CKalmanFilterCapable<VEH_SIZE, OBS_SIZE, FEAT_SIZE, ACT_SIZE, KFTYPE>::runO
           for (size_t IKF_iteration = 0; IKF_iteration < nKF_iterations; IKF_iteration++)
           {
             // Compute ytilde = OBS - PREDICTION
-            KFVector ytilde(OBS_SIZE * N_upd);
+            m_ytilde.resize(OBS_SIZE * N_upd);
             size_t ytilde_idx = 0;
 
             // TODO: Use a Matrix view of "dh_dx_full" instead of
@@ -477,14 +477,14 @@ void CKalmanFilterCapable<VEH_SIZE, OBS_SIZE, FEAT_SIZE, ACT_SIZE, KFTYPE>::runO
             m_dh_dx_full_obs.setZero(
                 N_upd * OBS_SIZE,
                 VEH_SIZE + FEAT_SIZE * N_map);  // Init to zeros.
-            KFMatrix S_observed;                // The KF "m_S" matrix: A
+            // m_S_observed is the KF "m_S" matrix: A
             // re-ordered, subset, version of
             // the prediction m_S:
 
             if (FEAT_SIZE != 0)
             {  // SLAM problems:
-              std::vector<size_t> S_idxs;
-              S_idxs.reserve(OBS_SIZE * N_upd);
+              m_S_idxs.clear();
+              m_S_idxs.reserve(OBS_SIZE * N_upd);
 
               // const size_t row_len = VEH_SIZE + FEAT_SIZE *
               // N_map;
@@ -513,26 +513,26 @@ void CKalmanFilterCapable<VEH_SIZE, OBS_SIZE, FEAT_SIZE, ACT_SIZE, KFTYPE>::runO
                 //(assoc_idx_in_pred*OBS_SIZE,0, OBS_SIZE,
                 // row_len);
 
-                m_dh_dx_full_obs.template block<OBS_SIZE, VEH_SIZE>(S_idxs.size(), 0) =
+                m_dh_dx_full_obs.template block<OBS_SIZE, VEH_SIZE>(m_S_idxs.size(), 0) =
                     m_Hxs[assoc_idx_in_pred].asEigen();
                 m_dh_dx_full_obs.template block<OBS_SIZE, FEAT_SIZE>(
-                    S_idxs.size(), VEH_SIZE + assoc_idx_in_map * FEAT_SIZE) =
+                    m_S_idxs.size(), VEH_SIZE + assoc_idx_in_map * FEAT_SIZE) =
                     m_Hys[assoc_idx_in_pred].asEigen();
 
-                // S_idxs.size() is used as counter for
+                // m_S_idxs.size() is used as counter for
                 // "m_dh_dx_full_obs".
                 for (size_t k = 0; k < OBS_SIZE; k++)
-                  S_idxs.push_back(assoc_idx_in_pred * OBS_SIZE + k);
+                  m_S_idxs.push_back(assoc_idx_in_pred * OBS_SIZE + k);
 
                 // ytilde_i = Z[i] - m_all_predictions[i]
                 KFArray_OBS ytilde_i = m_Z[i];
                 OnSubstractObservationVectors(
                     ytilde_i, m_all_predictions[m_predictLMidxs[assoc_idx_in_pred]]);
-                for (size_t k = 0; k < OBS_SIZE; k++) ytilde[ytilde_idx++] = ytilde_i[k];
+                for (size_t k = 0; k < OBS_SIZE; k++) m_ytilde[ytilde_idx++] = ytilde_i[k];
               }
               // Extract the subset that is involved in this
               // observation:
-              mrpt::math::extractSubmatrixSymmetrical(m_S, S_idxs, S_observed);
+              mrpt::math::extractSubmatrixSymmetrical(m_S, m_S_idxs, m_S_observed);
             }
             else
             {  // Non-SLAM problems:
@@ -542,24 +542,88 @@ void CKalmanFilterCapable<VEH_SIZE, OBS_SIZE, FEAT_SIZE, ACT_SIZE, KFTYPE>::runO
               m_dh_dx_full_obs = m_Hxs[0];  // Was: dh_dx_full
               KFArray_OBS ytilde_i = m_Z[0];
               OnSubstractObservationVectors(ytilde_i, m_all_predictions[0]);
-              for (size_t k = 0; k < OBS_SIZE; k++) ytilde[ytilde_idx++] = ytilde_i[k];
+              for (size_t k = 0; k < OBS_SIZE; k++) m_ytilde[ytilde_idx++] = ytilde_i[k];
               // Extract the subset that is involved in this
               // observation:
-              S_observed = m_S;
+              m_S_observed = m_S;
+            }
+
+            // Optional conditional (partial) update: restrict the correction
+            // to an active subset of the state, leaving cross-covariances
+            // towards the rest of the map untouched until a later full
+            // update (see OnGetUpdateStateMask()). Plain EKF only: IKF
+            // iterations always take the dense path below.
+            std::vector<bool> active_mask;
+            if (FEAT_SIZE != 0 && nKF_iterations == 1 && OnGetUpdateStateMask(active_mask))
+            {
+              m_timLogger.enter("KF:8.update stage:1.FULLKF:partial update");
+
+              ASSERT_EQUAL_(active_mask.size(), static_cast<size_t>(m_pkk.rows()));
+
+              // The entries with nonzero columns in the observation Jacobian
+              // (vehicle + observed landmarks) must be active in any case:
+              std::vector<size_t> obs_cols;
+              obs_cols.reserve(VEH_SIZE + FEAT_SIZE * N_upd);
+              for (size_t k = 0; k < VEH_SIZE; k++) obs_cols.push_back(k);
+              for (int assoc : mapIndicesForKFUpdate)
+                for (size_t k = 0; k < FEAT_SIZE; k++)
+                  obs_cols.push_back(VEH_SIZE + assoc * FEAT_SIZE + k);
+              for (size_t c : obs_cols) active_mask[c] = true;
+
+              std::vector<size_t> active;
+              active.reserve(active_mask.size());
+              for (size_t c = 0; c < active_mask.size(); c++)
+                if (active_mask[c]) active.push_back(c);
+
+              const size_t nAct = active.size(), nObsCols = obs_cols.size(),
+                           nObsRows = OBS_SIZE * N_upd;
+
+              // Gather the nonzero Jacobian columns and P(active, obs_cols):
+              Eigen::Matrix<KFTYPE, Eigen::Dynamic, Eigen::Dynamic> Hnz(nObsRows, nObsCols),
+                  P_act_obs(nAct, nObsCols);
+              for (size_t j = 0; j < nObsCols; j++)
+              {
+                const size_t c = obs_cols[j];
+                for (size_t r = 0; r < nObsRows; r++) Hnz(r, j) = m_dh_dx_full_obs(r, c);
+                for (size_t r = 0; r < nAct; r++) P_act_obs(r, j) = m_pkk(active[r], c);
+              }
+
+              // Kalman gain restricted to the active rows:
+              //   K_act = P(active,obs_cols) * Hnz^t * S^-1
+              m_S_1 = m_S_observed.inverse_LLt();
+              const Eigen::Matrix<KFTYPE, Eigen::Dynamic, Eigen::Dynamic> K_act =
+                  P_act_obs * Hnz.transpose() * m_S_1.asEigen();
+
+              // Mean: only the active entries change:
+              const Eigen::Matrix<KFTYPE, Eigen::Dynamic, 1> dx = K_act * m_ytilde.asEigen();
+              for (size_t r = 0; r < nAct; r++) m_xkk[active[r]] += dx[r];
+
+              // Covariance: correct the active x active block only,
+              //   P_AA -= K_act * Hnz * P(obs_cols,active),
+              // with P(obs_cols,active) = P(active,obs_cols)^t by symmetry:
+              const Eigen::Matrix<KFTYPE, Eigen::Dynamic, Eigen::Dynamic> dP =
+                  K_act * (Hnz * P_act_obs.transpose());
+              for (size_t r = 0; r < nAct; r++)
+                for (size_t c = 0; c < nAct; c++) m_pkk(active[r], active[c]) -= dP(r, c);
+
+              m_timLogger.leave("KF:8.update stage:1.FULLKF:partial update");
+              continue;  // Skip the dense update
             }
 
             // Compute the full K matrix:
             // ------------------------------
             m_timLogger.enter("KF:8.update stage:1.FULLKF:build K");
 
-            m_K.setSize(m_pkk.rows(), S_observed.cols());
+            m_K.setSize(m_pkk.rows(), m_S_observed.cols());
 
-            // K = m_pkk * (~dh_dx) * m_S.inverse_LLt() );
-            m_K.asEigen() = m_pkk.asEigen() * m_dh_dx_full_obs.asEigen().transpose();
+            // Inverse of m_S_observed -> m_S_1
+            m_S_1 = m_S_observed.inverse_LLt();
 
-            // Inverse of S_observed -> m_S_1
-            m_S_1 = S_observed.inverse_LLt();
-            m_K.asEigen() *= m_S_1.asEigen();
+            // K = m_pkk * (~dh_dx) * m_S.inverse_LLt() );
+            // One lazy expression: evaluated straight into m_K, without the
+            // extra temporary + copy that the former two-step `=` then `*=`
+            // evaluation required:
+            m_K.asEigen() = m_pkk * m_dh_dx_full_obs.transpose() * m_S_1;
 
             m_timLogger.leave("KF:8.update stage:1.FULLKF:build K");
 
@@ -567,7 +631,8 @@ void CKalmanFilterCapable<VEH_SIZE, OBS_SIZE, FEAT_SIZE, ACT_SIZE, KFTYPE>::runO
             if (nKF_iterations == 1)
             {
               m_timLogger.enter("KF:8.update stage:2.FULLKF:update xkk");
-              m_xkk.asEigen() += (m_K * ytilde).eval();
+              // (lazy product: evaluated as a single GEMV into m_xkk)
+              m_xkk.asEigen() += m_K * m_ytilde;
               m_timLogger.leave("KF:8.update stage:2.FULLKF:update xkk");
             }
             else
@@ -577,7 +642,7 @@ void CKalmanFilterCapable<VEH_SIZE, OBS_SIZE, FEAT_SIZE, ACT_SIZE, KFTYPE>::runO
               auto HAx_column = KFVector(m_dh_dx_full_obs * (m_xkk - xkk_0));
 
               m_xkk = xkk_0;
-              m_xkk.asEigen() += m_K * (ytilde - HAx_column);
+              m_xkk.asEigen() += m_K * (m_ytilde - HAx_column);
 
               m_timLogger.leave("KF:8.update stage:2.FULLKF:iter.update xkk");
             }
@@ -609,7 +674,10 @@ void CKalmanFilterCapable<VEH_SIZE, OBS_SIZE, FEAT_SIZE, ACT_SIZE, KFTYPE>::runO
                 }
               }
 
-              m_pkk = m_aux_K_dh_dx * m_pkk;
+              // Evaluate into the scratch member and swap storages, so no
+              // full-covariance temporary is allocated each iteration:
+              m_aux_pkk.matProductOf_AB(m_aux_K_dh_dx, m_pkk);
+              m_pkk.swap(m_aux_pkk);
 
               m_timLogger.leave("KF:8.update stage:3.FULLKF:update Pkk");
             }
@@ -650,13 +718,12 @@ void CKalmanFilterCapable<VEH_SIZE, OBS_SIZE, FEAT_SIZE, ACT_SIZE, KFTYPE>::runO
 
             // Compute just the part of the Jacobian that we need
             // using the current updated m_xkk:
-            vector_KFArray_OBS pred_obs;
-            OnObservationModel(std::vector<size_t>(1, idxInTheFilter), pred_obs);
-            ASSERTDEB_(pred_obs.size() == 1);
+            OnObservationModel(std::vector<size_t>(1, idxInTheFilter), m_pred_obs);
+            ASSERTDEB_(m_pred_obs.size() == 1);
 
             // ytilde = observation - prediction
             KFArray_OBS ytilde = m_Z[obsIdx];
-            OnSubstractObservationVectors(ytilde, pred_obs[0]);
+            OnSubstractObservationVectors(ytilde, m_pred_obs[0]);
 
             // Jacobians:
             // dh_dx: already is (N_pred*OBS_SIZE) x (VEH_SIZE +
@@ -719,79 +786,56 @@ void CKalmanFilterCapable<VEH_SIZE, OBS_SIZE, FEAT_SIZE, ACT_SIZE, KFTYPE>::runO
               // R:
               KFTYPE Sij = R(j, j);
 
-              // TERM 1:
-              for (size_t k = 0; k < VEH_SIZE; k++)
-              {
-                KFTYPE accum = 0;
-                for (size_t q = 0; q < VEH_SIZE; q++) accum += Hx(j, q) * m_pkk(q, k);
-                Sij += Hx(j, k) * accum;
-              }
-
-              // TERM 2:
-              KFTYPE term2 = 0;
-              for (size_t k = 0; k < VEH_SIZE; k++)
-              {
-                KFTYPE accum = 0;
-                for (size_t q = 0; q < FEAT_SIZE; q++) accum += Hy(j, q) * m_pkk(idx_off + q, k);
-                term2 += Hx(j, k) * accum;
-              }
-              Sij += 2 * term2;
-
-              // TERM 3:
-              for (size_t k = 0; k < FEAT_SIZE; k++)
-              {
-                KFTYPE accum = 0;
-                for (size_t q = 0; q < FEAT_SIZE; q++)
-                  accum += Hy(j, q) * m_pkk(idx_off + q, idx_off + k);
-                Sij += Hy(j, k) * accum;
-              }
+              // Fixed-width block views into m_pkk and the Jacobians, so
+              // all the products below are evaluated by Eigen with
+              // compile-time dimensions and no temporaries:
+              auto P = m_pkk.asEigen();
+              const auto Hx_e = Hx.asEigen();
+              const auto Hy_e = Hy.asEigen();
+              const auto Hxj = Hx_e.row(j);
+              const auto Hyj = Hy_e.row(j);
+
+              // TERM 1: Hxj * Pxx * Hxj^t
+              Sij +=
+                  (Hxj * P.template block<VEH_SIZE, VEH_SIZE>(0, 0) * Hxj.transpose())(0, 0);
+              // TERM 2: 2 * Hyj * Pyx * Hxj^t
+              Sij += 2 * (Hyj * P.template block<FEAT_SIZE, VEH_SIZE>(idx_off, 0) *
+                          Hxj.transpose())(0, 0);
+              // TERM 3: Hyj * Pyy * Hyj^t
+              Sij += (Hyj * P.template block<FEAT_SIZE, FEAT_SIZE>(idx_off, idx_off) *
+                      Hyj.transpose())(0, 0);
 
               // Compute the Kalman gain "Kij" for this
               // observation element:
               // -->  K = m_pkk * (~dh_dx) * m_S.inverse_LLt() );
-              size_t N = m_pkk.cols();
-              vector<KFTYPE> Kij(N);
-
-              for (size_t k = 0; k < N; k++)
-              {
-                KFTYPE K_tmp = 0;
-
-                // dhi_dxv term
-                size_t q;
-                for (q = 0; q < VEH_SIZE; q++) K_tmp += m_pkk(k, q) * Hx(j, q);
-
-                // dhi_dyi term
-                for (q = 0; q < FEAT_SIZE; q++) K_tmp += m_pkk(k, idx_off + q) * Hy(j, q);
-
-                Kij[k] = K_tmp / Sij;
-              }  // end for k
+              // Two tall GEMVs over the fixed-width column strips of m_pkk:
+              const size_t N = m_pkk.cols();
+              m_Kij.resize(N);
+              m_Kij.asEigen().noalias() =
+                  (P.template middleCols<VEH_SIZE>(0) * Hxj.transpose() +
+                   P.template middleCols<FEAT_SIZE>(idx_off) * Hyj.transpose()) /
+                  Sij;
 
               // Update the state vector m_xkk:
               //  x' = x + Kij * ytilde(ij)
-              for (size_t k = 0; k < N; k++) m_xkk[k] += Kij[k] * ytilde[j];
+              m_xkk.asEigen() += m_Kij.asEigen() * ytilde[j];
 
               // Update the covariance Pkk:
-              // P' =  P - Kij * Sij * Kij^t
-              {
-                for (size_t k = 0; k < N; k++)
-                {
-                  for (size_t q = k; q < N; q++)  // Half matrix
-                  {
-                    m_pkk(k, q) -= Sij * Kij[k] * Kij[q];
-                    // It is symmetric
-                    m_pkk(q, k) = m_pkk(k, q);
-                  }
+              // P' =  P - Kij * Sij * Kij^t   (symmetric rank-1 update)
+              P.noalias() -= (Sij * m_Kij.asEigen()) * m_Kij.asEigen().transpose();
 
 #if defined(_DEBUG) || (MRPT_ALWAYS_CHECKS_DEBUG)
-                  if (m_pkk(k, k) < 0)
-                  {
-                    m_pkk.saveToTextFile("Pkk_err.txt");
-                    mrpt::io::vectorToTextFile(Kij, "Kij.txt");
-                    ASSERT_(m_pkk(k, k) > 0);
-                  }
-#endif
+              for (size_t k = 0; k < N; k++)
+              {
+                if (m_pkk(k, k) < 0)
+                {
+                  m_pkk.saveToTextFile("Pkk_err.txt");
+                  mrpt::io::vectorToTextFile(
+                      std::vector<KFTYPE>(&m_Kij[0], &m_Kij[0] + N), "Kij.txt");
+                  ASSERT_(m_pkk(k, k) > 0);
                 }
               }
+#endif
 
               m_timLogger.leave("KF:8.update stage:2.ScalarAtOnce.update");
             }  // end for j
@@ -161,6 +161,26 @@ class CParticleFilter : public mrpt::system::COutputLogger
      * perform rejection sampling, but just the most-likely (ML) particle
      * found in the preliminary weight-determination stage. */
     bool pfAuxFilterOptimal_MLE{false};
+
+    /** Number of worker threads over which to shard the per-particle
+     * observation-likelihood evaluations of the weight-update stage
+     * (default=1: serial evaluation). Particle weights are independent of
+     * each other, so this stage parallelizes embarrassingly; each worker
+     * thread uses its own thread_local mrpt::random generator and the
+     * sharding is deterministic, so results are reproducible.
+     * Currently honored by the pfStandardProposal implementation in
+     * mrpt::slam::PF_implementation. */
+    uint16_t parallelUpdateNumThreads{1};
+
+    /** If enabled, the resampling stage reuses the storage of surviving
+     * particles in place and deep-copies only the particles that are
+     * actually duplicated, instead of rebuilding the whole particle list
+     * (see CParticleFilterCapable::performSubstitutionInPlace). This
+     * avoids per-resample allocation storms with heavy per-particle
+     * payloads, e.g. RBPF map hypotheses. The ordering of particles
+     * within the set may differ from the default method (default=false)
+     */
+    bool resampleInPlace{false};
   };
 
   /** Statistics for being returned from the "execute" method. */
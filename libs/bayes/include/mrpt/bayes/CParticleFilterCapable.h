@@ -176,6 +176,23 @@ class CParticleFilterCapable
    */
   virtual void performSubstitution(const std::vector<size_t>& indx) = 0;
 
+  /** In-place variant of performSubstitution(): surviving particles (those
+   * selected at least once in "indx") keep their current storage, and only
+   * the particles that are actually duplicated get deep-copied, avoiding
+   * the reallocation of the whole particle list on each resample.
+   * Note that the ordering of particles within the set after calling this
+   * may differ from that of performSubstitution().
+   * The default implementation just forwards to performSubstitution(); see
+   * the actual in-place implementation in CParticleFilterDataImpl.
+   *  \param indx The indices of current m_particles to be saved as the new
+   * m_particles set.
+   * \sa CParticleFilter::TParticleFilterOptions::resampleInPlace
+   */
+  virtual void performSubstitutionInPlace(const std::vector<size_t>& indx)
+  {
+    performSubstitution(indx);
+  }
+
   /** Normalize the (logarithmic) weights, such as the maximum weight is zero.
    * \param out_max_log_w If provided, will return with the maximum log_w
    * before normalizing, such as new_weights = old_weights - max_log_w.
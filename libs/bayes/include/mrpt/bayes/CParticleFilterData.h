@@ -149,6 +149,50 @@ struct CParticleFilterDataImpl : public CParticleFilterCapable
     MRPT_END
   }
 
+  /** In-place implementation of the substitution (see base class docs):
+   * survivors keep their storage untouched and each extra copy of a
+   * duplicated particle overwrites the slot of a discarded one, so only
+   * the actually-duplicated particles are cloned. */
+  void performSubstitutionInPlace(const std::vector<size_t>& indx) override
+  {
+    MRPT_START
+    auto& parts = derived().m_particles;
+    const size_t M = parts.size();
+
+    // Changing the particle count requires rebuilding the list anyway:
+    if (indx.size() != M)
+    {
+      performSubstitution(indx);
+      return;
+    }
+
+    // Number of copies requested of each of the current particles:
+    std::vector<uint32_t> counts(M, 0);
+    for (const size_t idx : indx)
+    {
+      ASSERT_LT_(idx, M);
+      counts[idx]++;
+    }
+
+    // Survivors (counts[i]>0) stay where they are; each *extra* copy of a
+    // survivor overwrites the slot of a discarded particle (counts[i]==0),
+    // which is the only point where particle data is actually cloned:
+    size_t nextFreeSlot = 0;
+    for (size_t i = 0; i < M; i++)
+    {
+      for (uint32_t c = 1; c < counts[i]; c++)
+      {
+        while (counts[nextFreeSlot] != 0) ++nextFreeSlot;
+        parts[nextFreeSlot].log_w = parts[i].log_w;
+        // Deep copy of the payload (for POINTER storage, the copy_ptr<>
+        // "=" operator clones the pointee):
+        parts[nextFreeSlot].d = parts[i].d;
+        counts[nextFreeSlot] = 1;  // Mark the slot as used
+      }
+    }
+    MRPT_END
+  }
+
 };  // end CParticleFilterDataImpl<>
 
 /** This template class declares the array of particles and its internal data,
@@ -45,6 +45,16 @@ struct CProbabilityParticleBase
 template <class T>
 struct CProbabilityParticle<T, particle_storage_mode::POINTER> : public CProbabilityParticleBase
 {
+  CProbabilityParticle() = default;
+  /** Copying a particle deep-copies its payload (copy_ptr<> clones the
+   * pointee), while moving just transfers ownership of the pointer.
+   * Resampling relies on the latter to reuse surviving particles' storage
+   * instead of cloning it. */
+  CProbabilityParticle(const CProbabilityParticle&) = default;
+  CProbabilityParticle(CProbabilityParticle&&) = default;
+  CProbabilityParticle& operator=(const CProbabilityParticle&) = default;
+  CProbabilityParticle& operator=(CProbabilityParticle&&) = default;
+
   /** The data associated with this particle. The use of copy_ptr<> allows
    * relying on compiler-generated copy ctor, etc. */
   mrpt::containers::copy_ptr<T> d{};
@@ -54,6 +64,10 @@ template <class T>
 struct CProbabilityParticle<T, particle_storage_mode::VALUE> : public CProbabilityParticleBase
 {
   CProbabilityParticle() = default;
+  CProbabilityParticle(const CProbabilityParticle&) = default;
+  CProbabilityParticle(CProbabilityParticle&&) = default;
+  CProbabilityParticle& operator=(const CProbabilityParticle&) = default;
+  CProbabilityParticle& operator=(CProbabilityParticle&&) = default;
   CProbabilityParticle(const T& data, const double logw) : CProbabilityParticleBase(logw), d(data)
   {
   }
@@ -12,6 +12,10 @@
 #include <mrpt/core/exceptions.h>
 #include <mrpt/random.h>
 
+#include <algorithm>
+#include <thread>
+#include <vector>
+
 namespace mrpt
 {
 /// \ingroup mrpt_bayes_grp
@@ -100,6 +104,146 @@ class CRejectionSamplingCapable
     MRPT_END
   }
 
+  /** Batched, parallel variant of rejectionSampling(), for problems with low
+   * acceptance rates and/or expensive likelihood functions.
+   *
+   *  Candidates are drawn in batches whose size is adapted from the observed
+   * acceptance rate, with the acceptance thresholds pre-drawn in bulk, and
+   * their likelihoods evaluated concurrently by `numThreads` worker threads
+   * (0 = one per CPU core). Since rejection-sampling candidates are i.i.d.,
+   * any accepted candidate can fill any output slot, so the result follows
+   * the same distribution as rejectionSampling().
+   *
+   *  Drawing candidates (RS_drawFromProposal) remains single-threaded, since
+   * proposals typically use the shared global random generator; only
+   * RS_observationLikelihood() is invoked concurrently, so to use
+   * numThreads>1 the derived class must implement it as a thread-safe
+   * (read-only) method.
+   *
+   * \param desiredSamples The number of desired samples to generate
+   * \param outSamples The output samples.
+   * \param timeoutTrials Maximum number of trials **per desired sample**; if
+   * the total budget (desiredSamples*timeoutTrials) is exhausted, the
+   * remaining slots are filled with the best candidate seen so far, weighted
+   * by its likelihood, as in rejectionSampling().
+   * \param numThreads Number of likelihood-evaluation threads (0 = one per
+   * CPU core; 1 = serial evaluation).
+   *
+   * \note [New in MRPT 2.14.5]
+   * \sa rejectionSampling
+   */
+  void rejectionSamplingBatched(
+      size_t desiredSamples,
+      std::vector<TParticle>& outSamples,
+      size_t timeoutTrials = 1000,
+      size_t numThreads = 0)
+  {
+    MRPT_START
+
+    if (numThreads == 0) numThreads = std::max(1u, std::thread::hardware_concurrency());
+
+    // Set output size (as in rejectionSampling()):
+    if (outSamples.size() != desiredSamples)
+    {
+      outSamples.clear();
+      outSamples.resize(desiredSamples);
+      for (auto& p : outSamples) p.d.reset(new TStateSpace);
+    }
+    if (!desiredSamples) return;
+
+    const size_t maxTotalTrials = desiredSamples * timeoutTrials;
+    size_t totalTrials = 0, accepted = 0;
+
+    // Best candidate seen so far, used to fill slots on timeout:
+    double bestLik = -1e250;
+    TStateSpace bestVal;
+
+    // Initial batch size; grown/shrunk from the observed acceptance rate:
+    size_t K = std::max<size_t>(desiredSamples, 64);
+
+    std::vector<TStateSpace> candidates;
+    std::vector<double> liks, thresholds;
+
+    while (accepted < desiredSamples && totalTrials < maxTotalTrials)
+    {
+      K = std::min(K, maxTotalTrials - totalTrials);
+
+      // 1) Draw the batch of candidates and their acceptance thresholds:
+      candidates.resize(K);
+      for (auto& c : candidates) RS_drawFromProposal(c);
+      thresholds.resize(K);
+      mrpt::random::getRandomGenerator().drawUniformVector(thresholds, 0.0, 0.999);
+
+      // 2) Evaluate all the likelihoods, concurrently if allowed:
+      liks.assign(K, 0.0);
+      const size_t nT = std::min<size_t>(numThreads, std::max<size_t>(1, K / 64));
+      if (nT <= 1)
+      {
+        for (size_t i = 0; i < K; i++) liks[i] = RS_observationLikelihood(candidates[i]);
+      }
+      else
+      {
+        std::vector<std::exception_ptr> excps(nT);
+        std::vector<std::thread> workers;
+        workers.reserve(nT);
+        for (size_t t = 0; t < nT; t++)
+        {
+          const size_t i0 = (K * t) / nT, i1 = (K * (t + 1)) / nT;
+          workers.emplace_back(
+              [&, t, i0, i1]()
+              {
+                try
+                {
+                  for (size_t i = i0; i < i1; i++)
+                    liks[i] = RS_observationLikelihood(candidates[i]);
+                }
+                catch (...)
+                {
+                  excps[t] = std::current_exception();
+                }
+              });
+        }
+        for (auto& w : workers) w.join();
+        for (auto& e : excps)
+          if (e) std::rethrow_exception(e);
+      }
+
+      // 3) Accept/reject:
+      for (size_t i = 0; i < K && accepted < desiredSamples; i++)
+      {
+        ASSERT_(liks[i] >= 0 && liks[i] <= 1);
+        totalTrials++;
+        if (liks[i] > bestLik)
+        {
+          bestLik = liks[i];
+          bestVal = candidates[i];
+        }
+        if (liks[i] >= thresholds[i])
+        {
+          *outSamples[accepted].d = candidates[i];
+          outSamples[accepted].log_w = 0;  // log(1.0)
+          accepted++;
+        }
+      }
+
+      // 4) Adapt the batch size to the still-missing samples, with some
+      // head-room for the uncertainty in the estimated acceptance rate:
+      const double accRate = std::max(1e-3, double(accepted) / double(totalTrials));
+      const size_t missing = desiredSamples - accepted;
+      K = std::clamp<size_t>(size_t(1.2 * missing / accRate), 64, 1 << 20);
+    }
+
+    // Timeout: fill any remaining slot with the best candidate, down-weighted
+    // by its likelihood (same convention as rejectionSampling()):
+    for (; accepted < desiredSamples; accepted++)
+    {
+      *outSamples[accepted].d = bestVal;
+      outSamples[accepted].log_w = log(bestLik);
+    }
+
+    MRPT_END
+  }
+
  protected:
   /** Generates one sample, drawing from some proposal distribution.
    */
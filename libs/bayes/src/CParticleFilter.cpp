@@ -128,6 +128,13 @@ void CParticleFilter::TParticleFilterOptions::saveToConfigFile(
       pfAuxFilterStandard_FirstStageWeightsMonteCarlo,
       "Only for PF_algorithm==pfAuxiliaryPFStandard");
   MRPT_SAVE_CONFIG_VAR_COMMENT(pfAuxFilterOptimal_MLE, "See doxygen docs.");
+  MRPT_SAVE_CONFIG_VAR_COMMENT(
+      parallelUpdateNumThreads,
+      "Worker threads for the weight-update stage (default=1: serial)");
+  MRPT_SAVE_CONFIG_VAR_COMMENT(
+      resampleInPlace,
+      "Reuse surviving particles' storage while resampling, cloning only "
+      "duplicated particles (default=false)");
 }
 
 /*---------------------------------------------------------------
@@ -163,6 +170,8 @@ void CParticleFilter::TParticleFilterOptions::loadFromConfigFile(
   MRPT_LOAD_CONFIG_VAR(
       pfAuxFilterStandard_FirstStageWeightsMonteCarlo, bool, iniFile, section.c_str());
   MRPT_LOAD_CONFIG_VAR(pfAuxFilterOptimal_MLE, bool, iniFile, section.c_str());
+  MRPT_LOAD_CONFIG_VAR(parallelUpdateNumThreads, int, iniFile, section.c_str());
+  MRPT_LOAD_CONFIG_VAR(resampleInPlace, bool, iniFile, section.c_str());
 
   MRPT_END
 }
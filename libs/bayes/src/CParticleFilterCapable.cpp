@@ -44,7 +44,10 @@ void CParticleFilterCapable::performResampling(
   computeResampling(PF_options.resamplingMethod, log_ws, indxs, out_particle_count);
 
   // And perform the particle replacement:
-  performSubstitution(indxs);
+  if (PF_options.resampleInPlace)
+    performSubstitutionInPlace(indxs);
+  else
+    performSubstitution(indxs);
 
   // Finally, equal weights:
   for (size_t i = 0; i < out_particle_count; i++) setW(i, 0 /* Logarithmic weight */);
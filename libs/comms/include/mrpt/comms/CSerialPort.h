@@ -8,9 +8,14 @@
    +------------------------------------------------------------------------+ */
 #pragma once
 
+#include <mrpt/containers/circular_buffer.h>
 #include <mrpt/io/CStream.h>
 #include <mrpt/system/CTicTac.h>
 
+#include <cstdint>
+#include <utility>
+#include <vector>
+
 namespace mrpt::comms
 {
 /** A communications serial port implementing the interface mrpt::io::CStream.
@@ -126,6 +131,21 @@ class CSerialPort : public mrpt::io::CStream
    */
   size_t Read(void* Buffer, size_t Count) override;
 
+  /** Enables (or disables) buffered read-ahead: whenever data is read from
+   * the port, any further bytes already waiting in the OS queue are slurped
+   * into an internal ring buffer with one extra syscall, and subsequent
+   * Read() / ReadString() calls are served from that ring without entering
+   * the kernel. This cuts the syscall count dramatically for drivers that
+   * consume the port in small chunks (e.g. NMEA or SCIP parsers).
+   * Only effective on POSIX systems; a no-op on Windows.
+   * \note [New in MRPT 2.14.5] \sa Read, ReadString */
+  void enableReadAhead(bool enabled = true, size_t bufferSize = 16384)
+  {
+    m_readAheadEnabled = enabled;
+    if (enabled) m_rxReadAhead = mrpt::containers::circular_buffer<uint8_t>(bufferSize);
+  }
+  bool isReadAheadEnabled() const { return m_readAheadEnabled; }
+
   /** Reads one text line from the serial port in POSIX "canonical mode".
    *  This method reads from the serial port until one of the characters in
    * \a eol are found.
@@ -143,6 +163,15 @@ class CSerialPort : public mrpt::io::CStream
 
   // See base class docs
   size_t Write(const void* Buffer, size_t Count) override;
+
+  /** Writes several buffers to the port as one operation, using a single
+   * writev() syscall per kernel round-trip on POSIX systems (sequential
+   * Write() calls elsewhere). Useful to send a command header + payload
+   * without concatenating them in user space first.
+   * \return The total number of bytes written.
+   * \exception std::exception On communication errors
+   * \note [New in MRPT 2.14.5] \sa Write */
+  size_t WriteBatch(const std::vector<std::pair<const void*, size_t>>& buffers);
   /** not applicable in a serial port */
   uint64_t Seek(int64_t off, CStream::TSeekOrigin o = sFromBeginning) override;
   /** not applicable in a serial port */
@@ -158,6 +187,15 @@ class CSerialPort : public mrpt::io::CStream
   int m_baudRate{0};
   int m_totalTimeout_ms{0}, m_interBytesTimeout_ms{0};
   mrpt::system::CTicTac m_timer;
+
+  /** See enableReadAhead() */
+  bool m_readAheadEnabled{false};
+  /** RX read-ahead ring, re-created by enableReadAhead() */
+  mrpt::containers::circular_buffer<uint8_t> m_rxReadAhead{16};
+
+  /** Slurps any bytes already waiting in the OS queue into m_rxReadAhead
+   * (POSIX only; no-op elsewhere) */
+  void internal_fillReadAhead();
 #ifdef _WIN32
   // WINDOWS
   void* hCOM{nullptr};
@@ -0,0 +1,147 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+#pragma once
+
+#include <mrpt/io/CStream.h>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace mrpt
+{
+namespace comms
+{
+/** A single-producer, single-consumer ring buffer placed in a named
+ * shared-memory segment, for passing serialized objects between processes on
+ * the same host without going through the network stack.
+ *
+ * The class implements mrpt::io::CStream, so the usual
+ * mrpt::serialization::archiveFrom() wrapper works on it: the producer process
+ * serializes objects straight into the shared segment and the consumer
+ * deserializes straight out of it, with no intermediate buffers or socket
+ * copies. For large payloads (e.g. the point buffers of
+ * mrpt::obs::CObservationPointCloud), writeInPlace()/readInPlace() expose the
+ * mapped memory itself so the data can be built or consumed in place.
+ *
+ * Usage: one process calls create() (it owns the segment and unlinks it on
+ * close()), the other calls attach(). Exactly one writer and one reader are
+ * supported; Read() and Write() block while the buffer is empty or full,
+ * respectively, polling the peer's position counter.
+ *
+ * \note Implemented with POSIX shared memory (`shm_open()`); not available on
+ * Windows builds, where all methods throw.
+ * \note [New in MRPT 2.14.5]
+ * \ingroup mrpt_comms_grp
+ */
+class CSharedMemoryRingBuffer : public mrpt::io::CStream
+{
+ public:
+  CSharedMemoryRingBuffer() = default;
+
+  /** Destructor: calls close() */
+  ~CSharedMemoryRingBuffer() override;
+
+  CSharedMemoryRingBuffer(const CSharedMemoryRingBuffer&) = delete;
+  CSharedMemoryRingBuffer& operator=(const CSharedMemoryRingBuffer&) = delete;
+
+  /** Creates (or resets, if a stale segment with the same name exists) the
+   * shared-memory segment and maps it into this process.
+   * \param name Segment name, e.g. "mrpt_pointclouds". A leading '/' is
+   * added if missing, as required by `shm_open()`.
+   * \param capacityBytes Size of the ring data area. Writes larger than this
+   * can never complete and raise an exception.
+   * \exception std::exception On failure to create or map the segment.
+   */
+  void create(const std::string& name, size_t capacityBytes);
+
+  /** Maps an existing segment, previously set up with create() by another
+   * process.
+   * \exception std::exception If the segment does not exist or its header
+   * is not a valid ring buffer of a compatible version.
+   */
+  void attach(const std::string& name);
+
+  /** Unmaps the segment, waking up a peer blocked on Read() or Write(); the
+   * creator side also unlinks the segment name. Safe to call if not open. */
+  void close();
+
+  bool isOpen() const { return m_hdr != nullptr; }
+
+  /** Removes a named segment left over by a crashed process. */
+  static void remove(const std::string& name);
+
+  /** Blocking read of an exact number of bytes from the ring.
+   * \return Count, or less than Count only if the peer closed the channel. */
+  size_t Read(void* Buffer, size_t Count) override;
+
+  /** Blocking write: returns once all Count bytes fit into the ring.
+   * \exception std::exception If the peer closed the channel. */
+  size_t Write(const void* Buffer, size_t Count) override;
+
+  /** This virtual method has no effect in this implementation over a ring
+   * buffer, and its use raises an exception */
+  uint64_t Seek(int64_t off, CStream::TSeekOrigin org = sFromBeginning) override;
+
+  /** This virtual method has no effect in this implementation over a ring
+   * buffer, and its use raises an exception */
+  uint64_t getTotalBytesCount() const override;
+
+  /** This virtual method has no effect in this implementation over a ring
+   * buffer, and its use raises an exception */
+  uint64_t getPosition() const override;
+
+  /** Size of the ring data area, as given to create(). */
+  size_t capacity() const;
+
+  /** Bytes ready to be read without blocking. */
+  size_t bytesAvailable() const;
+
+  /** Bytes that can be written without blocking. */
+  size_t freeSpace() const;
+
+  /** Signature of the user callbacks of writeInPlace() and readInPlace():
+   * the region is handed out as up to two spans, since it may wrap around
+   * the end of the ring (`part2`/`len2` are nullptr/0 if it does not). */
+  template <typename PTR>
+  using span_callback_t = std::function<void(PTR part1, size_t len1, PTR part2, size_t len2)>;
+
+  /** Zero-copy write: blocks until nBytes of ring space are free, then
+   * invokes the callback with pointers into the mapped segment where the
+   * payload must be constructed; the bytes are published to the reader when
+   * the callback returns.
+   * \exception std::exception If the peer closed the channel. */
+  void writeInPlace(size_t nBytes, const span_callback_t<void*>& fillInPlace);
+
+  /** Zero-copy read: blocks until nBytes are available, then invokes the
+   * callback with pointers to the payload inside the mapped segment; the
+   * bytes are released back to the writer when the callback returns.
+   * \exception std::exception If the peer closed the channel before nBytes
+   * were available. */
+  void readInPlace(size_t nBytes, const span_callback_t<const void*>& consumeInPlace);
+
+ private:
+  struct TShmHeader;  // The control block at the start of the segment
+
+  /** Blocks until the condition holds or the peer closes; returns false on
+   * close. */
+  bool waitFor(const std::function<bool()>& pred) const;
+
+  TShmHeader* m_hdr{nullptr};
+  /** The ring data area, right after the header within the mapping. */
+  uint8_t* m_data{nullptr};
+  int m_fd = -1;
+  std::string m_name;
+  /** true if this side called create() and must unlink on close() */
+  bool m_owner = false;
+
+};  // End of class def.
+
+}  // namespace comms
+}  // namespace mrpt
@@ -8,15 +8,20 @@
    +------------------------------------------------------------------------+ */
 #pragma once
 
+#include <mrpt/containers/mpsc_queue.h>
 #include <mrpt/typemeta/TTypeName.h>
 #include <mrpt/typemeta/TTypeName_stl.h>
 
 #include <any>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
 #include <functional>
 #include <iostream>
 #include <list>
 #include <memory>  // shared_ptr
 #include <mutex>
+#include <thread>
 #include <unordered_map>
 
 namespace mrpt::comms
@@ -85,6 +90,25 @@ class Topic : public std::enable_shared_from_this<Topic>
   }
 
   void publish(const std::any& any);
+
+  /** Enables asynchronous delivery for this topic: publishAsync() then
+   * just moves the message (typically a `shared_ptr` to the payload, so the
+   * hand-off is zero-copy) into a bounded per-topic queue and returns, and
+   * a per-topic worker thread invokes the subscribers. When the queue is
+   * full, the *oldest* queued message is dropped (see droppedMessages()),
+   * so a slow subscriber backpressures into frame drops instead of
+   * blocking the publisher. \note [New in MRPT 2.14.5] \sa publishAsync */
+  void enableAsyncDelivery(size_t maxQueueLength = 16);
+
+  /** Publishes a message through the asynchronous queue; requires a prior
+   * call to enableAsyncDelivery(), otherwise it falls back to the
+   * synchronous publish(). \note [New in MRPT 2.14.5] */
+  void publishAsync(std::any&& any);
+
+  /** Number of messages discarded so far by the drop-oldest policy of the
+   * asynchronous queue. \note [New in MRPT 2.14.5] */
+  uint64_t droppedMessages() const { return m_queueDropped; }
+
   void cleanupSubscriber(std::list<std::weak_ptr<Subscriber>>::iterator it);
 
   template <typename CLEANUP>
@@ -97,6 +121,23 @@ class Topic : public std::enable_shared_from_this<Topic>
   std::mutex m_mutex;
   std::list<std::weak_ptr<Subscriber>> m_subs;
   std::function<void()> m_cleanup;
+
+  /** @name Asynchronous delivery queue (see enableAsyncDelivery())
+   * @{ */
+  /** Lock-free hand-off from publishers to the worker; m_queueMtx/CV are
+   * only used to put the worker to sleep when idle, never to protect the
+   * messages themselves. */
+  mrpt::containers::mpsc_queue<std::any> m_queue;
+  std::atomic<size_t> m_queuePending{0};
+  std::mutex m_queueMtx;
+  std::condition_variable m_queueCV;
+  std::atomic<size_t> m_queueMaxLen{0};  //!< 0 = async delivery disabled
+  std::atomic<uint64_t> m_queueDropped{0};
+  bool m_workerShouldEnd{false};
+  std::thread m_worker;
+
+  void deliveryThread();
+  /** @} */
 };
 
 /** The central directory of existing topics for pub/sub */
@@ -20,6 +20,7 @@
 #include <fcntl.h>      /* File control definitions */
 #include <sys/ioctl.h>  // FIONREAD,...
 #include <sys/time.h>   // gettimeofday
+#include <sys/uio.h>    // writev()
 #include <termios.h>    /* POSIX terminal control definitions */
 #include <unistd.h>     /* UNIX standard function definitions */
 
@@ -654,6 +655,18 @@ size_t CSerialPort::Read(void* Buffer, size_t Count)
   m_timer.Tic();
 
   size_t alreadyRead = 0;
+
+  // Serve first from the read-ahead ring, if enabled:
+  if (m_readAheadEnabled)
+  {
+    const size_t fromRing = min(m_rxReadAhead.size(), Count);
+    if (fromRing)
+    {
+      m_rxReadAhead.pop_many(static_cast<uint8_t*>(Buffer), fromRing);
+      alreadyRead = fromRing;
+    }
+  }
+
   int leftTime = m_totalTimeout_ms - (int)(m_timer.Tac() * 1000);
 
   while (alreadyRead < Count && leftTime >= 0)
@@ -703,12 +716,37 @@ size_t CSerialPort::Read(void* Buffer, size_t Count)
     if (nRead > 0) leftTime = max(leftTime, m_interBytesTimeout_ms);
   }
 
+  // Read-ahead: if more bytes are already waiting in the OS queue, slurp
+  // them into the ring with one extra syscall so subsequent small reads
+  // are served without entering the kernel:
+  if (m_readAheadEnabled) internal_fillReadAhead();
+
   //    cout << "READ DONE: "<< alreadyRead << endl;
   return alreadyRead;
 #endif
   MRPT_END
 }
 
+void CSerialPort::internal_fillReadAhead()
+{
+#if !defined(_WIN32)
+  int waiting_bytes = 0;
+  if (ioctl(hCOM, FIONREAD, &waiting_bytes) < 0 || waiting_bytes <= 0) return;
+
+  size_t left = min((size_t)waiting_bytes, m_rxReadAhead.available());
+  uint8_t buf[4096];
+  while (left)
+  {
+    const size_t chunk = min(left, sizeof(buf));
+    const int nRead = ::read(hCOM, buf, chunk);
+    if (nRead <= 0) return;
+    m_rxReadAhead.push_many(buf, nRead);
+    left -= nRead;
+    if ((size_t)nRead < chunk) return;
+  }
+#endif
+}
+
 /** Reads one text line from the serial port in POSIX "canonical mode".
  *  This method reads from the serial port until one of the characters in \a
  * eol are found.
@@ -757,6 +795,19 @@ std::string CSerialPort::ReadString(
     // If we are still here, string is not finished:
     std::this_thread::sleep_for(1ms);  // Wait 1 more ms for new data to arrive.
 #else
+    // Serve from the read-ahead ring first, if enabled:
+    if (m_readAheadEnabled && m_rxReadAhead.size() != 0)
+    {
+      const char c = static_cast<char>(m_rxReadAhead.pop());
+      if (!strchr(eol_chars, c))
+      {
+        receivedStr.push_back(c);
+        continue;
+      }
+      // end of string!
+      return receivedStr;
+    }
+
     // Bytes waiting in the queue?
     // Check if we are still connected or there is an error...
     int waiting_bytes = 0;
@@ -867,6 +918,65 @@ size_t CSerialPort::Write(const void* Buffer, size_t Count)
   MRPT_END
 }
 
+size_t CSerialPort::WriteBatch(const std::vector<std::pair<const void*, size_t>>& buffers)
+{
+  MRPT_START
+  // Port must be open!
+  if (!isOpen()) THROW_EXCEPTION("The port is not open yet!");
+
+#ifdef _WIN32
+  size_t written = 0;
+  for (const auto& b : buffers) written += Write(b.first, b.second);
+  return written;
+#else
+  std::vector<iovec> iov;
+  iov.reserve(buffers.size());
+  size_t total = 0;
+  for (const auto& b : buffers)
+  {
+    if (!b.second) continue;
+    iov.push_back({const_cast<void*>(b.first), b.second});
+    total += b.second;
+  }
+  if (!total) return 0;
+
+  // One writev() per kernel round-trip; advance the iovec array past
+  // whatever each partial write consumed:
+  size_t written = 0, idx = 0;
+  while (written < total)
+  {
+    const ssize_t n = ::writev(hCOM, iov.data() + idx, iov.size() - idx);
+    if (n < 0)
+    {
+      if (errno == EAGAIN)
+      {
+        std::this_thread::sleep_for(1ms);
+        continue;
+      }
+      THROW_EXCEPTION_FMT("Error writing data to the serial port: %s", strerror(errno));
+    }
+    written += n;
+    size_t adv = n;
+    while (idx < iov.size() && adv >= iov[idx].iov_len)
+    {
+      adv -= iov[idx].iov_len;
+      idx++;
+    }
+    if (idx < iov.size() && adv)
+    {
+      iov[idx].iov_base = reinterpret_cast<char*>(iov[idx].iov_base) + adv;
+      iov[idx].iov_len -= adv;
+    }
+  }
+
+  // Make sure the queue is drained (see Write()):
+  ::tcdrain(hCOM);
+
+  return written;
+#endif
+  MRPT_END
+}
+
 void CSerialPort::purgeBuffers()
 {
   MRPT_START
@@ -874,6 +984,8 @@ void CSerialPort::purgeBuffers()
   // Port must be open!
   if (!isOpen()) THROW_EXCEPTION("The port is not open yet!");
 
+  m_rxReadAhead.clear();
+
 #ifdef _WIN32
   if (!PurgeComm(hCOM, PURGE_RXABORT | PURGE_RXCLEAR | PURGE_TXABORT | PURGE_TXCLEAR))
     THROW_EXCEPTION("Error during COM port purge");
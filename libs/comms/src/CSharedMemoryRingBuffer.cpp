@@ -0,0 +1,323 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include "comms-precomp.h"  // Precompiled headers
+//
+#include <mrpt/comms/CSharedMemoryRingBuffer.h>
+#include <mrpt/core/exceptions.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+// Linux, Apple
+#if defined(MRPT_OS_LINUX) || defined(MRPT_OS_APPLE)
+#define MRPT_HAS_POSIX_SHM 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#else
+#define MRPT_HAS_POSIX_SHM 0
+#endif
+
+using namespace mrpt::comms;
+using namespace std;
+
+static const uint32_t SHM_RING_MAGIC = 0x52494e47;  // "RING"
+static const uint32_t SHM_RING_VERSION = 1;
+
+/** The control block at the start of the shared segment. Positions are
+ * monotonically increasing byte counters (offset into the ring = pos %
+ * capacity), so empty/full are unambiguous without wasting a slot. */
+struct CSharedMemoryRingBuffer::TShmHeader
+{
+  uint32_t magic;
+  uint32_t version;
+  uint64_t capacity;
+  std::atomic<uint64_t> writePos;
+  std::atomic<uint64_t> readPos;
+  /** Set by close() on either side to wake up and fail the peer. */
+  std::atomic<uint32_t> closed;
+};
+
+#if MRPT_HAS_POSIX_SHM
+static std::string normalizedShmName(const std::string& name)
+{
+  ASSERT_(!name.empty());
+  return (name[0] == '/') ? name : ("/" + name);
+}
+#endif
+
+CSharedMemoryRingBuffer::~CSharedMemoryRingBuffer() { close(); }
+
+void CSharedMemoryRingBuffer::create(const std::string& name, size_t capacityBytes)
+{
+  MRPT_START
+#if MRPT_HAS_POSIX_SHM
+  ASSERT_(capacityBytes > 0);
+  close();
+
+  m_name = normalizedShmName(name);
+  m_fd = shm_open(m_name.c_str(), O_CREAT | O_RDWR, 0644);
+  if (m_fd < 0)
+    THROW_EXCEPTION_FMT(
+        "Error creating shared memory segment '%s': %s", m_name.c_str(), strerror(errno));
+
+  const size_t totalSize = sizeof(TShmHeader) + capacityBytes;
+  if (0 != ftruncate(m_fd, totalSize))
+  {
+    const std::string err = strerror(errno);
+    close();
+    THROW_EXCEPTION_FMT("Error sizing shared memory segment: %s", err.c_str());
+  }
+
+  void* p = mmap(nullptr, totalSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+  if (p == MAP_FAILED)
+  {
+    const std::string err = strerror(errno);
+    close();
+    THROW_EXCEPTION_FMT("Error mapping shared memory segment: %s", err.c_str());
+  }
+
+  m_hdr = static_cast<TShmHeader*>(p);
+  m_data = reinterpret_cast<uint8_t*>(m_hdr + 1);
+  m_owner = true;
+
+  // (Re)initialize the control block:
+  m_hdr->capacity = capacityBytes;
+  m_hdr->writePos.store(0);
+  m_hdr->readPos.store(0);
+  m_hdr->closed.store(0);
+  m_hdr->version = SHM_RING_VERSION;
+  // Written last: attach() on the peer can now accept the segment.
+  m_hdr->magic = SHM_RING_MAGIC;
+#else
+  THROW_EXCEPTION("Not available in this platform (requires POSIX shared memory)");
+#endif
+  MRPT_END
+}
+
+void CSharedMemoryRingBuffer::attach(const std::string& name)
+{
+  MRPT_START
+#if MRPT_HAS_POSIX_SHM
+  close();
+
+  m_name = normalizedShmName(name);
+  m_fd = shm_open(m_name.c_str(), O_RDWR, 0);
+  if (m_fd < 0)
+    THROW_EXCEPTION_FMT(
+        "Error opening shared memory segment '%s': %s", m_name.c_str(), strerror(errno));
+
+  struct stat st;
+  if (0 != fstat(m_fd, &st) || static_cast<size_t>(st.st_size) <= sizeof(TShmHeader))
+  {
+    close();
+    THROW_EXCEPTION_FMT("Shared memory segment '%s' is too small", m_name.c_str());
+  }
+
+  void* p = mmap(nullptr, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+  if (p == MAP_FAILED)
+  {
+    const std::string err = strerror(errno);
+    close();
+    THROW_EXCEPTION_FMT("Error mapping shared memory segment: %s", err.c_str());
+  }
+
+  m_hdr = static_cast<TShmHeader*>(p);
+  m_data = reinterpret_cast<uint8_t*>(m_hdr + 1);
+  m_owner = false;
+
+  if (m_hdr->magic != SHM_RING_MAGIC || m_hdr->version != SHM_RING_VERSION ||
+      sizeof(TShmHeader) + m_hdr->capacity != static_cast<uint64_t>(st.st_size))
+  {
+    close();
+    THROW_EXCEPTION_FMT(
+        "Segment '%s' is not a valid ring buffer of a compatible version", m_name.c_str());
+  }
+#else
+  THROW_EXCEPTION("Not available in this platform (requires POSIX shared memory)");
+#endif
+  MRPT_END
+}
+
+void CSharedMemoryRingBuffer::close()
+{
+#if MRPT_HAS_POSIX_SHM
+  if (m_hdr)
+  {
+    m_hdr->closed.store(1);
+    munmap(m_hdr, sizeof(TShmHeader) + m_hdr->capacity);
+    m_hdr = nullptr;
+    m_data = nullptr;
+  }
+  if (m_fd >= 0)
+  {
+    ::close(m_fd);
+    m_fd = -1;
+  }
+  if (m_owner && !m_name.empty()) shm_unlink(m_name.c_str());
+  m_owner = false;
+  m_name.clear();
+#endif
+}
+
+void CSharedMemoryRingBuffer::remove(const std::string& name)
+{
+#if MRPT_HAS_POSIX_SHM
+  shm_unlink(normalizedShmName(name).c_str());
+#else
+  THROW_EXCEPTION("Not available in this platform (requires POSIX shared memory)");
+#endif
+}
+
+size_t CSharedMemoryRingBuffer::capacity() const
+{
+  ASSERTMSG_(m_hdr, "The ring buffer is not open, use create() or attach() first");
+  return m_hdr->capacity;
+}
+
+size_t CSharedMemoryRingBuffer::bytesAvailable() const
+{
+  ASSERTMSG_(m_hdr, "The ring buffer is not open, use create() or attach() first");
+  return m_hdr->writePos.load(std::memory_order_acquire) -
+      m_hdr->readPos.load(std::memory_order_acquire);
+}
+
+size_t CSharedMemoryRingBuffer::freeSpace() const
+{
+  ASSERTMSG_(m_hdr, "The ring buffer is not open, use create() or attach() first");
+  return m_hdr->capacity - bytesAvailable();
+}
+
+bool CSharedMemoryRingBuffer::waitFor(const std::function<bool()>& pred) const
+{
+  // Spin briefly, then back off to a short sleep: a full futex-based wakeup
+  // is not worth the portability cost at the message rates this targets.
+  for (int spin = 0; !pred(); ++spin)
+  {
+    if (m_hdr->closed.load()) return pred();
+    if (spin > 1000) std::this_thread::sleep_for(std::chrono::microseconds(50));
+  }
+  return true;
+}
+
+void CSharedMemoryRingBuffer::writeInPlace(
+    size_t nBytes, const span_callback_t<void*>& fillInPlace)
+{
+  MRPT_START
+  ASSERTMSG_(m_hdr, "The ring buffer is not open, use create() or attach() first");
+  ASSERT_(nBytes <= m_hdr->capacity);
+  if (!nBytes) return;
+
+  if (!waitFor([this, nBytes]() { return freeSpace() >= nBytes; }))
+    THROW_EXCEPTION("Cannot write: the channel was closed by the peer");
+
+  const uint64_t wpos = m_hdr->writePos.load(std::memory_order_relaxed);
+  const size_t offset = wpos % m_hdr->capacity;
+  const size_t len1 = std::min(nBytes, static_cast<size_t>(m_hdr->capacity - offset));
+
+  fillInPlace(m_data + offset, len1, len1 < nBytes ? m_data : nullptr, nBytes - len1);
+
+  m_hdr->writePos.store(wpos + nBytes, std::memory_order_release);
+  MRPT_END
+}
+
+void CSharedMemoryRingBuffer::readInPlace(
+    size_t nBytes, const span_callback_t<const void*>& consumeInPlace)
+{
+  MRPT_START
+  ASSERTMSG_(m_hdr, "The ring buffer is not open, use create() or attach() first");
+  ASSERT_(nBytes <= m_hdr->capacity);
+  if (!nBytes) return;
+
+  if (!waitFor([this, nBytes]() { return bytesAvailable() >= nBytes; }))
+    THROW_EXCEPTION("Cannot read: the channel was closed by the peer");
+
+  const uint64_t rpos = m_hdr->readPos.load(std::memory_order_relaxed);
+  const size_t offset = rpos % m_hdr->capacity;
+  const size_t len1 = std::min(nBytes, static_cast<size_t>(m_hdr->capacity - offset));
+
+  consumeInPlace(m_data + offset, len1, len1 < nBytes ? m_data : nullptr, nBytes - len1);
+
+  m_hdr->readPos.store(rpos + nBytes, std::memory_order_release);
+  MRPT_END
+}
+
+size_t CSharedMemoryRingBuffer::Write(const void* Buffer, size_t Count)
+{
+  MRPT_START
+  ASSERTMSG_(m_hdr, "The ring buffer is not open, use create() or attach() first");
+  const auto* src = static_cast<const uint8_t*>(Buffer);
+  size_t remaining = Count;
+  // Large writes are streamed in capacity-sized pieces so serializing an
+  // object bigger than the ring still works:
+  while (remaining)
+  {
+    const size_t chunk = std::min(remaining, static_cast<size_t>(m_hdr->capacity));
+    writeInPlace(
+        chunk,
+        [&src](void* p1, size_t l1, void* p2, size_t l2)
+        {
+          std::memcpy(p1, src, l1);
+          if (l2) std::memcpy(p2, src + l1, l2);
+          src += l1 + l2;
+        });
+    remaining -= chunk;
+  }
+  return Count;
+  MRPT_END
+}
+
+size_t CSharedMemoryRingBuffer::Read(void* Buffer, size_t Count)
+{
+  MRPT_START
+  ASSERTMSG_(m_hdr, "The ring buffer is not open, use create() or attach() first");
+  auto* dst = static_cast<uint8_t*>(Buffer);
+  size_t done = 0;
+  while (done < Count)
+  {
+    // Consume data as it arrives; if the peer closed, drain whatever it
+    // left behind and return short:
+    if (!waitFor([this]() { return bytesAvailable() > 0; }) && bytesAvailable() == 0) return done;
+    const size_t chunk = std::min(Count - done, bytesAvailable());
+    readInPlace(
+        chunk,
+        [&dst](const void* p1, size_t l1, const void* p2, size_t l2)
+        {
+          std::memcpy(dst, p1, l1);
+          if (l2) std::memcpy(dst + l1, p2, l2);
+          dst += l1 + l2;
+        });
+    done += chunk;
+  }
+  return done;
+  MRPT_END
+}
+
+uint64_t CSharedMemoryRingBuffer::Seek(
+    [[maybe_unused]] int64_t off, [[maybe_unused]] CStream::TSeekOrigin org)
+{
+  THROW_EXCEPTION("This method has no effect in this class!");
+}
+
+uint64_t CSharedMemoryRingBuffer::getTotalBytesCount() const
+{
+  THROW_EXCEPTION("This method has no effect in this class!");
+}
+
+uint64_t CSharedMemoryRingBuffer::getPosition() const
+{
+  THROW_EXCEPTION("This method has no effect in this class!");
+}
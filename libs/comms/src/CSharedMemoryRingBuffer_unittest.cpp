@@ -0,0 +1,149 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/comms/CSharedMemoryRingBuffer.h>
+#include <mrpt/core/format.h>
+#include <mrpt/serialization/CArchive.h>
+#include <mrpt/serialization/stl_serialization.h>
+
+#include <cstring>
+#include <thread>
+
+#if !defined(_WIN32)
+#include <unistd.h>  // getpid()
+#endif
+
+#if !defined(_WIN32)
+
+using mrpt::comms::CSharedMemoryRingBuffer;
+
+static std::string uniqueSegmentName(const char* testName)
+{
+  return mrpt::format("mrpt_ut_%s_%u", testName, static_cast<unsigned>(::getpid()));
+}
+
+TEST(CSharedMemoryRingBuffer, archiveRoundTrip)
+{
+  const std::string segName = uniqueSegmentName("arch");
+
+  CSharedMemoryRingBuffer writer;
+  writer.create(segName, 4096);
+
+  const std::vector<float> refData = {1.0f, -2.5f, 3.25f, 1e9f};
+
+  std::thread producer(
+      [&]()
+      {
+        auto arch = mrpt::serialization::archiveFrom(writer);
+        arch << std::string("hello") << uint32_t(0xdeadbeef) << refData;
+      });
+
+  CSharedMemoryRingBuffer reader;
+  reader.attach(segName);
+  {
+    auto arch = mrpt::serialization::archiveFrom(reader);
+    std::string s;
+    uint32_t magic = 0;
+    std::vector<float> data;
+    arch >> s >> magic >> data;
+    EXPECT_EQ(s, "hello");
+    EXPECT_EQ(magic, 0xdeadbeefU);
+    EXPECT_EQ(data, refData);
+  }
+  producer.join();
+}
+
+TEST(CSharedMemoryRingBuffer, wrapAroundLargePayload)
+{
+  const std::string segName = uniqueSegmentName("wrap");
+
+  // A ring much smaller than the payload forces both wrap-around and
+  // blocking on a full buffer:
+  CSharedMemoryRingBuffer writer;
+  writer.create(segName, 256);
+
+  std::vector<uint8_t> tx(10000);
+  for (size_t i = 0; i < tx.size(); i++) tx[i] = static_cast<uint8_t>(i * 7 + 1);
+
+  std::thread producer([&]() { writer.Write(tx.data(), tx.size()); });
+
+  CSharedMemoryRingBuffer reader;
+  reader.attach(segName);
+  std::vector<uint8_t> rx(tx.size());
+  EXPECT_EQ(reader.Read(rx.data(), rx.size()), rx.size());
+  EXPECT_EQ(tx, rx);
+  producer.join();
+}
+
+TEST(CSharedMemoryRingBuffer, zeroCopyInPlace)
+{
+  const std::string segName = uniqueSegmentName("zcpy");
+
+  CSharedMemoryRingBuffer writer;
+  writer.create(segName, 1024);
+
+  CSharedMemoryRingBuffer reader;
+  reader.attach(segName);
+
+  // Build the payload directly inside the mapped segment:
+  const size_t N = 300;
+  writer.writeInPlace(
+      N,
+      [](void* p1, size_t l1, void* p2, size_t l2)
+      {
+        std::memset(p1, 0x42, l1);
+        if (l2) std::memset(p2, 0x42, l2);
+      });
+  EXPECT_EQ(reader.bytesAvailable(), N);
+
+  size_t seen = 0;
+  reader.readInPlace(
+      N,
+      [&seen](const void* p1, size_t l1, const void* p2, size_t l2)
+      {
+        const auto* b1 = static_cast<const uint8_t*>(p1);
+        for (size_t i = 0; i < l1; i++)
+          if (b1[i] == 0x42) seen++;
+        const auto* b2 = static_cast<const uint8_t*>(p2);
+        for (size_t i = 0; i < l2; i++)
+          if (b2[i] == 0x42) seen++;
+      });
+  EXPECT_EQ(seen, N);
+  EXPECT_EQ(reader.bytesAvailable(), 0U);
+}
+
+TEST(CSharedMemoryRingBuffer, closeUnblocksReader)
+{
+  const std::string segName = uniqueSegmentName("clos");
+
+  CSharedMemoryRingBuffer writer;
+  writer.create(segName, 128);
+
+  CSharedMemoryRingBuffer reader;
+  reader.attach(segName);
+
+  uint8_t partial[4] = {1, 2, 3, 4};
+  writer.Write(partial, sizeof(partial));
+
+  std::thread closer(
+      [&]()
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        writer.close();
+      });
+
+  // Ask for more than will ever arrive: the close() must unblock us with a
+  // short read of the drained bytes:
+  uint8_t rx[16];
+  EXPECT_EQ(reader.Read(rx, sizeof(rx)), sizeof(partial));
+  closer.join();
+}
+
+#endif  // !_WIN32
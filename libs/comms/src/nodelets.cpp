@@ -11,6 +11,8 @@
 //
 #include <mrpt/comms/nodelets.h>
 
+#include <deque>
+
 using namespace mrpt::comms;
 
 // ------- Subscriber --------------
@@ -30,7 +32,19 @@ Subscriber::Ptr Subscriber::create(
 void Subscriber::pub(const std::any& a) { m_func(a); }
 // ------- Topic --------------
 Topic::Topic(std::function<void()>&& cleanup) : m_cleanup(std::move(cleanup)) {}
-Topic::~Topic() { m_cleanup(); }
+Topic::~Topic()
+{
+  if (m_worker.joinable())
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_queueMtx);
+      m_workerShouldEnd = true;
+    }
+    m_queueCV.notify_all();
+    m_worker.join();
+  }
+  m_cleanup();
+}
 void Topic::publish(const std::any& any)
 {
   std::lock_guard<std::mutex> lock(m_mutex);
@@ -40,6 +54,72 @@ void Topic::publish(const std::any& any)
   }
 }
 
+void Topic::enableAsyncDelivery(size_t maxQueueLength)
+{
+  std::lock_guard<std::mutex> lock(m_queueMtx);
+  m_queueMaxLen = maxQueueLength;
+  if (maxQueueLength && !m_worker.joinable()) m_worker = std::thread(&Topic::deliveryThread, this);
+}
+
+void Topic::publishAsync(std::any&& any)
+{
+  if (m_queueMaxLen.load(std::memory_order_acquire) == 0)
+  {
+    // Async delivery not enabled: deliver synchronously.
+    publish(any);
+    return;
+  }
+
+  // Lock-free enqueue: publishers never contend with each other nor with
+  // the delivering worker. The bound (drop-oldest policy) is enforced by
+  // the worker when it drains the queue.
+  m_queue.push(std::move(any));
+  m_queuePending.fetch_add(1, std::memory_order_release);
+  {
+    // Empty critical section: pairs with the worker's predicate check so
+    // the notification cannot slip between its check and its wait.
+    std::lock_guard<std::mutex> lock(m_queueMtx);
+  }
+  m_queueCV.notify_one();
+}
+
+void Topic::deliveryThread()
+{
+  // Raw `this` is safe here: the dtor joins this thread before destruction
+  // (a shared_ptr self-capture would make the Topic immortal).
+  std::deque<std::any> local;
+  for (;;)
+  {
+    {
+      std::unique_lock<std::mutex> lock(m_queueMtx);
+      m_queueCV.wait(
+          lock,
+          [this]
+          { return m_workerShouldEnd || m_queuePending.load(std::memory_order_acquire) != 0; });
+      if (m_workerShouldEnd) return;
+    }
+
+    // Drain all pending messages with one atomic exchange:
+    const size_t n =
+        m_queue.consume_all([&](std::any&& msg) { local.emplace_back(std::move(msg)); });
+    m_queuePending.fetch_sub(n, std::memory_order_acq_rel);
+
+    // Drop-oldest policy:
+    const size_t maxLen = m_queueMaxLen.load(std::memory_order_acquire);
+    while (maxLen && local.size() > maxLen)
+    {
+      local.pop_front();
+      m_queueDropped++;
+    }
+
+    while (!local.empty())
+    {
+      publish(local.front());
+      local.pop_front();
+    }
+  }
+}
+
 void Topic::cleanupSubscriber(std::list<std::weak_ptr<Subscriber>>::iterator it)
 {
   std::lock_guard<std::mutex> lock(m_mutex);
@@ -0,0 +1,388 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+#pragma once
+
+#include <mrpt/containers/CDynamicGrid.h>  // internal::dynamic_grid_txt_saver
+#include <mrpt/core/round.h>
+
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace mrpt
+{
+namespace containers
+{
+/** A 2D grid of dynamic size with tiled-sparse storage: cells live in fixed
+ * 64x64 tiles that are allocated on the first write, tracked by a flat
+ * (dense) tile directory.
+ *
+ *  It mirrors the CDynamicGrid API (setSize/resize/cellByPos/cellByIndex/
+ * index transforms) so maps can switch backends with minimal changes, with
+ * these differences coming from the sparse storage:
+ *  - Unwritten areas cost no memory; reading them returns the default cell
+ *    value without allocating.
+ *  - Cell pointers returned by the non-const accessors stay valid across
+ *    resize(): tiles never move in memory, only the directory is rebuilt,
+ *    which also makes resize() O(allocated tiles) instead of O(cells).
+ *    To keep that property, grow operations extend the bounds by whole
+ *    tiles (the resulting grid may be slightly larger than requested).
+ *  - There is no contiguous data()/begin()/end(); bulk access goes through
+ *    the tile-wise visitors instead, which derived maps can also use to
+ *    distribute per-tile work across threads.
+ *
+ * \tparam T The type of each cell in the 2D grid.
+ * \note Defined in #include <mrpt/containers/CTiledDynamicGrid.h>
+ * \note [New in MRPT 2.14.5]
+ * \sa CDynamicGrid
+ * \ingroup mrpt_containers_grp
+ */
+template <class T>
+class CTiledDynamicGrid
+{
+ public:
+  /** Side length, in cells, of the (square) tiles */
+  static constexpr unsigned int TILE_SIZE = 64;
+
+  /** Constructor */
+  CTiledDynamicGrid(
+      double x_min = -10.,
+      double x_max = 10.,
+      double y_min = -10.,
+      double y_max = 10.,
+      double resolution = 0.1,
+      const T& defaultCellValue = T())
+  {
+    m_defaultValue = defaultCellValue;
+    setSize(x_min, x_max, y_min, y_max, resolution);
+  }
+
+  virtual ~CTiledDynamicGrid() = default;
+
+  /** Changes the size of the grid, ERASING all previous contents (all tiles
+   * are deallocated). If \a fill_value is given it becomes the new default
+   * cell value. \sa resize, fill */
+  void setSize(
+      const double x_min,
+      const double x_max,
+      const double y_min,
+      const double y_max,
+      const double resolution,
+      const T* fill_value = nullptr)
+  {
+    // Adjust sizes to adapt them to full sized cells according to the
+    // resolution:
+    m_x_min = resolution * round(x_min / resolution);
+    m_y_min = resolution * round(y_min / resolution);
+    m_x_max = resolution * round(x_max / resolution);
+    m_y_max = resolution * round(y_max / resolution);
+
+    m_resolution = resolution;
+
+    m_size_x = round((m_x_max - m_x_min) / m_resolution);
+    m_size_y = round((m_y_max - m_y_min) / m_resolution);
+
+    if (fill_value) m_defaultValue = *fill_value;
+
+    // Empty tile directory:
+    m_tiles_x = (m_size_x + TILE_SIZE - 1) / TILE_SIZE;
+    m_tiles_y = (m_size_y + TILE_SIZE - 1) / TILE_SIZE;
+    m_tiles.clear();
+    m_tiles.resize(m_tiles_x * m_tiles_y);
+  }
+
+  /** Erase the contents of all the cells, deallocating all tiles. */
+  void clear()
+  {
+    m_tiles.clear();
+    m_tiles.resize(m_tiles_x * m_tiles_y);
+  }
+
+  /** Fills all the cells with the same value. With tiled storage this just
+   * drops all tiles and replaces the default cell value, so it is O(tiles).
+   */
+  inline void fill(const T& value)
+  {
+    m_defaultValue = value;
+    clear();
+  }
+
+  /** Changes the size of the grid, maintaining previous contents.
+   *  Only the tile directory is rebuilt (old tiles are re-linked at their
+   * new directory slots), so this is O(allocated tiles) and existing cell
+   * pointers remain valid. The x_min/y_min bounds are extended by whole
+   * tiles, so the final grid may be slightly larger than requested.
+   * \note \a defaultValueNewCells becomes the new default cell value; cells
+   * of already-allocated, partially-used border tiles keep the default they
+   * were allocated with.
+   * \sa setSize
+   */
+  virtual void resize(
+      double new_x_min,
+      double new_x_max,
+      double new_y_min,
+      double new_y_max,
+      const T& defaultValueNewCells,
+      double additionalMarginMeters = 2.0)
+  {
+    // Is resize really necessary?
+    if (new_x_min >= m_x_min && new_y_min >= m_y_min && new_x_max <= m_x_max &&
+        new_y_max <= m_y_max)
+      return;
+
+    if (new_x_min > m_x_min) new_x_min = m_x_min;
+    if (new_x_max < m_x_max) new_x_max = m_x_max;
+    if (new_y_min > m_y_min) new_y_min = m_y_min;
+    if (new_y_max < m_y_max) new_y_max = m_y_max;
+
+    // Additional margin:
+    if (additionalMarginMeters > 0)
+    {
+      if (new_x_min < m_x_min) new_x_min = floor(new_x_min - additionalMarginMeters);
+      if (new_x_max > m_x_max) new_x_max = ceil(new_x_max + additionalMarginMeters);
+      if (new_y_min < m_y_min) new_y_min = floor(new_y_min - additionalMarginMeters);
+      if (new_y_max > m_y_max) new_y_max = ceil(new_y_max + additionalMarginMeters);
+    }
+
+    // Snap the min bounds so the old origin shifts by a whole number of
+    // tiles (this is what allows re-linking tiles instead of copying
+    // cells):
+    const double tileSpan = TILE_SIZE * m_resolution;
+    unsigned int extra_tiles_x = 0, extra_tiles_y = 0;
+    if (new_x_min < m_x_min)
+    {
+      extra_tiles_x = static_cast<unsigned int>(ceil((m_x_min - new_x_min) / tileSpan - 1e-6));
+      new_x_min = m_x_min - extra_tiles_x * tileSpan;
+    }
+    else
+      new_x_min = m_x_min;
+    if (new_y_min < m_y_min)
+    {
+      extra_tiles_y = static_cast<unsigned int>(ceil((m_y_min - new_y_min) / tileSpan - 1e-6));
+      new_y_min = m_y_min - extra_tiles_y * tileSpan;
+    }
+    else
+      new_y_min = m_y_min;
+
+    // Snap the max bounds to the resolution:
+    new_x_max = m_resolution * round(new_x_max / m_resolution);
+    new_y_max = m_resolution * round(new_y_max / m_resolution);
+
+    const size_t new_size_x = round((new_x_max - new_x_min) / m_resolution);
+    const size_t new_size_y = round((new_y_max - new_y_min) / m_resolution);
+    const size_t new_tiles_x = (new_size_x + TILE_SIZE - 1) / TILE_SIZE;
+    const size_t new_tiles_y = (new_size_y + TILE_SIZE - 1) / TILE_SIZE;
+
+    // Re-link old tiles into the new directory:
+    std::vector<std::unique_ptr<tile_t>> newTiles(new_tiles_x * new_tiles_y);
+    for (size_t ty = 0; ty < m_tiles_y; ty++)
+      for (size_t tx = 0; tx < m_tiles_x; tx++)
+      {
+        auto& old = m_tiles[tx + ty * m_tiles_x];
+        if (old) newTiles[(tx + extra_tiles_x) + (ty + extra_tiles_y) * new_tiles_x] = std::move(old);
+      }
+    m_tiles.swap(newTiles);
+
+    m_defaultValue = defaultValueNewCells;
+    m_x_min = new_x_min;
+    m_x_max = new_x_max;
+    m_y_min = new_y_min;
+    m_y_max = new_y_max;
+    m_size_x = new_size_x;
+    m_size_y = new_size_y;
+    m_tiles_x = new_tiles_x;
+    m_tiles_y = new_tiles_y;
+  }
+
+  /** Returns a pointer to the contents of a cell given by its coordinates,
+   * or nullptr if it is out of the map extensions. Allocates the tile on
+   * first access. */
+  inline T* cellByPos(double x, double y)
+  {
+    const int cx = x2idx(x);
+    const int cy = y2idx(y);
+    if (cx < 0 || cx >= static_cast<int>(m_size_x)) return nullptr;
+    if (cy < 0 || cy >= static_cast<int>(m_size_y)) return nullptr;
+    return &cellRef(cx, cy);
+  }
+  /** \overload (read-only: unwritten cells are served from the shared
+   * default value without allocating their tile) */
+  inline const T* cellByPos(double x, double y) const
+  {
+    const int cx = x2idx(x);
+    const int cy = y2idx(y);
+    if (cx < 0 || cx >= static_cast<int>(m_size_x)) return nullptr;
+    if (cy < 0 || cy >= static_cast<int>(m_size_y)) return nullptr;
+    return cellByIndex(cx, cy);
+  }
+
+  /** Returns a pointer to the contents of a cell given by its cell indexes,
+   * or nullptr if it is out of the map extensions. Allocates the tile on
+   * first access. */
+  inline T* cellByIndex(unsigned int cx, unsigned int cy)
+  {
+    if (cx >= m_size_x || cy >= m_size_y) return nullptr;
+    return &cellRef(cx, cy);
+  }
+
+  /** Returns a pointer to the contents of a cell given by its cell indexes,
+   * or nullptr if it is out of the map extensions. Unwritten cells are
+   * served from the shared default value without allocating their tile. */
+  inline const T* cellByIndex(unsigned int cx, unsigned int cy) const
+  {
+    if (cx >= m_size_x || cy >= m_size_y) return nullptr;
+    const auto& tile = m_tiles[(cx / TILE_SIZE) + (cy / TILE_SIZE) * m_tiles_x];
+    if (!tile) return &m_defaultValue;
+    return &(*tile)[(cx % TILE_SIZE) + (cy % TILE_SIZE) * TILE_SIZE];
+  }
+
+  /** @name Tile-wise access (bulk operations, parallelizable updates)
+   * @{ */
+
+  /** Number of tile columns of the directory */
+  inline size_t getTileCountX() const { return m_tiles_x; }
+  /** Number of tile rows of the directory */
+  inline size_t getTileCountY() const { return m_tiles_y; }
+  /** Whether the given tile has been allocated (i.e. some cell in it has
+   * been written to) */
+  inline bool isTileAllocated(size_t tx, size_t ty) const
+  {
+    return tx < m_tiles_x && ty < m_tiles_y && m_tiles[tx + ty * m_tiles_x] != nullptr;
+  }
+  /** Number of currently-allocated tiles */
+  size_t countAllocatedTiles() const
+  {
+    size_t n = 0;
+    for (const auto& t : m_tiles)
+      if (t) n++;
+    return n;
+  }
+
+  /** Raw storage of one tile (TILE_SIZE*TILE_SIZE cells, row-major), or
+   * nullptr if not allocated. Within a tile, cell (cx,cy) lives at offset
+   * `(cx%TILE_SIZE) + (cy%TILE_SIZE)*TILE_SIZE`. */
+  inline T* tileData(size_t tx, size_t ty)
+  {
+    if (tx >= m_tiles_x || ty >= m_tiles_y) return nullptr;
+    auto& tile = m_tiles[tx + ty * m_tiles_x];
+    return tile ? tile->data() : nullptr;
+  }
+  /// \overload
+  inline const T* tileData(size_t tx, size_t ty) const
+  {
+    if (tx >= m_tiles_x || ty >= m_tiles_y) return nullptr;
+    const auto& tile = m_tiles[tx + ty * m_tiles_x];
+    return tile ? tile->data() : nullptr;
+  }
+
+  /** Invokes `fn(tx, ty, T* cells)` for every allocated tile. Tiles are
+   * independent blocks of memory, so the caller may hand different tiles to
+   * different worker threads. */
+  template <class FN>
+  void forEachAllocatedTile(FN&& fn)
+  {
+    for (size_t ty = 0; ty < m_tiles_y; ty++)
+      for (size_t tx = 0; tx < m_tiles_x; tx++)
+        if (auto& tile = m_tiles[tx + ty * m_tiles_x]; tile) fn(tx, ty, tile->data());
+  }
+  /// \overload
+  template <class FN>
+  void forEachAllocatedTile(FN&& fn) const
+  {
+    for (size_t ty = 0; ty < m_tiles_y; ty++)
+      for (size_t tx = 0; tx < m_tiles_x; tx++)
+        if (const auto& tile = m_tiles[tx + ty * m_tiles_x]; tile) fn(tx, ty, tile->data());
+  }
+  /** @} */
+
+  /** The value returned when reading cells that were never written to */
+  inline const T& defaultCellValue() const { return m_defaultValue; }
+
+  /** Returns the horizontal size of grid map in cells count */
+  inline size_t getSizeX() const { return m_size_x; }
+  /** Returns the vertical size of grid map in cells count */
+  inline size_t getSizeY() const { return m_size_y; }
+  /** Returns the "x" coordinate of left side of grid map */
+  inline double getXMin() const { return m_x_min; }
+  /** Returns the "x" coordinate of right side of grid map */
+  inline double getXMax() const { return m_x_max; }
+  /** Returns the "y" coordinate of top side of grid map */
+  inline double getYMin() const { return m_y_min; }
+  /** Returns the "y" coordinate of bottom side of grid map */
+  inline double getYMax() const { return m_y_max; }
+  /** Returns the resolution of the grid map */
+  inline double getResolution() const { return m_resolution; }
+  /** Transform a coordinate values into cell indexes */
+  inline int x2idx(double x) const { return static_cast<int>((x - m_x_min) / m_resolution); }
+  inline int y2idx(double y) const { return static_cast<int>((y - m_y_min) / m_resolution); }
+
+  /** Transform a cell index into a coordinate value of the cell central
+   * point */
+  inline double idx2x(int cx) const { return m_x_min + (cx + 0.5) * m_resolution; }
+  inline double idx2y(int cy) const { return m_y_min + (cy + 0.5) * m_resolution; }
+
+  /** Get the entire grid as a matrix (see CDynamicGrid::getAsMatrix()) */
+  template <class MAT>
+  void getAsMatrix(MAT& m) const
+  {
+    m.setSize(m_size_y, m_size_x);
+    for (size_t cy = 0; cy < m_size_y; cy++)
+      for (size_t cx = 0; cx < m_size_x; cx++) m(cy, cx) = *cellByIndex(cx, cy);
+  }
+
+  /** The user must implement this in order to provide "saveToTextFile" a way
+   * to convert each cell into a numeric value */
+  virtual float cell2float(const T&) const { return 0; }
+  /** Saves a float representation of the grid (via "cell2float()") to a text
+   * file. \return false on error */
+  bool saveToTextFile(const std::string& fileName) const
+  {
+    struct aux_saver : public internal::dynamic_grid_txt_saver
+    {
+      aux_saver(const CTiledDynamicGrid<T>& obj) : m_obj(obj) {}
+      unsigned int getSizeX() const override { return m_obj.getSizeX(); }
+      unsigned int getSizeY() const override { return m_obj.getSizeY(); }
+      float getCellAsFloat(unsigned int cx, unsigned int cy) const override
+      {
+        return m_obj.cell2float(*m_obj.cellByIndex(cx, cy));
+      }
+      const CTiledDynamicGrid<T>& m_obj;
+    };
+    aux_saver aux(*this);
+    return aux.saveToTextFile(fileName);
+  }
+
+ protected:
+  /** One tile: TILE_SIZE*TILE_SIZE cells, row-major */
+  using tile_t = std::vector<T>;
+
+  /** Non-const cell access, allocating (default-filled) the tile on first
+   * use. Bounds must have been checked by the caller. */
+  inline T& cellRef(unsigned int cx, unsigned int cy)
+  {
+    auto& tile = m_tiles[(cx / TILE_SIZE) + (cy / TILE_SIZE) * m_tiles_x];
+    if (!tile) tile = std::make_unique<tile_t>(TILE_SIZE * TILE_SIZE, m_defaultValue);
+    return (*tile)[(cx % TILE_SIZE) + (cy % TILE_SIZE) * TILE_SIZE];
+  }
+
+  /** The flat tile directory (row-major, m_tiles_x columns); null entries
+   * are tiles never written to. */
+  std::vector<std::unique_ptr<tile_t>> m_tiles;
+  size_t m_tiles_x{0}, m_tiles_y{0};
+  T m_defaultValue{};
+
+  double m_x_min{0}, m_x_max{0}, m_y_min{0}, m_y_max{0}, m_resolution{0};
+  size_t m_size_x{0}, m_size_y{0};
+
+};  // end of CTiledDynamicGrid<>
+
+}  // namespace containers
+}  // namespace mrpt
@@ -0,0 +1,78 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+#pragma once
+
+#include <memory>
+#include <utility>
+
+namespace mrpt
+{
+namespace containers
+{
+/** \addtogroup mrpt_containers_grp
+ * @{ */
+
+/** Copy-on-write pointer: copies of a `cow_ptr<T>` share the same underlying
+ * object, and a private deep copy is made only upon the first mutable access
+ * (write()) of a shared instance.
+ *
+ * Useful for large payloads that are duplicated often but modified rarely,
+ * e.g. the per-particle metric maps of a RBPF, where resampling duplicates
+ * particles far more often than each duplicate diverges from its source.
+ *
+ * The owned object always exists (a default-constructed `T` for a
+ * default-constructed `cow_ptr<T>`), so accessors never return nullptr.
+ *
+ * \note Not thread-safe: concurrent write() calls on copies sharing the same
+ * object must be externally synchronized. Concurrent read() is safe.
+ * \sa copy_ptr<T>, poly_ptr<T>
+ */
+template <typename T>
+class cow_ptr
+{
+ public:
+  using value_type = T;
+
+  /** Default ctor: owns a default-constructed object. */
+  cow_ptr() : m_ptr(std::make_shared<T>()) {}
+  /** Ctor from a value, which is moved (or copied) into the owned object. */
+  explicit cow_ptr(T v) : m_ptr(std::make_shared<T>(std::move(v))) {}
+
+  // Compiler-generated copy/move ops share the pointee, as intended.
+
+  /** Read-only access to the (possibly shared) object. */
+  const T& read() const { return *m_ptr; }
+  const T* operator->() const { return m_ptr.get(); }
+  const T& operator*() const { return *m_ptr; }
+
+  /** Mutable access, enforcing copy-on-write: if the object is currently
+   * shared with other cow_ptr instances, a private deep copy is made first.
+   */
+  T& write()
+  {
+    if (m_ptr.use_count() > 1) m_ptr = std::make_shared<T>(*m_ptr);
+    return *m_ptr;
+  }
+
+  /** Mutable access WITHOUT enforcing copy-on-write: changes will be seen by
+   * all copies sharing the object. Only valid for mutations that do not
+   * change the logically-observable state, e.g. clearing internal caches. */
+  T& shared_mutable() { return *m_ptr; }
+
+  /** Returns true if the object is currently shared with other cow_ptr
+   * instances. */
+  bool isShared() const { return m_ptr.use_count() > 1; }
+
+ private:
+  std::shared_ptr<T> m_ptr;
+};
+
+/** @} */  // end of grouping
+}  // namespace containers
+}  // namespace mrpt
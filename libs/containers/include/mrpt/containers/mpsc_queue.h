@@ -0,0 +1,108 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+namespace mrpt::containers
+{
+/** An unbounded, lock-free multiple-producer/single-consumer (MPSC) queue.
+ *
+ *  Producers push() concurrently onto an atomic linked stack (one
+ * compare-and-swap per push, never blocking each other or the consumer), and
+ * the single consumer drains everything with consume_all(), which detaches
+ * the whole stack with one atomic exchange and then visits the elements in
+ * FIFO order.
+ *
+ *  Each push() allocates one small node; for strict hot paths with a
+ * single producer prefer the allocation-free bounded spsc_ring.
+ *
+ * \note Defined in #include <mrpt/containers/mpsc_queue.h>
+ * \note [New in MRPT 2.14.5]
+ * \sa spsc_ring, seqlock_value
+ * \ingroup mrpt_containers_grp
+ */
+template <typename T>
+class mpsc_queue
+{
+ public:
+  mpsc_queue() = default;
+  ~mpsc_queue()
+  {
+    Node* n = m_head.exchange(nullptr, std::memory_order_acquire);
+    while (n)
+    {
+      Node* next = n->next;
+      delete n;
+      n = next;
+    }
+  }
+  mpsc_queue(const mpsc_queue&) = delete;
+  mpsc_queue& operator=(const mpsc_queue&) = delete;
+
+  /** Enqueues one element. Safe to call from any number of threads. */
+  void push(T&& v)
+  {
+    auto* n = new Node{std::move(v), m_head.load(std::memory_order_relaxed)};
+    while (!m_head.compare_exchange_weak(
+        n->next, n, std::memory_order_release, std::memory_order_relaxed))
+    {
+    }
+  }
+
+  /// \overload
+  void push(const T& v)
+  {
+    T copy = v;
+    push(std::move(copy));
+  }
+
+  /** Dequeues all pending elements, invoking `fn(T&&)` on each of them in
+   * FIFO order, and returns how many were processed. Single consumer thread
+   * only. */
+  template <typename Fn>
+  size_t consume_all(Fn&& fn)
+  {
+    Node* n = m_head.exchange(nullptr, std::memory_order_acquire);
+    // Reverse the LIFO stack to recover FIFO order:
+    Node* fifo = nullptr;
+    while (n)
+    {
+      Node* next = n->next;
+      n->next = fifo;
+      fifo = n;
+      n = next;
+    }
+    size_t count = 0;
+    while (fifo)
+    {
+      Node* next = fifo->next;
+      fn(std::move(fifo->value));
+      delete fifo;
+      fifo = next;
+      count++;
+    }
+    return count;
+  }
+
+  /** Returns true if no element was pending at the time of the call */
+  bool empty() const { return m_head.load(std::memory_order_acquire) == nullptr; }
+
+ private:
+  struct Node
+  {
+    T value;
+    Node* next;
+  };
+  std::atomic<Node*> m_head{nullptr};
+};
+
+}  // namespace mrpt::containers
@@ -0,0 +1,85 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace mrpt::containers
+{
+/** A seqlock-protected holder of one value: a single writer publishes new
+ * values with store() and any number of readers call load() without ever
+ * blocking the writer.
+ *
+ *  Readers retry if a concurrent write tears their snapshot (detected via an
+ * odd/changed sequence counter), so loads are wait-free for the writer and
+ * lock-free for readers under a non-saturated writer. Useful for small
+ * "latest state" values shared from a driver thread, e.g. the most recent
+ * pose, timestamp or status word.
+ *
+ *  T must be trivially copyable: the value bytes are copied while a
+ * concurrent writer may be updating them, and the sequence counter is what
+ * makes the (discarded) torn copies harmless.
+ *
+ * \note Defined in #include <mrpt/containers/seqlock_value.h>
+ * \note [New in MRPT 2.14.5]
+ * \sa spsc_ring, mpsc_queue
+ * \ingroup mrpt_containers_grp
+ */
+template <typename T>
+class seqlock_value
+{
+  static_assert(std::is_trivially_copyable_v<T>, "seqlock_value requires a trivially-copyable T");
+
+ public:
+  seqlock_value() = default;
+  explicit seqlock_value(const T& initial) : m_value(initial) {}
+
+  /** Publishes a new value. Single writer thread only. */
+  void store(const T& v)
+  {
+    const uint32_t s = m_seq.load(std::memory_order_relaxed);
+    m_seq.store(s + 1, std::memory_order_relaxed);  // odd: write in progress
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(&m_value, &v, sizeof(T));
+    std::atomic_thread_fence(std::memory_order_release);
+    m_seq.store(s + 2, std::memory_order_release);
+  }
+
+  /** Returns a consistent snapshot of the value, retrying while a write is
+   * in progress. Safe from any number of reader threads. */
+  T load() const
+  {
+    T out;
+    while (!try_load(out))
+    {
+    }
+    return out;
+  }
+
+  /** Single-attempt variant of load(): returns false if a concurrent write
+   * made the snapshot inconsistent. */
+  bool try_load(T& out) const
+  {
+    const uint32_t s1 = m_seq.load(std::memory_order_acquire);
+    if (s1 & 1) return false;  // write in progress
+    std::atomic_thread_fence(std::memory_order_acquire);
+    std::memcpy(&out, &m_value, sizeof(T));
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return s1 == m_seq.load(std::memory_order_relaxed);
+  }
+
+ private:
+  std::atomic<uint32_t> m_seq{0};
+  T m_value{};
+};
+
+}  // namespace mrpt::containers
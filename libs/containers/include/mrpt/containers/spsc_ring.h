@@ -0,0 +1,96 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace mrpt::containers
+{
+/** A bounded, lock-free single-producer/single-consumer (SPSC) ring buffer.
+ *
+ *  The capacity is rounded up to a power of two at construction so that
+ * indices wrap with a bit mask, and the producer and consumer indices live on
+ * separate cache lines to avoid false sharing. try_push() may only be called
+ * from one thread at a time, and try_pop() from one (possibly different)
+ * thread at a time; under that contract no locks or waits are ever taken.
+ *
+ *  Intended for driver/pipeline hot paths where a full queue should lead to
+ * an explicit drop decision by the caller rather than blocking, e.g. handing
+ * samples from a sensor acquisition thread to a processing thread.
+ *
+ * \note Defined in #include <mrpt/containers/spsc_ring.h>
+ * \note [New in MRPT 2.14.5]
+ * \sa mpsc_queue, seqlock_value
+ * \ingroup mrpt_containers_grp
+ */
+template <typename T>
+class spsc_ring
+{
+ public:
+  /** Builds a ring able to hold at least `minCapacity` elements (rounded up
+   * to the next power of two). */
+  explicit spsc_ring(size_t minCapacity = 256)
+  {
+    size_t cap = 1;
+    while (cap < minCapacity) cap <<= 1;
+    m_buf.resize(cap);
+    m_mask = cap - 1;
+  }
+
+  /** Tries to enqueue one element; returns false (leaving the ring
+   * unmodified) if it is full. Producer thread only. */
+  bool try_push(T&& v)
+  {
+    const size_t tail = m_tail.load(std::memory_order_relaxed);
+    if (tail - m_head.load(std::memory_order_acquire) > m_mask) return false;  // full
+    m_buf[tail & m_mask] = std::move(v);
+    m_tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /// \overload
+  bool try_push(const T& v)
+  {
+    T copy = v;
+    return try_push(std::move(copy));
+  }
+
+  /** Tries to dequeue the oldest element into `out`; returns false if the
+   * ring is empty. Consumer thread only. */
+  bool try_pop(T& out)
+  {
+    const size_t head = m_head.load(std::memory_order_relaxed);
+    if (head == m_tail.load(std::memory_order_acquire)) return false;  // empty
+    out = std::move(m_buf[head & m_mask]);
+    m_head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  /** Number of elements currently stored. Only an instantaneous
+   * approximation when producer or consumer are running concurrently. */
+  size_t approx_size() const
+  {
+    return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+  }
+
+  /** The actual (power of two) capacity */
+  size_t capacity() const { return m_mask + 1; }
+
+ private:
+  std::vector<T> m_buf;
+  size_t m_mask = 0;
+  /** Consumer and producer indices, on separate cache lines: */
+  alignas(64) std::atomic<size_t> m_head{0};
+  alignas(64) std::atomic<size_t> m_tail{0};
+};
+
+}  // namespace mrpt::containers
@@ -10,6 +10,7 @@
 
 #include <mrpt/core/aligned_allocator.h>  // aligned_allocator_cpp11
 
+#include <algorithm>  // copy(), move()
 #include <array>
 #include <cstddef>      // size_t
 #include <type_traits>  // conditional_t, ...
@@ -68,7 +69,10 @@ class vector_with_small_size_optimization
   }
 
   vector_with_small_size_optimization(const vector_with_small_size_optimization& o) { *this = o; }
-  vector_with_small_size_optimization(vector_with_small_size_optimization&& o) { *this = o; }
+  vector_with_small_size_optimization(vector_with_small_size_optimization&& o)
+  {
+    *this = std::move(o);
+  }
   vector_with_small_size_optimization& operator=(const vector_with_small_size_optimization& o)
   {
     m_size = o.m_size;
@@ -76,7 +80,8 @@ class vector_with_small_size_optimization
     if (m_size > small_size)
       m_v = o.m_v;
     else if (m_size > 0)
-      m_a = o.m_a;
+      // Copy the occupied part only, not the whole inline array:
+      std::copy(o.m_a.begin(), o.m_a.begin() + m_size, m_a.begin());
     return *this;
   }
   vector_with_small_size_optimization& operator=(vector_with_small_size_optimization&& o)
@@ -86,7 +91,7 @@ class vector_with_small_size_optimization
     if (m_size > small_size)
       m_v = std::move(o.m_v);
     else if (m_size > 0)
-      m_a = std::move(o.m_a);
+      std::move(o.m_a.begin(), o.m_a.begin() + m_size, m_a.begin());
     return *this;
   }
 
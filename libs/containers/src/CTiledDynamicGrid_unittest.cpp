@@ -0,0 +1,95 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/containers/CTiledDynamicGrid.h>
+#include <mrpt/core/common.h>
+
+using mrpt::containers::CTiledDynamicGrid;
+
+TEST(CTiledDynamicGrid, sparseAllocationAndDefaults)
+{
+  CTiledDynamicGrid<double> grid{-10.0, 10.0, -10.0, 10.0, 0.1, 0.5};
+  EXPECT_EQ(grid.countAllocatedTiles(), 0U);
+
+  // Reads of unwritten cells return the default value and allocate nothing:
+  const auto& cgrid = grid;
+  EXPECT_NEAR(*cgrid.cellByPos(3.0, 4.0), 0.5, 1e-10);
+  EXPECT_EQ(grid.countAllocatedTiles(), 0U);
+
+  // The first write allocates exactly that cell's tile:
+  *grid.cellByPos(3.0, 4.0) = 8.0;
+  EXPECT_EQ(grid.countAllocatedTiles(), 1U);
+  EXPECT_NEAR(*cgrid.cellByPos(3.0, 4.0), 8.0, 1e-10);
+
+  // Other cells in the same tile got the default value:
+  EXPECT_NEAR(*grid.cellByIndex(grid.x2idx(3.0) + 1, grid.y2idx(4.0)), 0.5, 1e-10);
+
+  // Out-of-bounds:
+  EXPECT_EQ(grid.cellByPos(100.0, 0.0), nullptr);
+  EXPECT_EQ(cgrid.cellByPos(0.0, -100.0), nullptr);
+}
+
+TEST(CTiledDynamicGrid, resizeKeepsContentsAndPointers)
+{
+  CTiledDynamicGrid<double> grid{-10.0, 10.0, -10.0, 10.0, 0.1, 0.0};
+
+  double* c1 = grid.cellByPos(3.0, 4.0);
+  double* c2 = grid.cellByPos(-2.0, -7.0);
+  *c1 = 8.0;
+  *c2 = 9.0;
+  const size_t nTiles = grid.countAllocatedTiles();
+
+  grid.resize(-20.0, 20.0, -20.0, 20.0, 0.0, 0.0);
+  EXPECT_LE(grid.getXMin(), -20.0);
+  EXPECT_GE(grid.getXMax(), 20.0);
+
+  // Contents preserved at the same world coordinates:
+  EXPECT_NEAR(*grid.cellByPos(3.0, 4.0), 8.0, 1e-10);
+  EXPECT_NEAR(*grid.cellByPos(-2.0, -7.0), 9.0, 1e-10);
+
+  // Tiles were re-linked, not copied: old pointers are still the cells.
+  EXPECT_EQ(grid.cellByPos(3.0, 4.0), c1);
+  EXPECT_EQ(grid.cellByPos(-2.0, -7.0), c2);
+  EXPECT_EQ(grid.countAllocatedTiles(), nTiles);
+}
+
+TEST(CTiledDynamicGrid, tileWiseIteration)
+{
+  using grid_t = CTiledDynamicGrid<int>;
+  grid_t grid{-10.0, 10.0, -10.0, 10.0, 0.1, 0};
+
+  *grid.cellByPos(5.0, 5.0) = 1;
+  *grid.cellByPos(-5.0, -5.0) = 2;
+
+  int sum = 0;
+  size_t visited = 0;
+  grid.forEachAllocatedTile(
+      [&](size_t tx, size_t ty, const int* cells)
+      {
+        EXPECT_TRUE(grid.isTileAllocated(tx, ty));
+        for (size_t i = 0; i < grid_t::TILE_SIZE * grid_t::TILE_SIZE; i++) sum += cells[i];
+        visited++;
+      });
+  EXPECT_EQ(visited, grid.countAllocatedTiles());
+  EXPECT_EQ(sum, 3);
+}
+
+TEST(CTiledDynamicGrid, fillAndClear)
+{
+  CTiledDynamicGrid<int> grid{-10.0, 10.0, -10.0, 10.0, 0.1, 0};
+  *grid.cellByPos(1.0, 1.0) = 7;
+
+  grid.fill(3);
+  EXPECT_EQ(grid.countAllocatedTiles(), 0U);
+  EXPECT_EQ(*grid.cellByPos(1.0, 1.0), 3);  // written again -> default now 3
+
+  grid.clear();
+  EXPECT_EQ(grid.countAllocatedTiles(), 0U);
+}
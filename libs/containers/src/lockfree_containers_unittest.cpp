@@ -0,0 +1,118 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/containers/mpsc_queue.h>
+#include <mrpt/containers/seqlock_value.h>
+#include <mrpt/containers/spsc_ring.h>
+
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <vector>
+
+TEST(spsc_ring, basicPushPop)
+{
+  mrpt::containers::spsc_ring<int> q(3);  // rounds up to 4
+  EXPECT_EQ(q.capacity(), 4U);
+
+  int v = 0;
+  EXPECT_FALSE(q.try_pop(v));
+  for (int i = 0; i < 4; i++) EXPECT_TRUE(q.try_push(i));
+  EXPECT_FALSE(q.try_push(99));  // full
+  EXPECT_EQ(q.approx_size(), 4U);
+
+  for (int i = 0; i < 4; i++)
+  {
+    EXPECT_TRUE(q.try_pop(v));
+    EXPECT_EQ(v, i);
+  }
+  EXPECT_FALSE(q.try_pop(v));
+}
+
+TEST(spsc_ring, producerConsumerThreads)
+{
+  mrpt::containers::spsc_ring<int> q(64);
+  constexpr int N = 100000;
+
+  std::thread producer(
+      [&]
+      {
+        for (int i = 0; i < N;)
+          if (q.try_push(int(i))) i++;
+      });
+
+  int expected = 0;
+  while (expected < N)
+  {
+    int v;
+    if (!q.try_pop(v)) continue;
+    ASSERT_EQ(v, expected);  // FIFO order, nothing lost
+    expected++;
+  }
+  producer.join();
+}
+
+TEST(mpsc_queue, fifoPerProducerAndNoLoss)
+{
+  mrpt::containers::mpsc_queue<std::pair<int, int>> q;
+  constexpr int NUM_PRODUCERS = 4, N = 20000;
+
+  std::vector<std::thread> producers;
+  for (int p = 0; p < NUM_PRODUCERS; p++)
+    producers.emplace_back(
+        [&, p]
+        {
+          for (int i = 0; i < N; i++) q.push({p, i});
+        });
+  for (auto& t : producers) t.join();
+
+  std::vector<int> lastSeen(NUM_PRODUCERS, -1);
+  size_t total = 0;
+  while (!q.empty())
+  {
+    total += q.consume_all(
+        [&](std::pair<int, int>&& v)
+        {
+          // Within each producer, FIFO order must be preserved:
+          EXPECT_EQ(v.second, lastSeen[v.first] + 1);
+          lastSeen[v.first] = v.second;
+        });
+  }
+  EXPECT_EQ(total, size_t(NUM_PRODUCERS) * N);
+}
+
+TEST(seqlock_value, consistentSnapshots)
+{
+  struct Pose
+  {
+    double x = 0, y = 0, phi = 0;
+  };
+  mrpt::containers::seqlock_value<Pose> latest;
+
+  std::atomic<bool> done{false};
+  std::thread writer(
+      [&]
+      {
+        for (int i = 1; i <= 50000; i++) latest.store({double(i), double(2 * i), double(3 * i)});
+        done = true;
+      });
+
+  // Readers must never observe a torn value:
+  while (!done)
+  {
+    const Pose p = latest.load();
+    EXPECT_DOUBLE_EQ(p.y, 2 * p.x);
+    EXPECT_DOUBLE_EQ(p.phi, 3 * p.x);
+  }
+  writer.join();
+
+  const Pose p = latest.load();
+  EXPECT_DOUBLE_EQ(p.x, 50000.0);
+}
@@ -139,6 +139,40 @@ TEST(vector_with_small_size_optimization, GrowCheckFrontBack)
     EXPECT_EQ(&v[n - 1], &v.back()) << "n=" << n;
   }
 }
+TEST(vector_with_small_size_optimization, CopyAndMove)
+{
+  // Both the small (inline) and large (heap) cases:
+  for (size_t n : {SMALL_LEN / 2, SMALL_LEN, SMALL_LEN * 2})
+  {
+    vwsso_t v;
+    v.resize(n);
+    for (size_t i = 0; i < n; i++) v[i] = 100 + i;
+
+    // Copy ctor:
+    vwsso_t c = v;
+    EXPECT_EQ(c.size(), n);
+    for (size_t i = 0; i < n; i++) EXPECT_EQ(c[i], 100 + i) << "n=" << n;
+
+    // Copy assignment (over a non-empty target):
+    vwsso_t c2;
+    c2.resize(3);
+    c2 = v;
+    EXPECT_EQ(c2.size(), n);
+    for (size_t i = 0; i < n; i++) EXPECT_EQ(c2[i], 100 + i) << "n=" << n;
+
+    // Move ctor:
+    vwsso_t m = std::move(c);
+    EXPECT_EQ(m.size(), n);
+    for (size_t i = 0; i < n; i++) EXPECT_EQ(m[i], 100 + i) << "n=" << n;
+
+    // Move assignment:
+    vwsso_t m2;
+    m2 = std::move(m);
+    EXPECT_EQ(m2.size(), n);
+    for (size_t i = 0; i < n; i++) EXPECT_EQ(m2[i], 100 + i) << "n=" << n;
+  }
+}
+
 TEST(vector_with_small_size_optimization, push_back)
 {
   vwsso_t v;
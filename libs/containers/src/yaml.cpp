@@ -19,6 +19,8 @@
 #include <iostream>
 #include <istream>
 #include <stack>
+#include <stdexcept>
+#include <string_view>
 
 #if MRPT_HAS_FYAML
 #include <libfyaml.h>
@@ -746,6 +748,247 @@ yaml::scalar_t textToScalar(const std::string& s)
 }
 }  // namespace
 
+// ====== Fast path for strict-JSON documents (JSON is a subset of YAML) =====
+// Large calibration/config trees are often stored as JSON; for those, a
+// single-pass recursive-descent parser over the raw buffer avoids the
+// per-event/token overhead of the generic libfyaml pipeline. Scalars are
+// stored as raw strings and converted on demand by as<T>(), exactly as in
+// the YAML path. Anything that is not strict JSON (e.g. YAML flow style,
+// comments, unquoted keys) makes the parser bail out and loadFromText()
+// falls back to libfyaml.
+namespace
+{
+struct JsonFastPathError : std::runtime_error
+{
+  using std::runtime_error::runtime_error;
+};
+
+class JsonFastParser
+{
+ public:
+  explicit JsonFastParser(const std::string& s) : p_(s.data()), end_(s.data() + s.size()) {}
+
+  /// Returns the parsed root node, or nothing if the document does not even
+  /// look like JSON. Throws JsonFastPathError on malformed "JSON-like" input.
+  std::optional<yaml::node_t> parseDocument()
+  {
+    skipWhitespace();
+    if (p_ == end_ || (*p_ != '{' && *p_ != '[')) return {};
+    auto n = parseValue();
+    skipWhitespace();
+    if (p_ != end_) fail("trailing content after JSON document");
+    return n;
+  }
+
+ private:
+  const char* p_;
+  const char* end_;
+
+  [[noreturn]] void fail(const char* msg) const { throw JsonFastPathError(msg); }
+
+  void skipWhitespace()
+  {
+    while (p_ != end_ && (*p_ == ' ' || *p_ == '\t' || *p_ == '\n' || *p_ == '\r')) ++p_;
+  }
+  char peek() const
+  {
+    if (p_ == end_) fail("unexpected end of input");
+    return *p_;
+  }
+
+  yaml::node_t parseValue()
+  {
+    skipWhitespace();
+    switch (peek())
+    {
+      case '{':
+        return parseObject();
+      case '[':
+        return parseArray();
+      case '"':
+      {
+        yaml::node_t n;
+        n.d.emplace<yaml::scalar_t>(parseString());
+        return n;
+      }
+      default:
+        return parseLiteral();
+    }
+  }
+
+  yaml::node_t parseObject()
+  {
+    ++p_;  // consume '{'
+    yaml::node_t n;
+    yaml::map_t& m = n.d.emplace<yaml::map_t>();
+    skipWhitespace();
+    if (peek() == '}')
+    {
+      ++p_;
+      return n;
+    }
+    for (;;)
+    {
+      skipWhitespace();
+      if (peek() != '"') fail("expected quoted object key");
+      yaml::node_t key;
+      key.d.emplace<yaml::scalar_t>(parseString());
+      skipWhitespace();
+      if (peek() != ':') fail("expected ':' after object key");
+      ++p_;
+      m[std::move(key)] = parseValue();
+      skipWhitespace();
+      const char c = peek();
+      ++p_;
+      if (c == ',') continue;
+      if (c == '}') break;
+      fail("expected ',' or '}' in object");
+    }
+    return n;
+  }
+
+  yaml::node_t parseArray()
+  {
+    ++p_;  // consume '['
+    yaml::node_t n;
+    yaml::sequence_t& s = n.d.emplace<yaml::sequence_t>();
+    skipWhitespace();
+    if (peek() == ']')
+    {
+      ++p_;
+      return n;
+    }
+    for (;;)
+    {
+      s.push_back(parseValue());
+      skipWhitespace();
+      const char c = peek();
+      ++p_;
+      if (c == ',') continue;
+      if (c == ']') break;
+      fail("expected ',' or ']' in array");
+    }
+    return n;
+  }
+
+  std::string parseString()
+  {
+    ++p_;  // consume opening '"'
+    // Fast scan for the common escape-free case:
+    const char* q = p_;
+    while (q != end_ && *q != '"' && *q != '\\') ++q;
+    if (q == end_) fail("unterminated string");
+    std::string s(p_, q);
+    p_ = q;
+    while (peek() != '"')
+    {
+      if (*p_ != '\\')
+      {
+        s += *p_++;
+        continue;
+      }
+      if (++p_ == end_) fail("unterminated escape sequence");
+      const char c = *p_++;
+      switch (c)
+      {
+        case '"':
+          s += '"';
+          break;
+        case '\\':
+          s += '\\';
+          break;
+        case '/':
+          s += '/';
+          break;
+        case 'b':
+          s += '\b';
+          break;
+        case 'f':
+          s += '\f';
+          break;
+        case 'n':
+          s += '\n';
+          break;
+        case 'r':
+          s += '\r';
+          break;
+        case 't':
+          s += '\t';
+          break;
+        case 'u':
+        {
+          if (end_ - p_ < 4) fail("truncated \\u escape");
+          unsigned cp = 0;
+          for (int i = 0; i < 4; i++)
+          {
+            const char h = *p_++;
+            cp <<= 4;
+            if (h >= '0' && h <= '9')
+              cp |= static_cast<unsigned>(h - '0');
+            else if (h >= 'a' && h <= 'f')
+              cp |= static_cast<unsigned>(h - 'a' + 10);
+            else if (h >= 'A' && h <= 'F')
+              cp |= static_cast<unsigned>(h - 'A' + 10);
+            else
+              fail("invalid \\u escape");
+          }
+          // Encode as UTF-8:
+          if (cp < 0x80)
+            s += static_cast<char>(cp);
+          else if (cp < 0x800)
+          {
+            s += static_cast<char>(0xC0 | (cp >> 6));
+            s += static_cast<char>(0x80 | (cp & 0x3F));
+          }
+          else
+          {
+            s += static_cast<char>(0xE0 | (cp >> 12));
+            s += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            s += static_cast<char>(0x80 | (cp & 0x3F));
+          }
+          break;
+        }
+        default:
+          fail("invalid escape sequence");
+      }
+    }
+    ++p_;  // consume closing '"'
+    return s;
+  }
+
+  yaml::node_t parseLiteral()
+  {
+    const char* start = p_;
+    while (p_ != end_ && *p_ != ',' && *p_ != ']' && *p_ != '}' && *p_ != ' ' && *p_ != '\t' &&
+           *p_ != '\n' && *p_ != '\r')
+      ++p_;
+    const std::string_view tok(start, static_cast<size_t>(p_ - start));
+    yaml::node_t n;
+    if (tok == "null")
+    {
+      n.d.emplace<yaml::scalar_t>();  // null node
+      return n;
+    }
+    if (tok == "true" || tok == "false")
+    {
+      n.d.emplace<yaml::scalar_t>(std::string(tok));
+      return n;
+    }
+    // Otherwise it must be a number, or this is not strict JSON:
+    if (tok.empty()) fail("empty value");
+    for (const char c : tok)
+      if (!((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E'))
+        fail("not a JSON literal");
+    // Stored as text; converted on demand by as<T>():
+    n.d.emplace<yaml::scalar_t>(std::string(tok));
+    return n;
+  }
+};
+}  // namespace
+
+static bool MRPT_YAML_DISABLE_JSON_FASTPATH =
+    mrpt::get_env<bool>("MRPT_YAML_DISABLE_JSON_FASTPATH", false);
+
 #if MRPT_HAS_FYAML
 namespace
 {
@@ -958,11 +1201,30 @@ std::optional<yaml::node_t> recursiveParse(struct fy_parser* p)
 void yaml::loadFromText(const std::string& yamlTextBlock)
 {
   MRPT_START
-#if MRPT_HAS_FYAML
 
   // Reset:
   *this = yaml();
 
+  // Fast path for strict-JSON documents:
+  if (!MRPT_YAML_DISABLE_JSON_FASTPATH)
+  {
+    try
+    {
+      JsonFastParser jp(yamlTextBlock);
+      if (auto optNode = jp.parseDocument(); optNode.has_value())
+      {
+        root_ = std::move(optNode.value());
+        return;
+      }
+    }
+    catch (const JsonFastPathError&)
+    {
+      // Not strict JSON (e.g. YAML flow style): use the general parser below.
+    }
+  }
+
+#if MRPT_HAS_FYAML
+
   struct fy_parse_cfg cfg;
   cfg.search_path = "";
   cfg.diag = nullptr;
@@ -955,6 +955,47 @@ MRPT_TEST(yaml, fromJSON)
 }
 MRPT_TEST_END()
 
+MRPT_TEST(yaml, jsonFastPath)
+{
+  // Strict-JSON documents take a dedicated fast path in loadFromText():
+  {
+    const auto p = mrpt::containers::yaml::FromText(
+        R"({"name": "with \"quotes\" and\ttabs", "pi": 3.1416, "on": true, "off": false, "nil": null, "seq": [1, -2, 3e2], "empty_map": {}, "empty_seq": []})");
+
+    EXPECT_EQ(p["name"].as<std::string>(), "with \"quotes\" and\ttabs");
+    EXPECT_NEAR(p["pi"].as<double>(), 3.1416, 1e-9);
+    EXPECT_EQ(p["on"].as<bool>(), true);
+    EXPECT_EQ(p["off"].as<bool>(), false);
+    EXPECT_TRUE(p["nil"].isNullNode());
+    EXPECT_EQ(p["seq"](1).as<int>(), -2);
+    EXPECT_NEAR(p["seq"](2).as<double>(), 300.0, 1e-9);
+    EXPECT_TRUE(p["empty_map"].isMap());
+    EXPECT_EQ(p["empty_map"].asMap().size(), 0U);
+    EXPECT_TRUE(p["empty_seq"].isSequence());
+    EXPECT_EQ(p["empty_seq"].asSequence().size(), 0U);
+  }
+  {
+    // \u escapes are decoded as UTF-8:
+    const auto p = mrpt::containers::yaml::FromText(R"(["\u00e9", "\u0041"])");
+    EXPECT_EQ(p(0).as<std::string>(), "\xc3\xa9");
+    EXPECT_EQ(p(1).as<std::string>(), "A");
+  }
+  {
+    // Top-level array:
+    const auto p = mrpt::containers::yaml::FromText(R"([{"a": 1}, {"a": 2}])");
+    ASSERT_TRUE(p.isSequence());
+    EXPECT_EQ(p(1)["a"].as<int>(), 2);
+  }
+  // YAML flow style looks like JSON but is not strict JSON (unquoted keys):
+  // it must silently fall back to the general parser.
+  {
+    const auto p = mrpt::containers::yaml::FromText("{a: 1, b: [2, 3]}");
+    EXPECT_EQ(p["a"].as<int>(), 1);
+    EXPECT_EQ(p["b"](1).as<int>(), 3);
+  }
+}
+MRPT_TEST_END()
+
 MRPT_TEST(yaml, booleanVersions)
 {
   mrpt::containers::yaml p;
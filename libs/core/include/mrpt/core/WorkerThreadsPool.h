@@ -10,18 +10,20 @@
 
 /**
  * @file   WorkerThreadsPool.h
- * @brief  Simple thread pool
+ * @brief  Work-stealing thread pool
  * @author Jose Luis Blanco Claraco
  * @date   Dec 6, 2018
  */
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <functional>
 #include <future>
+#include <memory>
 #include <mutex>
-#include <queue>
 #include <thread>
 #include <vector>
 
@@ -43,6 +45,12 @@ namespace mrpt
  *  - WorkerThreadsPool::POLICY_DROP_OLD: Old jobs in the waiting queue are
  *    discarded. Note that running jobs are never aborted.
  *
+ *  Internally, each worker thread owns its own task deque and steals from its
+ *  siblings whenever its own deque runs dry, so feeding the pool many
+ *  fine-grained tasks (e.g. via submit_range() or TaskGroup) does not
+ *  serialize all workers on one global queue lock. Tasks enqueued from within
+ *  a pool worker go into that worker's own deque.
+ *
  * \note Partly based on: https://github.com/progschj/ThreadPool (ZLib license)
  *
  * \note (New in MRPT 2.1.0)
@@ -98,12 +106,180 @@ class WorkerThreadsPool
   /** Returns the base name of threads in this pool */
   std::string name() const { return name_; }
 
+  /** Pins the i-th worker thread to the CPU core `cpuIds[i % cpuIds.size()]`,
+   * so passing one CPU per worker pins each to its own core, and passing the
+   * CPU list of one NUMA node spreads the workers over that node (see
+   * findNUMANodeCPUs() and setNUMANode()). Combine with first-touch
+   * allocation (mrpt::aligned_malloc_first_touch()) to keep the data worked
+   * on by each thread local to its socket.
+   * Implemented for Linux and Windows; returns false (doing nothing) on
+   * other platforms, with an empty list, or upon any OS error. Threads
+   * created by a later resize() are not affected.
+   * \note [New in MRPT 2.14.5] */
+  bool setThreadAffinity(const std::vector<int>& cpuIds);
+
+  /** Pins all worker threads to the CPUs of the given NUMA node: shortcut
+   * for `setThreadAffinity(findNUMANodeCPUs(node))`. Returns false if the
+   * node is unknown or pinning is unsupported \sa setThreadAffinity
+   * \note [New in MRPT 2.14.5] */
+  bool setNUMANode(int node);
+
+  /** Returns the CPU ids belonging to the given NUMA node, as reported by
+   * the OS under `/sys/devices/system/node/` (Linux only: an empty list is
+   * returned on other platforms, or for unknown nodes).
+   * \note [New in MRPT 2.14.5] */
+  static std::vector<int> findNUMANodeCPUs(int node);
+
  private:
+  /** Completion state shared between a TaskGroup and its in-flight tasks */
+  struct TTaskGroupState
+  {
+    std::atomic<std::size_t> remaining{0};
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::mutex exceptMtx;
+    std::exception_ptr firstException;
+  };
+
+ public:
+  /** A set of tasks thrown at the pool which can be waited for together,
+   * e.g. the chunks of one parallel-for (see submit_range()).
+   *
+   * Groups are nestable: a task already running inside the pool may create
+   * its own group and wait() for it; while waiting, that worker keeps
+   * executing other pending pool tasks instead of blocking, so nested
+   * groups cannot deadlock the pool.
+   *
+   * wait() (but not the destructor) rethrows the first exception thrown by
+   * any task of the group, if any.
+   *
+   * \warning Use only with POLICY_FIFO pools: POLICY_DROP_OLD may discard
+   * tasks of the group, in which case wait() would never return.
+   * \note [New in MRPT 2.14.5]
+   */
+  class TaskGroup
+  {
+   public:
+    explicit TaskGroup(WorkerThreadsPool& pool) :
+        pool_(pool), st_(std::make_shared<TTaskGroupState>())
+    {
+    }
+    /** Waits for all pending tasks of the group, swallowing their
+     * exceptions; call wait() first to get them rethrown instead. */
+    ~TaskGroup() { pool_.internal_waitGroup(*st_, false /*rethrow*/); }
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    /** Enqueues one more task belonging to this group */
+    template <class F>
+    void run(F&& f)
+    {
+      auto st = st_;
+      st->remaining.fetch_add(1);
+      try
+      {
+        pool_.internal_pushTask(
+            [st, fn = std::function<void()>(std::forward<F>(f))]()
+            {
+              try
+              {
+                fn();
+              }
+              catch (...)
+              {
+                std::lock_guard<std::mutex> lk(st->exceptMtx);
+                if (!st->firstException) st->firstException = std::current_exception();
+              }
+              if (st->remaining.fetch_sub(1) == 1)
+              {
+                std::lock_guard<std::mutex> lk(st->mtx);
+                st->cv.notify_all();
+              }
+            });
+      }
+      catch (...)
+      {
+        st->remaining.fetch_sub(1);
+        throw;
+      }
+    }
+
+    /** Blocks until all tasks of this group finished, then rethrows the
+     * first exception thrown by any of them (if any). When called from a
+     * pool worker, this thread keeps executing other pending pool tasks
+     * while it waits. */
+    void wait() { pool_.internal_waitGroup(*st_, true /*rethrow*/); }
+
+   private:
+    WorkerThreadsPool& pool_;
+    std::shared_ptr<TTaskGroupState> st_;
+  };
+
+  /** Parallel-for over the index range [first, last): `fn(i)` is invoked
+   * exactly once per index, in chunks spread over the worker threads, and
+   * this call blocks until all of them finished (rethrowing the first task
+   * exception, if any). `fn` must be safe to invoke concurrently for
+   * different indices. Nested use (i.e. `fn` itself feeding this pool) is
+   * fine, see TaskGroup. If the pool has no threads, the range is simply
+   * run sequentially in the calling thread.
+   * \note [New in MRPT 2.14.5]
+   */
+  template <class IndexType, class F>
+  void submit_range(IndexType first, IndexType last, F&& fn)
+  {
+    if (!(first < last)) return;
+
+    if (threads_.empty())
+    {
+      for (IndexType i = first; i < last; ++i) fn(i);
+      return;
+    }
+
+    const auto n = static_cast<std::size_t>(last - first);
+    // A few chunks per worker, so work stealing can even out irregular
+    // per-index costs:
+    const std::size_t nChunks = std::min<std::size_t>(n, threads_.size() * 4);
+
+    TaskGroup group(*this);
+    for (std::size_t c = 0; c < nChunks; c++)
+    {
+      const auto i0 = first + static_cast<IndexType>((n * c) / nChunks);
+      const auto i1 = first + static_cast<IndexType>((n * (c + 1)) / nChunks);
+      group.run(
+          [i0, i1, &fn]()
+          {
+            for (IndexType i = i0; i < i1; ++i) fn(i);
+          });
+    }
+    group.wait();
+  }
+
+ private:
+  /** The task deque owned by one worker thread. The owner pops from the
+   * front (FIFO); idle siblings steal from the back. */
+  struct TWorkerQueue
+  {
+    std::deque<std::function<void()>> tasks;
+    std::mutex mtx;
+  };
+
+  /** Pushes a type-erased task, applying the queue policy. Used by both
+   * enqueue() and TaskGroup::run() */
+  void internal_pushTask(std::function<void()>&& task);
+  /** Pops one task, trying `preferredQueue` first and stealing from the
+   * other queues otherwise. Returns false if all queues are empty. */
+  bool internal_popTask(std::size_t preferredQueue, std::function<void()>& task);
+  void internal_waitGroup(TTaskGroupState& st, bool rethrow);
+
   std::vector<std::thread> threads_;
+  std::vector<std::unique_ptr<TWorkerQueue>> queues_;
+  std::atomic<std::size_t> pendingCount_{0};
+  /** Round-robin index for tasks enqueued from non-worker threads */
+  std::atomic<std::size_t> nextQueue_{0};
   std::atomic_bool do_stop_{false};
-  std::mutex queue_mutex_;
+  std::mutex wakeup_mtx_;
   std::condition_variable condition_;
-  std::queue<std::function<void()>> tasks_;
   queue_policy_t policy_{POLICY_FIFO};
   std::string name_{"WorkerThreadsPool"};
 };
@@ -118,25 +294,7 @@ auto WorkerThreadsPool::enqueue(F&& f, Args&&... args)
       std::bind(std::forward<F>(f), std::forward<Args>(args)...));
 
   std::future<return_type> res = task->get_future();
-  {
-    std::unique_lock<std::mutex> lock(queue_mutex_);
-
-    // don't allow enqueueing after stopping the pool
-    if (do_stop_) throw std::runtime_error("enqueue on stopped ThreadPool");
-
-    // policy check: drop pending tasks if we have more tasks than threads
-    if (policy_ == POLICY_DROP_OLD)
-    {
-      while (tasks_.size() >= threads_.size())
-      {
-        tasks_.pop();
-      }
-    }
-
-    // Enqueue the new task:
-    tasks_.emplace([task]() { (*task)(); });
-  }
-  condition_.notify_one();
+  internal_pushTask([task]() { (*task)(); });
   return res;
 }
 
@@ -11,6 +11,7 @@
 
 #include <mrpt/core/alignment_req.h>
 
+#include <cstdint>
 #include <memory>
 #include <type_traits>
 
@@ -21,6 +22,82 @@ void aligned_free(void* ptr);
 /** Identical to aligned_malloc, but it zeroes the reserved memory block. */
 void* aligned_calloc(size_t bytes, size_t alignment);
 
+/** Identical to aligned_malloc(), but additionally writes one byte into each
+ * memory page of the block from the calling thread ("first touch"), so under
+ * the default first-touch NUMA policy the whole block gets committed to the
+ * NUMA node of the calling thread - instead of to the node of whichever
+ * thread happens to write each page first, which is what scatters
+ * per-particle maps across sockets. Call it from a thread already pinned to
+ * the target node (see mrpt::WorkerThreadsPool::setNUMANode()).
+ * As with aligned_malloc(), the block contents are uninitialized.
+ * \note [New in MRPT 2.14.5] */
+void* aligned_malloc_first_touch(size_t size, size_t alignment);
+
+/** Zeroed variant of aligned_malloc_first_touch(). Equivalent to
+ * aligned_calloc(), whose full memset() already touches every page; provided
+ * for symmetry \sa aligned_malloc_first_touch
+ * \note [New in MRPT 2.14.5] */
+void* aligned_calloc_first_touch(size_t bytes, size_t alignment);
+
+/** Counters of the mrpt::aligned_malloc() family of allocators, as returned
+ * by aligned_alloc_stats(). The `*_in_use` fields are gauges of the current
+ * state; the rest are monotonic counters since process start (or the last
+ * reset_aligned_alloc_stats()).
+ * \note [New in MRPT 2.14.5] */
+struct TAlignedAllocStats
+{
+  uint64_t num_allocs = 0;  //!< Total aligned_malloc()/aligned_calloc() calls
+  uint64_t num_frees = 0;  //!< Total aligned_free() calls
+  uint64_t num_hugepage_blocks_in_use = 0;  //!< Live hugepage-backed blocks
+  uint64_t hugepage_bytes_in_use = 0;  //!< Bytes currently mapped for them
+  uint64_t num_hugetlb_allocs = 0;  //!< Blocks on explicit 2 MiB pages (MAP_HUGETLB)
+  uint64_t num_thp_allocs = 0;  //!< Blocks on madvise(MADV_HUGEPAGE) mappings
+  uint64_t num_hugepage_fallbacks = 0;  //!< Large blocks that fell back to the heap
+  uint64_t num_advised_ranges = 0;  //!< Successful advise_huge_pages() calls
+};
+
+/** When enabled, aligned_malloc() blocks of at least min_block_size bytes are
+ * served from hugepage-backed anonymous mappings instead of the general heap,
+ * cutting TLB pressure for multi-GB maps: explicit 2 MiB pages (MAP_HUGETLB)
+ * are tried first and, where the system has none reserved, the block falls
+ * back to a 2 MiB-aligned mapping with madvise(MADV_HUGEPAGE) so transparent
+ * huge pages can coalesce it. If even that mapping fails, the block silently
+ * falls back to the regular heap path. Containers built on
+ * aligned_allocator_cpp11 (e.g. the point buffers grown by
+ * mrpt::maps::CPointsMap::reserve()) opt in automatically; for buffers with
+ * other allocators see advise_huge_pages().
+ * Only implemented on Linux; elsewhere the flag is accepted but has no
+ * effect. Thread-safe.
+ * \sa aligned_alloc_stats, advise_huge_pages
+ * \note [New in MRPT 2.14.5] */
+void enable_hugepage_allocations(bool enable = true, size_t min_block_size = (2UL << 20));
+
+/** Returns whether enable_hugepage_allocations() is currently active.
+ * \note [New in MRPT 2.14.5] */
+bool hugepage_allocations_enabled();
+
+/** Best-effort madvise(MADV_HUGEPAGE) over a buffer that was *not* obtained
+ * from aligned_malloc(), for containers whose allocator type is part of the
+ * public API and cannot be swapped (e.g. the cell grid resized by
+ * mrpt::maps::COccupancyGridMap2D::setSize()). A no-op returning false unless
+ * hugepage allocations are enabled, on non-Linux builds, and for ranges
+ * spanning less than one whole 2 MiB page.
+ * \return true if the kernel accepted the advice.
+ * \sa enable_hugepage_allocations
+ * \note [New in MRPT 2.14.5] */
+bool advise_huge_pages(void* ptr, size_t bytes);
+
+/** Returns a snapshot of the allocation statistics, for performance
+ * introspection (e.g. verifying that a large grid actually ended up on huge
+ * pages). \sa enable_hugepage_allocations
+ * \note [New in MRPT 2.14.5] */
+TAlignedAllocStats aligned_alloc_stats();
+
+/** Resets the monotonic counters of aligned_alloc_stats() to zero; the
+ * `*_in_use` gauges always reflect the live state and are not touched.
+ * \note [New in MRPT 2.14.5] */
+void reset_aligned_alloc_stats();
+
 /** Aligned allocator that is compatible with C++11.
  * Default alignment can be 16 (default), 32 (if __AVX__ is defined) or 64
  * (if __AVX2__ is defined).
@@ -65,4 +142,27 @@ class aligned_allocator_cpp11 : public std::allocator<T>
   void deallocate(pointer p, size_type /*num*/) { mrpt::aligned_free(p); }
 };
 
+/** Drop-in variant of aligned_allocator_cpp11 whose allocate() first-touches
+ * every page from the calling thread, for NUMA-local container storage
+ * \sa aligned_malloc_first_touch
+ * \note [New in MRPT 2.14.5] */
+template <class T, size_t AligmentBytes = MRPT_MAX_ALIGN_BYTES>
+class aligned_allocator_cpp11_first_touch : public aligned_allocator_cpp11<T, AligmentBytes>
+{
+ public:
+  using pointer = T*;
+  using size_type = std::size_t;
+
+  template <class U>
+  struct rebind
+  {
+    using other = aligned_allocator_cpp11_first_touch<U>;
+  };
+
+  pointer allocate(size_type num, const void* /*hint*/ = nullptr)
+  {
+    return static_cast<pointer>(mrpt::aligned_malloc_first_touch(num * sizeof(T), AligmentBytes));
+  }
+};
+
 }  // namespace mrpt
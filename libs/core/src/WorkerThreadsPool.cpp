@@ -8,7 +8,7 @@
    +------------------------------------------------------------------------+ */
 /**
  * @file   WorkerThreadsPool.cpp
- * @brief  Simple thread pool
+ * @brief  Work-stealing thread pool
  * @author Jose Luis Blanco Claraco
  * @date   Dec 6, 2018
  */
@@ -19,62 +19,207 @@
 #include <mrpt/core/WorkerThreadsPool.h>
 #include <mrpt/core/exceptions.h>
 
+#include <chrono>
 #include <iostream>
 
-// for SetThreadDescription()
+// for SetThreadDescription(), SetThreadAffinityMask()
 #if defined(_WIN32)
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
 #endif
+// for pthread_setaffinity_np()
+#if defined(MRPT_OS_LINUX) && !MRPT_IN_EMSCRIPTEN
+#include <pthread.h>
+#include <sched.h>
+
+#include <fstream>
+#include <sstream>
+#endif
 
 using namespace mrpt;
 
+namespace
+{
+// Which pool (if any) the current thread belongs to, and its worker index.
+// Used to route nested enqueues into this worker's own deque, and to let
+// TaskGroup::wait() keep executing tasks instead of blocking.
+thread_local const WorkerThreadsPool* tl_workerPool = nullptr;
+thread_local std::size_t tl_workerIndex = 0;
+}  // namespace
+
 void WorkerThreadsPool::clear()
 {
   {
-    std::unique_lock<std::mutex> lock(queue_mutex_);
+    std::unique_lock<std::mutex> lock(wakeup_mtx_);
     do_stop_ = true;
   }
   condition_.notify_all();
 
-  if (!tasks_.empty())
+  if (pendingCount_ > 0)
     std::cerr << "[WorkerThreadsPool name=`" << name_
               << "`] Warning: clear() called (probably from a "
                  "dtor) while having "
-              << tasks_.size() << " pending tasks. Aborting them.\n";
+              << pendingCount_ << " pending tasks. Aborting them.\n";
 
   for (auto& t : threads_)
     if (t.joinable()) t.join();
   threads_.clear();
+  queues_.clear();
+  pendingCount_ = 0;
 }
 
-std::size_t WorkerThreadsPool::pendingTasks() const noexcept
+std::size_t WorkerThreadsPool::pendingTasks() const noexcept { return pendingCount_; }
+
+void WorkerThreadsPool::internal_pushTask(std::function<void()>&& task)
 {
-  std::unique_lock<std::mutex> lock(const_cast<WorkerThreadsPool*>(this)->queue_mutex_);
+  // don't allow enqueueing after stopping the pool
+  if (do_stop_) throw std::runtime_error("enqueue on stopped ThreadPool");
+
+  if (queues_.empty())
+  {
+    // Enqueue before (or without) any call to resize(): tasks wait in a
+    // lone queue until worker threads are created.
+    std::unique_lock<std::mutex> lock(wakeup_mtx_);
+    if (queues_.empty()) queues_.emplace_back(std::make_unique<TWorkerQueue>());
+  }
+
+  // policy check: drop pending tasks if we have more tasks than threads
+  if (policy_ == POLICY_DROP_OLD && !threads_.empty())
+  {
+    while (pendingCount_ >= threads_.size())
+    {
+      bool dropped = false;
+      for (auto& q : queues_)
+      {
+        std::lock_guard<std::mutex> lk(q->mtx);
+        if (q->tasks.empty()) continue;
+        q->tasks.pop_front();
+        pendingCount_--;
+        dropped = true;
+        break;
+      }
+      if (!dropped) break;  // all pending tasks are already running
+    }
+  }
+
+  // Pool workers push onto their own deque; everyone else, round-robin:
+  const std::size_t qIdx =
+      (tl_workerPool == this) ? tl_workerIndex : (nextQueue_.fetch_add(1) % queues_.size());
+  {
+    std::lock_guard<std::mutex> lk(queues_[qIdx]->mtx);
+    queues_[qIdx]->tasks.emplace_back(std::move(task));
+  }
+  pendingCount_++;
+  {
+    // Taking the lock (even empty) avoids losing the wake-up if a worker
+    // is just between checking the predicate and going to sleep:
+    std::lock_guard<std::mutex> lk(wakeup_mtx_);
+  }
+  condition_.notify_one();
+}
 
-  return tasks_.size();
+bool WorkerThreadsPool::internal_popTask(std::size_t preferredQueue, std::function<void()>& task)
+{
+  const std::size_t nQ = queues_.size();
+  for (std::size_t k = 0; k < nQ; k++)
+  {
+    auto& q = *queues_[(preferredQueue + k) % nQ];
+    std::unique_lock<std::mutex> lk(q.mtx, std::try_to_lock);
+    if (!lk.owns_lock())
+    {
+      // Never give up on our own queue; for victims, just move on:
+      if (k != 0) continue;
+      lk.lock();
+    }
+    if (q.tasks.empty()) continue;
+    if (k == 0)
+    {
+      // Own queue: oldest first (FIFO)
+      task = std::move(q.tasks.front());
+      q.tasks.pop_front();
+    }
+    else
+    {
+      // Steal from the opposite end to minimize contention with the owner
+      task = std::move(q.tasks.back());
+      q.tasks.pop_back();
+    }
+    pendingCount_--;
+    return true;
+  }
+  return false;
+}
+
+void WorkerThreadsPool::internal_waitGroup(TTaskGroupState& st, bool rethrow)
+{
+  using namespace std::chrono_literals;
+
+  while (st.remaining != 0)
+  {
+    if (tl_workerPool == this)
+    {
+      // We are one of this pool's workers: help instead of blocking, so
+      // that nested groups cannot exhaust the pool and deadlock.
+      std::function<void()> task;
+      if (internal_popTask(tl_workerIndex, task))
+      {
+        task();
+        continue;
+      }
+      // Nothing to steal: the remaining group tasks are running in other
+      // workers. Sleep briefly (tasks stolen elsewhere may spawn more).
+      std::unique_lock<std::mutex> lk(st.mtx);
+      st.cv.wait_for(lk, 1ms, [&st] { return st.remaining == 0; });
+    }
+    else
+    {
+      std::unique_lock<std::mutex> lk(st.mtx);
+      st.cv.wait(lk, [&st] { return st.remaining == 0; });
+    }
+  }
+
+  if (rethrow)
+  {
+    std::lock_guard<std::mutex> lk(st.exceptMtx);
+    if (st.firstException)
+    {
+      auto e = st.firstException;
+      st.firstException = nullptr;
+      std::rethrow_exception(e);
+    }
+  }
 }
 
 void WorkerThreadsPool::resize(std::size_t num_threads)
 {
+  // One deque per worker (keeping any queue lazily created by an early
+  // enqueue, so its tasks get drained by the new workers):
+  const std::size_t nTotal = threads_.size() + num_threads;
+  while (queues_.size() < nTotal) queues_.emplace_back(std::make_unique<TWorkerQueue>());
+
   for (std::size_t i = 0; i < num_threads; ++i)
+  {
+    const std::size_t qIdx = threads_.size();
     threads_.emplace_back(
-        [this]
+        [this, qIdx]
         {
+          tl_workerPool = this;
+          tl_workerIndex = qIdx;
           for (;;)
           {
             try
             {
+              if (do_stop_) return;
               std::function<void()> task;
+              if (internal_popTask(qIdx, task))
               {
-                std::unique_lock<std::mutex> lock(queue_mutex_);
-                condition_.wait(lock, [this] { return do_stop_ || !tasks_.empty(); });
-                if (do_stop_) return;
-                task = std::move(tasks_.front());
-                tasks_.pop();
+                // Execute:
+                task();
+                continue;
               }
-              // Execute:
-              task();
+              std::unique_lock<std::mutex> lock(wakeup_mtx_);
+              condition_.wait(lock, [this] { return do_stop_ || pendingCount_ > 0; });
+              if (do_stop_) return;
             }
             catch (std::exception& e)
             {
@@ -83,6 +228,7 @@ void WorkerThreadsPool::resize(std::size_t num_threads)
             }
           }
         });
+  }
 }
 
 // code partially replicated from mrpt::system for convenience (avoid dep)
@@ -101,6 +247,74 @@ void mySetThreadName(const std::string& name, std::thread& theThread)
 }
 }  // namespace
 
+bool WorkerThreadsPool::setThreadAffinity(const std::vector<int>& cpuIds)
+{
+  if (cpuIds.empty() || threads_.empty()) return false;
+
+#if defined(MRPT_OS_LINUX) && !MRPT_IN_EMSCRIPTEN
+  bool allOk = true;
+  for (std::size_t i = 0; i < threads_.size(); ++i)
+  {
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(cpuIds[i % cpuIds.size()], &cpuSet);
+    if (0 != pthread_setaffinity_np(threads_[i].native_handle(), sizeof(cpu_set_t), &cpuSet))
+      allOk = false;
+  }
+  return allOk;
+#elif defined(MRPT_OS_WINDOWS) && !defined(__MINGW32_MAJOR_VERSION)
+  bool allOk = true;
+  for (std::size_t i = 0; i < threads_.size(); ++i)
+  {
+    const auto mask = static_cast<DWORD_PTR>(1) << cpuIds[i % cpuIds.size()];
+    if (0 == SetThreadAffinityMask(threads_[i].native_handle(), mask)) allOk = false;
+  }
+  return allOk;
+#else
+  return false;  // unsupported platform
+#endif
+}
+
+bool WorkerThreadsPool::setNUMANode(int node)
+{
+  const auto cpus = findNUMANodeCPUs(node);
+  return cpus.empty() ? false : setThreadAffinity(cpus);
+}
+
+std::vector<int> WorkerThreadsPool::findNUMANodeCPUs([[maybe_unused]] int node)
+{
+  std::vector<int> cpus;
+#if defined(MRPT_OS_LINUX) && !MRPT_IN_EMSCRIPTEN
+  // Format of cpulist: comma-separated ranges, e.g. "0-15,32-47":
+  std::ifstream f("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+  std::string line;
+  if (!f || !std::getline(f, line)) return cpus;
+
+  std::istringstream ss(line);
+  std::string range;
+  while (std::getline(ss, range, ','))
+  {
+    int first = 0, last = 0;
+    const auto dash = range.find('-');
+    try
+    {
+      if (dash == std::string::npos) { first = last = std::stoi(range); }
+      else
+      {
+        first = std::stoi(range.substr(0, dash));
+        last = std::stoi(range.substr(dash + 1));
+      }
+    }
+    catch (...)
+    {
+      return {};
+    }
+    for (int c = first; c <= last; c++) cpus.push_back(c);
+  }
+#endif
+  return cpus;
+}
+
 void WorkerThreadsPool::name(const std::string& name)
 {
   using namespace std::string_literals;
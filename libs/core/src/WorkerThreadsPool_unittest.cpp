@@ -11,6 +11,13 @@
 #include <mrpt/config.h>
 #include <mrpt/core/WorkerThreadsPool.h>
 
+#include <atomic>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>  // sched_getcpu()
+#endif
+
 #if !MRPT_IN_EMSCRIPTEN  // No multithreading
 TEST(WorkerThreadsPool, runTasks)
 {
@@ -36,4 +43,73 @@ TEST(WorkerThreadsPool, runTasks)
   }
   EXPECT_EQ(accum, 6);
 }
+
+TEST(WorkerThreadsPool, submitRange)
+{
+  mrpt::WorkerThreadsPool pool(4);
+
+  const size_t N = 10000;
+  std::vector<int> vals(N, 0);
+
+  pool.submit_range<size_t>(0, N, [&vals](size_t i) { vals[i]++; });
+
+  for (size_t i = 0; i < N; i++) ASSERT_EQ(vals[i], 1) << "i=" << i;
+}
+
+TEST(WorkerThreadsPool, nestedTaskGroups)
+{
+  mrpt::WorkerThreadsPool pool(2);
+
+  // More outer tasks than workers, each waiting for an inner group: this
+  // would deadlock if waiting workers did not keep executing pending tasks.
+  std::atomic<int> accum{0};
+
+  mrpt::WorkerThreadsPool::TaskGroup outer(pool);
+  for (int i = 0; i < 8; i++)
+  {
+    outer.run(
+        [&pool, &accum]()
+        {
+          mrpt::WorkerThreadsPool::TaskGroup inner(pool);
+          for (int j = 0; j < 4; j++) inner.run([&accum]() { accum++; });
+          inner.wait();
+        });
+  }
+  outer.wait();
+
+  EXPECT_EQ(accum, 8 * 4);
+}
+
+TEST(WorkerThreadsPool, threadAffinity)
+{
+  mrpt::WorkerThreadsPool pool(2);
+
+  EXPECT_FALSE(pool.setThreadAffinity({}));  // empty list: error
+
+#if defined(__linux__)
+  ASSERT_TRUE(pool.setThreadAffinity({0}));
+  // All workers must now run on CPU #0:
+  for (int i = 0; i < 4; i++)
+  {
+    auto fut = pool.enqueue([]() { return sched_getcpu(); });
+    EXPECT_EQ(fut.get(), 0);
+  }
+  // NUMA node #0 always exists on Linux and contains at least one CPU:
+  EXPECT_FALSE(mrpt::WorkerThreadsPool::findNUMANodeCPUs(0).empty());
+  EXPECT_TRUE(mrpt::WorkerThreadsPool::findNUMANodeCPUs(1000).empty());
+#endif
+}
+
+TEST(WorkerThreadsPool, taskGroupExceptions)
+{
+  mrpt::WorkerThreadsPool pool(2);
+
+  mrpt::WorkerThreadsPool::TaskGroup group(pool);
+  group.run([]() { throw std::runtime_error("dummy"); });
+  group.run([]() {});
+
+  EXPECT_ANY_THROW(group.wait());
+  // A second wait() must not rethrow (nor hang):
+  EXPECT_NO_THROW(group.wait());
+}
 #endif  // !MRPT_IN_EMSCRIPTEN
@@ -11,8 +11,152 @@
 //
 #include <mrpt/core/aligned_allocator.h>
 
+#include <atomic>
+#include <cstdint>  // uintptr_t
 #include <cstdlib>  // free, realloc, C++17 aligned_alloc
 #include <cstring>  // memset
+#include <map>
+#include <mutex>
+
+#if defined(__linux__)
+#include <sys/mman.h>  // mmap, munmap, madvise
+#include <unistd.h>    // sysconf
+#endif
+
+namespace
+{
+// x86-64 and aarch64 both use 2 MiB as the (default) huge page size:
+constexpr size_t HUGE_PAGE_SIZE = 2UL << 20;
+
+std::atomic<bool> g_hugePagesEnabled{false};
+std::atomic<size_t> g_hugePageMinBlock{HUGE_PAGE_SIZE};
+
+// Monotonic counters for aligned_alloc_stats():
+std::atomic<uint64_t> g_numAllocs{0}, g_numFrees{0}, g_numHugetlbAllocs{0}, g_numThpAllocs{0},
+    g_numHugeFallbacks{0}, g_numAdvised{0};
+
+#if defined(__linux__)
+// Registry of live hugepage-backed blocks, so aligned_free() can tell them
+// apart from regular heap blocks. Only large allocations land here, so the
+// lock is uncontended in practice; the atomic gauge lets the common small
+// free() path skip it entirely.
+std::mutex g_hugeBlocksMtx;
+std::map<void*, size_t> g_hugeBlocks;  // ptr -> mapped length
+std::atomic<uint64_t> g_numHugeLive{0}, g_hugeBytesLive{0};
+
+void* hugepage_mmap(size_t size)
+{
+  // Round the mapping up to whole 2 MiB pages:
+  const size_t len = ((size + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE) * HUGE_PAGE_SIZE;
+
+  void* p = MAP_FAILED;
+  bool hugetlb = false;
+#if defined(MAP_HUGETLB)
+  // Explicit 2 MiB pages first (needs hugepages reserved by the admin):
+  p = ::mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+  hugetlb = (p != MAP_FAILED);
+#endif
+  if (!hugetlb)
+  {
+    // Fall back to a regular anonymous mapping, over-mapped by one huge page
+    // and trimmed so the block starts on a 2 MiB boundary - khugepaged can
+    // then back it with whole transparent huge pages:
+    const size_t overLen = len + HUGE_PAGE_SIZE;
+    void* raw = ::mmap(nullptr, overLen, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) return nullptr;
+    const auto base = reinterpret_cast<uintptr_t>(raw);
+    const uintptr_t aligned = (base + HUGE_PAGE_SIZE - 1) & ~uintptr_t(HUGE_PAGE_SIZE - 1);
+    if (aligned != base) ::munmap(raw, aligned - base);
+    if (const size_t tailLen = (base + overLen) - (aligned + len); tailLen != 0)
+      ::munmap(reinterpret_cast<void*>(aligned + len), tailLen);
+    p = reinterpret_cast<void*>(aligned);
+#if defined(MADV_HUGEPAGE)
+    ::madvise(p, len, MADV_HUGEPAGE);  // best-effort
+#endif
+  }
+
+  {
+    std::lock_guard<std::mutex> lck(g_hugeBlocksMtx);
+    g_hugeBlocks[p] = len;
+  }
+  g_numHugeLive++;
+  g_hugeBytesLive += len;
+  (hugetlb ? g_numHugetlbAllocs : g_numThpAllocs)++;
+  return p;
+}
+
+// Returns false if ptr is not a hugepage-backed block:
+bool hugepage_munmap(void* ptr)
+{
+  size_t len;
+  {
+    std::lock_guard<std::mutex> lck(g_hugeBlocksMtx);
+    const auto it = g_hugeBlocks.find(ptr);
+    if (it == g_hugeBlocks.end()) return false;
+    len = it->second;
+    g_hugeBlocks.erase(it);
+  }
+  g_numHugeLive--;
+  g_hugeBytesLive -= len;
+  ::munmap(ptr, len);
+  return true;
+}
+#endif  // __linux__
+}  // namespace
+
+void mrpt::enable_hugepage_allocations(bool enable, size_t min_block_size)
+{
+  g_hugePageMinBlock = min_block_size;
+  g_hugePagesEnabled = enable;
+}
+bool mrpt::hugepage_allocations_enabled() { return g_hugePagesEnabled; }
+
+bool mrpt::advise_huge_pages(void* ptr, size_t bytes)
+{
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  if (!g_hugePagesEnabled || !ptr || bytes < HUGE_PAGE_SIZE) return false;
+  // madvise() requires a page-aligned start address, and heap buffers rarely
+  // are: advance to the next page boundary inside the buffer.
+  const auto pageSize = static_cast<uintptr_t>(::sysconf(_SC_PAGESIZE));
+  const auto base = reinterpret_cast<uintptr_t>(ptr);
+  const uintptr_t start = (base + pageSize - 1) & ~(pageSize - 1);
+  const uintptr_t len = ((base + bytes) - start) & ~(pageSize - 1);
+  if (len < HUGE_PAGE_SIZE) return false;
+  if (::madvise(reinterpret_cast<void*>(start), len, MADV_HUGEPAGE) != 0) return false;
+  g_numAdvised++;
+  return true;
+#else
+  (void)ptr;
+  (void)bytes;
+  return false;
+#endif
+}
+
+mrpt::TAlignedAllocStats mrpt::aligned_alloc_stats()
+{
+  TAlignedAllocStats s;
+  s.num_allocs = g_numAllocs;
+  s.num_frees = g_numFrees;
+  s.num_hugetlb_allocs = g_numHugetlbAllocs;
+  s.num_thp_allocs = g_numThpAllocs;
+  s.num_hugepage_fallbacks = g_numHugeFallbacks;
+  s.num_advised_ranges = g_numAdvised;
+#if defined(__linux__)
+  s.num_hugepage_blocks_in_use = g_numHugeLive;
+  s.hugepage_bytes_in_use = g_hugeBytesLive;
+#endif
+  return s;
+}
+
+void mrpt::reset_aligned_alloc_stats()
+{
+  g_numAllocs = 0;
+  g_numFrees = 0;
+  g_numHugetlbAllocs = 0;
+  g_numThpAllocs = 0;
+  g_numHugeFallbacks = 0;
+  g_numAdvised = 0;
+}
 
 void* mrpt::aligned_calloc(size_t bytes, size_t alignment)
 {
@@ -22,6 +166,16 @@ void* mrpt::aligned_calloc(size_t bytes, size_t alignment)
 }
 void* mrpt::aligned_malloc(size_t size, size_t alignment)
 {
+  g_numAllocs++;
+#if defined(__linux__)
+  // Hugepage-backed mappings are 2 MiB aligned, satisfying any `alignment`
+  // a caller can legitimately request:
+  if (g_hugePagesEnabled && size >= g_hugePageMinBlock)
+  {
+    if (void* p = hugepage_mmap(size); p != nullptr) return p;
+    g_numHugeFallbacks++;
+  }
+#endif
   // size must be an integral multiple of alignment:
   if (alignment != 0 && (size % alignment) != 0) size = ((size / alignment) + 1) * alignment;
 #if defined(_MSC_VER) || defined(__MINGW32_MAJOR_VERSION)
@@ -37,8 +191,30 @@ void* mrpt::aligned_malloc(size_t size, size_t alignment)
   return ::aligned_alloc(alignment, size);
 #endif
 }
+void* mrpt::aligned_malloc_first_touch(size_t size, size_t alignment)
+{
+  void* ptr = mrpt::aligned_malloc(size, alignment);
+  if (!ptr) return nullptr;
+
+  // 4 KiB is a safe lower bound of the page size on all supported
+  // platforms; a stride finer than the actual page size is just redundant.
+  constexpr size_t PAGE_SIZE = 4096;
+  auto* p = static_cast<volatile unsigned char*>(ptr);
+  for (size_t offset = 0; offset < size; offset += PAGE_SIZE) p[offset] = 0;
+  return ptr;
+}
+void* mrpt::aligned_calloc_first_touch(size_t bytes, size_t alignment)
+{
+  // The full memset() in aligned_calloc() already touches every page:
+  return mrpt::aligned_calloc(bytes, alignment);
+}
 void mrpt::aligned_free(void* ptr)
 {
+  g_numFrees++;
+#if defined(__linux__)
+  // Only look into the registry while hugepage blocks are actually live:
+  if (g_numHugeLive.load(std::memory_order_relaxed) != 0 && hugepage_munmap(ptr)) return;
+#endif
 #if defined(_MSC_VER) || defined(__MINGW32_MAJOR_VERSION)
   return _aligned_free(ptr);
 #else
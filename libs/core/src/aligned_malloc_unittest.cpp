@@ -10,6 +10,8 @@
 #include <gtest/gtest.h>
 #include <mrpt/core/aligned_allocator.h>
 
+#include <vector>
+
 template <std::size_t alignment, typename T, typename = std::enable_if_t<std::is_pointer<T>::value>>
 bool my_is_aligned(T ptr)
 {
@@ -40,6 +42,18 @@ TEST(aligned_allocator, aligned_malloc)
   }
 }
 
+TEST(aligned_allocator, aligned_malloc_first_touch)
+{
+  // 10 pages worth of floats:
+  void* p = mrpt::aligned_malloc_first_touch(10 * 4096, 32);
+  EXPECT_TRUE(my_is_aligned<32>(p));
+  // All pages must be committed & writable:
+  auto* ptr = reinterpret_cast<uint8_t*>(p);
+  for (int i = 0; i < 10 * 4096; i += 512) ptr[i] = 0x55;
+
+  mrpt::aligned_free(p);
+}
+
 TEST(aligned_allocator, aligned_calloc)
 {
   void* p = mrpt::aligned_calloc(100, 32);
@@ -49,3 +63,61 @@ TEST(aligned_allocator, aligned_calloc)
 
   mrpt::aligned_free(p);
 }
+
+TEST(aligned_allocator, hugepage_allocations)
+{
+  const auto s0 = mrpt::aligned_alloc_stats();
+
+  EXPECT_FALSE(mrpt::hugepage_allocations_enabled());
+  mrpt::enable_hugepage_allocations(true, 1 * 1024 * 1024);
+  EXPECT_TRUE(mrpt::hugepage_allocations_enabled());
+
+  // A 4 MB block: hugepage-backed on Linux, regular heap elsewhere. Either
+  // way it must be aligned, fully writable, and freeable via aligned_free():
+  constexpr size_t N = 4 * 1024 * 1024;
+  void* p = mrpt::aligned_malloc(N, 32);
+  ASSERT_TRUE(p != nullptr);
+  EXPECT_TRUE(my_is_aligned<32>(p));
+  auto* ptr = reinterpret_cast<uint8_t*>(p);
+  for (size_t i = 0; i < N; i += 512) ptr[i] = 0x5a;
+
+  const auto s1 = mrpt::aligned_alloc_stats();
+  EXPECT_GT(s1.num_allocs, s0.num_allocs);
+#if defined(__linux__)
+  EXPECT_EQ(
+      s1.num_hugepage_blocks_in_use + s1.num_hugepage_fallbacks,
+      s0.num_hugepage_blocks_in_use + s0.num_hugepage_fallbacks + 1);
+  if (s1.num_hugepage_blocks_in_use > s0.num_hugepage_blocks_in_use)
+    EXPECT_GE(s1.hugepage_bytes_in_use, N);
+#endif
+
+  mrpt::aligned_free(p);
+  const auto s2 = mrpt::aligned_alloc_stats();
+  EXPECT_GT(s2.num_frees, s1.num_frees);
+  EXPECT_EQ(s2.num_hugepage_blocks_in_use, s0.num_hugepage_blocks_in_use);
+
+  // Small blocks must keep using the regular path:
+  void* q = mrpt::aligned_malloc(100, 16);
+  EXPECT_EQ(mrpt::aligned_alloc_stats().num_hugepage_blocks_in_use, s0.num_hugepage_blocks_in_use);
+  mrpt::aligned_free(q);
+
+  mrpt::enable_hugepage_allocations(false);
+  EXPECT_FALSE(mrpt::hugepage_allocations_enabled());
+}
+
+TEST(aligned_allocator, advise_huge_pages)
+{
+  std::vector<uint8_t> buf(4 * 1024 * 1024);
+
+  // Disabled => no-op:
+  EXPECT_FALSE(mrpt::advise_huge_pages(buf.data(), buf.size()));
+
+  mrpt::enable_hugepage_allocations(true);
+#if defined(__linux__)
+  EXPECT_TRUE(mrpt::advise_huge_pages(buf.data(), buf.size()));
+  EXPECT_GE(mrpt::aligned_alloc_stats().num_advised_ranges, 1U);
+#endif
+  // Too small to span one whole huge page:
+  EXPECT_FALSE(mrpt::advise_huge_pages(buf.data(), 1024));
+  mrpt::enable_hugepage_allocations(false);
+}
@@ -13,6 +13,7 @@
 #include <functional>
 #include <map>
 #include <string>
+#include <vector>
 
 #include "mrpt-expr_export.h"
 
@@ -122,6 +123,29 @@ class MRPT_EXPR_EXPORT CRuntimeCompiledExpression
    */
   double eval() const;
 
+  /** Batch evaluation: evaluates the formula `N` times, with the variable
+   * named `input_var_name` taking each of the `inputs[0..N-1]` values in
+   * turn, storing the results into `outputs[0..N-1]`. All other registered
+   * variables keep their current values. This amortizes the per-call
+   * overhead of eval() (verbose tracing checks, cache synchronization)
+   * across the whole batch, so it is the preferred entry point for per-ray
+   * or per-particle formulas evaluated in hot loops.
+   *
+   * After the call, the input variable is left set to the last input value.
+   *
+   * \exception std::runtime_error If the formula has not been compiled yet,
+   * or if no variable named `input_var_name` was registered in compile().
+   * \note [New in MRPT 2.14.5]
+   */
+  void eval_batch(
+      const std::string& input_var_name, const double* inputs, double* outputs, size_t N) const;
+
+  /// \overload taking and resizing std::vector containers.
+  void eval_batch(
+      const std::string& input_var_name,
+      const std::vector<double>& inputs,
+      std::vector<double>& outputs) const;
+
   /** Returns true if compile() was called and ended without errors. */
   bool is_compiled() const;
   /** Returns the original formula passed to compile(), or an empty string if
@@ -133,6 +157,27 @@ class MRPT_EXPR_EXPORT CRuntimeCompiledExpression
   /** Access raw exprtk expression object. */
   const exprtk::expression<double>& get_raw_exprtk_expr() const;
 
+  /** Empties the process-wide cache of compiled expressions.
+   *
+   * Identical formulas (same expression text and same set of variable
+   * names, no user-defined functions or extra symbol tables) compiled via
+   * the `std::map` overload of compile() share one compiled exprtk AST
+   * process-wide, so instantiating hundreds of copies of the same
+   * sensor-model formula parses it only once. Instances sharing a cached
+   * expression keep independent variable values (they are copied into the
+   * shared expression under a lock on each eval), at the cost of
+   * serializing *concurrent* evaluations of the very same formula.
+   * The cache can be disabled entirely with the environment variable
+   * `MRPT_EXPR_DISABLE_CACHE=1`.
+   * \note [New in MRPT 2.14.5]
+   */
+  static void clearCompilationCache();
+
+  /** Returns the current number of entries in the process-wide cache of
+   * compiled expressions. \sa clearCompilationCache()
+   * \note [New in MRPT 2.14.5] */
+  static size_t compilationCacheSize();
+
  private:
   struct Impl;
   mrpt::pimpl<Impl> m_impl;
@@ -10,12 +10,15 @@
 #include "expr-precomp.h"  // Precompiled headers
 //
 #include <mrpt/core/exceptions.h>
+#include <mrpt/core/get_env.h>
 #include <mrpt/expr/CRuntimeCompiledExpression.h>
 #include <mrpt/system/string_utils.h>
 
 #include <cmath>  // M_PI
 #include <cstdlib>
 #include <iostream>
+#include <memory>
+#include <mutex>
 
 #define exprtk_disable_string_capabilities  // Workaround a bug in Ubuntu
 // precise's GCC+libstdc++
@@ -57,6 +60,53 @@ struct CRuntimeCompiledExpression::ExprVerbose
   }
 };
 
+// ====== Process-wide cache of compiled expressions =====
+// Compiling an exprtk AST is much more expensive than evaluating it, and
+// applications tend to instantiate many copies of the very same formula
+// (e.g. one per particle or PTG). Formulas compiled via the std::map overload
+// of compile() with no user functions nor extra symbol tables can share one
+// compiled AST: each cache entry owns its own variable storage, and each
+// instance copies its current variable values into that storage (under the
+// entry lock) right before evaluating.
+namespace
+{
+static bool MRPT_EXPR_DISABLE_CACHE = mrpt::get_env<bool>("MRPT_EXPR_DISABLE_CACHE", false);
+
+struct CachedCompiledExpr
+{
+  std::mutex mtx;
+  /// Entry-owned variable storage (std::map: stable addresses)
+  std::map<std::string, double> varStorage;
+  exprtk::symbol_table<double> symtab;
+  exprtk::expression<double> expr;
+};
+
+struct ExprCache
+{
+  static ExprCache& Instance()
+  {
+    static ExprCache obj;
+    return obj;
+  }
+  std::mutex mtx;
+  std::map<std::string, std::shared_ptr<CachedCompiledExpr>> entries;
+};
+
+/// Cache key: expression text plus the ordered set of variable names.
+std::string buildCacheKey(
+    const std::string& expression, const std::map<std::string, double>& variables)
+{
+  std::string key = expression;
+  key += '\x01';
+  for (const auto& v : variables)
+  {
+    key += v.first;
+    key += '\x02';
+  }
+  return key;
+}
+}  // namespace
+
 // We only need this to be on this translation unit, hence the advantage of
 // using our MRPT wrapper instead of the original exprtk sources.
 struct CRuntimeCompiledExpression::Impl
@@ -64,6 +114,17 @@ struct CRuntimeCompiledExpression::Impl
   exprtk::expression<double> m_compiled_formula;
   std::string m_original_expr_str;
   bool m_compiled = false;
+
+  /// True if register_symbol_table() was used (disables the cache):
+  bool m_user_symbol_tables = false;
+  /// Non-null if this instance shares a process-wide cached expression:
+  std::shared_ptr<CachedCompiledExpr> m_cacheEntry;
+  /// Shallow copies of all registered symbol tables, for variable lookups
+  /// in eval_batch():
+  std::vector<exprtk::symbol_table<double>> m_symbol_tables;
+  /// (cache-entry storage slot, user-owned value) pairs, copied slot<-user
+  /// before each evaluation of a cached expression:
+  std::vector<std::pair<double*, const double*>> m_varBindings;
 };
 
 CRuntimeCompiledExpression::CRuntimeCompiledExpression() :
@@ -80,6 +141,59 @@ void CRuntimeCompiledExpression::compile(
 {
   m_impl->m_original_expr_str = expression;
   m_impl->m_compiled = false;
+  m_impl->m_cacheEntry.reset();
+  m_impl->m_varBindings.clear();
+
+  // Fast path: share one compiled AST process-wide for identical formulas.
+  // Only formulas fully defined by (expression, variable names) are
+  // cacheable; user functions and extra symbol tables involve per-instance
+  // pointers.
+  const bool cacheable = !MRPT_EXPR_DISABLE_CACHE && !m_impl->m_user_symbol_tables &&
+                         m_funcs_0.empty() && m_funcs_1.empty() && m_funcs_2.empty() &&
+                         m_funcs_3.empty();
+  if (cacheable)
+  {
+    const std::string key = buildCacheKey(expression, variables);
+    auto& cache = ExprCache::Instance();
+
+    std::shared_ptr<CachedCompiledExpr> entry;
+    {
+      std::lock_guard<std::mutex> lck(cache.mtx);
+      if (auto it = cache.entries.find(key); it != cache.entries.end()) entry = it->second;
+    }
+    if (!entry)
+    {
+      entry = std::make_shared<CachedCompiledExpr>();
+      for (const auto& v : variables) entry->varStorage[v.first] = v.second;
+
+      for (auto& kv : entry->varStorage) entry->symtab.add_variable(kv.first, kv.second);
+      entry->symtab.add_constant("M_PI", M_PI);
+      entry->symtab.add_constants();
+      entry->expr.register_symbol_table(entry->symtab);
+
+      exprtk::parser<double> parser;
+      if (!parser.compile(expression, entry->expr))
+        THROW_EXCEPTION_FMT(
+            "Error compiling expression (name=`%s`): `%s`. Error: `%s`",
+            expr_name_for_error_reporting.c_str(), expression.c_str(), parser.error().c_str());
+
+      // If another thread compiled it meanwhile, keep the first entry so
+      // all instances share a single AST:
+      std::lock_guard<std::mutex> lck(cache.mtx);
+      entry = cache.entries.emplace(key, std::move(entry)).first->second;
+    }
+
+    m_impl->m_cacheEntry = entry;
+    // Shallow copy: shares the AST and symbol table of the cached entry.
+    m_impl->m_compiled_formula = entry->expr;
+    m_impl->m_symbol_tables.clear();
+    m_impl->m_symbol_tables.push_back(entry->symtab);
+    for (const auto& v : variables)
+      m_impl->m_varBindings.emplace_back(&entry->varStorage.at(v.first), &v.second);
+
+    m_impl->m_compiled = true;
+    return;
+  }
 
   exprtk::symbol_table<double> symbol_table;
   for (const auto& v : variables)
@@ -107,6 +221,7 @@ void CRuntimeCompiledExpression::compile(
       symbol_table.add_function(kv.first, *ptr);
 
   m_impl->m_compiled_formula.register_symbol_table(symbol_table);
+  m_impl->m_symbol_tables.push_back(symbol_table);
 
   // Compile user-given expressions:
   exprtk::parser<double> parser;
@@ -121,17 +236,95 @@ void CRuntimeCompiledExpression::compile(
 double CRuntimeCompiledExpression::eval() const
 {
   ASSERT_(m_impl);
-  double ret = m_impl->m_compiled_formula.value();
+  double ret;
+  if (const auto& ce = m_impl->m_cacheEntry; ce)
+  {
+    // Shared compiled AST: copy this instance's variable values in first.
+    std::lock_guard<std::mutex> lck(ce->mtx);
+    for (const auto& b : m_impl->m_varBindings) *b.first = *b.second;
+    ret = m_impl->m_compiled_formula.value();
+  }
+  else
+  {
+    ret = m_impl->m_compiled_formula.value();
+  }
   ExprVerbose::Instance().process(*this, ret);
   return ret;
 }
 
+void CRuntimeCompiledExpression::eval_batch(
+    const std::string& input_var_name, const double* inputs, double* outputs, const size_t N) const
+{
+  ASSERT_(m_impl);
+  ASSERTMSG_(m_impl->m_compiled, "eval_batch() called before compile()");
+
+  // The variable may live in any of the registered symbol tables (e.g. the
+  // one from register_symbol_table() plus the one built in compile()):
+  exprtk::details::variable_node<double>* var = nullptr;
+  for (const auto& st : m_impl->m_symbol_tables)
+  {
+    var = st.get_variable(input_var_name);
+    if (var) break;
+  }
+  ASSERTMSG_(
+      var, mrpt::format(
+               "eval_batch(): no variable named `%s` was registered in compile()",
+               input_var_name.c_str()));
+  double& x = var->ref();
+
+  double ret = 0;
+  if (const auto& ce = m_impl->m_cacheEntry; ce)
+  {
+    std::lock_guard<std::mutex> lck(ce->mtx);
+    // Sync the rest of the variables once for the whole batch:
+    for (const auto& b : m_impl->m_varBindings) *b.first = *b.second;
+    for (size_t i = 0; i < N; i++)
+    {
+      x = inputs[i];
+      outputs[i] = ret = m_impl->m_compiled_formula.value();
+    }
+  }
+  else
+  {
+    for (size_t i = 0; i < N; i++)
+    {
+      x = inputs[i];
+      outputs[i] = ret = m_impl->m_compiled_formula.value();
+    }
+  }
+  if (N) ExprVerbose::Instance().process(*this, ret);
+}
+
+void CRuntimeCompiledExpression::eval_batch(
+    const std::string& input_var_name,
+    const std::vector<double>& inputs,
+    std::vector<double>& outputs) const
+{
+  outputs.resize(inputs.size());
+  eval_batch(input_var_name, inputs.data(), outputs.data(), inputs.size());
+}
+
+void CRuntimeCompiledExpression::clearCompilationCache()
+{
+  auto& cache = ExprCache::Instance();
+  std::lock_guard<std::mutex> lck(cache.mtx);
+  cache.entries.clear();
+}
+
+size_t CRuntimeCompiledExpression::compilationCacheSize()
+{
+  auto& cache = ExprCache::Instance();
+  std::lock_guard<std::mutex> lck(cache.mtx);
+  return cache.entries.size();
+}
+
 void CRuntimeCompiledExpression::register_symbol_table(
     /** [in] Map of variables/constants by `name` ->  `value`. The
        references to the values in this map **must** be ensured to be valid
        thoughout all the life of the compiled expression. */
     const std::map<std::string, double*>& variables)
 {
+  m_impl->m_user_symbol_tables = true;  // per-instance pointers: not cacheable
   exprtk::symbol_table<double> symbol_table;
   for (const auto& v : variables)
   {
@@ -139,6 +332,7 @@ void CRuntimeCompiledExpression::register_symbol_table(
     symbol_table.add_variable(v.first, *var);
   }
   m_impl->m_compiled_formula.register_symbol_table(symbol_table);
+  m_impl->m_symbol_tables.push_back(symbol_table);
 }
 
 exprtk::expression<double>& CRuntimeCompiledExpression::get_raw_exprtk_expr()
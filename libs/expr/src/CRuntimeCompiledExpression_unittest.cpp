@@ -29,6 +29,73 @@ TEST(RuntimeCompiledExpression, SimpleTest)
   EXPECT_NEAR(expr.eval(), vars["x"] * vars["x"] + vars["x"] * vars["y"] + 1.0, 1e-9);
 }
 
+TEST(RuntimeCompiledExpression, CompilationCache)
+{
+  using mrpt::expr::CRuntimeCompiledExpression;
+
+  CRuntimeCompiledExpression::clearCompilationCache();
+  EXPECT_EQ(CRuntimeCompiledExpression::compilationCacheSize(), 0U);
+
+  // Identical formulas share one compiled AST, but each instance keeps its
+  // own variable values:
+  CRuntimeCompiledExpression e1, e2;
+  std::map<std::string, double> vars1, vars2;
+  vars1["a"] = 2.0;
+  vars1["b"] = 3.0;
+  vars2["a"] = -1.0;
+  vars2["b"] = 10.0;
+
+  e1.compile("a*b+1", vars1);
+  e2.compile("a*b+1", vars2);
+  EXPECT_EQ(CRuntimeCompiledExpression::compilationCacheSize(), 1U);
+
+  // Interleaved evaluations must not mix up values:
+  EXPECT_NEAR(e1.eval(), 7.0, 1e-9);
+  EXPECT_NEAR(e2.eval(), -9.0, 1e-9);
+  EXPECT_NEAR(e1.eval(), 7.0, 1e-9);
+
+  // Changes in the user-side variables are picked up, as in the uncached
+  // code path:
+  vars1["b"] = 5.0;
+  EXPECT_NEAR(e1.eval(), 11.0, 1e-9);
+  EXPECT_NEAR(e2.eval(), -9.0, 1e-9);
+
+  // Same text but a different variable set is a different entry:
+  CRuntimeCompiledExpression e3;
+  std::map<std::string, double> vars3;
+  vars3["a"] = 2.0;
+  vars3["b"] = 3.0;
+  vars3["c"] = 0.0;
+  e3.compile("a*b+1", vars3);
+  EXPECT_EQ(CRuntimeCompiledExpression::compilationCacheSize(), 2U);
+
+  CRuntimeCompiledExpression::clearCompilationCache();
+  EXPECT_EQ(CRuntimeCompiledExpression::compilationCacheSize(), 0U);
+
+  // Cached instances must survive a cache clear (they hold shared
+  // ownership of their entry):
+  EXPECT_NEAR(e1.eval(), 11.0, 1e-9);
+}
+
+TEST(RuntimeCompiledExpression, EvalBatch)
+{
+  mrpt::expr::CRuntimeCompiledExpression expr;
+  std::map<std::string, double> vars;
+  vars["x"] = 0.0;
+  vars["k"] = 4.0;
+  expr.compile("x^2+k", vars);
+
+  std::vector<double> xs, outs;
+  for (int i = 0; i < 100; i++) xs.push_back(0.1 * i);
+
+  expr.eval_batch("x", xs, outs);
+  ASSERT_EQ(outs.size(), xs.size());
+  for (size_t i = 0; i < xs.size(); i++) EXPECT_NEAR(outs[i], xs[i] * xs[i] + 4.0, 1e-9);
+
+  // Unknown input variable name:
+  EXPECT_ANY_THROW(expr.eval_batch("does_not_exist", xs, outs));
+}
+
 static double myNullary() { return 10.0; }
 
 static double myNeg(double x) { return -x; }
@@ -0,0 +1,261 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+#pragma once
+#include <mrpt/core/exceptions.h>
+#include <mrpt/system/CTicTac.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace mrpt::graphs
+{
+/** Incremental shortest-path search (D* Lite, Koenig & Likhachev 2002) for
+ * planners that replan repeatedly over a slowly-changing graph, e.g. a grid
+ * map updated from sensor data.
+ *
+ * Unlike CAStarAlgorithm, which starts every query from scratch, this class
+ * keeps its search tree between calls: after edge costs change, call
+ * notifyNodeChanged() for the affected nodes and the next
+ * computeShortestPath() repairs only the part of the tree they invalidate.
+ * Node records live in a hash map that persists across queries, and the open
+ * list is a binary heap with lazy removal, so no per-call bookkeeping
+ * containers are allocated.
+ *
+ * To use it, derive a class implementing getNeighbors() and heuristic() for
+ * the graph at hand. Edges are assumed symmetric (cost(a,b)=cost(b,a)), as in
+ * typical occupancy-grid planners. A node whose traversal becomes forbidden
+ * is expressed by returning an infinite edge cost for it.
+ *
+ * Typical replanning loop:
+ * \code
+ *  planner.init(start, goal);
+ *  planner.computeShortestPath();
+ *  planner.getPath(path);
+ *  // ... world changes ...
+ *  for (auto cell : changedCells) planner.notifyNodeChanged(cell);
+ *  planner.setNewStart(currentRobotCell);  // if the robot moved
+ *  planner.computeShortestPath();          // incremental repair
+ *  planner.getPath(path);
+ * \endcode
+ *
+ * \note [New in MRPT 2.14.5]
+ * \sa CAStarAlgorithm
+ * \ingroup mrpt_graphs_grp
+ */
+template <typename node_id_t = uint64_t>
+class CDStarLiteAlgorithm
+{
+ public:
+  virtual ~CDStarLiteAlgorithm() = default;
+
+  /** Client code must implement this method: returns the traversable
+   * neighbors of a node together with the (symmetric) edge cost of reaching
+   * each of them. An infinite cost marks a currently-blocked edge. */
+  virtual void getNeighbors(
+      const node_id_t& id, std::vector<std::pair<node_id_t, double>>& outNeighbors) = 0;
+
+  /** Client code must implement this method: admissible estimate of the cost
+   * between two nodes (never larger than the actual cost, >=0). */
+  virtual double heuristic(const node_id_t& from, const node_id_t& to) = 0;
+
+  /** Resets the search tree and sets a new query. Must be called once before
+   * the first computeShortestPath(); calling it again discards all
+   * incremental state (e.g. for a new goal, which D* Lite cannot reuse). */
+  void init(const node_id_t& start, const node_id_t& goal)
+  {
+    m_nodes.clear();
+    m_open.clear();
+    m_km = 0;
+    m_start = start;
+    m_goal = goal;
+    m_initialized = true;
+
+    auto& g = node(m_goal);
+    g.rhs = 0;
+    pushOpen(m_goal, calculateKey(m_goal));
+  }
+
+  /** Informs the planner that the edges incident to this node changed cost
+   * (e.g. the cell was blocked or freed). Cheap: defers all real work to the
+   * next computeShortestPath(). */
+  void notifyNodeChanged(const node_id_t& id)
+  {
+    ASSERTMSG_(m_initialized, "init() must be called first");
+    updateVertex(id);
+    getNeighbors(id, m_neighbors);
+    for (const auto& [n, cost] : m_neighbors) updateVertex(n);
+  }
+
+  /** Moves the query start (the robot moved); the existing tree is kept
+   * valid through the km heuristic offset, as in the original algorithm. */
+  void setNewStart(const node_id_t& newStart)
+  {
+    ASSERTMSG_(m_initialized, "init() must be called first");
+    m_km += heuristic(m_start, newStart);
+    m_start = newStart;
+  }
+
+  /** Computes or incrementally repairs the shortest path from the current
+   * start to the goal.
+   * \return false if no path exists (or the time limit was hit before the
+   * tree became consistent). */
+  bool computeShortestPath(double maxComputationTime = HUGE_VAL)
+  {
+    ASSERTMSG_(m_initialized, "init() must be called first");
+    mrpt::system::CTicTac time;
+    time.Tic();
+
+    while (!m_open.empty())
+    {
+      const auto& sd = node(m_start);
+      if (!(m_open.front().key < calculateKey(m_start)) && sd.rhs == sd.g) break;
+
+      if (time.Tac() >= maxComputationTime) return false;
+
+      const THeapEntry top = m_open.front();
+      std::pop_heap(m_open.begin(), m_open.end(), heapCmp);
+      m_open.pop_back();
+
+      auto& nd = node(top.id);
+      // Lazy removal: drop entries made stale by a later updateVertex():
+      if (nd.g == nd.rhs) continue;
+      const TKey kNew = calculateKey(top.id);
+      if (top.key < kNew)
+      {
+        pushOpen(top.id, kNew);
+        continue;
+      }
+
+      if (nd.g > nd.rhs)
+      {
+        // Over-consistent: settle it and relax its neighbors.
+        nd.g = nd.rhs;
+        getNeighbors(top.id, m_neighbors);
+        for (const auto& [n, cost] : m_neighbors) updateVertex(n);
+      }
+      else
+      {
+        // Under-consistent: invalidate and re-evaluate it and neighbors.
+        nd.g = INF;
+        updateVertex(top.id);
+        getNeighbors(top.id, m_neighbors);
+        for (const auto& [n, cost] : m_neighbors) updateVertex(n);
+      }
+    }
+
+    const auto& sd = node(m_start);
+    return sd.rhs != INF && sd.rhs == sd.g;
+  }
+
+  /** Extracts the planned path (start and goal included) by greedily
+   * descending the cost-to-goal field.
+   * \return false if no path is available. */
+  bool getPath(std::vector<node_id_t>& outPath)
+  {
+    outPath.clear();
+    if (!m_initialized || node(m_start).g == INF) return false;
+
+    node_id_t cur = m_start;
+    outPath.push_back(cur);
+    // g strictly decreases along an optimal path, so this terminates:
+    while (!(cur == m_goal))
+    {
+      getNeighbors(cur, m_neighbors);
+      double best = INF;
+      node_id_t bestId = cur;
+      for (const auto& [n, cost] : m_neighbors)
+      {
+        const double c = cost + node(n).g;
+        if (c < best)
+        {
+          best = c;
+          bestId = n;
+        }
+      }
+      if (best == INF || node(bestId).g >= node(cur).g) return false;  // broken tree
+      cur = bestId;
+      outPath.push_back(cur);
+    }
+    return true;
+  }
+
+  /** Cost of the current planned path, or infinite if none. */
+  double pathCost() { return m_initialized ? node(m_start).g : INF; }
+
+  /** Number of node records kept in the pooled storage. */
+  size_t storedNodesCount() const { return m_nodes.size(); }
+
+ private:
+  static constexpr double INF = std::numeric_limits<double>::infinity();
+
+  /** D* Lite priority: lexicographically-ordered pair. */
+  struct TKey
+  {
+    double k1, k2;
+    bool operator<(const TKey& o) const { return k1 < o.k1 || (k1 == o.k1 && k2 < o.k2); }
+  };
+
+  struct TNode
+  {
+    double g{INF}, rhs{INF};
+  };
+
+  struct THeapEntry
+  {
+    TKey key;
+    node_id_t id;
+  };
+
+  /** std::make_heap is a max-heap; invert to pop the minimum key. */
+  static bool heapCmp(const THeapEntry& a, const THeapEntry& b) { return b.key < a.key; }
+
+  TNode& node(const node_id_t& id) { return m_nodes[id]; }
+
+  TKey calculateKey(const node_id_t& id)
+  {
+    const auto& n = node(id);
+    const double m = std::min(n.g, n.rhs);
+    return {m + heuristic(m_start, id) + m_km, m};
+  }
+
+  void pushOpen(const node_id_t& id, const TKey& key)
+  {
+    m_open.push_back({key, id});
+    std::push_heap(m_open.begin(), m_open.end(), heapCmp);
+  }
+
+  /** Re-evaluates rhs(id) from its neighbors and re-queues it if it became
+   * inconsistent. Stale open-list copies are skipped lazily at pop time. */
+  void updateVertex(const node_id_t& id)
+  {
+    auto& n = node(id);
+    if (!(id == m_goal))
+    {
+      n.rhs = INF;
+      getNeighbors(id, m_neighborsUpd);
+      for (const auto& [s, cost] : m_neighborsUpd)
+        n.rhs = std::min(n.rhs, cost + node(s).g);
+    }
+    if (n.g != n.rhs) pushOpen(id, calculateKey(id));
+  }
+
+  std::unordered_map<node_id_t, TNode> m_nodes;
+  std::vector<THeapEntry> m_open;
+  /** Scratch buffers, reused to avoid per-expansion allocations. */
+  std::vector<std::pair<node_id_t, double>> m_neighbors, m_neighborsUpd;
+  double m_km{0};
+  node_id_t m_start{}, m_goal{};
+  bool m_initialized{false};
+};
+}  // namespace mrpt::graphs
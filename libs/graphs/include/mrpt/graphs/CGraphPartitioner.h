@@ -40,6 +40,13 @@ template <class GRAPH_MATRIX, typename num_t = typename GRAPH_MATRIX::Scalar>
 class CGraphPartitioner
 {
  public:
+  /** Graph sizes (number of nodes) above this threshold make
+   * SpectralBisection() switch from the exact dense eigendecomposition
+   * (O(N^3), computes the whole spectrum) to the iterative Fiedler-vector
+   * solver (O(N^2) per iteration, multithreaded mat-vec products, optional
+   * warm start). \note [New in MRPT 2.14.5] */
+  static constexpr size_t ITERATIVE_FIEDLER_THRESHOLD = 512;
+
   /** Performs the spectral recursive partition into K-parts for a given
    * graph.
    * The default threshold for the N-cut is 1, which correspond to a cut
@@ -63,6 +70,14 @@ class CGraphPartitioner
    * partitions. Set to false to force 1 bisection as maximum.
    * \param minSizeClusters [IN] Default=1, Minimum size of partitions to be
    * accepted.
+   * \param inout_fiedler [IN/OUT] Optional warm start for the iterative
+   * Fiedler-vector solver of the *top-level* bisection (recursive splits work
+   * on remapped submatrices and always start cold). On input, a vector from a
+   * previous partitioning of a similar graph; on output, the Fiedler vector
+   * actually used. Callers that re-partition a growing graph (e.g.
+   * mrpt::slam::CIncrementalMapPartitioner) can keep it across calls to cut
+   * down the iteration count. It is only a convergence hint, so stale
+   * contents are harmless. [New in MRPT 2.14.5]
    *
    * \sa SpectralBisection
    *
@@ -76,7 +91,8 @@ class CGraphPartitioner
       bool useSpectralBisection = true,
       bool recursive = true,
       unsigned minSizeClusters = 1,
-      const bool verbose = false);
+      const bool verbose = false,
+      std::vector<typename GRAPH_MATRIX::Scalar>* inout_fiedler = nullptr);
 
   /** Performs the spectral bisection of a graph. This method always perform
    *   the bisection, and a measure of the goodness for this cut is returned.
@@ -97,6 +113,10 @@ class CGraphPartitioner
    * W<sub>ij</sub> and W<sub>ji</sub> are replaced by
    * 0.5*(W<sub>ij</sub>+W<sub>ji</sub>). Set to false if matrix is known to
    * be simetric.
+   * \param inout_fiedler	[IN/OUT] Optional warm start for (and output of)
+   * the iterative Fiedler-vector solver used on graphs larger than
+   * ITERATIVE_FIEDLER_THRESHOLD nodes; see RecursiveSpectralPartition().
+   * [New in MRPT 2.14.5]
    *
    * \sa mrpt::math::CMatrixF, RecursiveSpectralPartition
    *
@@ -107,7 +127,8 @@ class CGraphPartitioner
       std::vector<uint32_t>& out_part1,
       std::vector<uint32_t>& out_part2,
       num_t& out_cut_value,
-      bool forceSimetry = true);
+      bool forceSimetry = true,
+      std::vector<typename GRAPH_MATRIX::Scalar>* inout_fiedler = nullptr);
 
   /** Performs an EXACT minimum n-Cut graph bisection, (Use
    * CGraphPartitioner::SpectralBisection for a faster algorithm)
@@ -148,6 +169,15 @@ class CGraphPartitioner
       const std::vector<uint32_t>& in_part1,
       const std::vector<uint32_t>& in_part2);
 
+ private:
+  /** Approximates the Fiedler vector (eigenvector of the 2nd smallest
+   * eigenvalue) of the given graph Laplacian by deflated power iteration,
+   * with multithreaded matrix-vector products for large graphs.
+   * If \a inout_fiedler is non-empty on input it is used as warm start
+   * (entries beyond its size, for a graph that grew, start at zero). */
+  static void approxFiedlerVector(
+      const GRAPH_MATRIX& in_lap, std::vector<typename GRAPH_MATRIX::Scalar>& inout_fiedler);
+
 };  // End of class def.
 
 }  // namespace graphs
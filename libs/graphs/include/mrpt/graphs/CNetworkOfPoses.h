@@ -45,6 +45,34 @@ namespace detail
 template <class GRAPH_T>
 struct graph_ops;
 
+/** Internal state of CNetworkOfPoses::dijkstra_nodes_estimate_incremental():
+ * the spanning tree of the previous run, kept so successive calls only have
+ * to repair the part of the tree affected by newly inserted edges.
+ * It is validated against the current edge set on each call, so it never
+ * needs explicit invalidation. Not serialized.
+ * \note [New in MRPT 2.14.5]
+ */
+struct TDijkstraSpanningTreeCache
+{
+  bool valid = false;
+  /** The root node the cached tree was grown from */
+  TNodeID root = INVALID_NODEID;
+  /** Hop count (topological distance) from the root, per reached node */
+  std::map<TNodeID, size_t> dist;
+  /** The parent of each (non-root) node in the spanning tree */
+  std::map<TNodeID, TNodeID> prev_node;
+  /** The graph edge linking each (non-root) node with its parent, in the
+   * direction it is stored in the graph */
+  std::map<TNodeID, TPairNodeIDs> prev_arc;
+  /** Number of edges per node pair already incorporated into the tree; used
+   * to detect edge insertions and removals since the previous run */
+  std::map<TPairNodeIDs, size_t> known_edge_counts;
+  /** Undirected adjacency lists, kept in sync with the edges above */
+  std::map<TNodeID, std::vector<TNodeID>> neighbors;
+
+  void clear() { *this = {}; }
+};
+
 // forward declaration of CVisualizer
 template <
     class CPOSE,  // Type of edges
@@ -222,6 +250,11 @@ class CNetworkOfPoses : public mrpt::graphs::CDirectedGraph<CPOSE, EDGE_ANNOTATI
    */
   bool edges_store_inverse_poses{false};
 
+  /** Cached spanning tree used by dijkstra_nodes_estimate_incremental().
+   * Managed automatically (it is checked against the current edge set on
+   * each call), so there is normally no need to touch it. Not serialized. */
+  detail::TDijkstraSpanningTreeCache dijkstra_tree_cache;
+
   /** @} */
 
   /** @name I/O methods
@@ -283,6 +316,36 @@ class CNetworkOfPoses : public mrpt::graphs::CDirectedGraph<CPOSE, EDGE_ANNOTATI
     detail::graph_ops<self_t>::load_graph_of_poses_from_text_stream(this, i);
   }
 
+  /** Saves the graph to a compact binary file: a small header plus node and
+   * edge sections of fixed-size records, written in bulk, so saving and
+   * loading large (e.g. >10^6 edge) graphs is orders of magnitude faster
+   * than the ASCII format of saveToTextFile(). If \a fileName ends in
+   * ".gz" the file is transparently gzip-compressed.
+   * Since both formats live side by side in this class, converting is just
+   * loading with one flavor and saving with the other.
+   * \note Unlike saveToTextFile(), custom node/edge annotations are NOT
+   * stored in this format.
+   * \note [New in MRPT 2.14.5]
+   * \sa loadFromBinaryFile, saveToTextFile
+   * \exception On any error
+   */
+  void saveToBinaryFile(const std::string& fileName) const
+  {
+    detail::graph_ops<self_t>::save_graph_of_poses_to_binary_records_file(this, fileName);
+  }
+
+  /** Loads a graph stored with saveToBinaryFile(). The file must have been
+   * written by the very same graph type (this is checked and an exception
+   * raised otherwise).
+   * \note [New in MRPT 2.14.5]
+   * \sa saveToBinaryFile, loadFromTextFile
+   * \exception On any error
+   */
+  void loadFromBinaryFile(const std::string& fileName)
+  {
+    detail::graph_ops<self_t>::load_graph_of_poses_from_binary_records_file(this, fileName);
+  }
+
   /** @} */
 
   /** @name Utility methods
@@ -336,6 +399,29 @@ class CNetworkOfPoses : public mrpt::graphs::CDirectedGraph<CPOSE, EDGE_ANNOTATI
         this, topological_distances ? &topological_distances.value().get() : nullptr);
   }
 
+  /** Incremental version of dijkstra_nodes_estimate(): the spanning tree of
+   * the previous call is kept in \a dijkstra_tree_cache and, when the only
+   * change since then is a set of newly inserted edges (and nodes), only the
+   * affected subtree is repaired and re-estimated instead of re-solving the
+   * whole graph. A full re-computation is transparently run whenever the
+   * cache cannot be reused: first call, a different \a root, or removed or
+   * replaced edges.
+   *
+   * Semantic differences with dijkstra_nodes_estimate():
+   *  - The global poses of nodes whose tree path did not change are left
+   *    untouched (e.g. previously optimized estimates are preserved).
+   *  - During an incremental repair, nodes not (yet) connected to \a root
+   *    are silently left unestimated rather than throwing
+   *    mrpt::graphs::detail::NotConnectedGraph.
+   *
+   * \note [New in MRPT 2.14.5]
+   * \sa dijkstra_nodes_estimate, dijkstra_tree_cache
+   */
+  inline void dijkstra_nodes_estimate_incremental()
+  {
+    detail::graph_ops<self_t>::graph_of_poses_dijkstra_update(this);
+  }
+
   /** Look for duplicated edges (even in opposite directions) between all
    * pairs of nodes and fuse them.  Upon return, only one edge remains
    * between each pair of nodes with the mean & covariance (or information
@@ -10,6 +10,10 @@
 
 #include <mrpt/graphs/TNodeAnnotations.h>
 #include <mrpt/graphs/dijkstra.h>
+#include <mrpt/io/CFileGZInputStream.h>
+#include <mrpt/io/CFileGZOutputStream.h>
+#include <mrpt/io/CFileInputStream.h>
+#include <mrpt/io/CFileOutputStream.h>
 #include <mrpt/io/CTextFileLinesParser.h>
 #include <mrpt/math/CVectorFixed.h>
 #include <mrpt/math/TPose2D.h>
@@ -27,6 +31,9 @@
 #include <mrpt/poses/CPosePDFGaussianInf.h>
 #include <mrpt/system/string_utils.h>
 
+#include <limits>
+#include <queue>
+
 namespace mrpt::graphs::detail
 {
 using namespace std;
@@ -212,6 +219,240 @@ struct graph_ops
     }
   }
 
+  /** @name Fixed-size record encoders/decoders for the compact binary graph
+      file format (see save_graph_of_poses_to_binary_records_file())
+     @{ */
+  static constexpr uint32_t pose_record_len(const mrpt::poses::CPose2D*) { return 3; }
+  static constexpr uint32_t pose_record_len(const mrpt::poses::CPose3D*) { return 6; }
+  static constexpr uint32_t edge_record_len(const mrpt::poses::CPose2D*) { return 3; }
+  static constexpr uint32_t edge_record_len(const mrpt::poses::CPose3D*) { return 6; }
+  static constexpr uint32_t edge_record_len(const CPosePDFGaussianInf*) { return 3 + 9; }
+  static constexpr uint32_t edge_record_len(const CPosePDFGaussian*) { return 3 + 9; }
+  static constexpr uint32_t edge_record_len(const CPose3DPDFGaussianInf*) { return 6 + 36; }
+  static constexpr uint32_t edge_record_len(const CPose3DPDFGaussian*) { return 6 + 36; }
+
+  static void pose_to_record(const mrpt::poses::CPose2D& p, double* r)
+  {
+    r[0] = p.x();
+    r[1] = p.y();
+    r[2] = p.phi();
+  }
+  static void pose_to_record(const mrpt::poses::CPose3D& p, double* r)
+  {
+    r[0] = p.x();
+    r[1] = p.y();
+    r[2] = p.z();
+    r[3] = p.yaw();
+    r[4] = p.pitch();
+    r[5] = p.roll();
+  }
+  static void record_to_pose(const double* r, mrpt::poses::CPose2D& p)
+  {
+    p = mrpt::poses::CPose2D(r[0], r[1], r[2]);
+  }
+  static void record_to_pose(const double* r, mrpt::poses::CPose3D& p)
+  {
+    p.setFromValues(r[0], r[1], r[2], r[3], r[4], r[5]);
+  }
+
+  static void edge_to_record(const mrpt::poses::CPose2D& e, double* r) { pose_to_record(e, r); }
+  static void edge_to_record(const mrpt::poses::CPose3D& e, double* r) { pose_to_record(e, r); }
+  static void edge_to_record(const CPosePDFGaussianInf& e, double* r)
+  {
+    pose_to_record(e.mean, r);
+    for (int i = 0; i < 3; i++)
+      for (int j = 0; j < 3; j++) r[3 + i * 3 + j] = e.cov_inv(i, j);
+  }
+  static void edge_to_record(const CPosePDFGaussian& e, double* r)
+  {
+    pose_to_record(e.mean, r);
+    for (int i = 0; i < 3; i++)
+      for (int j = 0; j < 3; j++) r[3 + i * 3 + j] = e.cov(i, j);
+  }
+  static void edge_to_record(const CPose3DPDFGaussianInf& e, double* r)
+  {
+    pose_to_record(e.mean, r);
+    for (int i = 0; i < 6; i++)
+      for (int j = 0; j < 6; j++) r[6 + i * 6 + j] = e.cov_inv(i, j);
+  }
+  static void edge_to_record(const CPose3DPDFGaussian& e, double* r)
+  {
+    pose_to_record(e.mean, r);
+    for (int i = 0; i < 6; i++)
+      for (int j = 0; j < 6; j++) r[6 + i * 6 + j] = e.cov(i, j);
+  }
+  static void record_to_edge(const double* r, mrpt::poses::CPose2D& e) { record_to_pose(r, e); }
+  static void record_to_edge(const double* r, mrpt::poses::CPose3D& e) { record_to_pose(r, e); }
+  static void record_to_edge(const double* r, CPosePDFGaussianInf& e)
+  {
+    record_to_pose(r, e.mean);
+    for (int i = 0; i < 3; i++)
+      for (int j = 0; j < 3; j++) e.cov_inv(i, j) = r[3 + i * 3 + j];
+  }
+  static void record_to_edge(const double* r, CPosePDFGaussian& e)
+  {
+    record_to_pose(r, e.mean);
+    for (int i = 0; i < 3; i++)
+      for (int j = 0; j < 3; j++) e.cov(i, j) = r[3 + i * 3 + j];
+  }
+  static void record_to_edge(const double* r, CPose3DPDFGaussianInf& e)
+  {
+    record_to_pose(r, e.mean);
+    for (int i = 0; i < 6; i++)
+      for (int j = 0; j < 6; j++) e.cov_inv(i, j) = r[6 + i * 6 + j];
+  }
+  static void record_to_edge(const double* r, CPose3DPDFGaussian& e)
+  {
+    record_to_pose(r, e.mean);
+    for (int i = 0; i < 6; i++)
+      for (int j = 0; j < 6; j++) e.cov(i, j) = r[6 + i * 6 + j];
+  }
+  /** @} */
+
+  // =================================================================
+  //                save_graph_of_poses_to_binary_records_file
+  // =================================================================
+  static void save_graph_of_poses_to_binary_records_file(const graph_t* g, const std::string& fil)
+  {
+    mrpt::io::CFileGZOutputStream fgz;
+    mrpt::io::CFileOutputStream fplain;
+    mrpt::io::CStream* f;
+    if (fil.size() > 3 && fil.substr(fil.size() - 3) == ".gz")
+    {
+      if (!fgz.open(fil)) THROW_EXCEPTION_FMT("Error opening file '%s' for writing", fil.c_str());
+      f = &fgz;
+    }
+    else
+    {
+      if (!fplain.open(fil))
+        THROW_EXCEPTION_FMT("Error opening file '%s' for writing", fil.c_str());
+      f = &fplain;
+    }
+    auto out = mrpt::serialization::archiveFrom(*f);
+
+    const uint32_t poseDim =
+        pose_record_len(static_cast<const typename graph_t::constraint_no_pdf_t*>(nullptr));
+    const uint32_t edgeDim =
+        edge_record_len(static_cast<const typename graph_t::constraint_t*>(nullptr));
+    const uint64_t nNodes = g->nodes.size(), nEdges = g->edges.size();
+
+    // Header:
+    out << std::string("MRPT-GRAPH-BIN") << uint32_t(0) /*format version*/
+        << std::string(mrpt::typemeta::TTypeName<graph_t>::get().c_str()) << poseDim << edgeDim
+        << nNodes << nEdges << uint64_t(g->root);
+
+    // Node section: ids, then poses, as contiguous fixed-size records:
+    {
+      std::vector<uint64_t> ids;
+      std::vector<double> recs(nNodes * poseDim);
+      ids.reserve(nNodes);
+      size_t i = 0;
+      for (const auto& n : g->nodes)
+      {
+        ids.push_back(n.first);
+        pose_to_record(n.second, &recs[(i++) * poseDim]);
+      }
+      if (nNodes)
+      {
+        out.WriteBufferFixEndianness(&ids[0], ids.size());
+        out.WriteBufferFixEndianness(&recs[0], recs.size());
+      }
+    }
+    // Edge section: (from,to) pairs, then edge records:
+    {
+      std::vector<uint64_t> endpoints;
+      std::vector<double> recs(nEdges * edgeDim);
+      endpoints.reserve(2 * nEdges);
+      size_t i = 0;
+      for (const auto& e : g->edges)
+      {
+        endpoints.push_back(e.first.first);
+        endpoints.push_back(e.first.second);
+        edge_to_record(e.second, &recs[(i++) * edgeDim]);
+      }
+      if (nEdges)
+      {
+        out.WriteBufferFixEndianness(&endpoints[0], endpoints.size());
+        out.WriteBufferFixEndianness(&recs[0], recs.size());
+      }
+    }
+  }
+
+  // =================================================================
+  //                load_graph_of_poses_from_binary_records_file
+  // =================================================================
+  static void load_graph_of_poses_from_binary_records_file(graph_t* g, const std::string& fil)
+  {
+    mrpt::io::CFileGZInputStream fgz;
+    mrpt::io::CFileInputStream fplain;
+    mrpt::io::CStream* f;
+    if (fil.size() > 3 && fil.substr(fil.size() - 3) == ".gz")
+    {
+      if (!fgz.open(fil)) THROW_EXCEPTION_FMT("Error opening file '%s'", fil.c_str());
+      f = &fgz;
+    }
+    else
+    {
+      if (!fplain.open(fil)) THROW_EXCEPTION_FMT("Error opening file '%s'", fil.c_str());
+      f = &fplain;
+    }
+    auto in = mrpt::serialization::archiveFrom(*f);
+
+    // Header:
+    std::string magic;
+    in >> magic;
+    ASSERT_EQUAL_(magic, std::string("MRPT-GRAPH-BIN"));
+    uint32_t version;
+    in >> version;
+    if (version != 0) MRPT_THROW_UNKNOWN_SERIALIZATION_VERSION(version);
+
+    std::string storedClassName;
+    in >> storedClassName;
+    const std::string sClassName = mrpt::typemeta::TTypeName<graph_t>::get().c_str();
+    ASSERT_EQUAL_(storedClassName, sClassName);
+
+    const uint32_t poseDim =
+        pose_record_len(static_cast<const typename graph_t::constraint_no_pdf_t*>(nullptr));
+    const uint32_t edgeDim =
+        edge_record_len(static_cast<const typename graph_t::constraint_t*>(nullptr));
+    uint32_t storedPoseDim, storedEdgeDim;
+    uint64_t nNodes, nEdges, root;
+    in >> storedPoseDim >> storedEdgeDim >> nNodes >> nEdges >> root;
+    ASSERT_EQUAL_(storedPoseDim, poseDim);
+    ASSERT_EQUAL_(storedEdgeDim, edgeDim);
+
+    g->clear();
+    g->root = root;
+
+    // Node section:
+    if (nNodes)
+    {
+      std::vector<uint64_t> ids(nNodes);
+      std::vector<double> recs(nNodes * poseDim);
+      in.ReadBufferFixEndianness(&ids[0], ids.size());
+      in.ReadBufferFixEndianness(&recs[0], recs.size());
+      for (size_t i = 0; i < nNodes; i++)
+      {
+        typename graph_t::constraint_no_pdf_t& newNode = g->nodes[ids[i]];
+        record_to_pose(&recs[i * poseDim], newNode);
+      }
+    }
+    // Edge section:
+    if (nEdges)
+    {
+      std::vector<uint64_t> endpoints(2 * nEdges);
+      std::vector<double> recs(nEdges * edgeDim);
+      in.ReadBufferFixEndianness(&endpoints[0], endpoints.size());
+      in.ReadBufferFixEndianness(&recs[0], recs.size());
+      typename graph_t::constraint_t e;
+      for (size_t i = 0; i < nEdges; i++)
+      {
+        record_to_edge(&recs[i * edgeDim], e);
+        g->insertEdgeAtEnd(endpoints[2 * i + 0], endpoints[2 * i + 1], e);
+      }
+    }
+  }
+
   // =================================================================
   //                     load_graph_of_poses_from_text_file
   // =================================================================
@@ -678,7 +919,9 @@ struct graph_ops
   // specified in \a root.
   // --------------------------------------------------------------------------------
   static void graph_of_poses_dijkstra_init(
-      graph_t* g, std::map<TNodeID, size_t>* topological_distances = nullptr)
+      graph_t* g,
+      std::map<TNodeID, size_t>* topological_distances = nullptr,
+      TDijkstraSpanningTreeCache* out_tree_cache = nullptr)
   {
     MRPT_START
     using namespace std;
@@ -687,6 +930,8 @@ struct graph_ops
     using dijkstra_t = CDijkstra<graph_t, typename graph_t::maps_implementation_t>;
     using constraint_t = typename graph_t::constraint_t;
 
+    if (out_tree_cache) out_tree_cache->clear();
+
     // initialize corresponding dijkstra object from root.
     dijkstra_t dijkstra(*g, g->root);
 
@@ -700,6 +945,7 @@ struct graph_ops
     {
       graph_t* m_g;  // The original graph
       std::map<TNodeID, size_t>* m_topo_dists{nullptr};
+      TDijkstraSpanningTreeCache* m_tree_cache{nullptr};
 
       VisitorComputePoses(graph_t* g) : m_g(g) {}
       void OnVisitNode(
@@ -712,6 +958,17 @@ struct graph_ops
         // topological distance:
         if (m_topo_dists) (*m_topo_dists)[child_id] = depth_level;
 
+        // spanning tree cache, for later incremental re-estimations:
+        if (m_tree_cache)
+        {
+          m_tree_cache->dist[child_id] = depth_level;
+          m_tree_cache->prev_node[child_id] = parent_id;
+          // In the direction the edge is stored in the graph:
+          m_tree_cache->prev_arc[child_id] = edge_to_child.reverse
+              ? std::make_pair(child_id, parent_id)
+              : std::make_pair(parent_id, child_id);
+        }
+
         // Compute the pose of "child_id" as parent_pose (+)
         // edge_delta_pose,
         //  taking into account that that edge may be in reverse order
@@ -752,11 +1009,28 @@ struct graph_ops
     // Run the visit thru all nodes in the tree:
     VisitorComputePoses myVisitor(g);
     myVisitor.m_topo_dists = topological_distances;
+    myVisitor.m_tree_cache = out_tree_cache;
     treeView.visitBreadthFirst(treeView.root, myVisitor);
 
     // The distance of "root" is zero (it's not visited in the loop above!):
     if (topological_distances) (*topological_distances)[g->root] = 0;
 
+    if (out_tree_cache)
+    {
+      out_tree_cache->valid = true;
+      out_tree_cache->root = g->root;
+      out_tree_cache->dist[g->root] = 0;
+      for (const auto& e : g->edges)
+      {
+        auto& count = out_tree_cache->known_edge_counts[e.first];
+        if (count++ == 0 && e.first.first != e.first.second)
+        {
+          out_tree_cache->neighbors[e.first.first].push_back(e.first.second);
+          out_tree_cache->neighbors[e.first.second].push_back(e.first.first);
+        }
+      }
+    }
+
     // Fill the NODE_ANNOTATIONS part again
     if (!empty_node_annots)
     {
@@ -781,6 +1055,146 @@ struct graph_ops
     MRPT_END
   }  // end of graph_of_poses_dijkstra_init
 
+  // --------------------------------------------------------------------------------
+  //               Implements: dijkstra_nodes_estimate_incremental
+  //
+  //	Repairs the cached spanning tree (and the global poses that depend on
+  // it) after new edges and nodes were inserted, falling back to a full
+  // graph_of_poses_dijkstra_init() whenever the cache cannot be reused.
+  // --------------------------------------------------------------------------------
+  static void graph_of_poses_dijkstra_update(graph_t* g)
+  {
+    MRPT_START
+    using namespace std;
+
+    auto& cache = g->dijkstra_tree_cache;
+
+    // Find out what changed since the cached tree was computed: only *added*
+    // edges can be handled incrementally.
+    bool need_full_rebuild = !cache.valid || cache.root != g->root;
+
+    vector<TPairNodeIDs> new_pairs;  // node pairs adjacent for the 1st time
+    if (!need_full_rebuild)
+    {
+      size_t totalKnown = 0, knownVisited = 0;
+      for (const auto& kv : cache.known_edge_counts) totalKnown += kv.second;
+
+      // g->edges is sorted by (from,to), so equal pairs come in runs:
+      for (auto it = g->edges.begin(); it != g->edges.end() && !need_full_rebuild;)
+      {
+        const TPairNodeIDs ids = it->first;
+        size_t count = 0;
+        for (; it != g->edges.end() && it->first == ids; ++it) count++;
+
+        const auto itKnown = cache.known_edge_counts.find(ids);
+        const size_t known = itKnown == cache.known_edge_counts.end() ? 0 : itKnown->second;
+        if (count < known) need_full_rebuild = true;  // edge(s) removed
+        knownVisited += known;
+        if (known == 0) new_pairs.push_back(ids);
+      }
+      // Any known pair entirely missing from the graph?
+      if (knownVisited != totalKnown) need_full_rebuild = true;
+    }
+
+    if (need_full_rebuild)
+    {
+      graph_of_poses_dijkstra_init(g, nullptr, &cache);
+      return;
+    }
+
+    // Update the bookkeeping with the edges added since the last run:
+    for (const auto& ids : new_pairs)
+    {
+      if (ids.first == ids.second) continue;  // ignore self-loops...
+      cache.neighbors[ids.first].push_back(ids.second);
+      cache.neighbors[ids.second].push_back(ids.first);
+    }
+    cache.known_edge_counts.clear();
+    for (const auto& e : g->edges) cache.known_edge_counts[e.first]++;
+
+    // Multi-source Dijkstra repair: with the unit edge weights used here,
+    // added edges can only shorten paths, so seed the relaxation at their
+    // endpoints and grow only through nodes whose distance improves:
+    constexpr size_t INF_DIST = numeric_limits<size_t>::max();
+    const auto distOf = [&cache](const TNodeID id)
+    {
+      const auto it = cache.dist.find(id);
+      return it == cache.dist.end() ? INF_DIST : it->second;
+    };
+
+    using heap_entry_t = pair<size_t, TNodeID>;  // (distance, node)
+    priority_queue<heap_entry_t, vector<heap_entry_t>, std::greater<>> heap;
+    std::set<TNodeID> changed_nodes;
+
+    const auto improve = [&](const TNodeID n, const TNodeID parent, const size_t new_dist)
+    {
+      cache.dist[n] = new_dist;
+      cache.prev_node[n] = parent;
+      // Keep the arc in the direction it is stored in the graph:
+      cache.prev_arc[n] = g->edges.count(std::make_pair(parent, n)) != 0
+          ? std::make_pair(parent, n)
+          : std::make_pair(n, parent);
+      changed_nodes.insert(n);
+      heap.emplace(new_dist, n);
+    };
+
+    for (const auto& ids : new_pairs)
+    {
+      if (ids.first == ids.second) continue;
+      const size_t d1 = distOf(ids.first), d2 = distOf(ids.second);
+      if (d1 != INF_DIST && d1 + 1 < d2)
+        improve(ids.second, ids.first, d1 + 1);
+      else if (d2 != INF_DIST && d2 + 1 < d1)
+        improve(ids.first, ids.second, d2 + 1);
+    }
+
+    while (!heap.empty())
+    {
+      const auto [d, u] = heap.top();
+      heap.pop();
+      if (d != cache.dist[u]) continue;  // stale heap entry
+      for (const TNodeID v : cache.neighbors[u])
+        if (d + 1 < distOf(v)) improve(v, u, d + 1);
+    }
+
+    if (changed_nodes.empty()) return;  // tree untouched: nothing else to do
+
+    // Re-estimate the global poses of the affected subtrees, parents before
+    // children. With unit weights the tree depth equals the distance, so a
+    // min-heap on it yields a valid top-down order:
+    std::map<TNodeID, vector<TNodeID>> children;
+    for (const auto& kv : cache.prev_node) children[kv.second].push_back(kv.first);
+
+    std::set<TNodeID> visited;
+    priority_queue<heap_entry_t, vector<heap_entry_t>, std::greater<>> pending;
+    for (const TNodeID n : changed_nodes) pending.emplace(cache.dist.at(n), n);
+
+    while (!pending.empty())
+    {
+      const auto [d, n] = pending.top();
+      pending.pop();
+      if (!visited.insert(n).second) continue;
+
+      // Compute the pose of "n" as parent_pose (+) edge_delta_pose, taking
+      // into account that the edge may be stored in reverse order and that
+      // then we have to invert the delta pose:
+      const TNodeID parent = cache.prev_node.at(n);
+      const TPairNodeIDs& arc = cache.prev_arc.at(n);
+      const auto itEdge = g->edges.find(arc);
+      ASSERTMSG_(itEdge != g->edges.end(), "Arc in the spanning tree is not in the graph!");
+      const bool reverse = (arc.first == n);
+      if ((!reverse && !g->edges_store_inverse_poses) || (reverse && g->edges_store_inverse_poses))
+        g->nodes[n].composeFrom(g->nodes[parent], itEdge->second.getPoseMean());
+      else
+        g->nodes[n].composeFrom(g->nodes[parent], -itEdge->second.getPoseMean());
+
+      if (const auto itCh = children.find(n); itCh != children.end())
+        for (const TNodeID c : itCh->second) pending.emplace(cache.dist.at(c), c);
+    }
+
+    MRPT_END
+  }  // end of graph_of_poses_dijkstra_update
+
   // Auxiliary funcs:
   template <class VEC>
   static inline double auxMaha2Dist(VEC& err, const CPosePDFGaussianInf& p)
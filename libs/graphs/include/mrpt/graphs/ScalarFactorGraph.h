@@ -12,7 +12,9 @@
 #include <mrpt/system/COutputLogger.h>
 #include <mrpt/system/CTimeLogger.h>
 
+#include <cstdint>
 #include <deque>
+#include <memory>
 
 namespace mrpt::graphs
 {
@@ -28,7 +30,8 @@ namespace mrpt::graphs
  *   - Linear error functions (for now).
  *   - Scalar (1-dim) error functions.
  *   - Gaussian factors.
- *   - Solver: Eigen SparseQR.
+ *   - Solver: Eigen SparseQR (default), or a warm-started iterative
+ *     Least-Squares Conjugate Gradient (see setSolverAlgorithm()).
  *
  *  Usage:
  *   - Call initialize() to set the number of nodes.
@@ -42,6 +45,7 @@ class ScalarFactorGraph : public mrpt::system::COutputLogger
 {
  public:
   ScalarFactorGraph();
+  ~ScalarFactorGraph() override;
 
   struct FactorBase
   {
@@ -89,8 +93,16 @@ class ScalarFactorGraph : public mrpt::system::COutputLogger
   /** Removes a constraint. Return true if found and deleted correctly. */
   bool eraseConstraint(const FactorBase& c);
 
-  void clearAllConstraintsByType_Unary() { m_factors_unary.clear(); }
-  void clearAllConstraintsByType_Binary() { m_factors_binary.clear(); }
+  void clearAllConstraintsByType_Unary()
+  {
+    m_factors_unary.clear();
+    m_structure_dirty = true;
+  }
+  void clearAllConstraintsByType_Binary()
+  {
+    m_factors_binary.clear();
+    m_structure_dirty = true;
+  }
   void updateEstimation(
       /** Output increment of the current estimate. Caller must add this
        vector to current state vector to obtain the optimal estimation. */
@@ -101,6 +113,37 @@ class ScalarFactorGraph : public mrpt::system::COutputLogger
   bool isProfilerEnabled() const { return m_enable_profiler; }
   void enableProfiler(bool enable = true) { m_enable_profiler = enable; }
 
+  /** Linear solver back-end for updateEstimation()
+   * \note [New in MRPT 2.14.5] */
+  enum TSolverAlgorithm : uint8_t
+  {
+    /** Direct sparse QR factorization. Exact, and the only back-end
+     * capable of recovering variances. The symbolic analysis of the QR
+     * pattern is cached and reused while the graph structure (nodes and
+     * constraints) remains unchanged. */
+    saSparseQR = 0,
+    /** Iterative Least-Squares Conjugate Gradient (diagonal
+     * preconditioner), warm-started with the solution of the former call.
+     * Much faster than saSparseQR for large problems solved repeatedly
+     * (e.g. gas-distribution mapping at a fixed rate), at the cost of an
+     * approximate solution. Automatically falls back to saSparseQR
+     * whenever variances are requested. */
+    saLSCG
+  };
+
+  /** Selects the solver used by updateEstimation() (Default: saSparseQR)
+   * \note [New in MRPT 2.14.5] */
+  void setSolverAlgorithm(TSolverAlgorithm a) { m_solver_algorithm = a; }
+  TSolverAlgorithm getSolverAlgorithm() const { return m_solver_algorithm; }
+
+  /** Parameters for the saLSCG solver. A value of `0` keeps the Eigen
+   * default for that parameter. \note [New in MRPT 2.14.5] */
+  void setIterativeSolverParams(size_t maxIters, double tolerance = .0)
+  {
+    m_lscg_max_iters = maxIters;
+    m_lscg_tolerance = tolerance;
+  }
+
  private:
   /** number of nodes in the graph */
   size_t m_numNodes = 0;
@@ -111,6 +154,18 @@ class ScalarFactorGraph : public mrpt::system::COutputLogger
   mrpt::system::CTimeLogger m_timelogger;
   bool m_enable_profiler{false};
 
+  TSolverAlgorithm m_solver_algorithm{saSparseQR};
+  size_t m_lscg_max_iters{0};
+  double m_lscg_tolerance{0};
+
+  /** Set by any method changing the graph structure; tells
+   * updateEstimation() that cached symbolic analyses are stale. */
+  bool m_structure_dirty{true};
+
+  /** Cached solver objects and warm-start state (opaque: see the .cpp) */
+  struct SolverState;
+  std::unique_ptr<SolverState> m_solver_state;
+
 };  // End of class def.
 
 }  // namespace mrpt::graphs
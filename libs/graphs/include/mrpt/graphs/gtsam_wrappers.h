@@ -0,0 +1,92 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+#pragma once
+
+#include <gtsam/geometry/Pose2.h>
+#include <gtsam/geometry/Pose3.h>
+#include <gtsam/linear/NoiseModel.h>
+#include <gtsam/nonlinear/NonlinearFactorGraph.h>
+#include <gtsam/nonlinear/Values.h>
+#include <gtsam/slam/BetweenFactor.h>
+#include <mrpt/graphs/CNetworkOfPoses.h>
+#include <mrpt/poses/gtsam_wrappers.h>
+
+namespace mrpt::gtsam_wrappers
+{
+/** @name mrpt_gtsam_wrappers GTSAM <-> MRPT conversion functions
+ *  \note [New in MRPT 2.14.5]
+ *  \sa <mrpt/poses/gtsam_wrappers.h>, <mrpt/math/gtsam_wrappers.h>
+ * @{ */
+
+static gtsam::Pose2 toPose2(const mrpt::poses::CPose2D& p)
+{
+  return gtsam::Pose2(p.x(), p.y(), p.phi());
+}
+
+/** Builds a gtsam::NonlinearFactorGraph + initial gtsam::Values from a whole
+ * 2D pose graph in one pass: one BetweenFactor<Pose2> per edge (with a
+ * Gaussian noise model taken from the edge information matrix, whose
+ * (x,y,phi) ordering matches gtsam::Pose2 and is viewed without copies) and
+ * one initial value per node. Factor storage is reserved up-front, and
+ * factors are constructed in place with emplace_shared().
+ *
+ *  Node IDs are used directly as gtsam::Key; anchoring (e.g. a prior on the
+ * root node) is left to the caller.
+ * \note [New in MRPT 2.14.5] */
+static void to_gtsam_factor_graph(
+    const mrpt::graphs::CNetworkOfPoses2DInf& g, gtsam::NonlinearFactorGraph& fg,
+    gtsam::Values& values)
+{
+  fg.reserve(fg.size() + g.edges.size());
+  for (const auto& n : g.nodes) values.insert(n.first, toPose2(n.second));
+
+  for (const auto& e : g.edges)
+  {
+    const auto& c = e.second;
+    auto noise = gtsam::noiseModel::Gaussian::Information(view_sym_as_gtsam(c.cov_inv));
+    fg.emplace_shared<gtsam::BetweenFactor<gtsam::Pose2>>(
+        e.first.first, e.first.second, toPose2(c.mean), noise);
+  }
+}
+
+/** \overload for 3D pose graphs (BetweenFactor<Pose3> per edge).
+ *
+ *  Edge information matrices are expressed by MRPT in
+ * (x,y,z,yaw,pitch,roll) coordinates; they are mapped onto gtsam's
+ * (rx,ry,rz,x,y,z) rodrigues parameterization through the inverse of the
+ * per-edge YPR->so(3) Jacobian (I' = J^-T I J^-1) before building the noise
+ * models.
+ * \note [New in MRPT 2.14.5] */
+static void to_gtsam_factor_graph(
+    const mrpt::graphs::CNetworkOfPoses3DInf& g, gtsam::NonlinearFactorGraph& fg,
+    gtsam::Values& values)
+{
+  fg.reserve(fg.size() + g.edges.size());
+  for (const auto& n : g.nodes) values.insert(n.first, toPose3(n.second));
+
+  for (const auto& e : g.edges)
+  {
+    const auto& c = e.second;
+
+    const mrpt::math::CMatrixDouble66 J = c.mean.jacobian_pose_rodrigues_from_YPR();
+    const Eigen::Matrix<double, 6, 6> Jinv = J.asEigen().inverse();
+    const mrpt::math::CMatrixDouble66 info_rod(Jinv.transpose() * c.cov_inv.asEigen() * Jinv);
+
+    gtsam::Matrix6 info_gtsam;
+    to_gtsam_se3_cov6_reordering(info_rod, info_gtsam);
+
+    auto noise = gtsam::noiseModel::Gaussian::Information(info_gtsam);
+    fg.emplace_shared<gtsam::BetweenFactor<gtsam::Pose3>>(
+        e.first.first, e.first.second, toPose3(c.mean), noise);
+  }
+}
+
+/** @} */
+
+}  // namespace mrpt::gtsam_wrappers
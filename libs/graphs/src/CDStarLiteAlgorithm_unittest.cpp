@@ -0,0 +1,131 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/graphs/CDStarLiteAlgorithm.h>
+
+#include <set>
+
+using namespace mrpt::graphs;
+
+namespace
+{
+/** A 4-connected grid world with blockable cells, for testing. */
+class GridPlanner : public CDStarLiteAlgorithm<uint64_t>
+{
+ public:
+  GridPlanner(int W, int H) : m_W(W), m_H(H) {}
+
+  uint64_t cellId(int x, int y) const { return uint64_t(y) * m_W + x; }
+  void block(int x, int y) { m_blocked.insert(cellId(x, y)); }
+  void unblock(int x, int y) { m_blocked.erase(cellId(x, y)); }
+
+  void getNeighbors(
+      const uint64_t& id, std::vector<std::pair<uint64_t, double>>& outNeighbors) override
+  {
+    outNeighbors.clear();
+    const int x = id % m_W, y = id / m_W;
+    const int dx[4] = {1, -1, 0, 0}, dy[4] = {0, 0, 1, -1};
+    for (int k = 0; k < 4; k++)
+    {
+      const int nx = x + dx[k], ny = y + dy[k];
+      if (nx < 0 || ny < 0 || nx >= m_W || ny >= m_H) continue;
+      const uint64_t n = cellId(nx, ny);
+      const bool blocked = m_blocked.count(n) != 0 || m_blocked.count(id) != 0;
+      outNeighbors.emplace_back(n, blocked ? std::numeric_limits<double>::infinity() : 1.0);
+    }
+  }
+
+  double heuristic(const uint64_t& from, const uint64_t& to) override
+  {
+    const int x1 = from % m_W, y1 = from / m_W;
+    const int x2 = to % m_W, y2 = to / m_W;
+    return std::abs(x1 - x2) + std::abs(y1 - y2);  // Manhattan
+  }
+
+ private:
+  int m_W, m_H;
+  std::set<uint64_t> m_blocked;
+};
+}  // namespace
+
+TEST(CDStarLiteAlgorithm, shortestPathOnEmptyGrid)
+{
+  GridPlanner p(10, 10);
+  p.init(p.cellId(0, 0), p.cellId(9, 9));
+  EXPECT_TRUE(p.computeShortestPath());
+  EXPECT_DOUBLE_EQ(p.pathCost(), 18.0);
+
+  std::vector<uint64_t> path;
+  EXPECT_TRUE(p.getPath(path));
+  EXPECT_EQ(path.size(), 19U);
+  EXPECT_EQ(path.front(), p.cellId(0, 0));
+  EXPECT_EQ(path.back(), p.cellId(9, 9));
+}
+
+TEST(CDStarLiteAlgorithm, incrementalRepairAfterBlocking)
+{
+  GridPlanner p(20, 20);
+  p.init(p.cellId(0, 10), p.cellId(19, 10));
+  EXPECT_TRUE(p.computeShortestPath());
+  EXPECT_DOUBLE_EQ(p.pathCost(), 19.0);
+
+  // Build a wall with one gap, and notify only the changed cells:
+  for (int y = 0; y < 20; y++)
+  {
+    if (y == 0) continue;  // the gap
+    p.block(10, y);
+    p.notifyNodeChanged(p.cellId(10, y));
+  }
+
+  EXPECT_TRUE(p.computeShortestPath());
+  // Detour through the gap at (10,0): 10 down + 10 up + 19 across = 39
+  EXPECT_DOUBLE_EQ(p.pathCost(), 39.0);
+
+  std::vector<uint64_t> path;
+  EXPECT_TRUE(p.getPath(path));
+  EXPECT_EQ(path.front(), p.cellId(0, 10));
+  EXPECT_EQ(path.back(), p.cellId(19, 10));
+
+  // Reopening the wall must restore the straight path:
+  for (int y = 1; y < 20; y++)
+  {
+    p.unblock(10, y);
+    p.notifyNodeChanged(p.cellId(10, y));
+  }
+  EXPECT_TRUE(p.computeShortestPath());
+  EXPECT_DOUBLE_EQ(p.pathCost(), 19.0);
+}
+
+TEST(CDStarLiteAlgorithm, noPathWhenWalledOff)
+{
+  GridPlanner p(5, 5);
+  for (int y = 0; y < 5; y++) p.block(2, y);
+  p.init(p.cellId(0, 2), p.cellId(4, 2));
+  EXPECT_FALSE(p.computeShortestPath());
+
+  std::vector<uint64_t> path;
+  EXPECT_FALSE(p.getPath(path));
+}
+
+TEST(CDStarLiteAlgorithm, movingStartKeepsTree)
+{
+  GridPlanner p(10, 10);
+  p.init(p.cellId(0, 0), p.cellId(9, 0));
+  EXPECT_TRUE(p.computeShortestPath());
+
+  std::vector<uint64_t> path;
+  EXPECT_TRUE(p.getPath(path));
+  ASSERT_GE(path.size(), 2U);
+
+  // Advance the robot along the path and replan from there:
+  p.setNewStart(path[1]);
+  EXPECT_TRUE(p.computeShortestPath());
+  EXPECT_DOUBLE_EQ(p.pathCost(), 8.0);
+}
@@ -9,12 +9,19 @@
 
 #include "graphs-precomp.h"  // Precompiled headers
 //
+#include <mrpt/core/WorkerThreadsPool.h>
 #include <mrpt/graphs/CGraphPartitioner.h>
 #include <mrpt/math/CMatrixD.h>
 #include <mrpt/math/CMatrixF.h>
 #include <mrpt/math/ops_matrices.h>  // laplacian()
 
+#include <Eigen/Dense>
+#include <cmath>
+#include <future>
 #include <iostream>  // cout
+#include <limits>
+#include <memory>
+#include <thread>
 
 using namespace mrpt;
 using namespace mrpt::graphs;
@@ -29,7 +36,8 @@ void CGraphPartitioner<GRAPH_MATRIX, num_t>::SpectralBisection(
     std::vector<uint32_t>& out_part1,
     std::vector<uint32_t>& out_part2,
     num_t& out_cut_value,
-    bool forceSimetry)
+    bool forceSimetry,
+    std::vector<typename GRAPH_MATRIX::Scalar>* inout_fiedler)
 {
   size_t nodeCount;  // Nodes count
   GRAPH_MATRIX Adj, eigenVectors;
@@ -53,29 +61,41 @@ void CGraphPartitioner<GRAPH_MATRIX, num_t>::SpectralBisection(
   else
     Adj = in_A;
 
-  // Compute eigen-vectors of laplacian:
+  // Compute the Fiedler vector (eigenvector of the 2nd smallest eigenvalue)
+  // of the laplacian:
   GRAPH_MATRIX LAPLACIAN;
   mrpt::math::laplacian(Adj, LAPLACIAN);
 
-  LAPLACIAN.eig(eigenVectors, eigenValues);
+  std::vector<typename GRAPH_MATRIX::Scalar> fiedler;
+  if (nodeCount > ITERATIVE_FIEDLER_THRESHOLD)
+  {
+    // Large graphs: iterative solver, O(N^2) per iteration instead of the
+    // O(N^3) full eigendecomposition, optionally warm-started from a
+    // previous partitioning of a similar graph:
+    if (inout_fiedler) fiedler = std::move(*inout_fiedler);
+    approxFiedlerVector(LAPLACIAN, fiedler);
+  }
+  else
+  {
+    // Small graphs: exact, dense eigendecomposition:
+    LAPLACIAN.eig(eigenVectors, eigenValues);
+    fiedler.resize(nodeCount);
+    for (size_t i = 0; i < nodeCount; i++) fiedler[i] = eigenVectors(i, 1);  // second smallest
+  }
+  if (inout_fiedler) *inout_fiedler = fiedler;
 
-  //  Execute the bisection
+  //  Execute the bisection: threshold the Fiedler vector at its mean
   // ------------------------------------
-  // Second smallest eigen-vector
   double mean = 0;
-  size_t colNo = 1;  // second smallest
-  size_t nRows = eigenVectors.rows();
-
-  // for (i=0;i<eigenVectors.cols();i++) mean+=eigenVectors(colNo,i);
-  for (size_t i = 0; i < nRows; i++) mean += eigenVectors(i, colNo);
-  mean /= nRows;
+  for (size_t i = 0; i < nodeCount; i++) mean += fiedler[i];
+  mean /= nodeCount;
 
   out_part1.clear();
   out_part2.clear();
 
-  for (size_t i = 0; i < nRows; i++)
+  for (size_t i = 0; i < nodeCount; i++)
   {
-    if (eigenVectors(i, colNo) >= mean)
+    if (fiedler[i] >= mean)
       out_part1.push_back(i);
     else
       out_part2.push_back(i);
@@ -100,6 +120,99 @@ void CGraphPartitioner<GRAPH_MATRIX, num_t>::SpectralBisection(
   out_cut_value = nCut(Adj, out_part1, out_part2);
 }
 
+/*---------------------------------------------------------------
+approxFiedlerVector
+---------------------------------------------------------------*/
+template <class GRAPH_MATRIX, typename num_t>
+void CGraphPartitioner<GRAPH_MATRIX, num_t>::approxFiedlerVector(
+    const GRAPH_MATRIX& in_lap, std::vector<typename GRAPH_MATRIX::Scalar>& inout_fiedler)
+{
+  using Scalar = typename GRAPH_MATRIX::Scalar;
+  using vector_t = Eigen::Matrix<Scalar, Eigen::Dynamic, 1>;
+
+  const size_t N = in_lap.rows();
+  const auto L = in_lap.asEigen();
+
+  // Power iteration on M = shift*I - L, with "shift" an upper bound of the
+  // laplacian spectrum (Gershgorin: all eigenvalues <= 2*max diagonal), so M
+  // is PSD with the eigenvalue order of L reversed. The constant vector is
+  // the *exact* null vector of L = D - W, hence deflating it each iteration
+  // leaves the Fiedler vector as the dominant eigenvector of M.
+  Scalar shift = 0;
+  for (size_t i = 0; i < N; i++) shift = std::max(shift, Scalar(2) * in_lap(i, i));
+  if (!(shift > 0)) shift = 1;  // edge-less graph: any deflated vector works
+
+  // Deflate the constant component and normalize. Returns false if the
+  // vector was (numerically) constant:
+  const auto deflateAndNormalize = [N](vector_t& v)
+  {
+    v.array() -= v.mean();
+    const Scalar norm = v.norm();
+    if (norm < N * std::numeric_limits<Scalar>::epsilon()) return false;
+    v /= norm;
+    return true;
+  };
+
+  // Initial guess: warm start if provided (newly-added nodes beyond its size
+  // start at zero), else a fixed non-constant seed, so that results are
+  // deterministic:
+  vector_t x = vector_t::Zero(N);
+  const size_t nWarm = std::min(N, inout_fiedler.size());
+  for (size_t i = 0; i < nWarm; i++) x[i] = inout_fiedler[i];
+  if (!deflateAndNormalize(x))
+  {
+    for (size_t i = 0; i < N; i++) x[i] = std::cos(Scalar(i));
+    deflateAndNormalize(x);
+  }
+
+  // Threaded row-block mat-vec products for really large graphs:
+  std::unique_ptr<mrpt::WorkerThreadsPool> pool;
+  const size_t nThreads =
+      std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), N / 1024);
+  if (nThreads > 1)
+    pool = std::make_unique<mrpt::WorkerThreadsPool>(
+        nThreads, mrpt::WorkerThreadsPool::POLICY_FIFO, "graph_fiedler");
+
+  vector_t y(N);
+  const auto matProd = [&](const vector_t& in, vector_t& out)
+  {
+    if (!pool)
+    {
+      out.noalias() = shift * in - L * in;
+      return;
+    }
+    const size_t chunk = (N + nThreads - 1) / nThreads;
+    std::vector<std::future<void>> futs;
+    futs.reserve(nThreads);
+    for (size_t t = 0; t < nThreads; t++)
+    {
+      const size_t r0 = t * chunk, r1 = std::min(N, r0 + chunk);
+      if (r0 >= r1) break;
+      futs.emplace_back(pool->enqueue(
+          [&, r0, r1]() {
+            out.segment(r0, r1 - r0).noalias() =
+                shift * in.segment(r0, r1 - r0) - L.middleRows(r0, r1 - r0) * in;
+          }));
+    }
+    for (auto& f : futs) f.get();
+  };
+
+  // M is PSD, so the iteration converges without sign flips and a plain
+  // distance between successive (unit norm) iterates works as stop criterion:
+  constexpr size_t MAX_ITERS = 2000;
+  const Scalar tol = Scalar(1e-6);
+  for (size_t iter = 0; iter < MAX_ITERS; iter++)
+  {
+    matProd(x, y);
+    if (!deflateAndNormalize(y)) break;  // fell into the null space: keep x
+    const Scalar delta = (y - x).norm();
+    x.swap(y);
+    if (delta < tol) break;
+  }
+
+  inout_fiedler.assign(x.data(), x.data() + N);
+}
+
 /*---------------------------------------------------------------
 RecursiveSpectralPartition
 ---------------------------------------------------------------*/
@@ -112,7 +225,8 @@ void CGraphPartitioner<GRAPH_MATRIX, num_t>::RecursiveSpectralPartition(
     bool useSpectralBisection,
     bool recursive,
     unsigned minSizeClusters,
-    const bool verbose)
+    const bool verbose,
+    std::vector<typename GRAPH_MATRIX::Scalar>* inout_fiedler)
 {
   MRPT_START
 
@@ -146,9 +260,11 @@ void CGraphPartitioner<GRAPH_MATRIX, num_t>::RecursiveSpectralPartition(
   else
     Adj = in_A;
 
-  // Make bisection
+  // Make bisection. Only the top-level split gets the warm-started Fiedler
+  // vector: the recursive calls below work on remapped submatrices, for
+  // which cached entries would be meaningless.
   if (useSpectralBisection)
-    SpectralBisection(Adj, p1, p2, cut_value, false);
+    SpectralBisection(Adj, p1, p2, cut_value, false, inout_fiedler);
   else
     exactBisection(Adj, p1, p2, cut_value, false);
 
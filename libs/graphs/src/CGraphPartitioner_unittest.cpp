@@ -0,0 +1,101 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/graphs/CGraphPartitioner.h>
+#include <mrpt/math/CMatrixDynamic.h>
+
+#include <algorithm>
+
+using namespace mrpt::graphs;
+using mrpt::math::CMatrixDouble;
+
+// Adjacency matrix with two planted communities of "blockSize" nodes each:
+// strong intra-community weights, weak inter-community ones, so the optimal
+// bisection is unambiguous.
+static CMatrixDouble two_blocks_adjacency(const size_t blockSize)
+{
+  const size_t N = 2 * blockSize;
+  CMatrixDouble A(N, N);
+  for (size_t i = 0; i < N; i++)
+    for (size_t j = 0; j < N; j++)
+    {
+      const bool sameBlock = (i < blockSize) == (j < blockSize);
+      A(i, j) = sameBlock ? 1.0 : 0.01;
+    }
+  return A;
+}
+
+static void expect_blocks_recovered(
+    std::vector<uint32_t> part1, std::vector<uint32_t> part2, const size_t blockSize)
+{
+  ASSERT_EQ(part1.size(), blockSize);
+  ASSERT_EQ(part2.size(), blockSize);
+  std::sort(part1.begin(), part1.end());
+  std::sort(part2.begin(), part2.end());
+  if (part1.front() != 0) part1.swap(part2);
+  for (size_t i = 0; i < blockSize; i++)
+  {
+    EXPECT_EQ(part1[i], i);
+    EXPECT_EQ(part2[i], blockSize + i);
+  }
+}
+
+TEST(CGraphPartitioner, SpectralBisectionSmallGraph)
+{
+  // Below ITERATIVE_FIEDLER_THRESHOLD: exercises the dense (exact) path.
+  const size_t blockSize = 30;
+  auto A = two_blocks_adjacency(blockSize);
+
+  std::vector<uint32_t> p1, p2;
+  double cut_value;
+  CGraphPartitioner<CMatrixDouble>::SpectralBisection(A, p1, p2, cut_value, false);
+
+  expect_blocks_recovered(p1, p2, blockSize);
+  EXPECT_LT(cut_value, 0.1);
+}
+
+TEST(CGraphPartitioner, SpectralBisectionLargeGraphIterative)
+{
+  // Above ITERATIVE_FIEDLER_THRESHOLD: exercises the iterative Fiedler
+  // solver, with and without a warm start.
+  const size_t blockSize = 300;
+  static_assert(2 * blockSize > CGraphPartitioner<CMatrixDouble>::ITERATIVE_FIEDLER_THRESHOLD);
+  auto A = two_blocks_adjacency(blockSize);
+
+  std::vector<uint32_t> p1, p2;
+  double cut_value;
+  std::vector<double> fiedler;
+  CGraphPartitioner<CMatrixDouble>::SpectralBisection(A, p1, p2, cut_value, false, &fiedler);
+
+  expect_blocks_recovered(p1, p2, blockSize);
+  EXPECT_LT(cut_value, 0.1);
+  ASSERT_EQ(fiedler.size(), 2 * blockSize);
+
+  // Warm-started re-run (as CIncrementalMapPartitioner does on a growing
+  // map) must reproduce the same partition:
+  std::vector<uint32_t> q1, q2;
+  CGraphPartitioner<CMatrixDouble>::SpectralBisection(A, q1, q2, cut_value, false, &fiedler);
+  EXPECT_EQ(p1, q1);
+  EXPECT_EQ(p2, q2);
+}
+
+TEST(CGraphPartitioner, RecursiveSpectralPartitionLargeGraph)
+{
+  const size_t blockSize = 300;
+  auto A = two_blocks_adjacency(blockSize);
+
+  std::vector<std::vector<uint32_t>> parts;
+  std::vector<double> fiedler;
+  CGraphPartitioner<CMatrixDouble>::RecursiveSpectralPartition(
+      A, parts, 0.8 /*threshold_Ncut*/, false, true, true, 1, false, &fiedler);
+
+  ASSERT_EQ(parts.size(), 2U);
+  expect_blocks_recovered(parts[0], parts[1], blockSize);
+}
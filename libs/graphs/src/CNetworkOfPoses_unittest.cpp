@@ -0,0 +1,154 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/graphs/CNetworkOfPoses.h>
+#include <mrpt/system/filesystem.h>
+
+#include <cmath>
+#include <type_traits>
+
+using namespace mrpt::graphs;
+using mrpt::poses::CPose2D;
+
+// Ground-truth poses on a circle. Since all edges are built as exact relative
+// poses, *any* spanning tree must reproduce them exactly, which makes the
+// checks below independent of tie-breaking in the Dijkstra solvers.
+static CPose2D gt_pose(const TNodeID id)
+{
+  const double ang = 2 * M_PI * id / 40.0;
+  return {20 * std::cos(ang), 20 * std::sin(ang), ang};
+}
+
+static void add_gt_edge(CNetworkOfPoses2D& g, const TNodeID from, const TNodeID to)
+{
+  g.insertEdge(from, to, gt_pose(to) - gt_pose(from));
+}
+
+static void expect_nodes_at_gt(const CNetworkOfPoses2D& g)
+{
+  for (const auto& n : g.nodes)
+    EXPECT_NEAR(0, (n.second.asVectorVal() - gt_pose(n.first).asVectorVal()).sum_abs(), 1e-9)
+        << "node #" << n.first;
+}
+
+TEST(CNetworkOfPoses, DijkstraIncrementalEstimate)
+{
+  CNetworkOfPoses2D g;
+  g.root = 0;
+
+  // Initial chain 0 -> 9:
+  for (TNodeID i = 0; i < 10; i++)
+  {
+    g.nodes[i] = CPose2D();
+    if (i > 0) add_gt_edge(g, i - 1, i);
+  }
+
+  // First call falls back to a full solve:
+  g.dijkstra_nodes_estimate_incremental();
+  EXPECT_TRUE(g.dijkstra_tree_cache.valid);
+  expect_nodes_at_gt(g);
+
+  // Grow the graph: more chain nodes plus a few loop closures (including one
+  // stored "backwards", 25->5):
+  for (TNodeID i = 10; i < 40; i++)
+  {
+    g.nodes[i] = CPose2D();
+    add_gt_edge(g, i - 1, i);
+  }
+  add_gt_edge(g, 0, 15);
+  add_gt_edge(g, 25, 5);
+
+  g.dijkstra_nodes_estimate_incremental();
+  expect_nodes_at_gt(g);
+
+  // The repaired tree must match a from-scratch solve, e.g. node 15 is now
+  // one hop away from the root thanks to the new 0->15 edge:
+  EXPECT_EQ(g.dijkstra_tree_cache.dist.at(15), 1U);
+  {
+    CNetworkOfPoses2D g2 = g;
+    std::map<TNodeID, size_t> topo_dists;
+    g2.dijkstra_nodes_estimate(topo_dists);
+    for (const auto& d : topo_dists) EXPECT_EQ(g.dijkstra_tree_cache.dist.at(d.first), d.second);
+  }
+
+  // A no-op call (no graph changes) must not alter anything:
+  g.dijkstra_nodes_estimate_incremental();
+  expect_nodes_at_gt(g);
+
+  // Removing an edge invalidates the cache and triggers a full rebuild:
+  g.edges.erase(g.edges.find({0, 15}));
+  g.dijkstra_nodes_estimate_incremental();
+  expect_nodes_at_gt(g);
+  EXPECT_EQ(g.dijkstra_tree_cache.dist.at(15), 15U);
+}
+
+template <class GRAPH_T>
+static GRAPH_T build_test_graph()
+{
+  GRAPH_T g;
+  g.root = 0;
+  for (TNodeID i = 0; i < 10; i++)
+  {
+    typename GRAPH_T::constraint_no_pdf_t& n = g.nodes[i];
+    n = typename GRAPH_T::constraint_no_pdf_t(
+        mrpt::poses::CPose3D(0.1 * i, -0.2 * i, 0.05 * i, 0.01 * i, -0.02 * i, 0.03 * i));
+    if (i == 0) continue;
+    typename GRAPH_T::constraint_t e;
+    e.mean = g.nodes[i] - g.nodes[i - 1];
+    for (int k = 0; k < e.cov_inv.rows(); k++) e.cov_inv(k, k) = 1.0 + 0.1 * i + k;
+    g.insertEdge(i - 1, i, e);
+  }
+  return g;
+}
+
+template <class GRAPH_T>
+static void run_binary_roundtrip_test(const std::string& fileName)
+{
+  const GRAPH_T g = build_test_graph<GRAPH_T>();
+  g.saveToBinaryFile(fileName);
+
+  GRAPH_T g2;
+  g2.loadFromBinaryFile(fileName);
+
+  EXPECT_EQ(g2.root, g.root);
+  ASSERT_EQ(g2.nodes.size(), g.nodes.size());
+  for (const auto& n : g.nodes)
+    EXPECT_NEAR(
+        0, (g2.nodes.at(n.first).asVectorVal() - n.second.asVectorVal()).sum_abs(), 1e-12)
+        << "node #" << n.first;
+  ASSERT_EQ(g2.edges.size(), g.edges.size());
+  for (auto it = g.edges.begin(), it2 = g2.edges.begin(); it != g.edges.end(); ++it, ++it2)
+  {
+    EXPECT_EQ(it2->first, it->first);
+    EXPECT_NEAR(
+        0, (it2->second.mean.asVectorVal() - it->second.mean.asVectorVal()).sum_abs(), 1e-12);
+    EXPECT_NEAR(0, (it2->second.cov_inv - it->second.cov_inv).sum_abs(), 1e-12);
+  }
+
+  // A mismatching graph type must be rejected:
+  if (!std::is_same<GRAPH_T, CNetworkOfPoses2DInf>::value)
+  {
+    CNetworkOfPoses2DInf gBad;
+    EXPECT_ANY_THROW(gBad.loadFromBinaryFile(fileName));
+  }
+}
+
+TEST(CNetworkOfPoses, BinaryFileRoundTrip2DInf)
+{
+  run_binary_roundtrip_test<CNetworkOfPoses2DInf>(mrpt::system::getTempFileName());
+}
+TEST(CNetworkOfPoses, BinaryFileRoundTrip3DInf)
+{
+  run_binary_roundtrip_test<CNetworkOfPoses3DInf>(mrpt::system::getTempFileName());
+}
+TEST(CNetworkOfPoses, BinaryFileRoundTrip3DInfGz)
+{
+  run_binary_roundtrip_test<CNetworkOfPoses3DInf>(mrpt::system::getTempFileName() + ".gz");
+}
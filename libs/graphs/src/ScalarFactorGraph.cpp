@@ -19,12 +19,31 @@ using namespace mrpt::graphs;
 using namespace std;
 
 #if EIGEN_VERSION_AT_LEAST(3, 1, 0)  // Requires Eigen>=3.1
+#include <Eigen/IterativeLinearSolvers>
 #include <Eigen/SparseCore>
 #include <Eigen/SparseQR>
 #endif
 
+/** Cached solver objects, kept alive across updateEstimation() calls so that
+ * symbolic analyses and warm-start data can be reused. */
+struct ScalarFactorGraph::SolverState
+{
+#if EIGEN_VERSION_AT_LEAST(3, 1, 0)
+  Eigen::SparseQR<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>> qr;
+  /** true if `qr` holds a valid symbolic analysis of the current pattern */
+  bool qrPatternAnalyzed = false;
+  /** Warm-start guess for the saLSCG solver (last solved increment) */
+  Eigen::VectorXd lastX;
+#endif
+};
+
 ScalarFactorGraph::FactorBase::~FactorBase() = default;
-ScalarFactorGraph::ScalarFactorGraph() : COutputLogger("GMRF") {}
+ScalarFactorGraph::ScalarFactorGraph() :
+    COutputLogger("GMRF"), m_solver_state(std::make_unique<SolverState>())
+{
+}
+ScalarFactorGraph::~ScalarFactorGraph() = default;
+
 void ScalarFactorGraph::clear()
 {
   MRPT_LOG_DEBUG("clear() called");
@@ -32,6 +51,8 @@ void ScalarFactorGraph::clear()
   m_numNodes = 0;
   m_factors_unary.clear();
   m_factors_binary.clear();
+  m_structure_dirty = true;
+  m_solver_state = std::make_unique<SolverState>();
 }
 
 void ScalarFactorGraph::initialize(size_t nodeCount)
@@ -39,15 +60,18 @@ void ScalarFactorGraph::initialize(size_t nodeCount)
   MRPT_LOG_DEBUG_STREAM("initialize() called, nodeCount=" << nodeCount);
 
   m_numNodes = nodeCount;
+  m_structure_dirty = true;
 }
 
 void ScalarFactorGraph::addConstraint(const UnaryFactorVirtualBase& c)
 {
   m_factors_unary.push_back(&c);
+  m_structure_dirty = true;
 }
 void ScalarFactorGraph::addConstraint(const BinaryFactorVirtualBase& c)
 {
   m_factors_binary.push_back(&c);
+  m_structure_dirty = true;
 }
 
 bool ScalarFactorGraph::eraseConstraint(const FactorBase& c)
@@ -57,6 +81,7 @@ bool ScalarFactorGraph::eraseConstraint(const FactorBase& c)
     if (it != m_factors_unary.end())
     {
       m_factors_unary.erase(it);
+      m_structure_dirty = true;
       return true;
     }
   }
@@ -65,6 +90,7 @@ bool ScalarFactorGraph::eraseConstraint(const FactorBase& c)
     if (it != m_factors_binary.end())
     {
       m_factors_binary.erase(it);
+      m_structure_dirty = true;
       return true;
     }
   }
@@ -153,12 +179,51 @@ void ScalarFactorGraph::updateEstimation(
 
   // Solve increment
   // -----------------------
-  Eigen::SparseQR<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>> solver;
+  // The iterative solver cannot recover variances, so fall back to QR
+  // whenever they are requested:
+  const bool useIterative = (m_solver_algorithm == saLSCG) && solved_variances == nullptr;
+
+  if (useIterative)
   {
     mrpt::system::CTimeLoggerEntry tle(m_timelogger, "GMRF.solve");
 
-    solver.compute(A);
+    Eigen::LeastSquaresConjugateGradient<Eigen::SparseMatrix<double>> lscg;
+    if (m_lscg_max_iters > 0) lscg.setMaxIterations(static_cast<Eigen::Index>(m_lscg_max_iters));
+    if (m_lscg_tolerance > 0) lscg.setTolerance(m_lscg_tolerance);
+    lscg.compute(A);  // cheap: only builds the diagonal preconditioner
+
+    auto& x0 = m_solver_state->lastX;
+    if (x0.size() == static_cast<Eigen::Index>(n))
+    {
+      // Warm start: successive solves of a slowly-changing field converge
+      // in a handful of CG iterations.
+      solved_x_inc = lscg.solveWithGuess(g, x0);
+    }
+    else
+    {
+      solved_x_inc = lscg.solve(g);
+    }
+    x0 = solved_x_inc.asEigen();
+
+    MRPT_LOG_DEBUG_STREAM(
+        "LSCG converged in " << lscg.iterations() << " iterations, error=" << lscg.error());
+    return;
+  }
+
+  auto& solver = m_solver_state->qr;
+  {
+    mrpt::system::CTimeLoggerEntry tle(m_timelogger, "GMRF.solve");
+
+    // Re-run the symbolic analysis only if the sparsity pattern changed:
+    if (m_structure_dirty || !m_solver_state->qrPatternAnalyzed)
+    {
+      solver.analyzePattern(A);
+      m_solver_state->qrPatternAnalyzed = true;
+      m_structure_dirty = false;
+    }
+    solver.factorize(A);
     solved_x_inc = solver.solve(g);
+    m_solver_state->lastX = solved_x_inc.asEigen();
   }
 
   // Recover covariance
@@ -165,4 +165,54 @@ TEST(ScalarFactorGraph, MiniMRF_BinaryEdges)
   }
 }
 
+TEST(ScalarFactorGraph, IterativeSolverMatchesQR)
+{
+  const size_t N = 16;
+  vector<double> my_map(N, .0);
+
+  ScalarFactorGraph gmrf;
+  gmrf.enableProfiler(false);
+  gmrf.initialize(N);
+
+  // A chain MRF with a few scattered observations:
+  std::deque<MySimpleUnaryEdge> edgesObs;
+  edgesObs.emplace_back(my_map, 0, 1.0, 4.0);
+  edgesObs.emplace_back(my_map, 7, 3.0, 4.0);
+  edgesObs.emplace_back(my_map, 15, 2.0, 16.0);
+  for (const auto& e : edgesObs) gmrf.addConstraint(e);
+
+  std::deque<MySimpleBinaryEdge> edgesPrior;
+  for (size_t i = 0; i + 1 < N; i++) edgesPrior.emplace_back(my_map, i, i + 1, .5);
+  for (const auto& e : edgesPrior) gmrf.addConstraint(e);
+
+  // Reference: direct QR solution.
+  mrpt::math::CVectorDouble x_qr;
+  gmrf.updateEstimation(x_qr);
+
+  // Iterative solver must converge to the same solution:
+  gmrf.setSolverAlgorithm(ScalarFactorGraph::saLSCG);
+  gmrf.setIterativeSolverParams(0 /*Eigen default iters*/, 1e-10);
+
+  mrpt::math::CVectorDouble x_lscg;
+  gmrf.updateEstimation(x_lscg);
+
+  ASSERT_EQUAL_(size_t(x_qr.size()), size_t(x_lscg.size()));
+  for (size_t i = 0; i < N; i++) EXPECT_NEAR(x_qr[i], x_lscg[i], 1e-6) << "i=" << i;
+
+  // A second (warm-started) solve of the same problem must be idempotent:
+  mrpt::math::CVectorDouble x_lscg2;
+  gmrf.updateEstimation(x_lscg2);
+  for (size_t i = 0; i < N; i++) EXPECT_NEAR(x_qr[i], x_lscg2[i], 1e-6) << "i=" << i;
+
+  // Requesting variances must transparently fall back to the QR path:
+  mrpt::math::CVectorDouble x_fb, x_var;
+  gmrf.updateEstimation(x_fb, &x_var);
+  ASSERT_EQUAL_(size_t(x_var.size()), N);
+  for (size_t i = 0; i < N; i++)
+  {
+    EXPECT_NEAR(x_qr[i], x_fb[i], 1e-9) << "i=" << i;
+    EXPECT_GT(x_var[i], .0) << "i=" << i;
+  }
+}
+
 #endif  // Eigen>=3.1
@@ -19,10 +19,12 @@
 #include <mrpt/poses/CPose2D.h>
 #include <mrpt/poses/CPose3D.h>
 
+#include <atomic>
 #include <cmath>
 #include <iostream>
 #include <map>
 #include <string>
+#include <thread>
 
 namespace mrpt::graphslam::optimizers
 {
@@ -48,7 +50,9 @@ namespace mrpt::graphslam::optimizers
  *   + \a Default value :  FALSE
  *   + \a Required      : FALSE
  *   + \a Description   : Specify whether to use a second thread to optimize
- *   the graph.
+ *   the graph. The second thread works on a snapshot of the graph and only
+ *   locks the graph critical section to merge the corrected poses back, so
+ *   the frontend latency stays flat during large corrections.
  *
  * - \b LC_min_nodeid_diff
  *  + \a Section       : GeneralConfiguration
@@ -130,7 +134,7 @@ class CLevMarqGSO : public mrpt::graphslam::optimizers::CGraphSlamOptimizer<GRAP
   /**\}*/
 
   CLevMarqGSO();
-  ~CLevMarqGSO() override = default;
+  ~CLevMarqGSO() override;
 
   bool updateState(
       mrpt::obs::CActionCollection::Ptr action,
@@ -229,10 +233,13 @@ class CLevMarqGSO : public mrpt::graphslam::optimizers::CGraphSlamOptimizer<GRAP
    *
    */
   void _optimizeGraph(bool is_full_update = false);
-  /** \brief Wrapper around _optimizeGraph which first locks the section and
-   * then calls the _optimizeGraph method.
-   *
-   * Used in multithreaded optimization
+  /** \brief Entry point of the second-thread optimization: optimizes a
+   * snapshot of the graph without holding the graph critical section for
+   * the duration of the levmarq run, then merges the corrected poses back
+   * atomically. This keeps the frontend (node/edge registration) latency
+   * flat even during large loop-closure corrections.
+   * \note (Snapshot-based since MRPT 2.14.5; it formerly held the section
+   * for the whole optimization)
    * \sa _optimizeGraph()
    */
   void optimizeGraph() override;
@@ -328,6 +335,9 @@ class CLevMarqGSO : public mrpt::graphslam::optimizers::CGraphSlamOptimizer<GRAP
 
   // Use second thread for graph optimization
   std::thread m_thread_optimize;
+  /** True while a second-thread optimization is in flight; checked by
+   * updateState() so the frontend never blocks on a busy optimizer. */
+  std::atomic<bool> m_optimization_in_progress{false};
 
   /**\brief Enumeration that defines the behaviors towards using or ignoring a
    * newly added loop closure to fully optimize the graph
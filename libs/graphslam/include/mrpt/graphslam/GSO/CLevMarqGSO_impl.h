@@ -19,6 +19,13 @@ CLevMarqGSO<GRAPH_T>::CLevMarqGSO() : m_optimization_policy(OptimizationPolicy::
   this->initializeLoggers("CLevMarqGSO");
 }
 
+template <class GRAPH_T>
+CLevMarqGSO<GRAPH_T>::~CLevMarqGSO()
+{
+  // Wait for any in-flight second-thread optimization:
+  if (m_thread_optimize.joinable()) m_thread_optimize.join();
+}
+
 template <class GRAPH_T>
 bool CLevMarqGSO<GRAPH_T>::updateState(
     mrpt::obs::CActionCollection::Ptr action,
@@ -39,11 +46,18 @@ bool CLevMarqGSO<GRAPH_T>::updateState(
 
     if (opt_params.optimization_on_second_thread)
     {
-      // join the previous optimization thread
-      m_thread_optimize.join();
+      // do not stall the frontend if the previous optimization is still
+      // running; the nodes registered meanwhile are picked up by the next
+      // round
+      if (!m_optimization_in_progress)
+      {
+        // join the previous (already finished) optimization thread
+        if (m_thread_optimize.joinable()) m_thread_optimize.join();
 
-      // optimize the graph - run on a seperate thread
-      m_thread_optimize = std::thread(&CLevMarqGSO::optimizeGraph, this);
+        // optimize the graph - run on a seperate thread
+        m_optimization_in_progress = true;
+        m_thread_optimize = std::thread(&CLevMarqGSO::optimizeGraph, this);
+      }
     }
     else
     {  // single threaded implementation
@@ -362,12 +376,67 @@ void CLevMarqGSO<GRAPH_T>::optimizeGraph()
       "optimizeGraph:: ThreadID:" << endl
                                   << "\t" << std::this_thread::get_id() << endl
                                   << "\t"
-                                  << "Trying to grab lock... ");
+                                  << "Optimizing against a graph snapshot... ");
+
+  // Optimize against a snapshot of the graph so that the frontend keeps
+  // registering nodes/edges while the (possibly long) levmarq run is in
+  // progress: the graph section is held only while taking the snapshot and
+  // while merging the corrected poses back.
+  GRAPH_T graph_snapshot;
+  bool is_full_update = false;
+  std::set<mrpt::graphs::TNodeID>* nodes_to_optimize = nullptr;
+  {
+    std::lock_guard<std::mutex> graph_lock(*this->m_graph_section);
 
-  std::lock_guard<std::mutex> graph_lock(*this->m_graph_section);
-  this->_optimizeGraph();
+    // if less than X nodes exist overall, do not try optimizing
+    if (m_min_nodes_for_optimization > this->m_graph->nodes.size())
+    {
+      m_optimization_in_progress = false;
+      return;
+    }
+
+    is_full_update = this->checkForFullOptimization();
+    if (!is_full_update)
+    {
+      nodes_to_optimize = new std::set<mrpt::graphs::TNodeID>;
+      this->getNearbyNodesOf(
+          nodes_to_optimize, this->m_graph->nodeCount() - 1, opt_params.optimization_distance);
+      nodes_to_optimize->insert(this->m_graph->nodeCount() - 1);
+    }
+
+    graph_snapshot = *this->m_graph;
+  }
+
+  mrpt::system::CTicTac optimization_timer;
+  optimization_timer.Tic();
+
+  graphslam::TResultInfoSpaLevMarq levmarq_info;
+
+  // Execute the optimization - no locks held
+  mrpt::graphslam::optimize_graph_spa_levmarq(
+      graph_snapshot, levmarq_info, nodes_to_optimize, opt_params.cfg,
+      &CLevMarqGSO<GRAPH_T>::levMarqFeedback);  // functor feedback
+
+  double elapsed_time = optimization_timer.Tac();
+  this->logFmt(mrpt::system::LVL_DEBUG, "Optimization of graph took: %fs", elapsed_time);
+
+  delete nodes_to_optimize;
+  nodes_to_optimize = nullptr;
+
+  // Publish the corrected poses atomically wrt the graph section. Nodes
+  // registered by the frontend while the optimization was running keep
+  // their odometry-based estimates until the next round.
+  {
+    std::lock_guard<std::mutex> graph_lock(*this->m_graph_section);
+    for (const auto& id_pose : graph_snapshot.nodes)
+    {
+      auto it_live = this->m_graph->nodes.find(id_pose.first);
+      if (it_live != this->m_graph->nodes.end()) it_live->second = id_pose.second;
+    }
+    m_just_fully_optimized_graph = is_full_update;
+  }
 
-  this->logFmt(mrpt::system::LVL_DEBUG, "2nd thread grabbed the lock..");
+  m_optimization_in_progress = false;
 
   MRPT_END
 }
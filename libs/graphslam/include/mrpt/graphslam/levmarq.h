@@ -10,6 +10,7 @@
 
 #include <mrpt/containers/stl_containers_utils.h>  // find_in_vector()
 #include <mrpt/containers/yaml.h>
+#include <mrpt/core/WorkerThreadsPool.h>
 #include <mrpt/graphslam/types.h>
 #include <mrpt/math/CSparseMatrix.h>
 #include <mrpt/system/CTimeLogger.h>
@@ -61,6 +62,14 @@ namespace mrpt::graphslam
  *		- "e2": (default=1e-6) Lev-marq algorithm iteration stopping criterion
  *#2:
  *|delta_incr| < e2*(x_norm+e2)
+ *		- "num_threads": (default=1) Number of threads for the per-edge
+ *linearization and gradient/Hessian accumulation stages. 0 means one thread
+ *per hardware core. [New in MRPT 2.14.5]
+ *		- "relinearize_threshold": (default=0) If >0, after each accepted
+ *iteration only those edges whose error vector moved more than this value
+ *(Euclidean norm in the tangent space) since their last linearization have
+ *their Jacobians recomputed; the rest reuse the cached ones. [New in MRPT
+ *2.14.5]
  *
  * \note The following graph types are supported:
  *mrpt::graphs::CNetworkOfPoses2D, mrpt::graphs::CNetworkOfPoses3D,
@@ -109,6 +118,12 @@ void optimize_graph_spa_levmarq(
   const double tau = extra_params.getOrDefault<double>("tau", 1e-3);
   const double e1 = extra_params.getOrDefault<double>("e1", 1e-6);
   const double e2 = extra_params.getOrDefault<double>("e2", 1e-6);
+  // 0 means "auto" (one thread per hardware core):
+  size_t num_threads = extra_params.getOrDefault<size_t>("num_threads", 1);
+  if (num_threads == 0) num_threads = std::thread::hardware_concurrency();
+  // >0 enables incremental re-linearization (see doxygen docs above):
+  const double relinearize_threshold =
+      extra_params.getOrDefault<double>("relinearize_threshold", .0);
 
   mrpt::system::CTimeLogger profiler(enable_profiler);
   profiler.enter("optimize_graph_spa_levmarq (entire)");
@@ -195,6 +210,15 @@ void optimize_graph_spa_levmarq(
   using SparseCholeskyDecompPtr = std::unique_ptr<CSparseMatrix::CholeskyDecomp>;
   SparseCholeskyDecompPtr ptrCh;
 
+  // Worker threads for the per-edge stages (linearization, gradient and
+  // Hessian block accumulation), shared by all LM iterations. Small problems
+  // are not worth the synchronization overhead:
+  num_threads = std::max<size_t>(1, std::min(num_threads, 1 + nObservations / 256));
+  std::unique_ptr<mrpt::WorkerThreadsPool> threadPool;
+  if (num_threads > 1)
+    threadPool = std::make_unique<mrpt::WorkerThreadsPool>(
+        num_threads, mrpt::WorkerThreadsPool::POLICY_FIFO, "graphslam_levmarq");
+
   // The list of Jacobians: for each constraint i->j,
   //  we need the pair of Jacobians: { dh(xi,xj)_dxi, dh(xi,xj)_dxj },
   //  which are "first" and "second" in each pair.
@@ -210,10 +234,15 @@ void optimize_graph_spa_levmarq(
   // Compute Jacobians & errors
   // ===================================
   profiler.enter("optimize_graph_spa_levmarq.Jacobians&err");
-  double total_sqr_err =
-      computeJacobiansAndErrors<GRAPH_T>(graph, lstObservationData, lstJacobians, errs);
+  double total_sqr_err = computeJacobiansAndErrors<GRAPH_T>(
+      graph, lstObservationData, lstJacobians, errs, threadPool.get());
   profiler.leave("optimize_graph_spa_levmarq.Jacobians&err");
 
+  // For incremental re-linearization: the error vector of each edge at the
+  // point where its current Jacobians were evaluated:
+  std::vector<typename gst::Array_O> errs_at_last_lin;
+  if (relinearize_threshold > 0) errs_at_last_lin = errs;
+
   // Only once (since this will be static along iterations), build a quick
   // look-up table with the
   //  indices of the free nodes associated to the (first_id,second_id) of each
@@ -249,9 +278,17 @@ void optimize_graph_spa_levmarq(
   // -----------------------------------------------------------
   size_t last_iter = 0;
 
+  // The Hessian block columns. Kept outside of the loop, so iterations that
+  // only retry with a larger lambda reuse the blocks from the current
+  // linearization point instead of rebuilding them:
+  vector<map_ID2matrix_TxT_t> H_map(nFreeNodes);
+  // Random-access view of lstJacobians, so the accumulation stages below can
+  // be split by observation index among the worker threads:
+  vector<const typename gst::TPairJacobs*> jacByIdx;
+  jacByIdx.reserve(nObservations);
+
   for (size_t iter = 0; iter < max_iters; ++iter)
   {
-    vector<map_ID2matrix_TxT_t> H_map(nFreeNodes);
     last_iter = iter;
 
     // This will be false only when the delta leads to a worst solution and
@@ -274,19 +311,24 @@ void optimize_graph_spa_levmarq(
       // "lstJacobians" is sorted in the same order than
       // "lstObservationData":
       ASSERTDEB_EQUAL_(lstJacobians.size(), lstObservationData.size());
+      jacByIdx.clear();
       {
-        size_t idx_obs;
-        typename gst::map_pairIDs_pairJacobs_t::const_iterator itJ;
-
-        for (idx_obs = 0, itJ = lstJacobians.begin(); itJ != lstJacobians.end(); ++itJ, ++idx_obs)
+        size_t idx_obs = 0;
+        for (auto itJ = lstJacobians.begin(); itJ != lstJacobians.end(); ++itJ, ++idx_obs)
         {
           // make sure they're in the expected order!
           ASSERTDEB_(itJ->first == lstObservationData[idx_obs].edge->first);
+          jacByIdx.push_back(&itJ->second);
+        }
+      }
 
-          //  grad[k] += J^t_{i->k} * Inf.Matrix * errs_i
-          //    k: [0,nFreeNodes-1]     <-- IDs.first & IDs.second
-          //    i: [0,nObservations-1]  <--- idx_obs
-
+      //  grad[k] += J^t_{i->k} * Inf.Matrix * errs_i
+      //    k: [0,nFreeNodes-1]     <-- IDs.first & IDs.second
+      //    i: [0,nObservations-1]  <--- idx_obs
+      const auto accumGradient = [&](const size_t idxFirst, const size_t idxEnd, CVectorDouble& g)
+      {
+        for (size_t idx_obs = idxFirst; idx_obs < idxEnd; idx_obs++)
+        {
           // Get the corresponding indices in the vector of "free
           // variables" being optimized:
           const size_t idx1 = obsIdx2fnIdx[idx_obs].first;
@@ -296,22 +338,49 @@ void optimize_graph_spa_levmarq(
           {
             typename gst::Array_O grad_idx1;
             detail::AuxErrorEval<typename gst::edge_t, gst>::multiply_Jt_W_err(
-                itJ->second.first /* J */, lstObservationData[idx_obs].edge /* W */,
+                jacByIdx[idx_obs]->first /* J */, lstObservationData[idx_obs].edge /* W */,
                 errs[idx_obs] /* err */, grad_idx1 /* out */
             );
-            for (unsigned int i = 0; i < DIMS_POSE; i++) grad[DIMS_POSE * idx1 + i] += grad_idx1[i];
+            for (unsigned int i = 0; i < DIMS_POSE; i++) g[DIMS_POSE * idx1 + i] += grad_idx1[i];
           }
 
           if (idx2 != string::npos)
           {
             typename gst::Array_O grad_idx2;
             detail::AuxErrorEval<typename gst::edge_t, gst>::multiply_Jt_W_err(
-                itJ->second.second /* J */, lstObservationData[idx_obs].edge /* W */,
+                jacByIdx[idx_obs]->second /* J */, lstObservationData[idx_obs].edge /* W */,
                 errs[idx_obs] /* err */, grad_idx2 /* out */
             );
-            for (unsigned int i = 0; i < DIMS_POSE; i++) grad[DIMS_POSE * idx2 + i] += grad_idx2[i];
+            for (unsigned int i = 0; i < DIMS_POSE; i++) g[DIMS_POSE * idx2 + i] += grad_idx2[i];
           }
         }
+      };
+
+      if (threadPool)
+      {
+        // Edges sharing a node would race on the same gradient entries, so
+        // each worker accumulates into its own vector, summed afterwards:
+        const size_t nThreads = threadPool->size();
+        const size_t chunk = (nObservations + nThreads - 1) / nThreads;
+        std::vector<CVectorDouble> partialGrad(nThreads);
+        std::vector<std::future<void>> futs;
+        futs.reserve(nThreads);
+        for (size_t t = 0; t < nThreads; t++)
+        {
+          const size_t idxFirst = t * chunk;
+          const size_t idxEnd = std::min(nObservations, idxFirst + chunk);
+          if (idxFirst >= idxEnd) break;
+          partialGrad[t].setZero(nFreeNodes * DIMS_POSE);
+          futs.emplace_back(threadPool->enqueue([&, t, idxFirst, idxEnd]()
+                                                { accumGradient(idxFirst, idxEnd, partialGrad[t]); }));
+        }
+        for (auto& f : futs) f.get();
+        for (const auto& pg : partialGrad)
+          if (pg.size() != 0) grad.asEigen() += pg.asEigen();
+      }
+      else
+      {
+        accumGradient(0, nObservations, grad);
       }
       profiler.leave("optimize_graph_spa_levmarq.grad");
 
@@ -342,14 +411,15 @@ void optimize_graph_spa_levmarq(
       //  - H_map[i][j] is the entry for the j'th row, with "j" also in
       //  the range [0,N-1] as ordered in "*nodes_to_optimize".
       // ======================================================================
-      {
-        size_t idxObs;
-        typename gst::map_pairIDs_pairJacobs_t::const_iterator itJacobPair;
+      H_map.assign(nFreeNodes, map_ID2matrix_TxT_t());
 
-        for (idxObs = 0, itJacobPair = lstJacobians.begin(); idxObs < nObservations;
-             ++itJacobPair, ++idxObs)
+      const auto accumHessian =
+          [&](const size_t idxFirst, const size_t idxEnd, vector<map_ID2matrix_TxT_t>& H)
+      {
+        for (size_t idxObs = idxFirst; idxObs < idxEnd; idxObs++)
         {
-          const bool Hij_upper_triang = itJacobPair->first.first < itJacobPair->first.second;
+          const auto& ids = lstObservationData[idxObs].edge->first;
+          const bool Hij_upper_triang = ids.first < ids.second;
 
           // Indices in the "H_map" vector:
           const size_t idx_i = obsIdx2fnIdx[idxObs].first;
@@ -361,8 +431,8 @@ void optimize_graph_spa_levmarq(
           // Take references to both Jacobians (wrt pose "i" and pose
           // "j"), taking into account the possible
           // switch in their order:
-          const typename gst::matrix_TxT& J1 = itJacobPair->second.first;
-          const typename gst::matrix_TxT& J2 = itJacobPair->second.second;
+          const typename gst::matrix_TxT& J1 = jacByIdx[idxObs]->first;
+          const typename gst::matrix_TxT& J2 = jacByIdx[idxObs]->second;
 
           // Is "i" a free (to be optimized) node? -> Ji^t * Inf *  Ji
           if (is_i_free_node)
@@ -370,7 +440,7 @@ void optimize_graph_spa_levmarq(
             typename gst::matrix_TxT JtJ(mrpt::math::UNINITIALIZED_MATRIX);
             detail::AuxErrorEval<typename gst::edge_t, gst>::multiplyJtLambdaJ(
                 J1, JtJ, lstObservationData[idxObs].edge);
-            H_map[idx_i][idx_i] += JtJ;
+            H[idx_i][idx_i] += JtJ;
           }
           // Is "j" a free (to be optimized) node? -> Jj^t * Inf *  Jj
           if (is_j_free_node)
@@ -378,7 +448,7 @@ void optimize_graph_spa_levmarq(
             typename gst::matrix_TxT JtJ(mrpt::math::UNINITIALIZED_MATRIX);
             detail::AuxErrorEval<typename gst::edge_t, gst>::multiplyJtLambdaJ(
                 J2, JtJ, lstObservationData[idxObs].edge);
-            H_map[idx_j][idx_j] += JtJ;
+            H[idx_j][idx_j] += JtJ;
           }
           // Are both "i" and "j" free nodes? -> Ji^t * Inf *  Jj
           if (is_i_free_node && is_j_free_node)
@@ -389,11 +459,40 @@ void optimize_graph_spa_levmarq(
             // We sort IDs such as "i" < "j" and we can build just
             // the upper triangular part of the Hessian:
             if (Hij_upper_triang)  // H_map[col][row]
-              H_map[idx_j][idx_i] += JtJ;
+              H[idx_j][idx_i] += JtJ;
             else
-              H_map[idx_i][idx_j].sum_At(JtJ);
+              H[idx_i][idx_j].sum_At(JtJ);
           }
         }
+      };
+
+      if (threadPool)
+      {
+        // As with the gradient: per-worker block columns, merged afterwards
+        // (a default-constructed matrix_TxT is all zeros, so operator+=
+        // also handles the insertion of new blocks):
+        const size_t nThreads = threadPool->size();
+        const size_t chunk = (nObservations + nThreads - 1) / nThreads;
+        std::vector<vector<map_ID2matrix_TxT_t>> partialH(nThreads);
+        std::vector<std::future<void>> futs;
+        futs.reserve(nThreads);
+        for (size_t t = 0; t < nThreads; t++)
+        {
+          const size_t idxFirst = t * chunk;
+          const size_t idxEnd = std::min(nObservations, idxFirst + chunk);
+          if (idxFirst >= idxEnd) break;
+          partialH[t].resize(nFreeNodes);
+          futs.emplace_back(threadPool->enqueue([&, t, idxFirst, idxEnd]()
+                                                { accumHessian(idxFirst, idxEnd, partialH[t]); }));
+        }
+        for (auto& f : futs) f.get();
+        for (const auto& Ht : partialH)
+          for (size_t i = 0; i < Ht.size(); i++)
+            for (const auto& ijBlock : Ht[i]) H_map[i][ijBlock.first] += ijBlock.second;
+      }
+      else
+      {
+        accumHessian(0, nObservations, H_map);
       }
       profiler.leave("optimize_graph_spa_levmarq.sp_H:build map");
 
@@ -577,9 +676,15 @@ void optimize_graph_spa_levmarq(
       typename gst::map_pairIDs_pairJacobs_t new_lstJacobians;
       std::vector<typename gst::Array_O> new_errs;
 
+      // A copy, since the updates below must be discarded if the step ends
+      // up being rejected:
+      auto new_errs_at_last_lin = errs_at_last_lin;
+
       profiler.enter("optimize_graph_spa_levmarq.Jacobians&err");
-      double new_total_sqr_err =
-          computeJacobiansAndErrors<GRAPH_T>(graph, lstObservationData, new_lstJacobians, new_errs);
+      double new_total_sqr_err = computeJacobiansAndErrors<GRAPH_T>(
+          graph, lstObservationData, new_lstJacobians, new_errs, threadPool.get(),
+          relinearize_threshold > 0 ? &lstJacobians : nullptr,
+          relinearize_threshold > 0 ? &new_errs_at_last_lin : nullptr, relinearize_threshold);
       profiler.leave("optimize_graph_spa_levmarq.Jacobians&err");
 
       // Now, to decide whether to accept the change:
@@ -588,6 +693,7 @@ void optimize_graph_spa_levmarq(
         // Accept the new point:
         new_lstJacobians.swap(lstJacobians);
         new_errs.swap(errs);
+        new_errs_at_last_lin.swap(errs_at_last_lin);
         std::swap(new_total_sqr_err, total_sqr_err);
 
         // Instruct to recompute H and grad from the new Jacobians.
@@ -8,7 +8,11 @@
    +------------------------------------------------------------------------+ */
 #pragma once
 
+#include <mrpt/core/WorkerThreadsPool.h>
+
 #include <Eigen/Dense>
+#include <future>
+#include <utility>
 #include <vector>
 
 namespace mrpt
@@ -136,52 +140,154 @@ struct AuxErrorEval<CPose3DPDFGaussianInf, gst>
 
 // Compute, at once, jacobians and the error vectors for each constraint in
 // "lstObservationData", returns the overall squared error.
+//
+// Extended version, used internally by optimize_graph_spa_levmarq():
+//  - If "threadPool" is not nullptr, the per-edge work is split among its
+//    worker threads.
+//  - If "prevJacobians" and "errsAtLastLinearization" are both provided and
+//    "relinearizeThreshold" is >0, edges whose error vector moved less than
+//    the threshold (Euclidean norm in the tangent space) since they were last
+//    linearized reuse their cached Jacobians from "prevJacobians", and
+//    "errsAtLastLinearization" is updated for the edges that *are*
+//    re-linearized.
+// [New in MRPT 2.14.5]
 template <class GRAPH_T>
 double computeJacobiansAndErrors(
     [[maybe_unused]] const GRAPH_T& graph,
     const std::vector<typename graphslam_traits<GRAPH_T>::observation_info_t>& lstObservationData,
     typename graphslam_traits<GRAPH_T>::map_pairIDs_pairJacobs_t& lstJacobians,
-    std::vector<typename graphslam_traits<GRAPH_T>::Array_O>& errs)
+    std::vector<typename graphslam_traits<GRAPH_T>::Array_O>& errs,
+    mrpt::WorkerThreadsPool* threadPool,
+    const typename graphslam_traits<GRAPH_T>::map_pairIDs_pairJacobs_t* prevJacobians = nullptr,
+    std::vector<typename graphslam_traits<GRAPH_T>::Array_O>* errsAtLastLinearization = nullptr,
+    const double relinearizeThreshold = .0)
 {
   using gst = graphslam_traits<GRAPH_T>;
 
-  lstJacobians.clear();
-  errs.clear();
-
   const size_t nObservations = lstObservationData.size();
 
-  for (size_t i = 0; i < nObservations; i++)
+  errs.assign(nObservations, typename gst::Array_O());
+  // Per-observation scratch, so worker threads can fill entries in any
+  // order; dumped into the (ordered) multimap at the end:
+  std::vector<std::pair<mrpt::graphs::TPairNodeIDs, typename gst::TPairJacobs>> jacs(nObservations);
+
+  const bool incremental = prevJacobians != nullptr && errsAtLastLinearization != nullptr &&
+      relinearizeThreshold > 0 && prevJacobians->size() == nObservations &&
+      errsAtLastLinearization->size() == nObservations;
+
+  // The multimap iterates in the same order as lstObservationData, but the
+  // worker threads need random access to reuse the cached Jacobians:
+  std::vector<const typename gst::TPairJacobs*> prevJacByIdx;
+  if (incremental)
+  {
+    prevJacByIdx.reserve(nObservations);
+    for (const auto& pj : *prevJacobians) prevJacByIdx.push_back(&pj.second);
+  }
+
+  const auto process = [&](const size_t idxFirst, const size_t idxEnd)
   {
-    const typename gst::observation_info_t& obs = lstObservationData[i];
-    auto e = obs.edge;
-    const typename gst::graph_t::constraint_t::type_value* EDGE_POSE = obs.edge_mean;
-    typename gst::graph_t::constraint_t::type_value* P1 = obs.P1;
-    typename gst::graph_t::constraint_t::type_value* P2 = obs.P2;
+    // Edges of this chunk that must be (re)linearized; gathered into
+    // contiguous arrays so the Jacobians can be evaluated through the
+    // batched SE(n) API below:
+    std::vector<size_t> idxToLinearize;
+    std::vector<typename gst::graph_t::constraint_t::type_value> Dinvs, P1s, P2s;
+    idxToLinearize.reserve(idxEnd - idxFirst);
+    Dinvs.reserve(idxEnd - idxFirst);
+    P1s.reserve(idxEnd - idxFirst);
+    P2s.reserve(idxEnd - idxFirst);
+
+    for (size_t i = idxFirst; i < idxEnd; i++)
+    {
+      const typename gst::observation_info_t& obs = lstObservationData[i];
+      const typename gst::graph_t::constraint_t::type_value* EDGE_POSE = obs.edge_mean;
+      typename gst::graph_t::constraint_t::type_value* P1 = obs.P1;
+      typename gst::graph_t::constraint_t::type_value* P2 = obs.P2;
+
+      // Compute the residual pose error of these pair of nodes + its
+      // constraint:
+      // DinvP1invP2 = inv(EDGE) * inv(P1) * P2 = (P2 \ominus P1) \ominus EDGE
+      const typename gst::graph_t::constraint_t::type_value DinvP1invP2 =
+          ((*P2) - (*P1)) - *EDGE_POSE;
 
-    const auto& ids = e->first;
-    // const auto& edge = e->second;
+      errs[i] = gst::SE_TYPE::log(DinvP1invP2);
 
-    // Compute the residual pose error of these pair of nodes + its
-    // constraint:
-    // DinvP1invP2 = inv(EDGE) * inv(P1) * P2 = (P2 \ominus P1) \ominus EDGE
-    typename gst::graph_t::constraint_t::type_value DinvP1invP2 = ((*P2) - (*P1)) - *EDGE_POSE;
+      jacs[i].first = obs.edge->first;
 
-    // Add to vector of errors:
-    errs.resize(errs.size() + 1);
-    errs.back() = gst::SE_TYPE::log(DinvP1invP2);
+      // Incremental mode: if the error stayed close to the point where the
+      // cached Jacobians were evaluated, reuse them instead of
+      // re-linearizing this edge:
+      if (incremental)
+      {
+        double errDeltaSqr = 0;
+        for (size_t k = 0; k < errs[i].size(); k++)
+          errDeltaSqr += mrpt::square(errs[i][k] - (*errsAtLastLinearization)[i][k]);
+        if (errDeltaSqr <= mrpt::square(relinearizeThreshold))
+        {
+          jacs[i].second = *prevJacByIdx[i];
+          continue;
+        }
+      }
 
-    // Compute the jacobians:
-    alignas(MRPT_MAX_STATIC_ALIGN_BYTES)
-        std::pair<mrpt::graphs::TPairNodeIDs, typename gst::TPairJacobs>
-            newMapEntry;
-    newMapEntry.first = ids;
-    gst::SE_TYPE::jacob_dDinvP1invP2_de1e2(
-        -(*EDGE_POSE), *P1, *P2, newMapEntry.second.first, newMapEntry.second.second);
+      // Defer the Jacobians of this edge to the batched evaluation:
+      idxToLinearize.push_back(i);
+      Dinvs.emplace_back(-(*EDGE_POSE));
+      P1s.emplace_back(*P1);
+      P2s.emplace_back(*P2);
+      if (incremental) (*errsAtLastLinearization)[i] = errs[i];
+    }
 
-    // And insert into map of jacobians:
-    lstJacobians.insert(lstJacobians.end(), newMapEntry);
+    // Batch-compute both Jacobians of all the gathered edges at once:
+    const size_t nLin = idxToLinearize.size();
+    std::vector<typename gst::SE_TYPE::matrix_TxT> J1s(nLin), J2s(nLin);
+    gst::SE_TYPE::jacob_dDinvP1invP2_de1e2_many(
+        Dinvs.data(), P1s.data(), P2s.data(), J1s.data(), J2s.data(), nLin);
+
+    for (size_t k = 0; k < nLin; k++)
+    {
+      auto& jac = jacs[idxToLinearize[k]].second;
+      jac.first = J1s[k];
+      jac.second = J2s[k];
+    }
+  };
+
+  if (threadPool != nullptr && threadPool->size() > 1 && nObservations > 1)
+  {
+    // CPose2D lazily caches its cos/sin terms in mutable fields, so warm up
+    // the caches of all the (shared) node poses while still single-threaded,
+    // making the concurrent read-only accesses below race-free:
+    if constexpr (gst::SE_TYPE::DOFs == 3)
+    {
+      for (const auto& obs : lstObservationData)
+      {
+        obs.P1->phi_cos();
+        obs.P2->phi_cos();
+      }
+    }
+
+    const size_t nThreads = threadPool->size();
+    const size_t chunk = (nObservations + nThreads - 1) / nThreads;
+    std::vector<std::future<void>> futs;
+    futs.reserve(nThreads);
+    for (size_t t = 0; t < nThreads; t++)
+    {
+      const size_t idxFirst = t * chunk;
+      const size_t idxEnd = std::min(nObservations, idxFirst + chunk);
+      if (idxFirst >= idxEnd) break;
+      futs.emplace_back(threadPool->enqueue(process, idxFirst, idxEnd));
+    }
+    for (auto& f : futs) f.get();
+  }
+  else
+  {
+    process(0, nObservations);
   }
 
+  // Insert into the map of jacobians. Entries were generated in ascending
+  // key order (lstObservationData iterates graph.edges), so the end() hint
+  // makes each insertion O(1):
+  lstJacobians.clear();
+  for (auto& j : jacs) lstJacobians.insert(lstJacobians.end(), std::move(j));
+
   // return overall square error:  (Was:
   // std::accumulate(...,mrpt::squareNorm_accum<>), but led to GCC
   // errors when enabling parallelization)
@@ -190,5 +296,16 @@ double computeJacobiansAndErrors(
   return ret_err;
 }
 
+/** \overload Single-threaded, full re-linearization version. */
+template <class GRAPH_T>
+double computeJacobiansAndErrors(
+    const GRAPH_T& graph,
+    const std::vector<typename graphslam_traits<GRAPH_T>::observation_info_t>& lstObservationData,
+    typename graphslam_traits<GRAPH_T>::map_pairIDs_pairJacobs_t& lstJacobians,
+    std::vector<typename graphslam_traits<GRAPH_T>::Array_O>& errs)
+{
+  return computeJacobiansAndErrors<GRAPH_T>(graph, lstObservationData, lstJacobians, errs, nullptr);
+}
+
 }  // namespace graphslam
 }  // namespace mrpt
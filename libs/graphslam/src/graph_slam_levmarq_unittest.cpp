@@ -147,6 +147,32 @@ class GraphTester : public GraphSlamLevMarqTest<my_graph_t>, public ::testing::T
     compare_two_graphs(graph, read_graph);
   }
 
+  void test_optimize_multithreaded()
+  {
+    // A ring large enough for optimize_graph_spa_levmarq() to actually
+    // split the work among several threads:
+    my_graph_t graph;
+    GraphSlamLevMarqTest<my_graph_t>::create_ring_path(graph, 300 /*N_VERTEX*/);
+    my_graph_t graph_mt = graph;
+
+    mrpt::containers::yaml params;
+    params["max_iterations"] = 100;
+
+    graphslam::TResultInfoSpaLevMarq levmarq_info;
+    graphslam::optimize_graph_spa_levmarq(graph, levmarq_info, nullptr, params);
+
+    // Multithreaded + incremental re-linearization must converge to the
+    // same solution:
+    params["num_threads"] = 4;
+    params["relinearize_threshold"] = 1e-6;
+
+    graphslam::TResultInfoSpaLevMarq levmarq_info_mt;
+    graphslam::optimize_graph_spa_levmarq(graph_mt, levmarq_info_mt, nullptr, params);
+
+    EXPECT_LE(levmarq_info_mt.final_total_sq_error, 5e-2);
+    compare_two_graphs(graph, graph_mt, 1e-2 /*eps_node_pos*/, 1e-2 /*eps_edges*/);
+  }
+
   void test_optimize_compare_known_solution(const char* type)
   {
     auto files_it = inout_graph_files.find(type);
@@ -224,6 +250,11 @@ using GraphTester3DInf = GraphTester<CNetworkOfPoses3DInf>;
     getRandomGenerator().randomize(123);    \
     test_graph_text_serialization();        \
   }                                         \
+  TEST_F(_TYPE, OptimizeMultithreaded)    \
+  {                                       \
+    getRandomGenerator().randomize(42);   \
+    test_optimize_multithreaded();        \
+  }                                       \
   TEST_F(_TYPE, OptimizeCompareKnownSolution) { test_optimize_compare_known_solution(#_TYPE); }
 
 GRAPHS_TESTS(GraphTester2D)
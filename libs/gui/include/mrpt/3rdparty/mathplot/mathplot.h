@@ -92,6 +92,7 @@
 #pragma interface "mathplot.h"
 #endif
 
+#include <utility>
 #include <vector>
 
 // #include <wx/wx.h>
@@ -1559,11 +1560,43 @@ class WXDLLIMPEXP_MATHPLOT mpFXYVector : public mpFXY
 	 */
 	void AppendDataPoint(float x, float y);
 
+	/** Layer plotting handler, overridden in this implementation: when the
+	   layer holds a long X-sorted series (e.g. telemetry over time) with
+	   many samples per pixel column, it is rendered decimated as one
+	   min/max vertical segment per column, served from a cached
+	   level-of-detail pyramid that is extended incrementally as data are
+	   appended. Visually equivalent to drawing every segment, but with a
+	   cost bounded by the window width instead of the sample count.
+	   Falls back to mpFXY::Plot for small or non-monotonic data sets.
+	   (Added: AGO-2026)
+	*/
+	void Plot(wxDC& dc, mpWindow& w) override;
+
    protected:
 	/** The internal copy of the set of data to draw.
 	 */
 	std::vector<double> m_xs, m_ys;
 
+	/** Level-of-detail pyramid for the decimated Plot(): entry [k][j] holds
+		the (min,max) of m_ys over the bucket of 2^(k+1) samples starting
+		at index j*2^(k+1). Lazily extended by lodUpdate().
+	*/
+	std::vector<std::vector<std::pair<double, double>>> m_lodLevels;
+
+	/** Number of samples already folded into m_lodLevels */
+	size_t m_lodValidCount = 0;
+
+	/** Whether m_xs is sorted in ascending order, a requirement for the
+		decimated Plot() path */
+	bool m_xsSortedAscending = true;
+
+	/** Extends m_lodLevels to cover all current samples */
+	void lodUpdate();
+
+	/** Returns the (min,max) of m_ys over the index range [i0,i1), i0<i1,
+		using the m_lodLevels pyramid */
+	std::pair<double, double> lodQueryMinMax(size_t i0, size_t i1) const;
+
 	/** The internal counter for the "GetNextXY" interface
 	 */
 	size_t m_index;
@@ -14,6 +14,8 @@
 #include <mrpt/opengl/opengl_fonts.h>
 #include <mrpt/system/datetime.h>
 
+#include <atomic>
+#include <cstdint>
 #include <mutex>
 
 namespace mrpt::gui
@@ -124,6 +126,19 @@ class CDisplayWindow3D : public mrpt::gui::CBaseGUIWindow
   /** Critical section for accessing m_3Dscene */
   mutable std::recursive_timed_mutex m_csAccess3DScene;
 
+  /** Staged scene handed over via set3DSceneAndRepaint(), waiting to be
+   * latched into m_3Dscene by the render thread right before painting. */
+  mrpt::opengl::Scene::Ptr m_stagedScene;
+  std::mutex m_stagedSceneMtx;
+  /** True while a repaint requested by set3DSceneAndRepaint() has not been
+   * serviced yet, so further requests can be coalesced. */
+  std::atomic_bool m_stagedRepaintPending{false};
+  std::atomic<std::uint64_t> m_stagedFramesSkipped{0};
+
+  /** Called by the render thread (canvas OnPreRender) to swap in the latest
+   * staged scene, if any. */
+  void internal_latchStagedScene();
+
   /** Throws an exception on initialization error */
   void createOpenGLContext();
 
@@ -177,6 +192,29 @@ class CDisplayWindow3D : public mrpt::gui::CBaseGUIWindow
    */
   void unlockAccess3DScene();
 
+  /** Non-blocking alternative to the
+   * get3DSceneAndLock()/unlockAccess3DScene()/forceRepaint() sequence:
+   * atomically hands `scene` over to the render thread and requests a
+   * repaint, without ever waiting for the scene mutex while a render is in
+   * progress. The render thread takes ownership of the scene, so the caller
+   * must not modify it afterwards: keep building the *next* frame into a
+   * fresh (or recycled) Scene object instead.
+   *
+   * The handoff is triple-buffered: the producer's scene under construction,
+   * the staged scene, and the scene currently being rendered. If scenes are
+   * staged faster than the window repaints, a pending staged scene is
+   * replaced by the fresher one (latest-wins frame skipping) and the repaint
+   * requests are coalesced; see getStagedFramesSkipped().
+   * \note [New in MRPT 2.14.5]
+   */
+  void set3DSceneAndRepaint(mrpt::opengl::Scene::Ptr scene);
+
+  /** Number of scenes handed to set3DSceneAndRepaint() that were dropped
+   * (replaced by a fresher one) before ever being rendered.
+   * \note [New in MRPT 2.14.5]
+   */
+  std::uint64_t getStagedFramesSkipped() const { return m_stagedFramesSkipped; }
+
   /** Repaints the window. forceRepaint, repaint and updateWindow are all
    * aliases of the same method */
   void forceRepaint();
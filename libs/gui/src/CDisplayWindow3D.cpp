@@ -204,6 +204,9 @@ void CMyGLCanvas_DisplayWindow3D::OnPreRender()
   auto& openGLSceneRef = getOpenGLSceneRef();
   if (openGLSceneRef) openGLSceneRef.reset();
 
+  // Pick up the latest scene staged via set3DSceneAndRepaint(), if any:
+  m_win3D->internal_latchStagedScene();
+
   Scene::Ptr& ptrScene = m_win3D->get3DSceneAndLock();
   if (ptrScene) openGLSceneRef = ptrScene;
 }
@@ -485,6 +488,37 @@ opengl::Scene::Ptr& CDisplayWindow3D::get3DSceneAndLock()
 
 void CDisplayWindow3D::unlockAccess3DScene() { m_csAccess3DScene.unlock(); }
 
+void CDisplayWindow3D::set3DSceneAndRepaint(mrpt::opengl::Scene::Ptr scene)
+{
+  {
+    std::lock_guard<std::mutex> lck(m_stagedSceneMtx);
+    // Latest-wins frame skipping: an un-rendered staged scene is simply
+    // replaced by the fresher one.
+    if (m_stagedScene) m_stagedFramesSkipped++;
+    m_stagedScene = std::move(scene);
+  }
+  // Coalesce repaint requests: if the previous one has not been serviced
+  // yet, that repaint will already pick up the scene staged above.
+  if (!m_stagedRepaintPending.exchange(true)) forceRepaint();
+}
+
+void CDisplayWindow3D::internal_latchStagedScene()
+{
+  m_stagedRepaintPending = false;
+  Scene::Ptr staged;
+  {
+    std::lock_guard<std::mutex> lck(m_stagedSceneMtx);
+    staged = std::move(m_stagedScene);
+    m_stagedScene.reset();
+  }
+  if (!staged) return;
+
+  // Called from the render thread right before OnPreRender() relocks, so
+  // this recursive mutex is contention-free at this point:
+  std::lock_guard<std::recursive_timed_mutex> lck(m_csAccess3DScene);
+  m_3Dscene = std::move(staged);
+}
+
 void CDisplayWindow3D::forceRepaint()
 {
 #if MRPT_HAS_WXWIDGETS && MRPT_HAS_OPENGL_GLUT
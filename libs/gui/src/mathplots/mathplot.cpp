@@ -60,6 +60,7 @@ const int INVALID_CLICK_COORDS = -99999;
 #endif
 #include <algorithm>  // For std::min()/max()
 #include <cmath>
+#include <limits>
 #include <cstdio>  // used only for debug
 #include <ctime>   // used for representation of x axes involving date
 
@@ -2424,6 +2425,9 @@ void mpFXYVector::Clear()
 {
   m_xs.clear();
   m_ys.clear();
+  m_lodLevels.clear();
+  m_lodValidCount = 0;
+  m_xsSortedAscending = true;
 }
 
 void mpFXYVector::SetData(const std::vector<float>& xs, const std::vector<float>& ys)
@@ -2456,6 +2460,11 @@ void mpFXYVector::SetData(const std::vector<double>& xs, const std::vector<doubl
   m_xs = xs;
   m_ys = ys;
 
+  // Invalidate the decimation LOD pyramid:
+  m_lodLevels.clear();
+  m_lodValidCount = 0;
+  m_xsSortedAscending = std::is_sorted(xs.begin(), xs.end());
+
   // Update internal variables for the bounding box.
   if (xs.size() > 0)
   {
@@ -2492,7 +2501,10 @@ void mpFXYVector::SetData(const std::vector<double>& xs, const std::vector<doubl
 
 void mpFXYVector::AppendDataPoint(float x, float y)
 {
+  if (!m_xs.empty() && x < m_xs.back()) m_xsSortedAscending = false;
+
   // Append the data:
+  // (the LOD pyramid is extended lazily at the next Plot() call)
   m_xs.push_back(x);
   m_ys.push_back(y);
 
@@ -2520,6 +2532,202 @@ void mpFXYVector::AppendDataPoint(float x, float y)
   }
 }
 
+void mpFXYVector::lodUpdate()
+{
+  const size_t N = m_ys.size();
+  if (m_lodValidCount == N) return;
+
+  // Levels while a bucket of 2^(k+1) samples still fits in the data:
+  size_t nLevels = 0;
+  while ((size_t(1) << (nLevels + 1)) <= N) nLevels++;
+  if (m_lodLevels.size() < nLevels) m_lodLevels.resize(nLevels);
+
+  for (size_t k = 0; k < nLevels; k++)
+  {
+    const size_t B = size_t(1) << (k + 1);
+    auto& lvl = m_lodLevels[k];
+    const size_t nBuckets = (N + B - 1) / B;
+    // Only the bucket holding the first new sample and the ones after it
+    // need (re)computing, so appends cost O(log N) amortized:
+    const size_t firstDirty = (m_lodValidCount > 0 ? m_lodValidCount - 1 : 0) / B;
+    lvl.resize(nBuckets);
+
+    for (size_t j = firstDirty; j < nBuckets; j++)
+    {
+      if (k == 0)
+      {
+        const size_t i0 = j * B, i1 = std::min(i0 + B, N);
+        double mn = m_ys[i0], mx = m_ys[i0];
+        for (size_t i = i0 + 1; i < i1; i++)
+        {
+          mn = std::min(mn, m_ys[i]);
+          mx = std::max(mx, m_ys[i]);
+        }
+        lvl[j] = {mn, mx};
+      }
+      else
+      {
+        // Combine the two children buckets of the level below:
+        const auto& prev = m_lodLevels[k - 1];
+        auto p = prev[2 * j];
+        if (2 * j + 1 < prev.size())
+        {
+          p.first = std::min(p.first, prev[2 * j + 1].first);
+          p.second = std::max(p.second, prev[2 * j + 1].second);
+        }
+        lvl[j] = p;
+      }
+    }
+  }
+  m_lodValidCount = N;
+}
+
+std::pair<double, double> mpFXYVector::lodQueryMinMax(size_t i0, size_t i1) const
+{
+  double mn = std::numeric_limits<double>::max();
+  double mx = -std::numeric_limits<double>::max();
+
+  // Greedily cover [i0,i1) with the largest aligned pyramid buckets:
+  size_t i = i0;
+  while (i < i1)
+  {
+    size_t usedLevel = std::string::npos, usedB = 1;
+    for (size_t k = m_lodLevels.size(); k-- > 0;)
+    {
+      const size_t B = size_t(1) << (k + 1);
+      if ((i % B) == 0 && i + B <= i1)
+      {
+        usedLevel = k;
+        usedB = B;
+        break;
+      }
+    }
+    if (usedLevel == std::string::npos)
+    {
+      mn = std::min(mn, m_ys[i]);
+      mx = std::max(mx, m_ys[i]);
+      i++;
+    }
+    else
+    {
+      const auto& p = m_lodLevels[usedLevel][i / usedB];
+      mn = std::min(mn, p.first);
+      mx = std::max(mx, p.second);
+      i += usedB;
+    }
+  }
+  return {mn, mx};
+}
+
+void mpFXYVector::Plot(wxDC& dc, mpWindow& w)
+{
+  if (!m_visible) return;
+
+  // Decimated min/max rendering only pays off for long, X-sorted series
+  // drawn as continuous lines:
+  bool decimate = m_continuous && m_xsSortedAscending && m_ys.size() >= 4096;
+
+  const wxCoord startPx = m_drawOutsideMargins ? 0 : w.GetMarginLeft();
+  const wxCoord endPx = m_drawOutsideMargins ? w.GetScrX() : w.GetScrX() - w.GetMarginRight();
+  const wxCoord minYpx = m_drawOutsideMargins ? 0 : w.GetMarginTop();
+  const wxCoord maxYpx = m_drawOutsideMargins ? w.GetScrY() : w.GetScrY() - w.GetMarginBottom();
+
+  size_t iStart = 0, iEnd = 0;
+  if (decimate)
+  {
+    iStart = std::lower_bound(m_xs.begin(), m_xs.end(), w.p2x(startPx)) - m_xs.begin();
+    iEnd = std::lower_bound(m_xs.begin(), m_xs.end(), w.p2x(endPx)) - m_xs.begin();
+    // Require a few samples per pixel column on average, else plain
+    // per-segment drawing is both faster and more accurate:
+    const size_t nColumns = static_cast<size_t>(std::max<wxCoord>(1, endPx - startPx));
+    if (iEnd < iStart + 4 * nColumns) decimate = false;
+  }
+
+  if (!decimate)
+  {
+    mpFXY::Plot(dc, w);
+    return;
+  }
+
+  lodUpdate();
+
+  dc.SetPen(m_pen);
+
+  // For the label placement bounding box:
+  maxDrawX = startPx;
+  minDrawX = startPx;
+  maxDrawY = w.y2p(m_ys[iStart]);
+  minDrawY = maxDrawY;
+
+  // One vertical min/max segment per pixel column:
+  size_t i0 = iStart;
+  double prevLastY = 0;
+  bool havePrevY = false;
+  for (wxCoord px = startPx; px < endPx && i0 < iEnd; px++)
+  {
+    const double xHi = w.p2x(px + 1);
+    const size_t i1 = std::lower_bound(m_xs.begin() + i0, m_xs.begin() + iEnd, xHi) - m_xs.begin();
+    if (i1 == i0) continue;  // no sample falls in this column
+
+    auto [mn, mx] = lodQueryMinMax(i0, i1);
+
+    // Extend with the closing value of the former column, so consecutive
+    // columns always connect as a continuous line does:
+    if (havePrevY)
+    {
+      mn = std::min(mn, prevLastY);
+      mx = std::max(mx, prevLastY);
+    }
+    prevLastY = m_ys[i1 - 1];
+    havePrevY = true;
+    i0 = i1;
+
+    wxCoord yTop = w.y2p(mx), yBot = w.y2p(mn);
+    if (yTop > yBot) std::swap(yTop, yBot);
+    if (!m_drawOutsideMargins)
+    {
+      if (yBot < minYpx || yTop > maxYpx) continue;
+      yTop = std::max(yTop, minYpx);
+      yBot = std::min(yBot, maxYpx);
+    }
+    dc.DrawLine(px, yTop, px, yBot);
+    UpdateViewBoundary(px, yTop);
+    UpdateViewBoundary(px, yBot);
+  }
+
+  // Same label rendering as in mpFXY::Plot:
+  if (!m_name.IsEmpty() && m_showName)
+  {
+    dc.SetFont(m_font);
+
+    wxCoord tx, ty;
+    dc.GetTextExtent(m_name, &tx, &ty);
+
+    if ((mpFXY::m_flags & mpALIGNMASK) == mpALIGN_NW)
+    {
+      tx = minDrawX + 8;
+      ty = maxDrawY + 8;
+    }
+    else if ((mpFXY::m_flags & mpALIGNMASK) == mpALIGN_NE)
+    {
+      tx = maxDrawX - tx - 8;
+      ty = maxDrawY + 8;
+    }
+    else if ((mpFXY::m_flags & mpALIGNMASK) == mpALIGN_SE)
+    {
+      tx = maxDrawX - tx - 8;
+      ty = minDrawY - ty - 8;
+    }
+    else
+    {  // mpALIGN_SW
+      tx = minDrawX + 8;
+      ty = minDrawY - ty - 8;
+    }
+
+    dc.DrawText(m_name, tx, ty);
+  }
+}
+
 //-----------------------------------------------------------------------------
 // mpText - provided by Val Greene
 //-----------------------------------------------------------------------------
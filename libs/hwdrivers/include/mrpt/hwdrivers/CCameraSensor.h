@@ -27,6 +27,8 @@
 #include <mrpt/poses/CPose3D.h>
 #include <mrpt/system/COutputLogger.h>
 
+#include <atomic>
+#include <cstdint>
 #include <functional>
 #include <memory>  // unique_ptr
 
@@ -338,6 +340,37 @@ class CCameraSensor : public mrpt::system::COutputLogger, public CGenericSensor
     m_external_images_own_thread = enable;
   };
 
+  /** Maximum number of frames that may be pending in the asynchronous
+   * image-saving queues (aggregated over all saver threads) before the
+   * *oldest* queued frame is dropped, so a slow disk degrades into frame
+   * drops instead of unbounded memory growth and latency. 0 (default)
+   * keeps the queues unbounded. Also settable via the config param
+   * `external_images_max_queue_len`. \note [New in MRPT 2.14.5] */
+  void setExternalImagesMaxQueueLength(size_t maxLen) { m_toSaveList_max_len = maxLen; }
+  size_t getExternalImagesMaxQueueLength() const { return m_toSaveList_max_len; }
+
+  /** Statistics of the capture + asynchronous disk-writing pipeline.
+   * \sa getPipelineStats \note [New in MRPT 2.14.5] */
+  struct TPipelineStats
+  {
+    /** Frames handed over to the saver threads */
+    uint64_t frames_enqueued = 0;
+    /** Frames actually written to disk */
+    uint64_t frames_saved = 0;
+    /** Frames discarded by the drop-oldest policy */
+    uint64_t frames_dropped = 0;
+    /** Capture+conversion time of the last grabbed frame [s] */
+    double last_grab_latency_sec = 0;
+    /** Frame timestamp to written-to-disk time of the last saved frame [s] */
+    double last_save_latency_sec = 0;
+    /** Frames currently waiting in the saving queues */
+    size_t cur_queue_len = 0;
+  };
+
+  /** Returns a snapshot of the current pipeline statistics. Thread-safe.
+   * \note [New in MRPT 2.14.5] */
+  TPipelineStats getPipelineStats() const;
+
   /** Functor type */
   using TPreSaveUserHook =
       std::function<void(const mrpt::obs::CObservation::Ptr& obs, void* user_ptr)>;
@@ -493,10 +526,23 @@ class CCameraSensor : public mrpt::system::COutputLogger, public CGenericSensor
 
   bool m_threadImagesSaverShouldEnd{false};
   /** The critical section for m_toSaveList */
-  std::mutex m_csToSaveList;
+  mutable std::mutex m_csToSaveList;
   /** The queues of objects to be returned by getObservations, one for each
    * working thread. */
   std::vector<TListObservations> m_toSaveList;
+  /** Aggregated bound for m_toSaveList (0=unbounded), see
+   * setExternalImagesMaxQueueLength() */
+  size_t m_toSaveList_max_len{0};
+
+  /** Pipeline statistics, see getPipelineStats() */
+  std::atomic<uint64_t> m_statFramesEnqueued{0}, m_statFramesSaved{0}, m_statFramesDropped{0};
+  std::atomic<double> m_statLastGrabLatency{0}, m_statLastSaveLatency{0};
+
+  /** Enqueues an observation in the shortest saver-thread queue, enforcing
+   * the drop-oldest bound */
+  void enqueueForAsyncSave(
+      const mrpt::system::TTimeStamp& ts, const mrpt::serialization::CSerializable::Ptr& obs);
+
   /** Thread to save images to files. */
   void thread_save_images(unsigned int my_working_thread_index);
 
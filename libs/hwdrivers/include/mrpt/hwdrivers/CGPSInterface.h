@@ -19,6 +19,8 @@
 #include <mrpt/system/COutputLogger.h>
 #include <mrpt/typemeta/TEnumType.h>
 
+#include <string_view>
+
 namespace mrpt::hwdrivers
 {
 /** A class capable of reading GPS/GNSS/GNSS+IMU receiver data, from a serial
@@ -224,8 +226,14 @@ class CGPSInterface : public mrpt::system::COutputLogger, public CGenericSensor
    * \return true if some new data field has been correctly parsed and
    * inserted into out_obs
    */
+  /** \note Takes a view since MRPT 2.14.5: the sentence is tokenized and
+   * parsed without allocating heap memory (std::string arguments still bind
+   * via the implicit conversion).
+   */
   [[nodiscard]] static bool parse_NMEA(
-      const std::string& cmd_line, mrpt::obs::CObservationGPS& out_obs, const bool verbose = false);
+      const std::string_view& cmd_line,
+      mrpt::obs::CObservationGPS& out_obs,
+      const bool verbose = false);
 
   /** Gets the latest GGA command or an empty string if no newer GGA command
    * was received since the last call to this method.
@@ -10,11 +10,12 @@
 #pragma once
 
 #include <mrpt/config/CConfigFileBase.h>
+#include <mrpt/containers/mpsc_queue.h>
 #include <mrpt/obs/CObservation.h>
 #include <mrpt/typemeta/TEnumType.h>
 
 #include <map>
-#include <mutex>
+#include <vector>
 
 namespace mrpt
 {
@@ -113,10 +114,11 @@ class CGenericSensor
   static void registerClass(const TSensorClassId* pNewClass);
 
  private:
-  /** The critical section for m_objList */
-  std::mutex m_csObjList;
-  /** The queue of objects to be returned by getObservations */
-  TListObservations m_objList;
+  /** Lock-free MPSC queue of pending batches (one entry per
+   * appendObservations() call): driver threads push here without ever
+   * blocking on the consumer, and getObservations() drains it all at once.
+   */
+  mrpt::containers::mpsc_queue<std::vector<TListObsPair>> m_objQueue;
 
   /** Used in registerClass */
   using registered_sensor_classes_t = std::map<std::string, const TSensorClassId*>;
@@ -131,8 +133,8 @@ class CGenericSensor
   double m_process_rate{0};
   /** See CGenericSensor */
   size_t m_max_queue_len{200};
-  /** If set to N>=2, only 1 out of N observations will be saved to m_objList.
-   */
+  /** If set to N>=2, only 1 out of N observations will be enqueued for
+   * getObservations(). */
   size_t m_grab_decimation{0};
   /** See CGenericSensor */
   std::string m_sensorLabel = "UNNAMED_SENSOR";
@@ -204,6 +204,12 @@ class CHokuyoURG : public C2DRangeFinderAbstract
       mrpt::obs::CObservation2DRangeScan& outObservation,
       bool& hardwareError) override;
 
+  /** Overridden to drain *all* the scans pending in the RX buffer in a
+   * single call, appending one observation per scan: with the sensor
+   * streaming at up to 40 Hz, a caller polling at a slower rate would
+   * otherwise drop frames. \note [New in MRPT 2.14.5] */
+  void doProcess() override;
+
   /** Enables the scanning mode (which may depend on the specific laser
    * device); this must be called before asking for observations to assure
    * that the protocol has been initializated.
@@ -262,6 +268,9 @@ class CHokuyoURG : public C2DRangeFinderAbstract
   std::string m_rcv_data;
   char m_rcv_status0 = '\0', m_rcv_status1 = '\0';
 
+  /** Scan being filled in by doProcess(), reused across calls */
+  mrpt::obs::CObservation2DRangeScan::Ptr m_pendingObs;
+
   /** Returns true if there is a valid stream bound to the laser scanner,
    * otherwise it first try to open the serial port "m_com_port"
    */
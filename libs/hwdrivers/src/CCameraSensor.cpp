@@ -604,6 +604,8 @@ void CCameraSensor::loadConfig_sensorSpecific(
       iniSection, "external_images_own_thread", m_external_images_own_thread);
   m_external_image_saver_count = configSource.read_int(
       iniSection, "external_images_own_thread_count", m_external_image_saver_count);
+  m_toSaveList_max_len =
+      configSource.read_uint64_t(iniSection, "external_images_max_queue_len", m_toSaveList_max_len);
 
   // Sensor pose:
   m_sensorPose.setFromValues(
@@ -640,6 +642,8 @@ CObservation::Ptr CCameraSensor::getNextFrame()
 ----------------------------------------------------- */
 void CCameraSensor::getNextFrame(vector<CSerializable::Ptr>& out_obs)
 {
+  const double t_grab_start = mrpt::Clock::nowDouble();
+
   CObservationImage::Ptr obs;
   CObservationStereoImages::Ptr stObs;
   CObservation3DRangeScan::Ptr obs3D;  // 3D range image, also with an intensity channel
@@ -1088,6 +1092,8 @@ void CCameraSensor::getNextFrame(vector<CSerializable::Ptr>& out_obs)
       img4gui = obs3D->intensityImage.makeDeepCopy();
   }
 
+  m_statLastGrabLatency = mrpt::Clock::nowDouble() - t_grab_start;
+
   // External storage?
   // If true, we'll return nothing, but the observation will be
   // inserted from the thread.
@@ -1098,17 +1104,7 @@ void CCameraSensor::getNextFrame(vector<CSerializable::Ptr>& out_obs)
     {           // Stereo obs  -------
       if (m_external_images_own_thread)
       {
-        m_csToSaveList.lock();
-
-        // Select the "m_toSaveList" with the shortest pending queue:
-        size_t idx_min = 0;
-        for (size_t i = 0; i < m_toSaveList.size(); ++i)
-          if (m_toSaveList[i].size() < m_toSaveList[idx_min].size()) idx_min = i;
-        // Insert:
-        m_toSaveList[idx_min].insert(TListObsPair(stObs->timestamp, stObs));
-
-        m_csToSaveList.unlock();
-
+        enqueueForAsyncSave(stObs->timestamp, stObs);
         delayed_insertion_in_obs_queue = true;
       }
       else
@@ -1162,17 +1158,7 @@ void CCameraSensor::getNextFrame(vector<CSerializable::Ptr>& out_obs)
     {  // Monocular image obs  -------
       if (m_external_images_own_thread)
       {
-        m_csToSaveList.lock();
-
-        // Select the "m_toSaveList" with the shortest pending queue:
-        size_t idx_min = 0;
-        for (size_t i = 0; i < m_toSaveList.size(); ++i)
-          if (m_toSaveList[i].size() < m_toSaveList[idx_min].size()) idx_min = i;
-
-        // Insert:
-        m_toSaveList[idx_min].insert(TListObsPair(obs->timestamp, obs));
-
-        m_csToSaveList.unlock();
+        enqueueForAsyncSave(obs->timestamp, obs);
         delayed_insertion_in_obs_queue = true;
       }
       else
@@ -1468,6 +1454,56 @@ void mrpt::hwdrivers::readConfigIntoVideoSourcePanel(
 /* -----------------------------------------------------
     THREAD: Saver of external images
    ----------------------------------------------------- */
+void CCameraSensor::enqueueForAsyncSave(
+    const mrpt::system::TTimeStamp& ts, const mrpt::serialization::CSerializable::Ptr& obs)
+{
+  std::lock_guard<std::mutex> lck(m_csToSaveList);
+
+  // Select the "m_toSaveList" with the shortest pending queue:
+  size_t idx_min = 0;
+  for (size_t i = 0; i < m_toSaveList.size(); ++i)
+    if (m_toSaveList[i].size() < m_toSaveList[idx_min].size()) idx_min = i;
+
+  // Insert:
+  m_toSaveList[idx_min].insert(TListObsPair(ts, obs));
+  m_statFramesEnqueued++;
+
+  // Enforce the drop-oldest bound over the aggregated queues, so a slow
+  // disk turns into dropped frames instead of unbounded memory growth:
+  if (!m_toSaveList_max_len) return;
+  for (;;)
+  {
+    size_t total = 0, idx_oldest = 0;
+    mrpt::system::TTimeStamp t_oldest = INVALID_TIMESTAMP;
+    for (size_t i = 0; i < m_toSaveList.size(); ++i)
+    {
+      total += m_toSaveList[i].size();
+      if (!m_toSaveList[i].empty() &&
+          (t_oldest == INVALID_TIMESTAMP || m_toSaveList[i].begin()->first < t_oldest))
+      {
+        t_oldest = m_toSaveList[i].begin()->first;
+        idx_oldest = i;
+      }
+    }
+    if (total <= m_toSaveList_max_len) break;
+    m_toSaveList[idx_oldest].erase(m_toSaveList[idx_oldest].begin());
+    m_statFramesDropped++;
+  }
+}
+
+CCameraSensor::TPipelineStats CCameraSensor::getPipelineStats() const
+{
+  TPipelineStats s;
+  s.frames_enqueued = m_statFramesEnqueued;
+  s.frames_saved = m_statFramesSaved;
+  s.frames_dropped = m_statFramesDropped;
+  s.last_grab_latency_sec = m_statLastGrabLatency;
+  s.last_save_latency_sec = m_statLastSaveLatency;
+  std::lock_guard<std::mutex> lck(m_csToSaveList);
+  for (const auto& q : m_toSaveList) s.cur_queue_len += q.size();
+  return s;
+}
+
 void CCameraSensor::thread_save_images(unsigned int my_working_thread_index)
 {
   while (!m_threadImagesSaverShouldEnd)
@@ -1562,6 +1598,8 @@ void CCameraSensor::thread_save_images(unsigned int my_working_thread_index)
 
       // Append now:
       appendObservation(i->second);
+      m_statFramesSaved++;
+      m_statLastSaveLatency = mrpt::Clock::nowDouble() - mrpt::Clock::toDouble(i->first);
     }
 
     std::this_thread::sleep_for(2ms);
@@ -13,7 +13,10 @@
 #include <mrpt/system/filesystem.h>
 #include <mrpt/system/os.h>
 
+#include <array>
+#include <cstring>
 #include <iostream>
+#include <string_view>
 
 using namespace mrpt::hwdrivers;
 using namespace mrpt::obs;
@@ -22,6 +25,59 @@ using namespace std;
 
 const size_t MAX_NMEA_LINE_LENGTH = 1024;
 
+// Upper bound of fields in any recognized sentence (GSA has 18 + checksum):
+const size_t MAX_NMEA_TOKENS = 32;
+
+// ----- Allocation-free helpers over string views of one sentence -----
+namespace
+{
+std::string_view sv_trim(std::string_view sv)
+{
+  while (!sv.empty() && (sv.front() == ' ' || sv.front() == '\t')) sv.remove_prefix(1);
+  while (!sv.empty() && (sv.back() == ' ' || sv.back() == '\t')) sv.remove_suffix(1);
+  return sv;
+}
+
+/** Like atof() over a (non NUL-terminated) view; NMEA fields are short, so a
+ * stack copy suffices. */
+double sv_atof(std::string_view sv)
+{
+  char tmp[32];
+  const size_t n = std::min(sv.size(), sizeof(tmp) - 1);
+  std::memcpy(tmp, sv.data(), n);
+  tmp[n] = '\0';
+  return ::atof(tmp);
+}
+
+int sv_atoi(std::string_view sv)
+{
+  char tmp[16];
+  const size_t n = std::min(sv.size(), sizeof(tmp) - 1);
+  std::memcpy(tmp, sv.data(), n);
+  tmp[n] = '\0';
+  return ::atoi(tmp);
+}
+
+/** Splits the sentence at any of "*,\t\r\n" into trimmed views (blank tokens
+ * are kept, as field positions are meaningful in NMEA).
+ * \return The number of tokens found (clipped to the array size). */
+size_t sv_tokenize(std::string_view s, std::array<std::string_view, MAX_NMEA_TOKENS>& toks)
+{
+  size_t nTokens = 0, tokenStart = 0;
+  for (size_t i = 0; i <= s.size(); i++)
+  {
+    const char c = (i < s.size()) ? s[i] : ',';  // virtual trailing delimiter
+    if (i == s.size() || c == '*' || c == ',' || c == '\t' || c == '\r' || c == '\n')
+    {
+      if (nTokens >= toks.size()) break;
+      toks[nTokens++] = sv_trim(s.substr(tokenStart, i - tokenStart));
+      tokenStart = i + 1;
+    }
+  }
+  return nTokens;
+}
+}  // namespace
+
 bool CGPSInterface::implement_parser_NMEA(size_t& out_minimum_rx_buf_to_decide)
 {
   out_minimum_rx_buf_to_decide = 3;
@@ -54,8 +110,11 @@ bool CGPSInterface::implement_parser_NMEA(size_t& out_minimum_rx_buf_to_decide)
   // Not the start of a NMEA string, skip 1 char:
   if (!recognized) return false;
 
-  // It starts OK: try to find the end of the line
-  std::string line;
+  // It starts OK: try to find the end of the line.
+  // The sentence is extracted into a fixed stack buffer: no heap allocation
+  // in the driver thread hot path.
+  char line[MAX_NMEA_LINE_LENGTH];
+  size_t lineLen = 0;
   bool line_is_ended = false;
   for (size_t i = 0; i < nBytesAval && i < MAX_NMEA_LINE_LENGTH; i++)
   {
@@ -65,16 +124,18 @@ bool CGPSInterface::implement_parser_NMEA(size_t& out_minimum_rx_buf_to_decide)
       line_is_ended = true;
       break;
     }
-    line.push_back(val);
+    line[lineLen++] = val;
   }
   if (line_is_ended)
   {
     // Pop from buffer:
-    for (size_t i = 0; i < line.size(); i++) m_rx_buffer.pop();
+    for (size_t i = 0; i < lineLen; i++) m_rx_buffer.pop();
+
+    const std::string_view lineView(line, lineLen);
 
     // Parse:
     const bool did_have_gga = m_parsed_messages->has_GGA_datum();
-    if (CGPSInterface::parse_NMEA(line, *m_parsed_messages, false /*verbose*/))
+    if (CGPSInterface::parse_NMEA(lineView, *m_parsed_messages, false /*verbose*/))
     {
       // Parsers must set only the part of the msg type:
       m_parsed_messages->sensorLabel = "NMEA";
@@ -83,7 +144,7 @@ bool CGPSInterface::implement_parser_NMEA(size_t& out_minimum_rx_buf_to_decide)
       const bool now_has_gga = m_parsed_messages->has_GGA_datum();
       if (now_has_gga && !did_have_gga)
       {
-        m_last_GGA = line;
+        m_last_GGA.assign(lineView);
       }
     }
     else
@@ -91,7 +152,7 @@ bool CGPSInterface::implement_parser_NMEA(size_t& out_minimum_rx_buf_to_decide)
       if (m_verbose)
         std::cerr << "[CGPSInterface::implement_parser_NMEA] Line "
                      "of unknown format ignored: `"
-                  << line << "`\n";
+                  << lineView << "`\n";
     }
     return true;
   }
@@ -107,7 +168,7 @@ bool CGPSInterface::implement_parser_NMEA(size_t& out_minimum_rx_buf_to_decide)
           parse_NMEA
 ----------------------------------------------------- */
 bool CGPSInterface::parse_NMEA(
-    const std::string& s, mrpt::obs::CObservationGPS& out_obs, const bool verbose)
+    const std::string_view& s, mrpt::obs::CObservationGPS& out_obs, const bool verbose)
 {
   static mrpt::system::TTimeStamp last_known_date =
       mrpt::Clock::now();  // For building complete date+time in msgs without
@@ -120,11 +181,9 @@ bool CGPSInterface::parse_NMEA(
   if (s.size() < 7) return false;
   if (s[0] != '$') return false;
 
-  std::vector<std::string> lstTokens;
-  mrpt::system::tokenize(s, "*,\t\r\n", lstTokens, false /* do not skip blank tokens */);
-  if (lstTokens.size() < 3) return false;
-
-  for (auto& lstToken : lstTokens) lstToken = mrpt::system::trim(lstToken);  // Trim whitespaces
+  std::array<std::string_view, MAX_NMEA_TOKENS> lstTokens;
+  const size_t nTokens = sv_tokenize(s, lstTokens);
+  if (nTokens < 3) return false;
 
   bool parsed_ok = false;
 
@@ -132,13 +191,13 @@ bool CGPSInterface::parse_NMEA(
   if (lstTokens[0].size() > 3) lstTokens[0] = lstTokens[0].substr(3);
 
   // Try to determine the kind of command:
-  if (lstTokens[0] == "GGA" && lstTokens.size() >= 13)
+  if (lstTokens[0] == "GGA" && nTokens >= 13)
   {
     // ---------------------------------------------
     //					GGA
     // ---------------------------------------------
     bool all_fields_ok = true;
-    std::string token;
+    std::string_view token;
 
     // Fill out the output structure:
     gnss::Message_NMEA_GGA gga;
@@ -149,7 +208,7 @@ bool CGPSInterface::parse_NMEA(
     {
       gga.fields.UTCTime.hour = 10 * (token[0] - '0') + token[1] - '0';
       gga.fields.UTCTime.minute = 10 * (token[2] - '0') + token[3] - '0';
-      gga.fields.UTCTime.sec = atof(&(token.c_str()[4]));
+      gga.fields.UTCTime.sec = sv_atof(token.substr(4));
     }
     else
       all_fields_ok = false;
@@ -159,7 +218,7 @@ bool CGPSInterface::parse_NMEA(
     if (token.size() >= 4)
     {
       double lat = 10 * (token[0] - '0') + token[1] - '0';
-      lat += atof(&(token.c_str()[2])) / 60.0;
+      lat += sv_atof(token.substr(2)) / 60.0;
       gga.fields.latitude_degrees = lat;
     }
     else
@@ -177,7 +236,7 @@ bool CGPSInterface::parse_NMEA(
     if (token.size() >= 5)
     {
       double lat = 100 * (token[0] - '0') + 10 * (token[1] - '0') + token[2] - '0';
-      lat += atof(&(token.c_str()[3])) / 60.0;
+      lat += sv_atof(token.substr(3)) / 60.0;
       gga.fields.longitude_degrees = lat;
     }
     else
@@ -192,17 +251,17 @@ bool CGPSInterface::parse_NMEA(
 
     // fix quality:
     token = lstTokens[6];
-    if (!token.empty()) gga.fields.fix_quality = (unsigned char)atoi(token.c_str());
+    if (!token.empty()) gga.fields.fix_quality = (unsigned char)sv_atoi(token);
 
     // sats:
     token = lstTokens[7];
-    if (!token.empty()) gga.fields.satellitesUsed = (unsigned char)atoi(token.c_str());
+    if (!token.empty()) gga.fields.satellitesUsed = (unsigned char)sv_atoi(token);
 
     // HDOP:
     token = lstTokens[8];
     if (!token.empty())
     {
-      gga.fields.HDOP = (float)atof(token.c_str());
+      gga.fields.HDOP = (float)sv_atof(token);
       gga.fields.thereis_HDOP = true;
     }
 
@@ -211,7 +270,7 @@ bool CGPSInterface::parse_NMEA(
     if (token.empty())
       all_fields_ok = false;
     else
-      gga.fields.altitude_meters = atof(token.c_str());
+      gga.fields.altitude_meters = sv_atof(token);
 
     // Units of the altitude:
     //		token = lstTokens[10];
@@ -219,7 +278,7 @@ bool CGPSInterface::parse_NMEA(
 
     // Geoidal separation [B] (undulation)
     token = lstTokens[11];
-    if (!token.empty()) gga.fields.geoidal_distance = atof(token.c_str());
+    if (!token.empty()) gga.fields.geoidal_distance = sv_atof(token);
 
     // Units of the geoidal separation:
     //		token = lstTokens[12];
@@ -239,13 +298,13 @@ bool CGPSInterface::parse_NMEA(
     }
     parsed_ok = all_fields_ok;
   }
-  else if (lstTokens[0] == "RMC" && lstTokens.size() >= 13)
+  else if (lstTokens[0] == "RMC" && nTokens >= 13)
   {
     // ---------------------------------------------
     //					GPRMC
     // ---------------------------------------------
     bool all_fields_ok = true;
-    std::string token;
+    std::string_view token;
 
     // Fill out the output structure:
     gnss::Message_NMEA_RMC rmc;
@@ -256,7 +315,7 @@ bool CGPSInterface::parse_NMEA(
     {
       rmc.fields.UTCTime.hour = 10 * (token[0] - '0') + token[1] - '0';
       rmc.fields.UTCTime.minute = 10 * (token[2] - '0') + token[3] - '0';
-      rmc.fields.UTCTime.sec = atof(&(token.c_str()[4]));
+      rmc.fields.UTCTime.sec = sv_atof(token.substr(4));
     }
     else
       all_fields_ok = false;
@@ -266,14 +325,14 @@ bool CGPSInterface::parse_NMEA(
     if (token.empty())
       all_fields_ok = false;
     else
-      rmc.fields.validity_char = token.c_str()[0];
+      rmc.fields.validity_char = token[0];
 
     // Latitude:
     token = lstTokens[3];
     if (token.size() >= 4)
     {
       double lat = 10 * (token[0] - '0') + token[1] - '0';
-      lat += atof(&(token.c_str()[2])) / 60.0;
+      lat += sv_atof(token.substr(2)) / 60.0;
       rmc.fields.latitude_degrees = lat;
     }
     else
@@ -291,7 +350,7 @@ bool CGPSInterface::parse_NMEA(
     if (token.size() >= 5)
     {
       double lat = 100 * (token[0] - '0') + 10 * (token[1] - '0') + token[2] - '0';
-      lat += atof(&(token.c_str()[3])) / 60.0;
+      lat += sv_atof(token.substr(3)) / 60.0;
       rmc.fields.longitude_degrees = lat;
     }
     else
@@ -306,11 +365,11 @@ bool CGPSInterface::parse_NMEA(
 
     // Speed:
     token = lstTokens[7];
-    if (!token.empty()) rmc.fields.speed_knots = atof(token.c_str());
+    if (!token.empty()) rmc.fields.speed_knots = sv_atof(token);
 
     // Direction:
     token = lstTokens[8];
-    if (!token.empty()) rmc.fields.direction_degrees = atof(token.c_str());
+    if (!token.empty()) rmc.fields.direction_degrees = sv_atof(token);
 
     // Date:
     token = lstTokens[9];
@@ -318,7 +377,7 @@ bool CGPSInterface::parse_NMEA(
     {
       rmc.fields.date_day = 10 * (token[0] - '0') + token[1] - '0';
       rmc.fields.date_month = 10 * (token[2] - '0') + token[3] - '0';
-      rmc.fields.date_year = atoi(&(token.c_str()[4]));
+      rmc.fields.date_year = sv_atoi(token.substr(4));
     }
     else
       all_fields_ok = false;
@@ -327,7 +386,7 @@ bool CGPSInterface::parse_NMEA(
     token = lstTokens[10];
     if (token.size() >= 2)
     {
-      rmc.fields.magnetic_dir = atof(token.c_str());
+      rmc.fields.magnetic_dir = sv_atof(token);
       // E/W:
       token = lstTokens[11];
       if (token.empty())
@@ -337,14 +396,14 @@ bool CGPSInterface::parse_NMEA(
     }
 
     // Mode ind.
-    if (lstTokens.size() >= 14)
+    if (nTokens >= 14)
     {
       // Only for NMEA 2.3
       token = lstTokens[12];
       if (token.empty())
         all_fields_ok = false;
       else
-        rmc.fields.positioning_mode = token.c_str()[0];
+        rmc.fields.positioning_mode = token[0];
     }
     else
       rmc.fields.positioning_mode = 'A';  // Default for older receiver
@@ -360,13 +419,13 @@ bool CGPSInterface::parse_NMEA(
     }
     parsed_ok = all_fields_ok;
   }
-  else if (lstTokens[0] == "GLL" && lstTokens.size() >= 5)
+  else if (lstTokens[0] == "GLL" && nTokens >= 5)
   {
     // ---------------------------------------------
     //					GPGLL
     // ---------------------------------------------
     bool all_fields_ok = true;
-    std::string token;
+    std::string_view token;
 
     // Fill out the output structure:
     gnss::Message_NMEA_GLL gll;
@@ -375,7 +434,7 @@ bool CGPSInterface::parse_NMEA(
     if (token.size() >= 4)
     {
       double lat = 10 * (token[0] - '0') + token[1] - '0';
-      lat += atof(&(token.c_str()[2])) / 60.0;
+      lat += sv_atof(token.substr(2)) / 60.0;
       gll.fields.latitude_degrees = lat;
     }
     else
@@ -393,7 +452,7 @@ bool CGPSInterface::parse_NMEA(
     if (token.size() >= 5)
     {
       double lat = 100 * (token[0] - '0') + 10 * (token[1] - '0') + token[2] - '0';
-      lat += atof(&(token.c_str()[3])) / 60.0;
+      lat += sv_atof(token.substr(3)) / 60.0;
       gll.fields.longitude_degrees = lat;
     }
     else
@@ -406,7 +465,7 @@ bool CGPSInterface::parse_NMEA(
     else if (token[0] == 'W')
       gll.fields.longitude_degrees = -gll.fields.longitude_degrees;
 
-    if (lstTokens.size() >= 7)
+    if (nTokens >= 7)
     {
       // Time:
       token = lstTokens[5];
@@ -414,7 +473,7 @@ bool CGPSInterface::parse_NMEA(
       {
         gll.fields.UTCTime.hour = 10 * (token[0] - '0') + token[1] - '0';
         gll.fields.UTCTime.minute = 10 * (token[2] - '0') + token[3] - '0';
-        gll.fields.UTCTime.sec = atof(&(token.c_str()[4]));
+        gll.fields.UTCTime.sec = sv_atof(token.substr(4));
       }
       else
         all_fields_ok = false;
@@ -424,7 +483,7 @@ bool CGPSInterface::parse_NMEA(
       if (token.empty())
         all_fields_ok = false;
       else
-        gll.fields.validity_char = token.c_str()[0];
+        gll.fields.validity_char = token[0];
     }
 
     if (all_fields_ok)
@@ -437,21 +496,20 @@ bool CGPSInterface::parse_NMEA(
     }
     parsed_ok = all_fields_ok;
   }
-  else if (lstTokens[0] == "VTG" && lstTokens.size() >= 9)
+  else if (lstTokens[0] == "VTG" && nTokens >= 9)
   {
     // ---------------------------------------------
     //					GPVTG
     // ---------------------------------------------
     bool all_fields_ok = true;
-    std::string token;
 
     // Fill out the output structure:
     gnss::Message_NMEA_VTG vtg;
 
-    vtg.fields.true_track = atof(lstTokens[1].c_str());
-    vtg.fields.magnetic_track = atof(lstTokens[3].c_str());
-    vtg.fields.ground_speed_knots = atof(lstTokens[5].c_str());
-    vtg.fields.ground_speed_kmh = atof(lstTokens[7].c_str());
+    vtg.fields.true_track = sv_atof(lstTokens[1]);
+    vtg.fields.magnetic_track = sv_atof(lstTokens[3]);
+    vtg.fields.ground_speed_knots = sv_atof(lstTokens[5]);
+    vtg.fields.ground_speed_kmh = sv_atof(lstTokens[7]);
 
     if (lstTokens[2] != "T" || lstTokens[4] != "M" || lstTokens[6] != "N" || lstTokens[8] != "K")
       all_fields_ok = false;
@@ -465,13 +523,13 @@ bool CGPSInterface::parse_NMEA(
     }
     parsed_ok = all_fields_ok;
   }
-  else if (lstTokens[0] == "ZDA" && lstTokens.size() >= 5)
+  else if (lstTokens[0] == "ZDA" && nTokens >= 5)
   {
     // ---------------------------------------------
     //					GPZDA
     // ---------------------------------------------
     bool all_fields_ok = true;
-    std::string token;
+    std::string_view token;
 
     // Fill out the output structure:
     gnss::Message_NMEA_ZDA zda;
@@ -489,20 +547,20 @@ bool CGPSInterface::parse_NMEA(
     {
       zda.fields.UTCTime.hour = 10 * (token[0] - '0') + token[1] - '0';
       zda.fields.UTCTime.minute = 10 * (token[2] - '0') + token[3] - '0';
-      zda.fields.UTCTime.sec = atof(&(token.c_str()[4]));
+      zda.fields.UTCTime.sec = sv_atof(token.substr(4));
     }
     else
       all_fields_ok = false;
 
     // Day:
     token = lstTokens[2];
-    if (!token.empty()) zda.fields.date_day = atoi(token.c_str());
+    if (!token.empty()) zda.fields.date_day = sv_atoi(token);
     // Month:
     token = lstTokens[3];
-    if (!token.empty()) zda.fields.date_month = atoi(token.c_str());
+    if (!token.empty()) zda.fields.date_month = sv_atoi(token);
     // Year:
     token = lstTokens[4];
-    if (!token.empty()) zda.fields.date_year = atoi(token.c_str());
+    if (!token.empty()) zda.fields.date_year = sv_atoi(token);
 
     if (all_fields_ok)
     {
@@ -523,13 +581,13 @@ bool CGPSInterface::parse_NMEA(
     }
     parsed_ok = all_fields_ok;
   }
-  else if (lstTokens[0] == "GSA" && lstTokens.size() >= 18)
+  else if (lstTokens[0] == "GSA" && nTokens >= 18)
   {
     // ---------------------------------------------
     //					GSA
     // ---------------------------------------------
     bool all_fields_ok = true;
-    std::string token;
+    std::string_view token;
 
     // Fill out the output structure:
     gnss::Message_NMEA_GSA gsa;
@@ -564,9 +622,9 @@ bool CGPSInterface::parse_NMEA(
       if (token.size() > 1) gsa.fields.PRNs[i][1] = token[1];
     }
     // PDOP:
-    gsa.fields.PDOP = ::atof(lstTokens[3 + 12 + 0].data());
-    gsa.fields.HDOP = ::atof(lstTokens[3 + 12 + 1].data());
-    gsa.fields.VDOP = ::atof(lstTokens[3 + 12 + 2].data());
+    gsa.fields.PDOP = sv_atof(lstTokens[3 + 12 + 0]);
+    gsa.fields.HDOP = sv_atof(lstTokens[3 + 12 + 1]);
+    gsa.fields.VDOP = sv_atof(lstTokens[3 + 12 + 2]);
 
     if (all_fields_ok)
     {
@@ -31,11 +31,7 @@ CGenericSensor::CGenericSensor()
 /*-------------------------------------------------------------
             Destructor
 -------------------------------------------------------------*/
-CGenericSensor::~CGenericSensor()
-{
-  // Free objects in list, if any:
-  m_objList.clear();
-}
+CGenericSensor::~CGenericSensor() = default;
 
 /*-------------------------------------------------------------
             appendObservations
@@ -47,7 +43,11 @@ void CGenericSensor::appendObservations(
   {
     m_grab_decimation_counter = 0;
 
-    std::lock_guard<std::mutex> lock(m_csObjList);
+    // The whole batch is built locally, then published to the consumer
+    // with one lock-free push, so this driver thread never blocks on
+    // getObservations():
+    std::vector<TListObsPair> batch;
+    batch.reserve(objs.size());
 
     for (const auto& obj : objs)
     {
@@ -65,11 +65,15 @@ void CGenericSensor::appendObservations(
         timestamp = dynamic_cast<CObservation*>(obj.get())->timestamp;
       }
       else
+      {
         THROW_EXCEPTION("Passed object must be CObservation.");
+      }
 
       // Add it:
-      m_objList.insert(TListObsPair(timestamp, obj));
+      batch.emplace_back(timestamp, obj);
     }
+
+    m_objQueue.push(std::move(batch));
   }
 }
 
@@ -78,10 +82,15 @@ void CGenericSensor::appendObservations(
 -------------------------------------------------------------*/
 CGenericSensor::TListObservations CGenericSensor::getObservations()
 {
-  std::lock_guard<std::mutex> lock(m_csObjList);
-  auto lstObjects = m_objList;
-  m_objList.clear();  // Memory of objects will be freed by invoker.
-  return lstObjects;
+  // Grab all pending batches at once; producers keep pushing onto a fresh
+  // (empty) queue meanwhile:
+  TListObservations lstObjects;
+  m_objQueue.consume_all(
+      [&lstObjects](std::vector<TListObsPair>&& batch)
+      {
+        for (auto& p : batch) lstObjects.insert(std::move(p));
+      });
+  return lstObjects;  // Memory of objects will be freed by invoker.
 }
 
 /*-------------------------------------------------------------
@@ -17,7 +17,9 @@
 #include <mrpt/system/CTimeLogger.h>
 #include <mrpt/system/os.h>
 
+#include <array>
 #include <chrono>
+#include <cstdint>
 #include <thread>
 
 IMPLEMENTS_GENERIC_SENSOR(CHokuyoURG, mrpt::hwdrivers)
@@ -31,6 +33,15 @@ using namespace std;
 
 const int MINIMUM_PACKETS_TO_SET_TIMESTAMP_REFERENCE = 10;
 
+// 6-bit decode LUT for SCIP2.0 ASCII data chars (equivalent to `c - 0x30`
+// for the valid range 0x30-0x6F), for the hot 3-char decode loop:
+static constexpr auto SCIP2_DECODE_LUT = []
+{
+  std::array<int32_t, 256> t{};
+  for (int c = 0; c < 256; c++) t[c] = (c - 0x30) & 0x3f;
+  return t;
+}();
+
 CHokuyoURG::CHokuyoURG() : m_rx_buffer(40000) { m_sensorLabel = "Hokuyo"; }
 
 CHokuyoURG::~CHokuyoURG()
@@ -182,28 +193,28 @@ void CHokuyoURG::doProcessSimple(
   outObservation.sensorLabel = m_sensorLabel;
 
   outObservation.resizeScan(nRanges);
-  char* ptr = (char*)&m_rcv_data[4];
+  const auto* ptr = reinterpret_cast<const uint8_t*>(&m_rcv_data[4]);
 
   if (m_intensity) outObservation.setScanHasIntensity(true);
 
+  const float maxRange = outObservation.maxRange;
   for (int i = 0; i < nRanges; i++)
   {
-    int b1 = (*ptr++) - 0x30;
-    int b2 = (*ptr++) - 0x30;
-    int b3 = (*ptr++) - 0x30;
+    const int range_mm =
+        (SCIP2_DECODE_LUT[ptr[0]] << 12) | (SCIP2_DECODE_LUT[ptr[1]] << 6) | SCIP2_DECODE_LUT[ptr[2]];
+    ptr += 3;
 
-    int range_mm = ((b1 << 12) | (b2 << 6) | b3);
-
-    outObservation.setScanRange(i, range_mm * 0.001f);
-    outObservation.setScanRangeValidity(
-        i, range_mm >= 20 && (outObservation.getScanRange(i) <= outObservation.maxRange));
+    const float range_m = range_mm * 0.001f;
+    outObservation.setScanRange(i, range_m);
+    outObservation.setScanRangeValidity(i, range_mm >= 20 && range_m <= maxRange);
 
     if (m_intensity)
     {
-      int b4 = (*ptr++) - 0x30;
-      int b5 = (*ptr++) - 0x30;
-      int b6 = (*ptr++) - 0x30;
-      outObservation.setScanIntensity(i, ((b4 << 12) | (b5 << 6) | b6));
+      outObservation.setScanIntensity(
+          i,
+          (SCIP2_DECODE_LUT[ptr[0]] << 12) | (SCIP2_DECODE_LUT[ptr[1]] << 6) |
+              SCIP2_DECODE_LUT[ptr[2]]);
+      ptr += 3;
     }
   }
 
@@ -217,6 +228,33 @@ void CHokuyoURG::doProcessSimple(
   internal_notifyGoodScanNow();
 }
 
+void CHokuyoURG::doProcess()
+{
+  // Drain every complete scan already waiting in the RX buffer, appending
+  // one observation per scan; the bound just prevents a device streaming
+  // faster than we can process from starving the caller:
+  for (size_t nScans = 0; nScans < 100; nScans++)
+  {
+    bool thereIs = false, hwError = false;
+
+    if (!m_pendingObs) m_pendingObs = CObservation2DRangeScan::Create();
+
+    doProcessSimple(thereIs, *m_pendingObs, hwError);
+
+    if (hwError)
+    {
+      m_state = ssError;
+      MRPT_LOG_THROTTLE_ERROR(5.0, "Error reading from the sensor hardware. Will retry.");
+      return;
+    }
+    if (!thereIs) return;  // no more complete scans pending
+
+    m_state = ssWorking;
+    appendObservation(m_pendingObs);
+    m_pendingObs.reset();  // Create a new object in the next iteration
+  }
+}
+
 /*-------------------------------------------------------------
             loadConfig_sensorSpecific
 -------------------------------------------------------------*/
@@ -525,7 +563,8 @@ bool CHokuyoURG::parseResponse(bool additionalWaitForData)
     //  the read method with only 1 byte each time:
     // -----------------------------------------------------------------------------
     bool lastWasLF = false;
-    std::string tmp_rx;
+    // Decode in-place into m_rcv_data: its capacity persists between calls,
+    // so steady-state scan reception does not allocate at all.
     for (;;)
     {
       if (!ensureBufferHasBytes(peekIdx + 1, additionalWaitForData))
@@ -534,12 +573,12 @@ bool CHokuyoURG::parseResponse(bool additionalWaitForData)
         // data:
         return false;
       }
-      tmp_rx.push_back(m_rx_buffer.peek(peekIdx++));
+      m_rcv_data.push_back(m_rx_buffer.peek(peekIdx++));
 
       // No data?
-      if (tmp_rx.size() == 1 && tmp_rx[0] == 0x0A)
+      if (m_rcv_data.size() == 1 && m_rcv_data[0] == 0x0A)
       {
-        tmp_rx.clear();
+        m_rcv_data.clear();
         m_rcv_status0 = tmp_rcv_status0;
         m_rcv_status1 = tmp_rcv_status1;
         // Empty read bytes so far:
@@ -548,7 +587,7 @@ bool CHokuyoURG::parseResponse(bool additionalWaitForData)
       }
 
       // Is it a LF?
-      if (*tmp_rx.rbegin() != 0x0A)
+      if (*m_rcv_data.rbegin() != 0x0A)
       {
         lastWasLF = false;
         continue;
@@ -558,18 +597,17 @@ bool CHokuyoURG::parseResponse(bool additionalWaitForData)
       if (!lastWasLF)
       {
         // Discard SUM+LF
-        ASSERT_(tmp_rx.size() >= 2);
-        tmp_rx.resize(tmp_rx.size() - 2);
+        ASSERT_(m_rcv_data.size() >= 2);
+        m_rcv_data.resize(m_rcv_data.size() - 2);
       }
       else
       {
         // This was a double LF.
 
         // Discard this last LF:
-        tmp_rx.resize(tmp_rx.size() - 1);
+        m_rcv_data.resize(m_rcv_data.size() - 1);
 
         // Done!
-        m_rcv_data = tmp_rx;
         m_rcv_status0 = tmp_rcv_status0;
         m_rcv_status1 = tmp_rcv_status1;
 
@@ -16,6 +16,9 @@
 #include <mrpt/math/CMatrixFixed.h>
 #include <mrpt/serialization/CSerializable.h>
 
+#include <string>
+#include <vector>
+
 // Forwards decls:
 // clang-format off
 struct _IplImage;
@@ -253,7 +256,9 @@ class CImage : public mrpt::serialization::CSerializable, public CCanvas
 
   /** Scales this image to a new size, interpolating as needed, saving the new
    * image in a different output object, or operating in-place if
-   * `out_img==this`. \sa resize, rotateImage
+   * `out_img==this`. Downsampling to exactly half the size reuses the
+   * SSE2/SSSE3 kernels of scaleHalf() when applicable.
+   * \sa resize, rotateImage
    */
   void scaleImage(
       CImage& out_img,
@@ -401,6 +406,34 @@ class CImage : public mrpt::serialization::CSerializable, public CCanvas
       float biasThisImg = 0,
       float biasInImg = 0) const;
 
+  /** Normalized cross-correlation (NCC) search of a patch inside a window of
+   * this image, for template tracking.
+   *
+   * For every placement of `patch` fully inside the given search window,
+   * out_ncc gets the zero-mean NCC score in [-1,1]: out_ncc(v,u) is the
+   * score of the patch with its top-left corner at pixel
+   * (u_search_ini+u, v_search_ini+v), so the output size is
+   * (v_search_size-patchHeight+1) x (u_search_size-patchWidth+1).
+   *
+   * The correlation numerator runs in the spatial domain for small
+   * problems and through the 2D FFT for large ones, reusing cached
+   * mrpt::math::CFFT2DPlan work tables across calls of the same sizes (the
+   * common case when tracking fixed-size templates). Normalization uses
+   * integral images of the window, making it O(1) per candidate, and the
+   * per-candidate scoring is threaded. Grayscale (1 channel) images only.
+   *
+   *  Note: By default, the search area is the whole (this) image.
+   * \sa cross_correlation_FFT
+   * \note [New in MRPT 2.14.5]
+   */
+  void cross_correlation_NCC(
+      const CImage& patch,
+      math::CMatrixFloat& out_ncc,
+      int u_search_ini = -1,
+      int v_search_ini = -1,
+      int u_search_size = -1,
+      int v_search_size = -1) const;
+
   /** Optimize the brightness range of an image without using histogram
    * Only for one channel images.
    * \sa equalizeHist
@@ -437,13 +470,29 @@ class CImage : public mrpt::serialization::CSerializable, public CCanvas
 
   /** Filter the image with a Median filter with a window size WxW, returning
    * the filtered image in out_img. For inplace operation, set out_img to
-   * this. */
-  void filterMedian(CImage& out_img, int W = 3) const;
+   * this.
+   *
+   * For W=3 and 8-bit grayscale images, an SSE2-optimized kernel is used,
+   * optionally splitting the image into `num_threads` horizontal bands
+   * processed concurrently (`num_threads<=1`: single-threaded).
+   * \note num_threads: [New in MRPT 2.14.5]
+   */
+  void filterMedian(CImage& out_img, int W = 3, unsigned int num_threads = 1) const;
 
   /** Filter the image with a Gaussian filter with a window size WxH,
    * replacing "this" image by the filtered one. For inplace operation, set
-   * out_img to this. */
-  void filterGaussian(CImage& out_img, int W = 3, int H = 3, double sigma = 1.0) const;
+   * out_img to this.
+   *
+   * For W=H=3, sigma<=0 (i.e. OpenCV's "pick sigma from the kernel size"
+   * convention, a binomial [1 2 1]/4 kernel) and 8-bit grayscale images, an
+   * SSE2-optimized separable kernel is used, optionally splitting the image
+   * into `num_threads` horizontal bands processed concurrently
+   * (`num_threads<=1`: single-threaded).
+   * \note num_threads: [New in MRPT 2.14.5]
+   */
+  void filterGaussian(
+      CImage& out_img, int W = 3, int H = 3, double sigma = 1.0, unsigned int num_threads = 1)
+      const;
 
   /** Draw onto this image the detected corners of a chessboard. The length of
    * cornerCoords must be the product of the two check_sizes.
@@ -834,6 +883,31 @@ class CImage : public mrpt::serialization::CSerializable, public CCanvas
    */
   void unload() const noexcept;
 
+  /** Enqueues a list of externally-stored image files (relative paths, as in
+   * setExternalStorage()) to be read and decoded in background threads, so a
+   * posterior lazy load of those images via forceLoad() or any other image
+   * access becomes a cheap cache hit instead of a synchronous decode.
+   * Typical use: a dataset reader prefetches the next few frames while the
+   * current one is being processed.
+   *
+   * Prefetched but never-consumed decodes are kept in a small bounded cache
+   * and silently dropped when it fills up; files that fail to load are also
+   * silently ignored (the error will surface, as usual, on the actual lazy
+   * load). The number of worker threads can be set with the environment
+   * variable `MRPT_IMAGE_PREFETCH_THREADS` (default: 2).
+   * This is a no-op if MRPT was built without OpenCV.
+   *
+   * \sa setExternalStorage, forceLoad, clearExternalImagesPrefetchCache
+   * \note [New in MRPT 2.14.5]
+   */
+  static void prefetchExternalImages(const std::vector<std::string>& external_files);
+
+  /** Discards all decoded images held by the prefetch cache of
+   * prefetchExternalImages() (pending background decodes are left to finish).
+   * \note [New in MRPT 2.14.5]
+   */
+  static void clearExternalImagesPrefetchCache();
+
   /** @}  */
   // ================================================================
 
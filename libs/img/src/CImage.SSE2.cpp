@@ -27,6 +27,9 @@
 #include <mrpt/img/CImage.h>
 #include <mrpt/system/memory.h>
 
+#include <algorithm>
+#include <vector>
+
 #include "CImage.SSEx.h"
 
 /** \addtogroup sse_optimizations
@@ -176,6 +179,181 @@ void image_SSE2_scale_half_smooth_1c8u(
   }
 }
 
+template <bool MemIsAligned>
+void impl_image_SSE2_gaussian_3x3_1c8u(
+    const uint8_t* in,
+    uint8_t* out,
+    int w,
+    int h,
+    size_t step_in,
+    size_t step_out,
+    int row_first,
+    int row_end)
+{
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i round8 = _mm_set1_epi16(8);
+
+  // Output of the vertical pass for one row, 16-bit, with the two ends
+  // replicated so the horizontal pass needs no special border code:
+  std::vector<uint16_t> tmp(w + 2);
+
+  for (int y = row_first; y < row_end; y++)
+  {
+    const uint8_t* rm = in + step_in * static_cast<size_t>(y > 0 ? y - 1 : 0);
+    const uint8_t* rc = in + step_in * static_cast<size_t>(y);
+    const uint8_t* rp = in + step_in * static_cast<size_t>(y + 1 < h ? y + 1 : h - 1);
+
+    // Vertical pass: tmp[1+x] = rm[x] + 2*rc[x] + rp[x]  (max: 1020)
+    int x = 0;
+    for (; x + 16 <= w; x += 16)
+    {
+      const __m128i a = mm_load_si128<MemIsAligned>(reinterpret_cast<const __m128i*>(rm + x));
+      const __m128i b = mm_load_si128<MemIsAligned>(reinterpret_cast<const __m128i*>(rc + x));
+      const __m128i c = mm_load_si128<MemIsAligned>(reinterpret_cast<const __m128i*>(rp + x));
+
+      const __m128i s_lo = _mm_add_epi16(
+          _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(c, zero)),
+          _mm_slli_epi16(_mm_unpacklo_epi8(b, zero), 1));
+      const __m128i s_hi = _mm_add_epi16(
+          _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(c, zero)),
+          _mm_slli_epi16(_mm_unpackhi_epi8(b, zero), 1));
+
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(&tmp[1 + x]), s_lo);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(&tmp[1 + x + 8]), s_hi);
+    }
+    for (; x < w; x++) tmp[1 + x] = static_cast<uint16_t>(rm[x] + 2 * rc[x] + rp[x]);
+    tmp[0] = tmp[1];
+    tmp[w + 1] = tmp[w];
+
+    // Horizontal pass: out[x] = (tmp[x] + 2*tmp[1+x] + tmp[2+x] + 8) / 16
+    uint8_t* o = out + step_out * static_cast<size_t>(y);
+    x = 0;
+    for (; x + 8 <= w; x += 8)
+    {
+      const __m128i l = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&tmp[x]));
+      const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&tmp[x + 1]));
+      const __m128i r = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&tmp[x + 2]));
+
+      __m128i s = _mm_add_epi16(_mm_add_epi16(l, r), _mm_slli_epi16(c, 1));
+      s = _mm_srli_epi16(_mm_add_epi16(s, round8), 4);
+      _mm_storel_epi64(reinterpret_cast<__m128i*>(o + x), _mm_packus_epi16(s, s));
+    }
+    for (; x < w; x++)
+      o[x] = static_cast<uint8_t>((tmp[x] + 2 * tmp[x + 1] + tmp[x + 2] + 8) >> 4);
+  }
+}
+
+/** Separable 3x3 binomial ([1 2 1]/4 per axis) Gaussian filter, with
+ * replicated borders. Rows [row_first,row_end) of the output are computed, so
+ * disjoint row blocks can be processed concurrently on the same image.
+ *  - <b>Input format:</b> uint8_t, 1 channel
+ *  - <b>Output format:</b> uint8_t, 1 channel (may not alias the input)
+ *  - <b>Preconditions:</b> in aligned to 16bytes (faster) or not, step =
+ * k*16 (faster) or not
+ *  - <b>Requires:</b> SSE2
+ *  - <b>Invoked from:</b> mrpt::img::CImage::filterGaussian()
+ */
+void image_SSE2_gaussian_3x3_1c8u(
+    const uint8_t* in,
+    uint8_t* out,
+    int w,
+    int h,
+    size_t step_in,
+    size_t step_out,
+    int row_first,
+    int row_end)
+{
+  if (mrpt::system::is_aligned<16>(in) && is_multiple<16>(step_in))
+    impl_image_SSE2_gaussian_3x3_1c8u<true>(in, out, w, h, step_in, step_out, row_first, row_end);
+  else
+    impl_image_SSE2_gaussian_3x3_1c8u<false>(in, out, w, h, step_in, step_out, row_first, row_end);
+}
+
+// One comparator of the median-of-9 sorting network: (a,b) <- (min,max)
+#define MEDIAN_SORT2(a, b)                    \
+  {                                           \
+    const __m128i t_ = _mm_min_epu8((a), (b)); \
+    (b) = _mm_max_epu8((a), (b));             \
+    (a) = t_;                                 \
+  }
+
+static uint8_t median9(uint8_t v[9])
+{
+  std::nth_element(v, v + 4, v + 9);
+  return v[4];
+}
+
+/** 3x3 median filter, with replicated borders. Rows [row_first,row_end) of
+ * the output are computed, so disjoint row blocks can be processed
+ * concurrently on the same image. The 16-pixel-wide inner loop evaluates the
+ * classic 19-comparator median-of-9 network with epu8 min/max.
+ *  - <b>Input format:</b> uint8_t, 1 channel
+ *  - <b>Output format:</b> uint8_t, 1 channel (may not alias the input)
+ *  - <b>Preconditions:</b> none (unaligned loads)
+ *  - <b>Requires:</b> SSE2
+ *  - <b>Invoked from:</b> mrpt::img::CImage::filterMedian()
+ */
+void image_SSE2_median_3x3_1c8u(
+    const uint8_t* in,
+    uint8_t* out,
+    int w,
+    int h,
+    size_t step_in,
+    size_t step_out,
+    int row_first,
+    int row_end)
+{
+  for (int y = row_first; y < row_end; y++)
+  {
+    const uint8_t* rows[3] = {
+        in + step_in * static_cast<size_t>(y > 0 ? y - 1 : 0),
+        in + step_in * static_cast<size_t>(y),
+        in + step_in * static_cast<size_t>(y + 1 < h ? y + 1 : h - 1)};
+    uint8_t* o = out + step_out * static_cast<size_t>(y);
+
+    // Scalar lambda, used for the border columns and the tail:
+    const auto scalarMedianAt = [&](int x)
+    {
+      const int xm = x > 0 ? x - 1 : 0, xp = x + 1 < w ? x + 1 : w - 1;
+      uint8_t v[9];
+      for (int r = 0; r < 3; r++)
+      {
+        v[3 * r + 0] = rows[r][xm];
+        v[3 * r + 1] = rows[r][x];
+        v[3 * r + 2] = rows[r][xp];
+      }
+      o[x] = median9(v);
+    };
+
+    scalarMedianAt(0);
+
+    int x = 1;
+    for (; x + 16 <= w - 1; x += 16)
+    {
+      __m128i p[9];
+      for (int r = 0; r < 3; r++)
+      {
+        p[3 * r + 0] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows[r] + x - 1));
+        p[3 * r + 1] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows[r] + x));
+        p[3 * r + 2] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows[r] + x + 1));
+      }
+      // clang-format off
+      MEDIAN_SORT2(p[1], p[2]); MEDIAN_SORT2(p[4], p[5]); MEDIAN_SORT2(p[7], p[8]);
+      MEDIAN_SORT2(p[0], p[1]); MEDIAN_SORT2(p[3], p[4]); MEDIAN_SORT2(p[6], p[7]);
+      MEDIAN_SORT2(p[1], p[2]); MEDIAN_SORT2(p[4], p[5]); MEDIAN_SORT2(p[7], p[8]);
+      MEDIAN_SORT2(p[0], p[3]); MEDIAN_SORT2(p[5], p[8]); MEDIAN_SORT2(p[4], p[7]);
+      MEDIAN_SORT2(p[3], p[6]); MEDIAN_SORT2(p[1], p[4]); MEDIAN_SORT2(p[2], p[5]);
+      MEDIAN_SORT2(p[4], p[7]); MEDIAN_SORT2(p[4], p[2]); MEDIAN_SORT2(p[6], p[4]);
+      MEDIAN_SORT2(p[4], p[2]);
+      // clang-format on
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(o + x), p[4]);
+    }
+    for (; x < w; x++) scalarMedianAt(x);
+  }
+}
+
+#undef MEDIAN_SORT2
+
 // TODO:
 // Sum of absolute differences: Use  _mm_sad_epu8
 
@@ -25,3 +25,9 @@ void image_SSSE3_rgb_to_gray_8u(
     const uint8_t* in, uint8_t* out, int w, int h, size_t in_step, size_t out_step);
 void image_SSSE3_bgr_to_gray_8u(
     const uint8_t* in, uint8_t* out, int w, int h, size_t in_step, size_t out_step);
+void image_SSE2_gaussian_3x3_1c8u(
+    const uint8_t* in, uint8_t* out, int w, int h, size_t in_step, size_t out_step, int row_first,
+    int row_end);
+void image_SSE2_median_3x3_1c8u(
+    const uint8_t* in, uint8_t* out, int w, int h, size_t in_step, size_t out_step, int row_first,
+    int row_end);
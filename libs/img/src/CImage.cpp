@@ -27,7 +27,13 @@
 #include <mrpt/system/filesystem.h>
 #include <mrpt/system/memory.h>
 
+#include <condition_variable>
+#include <deque>
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
 
 // Universal include for all versions of OpenCV
 #include <mrpt/3rdparty/do_opencv_includes.h>
@@ -92,6 +98,142 @@ int interpolationMethod2Cv(TInterpolationMethod i)
   // clang-format on
   return -1;
 }
+
+/** Runs `kernel(row_first, row_end)` over [0,rows), split into one contiguous
+ * band per thread. The filtering kernels clamp their own vertical borders, so
+ * the bands are fully independent. */
+template <class KERNEL>
+void launchRowBandedKernel(const KERNEL& kernel, int rows, unsigned int num_threads)
+{
+  if (num_threads <= 1 || rows < static_cast<int>(2 * num_threads))
+  {
+    kernel(0, rows);
+    return;
+  }
+  std::vector<std::thread> threads;
+  threads.reserve(num_threads);
+  for (unsigned int b = 0; b < num_threads; b++)
+  {
+    const int r0 = (rows * b) / num_threads;
+    const int r1 = (rows * (b + 1)) / num_threads;
+    threads.emplace_back([=, &kernel] { kernel(r0, r1); });
+  }
+  for (auto& t : threads) t.join();
+}
+
+/** Background decode-ahead pool for externally-stored images, shared by all
+ * CImage instances (see CImage::prefetchExternalImages()). Workers read and
+ * decode files exactly as CImage::loadFromFile() does (OpenCV imdecode, which
+ * uses libjpeg-turbo/libpng underneath when available), and park the resulting
+ * cv::Mat in a small bounded cache keyed by absolute path, from where
+ * makeSureImageIsLoaded() can steal it without touching the codec again.
+ */
+class ImagePrefetcher
+{
+ public:
+  static ImagePrefetcher& Instance()
+  {
+    static ImagePrefetcher o;
+    return o;
+  }
+
+  void enqueue(const std::vector<std::string>& externalFiles)
+  {
+    {
+      std::lock_guard<std::mutex> lck(m_mtx);
+      launchWorkers();
+      for (const auto& f : externalFiles)
+      {
+        const std::string absPath = mrpt::io::lazy_load_absolute_path(f);
+        // Skip files already decoded or being decoded:
+        if (m_done.count(absPath) != 0 || m_inFlight.count(absPath) != 0) continue;
+        m_inFlight.insert(absPath);
+        m_pending.push_back(absPath);
+      }
+    }
+    m_cv.notify_all();
+  }
+
+  /** If absPath was prefetched and its decode has finished, moves the decoded
+   * image into `out` (removing it from the cache) and returns true. */
+  bool consume(const std::string& absPath, cv::Mat& out)
+  {
+    std::lock_guard<std::mutex> lck(m_mtx);
+    auto it = m_done.find(absPath);
+    if (it == m_done.end()) return false;
+    out = std::move(it->second);
+    m_done.erase(it);
+    return true;
+  }
+
+  void clearCache()
+  {
+    std::lock_guard<std::mutex> lck(m_mtx);
+    m_done.clear();
+  }
+
+  ~ImagePrefetcher()
+  {
+    {
+      std::lock_guard<std::mutex> lck(m_mtx);
+      m_stop = true;
+    }
+    m_cv.notify_all();
+    for (auto& t : m_threads)
+      if (t.joinable()) t.join();
+  }
+
+ private:
+  ImagePrefetcher() = default;
+
+  // Keep never-consumed decodes bounded (a dropped entry just means a normal
+  // synchronous load later on):
+  constexpr static size_t MAX_CACHED_IMAGES = 64;
+
+  void launchWorkers()  // m_mtx must be held
+  {
+    if (!m_threads.empty()) return;
+    const int n = std::max(1, mrpt::get_env<int>("MRPT_IMAGE_PREFETCH_THREADS", 2));
+    for (int i = 0; i < n; i++) m_threads.emplace_back([this] { workerLoop(); });
+  }
+
+  void workerLoop()
+  {
+    for (;;)
+    {
+      std::string absPath;
+      {
+        std::unique_lock<std::mutex> lck(m_mtx);
+        m_cv.wait(lck, [this] { return m_stop || !m_pending.empty(); });
+        if (m_stop) return;
+        absPath = std::move(m_pending.front());
+        m_pending.pop_front();
+      }
+
+      // Decode outside the lock, mirroring CImage::loadFromFile():
+      cv::Mat img;
+      std::vector<uint8_t> fileData;
+      if (mrpt::io::loadBinaryFile(fileData, absPath))
+      {
+        const cv::Mat data(fileData.size(), 1, CV_8UC1, fileData.data());
+        img = cv::imdecode(data, -1 /*as-is*/);
+      }
+
+      std::lock_guard<std::mutex> lck(m_mtx);
+      m_inFlight.erase(absPath);
+      if (!img.empty() && m_done.size() < MAX_CACHED_IMAGES) m_done.emplace(absPath, std::move(img));
+    }
+  }
+
+  std::mutex m_mtx;
+  std::condition_variable m_cv;
+  std::vector<std::thread> m_threads;
+  std::deque<std::string> m_pending;
+  std::set<std::string> m_inFlight;
+  std::map<std::string, cv::Mat> m_done;
+  bool m_stop = false;
+};
+
 }  // namespace
 
 template <typename RET = uint32_t>
@@ -628,11 +770,20 @@ void CImage::serializeFrom(mrpt::serialization::CArchive& in, uint8_t version)
       // Version 1: High quality JPEG image
       uint32_t nBytes;
       in >> nBytes;
-      std::vector<uint8_t> buf(nBytes);
-      in.ReadBuffer(buf.data(), nBytes);
 
       mrpt::io::CMemoryStream aux;
-      aux.assignMemoryNotOwn(buf.data(), buf.size());
+      std::vector<uint8_t> buf;  // backing storage for the copying path
+      if (const uint8_t* p = in.ReadBufferBorrow(nBytes); p)
+      {
+        // Zero-copy: decode straight from the archive's own buffer.
+        aux.assignMemoryNotOwn(p, nBytes);
+      }
+      else
+      {
+        buf.resize(nBytes);
+        in.ReadBuffer(buf.data(), nBytes);
+        aux.assignMemoryNotOwn(buf.data(), buf.size());
+      }
       aux.Seek(0);
       loadFromStreamAsJPEG(aux);
     }
@@ -766,11 +917,19 @@ void CImage::serializeFrom(mrpt::serialization::CArchive& in, uint8_t version)
             uint32_t nBytes;
             in >> nBytes;
 
-            std::vector<uint8_t> buf(nBytes);
-            in.ReadBuffer(buf.data(), nBytes);
-
             mrpt::io::CMemoryStream aux;
-            aux.assignMemoryNotOwn(buf.data(), buf.size());
+            std::vector<uint8_t> buf;  // backing storage for the copying path
+            if (const uint8_t* p = in.ReadBufferBorrow(nBytes); p)
+            {
+              // Zero-copy: decode straight from the archive's own buffer.
+              aux.assignMemoryNotOwn(p, nBytes);
+            }
+            else
+            {
+              buf.resize(nBytes);
+              in.ReadBuffer(buf.data(), nBytes);
+              aux.assignMemoryNotOwn(buf.data(), buf.size());
+            }
             aux.Seek(0);
 
             loadFromStreamAsJPEG(aux);
@@ -1546,6 +1705,176 @@ void CImage::cross_correlation_FFT(
   MRPT_END
 }
 
+void CImage::cross_correlation_NCC(
+    const CImage& patch,
+    CMatrixFloat& out_ncc,
+    int u_search_ini,
+    int v_search_ini,
+    int u_search_size,
+    int v_search_size) const
+{
+  MRPT_START
+
+  makeSureImageIsLoaded();  // For delayed loaded images stored externally
+  patch.makeSureImageIsLoaded();
+  ASSERTMSG_(!isColor() && !patch.isColor(), "Only grayscale (1 channel) images are supported");
+
+  // Set limits:
+  if (u_search_ini == -1) u_search_ini = 0;
+  if (v_search_ini == -1) v_search_ini = 0;
+  if (u_search_size == -1) u_search_size = static_cast<int>(getWidth()) - u_search_ini;
+  if (v_search_size == -1) v_search_size = static_cast<int>(getHeight()) - v_search_ini;
+
+  const int W = u_search_size, H = v_search_size;
+  const int w = static_cast<int>(patch.getWidth()), h = static_cast<int>(patch.getHeight());
+
+  ASSERT_(u_search_ini + W <= static_cast<int>(getWidth()));
+  ASSERT_(v_search_ini + H <= static_cast<int>(getHeight()));
+  ASSERT_(w <= W && h <= H);
+
+  // Window and patch as float matrices (raw [0,255] pixel values):
+  CMatrixFloat win, pat;
+  getAsMatrix(
+      win, true, u_search_ini, v_search_ini, u_search_ini + W - 1, v_search_ini + H - 1,
+      false /*normalize_01*/);
+  patch.getAsMatrix(pat, true, 0, 0, -1, -1, false /*normalize_01*/);
+
+  // Zero-mean patch and its energy. Since sum(p-mean)=0, correlating the
+  // window against the zero-mean patch directly yields the NCC numerator
+  // sum((win-winMean)*(p-mean)):
+  double pMean = 0;
+  for (int y = 0; y < h; y++)
+    for (int x = 0; x < w; x++) pMean += pat(y, x);
+  pMean /= (double(w) * h);
+
+  double pEnergy = 0;
+  for (int y = 0; y < h; y++)
+    for (int x = 0; x < w; x++)
+    {
+      const double d = pat(y, x) - pMean;
+      pat(y, x) = d2f(d);
+      pEnergy += d * d;
+    }
+  const double patchNorm = std::sqrt(pEnergy);
+
+  const int nx = W - w + 1, ny = H - h + 1;
+  out_ncc.setSize(ny, nx);
+
+  // Integral images of the window and its squares: O(1) mean/variance per
+  // candidate placement.
+  std::vector<double> S1((W + 1) * (H + 1), 0), S2((W + 1) * (H + 1), 0);
+  for (int y = 0; y < H; y++)
+    for (int x = 0; x < W; x++)
+    {
+      const double v = win(y, x);
+      const int i = (y + 1) * (W + 1) + (x + 1);
+      S1[i] = v + S1[i - 1] + S1[i - (W + 1)] - S1[i - (W + 1) - 1];
+      S2[i] = v * v + S2[i - 1] + S2[i - (W + 1)] - S2[i - (W + 1) - 1];
+    }
+
+  // Numerator: spatial domain for small problems, 2D FFT for large ones.
+  const bool useFFT =
+      static_cast<size_t>(nx) * static_cast<size_t>(ny) * static_cast<size_t>(w) * h >= 2000000;
+
+  CMatrixFloat num;
+  if (useFFT)
+  {
+    const auto lx = mrpt::round2up<size_t>(W), ly = mrpt::round2up<size_t>(H);
+
+    CMatrixFloat A(ly, lx), B(ly, lx);
+    A.fill(0);
+    B.fill(0);
+    for (int y = 0; y < H; y++)
+      for (int x = 0; x < W; x++) A(y, x) = win(y, x);
+    for (int y = 0; y < h; y++)
+      for (int x = 0; x < w; x++) B(y, x) = pat(y, x);
+
+    // The plan caches its work tables while the sizes stay fixed, which is
+    // the steady state of a template tracker:
+    thread_local mrpt::math::CFFT2DPlan plan;
+
+    CMatrixFloat AR, AI, BR, BI;
+    plan.dft2_real(A, AR, AI);
+    plan.dft2_real(B, BR, BI);
+
+    // Correlation: IFFT( FFT(win) * conj(FFT(patch)) ). Both inputs are
+    // real, so the product is Hermitian and the inverse is real. Valid
+    // shifts (<= W-w, H-h) are free of circular wrap-around.
+    CMatrixFloat CR(ly, lx), CI(ly, lx);
+    for (size_t y = 0; y < ly; y++)
+      for (size_t x = 0; x < lx; x++)
+      {
+        CR(y, x) = AR(y, x) * BR(y, x) + AI(y, x) * BI(y, x);
+        CI(y, x) = AI(y, x) * BR(y, x) - AR(y, x) * BI(y, x);
+      }
+    plan.idft2_real(CR, CI, num);
+  }
+
+  // Per-candidate scoring, threaded over bands of result rows:
+  const auto scoreRows = [&](int y0, int y1)
+  {
+    const double n = double(w) * h;
+    for (int y = y0; y < y1; y++)
+      for (int x = 0; x < nx; x++)
+      {
+        double numerator;
+        if (useFFT)
+        {
+          numerator = num(y, x);
+        }
+        else
+        {
+          numerator = 0;
+          for (int v = 0; v < h; v++)
+            for (int u = 0; u < w; u++) numerator += double(win(y + v, x + u)) * pat(v, u);
+        }
+
+        const int i00 = y * (W + 1) + x;
+        const int i01 = i00 + w;
+        const int i10 = i00 + h * (W + 1);
+        const int i11 = i10 + w;
+        const double s1 = S1[i11] - S1[i10] - S1[i01] + S1[i00];
+        const double s2 = S2[i11] - S2[i10] - S2[i01] + S2[i00];
+        const double winVar = std::max(0.0, s2 - s1 * s1 / n);
+
+        const double den = patchNorm * std::sqrt(winVar);
+        out_ncc(y, x) = den > 1e-6 ? d2f(numerator / den) : .0f;
+      }
+  };
+
+  const size_t nThreads = std::min<size_t>(
+      std::max(1u, std::thread::hardware_concurrency()),
+      std::max<size_t>(1, size_t(nx) * ny * (useFFT ? 1 : w * h) / 100000));
+  if (nThreads == 1)
+  {
+    scoreRows(0, ny);
+  }
+  else
+  {
+    std::vector<std::thread> threads;
+    std::vector<std::exception_ptr> excepts(nThreads);
+    const int rowsPerThread = (ny + nThreads - 1) / nThreads;
+    for (size_t t = 0; t < nThreads; t++)
+      threads.emplace_back(
+          [&, t]()
+          {
+            try
+            {
+              scoreRows(t * rowsPerThread, std::min<int>(ny, (t + 1) * rowsPerThread));
+            }
+            catch (...)
+            {
+              excepts[t] = std::current_exception();
+            }
+          });
+    for (auto& t : threads) t.join();
+    for (auto& e : excepts)
+      if (e) std::rethrow_exception(e);
+  }
+
+  MRPT_END
+}
+
 void CImage::getAsMatrixTiled(CMatrixFloat& outMatrix) const
 {
 #if MRPT_HAS_OPENCV
@@ -1635,6 +1964,20 @@ void CImage::makeSureImageIsLoaded(bool allowNonInitialized) const
     string wholeFile;
     getExternalStorageFileAbsolutePath(wholeFile);
 
+#if MRPT_HAS_OPENCV
+    // Already decoded in the background by prefetchExternalImages()?
+    if (cv::Mat pre; ImagePrefetcher::Instance().consume(wholeFile, pre))
+    {
+      const_cast<cv::Mat&>(m_impl->img) = std::move(pre);
+
+      if (MRPT_DEBUG_IMG_LAZY_LOAD)
+        std::cout << "[CImage] Lazy-load of '" << wholeFile
+                  << "' served from the prefetch cache, on this="
+                  << reinterpret_cast<const void*>(this) << std::endl;
+      return;
+    }
+#endif
+
     const std::string tmpFile = m_externalFile;
 
     bool ret = const_cast<CImage*>(this)->loadFromFile(wholeFile);
@@ -1667,6 +2010,22 @@ void CImage::getExternalStorageFileAbsolutePath(std::string& out_path) const
   out_path = mrpt::io::lazy_load_absolute_path(m_externalFile);
 }
 
+void CImage::prefetchExternalImages(const std::vector<std::string>& external_files)
+{
+#if MRPT_HAS_OPENCV
+  ImagePrefetcher::Instance().enqueue(external_files);
+#else
+  (void)external_files;
+#endif
+}
+
+void CImage::clearExternalImagesPrefetchCache()
+{
+#if MRPT_HAS_OPENCV
+  ImagePrefetcher::Instance().clearCache();
+#endif
+}
+
 void CImage::flipVertical()
 {
 #if MRPT_HAS_OPENCV
@@ -1733,7 +2092,7 @@ void CImage::undistort(CImage& out_img, const mrpt::img::TCamera& cameraParams)
 #endif
 }
 
-void CImage::filterMedian(CImage& out_img, int W) const
+void CImage::filterMedian(CImage& out_img, int W, unsigned int num_threads) const
 {
 #if MRPT_HAS_OPENCV
   makeSureImageIsLoaded();  // For delayed loaded images stored externally
@@ -1744,11 +2103,31 @@ void CImage::filterMedian(CImage& out_img, int W) const
   else
     out_img.resize(srcImg.cols, srcImg.rows, getChannelCount());
 
+// If possible, use the SSE2 optimized version:
+#if MRPT_ARCH_INTEL_COMPATIBLE
+  if (W == 3 && srcImg.channels() == 1 && srcImg.depth() == CV_8U &&
+      mrpt::cpu::supports(mrpt::cpu::feature::SSE2))
+  {
+    const auto& dst = out_img.m_impl->img;
+    launchRowBandedKernel(
+        [&](int r0, int r1)
+        {
+          image_SSE2_median_3x3_1c8u(
+              srcImg.data, dst.data, srcImg.cols, srcImg.rows, srcImg.step[0], dst.step[0], r0, r1);
+        },
+        srcImg.rows, num_threads);
+    return;
+  }
+#endif
+
   cv::medianBlur(srcImg, out_img.m_impl->img, W);
+#else
+  (void)num_threads;
 #endif
 }
 
-void CImage::filterGaussian(CImage& out_img, int W, int H, double sigma) const
+void CImage::filterGaussian(
+    CImage& out_img, int W, int H, double sigma, unsigned int num_threads) const
 {
 #if MRPT_HAS_OPENCV
   makeSureImageIsLoaded();  // For delayed loaded images stored externally
@@ -1758,7 +2137,28 @@ void CImage::filterGaussian(CImage& out_img, int W, int H, double sigma) const
   else
     out_img.resize(srcImg.cols, srcImg.rows, getChannelCount());
 
+// If possible, use the SSE2 optimized version. sigma<=0 with a 3x3 window is
+// exactly OpenCV's fixed [1 2 1]/4 binomial kernel, which is what the SIMD
+// kernel implements:
+#if MRPT_ARCH_INTEL_COMPATIBLE
+  if (W == 3 && H == 3 && sigma <= 0 && srcImg.channels() == 1 && srcImg.depth() == CV_8U &&
+      mrpt::cpu::supports(mrpt::cpu::feature::SSE2))
+  {
+    const auto& dst = out_img.m_impl->img;
+    launchRowBandedKernel(
+        [&](int r0, int r1)
+        {
+          image_SSE2_gaussian_3x3_1c8u(
+              srcImg.data, dst.data, srcImg.cols, srcImg.rows, srcImg.step[0], dst.step[0], r0, r1);
+        },
+        srcImg.rows, num_threads);
+    return;
+  }
+#endif
+
   cv::GaussianBlur(srcImg, out_img.m_impl->img, cv::Size(W, H), sigma);
+#else
+  (void)num_threads;
 #endif
 }
 
@@ -1780,6 +2180,37 @@ void CImage::scaleImage(
   }
   out_img.resize(width, height, getChannelCount());
 
+// Exact half-size downsamples can reuse the SSE2/SSSE3 scaleHalf() kernels:
+#if MRPT_ARCH_INTEL_COMPATIBLE
+  if (srcImg.depth() == CV_8U && static_cast<int>(width) * 2 == srcImg.cols &&
+      static_cast<int>(height) * 2 == srcImg.rows)
+  {
+    auto& dst = out_img.m_impl->img;
+    if (srcImg.channels() == 3 && interp == IMG_INTERP_NN &&
+        mrpt::cpu::supports(mrpt::cpu::feature::SSSE3))
+    {
+      image_SSSE3_scale_half_3c8u(
+          srcImg.data, dst.data, srcImg.cols, srcImg.rows, srcImg.step[0], dst.step[0]);
+      return;
+    }
+    if (srcImg.channels() == 1 && mrpt::cpu::supports(mrpt::cpu::feature::SSE2))
+    {
+      if (interp == IMG_INTERP_NN)
+      {
+        image_SSE2_scale_half_1c8u(
+            srcImg.data, dst.data, srcImg.cols, srcImg.rows, srcImg.step[0], dst.step[0]);
+        return;
+      }
+      else if (interp == IMG_INTERP_LINEAR)
+      {
+        image_SSE2_scale_half_smooth_1c8u(
+            srcImg.data, dst.data, srcImg.cols, srcImg.rows, srcImg.step[0], dst.step[0]);
+        return;
+      }
+    }
+  }
+#endif
+
   // Resize:
   cv::resize(
       srcImg, out_img.m_impl->img, out_img.m_impl->img.size(), 0, 0,
@@ -242,6 +242,62 @@ TEST(CImage, ExternalImage)
   }
 }
 
+TEST(CImage, ExternalImagePrefetch)
+{
+  using namespace mrpt::img;
+
+  // Prefetching a missing file must be harmless (errors surface on the
+  // actual lazy load, as usual):
+  CImage::prefetchExternalImages({tstImgFileColor, "./foo_61717181.png"});
+
+  CImage a;
+  a.setExternalStorage(tstImgFileColor);
+  a.forceLoad();  // may or may not hit the prefetch cache, depending on timing
+
+  CImage b;
+  EXPECT_TRUE(b.loadFromFile(tstImgFileColor));
+  EXPECT_EQ(a.getWidth(), b.getWidth());
+  EXPECT_EQ(a.getHeight(), b.getHeight());
+  EXPECT_EQ(a.isColor(), b.isColor());
+
+  CImage::clearExternalImagesPrefetchCache();
+}
+
+TEST(CImage, FilterKernels3x3)
+{
+  using namespace mrpt::img;
+
+  CImage img(70, 50, CH_GRAY);
+  fillImagePseudoRandom(1234, img);
+
+  // Median: single-threaded and row-banded threaded runs must be identical:
+  CImage med1, med4;
+  img.filterMedian(med1, 3, 1);
+  img.filterMedian(med4, 3, 4);
+  expect_identical(med1, med4, "filterMedian num_threads=1 vs 4");
+
+  // Gaussian (3x3 binomial, sigma<=0): idem, plus check interior pixels
+  // against the scalar [1 2 1]/4 x [1 2 1]/4 reference (tolerance: 1 LSB for
+  // rounding differences between code paths):
+  CImage g1, g4;
+  img.filterGaussian(g1, 3, 3, -1.0, 1);
+  img.filterGaussian(g4, 3, 3, -1.0, 4);
+  expect_identical(g1, g4, "filterGaussian num_threads=1 vs 4");
+
+  for (unsigned int y = 1; y + 1 < img.getHeight(); y += 7)
+    for (unsigned int x = 1; x + 1 < img.getWidth(); x += 11)
+    {
+      int s = 0;
+      const int wgt[3] = {1, 2, 1};
+      for (int dy = -1; dy <= 1; dy++)
+        for (int dx = -1; dx <= 1; dx++)
+          s += wgt[dx + 1] * wgt[dy + 1] * img.at<uint8_t>(x + dx, y + dy);
+      const int expected = (s + 8) / 16;
+      EXPECT_NEAR(static_cast<int>(g1.at<uint8_t>(x, y)), expected, 1)
+          << "(" << x << "," << y << ")";
+    }
+}
+
 TEST(CImage, ConvertGray)
 {
   using namespace mrpt::img;
@@ -495,6 +551,50 @@ TEST(CImage, KLT_response)
   }
 }
 
+TEST(CImage, cross_correlation_NCC)
+{
+  using namespace mrpt::img;
+
+  // One run through the spatial path (small sizes) and one through the FFT
+  // path (sizes above the internal threshold):
+  const struct
+  {
+    unsigned imgSize, patchSize;
+  } cases[] = {{64, 8}, {128, 32}};
+
+  for (const auto& c : cases)
+  {
+    CImage img(c.imgSize, c.imgSize, CH_GRAY);
+    fillImagePseudoRandom(c.imgSize /*seed*/, img);
+
+    // Take the patch from a known location:
+    const unsigned px = c.imgSize / 3, py = c.imgSize / 2;
+    CImage patch;
+    img.extract_patch(patch, px, py, c.patchSize, c.patchSize);
+
+    mrpt::math::CMatrixFloat ncc;
+    img.cross_correlation_NCC(patch, ncc);
+
+    ASSERT_EQ(static_cast<unsigned>(ncc.cols()), c.imgSize - c.patchSize + 1);
+    ASSERT_EQ(static_cast<unsigned>(ncc.rows()), c.imgSize - c.patchSize + 1);
+
+    std::size_t u, v;
+    const float peak = ncc.maxCoeff(u, v);
+
+    EXPECT_NEAR(peak, 1.0f, 0.01f) << " imgSize=" << c.imgSize;
+    EXPECT_EQ(v, px) << " imgSize=" << c.imgSize;
+    EXPECT_EQ(u, py) << " imgSize=" << c.imgSize;
+
+    // Scores are proper NCC values:
+    for (int i = 0; i < ncc.rows(); i++)
+      for (int j = 0; j < ncc.cols(); j++)
+      {
+        EXPECT_GE(ncc(i, j), -1.02f);
+        EXPECT_LE(ncc(i, j), 1.02f);
+      }
+  }
+}
+
 TEST(CImage, LoadAndComparePseudoRnd)
 {
   using namespace mrpt::img;
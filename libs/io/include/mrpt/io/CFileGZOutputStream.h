@@ -19,6 +19,13 @@ namespace mrpt::io
  * compression level.
  * The generated files are in gzip format ("file.gz").
  *
+ * Optionally (numberOfThreads>0 in open() or the constructor), compression
+ * runs pigz-style: the output is chunked and the chunks are compressed in
+ * parallel by a pool of worker threads, each as a complete gzip member. The
+ * resulting concatenated-gzip file is standards-compliant (RFC 1952) and is
+ * read transparently by CFileGZInputStream or by gunzip, while writing scales
+ * with the number of threads instead of being capped by single-threaded zlib.
+ *
  * \sa CFileOutputStream
  * \ingroup mrpt_io_grp
  */
@@ -36,12 +43,16 @@ class CFileGZOutputStream : public CStream
    * \param append If set to true, the file will be opened for writing and the
    * current cursor position set at the end of the file. Otherwise, previous
    * contents will be lost.
+   * \param numberOfThreads 0 (default): compress in the calling thread.
+   * >=1: compress chunks in parallel on that many worker threads (see class
+   * description).
    * \exception std::exception if the file cannot be opened.
    */
   CFileGZOutputStream(
       const std::string& fileName,
       const OpenMode mode = OpenMode::TRUNCATE,
-      int compressionLevel = 1);
+      int compressionLevel = 1,
+      unsigned int numberOfThreads = 0);
 
   /** Constructor, without opening the file.
    * \sa open
@@ -59,13 +70,17 @@ class CFileGZOutputStream : public CStream
   /** Open a file for write, choosing the compression level
    * \param fileName The file to be open in this stream
    * \param compress_level 0:no compression, 1:fastest, 9:best
+   * \param numberOfThreads 0 (default): compress in the calling thread.
+   * >=1: compress chunks in parallel on that many worker threads (see class
+   * description).
    * \return true on success, false on any error.
    */
   bool open(
       const std::string& fileName,
       int compress_level = 1,
       mrpt::optional_ref<std::string> error_msg = std::nullopt,
-      const OpenMode mode = OpenMode::TRUNCATE);
+      const OpenMode mode = OpenMode::TRUNCATE,
+      unsigned int numberOfThreads = 0);
 
   /** Close the file */
   void close();
@@ -0,0 +1,119 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+#pragma once
+
+#include <mrpt/io/CStream.h>
+
+namespace mrpt::io
+{
+/** Hint on the expected access pattern of a CMemoryMappedFileStream, forwarded
+ * to the OS (madvise() on POSIX) so it can tune its read-ahead.
+ *
+ * \sa CMemoryMappedFileStream
+ * \ingroup mrpt_io_grp
+ */
+enum class AccessPattern : uint8_t
+{
+  /** No hint: the OS default read-ahead policy. */
+  Normal = 0,
+  /** Mostly front-to-back reads: aggressive read-ahead (e.g. rawlog
+   * playback, loading a serialized map or Scene). */
+  Sequential,
+  /** Scattered reads: disable read-ahead (e.g. indexed random access). */
+  Random
+};
+
+/** A read-only, binary CStream over a memory-mapped file (mmap() on POSIX,
+ * MapViewOfFile() on Windows).
+ *
+ * Compared with CFileInputStream, reads are served straight from the page
+ * cache: repeated loads of the same dataset run at memory speed, and several
+ * processes mapping the same file share a single physical copy of it.
+ * Since the file contents are directly addressable, borrowReadBuffer() is
+ * supported, enabling the zero-copy deserialization path of
+ * mrpt::serialization::CArchive::ReadBufferBorrow().
+ *
+ * The mapping is read-only: the file must not be truncated by another
+ * process while mapped, or accessing the stream is undefined behavior (as
+ * with any mapped file).
+ *
+ * \sa CStream, CFileInputStream, CMemoryStream
+ * \ingroup mrpt_io_grp
+ */
+class CMemoryMappedFileStream : public CStream
+{
+ private:
+  /** Base address of the mapping (nullptr if not open or empty file). */
+  const uint8_t* m_base{nullptr};
+  /** Size of the mapped file, in bytes. */
+  uint64_t m_size{0};
+  /** Current read cursor. */
+  uint64_t m_position{0};
+  std::string m_filename;
+#ifdef _WIN32
+  void* m_hFile{nullptr};
+  void* m_hMapping{nullptr};
+#else
+  int m_fd{-1};
+#endif
+
+ public:
+  /** Constructor
+   * \param fileName The file to be mapped in this stream
+   * \param pattern Expected access pattern, used as an OS read-ahead hint
+   * \exception std::exception On error trying to open or map the file.
+   */
+  CMemoryMappedFileStream(
+      const std::string& fileName, AccessPattern pattern = AccessPattern::Sequential);
+  /** Default constructor */
+  CMemoryMappedFileStream() = default;
+
+  CMemoryMappedFileStream(const CMemoryMappedFileStream&) = delete;
+  CMemoryMappedFileStream& operator=(const CMemoryMappedFileStream&) = delete;
+
+  ~CMemoryMappedFileStream() override;
+
+  /** Maps a file for reading
+   * \param fileName The file to be mapped in this stream
+   * \param pattern Expected access pattern, used as an OS read-ahead hint
+   * \return true on success.
+   */
+  bool open(const std::string& fileName, AccessPattern pattern = AccessPattern::Sequential);
+  /** Unmaps the file and closes the stream */
+  void close();
+  /** Returns true if the file was mapped without errors. */
+  bool fileOpenCorrectly() const { return m_base != nullptr || (m_size == 0 && !m_filename.empty()); }
+  /** Returns true if the file was mapped without errors. */
+  bool is_open() { return fileOpenCorrectly(); }
+  /** Will be true if the read cursor has already reached the end. */
+  bool checkEOF() const { return m_position >= m_size; }
+
+  /** Changes the OS read-ahead hint of an already-mapped file. */
+  void setAccessPattern(AccessPattern pattern);
+
+  /** Base address of the whole mapping (nullptr if not open or the file is
+   * empty). The length in bytes is given by getTotalBytesCount() */
+  const void* getRawBufferData() const { return m_base; }
+
+  std::string getStreamDescription() const override;
+
+  // See docs in base class
+  uint64_t Seek(int64_t Offset, CStream::TSeekOrigin Origin = sFromBeginning) override;
+  // See docs in base class
+  uint64_t getTotalBytesCount() const override { return m_size; }
+  // See docs in base class
+  uint64_t getPosition() const override { return m_position; }
+
+  size_t Read(void* Buffer, size_t Count) override;
+  size_t Write(const void* Buffer, size_t Count) override;
+
+  // See base class docs: returns a pointer into the mapping.
+  const uint8_t* borrowReadBuffer(size_t Count, size_t Alignment = 1) override;
+};  // End of class def.
+}  // namespace mrpt::io
@@ -29,6 +29,9 @@ class CMemoryStream : public CStream
   size_t Read(void* Buffer, size_t Count) override;
   size_t Write(const void* Buffer, size_t Count) override;
 
+  // See base class docs: returns a pointer into the internal buffer.
+  const uint8_t* borrowReadBuffer(size_t Count, size_t Alignment = 1) override;
+
  protected:
   /** Internal data */
   void_ptr_noncopy m_memory{nullptr};
@@ -106,6 +106,14 @@ class CPipeBaseEndPoint : public mrpt::io::CStream
   size_t Read(void* Buffer, size_t Count) override;
   size_t Write(const void* Buffer, size_t Count) override;
 
+  /** Single-syscall gathered write via writev() on POSIX; falls back to the
+   * generic per-chunk loop elsewhere. \note [New in MRPT 2.14.5] */
+  size_t WriteV(const std::vector<TBufferView>& chunks) override;
+  /** Single-syscall scattered read via readv() on POSIX (only when no read
+   * timeouts are set); falls back to the generic per-chunk loop elsewhere.
+   * \note [New in MRPT 2.14.5] */
+  size_t ReadV(const std::vector<TMutableBufferView>& chunks) override;
+
   /** Without effect in this class */
   uint64_t Seek(int64_t of, CStream::TSeekOrigin o = sFromBeginning) override;
   /** Without effect in this class */
@@ -12,9 +12,26 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 namespace mrpt::io
 {
+/** A (data, size) view of a read-only buffer, for CStream::WriteV()
+ * \note [New in MRPT 2.14.5] */
+struct TBufferView
+{
+  const void* data = nullptr;
+  size_t size = 0;
+};
+
+/** A (data, size) view of a writable buffer, for CStream::ReadV()
+ * \note [New in MRPT 2.14.5] */
+struct TMutableBufferView
+{
+  void* data = nullptr;
+  size_t size = 0;
+};
+
 /** This base class is used to provide a unified interface to
  *    files,memory buffers,..Please see the derived classes. This class is
  *    largely inspired by Borland VCL "TStream" class. <br><br>
@@ -61,6 +78,41 @@ class CStream
    */
   virtual size_t ReadBufferImmediate(void* Buffer, size_t Count) { return Read(Buffer, Count); }
 
+  /** If the stream is backed by directly-addressable memory (e.g.
+   * CMemoryStream, or a future memory-mapped file stream), returns a
+   * read-only pointer to the next Count bytes and advances the read position
+   * past them, so callers can use the data in place instead of copying it
+   * out. Returns nullptr, leaving the read position untouched, if the stream
+   * does not support it (the default), fewer than Count bytes remain, or the
+   * data does not satisfy the given Alignment (in bytes).
+   * The returned pointer is only valid while the underlying storage is: do
+   * not keep it beyond the life of this stream or of its mapped buffer.
+   */
+  virtual const uint8_t* borrowReadBuffer(
+      [[maybe_unused]] size_t Count, [[maybe_unused]] size_t Alignment = 1)
+  {
+    return nullptr;
+  }
+
+  /** Gathered ("vectored") write: writes the given sequence of buffers as if
+   * they were one contiguous block, and returns the total number of bytes
+   * actually written.
+   * The default implementation simply loops over Write(); streams backed by
+   * file descriptors (e.g. the pipe end-points in mrpt::io::CPipe) override
+   * it with a single writev() syscall.
+   * \note [New in MRPT 2.14.5] \sa ReadV
+   */
+  virtual size_t WriteV(const std::vector<TBufferView>& chunks);
+
+  /** Scattered ("vectored") read: fills the given sequence of buffers in
+   * order, as if they were one contiguous block, and returns the total
+   * number of bytes actually read (which may be less than the sum of the
+   * chunk sizes on a short read).
+   * The default implementation simply loops over Read(); see WriteV().
+   * \note [New in MRPT 2.14.5] \sa WriteV
+   */
+  virtual size_t ReadV(const std::vector<TMutableBufferView>& chunks);
+
   /** Introduces a pure virtual method for moving to a specified position in
    *the streamed resource.
    *   he Origin parameter indicates how to interpret the Offset parameter.
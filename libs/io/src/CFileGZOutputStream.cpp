@@ -9,12 +9,19 @@
 
 #include "io-precomp.h"  // Precompiled headers
 //
+#include <mrpt/core/WorkerThreadsPool.h>
 #include <mrpt/core/exceptions.h>
 #include <mrpt/io/CFileGZOutputStream.h>
 
 #include <cerrno>
+#include <chrono>
 #include <cstring>  // strerror
+#include <deque>
+#include <fstream>
+#include <future>
+#include <memory>
 #include <type_traits>
+#include <vector>
 //
 #include <mrpt/config.h>
 #if HAVE_UNISTD_H
@@ -26,21 +33,105 @@
 using namespace mrpt::io;
 using namespace std;
 
+namespace
+{
+/** Compresses one chunk of data as a complete, standalone gzip member.
+ * Concatenated gzip members are a valid gzip file (RFC 1952), and are read
+ * back transparently by zlib, hence by CFileGZInputStream or gunzip. */
+std::vector<uint8_t> compressChunk(std::vector<uint8_t> data, int level)
+{
+  z_stream zs;
+  std::memset(&zs, 0, sizeof(zs));
+  if (deflateInit2(
+          &zs, level, Z_DEFLATED, 15 /*window*/ + 16 /*gzip wrapper*/, 8, Z_DEFAULT_STRATEGY) !=
+      Z_OK)
+    THROW_EXCEPTION("deflateInit2() failed");
+
+  std::vector<uint8_t> out(deflateBound(&zs, data.size()));
+  zs.next_in = data.data();
+  zs.avail_in = static_cast<uInt>(data.size());
+  zs.next_out = out.data();
+  zs.avail_out = static_cast<uInt>(out.size());
+  const int ret = deflate(&zs, Z_FINISH);
+  deflateEnd(&zs);
+  if (ret != Z_STREAM_END) THROW_EXCEPTION("deflate() failed compressing a gzip chunk");
+
+  out.resize(zs.total_out);
+  return out;
+}
+}  // namespace
+
+namespace
+{
+/** State of the parallel (pigz-style) compression mode. */
+struct ParallelGZState
+{
+  /** Uncompressed bytes per gzip member. */
+  static constexpr size_t CHUNK_SIZE = 1024 * 1024;
+
+  ParallelGZState(unsigned int nThreads, int compress_level) :
+      level(compress_level),
+      numThreads(nThreads),
+      pool(nThreads, mrpt::WorkerThreadsPool::POLICY_FIFO, "CFileGZOutputStream")
+  {
+  }
+
+  std::ofstream rawFile;
+  int level;
+  unsigned int numThreads;
+  mrpt::WorkerThreadsPool pool;
+  /** Compressed chunks not yet written to disk, in input order. */
+  std::deque<std::future<std::vector<uint8_t>>> pendingChunks;
+  /** Uncompressed data accumulated for the next chunk. */
+  std::vector<uint8_t> curChunk;
+  uint64_t uncompressedBytes = 0;
+  bool chunkEverFlushed = false;
+
+  void flushCurChunk()
+  {
+    pendingChunks.emplace_back(pool.enqueue(&compressChunk, std::move(curChunk), level));
+    curChunk = {};  // moved-from: re-init
+    chunkEverFlushed = true;
+  }
+  void writeFrontChunk()
+  {
+    const auto compressed = pendingChunks.front().get();
+    pendingChunks.pop_front();
+    rawFile.write(reinterpret_cast<const char*>(compressed.data()), compressed.size());
+    if (!rawFile) THROW_EXCEPTION("Error writing compressed data to disk");
+  }
+  /** Writes, in input order, all the chunks already compressed; blocks on
+   * pending ones only while more than maxPending are in flight. */
+  void drainReadyChunks(size_t maxPending)
+  {
+    while (!pendingChunks.empty() &&
+           (pendingChunks.size() > maxPending ||
+            pendingChunks.front().wait_for(std::chrono::seconds(0)) == std::future_status::ready))
+      writeFrontChunk();
+  }
+};
+}  // namespace
+
 struct CFileGZOutputStream::Impl
 {
   gzFile f = nullptr;
   std::string filename;
+  /** Non-null while the stream is open in parallel (pigz-style) mode.
+   * (shared_ptr only so that Impl stays formally copyable for mrpt::pimpl;
+   *  the stream class itself is non-copyable) */
+  std::shared_ptr<ParallelGZState> par;
 };
 
 CFileGZOutputStream::CFileGZOutputStream() : m_f(mrpt::make_impl<CFileGZOutputStream::Impl>()) {}
 
 CFileGZOutputStream::CFileGZOutputStream(
-    const std::string& fileName, const OpenMode mode, int compressionLevel) :
+    const std::string& fileName, const OpenMode mode, int compressionLevel,
+    unsigned int numberOfThreads) :
     CFileGZOutputStream()
 {
   MRPT_START
   std::string err_msg;
-  if (!open(fileName, compressionLevel, err_msg, mode))
+  if (!open(fileName, compressionLevel, err_msg, mode, numberOfThreads))
     THROW_EXCEPTION_FMT(
         "Error trying to open file: '%s', error: '%s'", fileName.c_str(), err_msg.c_str());
   MRPT_END
@@ -50,11 +141,30 @@ bool CFileGZOutputStream::open(
     const string& fileName,
     int compress_level,
     mrpt::optional_ref<std::string> error_msg,
-    const OpenMode mode)
+    const OpenMode mode,
+    unsigned int numberOfThreads)
 {
   MRPT_START
 
-  if (m_f->f) gzclose(m_f->f);
+  close();
+
+  if (numberOfThreads > 0)
+  {
+    // Parallel (pigz-style) mode: plain output file, we compress ourselves.
+    auto par = std::make_shared<ParallelGZState>(numberOfThreads, compress_level);
+    par->rawFile.open(
+        fileName.c_str(),
+        ios_base::binary | ios_base::out |
+            (mode == OpenMode::APPEND ? ios_base::app : ios_base::trunc));
+    if (!par->rawFile.is_open())
+    {
+      if (error_msg) error_msg.value().get() = std::string(strerror(errno));
+      return false;
+    }
+    m_f->par = std::move(par);
+    m_f->filename = fileName;
+    return true;
+  }
 
   // Open gz stream:
   m_f->f = gzopen(
@@ -72,6 +182,17 @@ bool CFileGZOutputStream::open(
 CFileGZOutputStream::~CFileGZOutputStream() { close(); }
 void CFileGZOutputStream::close()
 {
+  if (m_f->par)
+  {
+    auto& par = *m_f->par;
+    // Flush the last (possibly partial) chunk. Also make sure at least one
+    // gzip member is ever emitted, so empty files are still valid gzip:
+    if (!par.curChunk.empty() || !par.chunkEverFlushed) par.flushCurChunk();
+    while (!par.pendingChunks.empty()) par.writeFrontChunk();
+    par.rawFile.close();
+    m_f->par.reset();
+    m_f->filename.clear();
+  }
   if (m_f->f)
   {
     gzclose(m_f->f);
@@ -87,6 +208,19 @@ size_t CFileGZOutputStream::Read(void*, size_t)
 
 size_t CFileGZOutputStream::Write(const void* Buffer, size_t Count)
 {
+  if (m_f->par)
+  {
+    auto& par = *m_f->par;
+    const auto* p = static_cast<const uint8_t*>(Buffer);
+    par.curChunk.insert(par.curChunk.end(), p, p + Count);
+    if (par.curChunk.size() >= ParallelGZState::CHUNK_SIZE) par.flushCurChunk();
+
+    // Keep disk writes going and bound the in-flight memory:
+    par.drainReadyChunks(2 * par.numThreads);
+
+    par.uncompressedBytes += Count;
+    return Count;
+  }
   if (!m_f->f)
   {
     THROW_EXCEPTION("File is not open.");
@@ -96,6 +230,8 @@ size_t CFileGZOutputStream::Write(const void* Buffer, size_t Count)
 
 uint64_t CFileGZOutputStream::getPosition() const
 {
+  // As with gztell(), the position refers to the *uncompressed* data:
+  if (m_f->par) return m_f->par->uncompressedBytes;
   if (!m_f->f)
   {
     THROW_EXCEPTION("File is not open.");
@@ -103,7 +239,7 @@ uint64_t CFileGZOutputStream::getPosition() const
   return gztell(m_f->f);
 }
 
-bool CFileGZOutputStream::fileOpenCorrectly() const { return m_f->f != nullptr; }
+bool CFileGZOutputStream::fileOpenCorrectly() const { return m_f->f != nullptr || !!m_f->par; }
 uint64_t CFileGZOutputStream::Seek(int64_t, CStream::TSeekOrigin)
 {
   THROW_EXCEPTION("Method not available in this class.");
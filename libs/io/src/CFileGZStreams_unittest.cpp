@@ -141,6 +141,62 @@ TEST(CFileGZStreams, readwriteTmpFileCompressed)
   }
 }
 
+TEST(CFileGZStreams, parallelCompression)
+{
+  // Large enough to span several compression chunks (gzip members):
+  const size_t N = 3 * 1024 * 1024 + 12345;
+  std::vector<uint8_t> tst_data(N);
+  mrpt::random::Generator_MT19937 mersenne_engine;
+  mersenne_engine.seed(123U);
+  std::generate(
+      std::begin(tst_data), std::end(tst_data),
+      [&mersenne_engine]() { return mersenne_engine() % 4; });
+
+  const std::string fil = mrpt::system::getTempFileName() + std::string("_par");
+
+  // Write with a worker pool:
+  {
+    mrpt::io::CFileGZOutputStream fil_out;
+    const bool open_ok =
+        fil_out.open(fil, 1, std::nullopt, mrpt::io::OpenMode::TRUNCATE, 4 /*threads*/);
+    EXPECT_TRUE(open_ok);
+
+    // Many small writes, as rawlog-grabber would do:
+    size_t wr = 0;
+    while (wr < N)
+    {
+      const size_t len = std::min<size_t>(64 * 1024 + 7, N - wr);
+      EXPECT_EQ(fil_out.Write(&tst_data[wr], len), len);
+      wr += len;
+    }
+    EXPECT_EQ(fil_out.getPosition(), N);
+  }
+  // The concatenated-gzip output must be readable by the regular reader:
+  {
+    mrpt::io::CFileGZInputStream fil_in(fil);
+    std::vector<uint8_t> rd_buf(N + 5);
+    const size_t rd_count = fil_in.Read(rd_buf.data(), N);
+    EXPECT_EQ(rd_count, N);
+    EXPECT_TRUE(std::equal(std::begin(tst_data), std::end(tst_data), std::begin(rd_buf)));
+    EXPECT_EQ(fil_in.Read(rd_buf.data(), 1), 0U);  // EOF
+  }
+  // Parallel append after a parallel write:
+  {
+    mrpt::io::CFileGZOutputStream fil_out;
+    const bool open_ok =
+        fil_out.open(fil, 1, std::nullopt, mrpt::io::OpenMode::APPEND, 2 /*threads*/);
+    EXPECT_TRUE(open_ok);
+    EXPECT_EQ(fil_out.Write(&tst_data[0], 1000U), 1000U);
+  }
+  {
+    mrpt::io::CFileGZInputStream fil_in(fil);
+    std::vector<uint8_t> rd_buf(N + 1000U);
+    const size_t rd_count = fil_in.Read(rd_buf.data(), N + 1000U);
+    EXPECT_EQ(rd_count, N + 1000U);
+    EXPECT_TRUE(std::equal(std::begin(rd_buf) + N, std::end(rd_buf), std::begin(tst_data)));
+  }
+}
+
 TEST(CFileGZStreams, compareWithTestGZFiles)
 {
   std::vector<uint8_t> tst_data;
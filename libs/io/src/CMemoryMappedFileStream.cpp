@@ -0,0 +1,216 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include "io-precomp.h"  // Precompiled headers
+//
+#include <mrpt/core/exceptions.h>
+#include <mrpt/io/CMemoryMappedFileStream.h>
+
+#include <cstring>  // memcpy
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace mrpt::io;
+using namespace std;
+
+static_assert(
+    !std::is_copy_constructible_v<CMemoryMappedFileStream> &&
+        !std::is_copy_assignable_v<CMemoryMappedFileStream>,
+    "Copy Check");
+
+CMemoryMappedFileStream::CMemoryMappedFileStream(const string& fileName, AccessPattern pattern)
+{
+  MRPT_START
+
+  if (!open(fileName, pattern))
+    THROW_EXCEPTION_FMT("Error trying to map file: '%s'", fileName.c_str());
+
+  MRPT_END
+}
+
+CMemoryMappedFileStream::~CMemoryMappedFileStream() { close(); }
+
+bool CMemoryMappedFileStream::open(const string& fileName, AccessPattern pattern)
+{
+  close();
+
+#ifdef _WIN32
+  const DWORD flags =
+      (pattern == AccessPattern::Random) ? FILE_FLAG_RANDOM_ACCESS : FILE_FLAG_SEQUENTIAL_SCAN;
+  HANDLE hFile = CreateFileA(
+      fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flags, nullptr);
+  if (hFile == INVALID_HANDLE_VALUE) return false;
+
+  LARGE_INTEGER fileSize;
+  if (!GetFileSizeEx(hFile, &fileSize))
+  {
+    CloseHandle(hFile);
+    return false;
+  }
+  m_hFile = hFile;
+  m_size = static_cast<uint64_t>(fileSize.QuadPart);
+
+  if (m_size > 0)
+  {
+    HANDLE hMapping = CreateFileMappingA(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!hMapping)
+    {
+      CloseHandle(hFile);
+      m_hFile = nullptr;
+      return false;
+    }
+    m_hMapping = hMapping;
+    m_base = static_cast<const uint8_t*>(MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0));
+    if (!m_base)
+    {
+      CloseHandle(hMapping);
+      CloseHandle(hFile);
+      m_hMapping = nullptr;
+      m_hFile = nullptr;
+      return false;
+    }
+  }
+#else
+  const int fd = ::open(fileName.c_str(), O_RDONLY);
+  if (fd < 0) return false;
+
+  struct stat st;
+  if (::fstat(fd, &st) != 0)
+  {
+    ::close(fd);
+    return false;
+  }
+  m_fd = fd;
+  m_size = static_cast<uint64_t>(st.st_size);
+
+  if (m_size > 0)
+  {
+    void* p = ::mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (p == MAP_FAILED)
+    {
+      ::close(fd);
+      m_fd = -1;
+      return false;
+    }
+    m_base = static_cast<const uint8_t*>(p);
+  }
+#endif
+
+  m_position = 0;
+  m_filename = fileName;
+  setAccessPattern(pattern);
+  return true;
+}
+
+void CMemoryMappedFileStream::close()
+{
+#ifdef _WIN32
+  if (m_base) UnmapViewOfFile(const_cast<uint8_t*>(m_base));
+  if (m_hMapping) CloseHandle(m_hMapping);
+  if (m_hFile) CloseHandle(m_hFile);
+  m_hMapping = nullptr;
+  m_hFile = nullptr;
+#else
+  if (m_base) ::munmap(const_cast<uint8_t*>(m_base), m_size);
+  if (m_fd >= 0) ::close(m_fd);
+  m_fd = -1;
+#endif
+  m_base = nullptr;
+  m_size = 0;
+  m_position = 0;
+  m_filename.clear();
+}
+
+void CMemoryMappedFileStream::setAccessPattern([[maybe_unused]] AccessPattern pattern)
+{
+#ifndef _WIN32
+  // On Windows the hint can only be given at CreateFile() time, see open().
+  if (!m_base) return;
+  int advice = MADV_NORMAL;
+  switch (pattern)
+  {
+    case AccessPattern::Normal:
+      advice = MADV_NORMAL;
+      break;
+    case AccessPattern::Sequential:
+      advice = MADV_SEQUENTIAL;
+      break;
+    case AccessPattern::Random:
+      advice = MADV_RANDOM;
+      break;
+  }
+  // A failed hint is only a performance issue, so the result is ignored:
+  ::madvise(const_cast<uint8_t*>(m_base), m_size, advice);
+#endif
+}
+
+size_t CMemoryMappedFileStream::Read(void* Buffer, size_t Count)
+{
+  // enough bytes?
+  if (m_position >= m_size) return 0;
+  const size_t nToRead = std::min<size_t>(Count, m_size - m_position);
+
+  // Copy out of the mapping:
+  if (nToRead > 0) memcpy(Buffer, m_base + m_position, nToRead);
+
+  m_position += nToRead;
+  return nToRead;
+}
+
+size_t CMemoryMappedFileStream::Write([[maybe_unused]] const void* Buffer, [[maybe_unused]] size_t Count)
+{
+  THROW_EXCEPTION("Trying to write to a read-only memory-mapped stream.");
+}
+
+const uint8_t* CMemoryMappedFileStream::borrowReadBuffer(size_t Count, size_t Alignment)
+{
+  // enough bytes?
+  if (m_position + Count > m_size) return nullptr;
+
+  const uint8_t* ptr = m_base + m_position;
+  if (Alignment > 1 && (reinterpret_cast<uintptr_t>(ptr) % Alignment) != 0) return nullptr;
+
+  m_position += Count;
+  return ptr;
+}
+
+uint64_t CMemoryMappedFileStream::Seek(int64_t Offset, CStream::TSeekOrigin Origin)
+{
+  int64_t newPos = 0;
+  switch (Origin)
+  {
+    case sFromBeginning:
+      newPos = Offset;
+      break;
+    case sFromCurrent:
+      newPos = static_cast<int64_t>(m_position) + Offset;
+      break;
+    case sFromEnd:
+      newPos = static_cast<int64_t>(m_size) + Offset;
+      break;
+    default:
+      THROW_EXCEPTION("Invalid value for 'Origin'");
+  }
+  if (newPos < 0) newPos = 0;
+  if (newPos > static_cast<int64_t>(m_size)) newPos = static_cast<int64_t>(m_size);
+  m_position = static_cast<uint64_t>(newPos);
+  return m_position;
+}
+
+std::string CMemoryMappedFileStream::getStreamDescription() const
+{
+  return mrpt::format("mrpt::io::CMemoryMappedFileStream for file '%s'", m_filename.c_str());
+}
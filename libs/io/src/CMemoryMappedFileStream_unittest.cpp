@@ -0,0 +1,85 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/io/CFileOutputStream.h>
+#include <mrpt/io/CMemoryMappedFileStream.h>
+#include <mrpt/system/filesystem.h>
+
+static std::string createTestFile(const std::string& contents)
+{
+  const std::string fil = mrpt::system::getTempFileName();
+  mrpt::io::CFileOutputStream fo(fil);
+  fo.Write(contents.data(), contents.size());
+  return fil;
+}
+
+TEST(CMemoryMappedFileStream, readSeek)
+{
+  const auto fil = createTestFile("0123456789");
+
+  mrpt::io::CMemoryMappedFileStream m;
+  ASSERT_TRUE(m.open(fil));
+  EXPECT_TRUE(m.fileOpenCorrectly());
+  EXPECT_EQ(m.getTotalBytesCount(), 10U);
+
+  char r[100];
+  EXPECT_EQ(m.Read(r, 4), 4U);
+  EXPECT_EQ(r[0], '0');
+  EXPECT_EQ(r[3], '3');
+  EXPECT_EQ(m.getPosition(), 4U);
+
+  m.Seek(-2, mrpt::io::CStream::sFromEnd);
+  EXPECT_EQ(m.getPosition(), 8U);
+
+  // Short read at the end of the file:
+  EXPECT_EQ(m.Read(r, 100), 2U);
+  EXPECT_EQ(r[1], '9');
+  EXPECT_TRUE(m.checkEOF());
+}
+
+TEST(CMemoryMappedFileStream, borrowReadBuffer)
+{
+  const auto fil = createTestFile("0123456789");
+
+  mrpt::io::CMemoryMappedFileStream m(fil);
+
+  // Borrowed reads alias the mapping and advance the cursor:
+  const uint8_t* p = m.borrowReadBuffer(4);
+  ASSERT_TRUE(p != nullptr);
+  EXPECT_EQ(p, static_cast<const uint8_t*>(m.getRawBufferData()));
+  EXPECT_EQ(p[0], '0');
+  EXPECT_EQ(m.getPosition(), 4U);
+
+  // Not enough bytes left => nullptr, and the cursor is left untouched:
+  EXPECT_TRUE(m.borrowReadBuffer(100) == nullptr);
+  EXPECT_EQ(m.getPosition(), 4U);
+
+  // Changing the read-ahead hint of a mapped file must be harmless:
+  m.setAccessPattern(mrpt::io::AccessPattern::Random);
+  p = m.borrowReadBuffer(6);
+  ASSERT_TRUE(p != nullptr);
+  EXPECT_EQ(p[5], '9');
+}
+
+TEST(CMemoryMappedFileStream, openErrors)
+{
+  mrpt::io::CMemoryMappedFileStream m;
+  EXPECT_FALSE(m.open("/this_file_does_not_exist_0xDEADBEEF"));
+  EXPECT_FALSE(m.fileOpenCorrectly());
+
+  // Mapping an empty file is not an error, just an immediate EOF:
+  const auto fil = createTestFile({});
+  ASSERT_TRUE(m.open(fil));
+  EXPECT_TRUE(m.fileOpenCorrectly());
+  EXPECT_EQ(m.getTotalBytesCount(), 0U);
+  char c;
+  EXPECT_EQ(m.Read(&c, 1), 0U);
+  EXPECT_TRUE(m.checkEOF());
+}
@@ -97,6 +97,19 @@ size_t CMemoryStream::Read(void* Buffer, size_t Count)
   return nToRead;
 }
 
+const uint8_t* CMemoryStream::borrowReadBuffer(size_t Count, size_t Alignment)
+{
+  // enough bytes?
+  if (m_position + Count > m_bytesWritten) return nullptr;
+
+  const auto* ptr = reinterpret_cast<const uint8_t*>(m_memory.get()) + m_position;
+  if (Alignment > 1 && (reinterpret_cast<uintptr_t>(ptr) % Alignment) != 0) return nullptr;
+
+  // Update cursor position:
+  m_position += Count;
+  return ptr;
+}
+
 size_t CMemoryStream::Write(const void* Buffer, size_t Count)
 {
   ASSERT_(Buffer != nullptr);
@@ -34,3 +34,53 @@ TEST(CMemoryStream, readwrite)
   EXPECT_EQ(nRead, 18U);
   EXPECT_EQ(r[18], '9');
 }
+
+TEST(CMemoryStream, borrowReadBuffer)
+{
+  mrpt::io::CMemoryStream buf;
+  buf.Write("1234567890", 10);
+  buf.Seek(0);
+
+  // A borrowed read aliases the internal buffer and advances the cursor:
+  const uint8_t* p = buf.borrowReadBuffer(4);
+  ASSERT_TRUE(p != nullptr);
+  EXPECT_EQ(p, static_cast<const uint8_t*>(buf.getRawBufferData()));
+  EXPECT_EQ(p[0], '1');
+  EXPECT_EQ(buf.getPosition(), 4U);
+
+  // Mixing with regular copying reads is fine:
+  char r[2];
+  EXPECT_EQ(buf.Read(r, 2), 2U);
+  EXPECT_EQ(r[0], '5');
+
+  // Not enough bytes left => nullptr, and the cursor is left untouched:
+  EXPECT_TRUE(buf.borrowReadBuffer(100) == nullptr);
+  EXPECT_EQ(buf.getPosition(), 6U);
+
+  // The remaining bytes can still be borrowed:
+  p = buf.borrowReadBuffer(4);
+  ASSERT_TRUE(p != nullptr);
+  EXPECT_EQ(p[3], '0');
+  EXPECT_EQ(buf.getPosition(), 10U);
+}
+
+TEST(CMemoryStream, vectoredReadWrite)
+{
+  mrpt::io::CMemoryStream buf;
+
+  const std::string a = "hello, ", b = "vectored ", c = "world";
+  EXPECT_EQ(
+      buf.WriteV({{a.data(), a.size()}, {b.data(), b.size()}, {c.data(), c.size()}}),
+      a.size() + b.size() + c.size());
+
+  buf.Seek(0);
+  std::string ra(a.size(), '\0'), rbc(b.size() + c.size(), '\0');
+  EXPECT_EQ(
+      buf.ReadV({{ra.data(), ra.size()}, {rbc.data(), rbc.size()}}), ra.size() + rbc.size());
+  EXPECT_EQ(ra, a);
+  EXPECT_EQ(rbc, b + c);
+
+  // Short read: only the available bytes are filled in:
+  std::string extra(10, '\0');
+  EXPECT_EQ(buf.ReadV({{extra.data(), extra.size()}}), 0U);
+}
@@ -12,11 +12,15 @@
 #include <mrpt/core/exceptions.h>
 #include <mrpt/io/CPipe.h>
 
+#include <algorithm>  // min()
+
 #ifdef _WIN32
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
 #else
+#include <limits.h>  // IOV_MAX
 #include <sys/types.h>
+#include <sys/uio.h>  // writev(), readv()
 #include <unistd.h>
 
 #include <cstdio>
@@ -231,6 +235,71 @@ size_t CPipeBaseEndPoint::Write(const void* Buffer, size_t Count)
 #endif
 }
 
+size_t CPipeBaseEndPoint::WriteV(const std::vector<mrpt::io::TBufferView>& chunks)
+{
+  ASSERTMSG_(m_pipe_file != 0, "Pipe is closed, can't write!");
+
+#ifdef _WIN32
+  // Win32 pipes have no vectored write: use the generic loop.
+  return CStream::WriteV(chunks);
+#else
+  // UNIX pipes: one writev() syscall per IOV_MAX chunks.
+  size_t total = 0;
+  std::vector<struct iovec> iov;
+  iov.reserve(chunks.size());
+  for (const auto& c : chunks)
+  {
+    if (!c.size) continue;
+    iov.push_back({const_cast<void*>(c.data), c.size});
+  }
+  for (size_t first = 0; first < iov.size(); first += IOV_MAX)
+  {
+    const auto n = std::min<size_t>(IOV_MAX, iov.size() - first);
+    size_t expected = 0;
+    for (size_t i = 0; i < n; i++) expected += iov[first + i].iov_len;
+
+    const ssize_t written = ::writev(m_pipe_file, &iov[first], static_cast<int>(n));
+    if (written < 0) return total;
+    total += static_cast<size_t>(written);
+    if (static_cast<size_t>(written) != expected) break;  // short write
+  }
+  return total;
+#endif
+}
+
+size_t CPipeBaseEndPoint::ReadV(const std::vector<mrpt::io::TMutableBufferView>& chunks)
+{
+  ASSERTMSG_(m_pipe_file != 0, "Pipe is closed, can't read!");
+
+#ifdef _WIN32
+  return CStream::ReadV(chunks);
+#else
+  // The generic loop honors the read timeouts; readv() would not:
+  if (timeout_read_start_us || timeout_read_between_us) return CStream::ReadV(chunks);
+
+  size_t total = 0;
+  std::vector<struct iovec> iov;
+  iov.reserve(chunks.size());
+  for (const auto& c : chunks)
+  {
+    if (!c.size) continue;
+    iov.push_back({c.data, c.size});
+  }
+  for (size_t first = 0; first < iov.size(); first += IOV_MAX)
+  {
+    const auto n = std::min<size_t>(IOV_MAX, iov.size() - first);
+    size_t expected = 0;
+    for (size_t i = 0; i < n; i++) expected += iov[first + i].iov_len;
+
+    const ssize_t nRead = ::readv(m_pipe_file, &iov[first], static_cast<int>(n));
+    if (nRead < 0) return total;
+    total += static_cast<size_t>(nRead);
+    if (static_cast<size_t>(nRead) != expected) break;  // short read
+  }
+  return total;
+#endif
+}
+
 //  ------------- CPipeReadEndPoint  -------------
 CPipeReadEndPoint::CPipeReadEndPoint() : CPipeBaseEndPoint() {}
 CPipeReadEndPoint::CPipeReadEndPoint(const std::string& serialized) : CPipeBaseEndPoint(serialized)
@@ -25,6 +25,33 @@ using namespace mrpt::io;
 using namespace std;
 
 CStream::~CStream() = default;
+
+size_t CStream::WriteV(const std::vector<TBufferView>& chunks)
+{
+  size_t total = 0;
+  for (const auto& c : chunks)
+  {
+    if (!c.size) continue;
+    const size_t written = Write(c.data, c.size);
+    total += written;
+    if (written != c.size) break;  // short write
+  }
+  return total;
+}
+
+size_t CStream::ReadV(const std::vector<TMutableBufferView>& chunks)
+{
+  size_t total = 0;
+  for (const auto& c : chunks)
+  {
+    if (!c.size) continue;
+    const size_t nRead = Read(c.data, c.size);
+    total += nRead;
+    if (nRead != c.size) break;  // short read
+  }
+  return total;
+}
+
 /*---------------------------------------------------------------
       Writes an elemental data type to stream.
  ---------------------------------------------------------------*/
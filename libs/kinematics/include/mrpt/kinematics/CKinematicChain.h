@@ -51,6 +51,14 @@ struct TKinematicLink
   TKinematicLink() = default;
 };
 
+/** Exact comparison of all the DH parameters of two links
+ * \note [New in MRPT 2.14.5] */
+inline bool operator==(const TKinematicLink& a, const TKinematicLink& b)
+{
+  return a.theta == b.theta && a.d == b.d && a.a == b.a && a.alpha == b.alpha &&
+         a.is_prismatic == b.is_prismatic;
+}
+
 mrpt::serialization::CArchive& operator>>(mrpt::serialization::CArchive& in, TKinematicLink& o);
 mrpt::serialization::CArchive& operator<<(
     mrpt::serialization::CArchive& out, const TKinematicLink& o);
@@ -79,6 +87,23 @@ class CKinematicChain : public mrpt::serialization::CSerializable
   /** The pose of the first link. */
   mrpt::poses::CPose3D m_origin;
 
+  /** @name Cached forward kinematics (see recomputeAllPoses())
+   * @{ */
+  /** Snapshot of the DH parameters the cached transforms were built for;
+   * comparing against m_links is what detects "dirty" joints. */
+  mutable std::vector<TKinematicLink> m_cachedLinkParams;
+  /** Local SE(3) transform of each link */
+  mutable std::vector<mrpt::poses::CPose3D> m_cachedLocal;
+  /** Cumulative global link poses (N+1 entries, [0]=origin) */
+  mutable std::vector<mrpt::poses::CPose3D> m_cachedPoses;
+  mutable mrpt::poses::CPose3D m_cachedOrigin;
+
+  /** Refreshes m_cachedPoses, rebuilding only the link transforms whose DH
+   * parameters changed since the last call and recomposing the cumulative
+   * poses from the first dirty link on. */
+  void internalUpdatePoseCache() const;
+  /** @} */
+
  public:
   /** Return the number of links */
   size_t size() const { return m_links.size(); }
@@ -183,6 +208,36 @@ class CKinematicChain : public mrpt::serialization::CSerializable
       std::vector<mrpt::poses::CPose3D>& poses,
       const mrpt::poses::CPose3D& pose0 = mrpt::poses::CPose3D()) const;
 
+  /** \overload writing the N+1 poses into a caller-provided array, without
+   * touching the heap; intended for high-rate monitoring loops.
+   *
+   *  Both overloads reuse the cached per-link transforms: only the links
+   * whose DH parameters changed since the previous call (e.g. via
+   * setConfiguration()) recompute their trigonometry, and the cumulative
+   * composition restarts at the first changed link.
+   * \note [New in MRPT 2.14.5]
+   */
+  void recomputeAllPoses(mrpt::poses::CPose3D* poses) const;
+
+  /** Batch forward kinematics: evaluates the chain over `numConfigs` joint
+   * configurations at once.
+   *
+   * \param qs Row-major `numConfigs x N` array of "q_i" values (same
+   * meaning as in setConfiguration()).
+   * \param numConfigs Number of configurations (rows of `qs`).
+   * \param outPoses Caller-provided array of `numConfigs*(N+1)` poses; row
+   * `c` receives the same N+1 poses recomputeAllPoses() would return for
+   * configuration `c`.
+   *
+   *  The per-link trigonometric terms are evaluated in tight loops across
+   * all the configurations (one sin/cos sweep per link, hoisting the
+   * constant terms), and nothing is allocated beyond a small per-link
+   * scratch buffer. The chain itself is not modified.
+   * \note [New in MRPT 2.14.5]
+   */
+  void recomputeAllPosesBatch(
+      const double* qs, size_t numConfigs, mrpt::poses::CPose3D* outPoses) const;
+
 };  // End of class def.
 
 }  // namespace kinematics
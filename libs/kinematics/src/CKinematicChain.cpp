@@ -81,6 +81,58 @@ void CKinematicChain::serializeFrom(mrpt::serialization::CArchive& in, uint8_t v
   };
 }
 
+/** Builds the SE(3) transform of one link from its DH parameters */
+static CPose3D dhLinkTransform(const TKinematicLink& l)
+{
+  const double sth = sin(l.theta), cth = cos(l.theta);
+  const double sa = sin(l.alpha), ca = cos(l.alpha);
+
+  const double t_vals[3] = {l.a * cth, l.a * sth, l.d};
+  const double r_vals[3 * 3] = {
+      cth, -sth * ca, sth * sa, sth, cth * ca, -cth * sa, 0, sa, ca};
+
+  const CMatrixDouble33 R(r_vals);
+  const CVectorFixedDouble<3> t(t_vals);
+
+  return CPose3D(R, t);
+}
+
+void CKinematicChain::internalUpdatePoseCache() const
+{
+  const size_t N = m_links.size();
+
+  size_t firstDirty;
+  if (m_cachedLinkParams.size() != N || m_cachedPoses.size() != N + 1 ||
+      !(m_cachedOrigin == m_origin))
+  {
+    // Chain structure or origin changed: rebuild everything.
+    m_cachedLinkParams = m_links;
+    m_cachedLocal.resize(N);
+    m_cachedPoses.resize(N + 1);
+    m_cachedOrigin = m_origin;
+    for (size_t i = 0; i < N; i++) m_cachedLocal[i] = dhLinkTransform(m_links[i]);
+    firstDirty = 0;
+  }
+  else
+  {
+    // Rebuild only the links whose DH parameters changed:
+    firstDirty = N;
+    for (size_t i = 0; i < N; i++)
+    {
+      if (m_cachedLinkParams[i] == m_links[i]) continue;
+      m_cachedLocal[i] = dhLinkTransform(m_links[i]);
+      m_cachedLinkParams[i] = m_links[i];
+      if (firstDirty == N) firstDirty = i;
+    }
+    if (firstDirty == N) return;  // Cache already up to date
+  }
+
+  // Recompose the cumulative poses from the first dirty link on:
+  m_cachedPoses[0] = m_origin;
+  for (size_t i = firstDirty; i < N; i++)
+    m_cachedPoses[i + 1].composeFrom(m_cachedPoses[i], m_cachedLocal[i]);
+}
+
 /** Go thru all the links of the chain and compute the global pose of each link.
  * The "ground" link pose "pose0" defaults to the origin of coordinates,
  * but anything else can be passed as the optional argument. */
@@ -88,42 +140,68 @@ void CKinematicChain::recomputeAllPoses(
     std::vector<mrpt::poses::CPose3D>& poses,
     [[maybe_unused]] const mrpt::poses::CPose3D& pose0) const
 {
+  poses.resize(m_links.size() + 1);
+  recomputeAllPoses(poses.data());
+}
+
+void CKinematicChain::recomputeAllPoses(mrpt::poses::CPose3D* poses) const
+{
+  internalUpdatePoseCache();
   const size_t N = m_links.size();
+  for (size_t i = 0; i <= N; i++) poses[i] = m_cachedPoses[i];
+}
 
-  poses.resize(N + 1);
+void CKinematicChain::recomputeAllPosesBatch(
+    const double* qs, size_t numConfigs, mrpt::poses::CPose3D* outPoses) const
+{
+  const size_t N = m_links.size();
+  const size_t stride = N + 1;
 
-  CPose3D p = m_origin;  // Cummulative pose
+  for (size_t c = 0; c < numConfigs; c++) outPoses[c * stride] = m_origin;
 
-  poses[0] = p;
+  // Per-link scratch for the per-configuration trigonometric terms:
+  std::vector<double> sth(numConfigs), cth(numConfigs);
 
   for (size_t i = 0; i < N; i++)
   {
-    // Build the 3D pose change of the i'th link:
-    const double th = m_links[i].theta;
-    const double alpha = m_links[i].alpha;
-    const double d = m_links[i].d;
-    const double a = m_links[i].a;
-
-    const double t_vals[3] = {a * cos(th), a * sin(th), d};
-    const double r_vals[3 * 3] = {
-        cos(th),
-        -sin(th) * cos(alpha),
-        sin(th) * sin(alpha),
-        sin(th),
-        cos(th) * cos(alpha),
-        -cos(th) * sin(alpha),
-        0,
-        sin(alpha),
-        cos(alpha)};
-
-    const CMatrixDouble33 R(r_vals);
-    const CVectorFixedDouble<3> t(t_vals);
-
-    CPose3D link(R, t);
-
-    p.composeFrom(p, link);
-
-    poses[i + 1] = p;
+    const TKinematicLink& l = m_links[i];
+    const double sa = sin(l.alpha), ca = cos(l.alpha);
+
+    if (l.is_prismatic)
+    {
+      // theta is constant across the whole batch:
+      const double s0 = sin(l.theta), c0 = cos(l.theta);
+      for (size_t c = 0; c < numConfigs; c++)
+      {
+        sth[c] = s0;
+        cth[c] = c0;
+      }
+    }
+    else
+    {
+      // One tight sin/cos sweep over all the configurations:
+      for (size_t c = 0; c < numConfigs; c++)
+      {
+        const double th = qs[c * N + i];
+        sth[c] = sin(th);
+        cth[c] = cos(th);
+      }
+    }
+
+    for (size_t c = 0; c < numConfigs; c++)
+    {
+      const double d = l.is_prismatic ? qs[c * N + i] : l.d;
+      const double s = sth[c], ct = cth[c];
+
+      const double t_vals[3] = {l.a * ct, l.a * s, d};
+      const double r_vals[3 * 3] = {ct, -s * ca, s * sa, s, ct * ca, -ct * sa, 0, sa, ca};
+
+      const CMatrixDouble33 R(r_vals);
+      const CVectorFixedDouble<3> t(t_vals);
+      const CPose3D link(R, t);
+
+      outPoses[c * stride + i + 1].composeFrom(outPoses[c * stride + i], link);
+    }
   }
 }
 
@@ -224,6 +302,9 @@ void CKinematicChain::clear()
 {
   m_links.clear();
   m_last_gl_objects.clear();
+  m_cachedLinkParams.clear();
+  m_cachedLocal.clear();
+  m_cachedPoses.clear();
 }
 
 mrpt::serialization::CArchive& mrpt::kinematics::operator>>(
@@ -189,6 +189,13 @@ class CBeaconMap : public mrpt::maps::CMetricMap
      * when creating the Gaussians.
      */
     float SOG_separationConstant{3.0f};
+
+    /** Maximum KL-divergence between two modes of a beacon SOG to merge
+     * them after each update (Runnalls' criterion, see
+     * mrpt::poses::CPointPDFSOG::mergeModes). Set to 0 to disable mode
+     * merging (default=0.5). \note [New in MRPT 2.14.5]
+     */
+    double SOG_mergeMaxKLd{0.5};
   } insertionOptions;
 
   /** Save to a MATLAB script which displays 3D error ellipses for the map.
@@ -11,14 +11,20 @@
 
 #include <mrpt/config/CLoadableOptions.h>
 #include <mrpt/containers/CDynamicGrid.h>
+#include <mrpt/core/bits_math.h>
 #include <mrpt/img/color_maps.h>
 #include <mrpt/maps/CHeightGridMap2D_Base.h>
 #include <mrpt/maps/CMetricMap.h>
+#include <mrpt/math/CMatrixDynamic.h>
+#include <mrpt/math/TPoint3D.h>
 #include <mrpt/obs/obs_frwds.h>
 #include <mrpt/poses/poses_frwds.h>
 #include <mrpt/serialization/CSerializable.h>
 #include <mrpt/typemeta/TEnumType.h>
 
+#include <cmath>
+#include <vector>
+
 namespace mrpt
 {
 namespace maps
@@ -150,6 +156,19 @@ class CHeightGridMap2D :
       const double z,
       const CHeightGridMap2D_Base::TPointInsertParams& params =
           CHeightGridMap2D_Base::TPointInsertParams()) override;
+
+  /** Bulk insertion of a batch of 3D points, equivalent to calling
+   * insertIndividualPoint() for each one but much faster for large clouds
+   * (e.g. survey DEMs): the grid is resized only once, to the bounding box
+   * of all the points, and the cell updates then run in parallel over
+   * disjoint row bands of the grid.
+   * \return The number of points used to update cells (points discarded by
+   * insertionOptions.filterByHeight are not counted).
+   * \note [New in MRPT 2.14.5] \sa insertIndividualPoint */
+  size_t insertPoints(
+      const std::vector<mrpt::math::TPoint3D>& pts,
+      const CHeightGridMap2D_Base::TPointInsertParams& params =
+          CHeightGridMap2D_Base::TPointInsertParams());
   double dem_get_resolution() const override;
   size_t dem_get_size_x() const override;
   size_t dem_get_size_y() const override;
@@ -168,6 +187,52 @@ class CHeightGridMap2D :
   double internal_computeObservationLikelihood(
       const mrpt::obs::CObservation& obs, const mrpt::poses::CPose3D& takenFrom) const override;
 
+ private:
+  /** Core of insertIndividualPoint(): update the running average/variance
+   * of one cell with a new height sample.
+   * \return false if the sample was discarded by the filterByHeight option.
+   */
+  inline bool internal_insertZ(THeightGridmapCell& cell, const float z)
+  {
+    if (insertionOptions.filterByHeight &&
+        (z < insertionOptions.z_min || z > insertionOptions.z_max))
+      return false;
+    cell.u += z;
+    cell.v += z * z;
+    if (!cell.w)
+    {
+      cell.h = z;  // First observation
+      cell.w = 1;
+    }
+    else
+    {
+      float W = cell.w++;  // W = N-1
+      cell.h = (cell.h * W + z) / cell.w;
+      if (W > 0) cell.var = (cell.v - mrpt::d2f(std::pow(cell.u, 2)) / cell.w) / W;
+    }
+    return true;
+  }
+
+  /** @name Dirty-tile tracking, so getVisualizationInto() only refreshes
+   * the mesh patches actually modified since the last call.
+   *  @{ */
+  /** Cells per tile side */
+  static constexpr size_t MESH_TILE_SIZE = 32;
+  mutable bool m_meshCacheValid{false};
+  /** One entry per tile; nonzero = must be refreshed in the cache */
+  mutable std::vector<uint8_t> m_dirtyTiles;
+  mutable mrpt::math::CMatrixFloat m_meshCacheZ, m_meshCacheMask;
+
+  /** Flags as dirty the mesh tile containing the given cell */
+  inline void markDirtyCell(size_t cx, size_t cy, std::vector<uint8_t>& dirtyTiles) const
+  {
+    const size_t tiles_x = (m_size_x + MESH_TILE_SIZE - 1) / MESH_TILE_SIZE;
+    const size_t idx = (cy / MESH_TILE_SIZE) * tiles_x + cx / MESH_TILE_SIZE;
+    if (idx < dirtyTiles.size()) dirtyTiles[idx] = 1;
+  }
+  /** @} */
+
+ public:
   MAP_DEFINITION_START(CHeightGridMap2D)
   /** See CHeightGridMap2D::CHeightGridMap2D */
   double min_x{-2}, max_x{2}, min_y{-2}, max_y{2}, resolution{0.10f};
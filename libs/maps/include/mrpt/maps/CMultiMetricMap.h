@@ -9,11 +9,15 @@
 #pragma once
 
 #include <mrpt/config/CLoadableOptions.h>
+#include <mrpt/core/WorkerThreadsPool.h>
 #include <mrpt/maps/CMetricMap.h>
 #include <mrpt/obs/obs_frwds.h>
 #include <mrpt/serialization/CSerializable.h>
 #include <mrpt/typemeta/TEnumType.h>
 
+#include <array>
+#include <mutex>
+
 namespace mrpt::maps
 {
 class TSetOfMetricMapInitializers;
@@ -197,6 +201,43 @@ class CMultiMetricMap : public mrpt::maps::CMetricMap
    * initializers (current maps will be deleted) */
   void setListOfMaps(const mrpt::maps::TSetOfMetricMapInitializers& init);
 
+  /** @name Optional parallel observation insertion
+    @{ */
+
+  /** Enables/disables dispatching insertObservation() calls for the
+   * contained maps in parallel onto an internal mrpt::WorkerThreadsPool,
+   * instead of inserting sequentially into one map after the other.
+   *
+   * The contained maps are independent containers with no shared state
+   * during insertion, so each worker touches one map only. It is the
+   * responsibility of the caller to make sure no other thread is using
+   * the maps while an insertion is ongoing.
+   *
+   * \param enable Whether to use the thread pool.
+   * \param numThreads Number of worker threads; `0` means one per
+   *        contained map at the time of the first parallel insertion
+   *        (capped to std::thread::hardware_concurrency()).
+   *
+   * Disabled by default. This setting is not serialized.
+   */
+  void enableParallelInsertion(bool enable, std::size_t numThreads = 0);
+
+  /** Returns whether parallel insertion was enabled with
+   * enableParallelInsertion() */
+  bool parallelInsertionEnabled() const { return m_insertionPoolRequested; }
+
+  /** While parallel insertion is enabled, insertObservation() may itself be
+   * invoked concurrently for different observations (e.g. from
+   * CSensoryFrame::insertObservationsIntoParallel()): each contained map is
+   * guarded by its own lock, so inserts for different (observation, map)
+   * pairs overlap and inserts into the same contained map serialize. Note
+   * that the per-map insertion *order* then becomes unspecified.
+   * \note [New in MRPT 2.14.5]
+   */
+  bool insertionIsThreadSafe() const override { return m_insertionPoolRequested; }
+
+  /** @} */
+
   // Implementation of virtual CMetricMap methods.
   // See docs in base class:
 
@@ -230,6 +271,25 @@ class CMultiMetricMap : public mrpt::maps::CMetricMap
   double internal_computeObservationLikelihood(
       const mrpt::obs::CObservation& obs, const mrpt::poses::CPose3D& takenFrom) const override;
 
+ private:
+  /** See enableParallelInsertion(). Shared between copies of this object,
+   * which is safe: the pool itself holds no map state. */
+  std::shared_ptr<mrpt::WorkerThreadsPool> m_insertionPool;
+  bool m_insertionPoolRequested = false;
+  std::size_t m_insertionPoolNumThreads = 0;
+
+  /** Locks supporting concurrent insertObservation() callers (see
+   * insertionIsThreadSafe()): one setup mutex for the lazy pool creation,
+   * and a fixed set of per-contained-map mutexes indexed by map pointer
+   * hash. Shared between copies, like the pool; a hash collision merely
+   * over-serializes. */
+  struct TParallelInsertAux
+  {
+    std::mutex setupMtx;
+    std::array<std::mutex, 16> perMapMtx;
+  };
+  std::shared_ptr<TParallelInsertAux> m_insertionAux;
+
 };  // End of class def.
 
 }  // namespace mrpt::maps
@@ -25,6 +25,15 @@
 #include <mrpt/tfest/TMatchingPair.h>
 #include <mrpt/typemeta/TEnumType.h>
 
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace mrpt
+{
+class WorkerThreadsPool;
+}
+
 namespace mrpt::maps
 {
 /** A class for storing an occupancy grid map.
@@ -95,6 +104,42 @@ class COccupancyGridMap2D :
   mutable std::vector<double> m_precomputedLikelihood;
   mutable bool m_likelihoodCacheOutDated{true};
 
+  /** Lazily-built Euclidean distance transform (EDT) of the obstacle
+   * cells: same row-major layout as m_map, distances in meters, capped at
+   * the value passed to distanceTransform(). \sa distanceTransform() */
+  mutable std::vector<float> m_distanceTransform;
+  /** The cap distance [m] m_distanceTransform was built for */
+  mutable float m_distanceTransformMaxDist{0};
+  /** Whole-map invalidation flag for m_distanceTransform */
+  mutable bool m_distanceTransformOutDated{true};
+  /** Cell rectangle (cx0,cx1,cy0,cy1) touched by insertions since the EDT
+   * was last refreshed; empty if cx0>cx1. \sa distanceTransform() */
+  mutable int m_dtDirtyCx0{1}, m_dtDirtyCx1{0}, m_dtDirtyCy0{1}, m_dtDirtyCy1{0};
+
+  /** Accumulates the given cell rectangle into the dirty area pending an
+   * incremental refresh of the cached EDT. \sa distanceTransform() */
+  void markDistanceTransformDirtyCells(int cx0, int cx1, int cy0, int cy1) const;
+
+  /** Per-tile modification counters (row-major, m_tileCntSizeX columns);
+   * lazily (re)allocated when the grid size in tiles changes.
+   * \sa getTileChangeCounters() */
+  mutable std::vector<uint32_t> m_tileChangeCnt;
+  mutable unsigned int m_tileCntSizeX{0}, m_tileCntSizeY{0};
+
+  /** (Re)allocates m_tileChangeCnt if the grid size in tiles changed */
+  void ensureTileChangeCounters() const;
+
+  /** Bumps the change counter of every tile overlapping the given cell
+   * rectangle \sa getTileChangeCounters() */
+  void markTileChangedCells(int cx0, int cx1, int cy0, int cy1) const;
+
+  /** Recomputes m_distanceTransform inside the [ox0,ox1]x[oy0,oy1] cell
+   * rectangle, reading obstacle data from the larger [wx0,wx1]x[wy0,wy1]
+   * window (which must extend the output rect by at least
+   * ceil(maxDist/resolution) cells, or reach the map borders). */
+  void rebuildDistanceTransformWindow(
+      int wx0, int wx1, int wy0, int wy1, int ox0, int ox1, int oy0, int oy1, float maxDist) const;
+
   /** Used for Voronoi calculation.Same struct as "map", but contains a "0" if
    * not a basis point. */
   mrpt::containers::CDynamicGrid<uint8_t> m_basis_map;
@@ -216,6 +261,29 @@ class COccupancyGridMap2D :
 
   mutable TUpdateCellsInfoChangeOnly updateInfoChangeOnly;
 
+  /** Side length, in cells, of the square tiles used by the per-tile change
+   * counters \sa getTileChangeCounters */
+  static constexpr unsigned int CHANGE_COUNTER_TILE_SIZE = 64;
+
+  /** Per-tile modification counters: the grid is divided into square tiles
+   * of CHANGE_COUNTER_TILE_SIZE cells per side, and every observation
+   * insertion, updateCell() or fill() bumps the counter of the touched
+   * tiles. Clients that derive expensive per-area products from the grid
+   * (e.g. mrpt::slam::COccupancyGridMapFeatureExtractor) can snapshot the
+   * counters and later re-process only the tiles whose counter changed.
+   *
+   *  The vector is row-major with getTileChangeCountX() columns, and is
+   * reallocated (all counters reset) whenever the grid dimensions change,
+   * so clients must also compare the grid geometry against their snapshot.
+   * \note [New in MRPT 2.14.5]
+   */
+  const std::vector<uint32_t>& getTileChangeCounters() const;
+
+  /** Number of tile columns in getTileChangeCounters() */
+  unsigned int getTileChangeCountX() const;
+  /** Number of tile rows in getTileChangeCounters() */
+  unsigned int getTileChangeCountY() const;
+
   /** Fills all the cells with a default value. */
   void fill(float default_value = 0.5f);
 
@@ -491,6 +559,18 @@ class COccupancyGridMap2D :
     /** Enabled: Rays widen with distance to approximate the real behavior
      * of lasers, disabled: insert rays as simple lines (Default=false) */
     bool wideningBeamsWithDistance{false};
+    /** If enabled, the simple-rays insertion path traces all rays first
+     * into per-sector buffers, sorts the touched cells in row-major
+     * order, and applies the aggregated updates in one cache-friendly
+     * sweep over the grid, instead of updating one cell at a time while
+     * striding across the whole map. Results are identical to the default
+     * path except for cells driven into log-odds saturation, where the
+     * update order differs. (Default=false) */
+    bool batchSortedRayUpdates{false};
+    /** Number of worker threads used to trace the angular sectors in the
+     * batched insertion path (only used if batchSortedRayUpdates=true).
+     * (Default=1) */
+    uint16_t insertionNumThreads{1};
   };
 
   /** With this struct options are provided to the observation insertion
@@ -556,6 +636,16 @@ class COccupancyGridMap2D :
      * where the likelihood of the whole range scan is computed by
      * "averaging" of individual ranges, instead of by the "product". */
     bool LF_alternateAverageMethod{false};
+    /** [LikelihoodField] (Default:false) Evaluate the likelihood field
+     * for all the scan points in one batch, replacing the per-point
+     * libm exp()/log() calls with vectorized polynomial approximations
+     * (relative error ~1e-6) on CPUs supporting SSE2. */
+    bool LF_useVectorizedEval{false};
+    /** [LikelihoodField] (Default:false) Take the closest-obstacle
+     * distance of each scan point from the incrementally-maintained
+     * distance transform (see distanceTransform()) instead of running a
+     * windowed search around the cell. */
+    bool LF_useDistanceTransform{false};
     /** [MI] The exponent in the MI likelihood computation. Default value =
      * 5 */
     float MI_exponent{2.5f};
@@ -909,6 +999,21 @@ class COccupancyGridMap2D :
   double computeLikelihoodField_II(
       const CPointsMap* pm, const mrpt::poses::CPose2D* relativePose = nullptr) const;
 
+  /** Returns the Euclidean distance transform (EDT) of the obstacle cells
+   * (those with occupancy < 0.5): for each cell, the distance [m] from its
+   * center to the center of the closest obstacle cell, saturated to
+   * `maxDist`. Same row-major layout as the occupancy data.
+   *
+   * The field is built lazily with Felzenszwalb's O(N) algorithm on the
+   * first call, and refreshed incrementally afterwards: insertions only
+   * trigger a recomputation of the dirty cell rectangle they touched
+   * (expanded by a `maxDist` margin), so repeated likelihood evaluations
+   * between map updates become single array lookups.
+   * (New in MRPT 2.14.5)
+   * \sa TLikelihoodOptions::LF_useDistanceTransform
+   */
+  const std::vector<float>& distanceTransform(float maxDist) const;
+
   /** Saves the gridmap as a graphical file (BMP,PNG,...).
    * The format will be derived from the file extension (see
    * CImage::saveToFile )
@@ -1147,6 +1252,13 @@ class COccupancyGridMap2D :
   // See docs in base class
   double internal_computeObservationLikelihood(
       const mrpt::obs::CObservation& obs, const mrpt::poses::CPose3D& takenFrom) const override;
+
+  /** Batched implementation of computeLikelihoodField_Thrun(), used when
+   * likelihoodOptions.LF_useVectorizedEval is enabled: closest-obstacle
+   * distances are gathered for the whole scan first, then the exp()/log()
+   * evaluation runs over the packed batch with SIMD approximations. */
+  double computeLikelihoodField_Thrun_batch(
+      const CPointsMap* pm, const mrpt::poses::CPose2D* relativePose) const;
   // See docs in base class
   bool internal_canComputeObservationLikelihood(const mrpt::obs::CObservation& obs) const override;
 
@@ -1169,6 +1281,34 @@ class COccupancyGridMap2D :
    */
   int direction2idx(int dx, int dy);
 
+  /** Implements the opt-in batched insertion path for the "simple rays"
+   * method (TInsertionOptions::batchSortedRayUpdates): rays are traced
+   * first, possibly in parallel per angular sector, into lists of touched
+   * cell indices, which are then sorted and applied to the grid as
+   * aggregated log-odds updates in a single, cache-friendly sweep.
+   * \sa internal_insertObservation
+   */
+  void insertScanAsSortedCellLists(
+      const mrpt::obs::CObservation2DRangeScan& scan,
+      const float* scanPoints_x,
+      const float* scanPoints_y,
+      size_t nRanges,
+      int K,
+      int cx0,
+      int cy0,
+      float maxDistanceInsertion,
+      bool invalidAsFree,
+      cellType logodd_observation_free,
+      cellType logodd_noecho_free,
+      cellType logodd_observation_occupied,
+      cellType logodd_thres_free,
+      cellType logodd_thres_occupied);
+
+  /** Lazily-created pool used by the batched ray insertion path
+   * (TInsertionOptions::batchSortedRayUpdates). Shared between copies of
+   * the map; it holds no map state. */
+  std::shared_ptr<mrpt::WorkerThreadsPool> m_batchInsertPool;
+
   MAP_DEFINITION_START(COccupancyGridMap2D)
   /** See COccupancyGridMap2D::COccupancyGridMap2D */
   float min_x{-10.0f}, max_x{10.0f}, min_y{-10.0f}, max_y{10.0f}, resolution{0.10f};
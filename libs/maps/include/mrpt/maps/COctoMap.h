@@ -15,6 +15,8 @@
 #include <mrpt/maps/COctoMapBase.h>
 #include <mrpt/obs/obs_frwds.h>
 
+#include <memory>
+
 namespace octomap
 {
 class OcTree;
@@ -47,6 +49,11 @@ class COctoMap : public COctoMapBase<octomap::OcTree, octomap::OcTreeNode>
   COctoMap(const double resolution = 0.10);  //!< Default constructor
   ~COctoMap() override;                      //!< Destructor
 
+  /** Regenerates \a gl_obj from the current octree contents. When the same
+   * \a gl_obj is refreshed repeatedly (e.g. a live 3D view), only the voxels
+   * whose octree key changed since the previous call are patched in-place in
+   * the existing buffers, instead of rebuilding the whole object.
+   * \note [New in MRPT 2.14.5: incremental refresh] */
   void getAsOctoMapVoxels(mrpt::opengl::COctoMapVoxels& gl_obj) const override;
 
   MAP_DEFINITION_START(COctoMap)
@@ -77,6 +84,10 @@ class COctoMap : public COctoMapBase<octomap::OcTree, octomap::OcTreeNode>
   /** Check whether the given point lies within the volume covered by the
    * octomap (that is, whether it is "mapped") */
   bool isPointWithinOctoMap(const float x, const float y, const float z) const;
+
+  /** Bookkeeping for incremental getAsOctoMapVoxels() exports (opaque,
+   * defined in the implementation file) */
+  struct TVoxelExportCache;
   double getResolution() const;
   unsigned int getTreeDepth() const;
   /// \return The number of nodes in the tree
@@ -129,6 +140,10 @@ class COctoMap : public COctoMapBase<octomap::OcTree, octomap::OcTreeNode>
   bool internal_insertObservation(
       const mrpt::obs::CObservation& obs,
       const std::optional<const mrpt::poses::CPose3D>& robotPose = std::nullopt) override;
+
+ private:
+  /** \sa getAsOctoMapVoxels */
+  mutable std::unique_ptr<TVoxelExportCache> m_voxelExportCache;
 };  // End of class def.
 }  // namespace maps
 }  // namespace mrpt
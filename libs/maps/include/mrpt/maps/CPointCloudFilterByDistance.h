@@ -13,7 +13,9 @@
 #include <mrpt/maps/CSimplePointsMap.h>
 #include <mrpt/poses/CPose3D.h>
 
+#include <cstdint>
 #include <map>
+#include <unordered_set>
 
 namespace mrpt::maps
 {
@@ -73,6 +75,12 @@ class CPointCloudFilterByDistance : public mrpt::maps::CPointCloudFilterBase
   {
     mrpt::poses::CPose3D pose;
     mrpt::maps::CSimplePointsMap::Ptr pc;
+
+    /** Coarse occupied-voxel hash of `pc`, used by filter() as an early-out
+     * before querying the KD-tree; rebuilt lazily when the voxel size in
+     * effect (a function of TOptions::min_dist) changes. */
+    std::unordered_set<uint64_t> coarseVoxels;
+    double coarseVoxelSize = 0;
   };
 
   std::map<mrpt::system::TTimeStamp, FrameInfo> m_last_frames;
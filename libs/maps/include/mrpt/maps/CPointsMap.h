@@ -27,6 +27,7 @@
 #include <mrpt/serialization/CSerializable.h>
 
 #include <iosfwd>
+#include <unordered_map>
 
 // Add for declaration of mexplus::from template specialization
 DECLARE_MEXPLUS_FROM(mrpt::maps::CPointsMap)
@@ -144,6 +145,10 @@ class CPointsMap :
    * size of the map. This method is more
    *  efficient than constantly increasing the size of the buffers. Refer to
    * the STL C++ library's "reserve" methods.
+   *
+   * \note [New in MRPT 2.14.5] The point buffers use mrpt::aligned_malloc(),
+   * so large reservations become hugepage-backed once
+   * mrpt::enable_hugepage_allocations() is active.
    */
   virtual void reserve(size_t newLength) = 0;
 
@@ -351,6 +356,30 @@ class CPointsMap :
       const mrpt::poses::CPose3D& otherPose,
       const bool filterOutPointsAtZero = false);
 
+  /** \overload Move version: when this map is empty and no filtering is
+   * requested, the point buffers are stolen from `otherMap` (no per-point
+   * copies; `otherMap` is left empty), and the transformation is applied
+   * in place. Falls back to the copying overload otherwise.
+   * \note Unlike the copying overload, NAN points are not filtered out.
+   * (New in MRPT 2.14.5)
+   */
+  void insertAnotherMap(
+      CPointsMap&& otherMap,
+      const mrpt::poses::CPose3D& otherPose,
+      const bool filterOutPointsAtZero = false);
+
+  /** Replaces the contents of this map with the given structure-of-arrays
+   * XYZ buffers, which are moved in without copying the per-point data
+   * (all three sizes must match). Class-specific per-point fields (color,
+   * intensity, etc.) are filled with default values.
+   * (New in MRPT 2.14.5)
+   * \sa mrpt::obs::CObservationPointCloud::fromXYZBuffers
+   */
+  void setFromXYZBuffers(
+      mrpt::aligned_std_vector<float>&& xs,
+      mrpt::aligned_std_vector<float>&& ys,
+      mrpt::aligned_std_vector<float>&& zs);
+
   /** Inserts another map into this one. \sa insertAnotherMap() */
   void operator+=(const CPointsMap& anotherMap)
   {
@@ -661,7 +690,7 @@ class CPointsMap :
 	inline void insertPoint(float x, float y, float z = 0)
 	{
 		insertPointFast(x, y, z);
-		mark_as_modified();
+		mark_as_modified_insertion(x, y, z);
 	}
 	/// \overload
 	inline void insertPoint(const mrpt::math::TPoint3D& p)
@@ -704,7 +733,7 @@ class CPointsMap :
 		if (cG && !cG->empty() && hasField_color_G()) insertPointField_color_G((*cG)[i]);
 		if (cB && !cB->empty() && hasField_color_B()) insertPointField_color_B((*cB)[i]);
 
-		mark_as_modified();
+		mark_as_modified_insertion(xs[i], ys[i], zs[i]);
 	}
 
 	/** Set all the points at once from vectors with X,Y and Z coordinates (if Z
@@ -969,6 +998,24 @@ class CPointsMap :
 	 */
 	mrpt::math::TBoundingBoxf boundingBox() const override;
 
+	/** Per-point estimated 2D unit normals, as returned by pointNormals2D().
+	 * Entries are (0,0) for points whose neighborhood was too small or
+	 * degenerate to estimate a normal from. */
+	struct TPointNormals2D
+	{
+		mrpt::aligned_std_vector<float> nx, ny;
+	};
+
+	/** Returns per-point 2D unit normals, estimated for each point as the
+	 * direction of least spread (the smallest-eigenvalue eigenvector of the
+	 * 2x2 covariance) of its \a knn nearest neighbors in the XY plane.
+	 * Results are cached and recomputed lazily only after the map is
+	 * modified, so the covariance pass runs once per insertion batch no
+	 * matter how often the normals are queried (e.g. from the point-to-plane
+	 * ICP variant in mrpt::slam::CICP). (New in MRPT 2.14.5)
+	 */
+	const TPointNormals2D& pointNormals2D(size_t knn = 8) const;
+
 	/** Extracts the points in the map within a cylinder in 3D defined the
 	 * provided radius and zmin/zmax values.
 	 */
@@ -1150,7 +1197,34 @@ class CPointsMap :
 	{
 		m_largestDistanceFromOriginIsUpdated = false;
 		m_boundingBoxIsUpdated = false;
+		m_tileIndexIsUpdated = false;
+		m_pointNormals2D_knn = 0;
+		kdtree_mark_as_outdated();
+	}
+
+	/** Like mark_as_modified(), but for the special case of having just
+	 * appended ONE new point (already stored in the buffers): a valid cached
+	 * bounding box is extended with the new point instead of being
+	 * invalidated, so streams of individual insertions no longer force a full
+	 * rescan on the next boundingBox() call.
+	 * \note [New in MRPT 2.14.5] */
+	inline void mark_as_modified_insertion(float x, float y, float z) const
+	{
+		m_largestDistanceFromOriginIsUpdated = false;
+		m_tileIndexIsUpdated = false;
+		m_pointNormals2D_knn = 0;
 		kdtree_mark_as_outdated();
+		if (!m_boundingBoxIsUpdated) return;
+		if (this->size() == 1)
+		{
+			// First point: the cached box was the (0,0,0) empty-map
+			// placeholder, not a real extent.
+			m_boundingBox.min = m_boundingBox.max = {x, y, z};
+		}
+		else
+		{
+			m_boundingBox.updateWithPoint({x, y, z});
+		}
 	}
 
 	/** Returns a short description of the map. */
@@ -1175,6 +1249,14 @@ class CPointsMap :
 	[[nodiscard]] bool nn_single_search(
 		const mrpt::math::TPoint2Df& query, mrpt::math::TPoint2Df& result,
 		float& out_dist_sqr, uint64_t& resultIndexOrID) const override;
+	[[nodiscard]] bool nn_single_search_approx(
+		const mrpt::math::TPoint3Df& query, mrpt::math::TPoint3Df& result,
+		float& out_dist_sqr, uint64_t& resultIndexOrID,
+		float maxSearchDistanceSqr, float epsilon = .0f) const override;
+	[[nodiscard]] bool nn_single_search_approx(
+		const mrpt::math::TPoint2Df& query, mrpt::math::TPoint2Df& result,
+		float& out_dist_sqr, uint64_t& resultIndexOrID,
+		float maxSearchDistanceSqr, float epsilon = .0f) const override;
 	void nn_multiple_search(
 		const mrpt::math::TPoint3Df& query, const size_t N,
 		std::vector<mrpt::math::TPoint3Df>& results,
@@ -1219,6 +1301,22 @@ class CPointsMap :
 	mutable bool m_boundingBoxIsUpdated;
 	mutable mrpt::math::TBoundingBoxf m_boundingBox;
 
+	/** Coarse tile-occupancy summary: point indices grouped into fixed-size
+	 * 3D tiles, built lazily by tileOccupancyIndex() and invalidated by
+	 * mark_as_modified(). Used to accelerate box queries (extractPoints())
+	 * on large maps without a full scan per query.
+	 * \note [New in MRPT 2.14.5] */
+	mutable std::unordered_map<uint64_t, std::vector<uint32_t>> m_tileIndex;
+	mutable bool m_tileIndexIsUpdated{false};
+
+	/** Returns the coarse tile-occupancy index, rebuilding it first if
+	 * outdated. \sa m_tileIndex */
+	const std::unordered_map<uint64_t, std::vector<uint32_t>>& tileOccupancyIndex() const;
+
+	/** Cache for pointNormals2D(); m_pointNormals2D_knn==0 means outdated */
+	mutable TPointNormals2D m_pointNormals2D;
+	mutable size_t m_pointNormals2D_knn{0};
+
 	/** This is a common version of CMetricMap::insertObservation() for point
 	 * maps (actually, CMetricMap::internal_insertObservation),
 	 *   so derived classes don't need to worry implementing that method unless
@@ -1247,6 +1345,13 @@ class CPointsMap :
 	void PLY_import_set_vertex(
 		size_t idx, const mrpt::math::TPoint3Df& pt,
 		const mrpt::img::TColorf* pt_color = nullptr) override;
+
+	/** Bulk version used by the fast binary PLY import path: writes the
+	 * block straight into the m_x/m_y/m_z columns. */
+	void PLY_import_set_vertex_block(
+		size_t first_idx, size_t num_pts, const mrpt::math::TPoint3Df* pts,
+		const mrpt::img::TColorf* colors) override;
+
 	void PLY_import_set_vertex_timestamp(
 		[[maybe_unused]] size_t idx,
 		[[maybe_unused]] const double unixTimestamp) override
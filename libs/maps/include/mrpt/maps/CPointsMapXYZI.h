@@ -89,6 +89,30 @@ class CPointsMapXYZI : public CPointsMap
 
   bool saveToKittiVelodyneFile(const std::string& filename) const;
 
+  /** Erases the map and loads it from a whole stereo disparity image in one
+   * batched, per-row-threaded pass: each pixel of `disparity` (in pixels,
+   * with the dimensions of `obs.leftCamera`) is back-projected through the
+   * left camera intrinsics and the stereo baseline, transformed by
+   * `obs.cameraPose`, and inserted with the intensity of the corresponding
+   * left image pixel (in [0,1]; `1.0` if the left image is empty or does
+   * not match the disparity size).
+   *
+   * Pixels with disparity below `minDisparity` are skipped, as are depths
+   * beyond `maxRange` (if `maxRange>0`).
+   *
+   * \param decimation Use every N-th row & column only (default=1: all).
+   * \param numThreads Worker threads for the row stripes; 0 (default) uses
+   * all hardware threads, 1 disables threading.
+   * \note [New in MRPT 2.14.5]
+   */
+  void loadFromStereoDisparity(
+      const mrpt::obs::CObservationStereoImages& obs,
+      const mrpt::math::CMatrixFloat& disparity,
+      const float minDisparity = 0.1f,
+      const float maxRange = .0f,
+      const unsigned int decimation = 1,
+      const unsigned int numThreads = 0);
+
   /** See CPointsMap::loadFromRangeScan() */
   void loadFromRangeScan(
       const mrpt::obs::CObservation2DRangeScan& rangeScan,
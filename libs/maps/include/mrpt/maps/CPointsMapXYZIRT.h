@@ -9,6 +9,7 @@
 #pragma once
 
 #include <mrpt/maps/CPointsMap.h>
+#include <mrpt/obs/CObservationVelodyneScan.h>
 #include <mrpt/obs/obs_frwds.h>
 #include <mrpt/opengl/pointcloud_adapters.h>
 #include <mrpt/serialization/CSerializable.h>
@@ -114,6 +115,31 @@ class CPointsMapXYZIRT : public CPointsMap
       const mrpt::obs::CObservation3DRangeScan& rangeScan,
       const std::optional<const mrpt::poses::CPose3D>& robotPose = std::nullopt) override;
 
+  /** Like CPointsMap::loadFromVelodyneScan(), but decoding the raw Velodyne
+   * packets straight into this map's XYZIRT structure-of-arrays vectors
+   * via mrpt::obs::CObservationVelodyneScan::decodePacket(), bypassing both
+   * `scan.point_cloud` and the per-point virtual interface of
+   * PointCloudStorageWrapper.
+   *
+   * Packets are decoded by parallel worker threads (`numThreads=0` means
+   * use all CPU cores, `1` disables threading); the resulting map is
+   * identical regardless of the thread count.
+   * Points are transformed with `robotPose + scan.sensorPose` (or just
+   * `scan.sensorPose` if no robotPose is given); intensities are stored in
+   * [0,1]; `ring` holds the laser id; and per-point `time` follows the same
+   * convention than insertObservation(): seconds, centered (t=0) at the
+   * middle of the scan.
+   * Previous map contents are discarded unless
+   * `insertionOptions.addToExistingPointsMap` is set.
+   * \note [New in MRPT 2.14.5]
+   */
+  void loadFromVelodyneScanDirect(
+      const mrpt::obs::CObservationVelodyneScan& scan,
+      const std::optional<const mrpt::poses::CPose3D>& robotPose = std::nullopt,
+      const mrpt::obs::CObservationVelodyneScan::TGeneratePointCloudParameters& params =
+          mrpt::obs::CObservationVelodyneScan::TGeneratePointCloudParameters(),
+      unsigned int numThreads = 0);
+
  protected:
   // See base class
   void addFrom_classSpecific(
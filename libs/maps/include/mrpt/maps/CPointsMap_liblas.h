@@ -12,12 +12,20 @@
  * installed in your system */
 #include <mrpt/maps/CPointsMap.h>
 
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <fstream>
 #include <iostream>
 #include <liblas/liblas.hpp>
 #include <liblas/reader.hpp>
 #include <liblas/writer.hpp>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
 
 namespace mrpt
 {
@@ -35,10 +43,21 @@ struct LAS_WriteParams
   // None.
 };
 
-/** Optional settings for loadLASFile() */
+/** Optional settings for loadLASFile() and loadLASFileStreaming() */
 struct LAS_LoadParams
 {
-  // None.
+  /** (Default: 0 = disabled) If >0, on-the-fly voxel decimation during load:
+   * at most one point is kept per cubic voxel of this size, in the LAS file
+   * units (normally meters). Bounds the memory taken by huge aerial-survey
+   * tiles without loading the full cloud first. Only honored by
+   * loadLASFileStreaming().
+   * \note [New in MRPT 2.14.5] */
+  double decimation_voxel_size = .0;
+
+  /** Number of points decoded per batch handed over from the decoder thread
+   * to the insertion code in loadLASFileStreaming().
+   * \note [New in MRPT 2.14.5] */
+  size_t batch_size = 100000;
 };
 
 /** Extra information gathered from the LAS file header */
@@ -58,6 +77,26 @@ struct LAS_HeaderInfo
   LAS_HeaderInfo() : creation_year(0), creation_DOY(0) {}
 };
 
+namespace detail
+{
+/** Fills in a LAS_HeaderInfo from a liblas header (implementation detail of
+ * the loadLASFile*() functions). */
+inline void readLASHeaderInfo(const liblas::Header& header, LAS_HeaderInfo& out_headerInfo)
+{
+  out_headerInfo.FileSignature = header.GetFileSignature();
+  out_headerInfo.SystemIdentifier = header.GetSystemId();
+  out_headerInfo.SoftwareIdentifier = header.GetSoftwareId();
+#if LIBLAS_VERSION_NUM < 1800
+  out_headerInfo.project_guid = header.GetProjectId().to_string();
+#else
+  out_headerInfo.project_guid = boost::lexical_cast<std::string>(header.GetProjectId());
+#endif
+  out_headerInfo.spatial_reference_proj4 = header.GetSRS().GetProj4();
+  out_headerInfo.creation_year = header.GetCreationYear();
+  out_headerInfo.creation_DOY = header.GetCreationDOY();
+}
+}  // namespace detail
+
 /** Save the point cloud as an ASPRS LAS binary file (requires MRPT built
  * against liblas). Refer to http://www.liblas.org/
  * \return false on any error */
@@ -152,17 +191,7 @@ bool loadLASFile(
   const size_t nPts = header.GetPointRecordsCount();
   ptmap.reserve(nPts);
 
-  out_headerInfo.FileSignature = header.GetFileSignature();
-  out_headerInfo.SystemIdentifier = header.GetSystemId();
-  out_headerInfo.SoftwareIdentifier = header.GetSoftwareId();
-#if LIBLAS_VERSION_NUM < 1800
-  out_headerInfo.project_guid = header.GetProjectId().to_string();
-#else
-  out_headerInfo.project_guid = boost::lexical_cast<std::string>(header.GetProjectId());
-#endif
-  out_headerInfo.spatial_reference_proj4 = header.GetSRS().GetProj4();
-  out_headerInfo.creation_year = header.GetCreationYear();
-  out_headerInfo.creation_DOY = header.GetCreationDOY();
+  detail::readLASHeaderInfo(header, out_headerInfo);
 
   // Load points:
   // ---------------------
@@ -193,6 +222,177 @@ bool loadLASFile(
 
   return true;  // All ok.
 }
+
+/** Streaming version of loadLASFile(), aimed at huge (e.g. >10^8 points)
+ * LAS/LAZ aerial-survey tiles: the liblas point decoding (which for LAZ input
+ * includes the decompression) runs in a background thread, handing over
+ * plain coordinate batches through a bounded queue, while the calling thread
+ * bulk-appends them into the map after one single reserve(). Optionally,
+ * points are decimated on the fly to one per voxel
+ * (LAS_LoadParams::decimation_voxel_size) so memory stays bounded without a
+ * second pass over the data.
+ *
+ * \note Color (RGB) information will be taken into account if using the
+ * derived class mrpt::maps::CColouredPointsMap
+ * \note [New in MRPT 2.14.5]
+ * \return false on any error
+ * \sa loadLASFile */
+template <class POINTSMAP>
+bool loadLASFileStreaming(
+    POINTSMAP& ptmap,
+    const std::string& filename,
+    LAS_HeaderInfo& out_headerInfo,
+    const LAS_LoadParams& params = LAS_LoadParams())
+{
+  using namespace std;
+  ptmap.clear();
+
+  std::ifstream ifs;
+  ifs.open(filename.c_str(), std::ios::in | std::ios::binary);
+
+  if (!ifs.is_open())
+  {
+    std::cerr << "[loadLASFileStreaming] Couldn't open file: " << filename << std::endl;
+    return false;
+  }
+
+  // Create LAS reader & parse header info:
+  // ---------------------------------------
+  liblas::Reader reader(ifs);
+  liblas::Header const& header = reader.GetHeader();
+  const size_t nPts = header.GetPointRecordsCount();
+  detail::readLASHeaderInfo(header, out_headerInfo);
+
+  const bool has_color = ptmap.hasColorPoints();
+  const float col_fract = 1.0f / 255.0f;
+  const size_t batchSize = std::max<size_t>(1, params.batch_size);
+
+  // Batches of decoded points, exchanged decoder thread -> this thread:
+  struct TBatch
+  {
+    std::vector<float> xs, ys, zs, rs, gs, bs;
+  };
+  const size_t MAX_QUEUED_BATCHES = 4;  // bounds decode-ahead memory
+
+  std::mutex qMtx;
+  std::condition_variable qCV;
+  std::deque<TBatch> queue;
+  bool decoderDone = false;
+  std::string decoderError;
+
+  std::thread decoder(
+      [&]()
+      {
+        try
+        {
+          TBatch b;
+          auto flushBatch = [&]()
+          {
+            std::unique_lock<std::mutex> lk(qMtx);
+            qCV.wait(lk, [&]() { return queue.size() < MAX_QUEUED_BATCHES; });
+            queue.emplace_back(std::move(b));
+            lk.unlock();
+            qCV.notify_all();
+            b = TBatch();
+          };
+          while (reader.ReadNextPoint())
+          {
+            liblas::Point const& p = reader.GetPoint();
+            b.xs.push_back(static_cast<float>(p.GetX()));
+            b.ys.push_back(static_cast<float>(p.GetY()));
+            b.zs.push_back(static_cast<float>(p.GetZ()));
+            if (has_color)
+            {
+              liblas::Color const& col = p.GetColor();
+              b.rs.push_back(col.GetRed() * col_fract);
+              b.gs.push_back(col.GetGreen() * col_fract);
+              b.bs.push_back(col.GetBlue() * col_fract);
+            }
+            if (b.xs.size() >= batchSize) flushBatch();
+          }
+          if (!b.xs.empty()) flushBatch();
+        }
+        catch (const std::exception& e)
+        {
+          std::lock_guard<std::mutex> lk(qMtx);
+          decoderError = e.what();
+        }
+        {
+          std::lock_guard<std::mutex> lk(qMtx);
+          decoderDone = true;
+        }
+        qCV.notify_all();
+      });
+
+  // On-the-fly voxel decimation state: voxel cell indices are taken relative
+  // to the first point's cell, then packed as 3 x 21 bits, so georeferenced
+  // (e.g. UTM) coordinates far from the origin do not overflow the key.
+  const double voxel = params.decimation_voxel_size;
+  const double voxel_inv = voxel > 0 ? 1.0 / voxel : .0;
+  std::unordered_set<uint64_t> occupiedVoxels;
+  int64_t baseCell[3] = {0, 0, 0};
+  bool baseCellSet = false;
+
+  ptmap.reserve(nPts);
+  size_t nRead = 0;
+
+  // Consume batches in order:
+  for (;;)
+  {
+    TBatch b;
+    {
+      std::unique_lock<std::mutex> lk(qMtx);
+      qCV.wait(lk, [&]() { return !queue.empty() || decoderDone; });
+      if (queue.empty()) break;  // done (or error) and nothing left
+      b = std::move(queue.front());
+      queue.pop_front();
+    }
+    qCV.notify_all();  // wake the decoder if it was waiting on a full queue
+
+    const size_t n = b.xs.size();
+    nRead += n;
+    for (size_t i = 0; i < n; i++)
+    {
+      if (voxel > 0)
+      {
+        const int64_t cell[3] = {
+            static_cast<int64_t>(std::floor(b.xs[i] * voxel_inv)),
+            static_cast<int64_t>(std::floor(b.ys[i] * voxel_inv)),
+            static_cast<int64_t>(std::floor(b.zs[i] * voxel_inv))};
+        if (!baseCellSet)
+        {
+          for (int k = 0; k < 3; k++) baseCell[k] = cell[k];
+          baseCellSet = true;
+        }
+        uint64_t key = 0;
+        for (int k = 0; k < 3; k++)
+          key |= (static_cast<uint64_t>(cell[k] - baseCell[k]) & 0x1fffff) << (21 * k);
+        if (!occupiedVoxels.insert(key).second) continue;  // voxel already taken
+      }
+      if (has_color)
+        ptmap.insertPointRGB(b.xs[i], b.ys[i], b.zs[i], b.rs[i], b.gs[i], b.bs[i]);
+      else
+        ptmap.insertPointFast(b.xs[i], b.ys[i], b.zs[i]);
+    }
+  }
+  decoder.join();
+
+  if (!decoderError.empty())
+  {
+    std::cerr << "[loadLASFileStreaming] Error reading '" << filename << "': " << decoderError
+              << std::endl;
+    ptmap.mark_as_modified();
+    return false;
+  }
+
+  if (nRead != nPts)
+    cerr << "[loadLASFileStreaming] Header says point count is " << nPts << " but only " << nRead
+         << " were really parsed in.\n";
+
+  ptmap.mark_as_modified();
+
+  return true;  // All ok.
+}
 /** @} */
 }  // namespace maps
 }  // namespace mrpt
@@ -321,6 +321,13 @@ class CRandomFieldGridMap2D :
     /** (Default:false) Skip the computation of the variance, just compute
      * the mean */
     bool GMRF_skip_variance{false};
+    /** (Default:false) Solve the GMRF with the warm-started iterative
+     * LSCG solver of mrpt::graphs::ScalarFactorGraph instead of the
+     * direct SparseQR factorization. Much faster for large maps updated
+     * at a fixed rate, but only effective together with
+     * GMRF_skip_variance (variances always require the direct solver).
+     * \note [New in MRPT 2.14.5] */
+    bool GMRF_use_iterative_solver{false};
     /** @} */
   };
 
@@ -0,0 +1,209 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#pragma once
+
+#include <mrpt/config/CLoadableOptions.h>
+#include <mrpt/core/WorkerThreadsPool.h>
+#include <mrpt/maps/CMetricMap.h>
+#include <mrpt/math/TBoundingBox.h>
+#include <mrpt/math/TPoint3D.h>
+#include <mrpt/obs/obs_frwds.h>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace mrpt::obs
+{
+class CObservationPointCloud;
+}
+
+namespace mrpt::maps
+{
+/** Insertion options for CVoxelHashMap */
+struct TVoxelHashMap_InsertionOptions : public mrpt::config::CLoadableOptions
+{
+  TVoxelHashMap_InsertionOptions() = default;
+
+  /** Maximum range from the sensor for points to be inserted (<0: none) */
+  double max_range = -1;
+
+  /** Insert one out of `decimation` input points */
+  uint32_t decimation = 1;
+
+  /** Number of worker threads used to integrate one point cloud
+   * (0 = std::thread::hardware_concurrency()) */
+  uint32_t num_threads = 0;
+
+  // See base docs
+  void loadFromConfigFile(
+      const mrpt::config::CConfigFileBase& source, const std::string& section) override;
+  void saveToConfigFile(mrpt::config::CConfigFileBase& c, const std::string& s) const override;
+
+  void writeToStream(mrpt::serialization::CArchive& out) const;
+  void readFromStream(mrpt::serialization::CArchive& in);
+};
+
+/** Options used when evaluating "computeObservationLikelihood"
+ * \sa CObservation::computeObservationLikelihood
+ */
+struct TVoxelHashMap_LikelihoodOptions : public mrpt::config::CLoadableOptions
+{
+  TVoxelHashMap_LikelihoodOptions() = default;
+
+  /// Speed up the likelihood computation by considering only a maximum of
+  /// `decimate_up_to` points. Values <=1 mean use all measurements without
+  /// decimation.
+  uint32_t decimate_up_to = 0;
+
+  /// Minimum number of accumulated hits for a voxel to be considered
+  /// occupied.
+  int32_t occupiedThreshold = 1;
+
+  /// Hit count at which a voxel is considered "surely occupied"
+  /// (likelihood contribution saturates to 1.0).
+  int32_t saturation_hits = 10;
+
+  // See base docs
+  void loadFromConfigFile(
+      const mrpt::config::CConfigFileBase& source, const std::string& section) override;
+  void saveToConfigFile(mrpt::config::CConfigFileBase& c, const std::string& s) const override;
+
+  void writeToStream(mrpt::serialization::CArchive& out) const;
+  void readFromStream(mrpt::serialization::CArchive& in);
+};
+
+/** Sparse voxel map stored as an open-addressing, spatially-hashed table
+ * with per-bucket atomics, so concurrent point insertions are lock-free.
+ *
+ * Unlike CVoxelMap (built on the single-threaded Bonxai tree), this map is
+ * designed for high-rate LiDAR integration: insertObservation() for a
+ * mrpt::obs::CObservationPointCloud splits the scan into sectors which are
+ * integrated in parallel on an internal mrpt::WorkerThreadsPool. Each voxel
+ * stores an accumulated hit counter; there is no free-space ray tracing.
+ *
+ * The table only grows from the single-threaded ensureExtraCapacity(),
+ * invoked before dispatching a batch, so workers never rehash.
+ *
+ * \note (New in MRPT 2.14.5)
+ * \sa CMetricMap, CVoxelMap
+ * \ingroup mrpt_maps_grp
+ */
+class CVoxelHashMap : public mrpt::maps::CMetricMap
+{
+  DEFINE_SERIALIZABLE(CVoxelHashMap, mrpt::maps)
+
+ public:
+  /** Constructor: voxel side length [m] and initial table capacity
+   * (rounded up to a power of two). */
+  CVoxelHashMap(double resolution = 0.10, size_t initialCapacity = 1 << 17);
+  ~CVoxelHashMap() override;
+
+  CVoxelHashMap(const CVoxelHashMap& o);
+  CVoxelHashMap& operator=(const CVoxelHashMap& o);
+
+  /** @name Voxel access API
+    @{ */
+
+  double resolution() const { return m_resolution; }
+
+  /** Number of distinct voxels with at least one hit */
+  size_t voxelCount() const { return m_used.load(std::memory_order_relaxed); }
+
+  /** Current table capacity (buckets) */
+  size_t capacity() const { return m_capacity; }
+
+  /** Returns the accumulated hit count for the voxel containing the given
+   * point, or 0 if that voxel was never observed. */
+  int32_t voxelHits(double x, double y, double z) const;
+
+  /** Accumulates one hit on the voxel containing (x,y,z).
+   * Lock-free and safe to call concurrently from several threads, as long
+   * as enough free capacity was reserved beforehand with
+   * ensureExtraCapacity(). */
+  void accumulateHit(double x, double y, double z);
+
+  /** Grows (rehashes) the table, if needed, so that `extraVoxels` new
+   * voxels can be inserted while keeping the load factor under 50%.
+   * Must NOT be called concurrently with accumulateHit(). */
+  void ensureExtraCapacity(size_t extraVoxels);
+
+  /** Visits all voxels with a hit count >=1, passing the voxel center
+   * point and its hit counter. */
+  void visitOccupiedVoxels(const std::function<void(const mrpt::math::TPoint3D&, int32_t)>& f)
+      const;
+
+  /** @} */
+
+  TVoxelHashMap_InsertionOptions insertionOptions;
+  TVoxelHashMap_LikelihoodOptions likelihoodOptions;
+
+  // See docs in base class
+  std::string asString() const override;
+  bool isEmpty() const override;
+  void getVisualizationInto(mrpt::opengl::CSetOfObjects& outObj) const override;
+  void saveMetricMapRepresentationToFile(const std::string& filNamePrefix) const override;
+  mrpt::math::TBoundingBoxf boundingBox() const override;
+
+  MAP_DEFINITION_START(CVoxelHashMap)
+  double resolution = 0.10;
+  uint64_t initial_capacity = 1 << 17;
+  mrpt::maps::TVoxelHashMap_InsertionOptions insertionOpts;
+  mrpt::maps::TVoxelHashMap_LikelihoodOptions likelihoodOpts;
+  MAP_DEFINITION_END(CVoxelHashMap)
+
+ protected:
+  // See docs in base class
+  void internal_clear() override;
+  bool internal_insertObservation(
+      const mrpt::obs::CObservation& obs,
+      const std::optional<const mrpt::poses::CPose3D>& robotPose = std::nullopt) override;
+  bool internal_insertObservation_Pts(
+      const mrpt::obs::CObservationPointCloud& obs,
+      const std::optional<const mrpt::poses::CPose3D>& robotPose);
+  double internal_computeObservationLikelihood(
+      const mrpt::obs::CObservation& obs, const mrpt::poses::CPose3D& takenFrom) const override;
+
+ private:
+  struct Bucket
+  {
+    std::atomic<uint64_t> key{EMPTY_KEY};
+    std::atomic<int32_t> hits{0};
+  };
+
+  /** Key marking a free bucket. Valid packed keys always have their two
+   * most-significant bits cleared, so no collision is possible. */
+  static constexpr uint64_t EMPTY_KEY = 0xFFFFFFFFFFFFFFFFULL;
+
+  /** Packs signed voxel indices (21 bits each, biased) into one key */
+  static uint64_t packKey(int32_t cx, int32_t cy, int32_t cz);
+  static void unpackKey(uint64_t key, int32_t& cx, int32_t& cy, int32_t& cz);
+
+  uint64_t coordToKey(double x, double y, double z) const;
+
+  /** Lock-free claim-or-update of the bucket for `key` */
+  void accumulateHitByKey(uint64_t key);
+
+  /** Parallel integration of the SoA buffers of a point cloud */
+  void insertPointCloudParallel(
+      const mrpt::maps::CPointsMap& pts, const mrpt::poses::CPose3D& sensorPose);
+
+  double m_resolution, m_invResolution;
+  size_t m_capacity = 0;  //!< Always a power of two
+  std::unique_ptr<Bucket[]> m_table;
+  std::atomic<size_t> m_used{0};
+
+  /** Lazily-created pool for insertPointCloudParallel(). Shared between
+   * copies; it holds no map state. */
+  std::shared_ptr<mrpt::WorkerThreadsPool> m_insertPool;
+};
+
+}  // namespace mrpt::maps
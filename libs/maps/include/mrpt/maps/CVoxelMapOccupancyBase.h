@@ -304,6 +304,28 @@ class CVoxelMapOccupancyBase :
   {
     return getOccupiedVoxels()->nn_single_search(query, result, out_dist_sqr, resultIndexOrID);
   }
+  [[nodiscard]] bool nn_single_search_approx(
+      const mrpt::math::TPoint3Df& query,
+      mrpt::math::TPoint3Df& result,
+      float& out_dist_sqr,
+      uint64_t& resultIndexOrID,
+      float maxSearchDistanceSqr,
+      float epsilon = .0f) const override
+  {
+    return getOccupiedVoxels()->nn_single_search_approx(
+        query, result, out_dist_sqr, resultIndexOrID, maxSearchDistanceSqr, epsilon);
+  }
+  [[nodiscard]] bool nn_single_search_approx(
+      const mrpt::math::TPoint2Df& query,
+      mrpt::math::TPoint2Df& result,
+      float& out_dist_sqr,
+      uint64_t& resultIndexOrID,
+      float maxSearchDistanceSqr,
+      float epsilon = .0f) const override
+  {
+    return getOccupiedVoxels()->nn_single_search_approx(
+        query, result, out_dist_sqr, resultIndexOrID, maxSearchDistanceSqr, epsilon);
+  }
   void nn_multiple_search(
       const mrpt::math::TPoint3Df& query,
       const size_t N,
@@ -87,6 +87,49 @@ class NearestNeighborsCapable
       float& out_dist_sqr,
       uint64_t& resultIndexOrIDOrID) const = 0;
 
+  /** Approximate, bounded variant of nn_single_search(), for callers that
+   * only care about neighbors below a known distance and/or can tolerate an
+   * approximate answer (e.g. the early iterations of ICP).
+   *
+   * \param[in] maxSearchDistanceSqr Upper bound for the **squared** distance
+   * of an acceptable neighbor: the search can prune aggressively beyond it,
+   * and the method returns false if no point lies below it.
+   * \param[in] epsilon Approximation factor: if >0, implementations may
+   * return any point whose distance is within a factor `(1+epsilon)` of the
+   * true nearest neighbor's. `0` keeps the search exact (but still bounded).
+   *
+   * The default implementation falls back to the exact nn_single_search()
+   * and just applies the distance bound afterwards; derived classes should
+   * override it when their search structure can exploit the bound.
+   *
+   * \return True if a point below the bound was found.
+   * \note [New in MRPT 2.14.5]
+   */
+  [[nodiscard]] virtual bool nn_single_search_approx(
+      const mrpt::math::TPoint3Df& query,
+      mrpt::math::TPoint3Df& result,
+      float& out_dist_sqr,
+      uint64_t& resultIndexOrID,
+      float maxSearchDistanceSqr,
+      [[maybe_unused]] float epsilon = .0f) const
+  {
+    if (!nn_single_search(query, result, out_dist_sqr, resultIndexOrID)) return false;
+    return out_dist_sqr < maxSearchDistanceSqr;
+  }
+
+  /// \overload for 2D points \note [New in MRPT 2.14.5]
+  [[nodiscard]] virtual bool nn_single_search_approx(
+      const mrpt::math::TPoint2Df& query,
+      mrpt::math::TPoint2Df& result,
+      float& out_dist_sqr,
+      uint64_t& resultIndexOrID,
+      float maxSearchDistanceSqr,
+      [[maybe_unused]] float epsilon = .0f) const
+  {
+    if (!nn_single_search(query, result, out_dist_sqr, resultIndexOrID)) return false;
+    return out_dist_sqr < maxSearchDistanceSqr;
+  }
+
   /** Search for the `N` closest 3D points to a given one.
    *
    * \param[in]  query The query input point.
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <mrpt/core/aligned_std_vector.h>
 #include <mrpt/maps/CPointsMap.h>
 #include <mrpt/obs/CObservation.h>
 
@@ -40,18 +41,51 @@ class CObservationPointCloud : public CObservation
     None = 0,            //!< is always stored in memory
     MRPT_Serialization,  //!< Uses mrpt-serialization binary file
     KittiBinFile,        //!< Uses Kitti .bin file format
-    PlainTextFile        //!< Plain text, each line has "x y z [i]" coords
+    PlainTextFile,       //!< Plain text, each line has "x y z [i]" coords
+    ColumnarFile  //!< Column-oriented binary file: an index header plus one
+                  //!< zlib-compressed block per point attribute, so lazy
+                  //!< loads can read only the columns selected with
+                  //!< setLazyLoadColumns(). (New in MRPT 2.14.5)
+  };
+
+  /** Bit flags naming each point attribute ("column") of a ColumnarFile
+   * external file, for use with setLazyLoadColumns().
+   * (New in MRPT 2.14.5) */
+  enum ColumnBits : uint8_t
+  {
+    COLUMN_X = 0x01,
+    COLUMN_Y = 0x02,
+    COLUMN_Z = 0x04,
+    COLUMN_INTENSITY = 0x08,
+    COLUMN_RING = 0x10,
+    COLUMN_TIMESTAMP = 0x20,
+    COLUMN_ALL = 0xff
   };
 
  protected:
   ExternalStorageFormat m_externally_stored{ExternalStorageFormat::None};
   std::string m_external_file;
+  uint8_t m_lazy_load_columns{COLUMN_ALL};
 
  public:
   CObservationPointCloud() = default;
 
   explicit CObservationPointCloud(const CObservation3DRangeScan& o);
 
+  /** Builds an observation whose \a pointcloud (a CSimplePointsMap) adopts
+   * the given structure-of-arrays XYZ buffers without copying the
+   * per-point data (the vectors are moved in). Intended for driver decode
+   * buffers, so a grabbed cloud can be wrapped and later inserted into a
+   * working map without any per-point copies (see the move overload of
+   * mrpt::maps::CPointsMap::insertAnotherMap()).
+   * (New in MRPT 2.14.5)
+   */
+  static Ptr fromXYZBuffers(
+      mrpt::aligned_std_vector<float>&& xs,
+      mrpt::aligned_std_vector<float>&& ys,
+      mrpt::aligned_std_vector<float>&& zs,
+      const mrpt::poses::CPose3D& sensorPoseOnRobot = {});
+
   /** The pointcloud */
   mrpt::maps::CPointsMap::Ptr pointcloud;
 
@@ -86,6 +120,21 @@ class CObservationPointCloud : public CObservation
   {
     m_externally_stored = fmt;
   }
+
+  /** Selects which columns load() reads back from a
+   * ExternalStorageFormat::ColumnarFile external file (an OR of ColumnBits
+   * flags; default: COLUMN_ALL), so e.g. an analytics job needing only
+   * `COLUMN_X | COLUMN_Y | COLUMN_INTENSITY` skips the compressed z, ring
+   * and timestamp blocks entirely.
+   * Deselected x/y/z columns are zero-filled so the point count is
+   * preserved; deselected intensity/ring/timestamp channels are left empty.
+   * This is a local playback setting: it is not serialized, and it is
+   * ignored by the other storage formats. Files always store all the
+   * columns present in the point cloud.
+   * \note [New in MRPT 2.14.5]
+   */
+  void setLazyLoadColumns(uint8_t columnsMask) { m_lazy_load_columns = columnsMask; }
+  uint8_t lazyLoadColumns() const { return m_lazy_load_columns; }
   /** @} */
 
 };  // End of class def.
@@ -246,29 +246,31 @@ double CBeaconMap::internal_computeObservationLikelihood(
           // ------------------------------
           case CBeacon::pdfSOG:
           {
-            CMatrixDouble13 H;
             CVectorDouble logWeights(beac->m_locationSOG.size());
             CVectorDouble logLiks(beac->m_locationSOG.size());
             CVectorDouble::iterator itLW, itLL;
             CPointPDFSOG::const_iterator it;
-            // For each Gaussian mode:
+            const double varR = square(likelihoodOptions.rangeStd);
+            // For each Gaussian mode: evaluate H*C*H^t in closed form
+            // over the covariance entries (H = dij^t/range), without any
+            // matrix temporaries:
             for (it = beac->m_locationSOG.begin(), itLW = logWeights.begin(),
                 itLL = logLiks.begin();
                  it != beac->m_locationSOG.end(); ++it, ++itLW, ++itLL)
             {
-              // Compute the Jacobian H and varZ
-              double varZ, varR = square(likelihoodOptions.rangeStd);
-              double Ax = it->val.mean.x() - sensor3D.x();
-              double Ay = it->val.mean.y() - sensor3D.y();
-              double Az = it->val.mean.z() - sensor3D.z();
-              H(0, 0) = Ax;
-              H(0, 1) = Ay;
-              H(0, 2) = Az;
-              double expectedRange = sensor3D.distanceTo(it->val.mean);
-              H.asEigen() *= 1.0 / expectedRange;  // sqrt(Ax*Ax+Ay*Ay+Az*Az);
-
-              varZ = mrpt::math::multiply_HCHt_scalar(H, it->val.cov);
-              varZ += varR;
+              const double Ax = it->val.mean.x() - sensor3D.x();
+              const double Ay = it->val.mean.y() - sensor3D.y();
+              const double Az = it->val.mean.z() - sensor3D.z();
+              const double expectedRange2 = Ax * Ax + Ay * Ay + Az * Az;
+              const double expectedRange = std::sqrt(expectedRange2);
+
+              const auto& C = it->val.cov;
+              const double varZ =
+                  (Ax * (C(0, 0) * Ax + C(0, 1) * Ay + C(0, 2) * Az) +
+                   Ay * (C(0, 1) * Ax + C(1, 1) * Ay + C(1, 2) * Az) +
+                   Az * (C(0, 2) * Ax + C(1, 2) * Ay + C(2, 2) * Az)) /
+                      expectedRange2 +
+                  varR;
 
               // Compute the mean expected range (add bias!):
               // expectedRange +=
@@ -648,6 +650,11 @@ bool CBeaconMap::internal_insertObservation(
               // Normalize the weights:
               beac->m_locationSOG.normalizeWeights();
 
+              // Merge modes that became nearly identical, so the mode
+              // count does not keep growing with every observation:
+              if (insertionOptions.SOG_mergeMaxKLd > 0 && beac->m_locationSOG.size() > 1)
+                beac->m_locationSOG.mergeModes(insertionOptions.SOG_mergeMaxKLd);
+
               // Should we pass this beacon to a single Gaussian
               // mode?
               // -----------------------------------------------------------
@@ -889,6 +896,7 @@ void CBeaconMap::TInsertionOptions::dumpToTextStream(std::ostream& out) const
   out << mrpt::format(
       "SOG_maxDistBetweenGaussians             = %.03f\n", SOG_maxDistBetweenGaussians);
   out << mrpt::format("SOG_separationConstant                  = %.03f\n", SOG_separationConstant);
+  out << mrpt::format("SOG_mergeMaxKLd                         = %.03f\n", SOG_mergeMaxKLd);
 
   out << "\n";
 }
@@ -910,6 +918,7 @@ void CBeaconMap::TInsertionOptions::loadFromConfigFile(
   MRPT_LOAD_CONFIG_VAR(SOG_thresholdNegligible, float, iniFile, section.c_str());
   MRPT_LOAD_CONFIG_VAR(SOG_maxDistBetweenGaussians, float, iniFile, section.c_str());
   MRPT_LOAD_CONFIG_VAR(SOG_separationConstant, float, iniFile, section.c_str());
+  MRPT_LOAD_CONFIG_VAR(SOG_mergeMaxKLd, double, iniFile, section.c_str());
 }
 
 /*---------------------------------------------------------------
@@ -18,6 +18,9 @@
 #include <mrpt/serialization/CArchive.h>
 #include <mrpt/serialization/stl_serialization.h>
 
+#include <algorithm>
+#include <thread>
+
 using namespace mrpt::maps;
 using namespace mrpt::obs;
 using namespace mrpt::poses;
@@ -107,7 +110,11 @@ CHeightGridMap2D::CHeightGridMap2D(
 /*---------------------------------------------------------------
             clear
   ---------------------------------------------------------------*/
-void CHeightGridMap2D::internal_clear() { fill(THeightGridmapCell()); }
+void CHeightGridMap2D::internal_clear()
+{
+  fill(THeightGridmapCell());
+  m_meshCacheValid = false;
+}
 /*---------------------------------------------------------------
             isEmpty
   ---------------------------------------------------------------*/
@@ -116,30 +123,100 @@ bool CHeightGridMap2D::insertIndividualPoint(
     const double x,
     const double y,
     const double zz,
-    const CHeightGridMap2D_Base::TPointInsertParams& params)
+    [[maybe_unused]] const CHeightGridMap2D_Base::TPointInsertParams& params)
 {
-  THeightGridmapCell* cell = cellByPos(x, y);
-  if (!cell) return false;  // Out of the map: Ignore if we've not resized before.
+  const int cx = x2idx(x), cy = y2idx(y);
+  if (cx < 0 || cx >= static_cast<int>(m_size_x) || cy < 0 || cy >= static_cast<int>(m_size_y))
+    return false;  // Out of the map: Ignore if we've not resized before.
+
+  THeightGridmapCell* cell = cellByIndex(cx, cy);
+  if (internal_insertZ(*cell, d2f(zz)) && m_meshCacheValid) markDirtyCell(cx, cy, m_dirtyTiles);
+  return true;
+}
 
-  const float z = d2f(zz);
-  if (!insertionOptions.filterByHeight ||
-      (z >= insertionOptions.z_min && z <= insertionOptions.z_max))
+size_t CHeightGridMap2D::insertPoints(
+    const std::vector<mrpt::math::TPoint3D>& pts, const CHeightGridMap2D_Base::TPointInsertParams& params)
+{
+  MRPT_START
+  if (pts.empty()) return 0;
+
+  // 1) Single resize pre-pass: enlarge the grid (at most once) so it encloses
+  // all the points:
+  double x_min = pts[0].x, x_max = pts[0].x;
+  double y_min = pts[0].y, y_max = pts[0].y;
+  for (const auto& p : pts)
   {
-    cell->u += z;
-    cell->v += z * z;
-    if (!cell->w)
-    {
-      cell->h = z;  // First observation
-      cell->w = 1;
-    }
-    else
+    x_min = std::min(x_min, p.x);
+    x_max = std::max(x_max, p.x);
+    y_min = std::min(y_min, p.y);
+    y_max = std::max(y_max, p.y);
+  }
+  resize(
+      std::min(x_min, m_x_min), std::max(x_max, m_x_max), std::min(y_min, m_y_min),
+      std::max(y_max, m_y_max), THeightGridmapCell());
+
+  const size_t tiles_x = (m_size_x + MESH_TILE_SIZE - 1) / MESH_TILE_SIZE;
+  const size_t tiles_y = (m_size_y + MESH_TILE_SIZE - 1) / MESH_TILE_SIZE;
+  if (m_meshCacheValid && m_dirtyTiles.size() != tiles_x * tiles_y) m_meshCacheValid = false;
+  const bool trackDirty = m_meshCacheValid;
+
+  // 2) Bucket the points into disjoint horizontal bands of grid rows, so each
+  // worker thread updates a different set of cells and no locking is needed:
+  const size_t nThreads =
+      std::min<size_t>(std::max(1U, std::thread::hardware_concurrency()), pts.size());
+  const size_t rowsPerBand = std::max<size_t>(1, (m_size_y + nThreads - 1) / nThreads);
+  const size_t nBands = (m_size_y + rowsPerBand - 1) / rowsPerBand;
+
+  std::vector<std::vector<size_t>> bands(nBands);
+  for (size_t i = 0; i < pts.size(); i++)
+  {
+    const int cy = y2idx(pts[i].y);
+    if (cy < 0 || cy >= static_cast<int>(m_size_y)) continue;
+    bands[cy / rowsPerBand].push_back(i);
+  }
+
+  std::vector<size_t> inserted(nBands, 0);
+  std::vector<std::vector<uint8_t>> localDirty(nBands);
+
+  auto run_band = [&](size_t b)
+  {
+    if (trackDirty) localDirty[b].assign(tiles_x * tiles_y, 0);
+    for (size_t i : bands[b])
     {
-      float W = cell->w++;  // W = N-1
-      cell->h = (cell->h * W + z) / cell->w;
-      if (W > 0) cell->var = (cell->v - d2f(pow(cell->u, 2)) / cell->w) / W;
+      const auto& p = pts[i];
+      const int cx = x2idx(p.x), cy = y2idx(p.y);
+      THeightGridmapCell* cell = cellByIndex(cx, cy);
+      ASSERTDEB_(cell);
+      if (!internal_insertZ(*cell, d2f(p.z))) continue;
+      inserted[b]++;
+      if (trackDirty) markDirtyCell(cx, cy, localDirty[b]);
     }
-  }  // end if really inserted
-  return true;
+  };
+
+  if (nBands > 1 && nThreads > 1)
+  {
+    std::vector<std::thread> workers;
+    workers.reserve(nBands);
+    for (size_t b = 0; b < nBands; b++) workers.emplace_back(run_band, b);
+    for (auto& t : workers) t.join();
+  }
+  else
+  {
+    for (size_t b = 0; b < nBands; b++) run_band(b);
+  }
+
+  // Merge the per-thread dirty-tile maps:
+  if (trackDirty)
+    for (const auto& ld : localDirty)
+      for (size_t t = 0; t < ld.size(); t++)
+        if (ld[t]) m_dirtyTiles[t] = 1;
+
+  if (params.update_map_after_insertion) dem_update_map();
+
+  size_t count = 0;
+  for (size_t c : inserted) count += c;
+  return count;
+  MRPT_END
 }
 
 bool CHeightGridMap2D::internal_insertObservation(
@@ -217,6 +294,8 @@ void CHeightGridMap2D::serializeFrom(mrpt::serialization::CArchive& in, uint8_t
       in >> insertionOptions.filterByHeight >> insertionOptions.z_min >> insertionOptions.z_max;
 
       if (version >= 2) in >> genericMapParams;
+
+      m_meshCacheValid = false;
     }
     break;
     default:
@@ -281,26 +360,58 @@ void CHeightGridMap2D::getVisualizationInto(mrpt::opengl::CSetOfObjects& o) cons
     mesh->enableWireFrame(true);
     mesh->enableColorFromZ(true, insertionOptions.colorMap /*cmJET*/);
 
-    CMatrixFloat Z, mask;
-    /*mesh->getZ(Z);
-
-    mesh->getMask(mask);*/
+    const size_t tiles_x = (m_size_x + MESH_TILE_SIZE - 1) / MESH_TILE_SIZE;
+    const size_t tiles_y = (m_size_y + MESH_TILE_SIZE - 1) / MESH_TILE_SIZE;
 
-    Z.setSize(m_size_x, m_size_y);
-    mask.setSize(m_size_x, m_size_y);
+    const bool fullRebuild = !m_meshCacheValid ||
+        m_meshCacheZ.rows() != static_cast<int>(m_size_x) ||
+        m_meshCacheZ.cols() != static_cast<int>(m_size_y) ||
+        m_dirtyTiles.size() != tiles_x * tiles_y;
 
-    for (size_t x = 0; x < m_size_x; x++)
+    if (fullRebuild)
     {
-      for (size_t y = 0; y < m_size_y; y++)
+      m_meshCacheZ.setSize(m_size_x, m_size_y);
+      m_meshCacheMask.setSize(m_size_x, m_size_y);
+      for (size_t x = 0; x < m_size_x; x++)
       {
-        const THeightGridmapCell* c = cellByIndex(x, y);
-        ASSERTDEB_(c);
-        Z(x, y) = c->h;
-        mask(x, y) = c->w ? 1 : 0;
+        for (size_t y = 0; y < m_size_y; y++)
+        {
+          const THeightGridmapCell* c = cellByIndex(x, y);
+          ASSERTDEB_(c);
+          m_meshCacheZ(x, y) = c->h;
+          m_meshCacheMask(x, y) = c->w ? 1 : 0;
+        }
+      }
+      m_dirtyTiles.assign(tiles_x * tiles_y, 0);
+      m_meshCacheValid = true;
+    }
+    else
+    {
+      // Regenerate only the mesh patches touched since the last call:
+      for (size_t ty = 0; ty < tiles_y; ty++)
+      {
+        for (size_t tx = 0; tx < tiles_x; tx++)
+        {
+          uint8_t& dirty = m_dirtyTiles[ty * tiles_x + tx];
+          if (!dirty) continue;
+          dirty = 0;
+          const size_t x_end = std::min(m_size_x, (tx + 1) * MESH_TILE_SIZE);
+          const size_t y_end = std::min(m_size_y, (ty + 1) * MESH_TILE_SIZE);
+          for (size_t x = tx * MESH_TILE_SIZE; x < x_end; x++)
+          {
+            for (size_t y = ty * MESH_TILE_SIZE; y < y_end; y++)
+            {
+              const THeightGridmapCell* c = cellByIndex(x, y);
+              ASSERTDEB_(c);
+              m_meshCacheZ(x, y) = c->h;
+              m_meshCacheMask(x, y) = c->w ? 1 : 0;
+            }
+          }
+        }
       }
     }
-    mesh->setZ(Z);
-    mesh->setMask(mask);
+    mesh->setZ(m_meshCacheZ);
+    mesh->setMask(m_meshCacheMask);
 
     o.insert(mesh);
   }
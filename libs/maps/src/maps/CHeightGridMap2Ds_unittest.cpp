@@ -10,6 +10,9 @@
 #include <gtest/gtest.h>
 #include <mrpt/maps/CHeightGridMap2D.h>
 #include <mrpt/maps/CHeightGridMap2D_MRF.h>
+#include <mrpt/math/TPoint3D.h>
+
+#include <vector>
 
 template <class MAP>
 void do_test_insertCheckMapBounds()
@@ -53,3 +56,30 @@ TEST(CHeightGridMap2Ds, insertPointsAndRead)
   do_test_insertPointsAndRead<mrpt::maps::CHeightGridMap2D>();
   do_test_insertPointsAndRead<mrpt::maps::CHeightGridMap2D_MRF>();
 }
+
+TEST(CHeightGridMap2Ds, bulkInsertPoints)
+{
+  std::vector<mrpt::math::TPoint3D> pts;
+  for (int i = 0; i < 500; i++)
+    pts.emplace_back(-2.0 + 0.017 * i, 1.0 + 0.013 * i, 10.0 + 0.05 * (i % 37));
+
+  // Reference: one-by-one insertion into a grid already covering all points:
+  mrpt::maps::CHeightGridMap2D demRef(
+      mrpt::maps::CHeightGridMap2D::mrSimpleAverage, -3.0, 7.0, 0.0, 8.0, 0.5);
+  for (const auto& p : pts) demRef.insertIndividualPoint(p.x, p.y, p.z);
+
+  // The bulk version must grow the grid on its own:
+  mrpt::maps::CHeightGridMap2D demBulk(
+      mrpt::maps::CHeightGridMap2D::mrSimpleAverage, 0.0, 1.0, 0.0, 1.0, 0.5);
+  const size_t nInserted = demBulk.insertPoints(pts);
+  EXPECT_EQ(nInserted, pts.size());
+  EXPECT_EQ(demBulk.countObservedCells(), demRef.countObservedCells());
+
+  for (const auto& p : pts)
+  {
+    double zRef = 0, zBulk = 0;
+    EXPECT_TRUE(demRef.dem_get_z(p.x, p.y, zRef));
+    EXPECT_TRUE(demBulk.dem_get_z(p.x, p.y, zBulk));
+    EXPECT_NEAR(zRef, zBulk, 1e-4);
+  }
+}
@@ -18,6 +18,8 @@
 #include <mrpt/serialization/metaprogramming_serialization.h>
 #include <mrpt/system/filesystem.h>
 
+#include <algorithm>
+
 using namespace mrpt::maps;
 using namespace mrpt::poses;
 using namespace mrpt::obs;
@@ -200,9 +202,63 @@ bool CMultiMetricMap::internal_canComputeObservationLikelihood(const CObservatio
   return can_comp;  //-V614
 }
 
+void CMultiMetricMap::enableParallelInsertion(bool enable, std::size_t numThreads)
+{
+  m_insertionPoolRequested = enable;
+  m_insertionPoolNumThreads = numThreads;
+  if (enable)
+  {
+    if (!m_insertionAux) m_insertionAux = std::make_shared<TParallelInsertAux>();
+  }
+  else
+  {
+    m_insertionPool.reset();
+    m_insertionAux.reset();
+  }
+}
+
 bool CMultiMetricMap::internal_insertObservation(
     const CObservation& obs, const std::optional<const mrpt::poses::CPose3D>& robotPose)
 {
+  // Parallel mode: each worker inserts into one independent map, then join.
+  if (m_insertionPoolRequested && maps.size() > 1)
+  {
+    auto aux = m_insertionAux;  // keep alive even if disabled concurrently
+    ASSERT_(aux);
+    {
+      // Guard the lazy pool creation: we may be invoked concurrently
+      // ourselves (see insertionIsThreadSafe()):
+      std::lock_guard<std::mutex> lck(aux->setupMtx);
+      if (!m_insertionPool)
+      {
+        std::size_t nThreads = m_insertionPoolNumThreads;
+        if (nThreads == 0)
+          nThreads = std::min<std::size_t>(maps.size(), std::thread::hardware_concurrency());
+        m_insertionPool = std::make_shared<mrpt::WorkerThreadsPool>(
+            nThreads, mrpt::WorkerThreadsPool::POLICY_FIFO, "CMultiMetricMap_insert");
+      }
+    }
+
+    std::vector<std::future<bool>> futs;
+    futs.reserve(maps.size());
+    for (auto& ptr : maps)
+      futs.emplace_back(m_insertionPool->enqueue(
+          [&obs, &robotPose, &ptr, &aux]()
+          {
+            // Serialize inserts into the same contained map, so several
+            // observations can be in flight at once without conflicting:
+            const size_t slot =
+                std::hash<const void*>()(ptr.get()) % aux->perMapMtx.size();
+            std::lock_guard<std::mutex> lckMap(aux->perMapMtx[slot]);
+            return ptr->insertObservation(obs, robotPose);
+          }));
+
+    int total_insert = 0;
+    for (auto& f : futs)
+      if (f.get()) total_insert++;
+    return total_insert != 0;
+  }
+
   int total_insert = 0;
 
   std::for_each(
@@ -12,6 +12,9 @@
 #include <mrpt/maps/CMultiMetricMap.h>
 #include <mrpt/maps/COccupancyGridMap2D.h>
 #include <mrpt/maps/CSimplePointsMap.h>
+#include <mrpt/obs/CObservation2DRangeScan.h>
+#include <mrpt/obs/CSensoryFrame.h>
+#include <mrpt/obs/stock_observations.h>
 #include <test_mrpt_common.h>
 
 TEST(CMultiMetricMapTests, isEmpty)
@@ -145,3 +148,51 @@ max_y= 10
     EXPECT_ANY_THROW(map_inits.loadFromConfigFile(cfg, "map"));
   }
 }
+
+TEST(CMultiMetricMapTests, parallelInsertion)
+{
+  using mrpt::maps::CSimplePointsMap;
+
+  mrpt::obs::CObservation2DRangeScan scan1;
+  mrpt::obs::stock_observations::example2DRangeScan(scan1);
+
+  auto mSeq = initializer1();
+  auto mPar = initializer1();
+  mPar.enableParallelInsertion(true);
+  EXPECT_TRUE(mPar.parallelInsertionEnabled());
+
+  EXPECT_TRUE(mSeq.insertObservation(scan1));
+  EXPECT_TRUE(mPar.insertObservation(scan1));
+
+  // Both modes must lead to identical maps:
+  EXPECT_EQ(
+      mSeq.mapByClass<CSimplePointsMap>()->size(), mPar.mapByClass<CSimplePointsMap>()->size());
+}
+
+TEST(CMultiMetricMapTests, parallelSensoryFrameInsertion)
+{
+  using mrpt::maps::CSimplePointsMap;
+
+  auto scan = mrpt::obs::CObservation2DRangeScan::Create();
+  mrpt::obs::stock_observations::example2DRangeScan(*scan);
+
+  mrpt::obs::CSensoryFrame sf;
+  const size_t NUM_OBS = 5;
+  for (size_t i = 0; i < NUM_OBS; i++) sf.insert(scan);
+
+  auto mSeq = initializer1();
+  auto mPar = initializer1();
+
+  // Without enableParallelInsertion() the map declares no thread-safe
+  // insertion and the parallel call must silently run serially:
+  EXPECT_FALSE(mSeq.insertionIsThreadSafe());
+  EXPECT_TRUE(sf.insertObservationsIntoParallel(mSeq));
+
+  mPar.enableParallelInsertion(true);
+  EXPECT_TRUE(mPar.insertionIsThreadSafe());
+  EXPECT_TRUE(sf.insertObservationsIntoParallel(mPar));
+
+  // Same number of points regardless of the insertion schedule:
+  EXPECT_EQ(
+      mSeq.mapByClass<CSimplePointsMap>()->size(), mPar.mapByClass<CSimplePointsMap>()->size());
+}
@@ -13,12 +13,16 @@
 // Force size_x being a multiple of 16 cells
 //#define		ROWSIZE_MULTIPLE_16
 
+#include <mrpt/core/aligned_allocator.h>  // advise_huge_pages()
 #include <mrpt/maps/COccupancyGridMap2D.h>
 #include <mrpt/maps/CSimplePointsMap.h>
 #include <mrpt/math/TPose2D.h>
 #include <mrpt/poses/CPose3D.h>
 #include <mrpt/serialization/CArchive.h>
 
+#include <algorithm>
+#include <cstring>
+
 using namespace mrpt;
 using namespace mrpt::math;
 using namespace mrpt::maps;
@@ -128,6 +132,7 @@ void COccupancyGridMap2D::copyMapContentFrom(const COccupancyGridMap2D& o)
   m_voronoi_diagram.clear();
 
   m_likelihoodCacheOutDated = true;
+  m_distanceTransformOutDated = true;
   m_is_empty = o.m_is_empty;
 }
 
@@ -144,6 +149,7 @@ void COccupancyGridMap2D::setSize(
 
   freeMap();
   m_likelihoodCacheOutDated = true;
+  m_distanceTransformOutDated = true;
 
   // Adjust sizes to adapt them to full sized cells according to the
   // resolution:
@@ -177,10 +183,24 @@ void COccupancyGridMap2D::setSize(
   // Cells memory:
   m_map.resize(m_size_x * m_size_y, p2l(default_value));
 
+  // The cell vector keeps the default allocator (its type is public API), so
+  // large grids opt into transparent huge pages via kernel advice instead:
+  if (mrpt::hugepage_allocations_enabled())
+    mrpt::advise_huge_pages(m_map.data(), m_map.size() * sizeof(cellType));
+
   // Free these buffers also:
   m_basis_map.clear();
   m_voronoi_diagram.clear();
 
+  // Per-tile change counters: if some client is tracking changes, make sure
+  // the reset of the whole map is visible even if the dimensions (hence the
+  // counter vector) did not change:
+  if (!m_tileChangeCnt.empty())
+  {
+    ensureTileChangeCounters();
+    for (auto& c : m_tileChangeCnt) c++;
+  }
+
   m_is_empty = true;
 
   MRPT_END
@@ -195,7 +215,6 @@ void COccupancyGridMap2D::resizeGrid(
     bool additionalMargin) noexcept
 {
   unsigned int extra_x_izq = 0, extra_y_arr = 0, new_size_x = 0, new_size_y = 0;
-  std::vector<cellType> new_map;
 
   if (new_x_min > new_x_max)
   {
@@ -220,6 +239,7 @@ void COccupancyGridMap2D::resizeGrid(
 
   // For the precomputed likelihood trick:
   m_likelihoodCacheOutDated = true;
+  m_distanceTransformOutDated = true;
 
   // Add an additional margin:
   if (additionalMargin)
@@ -269,25 +289,41 @@ void COccupancyGridMap2D::resizeGrid(
   assert(0 == (new_size_x % 16));
 #endif
 
-  // Reserve new mem block
-  new_map.resize(new_size_x * new_size_y, p2l(new_cells_default_value));
+  // Grow in place: extending the vector keeps the old contents as a prefix,
+  // so old rows can be relocated backwards without allocating (and filling)
+  // a second full-sized buffer. Growing only towards +y is free of any copy.
+  const size_t old_size_x = m_size_x, old_size_y = m_size_y;
+  const size_t new_cells = size_t(new_size_x) * size_t(new_size_y);
+  const cellType defValue = p2l(new_cells_default_value);
 
-  // Copy all the old map rows into the new map:
-  {
-    cellType* dest_ptr = &new_map[extra_x_izq + extra_y_arr * new_size_x];
-    cellType* src_ptr = &m_map[0];
-    size_t row_size = m_size_x * sizeof(cellType);
+  // Geometric capacity growth, so repeated small extensions at the map
+  // border (the common case while exploring) have amortized O(1) allocations:
+  if (new_cells > m_map.capacity())
+    m_map.reserve(std::max(new_cells, m_map.capacity() + m_map.capacity() / 2));
+  m_map.resize(new_cells, defValue);
 
-    for (size_t y = 0; y < m_size_y; y++)
+  if (new_size_x != old_size_x || extra_y_arr != 0)
+  {
+    // Relocate old rows from the last one downwards, so no source row is
+    // overwritten before having been read (dest >= src always holds):
+    for (size_t y = old_size_y; y-- > 0;)
     {
-#if defined(_DEBUG) || (MRPT_ALWAYS_CHECKS_DEBUG)
-      assert(dest_ptr + row_size - 1 <= &new_map[new_map.size() - 1]);
-      assert(src_ptr + row_size - 1 <= &m_map[m_map.size() - 1]);
-#endif
-      memcpy(dest_ptr, src_ptr, row_size);
-      dest_ptr += new_size_x;
-      src_ptr += m_size_x;
+      cellType* src = &m_map[y * old_size_x];
+      cellType* dest = &m_map[extra_x_izq + (y + extra_y_arr) * new_size_x];
+      if (dest != src) std::memmove(dest, src, old_size_x * sizeof(cellType));
     }
+    // Fill the uncovered areas (stale after the moves) with the default:
+    // - New band at -y:
+    std::fill_n(&m_map[0], size_t(extra_y_arr) * new_size_x, defValue);
+    // - New left/right margins of each old row:
+    for (size_t y = 0; y < old_size_y; y++)
+    {
+      cellType* row = &m_map[(y + extra_y_arr) * size_t(new_size_x)];
+      std::fill_n(row, extra_x_izq, defValue);
+      std::fill_n(
+          row + extra_x_izq + old_size_x, new_size_x - old_size_x - extra_x_izq, defValue);
+    }
+    // (the new band at +y was already default-filled by resize() above)
   }
 
   // Move new values into the new map:
@@ -299,9 +335,6 @@ void COccupancyGridMap2D::resizeGrid(
   m_size_x = new_size_x;
   m_size_y = new_size_y;
 
-  // Free old map, replace by new one:
-  m_map.swap(new_map);
-
   // Free the other buffers:
   m_basis_map.clear();
   m_voronoi_diagram.clear();
@@ -324,6 +357,7 @@ void COccupancyGridMap2D::freeMap()
 
   // For the precomputed likelihood trick:
   m_likelihoodCacheOutDated = true;
+  m_distanceTransformOutDated = true;
 
   m_is_empty = true;
 
@@ -415,6 +449,7 @@ void COccupancyGridMap2D::internal_clear()
   setSize(-10, 10, -10, 10, getResolution());
   // For the precomputed likelihood trick:
   m_likelihoodCacheOutDated = true;
+  m_distanceTransformOutDated = true;
 }
 
 /*---------------------------------------------------------------
@@ -426,6 +461,13 @@ void COccupancyGridMap2D::fill(float default_value)
   for (auto it = m_map.begin(); it < m_map.end(); ++it) *it = defValue;
   // For the precomputed likelihood trick:
   m_likelihoodCacheOutDated = true;
+  m_distanceTransformOutDated = true;
+  // All the tiles changed:
+  if (!m_tileChangeCnt.empty())
+  {
+    ensureTileChangeCounters();
+    for (auto& c : m_tileChangeCnt) c++;
+  }
 }
 
 /*---------------------------------------------------------------
@@ -464,9 +506,58 @@ void COccupancyGridMap2D::updateCell(int x, int y, float v)
       else
         theCell += obs;
     }
+
+    if (!m_tileChangeCnt.empty()) markTileChangedCells(x, x, y, y);
   }
 }
 
+// ---------------------------------------------------------------------------
+// Per-tile change counters (see getTileChangeCounters() in the header)
+// ---------------------------------------------------------------------------
+void COccupancyGridMap2D::ensureTileChangeCounters() const
+{
+  constexpr unsigned int T = CHANGE_COUNTER_TILE_SIZE;
+  const unsigned int tx = (m_size_x + T - 1) / T;
+  const unsigned int ty = (m_size_y + T - 1) / T;
+  if (m_tileCntSizeX == tx && m_tileCntSizeY == ty && !m_tileChangeCnt.empty()) return;
+  m_tileCntSizeX = tx;
+  m_tileCntSizeY = ty;
+  m_tileChangeCnt.assign(size_t(tx) * ty, 0);
+}
+
+void COccupancyGridMap2D::markTileChangedCells(int cx0, int cx1, int cy0, int cy1) const
+{
+  ensureTileChangeCounters();
+
+  cx0 = std::max(0, cx0);
+  cy0 = std::max(0, cy0);
+  cx1 = std::min<int>(m_size_x - 1, cx1);
+  cy1 = std::min<int>(m_size_y - 1, cy1);
+  if (cx0 > cx1 || cy0 > cy1) return;
+
+  constexpr int T = CHANGE_COUNTER_TILE_SIZE;
+  for (int ty = cy0 / T; ty <= cy1 / T; ty++)
+    for (int tx = cx0 / T; tx <= cx1 / T; tx++) m_tileChangeCnt[tx + ty * m_tileCntSizeX]++;
+}
+
+const std::vector<uint32_t>& COccupancyGridMap2D::getTileChangeCounters() const
+{
+  ensureTileChangeCounters();
+  return m_tileChangeCnt;
+}
+
+unsigned int COccupancyGridMap2D::getTileChangeCountX() const
+{
+  ensureTileChangeCounters();
+  return m_tileCntSizeX;
+}
+
+unsigned int COccupancyGridMap2D::getTileChangeCountY() const
+{
+  ensureTileChangeCounters();
+  return m_tileCntSizeY;
+}
+
 /*---------------------------------------------------------------
               subSample
  ---------------------------------------------------------------*/
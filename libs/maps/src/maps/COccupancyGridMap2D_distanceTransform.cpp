@@ -0,0 +1,185 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include "maps-precomp.h"  // Precomp header
+//
+#include <mrpt/maps/COccupancyGridMap2D.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace mrpt;
+using namespace mrpt::maps;
+
+namespace
+{
+/** 1D squared-distance transform of the sampled function `f[0..n-1]`
+ * (Felzenszwalb & Huttenlocher, "Distance Transforms of Sampled
+ * Functions"). `v` and `z` are caller-provided scratch buffers of sizes
+ * n and n+1. */
+void dt1d(const float* f, int n, float* d, int* v, float* z)
+{
+  // Large-but-finite "infinity", so INF-INF stays 0 instead of NaN:
+  constexpr float INF = 1e20f;
+
+  int k = 0;
+  v[0] = 0;
+  z[0] = -INF;
+  z[1] = +INF;
+
+  for (int q = 1; q < n; q++)
+  {
+    float s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2 * q - 2 * v[k]);
+    while (s <= z[k])
+    {
+      k--;
+      s = ((f[q] + q * q) - (f[v[k]] + v[k] * v[k])) / (2 * q - 2 * v[k]);
+    }
+    k++;
+    v[k] = q;
+    z[k] = s;
+    z[k + 1] = +INF;
+  }
+
+  k = 0;
+  for (int q = 0; q < n; q++)
+  {
+    while (z[k + 1] < q) k++;
+    d[q] = (q - v[k]) * (q - v[k]) + f[v[k]];
+  }
+}
+}  // namespace
+
+void COccupancyGridMap2D::rebuildDistanceTransformWindow(
+    int wx0, int wx1, int wy0, int wy1, int ox0, int ox1, int oy0, int oy1, float maxDist) const
+{
+  const int W = wx1 - wx0 + 1, H = wy1 - wy0 + 1;
+  ASSERT_(W > 0 && H > 0);
+
+  const cellType thresholdCellValue = p2l(0.5f);
+  const float capSqCells = square(maxDist / m_resolution);
+
+  // Phase 1: per-column distances (in cells) to the nearest obstacle along
+  // the y axis, by the usual forward/backward linear scans:
+  constexpr float INF = 1e20f;
+  const float INF_CELLS = d2f(W + H + 1);
+
+  std::vector<float> g(static_cast<size_t>(W) * H);
+  for (int x = 0; x < W; x++)
+  {
+    const cellType* col = &m_map[(wx0 + x) + static_cast<size_t>(wy0) * m_size_x];
+
+    float dist = INF_CELLS;
+    for (int y = 0; y < H; y++, col += m_size_x)
+    {
+      dist = (*col < thresholdCellValue) ? 0 : dist + 1;
+      g[x + static_cast<size_t>(y) * W] = dist;
+    }
+    dist = INF_CELLS;
+    for (int y = H - 1; y >= 0; y--)
+    {
+      col -= m_size_x;
+      dist = (*col < thresholdCellValue) ? 0 : std::min(dist + 1, g[x + static_cast<size_t>(y) * W]);
+      g[x + static_cast<size_t>(y) * W] = dist;
+    }
+  }
+
+  // Phase 2: 1D squared EDT along each row over g^2, writing back only the
+  // requested output rectangle:
+  std::vector<float> f(W), d(W);
+  std::vector<int> v(W);
+  std::vector<float> z(W + 1);
+
+  for (int y = oy0 - wy0; y <= oy1 - wy0; y++)
+  {
+    for (int x = 0; x < W; x++)
+    {
+      const float gy = g[x + static_cast<size_t>(y) * W];
+      f[x] = (gy >= INF_CELLS) ? INF : gy * gy;
+    }
+    dt1d(f.data(), W, d.data(), v.data(), z.data());
+
+    float* out = &m_distanceTransform[ox0 + static_cast<size_t>(wy0 + y) * m_size_x];
+    for (int x = ox0 - wx0; x <= ox1 - wx0; x++)
+      *out++ = (d[x] >= capSqCells) ? maxDist : std::sqrt(d[x]) * m_resolution;
+  }
+}
+
+const std::vector<float>& COccupancyGridMap2D::distanceTransform(float maxDist) const
+{
+  MRPT_START
+  ASSERT_GT_(maxDist, 0);
+
+  const size_t N = m_map.size();
+
+  const bool fullRebuild = m_distanceTransformOutDated || m_distanceTransform.size() != N ||
+      m_distanceTransformMaxDist != maxDist;
+
+  if (fullRebuild)
+  {
+    m_distanceTransform.assign(N, maxDist);
+    if (N) rebuildDistanceTransformWindow(
+            0, m_size_x - 1, 0, m_size_y - 1, 0, m_size_x - 1, 0, m_size_y - 1, maxDist);
+    m_distanceTransformMaxDist = maxDist;
+    m_distanceTransformOutDated = false;
+  }
+  else if (m_dtDirtyCx0 <= m_dtDirtyCx1 && m_dtDirtyCy0 <= m_dtDirtyCy1)
+  {
+    // Incremental refresh: obstacles only changed inside the dirty rect,
+    // so the capped field may only change within a maxDist margin around
+    // it; recomputing over a 2x margin window makes the output exact.
+    const int margin = static_cast<int>(std::ceil(maxDist / m_resolution)) + 1;
+
+    const int ox0 = std::max(0, m_dtDirtyCx0 - margin);
+    const int ox1 = std::min<int>(m_size_x - 1, m_dtDirtyCx1 + margin);
+    const int oy0 = std::max(0, m_dtDirtyCy0 - margin);
+    const int oy1 = std::min<int>(m_size_y - 1, m_dtDirtyCy1 + margin);
+
+    const int wx0 = std::max(0, ox0 - margin);
+    const int wx1 = std::min<int>(m_size_x - 1, ox1 + margin);
+    const int wy0 = std::max(0, oy0 - margin);
+    const int wy1 = std::min<int>(m_size_y - 1, oy1 + margin);
+
+    rebuildDistanceTransformWindow(wx0, wx1, wy0, wy1, ox0, ox1, oy0, oy1, maxDist);
+  }
+
+  // The cache is up to date now:
+  m_dtDirtyCx0 = m_dtDirtyCy0 = 1;
+  m_dtDirtyCx1 = m_dtDirtyCy1 = 0;
+
+  return m_distanceTransform;
+  MRPT_END
+}
+
+void COccupancyGridMap2D::markDistanceTransformDirtyCells(int cx0, int cx1, int cy0, int cy1) const
+{
+  if (m_distanceTransformOutDated) return;  // Fully invalidated already
+
+  cx0 = std::max(0, cx0);
+  cy0 = std::max(0, cy0);
+  cx1 = std::min<int>(m_size_x - 1, cx1);
+  cy1 = std::min<int>(m_size_y - 1, cy1);
+  if (cx0 > cx1 || cy0 > cy1) return;
+
+  if (m_dtDirtyCx0 > m_dtDirtyCx1 || m_dtDirtyCy0 > m_dtDirtyCy1)
+  {
+    m_dtDirtyCx0 = cx0;
+    m_dtDirtyCx1 = cx1;
+    m_dtDirtyCy0 = cy0;
+    m_dtDirtyCy1 = cy1;
+  }
+  else
+  {
+    m_dtDirtyCx0 = std::min(m_dtDirtyCx0, cx0);
+    m_dtDirtyCx1 = std::max(m_dtDirtyCx1, cx1);
+    m_dtDirtyCy0 = std::min(m_dtDirtyCy0, cy0);
+    m_dtDirtyCy1 = std::max(m_dtDirtyCy1, cy1);
+  }
+}
@@ -9,6 +9,7 @@
 
 #include "maps-precomp.h"  // Precomp header
 //
+#include <mrpt/core/WorkerThreadsPool.h>
 #include <mrpt/core/round.h>  // round()
 #include <mrpt/maps/COccupancyGridMap2D.h>
 #include <mrpt/obs/CObservation2DRangeScan.h>
@@ -16,6 +17,10 @@
 #include <mrpt/serialization/CArchive.h>
 #include <mrpt/system/memory.h>  // alloca()
 
+#include <algorithm>
+#include <future>
+#include <vector>
+
 #if HAVE_ALLOCA_H
 #include <alloca.h>
 #endif
@@ -202,6 +207,11 @@ bool COccupancyGridMap2D::internal_insertObservation(
           new_y_min = min(new_y_min, *scanPoint_y);
         }
 
+        // Area possibly touched by this scan, for the incremental
+        // distance-transform cache (before the margins below):
+        const float dtX0 = min(new_x_min, px), dtX1 = max(new_x_max, px);
+        const float dtY0 = min(new_y_min, py), dtY1 = max(new_y_max, py);
+
         // Add an extra margin:
         float securMargen = 15 * m_resolution;
 
@@ -228,6 +238,10 @@ bool COccupancyGridMap2D::internal_insertObservation(
         // -----------------------
         resizeGrid(new_x_min, new_x_max, new_y_min, new_y_max, 0.5);
 
+        markDistanceTransformDirtyCells(x2idx(dtX0), x2idx(dtX1), y2idx(dtY0), y2idx(dtY1));
+        if (!m_tileChangeCnt.empty())
+          markTileChangedCells(x2idx(dtX0), x2idx(dtX1), y2idx(dtY0), y2idx(dtY1));
+
         // For updateCell_fast methods:
         cellType* theMapArray = &m_map[0];
         unsigned theMapSize_x = m_size_x;
@@ -236,6 +250,24 @@ bool COccupancyGridMap2D::internal_insertObservation(
         int cy0 = y2idx(py);
 
         // Insert rays:
+        if (insertionOptions.batchSortedRayUpdates)
+        {
+          // Batched variant: trace all rays first into per-sector lists
+          // of touched cells, sort them in row-major (memory) order, and
+          // update the grid in one cache-friendly sweep. Tracing of the
+          // angular sectors may run in parallel; the grid itself is only
+          // written from this thread.
+          insertScanAsSortedCellLists(
+              o, scanPoints_x, scanPoints_y, nRanges, K, cx0, cy0, maxDistanceInsertion,
+              invalidAsFree, logodd_observation_free, logodd_noecho_free,
+              logodd_observation_occupied, logodd_thres_free, logodd_thres_occupied);
+
+          mrpt_alloca_free(scanPoints_x);
+          mrpt_alloca_free(scanPoints_y);
+
+          return true;
+        }
+
         for (idx = 0; idx < nRanges; idx += K)
         {
           if (!o.getScanRangeValidity(idx) && !invalidAsFree) continue;
@@ -361,6 +393,11 @@ bool COccupancyGridMap2D::internal_insertObservation(
           new_y_min = min(new_y_min, scanPoint_y);
         }
 
+        // Area possibly touched by this scan, for the incremental
+        // distance-transform cache (before the margins below):
+        const float dtX0 = min(new_x_min, px), dtX1 = max(new_x_max, px);
+        const float dtY0 = min(new_y_min, py), dtY1 = max(new_y_max, py);
+
         // Add an extra margin:
         float securMargen = 15 * m_resolution;
 
@@ -387,6 +424,10 @@ bool COccupancyGridMap2D::internal_insertObservation(
         // -----------------------
         resizeGrid(new_x_min, new_x_max, new_y_min, new_y_max, 0.5);
 
+        markDistanceTransformDirtyCells(x2idx(dtX0), x2idx(dtX1), y2idx(dtY0), y2idx(dtY1));
+        if (!m_tileChangeCnt.empty())
+          markTileChangedCells(x2idx(dtX0), x2idx(dtX1), y2idx(dtY0), y2idx(dtY1));
+
         // For updateCell_fast methods:
         cellType* theMapArray = &m_map[0];
         unsigned theMapSize_x = m_size_x;
@@ -759,6 +800,9 @@ bool COccupancyGridMap2D::internal_insertObservation(
   }
   else if (IS_CLASS(obs, CObservationRange))
   {
+    // (No per-area bookkeeping for sonar-like observations)
+    m_distanceTransformOutDated = true;
+
     const auto& o = dynamic_cast<const CObservationRange&>(obs);
     CPose3D spose;
     o.getSensorPose(spose);
@@ -1243,6 +1287,179 @@ bool COccupancyGridMap2D::internal_insertObservation(
   //	MRPT_END
 }
 
+/*---------------------------------------------------------------
+          insertScanAsSortedCellLists
+  ---------------------------------------------------------------*/
+void COccupancyGridMap2D::insertScanAsSortedCellLists(
+    const CObservation2DRangeScan& scan,
+    const float* scanPoints_x,
+    const float* scanPoints_y,
+    size_t nRanges,
+    int K,
+    int cx0,
+    int cy0,
+    float maxDistanceInsertion,
+    bool invalidAsFree,
+    cellType logodd_observation_free,
+    cellType logodd_noecho_free,
+    cellType logodd_observation_occupied,
+    cellType logodd_thres_free,
+    cellType logodd_thres_occupied)
+{
+  // Cells touched by the rays of one angular sector, as row-major indices
+  // into m_map. "Valid" and "no echo" free cells are kept apart since they
+  // use different log-odds increments.
+  struct TSectorCells
+  {
+    std::vector<uint32_t> freeValid, freeNoEcho, occupied;
+  };
+
+  cellType* theMapArray = &m_map[0];
+  const unsigned theMapSize_x = m_size_x;
+
+  const size_t nRays = (nRanges + K - 1) / K;
+  const size_t nThreads = std::max<size_t>(1, insertionOptions.insertionNumThreads);
+  std::vector<TSectorCells> sectors(nThreads);
+
+  // Trace the rays [firstRay, lastRay) into `out`, then leave each list
+  // sorted in memory order. This only reads the grid geometry, so several
+  // sectors can be traced concurrently:
+  const auto traceSector = [&](size_t firstRay, size_t lastRay, TSectorCells& out)
+  {
+    out.freeValid.reserve((lastRay - firstRay) * 16);
+
+    for (size_t r = firstRay; r < lastRay; r++)
+    {
+      const size_t i = r * K;
+      if (!scan.getScanRangeValidity(i) && !invalidAsFree) continue;
+
+      // Same "fractional integers" Bresenham stepping as the default
+      // insertion path:
+      int cx = cx0, cy = cy0;
+      const int trg_cx = x2idx(scanPoints_x[i]);
+      const int trg_cy = y2idx(scanPoints_y[i]);
+
+      ASSERT_(
+          static_cast<unsigned int>(trg_cx) < m_size_x &&
+          static_cast<unsigned int>(trg_cy) < m_size_y);
+
+      const int Acx = trg_cx - cx;
+      const int Acy = trg_cy - cy;
+      const int Acx_ = std::abs(Acx);
+      const int Acy_ = std::abs(Acy);
+
+      const int nStepsRay = max(Acx_, Acy_);
+      if (!nStepsRay) continue;
+
+      const float N_1 = 1.0f / nStepsRay;
+      const int frAcx = (Acx < 0 ? -1 : +1) * round((Acx_ << FRBITS) * N_1);
+      const int frAcy = (Acy < 0 ? -1 : +1) * round((Acy_ << FRBITS) * N_1);
+
+      int frCX = cx << FRBITS;
+      int frCY = cy << FRBITS;
+
+      auto& freeCells = scan.getScanRangeValidity(i) ? out.freeValid : out.freeNoEcho;
+
+      for (int nStep = 0; nStep < nStepsRay; nStep++)
+      {
+        freeCells.push_back(cx + cy * theMapSize_x);
+
+        frCX += frAcx;
+        frCY += frAcy;
+
+        cx = frCX >> FRBITS;
+        cy = frCY >> FRBITS;
+      }
+
+      if (scan.getScanRangeValidity(i) && scan.getScanRange(i) < maxDistanceInsertion)
+        out.occupied.push_back(trg_cx + trg_cy * theMapSize_x);
+    }
+
+    std::sort(out.freeValid.begin(), out.freeValid.end());
+    std::sort(out.freeNoEcho.begin(), out.freeNoEcho.end());
+    std::sort(out.occupied.begin(), out.occupied.end());
+  };
+
+  if (nThreads == 1 || nRays < 2 * nThreads)
+  {
+    traceSector(0, nRays, sectors[0]);
+  }
+  else
+  {
+    if (!m_batchInsertPool)
+      m_batchInsertPool = std::make_shared<mrpt::WorkerThreadsPool>(
+          nThreads, mrpt::WorkerThreadsPool::POLICY_FIFO, "COccupancyGridMap2D_insert");
+    else if (m_batchInsertPool->size() < nThreads)
+      m_batchInsertPool->resize(nThreads);
+
+    std::vector<std::future<void>> futs;
+    futs.reserve(nThreads);
+    for (size_t s = 0; s < nThreads; s++)
+    {
+      const size_t r0 = (s * nRays) / nThreads;
+      const size_t r1 = ((s + 1) * nRays) / nThreads;
+      if (r0 >= r1) continue;
+      futs.emplace_back(m_batchInsertPool->enqueue([&traceSector, &sectors, r0, r1, s]()
+                                                   { traceSector(r0, r1, sectors[s]); }));
+    }
+    for (auto& f : futs) f.get();  // join (and rethrow errors, if any)
+  }
+
+  // Apply the sorted cell lists: runs of equal indices are collapsed into
+  // one closed-form update that reproduces, exactly, the saturation
+  // behavior of N consecutive updateCell_fast_free() calls:
+  const auto applyFreeRuns = [&](const std::vector<uint32_t>& cells, cellType logodd_free)
+  {
+    for (size_t i = 0; i < cells.size();)
+    {
+      size_t j = i + 1;
+      while (j < cells.size() && cells[j] == cells[i]) j++;
+      const int count = static_cast<int>(j - i);
+
+      cellType& c = theMapArray[cells[i]];
+      if (c >= logodd_thres_free) c = OCCGRID_CELLTYPE_MAX;
+      else
+      {
+        const int maxAdds = (logodd_thres_free - c + logodd_free - 1) / logodd_free;
+        if (count <= maxAdds) c = static_cast<cellType>(c + count * logodd_free);
+        else
+          c = OCCGRID_CELLTYPE_MAX;
+      }
+      i = j;
+    }
+  };
+  // Idem for updateCell_fast_occupied():
+  const auto applyOccupiedRuns = [&](const std::vector<uint32_t>& cells)
+  {
+    for (size_t i = 0; i < cells.size();)
+    {
+      size_t j = i + 1;
+      while (j < cells.size() && cells[j] == cells[i]) j++;
+      const int count = static_cast<int>(j - i);
+
+      cellType& c = theMapArray[cells[i]];
+      if (c <= logodd_thres_occupied) c = OCCGRID_CELLTYPE_MIN;
+      else
+      {
+        const int maxSubs =
+            (c - logodd_thres_occupied + logodd_observation_occupied - 1) /
+            logodd_observation_occupied;
+        if (count <= maxSubs) c = static_cast<cellType>(c - count * logodd_observation_occupied);
+        else
+          c = OCCGRID_CELLTYPE_MIN;
+      }
+      i = j;
+    }
+  };
+
+  for (const auto& sec : sectors)
+  {
+    applyFreeRuns(sec.freeValid, logodd_observation_free);
+    applyFreeRuns(sec.freeNoEcho, logodd_noecho_free);
+    applyOccupiedRuns(sec.occupied);
+  }
+}
+
 /*---------------------------------------------------------------
           loadFromConfigFile
   ---------------------------------------------------------------*/
@@ -1262,6 +1479,8 @@ void COccupancyGridMap2D::TInsertionOptions::loadFromConfigFile(
   MRPT_LOAD_CONFIG_VAR(CFD_features_gaussian_size, float, iniFile, section);
   MRPT_LOAD_CONFIG_VAR(CFD_features_median_size, float, iniFile, section);
   MRPT_LOAD_CONFIG_VAR(wideningBeamsWithDistance, bool, iniFile, section);
+  MRPT_LOAD_CONFIG_VAR(batchSortedRayUpdates, bool, iniFile, section);
+  MRPT_LOAD_CONFIG_VAR(insertionNumThreads, int, iniFile, section);
 }
 
 /*---------------------------------------------------------------
@@ -1285,6 +1504,8 @@ void COccupancyGridMap2D::TInsertionOptions::dumpToTextStream(std::ostream& out)
   LOADABLEOPTS_DUMP_VAR(CFD_features_gaussian_size, float)
   LOADABLEOPTS_DUMP_VAR(CFD_features_median_size, float)
   LOADABLEOPTS_DUMP_VAR(wideningBeamsWithDistance, bool)
+  LOADABLEOPTS_DUMP_VAR(batchSortedRayUpdates, bool)
+  LOADABLEOPTS_DUMP_VAR(insertionNumThreads, int)
 
   out << "\n";
 }
@@ -0,0 +1,138 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include "maps-precomp.h"  // Precomp header
+//
+#include <mrpt/config.h>
+
+#include "COccupancyGridMap2D_likelihood_internal.h"
+
+#if MRPT_ARCH_INTEL_COMPATIBLE
+
+#include <mrpt/core/SSE_types.h>
+
+using namespace mrpt::maps;
+
+namespace
+{
+// 4-wide polynomial approximations of expf()/logf(), following the classic
+// Cephes/sse_mathfun formulation (relative error ~1e-6 over the ranges used
+// by the likelihood field: exp() of non-positive args, log() of positives).
+
+inline __m128 exp4f(__m128 x)
+{
+  const __m128 one = _mm_set1_ps(1.0f);
+
+  x = _mm_min_ps(x, _mm_set1_ps(88.3762626647950f));
+  x = _mm_max_ps(x, _mm_set1_ps(-87.3365478515625f));
+
+  // express exp(x) as exp(g) * 2^n:
+  __m128 fx = _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(1.44269504088896341f)), _mm_set1_ps(0.5f));
+  // floor(fx):
+  __m128 tmp = _mm_cvtepi32_ps(_mm_cvttps_epi32(fx));
+  const __m128 stepAdj = _mm_and_ps(_mm_cmpgt_ps(tmp, fx), one);
+  fx = _mm_sub_ps(tmp, stepAdj);
+
+  x = _mm_sub_ps(x, _mm_mul_ps(fx, _mm_set1_ps(0.693359375f)));
+  x = _mm_sub_ps(x, _mm_mul_ps(fx, _mm_set1_ps(-2.12194440e-4f)));
+
+  const __m128 z = _mm_mul_ps(x, x);
+  __m128 y = _mm_set1_ps(1.9875691500e-4f);
+  y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(1.3981999507e-3f));
+  y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(8.3334519073e-3f));
+  y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(4.1665795894e-2f));
+  y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(1.6666665459e-1f));
+  y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(5.0000001201e-1f));
+  y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(y, z), x), one);
+
+  // scale by 2^n:
+  __m128i emm0 = _mm_cvttps_epi32(fx);
+  emm0 = _mm_slli_epi32(_mm_add_epi32(emm0, _mm_set1_epi32(0x7f)), 23);
+  return _mm_mul_ps(y, _mm_castsi128_ps(emm0));
+}
+
+inline __m128 log4f(__m128 x)
+{
+  const __m128 one = _mm_set1_ps(1.0f);
+
+  // Avoid denormals/zero (inputs are strictly positive likelihoods):
+  x = _mm_max_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x00800000)));
+
+  // Exponent and mantissa in [0.5, 1):
+  __m128i emm0 = _mm_srli_epi32(_mm_castps_si128(x), 23);
+  emm0 = _mm_sub_epi32(emm0, _mm_set1_epi32(0x7f));
+  __m128 e = _mm_add_ps(_mm_cvtepi32_ps(emm0), one);
+
+  x = _mm_and_ps(x, _mm_castsi128_ps(_mm_set1_epi32(~0x7f800000)));
+  x = _mm_or_ps(x, _mm_set1_ps(0.5f));
+
+  // If mantissa < sqrt(1/2): adjust exponent and double mantissa:
+  const __m128 mask = _mm_cmplt_ps(x, _mm_set1_ps(0.707106781186547524f));
+  const __m128 tmp = _mm_and_ps(x, mask);
+  x = _mm_sub_ps(x, one);
+  e = _mm_sub_ps(e, _mm_and_ps(one, mask));
+  x = _mm_add_ps(x, tmp);
+
+  const __m128 z = _mm_mul_ps(x, x);
+  __m128 y = _mm_set1_ps(7.0376836292e-2f);
+  y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(-1.1514610310e-1f));
+  y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(1.1676998740e-1f));
+  y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(-1.2420140846e-1f));
+  y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(1.4249322787e-1f));
+  y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(-1.6668057665e-1f));
+  y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(2.0000714765e-1f));
+  y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(-2.4999993993e-1f));
+  y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(3.3333331174e-1f));
+  y = _mm_mul_ps(_mm_mul_ps(y, x), z);
+
+  y = _mm_add_ps(y, _mm_mul_ps(e, _mm_set1_ps(-2.12194440e-4f)));
+  y = _mm_sub_ps(y, _mm_mul_ps(z, _mm_set1_ps(0.5f)));
+  x = _mm_add_ps(x, y);
+  x = _mm_add_ps(x, _mm_mul_ps(e, _mm_set1_ps(0.693359375f)));
+  return x;
+}
+}  // namespace
+
+void internal::evalLikelihoodBatch_SSE2(
+    const float* QdistsSq, size_t n, float zHit, float zRandomTerm, float* liks)
+{
+  const __m128 vZHit = _mm_set1_ps(zHit);
+  const __m128 vZRnd = _mm_set1_ps(zRandomTerm);
+
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+  {
+    const __m128 e = exp4f(_mm_loadu_ps(&QdistsSq[i]));
+    _mm_storeu_ps(&liks[i], _mm_add_ps(vZRnd, _mm_mul_ps(vZHit, e)));
+  }
+  if (i < n) evalLikelihoodBatch_generic(QdistsSq + i, n - i, zHit, zRandomTerm, liks + i);
+}
+
+double internal::sumLogLikelihoodBatch_SSE2(const float* liks, size_t n)
+{
+  __m128d acc = _mm_setzero_pd();
+
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+  {
+    const __m128 l = log4f(_mm_loadu_ps(&liks[i]));
+    // Accumulate in double to keep the long sums accurate:
+    acc = _mm_add_pd(acc, _mm_cvtps_pd(l));
+    acc = _mm_add_pd(acc, _mm_cvtps_pd(_mm_movehl_ps(l, l)));
+  }
+
+  alignas(16) double accs[2];
+  _mm_store_pd(accs, acc);
+  double ret = accs[0] + accs[1];
+
+  if (i < n) ret += sumLogLikelihoodBatch_generic(liks + i, n - i);
+  return ret;
+}
+
+#endif  // MRPT_ARCH_INTEL_COMPATIBLE
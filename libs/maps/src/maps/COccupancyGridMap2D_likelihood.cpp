@@ -9,12 +9,17 @@
 
 #include "maps-precomp.h"  // Precomp header
 //
+#include <mrpt/core/cpu.h>
 #include <mrpt/maps/COccupancyGridMap2D.h>
 #include <mrpt/maps/CSimplePointsMap.h>
 #include <mrpt/obs/CObservation2DRangeScan.h>
 #include <mrpt/obs/CObservationRange.h>
 #include <mrpt/serialization/CArchive.h>
 
+#include <vector>
+
+#include "COccupancyGridMap2D_likelihood_internal.h"
+
 using namespace mrpt;
 using namespace mrpt::math;
 using namespace mrpt::maps;
@@ -484,6 +489,41 @@ double COccupancyGridMap2D::computeObservationLikelihood_likelihoodField_II(
   MRPT_END
 }
 
+void mrpt::maps::internal::evalLikelihoodBatch_generic(
+    const float* QdistsSq, size_t n, float zHit, float zRandomTerm, float* liks)
+{
+  for (size_t i = 0; i < n; i++) liks[i] = zRandomTerm + zHit * std::exp(QdistsSq[i]);
+}
+
+double mrpt::maps::internal::sumLogLikelihoodBatch_generic(const float* liks, size_t n)
+{
+  double ret = 0;
+  for (size_t i = 0; i < n; i++) ret += std::log(liks[i]);
+  return ret;
+}
+
+void mrpt::maps::internal::evalLikelihoodBatch(
+    const float* QdistsSq, size_t n, float zHit, float zRandomTerm, float* liks)
+{
+#if MRPT_ARCH_INTEL_COMPATIBLE
+  if (mrpt::cpu::supports(mrpt::cpu::feature::SSE2))
+  {
+    mrpt::maps::internal::evalLikelihoodBatch_SSE2(QdistsSq, n, zHit, zRandomTerm, liks);
+    return;
+  }
+#endif
+  mrpt::maps::internal::evalLikelihoodBatch_generic(QdistsSq, n, zHit, zRandomTerm, liks);
+}
+
+double mrpt::maps::internal::sumLogLikelihoodBatch(const float* liks, size_t n)
+{
+#if MRPT_ARCH_INTEL_COMPATIBLE
+  if (mrpt::cpu::supports(mrpt::cpu::feature::SSE2))
+    return mrpt::maps::internal::sumLogLikelihoodBatch_SSE2(liks, n);
+#endif
+  return mrpt::maps::internal::sumLogLikelihoodBatch_generic(liks, n);
+}
+
 /*---------------------------------------------------------------
           computeLikelihoodField_Thrun
  ---------------------------------------------------------------*/
@@ -492,6 +532,9 @@ double COccupancyGridMap2D::computeLikelihoodField_Thrun(
 {
   MRPT_START
 
+  if (likelihoodOptions.LF_useVectorizedEval)
+    return computeLikelihoodField_Thrun_batch(pm, relativePose);
+
   double ret;
   size_t N = pm->size();
   int K = (int)ceil(
@@ -550,6 +593,12 @@ double COccupancyGridMap2D::computeLikelihoodField_Thrun(
 
   if (N < 10) decimation = 1;
 
+  // Optionally, read the closest-obstacle distances off the incremental
+  // distance transform instead of searching around each cell:
+  const float* dtField = nullptr;
+  if (likelihoodOptions.LF_useDistanceTransform)
+    dtField = distanceTransform(likelihoodOptions.LF_maxCorrsDistance).data();
+
   TPoint2D pointLocal;
   TPoint2D pointGlobal;
 
@@ -598,16 +647,24 @@ double COccupancyGridMap2D::computeLikelihoodField_Thrun(
       {
         // Compute now:
         // -------------
-        // Find the closest occupied cell in a certain range, given by
-        // K:
-        int xx1 = max(0, cx - K);
-        int xx2 = min(size_x_1, (unsigned)(cx + K));
-        int yy1 = max(0, cy - K);
-        int yy2 = min(size_y_1, (unsigned)(cy + K));
-
-        // Optimized code: this part will be invoked a *lot* of times:
         float occupiedMinDist;
+        if (dtField)
         {
+          // Single lookup into the precomputed distance field:
+          occupiedMinDist = square(dtField[cx + cy * m_size_x]);
+        }
+        else
+        {
+          // Find the closest occupied cell in a certain range, given
+          // by K:
+          int xx1 = max(0, cx - K);
+          int xx2 = min(size_x_1, (unsigned)(cx + K));
+          int yy1 = max(0, cy - K);
+          int yy2 = min(size_y_1, (unsigned)(cy + K));
+
+          // Optimized code: this part will be invoked a *lot* of
+          // times:
+
           // Initial pointer position
           const cellType* mapPtr = &m_map[xx1 + yy1 * m_size_x];
           unsigned incrAfterRow = m_size_x - ((xx2 - xx1) + 1);
@@ -670,6 +727,212 @@ double COccupancyGridMap2D::computeLikelihoodField_Thrun(
   MRPT_END
 }
 
+/*---------------------------------------------------------------
+          computeLikelihoodField_Thrun_batch
+ ---------------------------------------------------------------*/
+double COccupancyGridMap2D::computeLikelihoodField_Thrun_batch(
+    const CPointsMap* pm, const CPose2D* relativePose) const
+{
+  MRPT_START
+
+  const size_t N = pm->size();
+  const int K = (int)ceil(likelihoodOptions.LF_maxCorrsDistance / m_resolution);
+
+  const bool Product_T_OrSum_F = !likelihoodOptions.LF_alternateAverageMethod;
+
+  if (!N)
+  {
+    return -100;  // No way to estimate this likelihood!!
+  }
+
+  const float stdHit = likelihoodOptions.LF_stdHit;
+  const float zHit = likelihoodOptions.LF_zHit;
+  const float zRandom = likelihoodOptions.LF_zRandom;
+  const float zRandomMaxRange = likelihoodOptions.LF_maxRange;
+  const float zRandomTerm = zRandom / zRandomMaxRange;
+  const float Q = -0.5f / square(stdHit);
+
+  const unsigned int size_x_1 = m_size_x - 1;
+  const unsigned int size_y_1 = m_size_y - 1;
+
+  const double maxCorrDist_sq = square(likelihoodOptions.LF_maxCorrsDistance);
+  const double minimumLik = zRandomTerm + zHit * exp(Q * maxCorrDist_sq);
+
+  if (likelihoodOptions.enableLikelihoodCache)
+  {
+    // Reset the precomputed likelihood values map
+    if (m_likelihoodCacheOutDated)
+    {
+      if (!m_map.empty())
+        m_precomputedLikelihood.assign(m_map.size(), LIK_LF_CACHE_INVALID);
+      else
+        m_precomputedLikelihood.clear();
+
+      m_likelihoodCacheOutDated = false;
+    }
+  }
+
+  const cellType thresholdCellValue = p2l(0.5f);
+  int decimation = likelihoodOptions.LF_decimation;
+  if (N < 10) decimation = 1;
+
+  // Optionally, read the closest-obstacle distances off the incremental
+  // distance transform instead of searching around each cell:
+  const float* dtField = nullptr;
+  if (likelihoodOptions.LF_useDistanceTransform)
+    dtField = distanceTransform(likelihoodOptions.LF_maxCorrsDistance).data();
+
+  const double _resolution = this->m_resolution;
+  const double constDist2DiscrUnits = 100 / (_resolution * _resolution);
+  const double constDist2DiscrUnits_INV = 1.0 / constDist2DiscrUnits;
+
+  // The pose increment is constant for the whole scan, so evaluate the
+  // sin/cos once (unlike the per-point path):
+  double ccos = 1, ssin = 0;
+  if (relativePose)
+  {
+#ifdef HAVE_SINCOS
+    ::sincos(relativePose->phi(), &ssin, &ccos);
+#else
+    ccos = cos(relativePose->phi());
+    ssin = sin(relativePose->phi());
+#endif
+  }
+
+  // Phase 1 (gather): resolve each point either to an already-known
+  // likelihood (cache hit / out of map) or to a pending Q*dist^2 entry
+  // awaiting the batched exp() evaluation:
+  std::vector<float> liks;
+  liks.reserve(N / decimation + 1);
+  std::vector<float> pendingQd;
+  std::vector<uint32_t> pendingSlot;  // Index into `liks`
+  std::vector<uint32_t> pendingCell;  // Index into the cache, for write-back
+
+  TPoint2D pointLocal;
+  TPoint2D pointGlobal;
+
+  for (size_t j = 0; j < N; j += decimation)
+  {
+    // Get the point and pass it to global coordinates:
+    if (relativePose)
+    {
+      pm->getPoint(j, pointLocal);
+      pointGlobal.x = relativePose->x() + pointLocal.x * ccos - pointLocal.y * ssin;
+      pointGlobal.y = relativePose->y() + pointLocal.x * ssin + pointLocal.y * ccos;
+    }
+    else
+    {
+      pm->getPoint(j, pointGlobal);
+    }
+
+    // Point to cell indixes
+    const int cx = x2idx(pointGlobal.x);
+    const int cy = y2idx(pointGlobal.y);
+
+    if (static_cast<unsigned>(cx) >= size_x_1 || static_cast<unsigned>(cy) >= size_y_1)
+    {
+      // We are outside of the map: Assign the likelihood for the max.
+      // correspondence distance:
+      liks.push_back(d2f(minimumLik));
+      continue;
+    }
+
+    if (likelihoodOptions.enableLikelihoodCache)
+    {
+      const double cached = m_precomputedLikelihood[cx + cy * m_size_x];
+      if (cached != LIK_LF_CACHE_INVALID)
+      {
+        liks.push_back(d2f(cached));
+        continue;
+      }
+    }
+
+    float occupiedMinDist;
+    if (dtField)
+    {
+      // Single lookup into the precomputed distance field:
+      occupiedMinDist = square(dtField[cx + cy * m_size_x]);
+    }
+    else
+    {
+      // Find the closest occupied cell within the checking area, exactly
+      // as in the per-point path:
+      const int xx1 = max(0, cx - K);
+      const int xx2 = min(size_x_1, (unsigned)(cx + K));
+      const int yy1 = max(0, cy - K);
+      const int yy2 = min(size_y_1, (unsigned)(cy + K));
+
+      const cellType* mapPtr = &m_map[xx1 + yy1 * m_size_x];
+      unsigned incrAfterRow = m_size_x - ((xx2 - xx1) + 1);
+
+      signed int Ax0 = 10 * (xx1 - cx);
+      signed int Ay = 10 * (yy1 - cy);
+
+      unsigned int occupiedMinDistInt = mrpt::round(maxCorrDist_sq * constDist2DiscrUnits);
+
+      for (int yy = yy1; yy <= yy2; yy++)
+      {
+        unsigned int Ay2 = square((unsigned int)(Ay));
+        signed short Ax = Ax0;
+        cellType cell;
+
+        for (int xx = xx1; xx <= xx2; xx++)
+        {
+          if ((cell = *mapPtr++) < thresholdCellValue)
+          {
+            unsigned int d = square((unsigned int)(Ax)) + Ay2;
+            keep_min(occupiedMinDistInt, d);
+          }
+          Ax += 10;
+        }
+        mapPtr += incrAfterRow;
+        Ay += 10;
+      }
+
+      occupiedMinDist = d2f(occupiedMinDistInt * constDist2DiscrUnits_INV);
+    }
+
+    if (likelihoodOptions.LF_useSquareDist) occupiedMinDist *= occupiedMinDist;
+
+    pendingSlot.push_back(static_cast<uint32_t>(liks.size()));
+    pendingCell.push_back(cx + cy * m_size_x);
+    pendingQd.push_back(Q * occupiedMinDist);
+    liks.push_back(0);  // Filled in below
+  }
+
+  // Phase 2: evaluate all the pending exp() at once (SIMD, if available):
+  if (!pendingQd.empty())
+  {
+    std::vector<float> newLiks(pendingQd.size());
+    mrpt::maps::internal::evalLikelihoodBatch(
+        pendingQd.data(), pendingQd.size(), zHit, zRandomTerm, newLiks.data());
+
+    for (size_t i = 0; i < newLiks.size(); i++)
+    {
+      liks[pendingSlot[i]] = newLiks[i];
+      if (likelihoodOptions.enableLikelihoodCache)
+        m_precomputedLikelihood[pendingCell[i]] = newLiks[i];
+    }
+  }
+
+  // Phase 3: accumulate the batch:
+  double ret;
+  if (Product_T_OrSum_F)
+  {
+    ret = mrpt::maps::internal::sumLogLikelihoodBatch(liks.data(), liks.size());
+  }
+  else
+  {
+    double sum = 0;
+    for (const float l : liks) sum += l;
+    ret = log(sum / liks.size());
+  }
+
+  return ret;
+
+  MRPT_END
+}
+
 /*---------------------------------------------------------------
           computeLikelihoodField_II
  ---------------------------------------------------------------*/
@@ -793,6 +1056,9 @@ void COccupancyGridMap2D::TLikelihoodOptions::loadFromConfigFile(
   LF_useSquareDist = iniFile.read_bool(section, "LF_useSquareDist", LF_useSquareDist);
   LF_alternateAverageMethod =
       iniFile.read_bool(section, "LF_alternateAverageMethod", LF_alternateAverageMethod);
+  LF_useVectorizedEval = iniFile.read_bool(section, "LF_useVectorizedEval", LF_useVectorizedEval);
+  LF_useDistanceTransform =
+      iniFile.read_bool(section, "LF_useDistanceTransform", LF_useDistanceTransform);
 
   MI_exponent = iniFile.read_float(section, "MI_exponent", MI_exponent);
   MI_skip_rays = iniFile.read_int(section, "MI_skip_rays", MI_skip_rays);
@@ -862,6 +1128,10 @@ void COccupancyGridMap2D::TLikelihoodOptions::dumpToTextStream(std::ostream& out
       "LF_useSquareDist                        = %c\n", LF_useSquareDist ? 'Y' : 'N');
   out << mrpt::format(
       "LF_alternateAverageMethod               = %c\n", LF_alternateAverageMethod ? 'Y' : 'N');
+  out << mrpt::format(
+      "LF_useVectorizedEval                    = %c\n", LF_useVectorizedEval ? 'Y' : 'N');
+  out << mrpt::format(
+      "LF_useDistanceTransform                 = %c\n", LF_useDistanceTransform ? 'Y' : 'N');
   out << mrpt::format("MI_exponent                             = %f\n", MI_exponent);
   out << mrpt::format("MI_skip_rays                            = %u\n", MI_skip_rays);
   out << mrpt::format("MI_ratio_max_distance                   = %f\n", MI_ratio_max_distance);
@@ -0,0 +1,46 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#pragma once
+
+#include <mrpt/config.h>
+
+#include <cstddef>
+
+namespace mrpt::maps::internal
+{
+/** Evaluates `liks[i] = zRandomTerm + zHit * exp(QdistsSq[i])` for a packed
+ * batch of likelihood-field points, with `QdistsSq[i] = Q*dist_i^2 <= 0`.
+ *
+ * Plain scalar (libm) version, used as fallback and for the tail of the
+ * vectorized loops.
+ */
+void evalLikelihoodBatch_generic(
+    const float* QdistsSq, size_t n, float zHit, float zRandomTerm, float* liks);
+
+/** Returns the sum of log(liks[i]), for liks[i] > 0. Scalar fallback. */
+double sumLogLikelihoodBatch_generic(const float* liks, size_t n);
+
+#if MRPT_ARCH_INTEL_COMPATIBLE
+/// SSE2 version of evalLikelihoodBatch_generic(): 4-wide polynomial exp()
+/// approximation (Cephes-style, relative error ~1e-6).
+void evalLikelihoodBatch_SSE2(
+    const float* QdistsSq, size_t n, float zHit, float zRandomTerm, float* liks);
+
+/// SSE2 version of sumLogLikelihoodBatch_generic(): 4-wide polynomial log().
+double sumLogLikelihoodBatch_SSE2(const float* liks, size_t n);
+#endif
+
+/** Runtime-dispatched version of evalLikelihoodBatch_generic() */
+void evalLikelihoodBatch(const float* QdistsSq, size_t n, float zHit, float zRandomTerm, float* liks);
+
+/** Runtime-dispatched version of sumLogLikelihoodBatch_generic() */
+double sumLogLikelihoodBatch(const float* liks, size_t n);
+
+}  // namespace mrpt::maps::internal
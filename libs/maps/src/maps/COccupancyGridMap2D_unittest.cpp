@@ -37,6 +37,137 @@ TEST(COccupancyGridMap2DTests, insert2DScan)
   }
 }
 
+TEST(COccupancyGridMap2DTests, resizeGridKeepsContents)
+{
+  COccupancyGridMap2D grid(-4.0f, 4.0f, -4.0f, 4.0f, 0.10f);
+  grid.setPos(1.0f, 2.0f, 0.9f);
+  grid.setPos(-3.0f, -1.0f, 0.1f);
+
+  // Grow only towards +y (copy-free path):
+  grid.resizeGrid(-4.0f, 4.0f, -4.0f, 10.0f, 0.5f, false /*additionalMargin*/);
+  EXPECT_NEAR(grid.getPos(1.0f, 2.0f), 0.9f, 0.02f);
+  EXPECT_NEAR(grid.getPos(-3.0f, -1.0f), 0.1f, 0.02f);
+  EXPECT_NEAR(grid.getPos(0.0f, 8.0f), 0.5f, 0.02f);
+
+  // Grow on all four sides:
+  grid.resizeGrid(-12.0f, 9.0f, -7.0f, 15.0f, 0.5f, false /*additionalMargin*/);
+  EXPECT_NEAR(grid.getPos(1.0f, 2.0f), 0.9f, 0.02f);
+  EXPECT_NEAR(grid.getPos(-3.0f, -1.0f), 0.1f, 0.02f);
+  EXPECT_NEAR(grid.getPos(0.0f, 8.0f), 0.5f, 0.02f);
+  EXPECT_NEAR(grid.getPos(-10.0f, -6.0f), 0.5f, 0.02f);
+  EXPECT_NEAR(grid.getPos(8.0f, 14.0f), 0.5f, 0.02f);
+}
+
+TEST(COccupancyGridMap2DTests, insert2DScanBatchSorted)
+{
+  mrpt::obs::CObservation2DRangeScan scan1;
+  stock_observations::example2DRangeScan(scan1);
+
+  // Insert the same scans via the default and the batched sorted-cell
+  // paths (1 and 4 tracing threads) and compare the resulting grids
+  // cell by cell:
+  COccupancyGridMap2D gridRef(-50.0f, 50.0f, -50.0f, 50.0f, 0.10f);
+  COccupancyGridMap2D gridBatch1(-50.0f, 50.0f, -50.0f, 50.0f, 0.10f);
+  COccupancyGridMap2D gridBatch4(-50.0f, 50.0f, -50.0f, 50.0f, 0.10f);
+
+  gridBatch1.insertionOptions.batchSortedRayUpdates = true;
+  gridBatch1.insertionOptions.insertionNumThreads = 1;
+  gridBatch4.insertionOptions.batchSortedRayUpdates = true;
+  gridBatch4.insertionOptions.insertionNumThreads = 4;
+
+  for (int i = 0; i < 3; i++)
+  {
+    const CPose3D pose(0.05 * i, 0.01 * i, 0, 0.02 * i, 0, 0);
+    gridRef.insertObservation(scan1, pose);
+    gridBatch1.insertObservation(scan1, pose);
+    gridBatch4.insertObservation(scan1, pose);
+  }
+
+  ASSERT_EQ(gridRef.getSizeX(), gridBatch1.getSizeX());
+  ASSERT_EQ(gridRef.getSizeY(), gridBatch1.getSizeY());
+  for (unsigned cy = 0; cy < gridRef.getSizeY(); cy++)
+    for (unsigned cx = 0; cx < gridRef.getSizeX(); cx++)
+    {
+      EXPECT_NEAR(gridRef.getCell(cx, cy), gridBatch1.getCell(cx, cy), 0.02f)
+          << "cell: (" << cx << "," << cy << ")";
+      EXPECT_NEAR(gridRef.getCell(cx, cy), gridBatch4.getCell(cx, cy), 0.02f)
+          << "cell: (" << cx << "," << cy << ")";
+    }
+}
+
+TEST(COccupancyGridMap2DTests, likelihoodFieldVectorizedEval)
+{
+  mrpt::obs::CObservation2DRangeScan scan1;
+  stock_observations::example2DRangeScan(scan1);
+
+  COccupancyGridMap2D gridRef(-20.0f, 20.0f, -20.0f, 20.0f, 0.10f);
+  COccupancyGridMap2D gridVec(-20.0f, 20.0f, -20.0f, 20.0f, 0.10f);
+  gridRef.insertObservation(scan1);
+  gridVec.insertObservation(scan1);
+
+  gridVec.likelihoodOptions.LF_useVectorizedEval = true;
+
+  // The vectorized path uses polynomial exp()/log() approximations, so
+  // allow a small tolerance in the total log-likelihoods:
+  for (int i = 0; i < 5; i++)
+  {
+    const CPose3D pose(0.10 * i, -0.05 * i, 0, 0.05 * i, 0, 0);
+    const double llRef = gridRef.computeObservationLikelihood(scan1, pose);
+    const double llVec = gridVec.computeObservationLikelihood(scan1, pose);
+    EXPECT_NEAR(llRef, llVec, 1e-3 * std::max(1.0, std::abs(llRef))) << "pose: " << pose;
+  }
+}
+
+namespace
+{
+// Brute-force reference for COccupancyGridMap2D::distanceTransform()
+float bruteForceObstacleDist(const COccupancyGridMap2D& g, int cx, int cy, float maxDist)
+{
+  const int K = static_cast<int>(std::ceil(maxDist / g.getResolution())) + 1;
+  // Same obstacle criterion as the implementation (cellType < p2l(0.5)),
+  // mapped through the discretized log-odds LUT:
+  const float thrFree = COccupancyGridMap2D::l2p(COccupancyGridMap2D::p2l(0.5f));
+  float best = maxDist;
+  for (int y = std::max(0, cy - K); y <= std::min<int>(g.getSizeY() - 1, cy + K); y++)
+    for (int x = std::max(0, cx - K); x <= std::min<int>(g.getSizeX() - 1, cx + K); x++)
+    {
+      if (g.getCell(x, y) >= thrFree) continue;  // Not an obstacle
+      const float d = g.getResolution() * std::hypot<float>(x - cx, y - cy);
+      best = std::min(best, d);
+    }
+  return best;
+}
+}  // namespace
+
+TEST(COccupancyGridMap2DTests, distanceTransform)
+{
+  mrpt::obs::CObservation2DRangeScan scan1;
+  stock_observations::example2DRangeScan(scan1);
+
+  COccupancyGridMap2D grid(-20.0f, 20.0f, -20.0f, 20.0f, 0.10f);
+  grid.insertObservation(scan1);
+
+  const float maxDist = 0.6f;
+
+  // Full lazy build:
+  const auto& dt1 = grid.distanceTransform(maxDist);
+  ASSERT_EQ(dt1.size(), size_t(grid.getSizeX()) * grid.getSizeY());
+  for (unsigned cy = 0; cy < grid.getSizeY(); cy += 7)
+    for (unsigned cx = 0; cx < grid.getSizeX(); cx += 7)
+      EXPECT_NEAR(
+          dt1[cx + cy * grid.getSizeX()], bruteForceObstacleDist(grid, cx, cy, maxDist), 1e-4f)
+          << "cell: (" << cx << "," << cy << ")";
+
+  // Incremental refresh after another insertion (dirty-rect path):
+  grid.insertObservation(scan1, CPose3D(0.5, 0.25, 0, 0.3, 0, 0));
+  const auto& dt2 = grid.distanceTransform(maxDist);
+  for (unsigned cy = 0; cy < grid.getSizeY(); cy += 7)
+    for (unsigned cx = 0; cx < grid.getSizeX(); cx += 7)
+      EXPECT_NEAR(
+          dt2[cx + cy * grid.getSizeX()], bruteForceObstacleDist(grid, cx, cy, maxDist), 1e-4f)
+          << "cell: (" << cx << "," << cy << ")";
+}
+
 TEST(COccupancyGridMap2DTests, NearestNeighborsCapable)
 {
   // low freeness=occupied
@@ -16,6 +16,11 @@
 #include <mrpt/obs/CObservationPointCloud.h>
 #include <mrpt/poses/CPose3D.h>
 
+#include <algorithm>
+#include <limits>
+#include <thread>
+#include <vector>
+
 using namespace mrpt::maps;
 
 // bits to left-shift for fixed-point arithmetic simulation in raytracing.
@@ -84,13 +89,149 @@ void COccupancyGridMap3D::insertPointCloud(
   const auto& ys = pts.getPointsBufferRef_y();
   const auto& zs = pts.getPointsBufferRef_z();
 
-  // Process points one by one as rays:
+  // Gather the (decimated) ray end points, in the global frame:
+  std::vector<mrpt::math::TPoint3D> endPts;
+  endPts.reserve(xs.size() / insertionOptions.decimation + 1);
   for (std::size_t idx = 0; idx < xs.size(); idx += insertionOptions.decimation)
   {
     auto pt = mrpt::math::TPoint3D(xs[idx], ys[idx], zs[idx]);
     if (robotPose) pt = robotPose->composePoint(pt);
+    endPts.emplace_back(pt);
+  }
+  if (endPts.empty()) return;
+
+  const size_t nThreads =
+      std::min<size_t>(std::max(1U, std::thread::hardware_concurrency()), endPts.size());
+
+  // Fall back to the plain serial path for tiny workloads, or for (unlikely)
+  // grids too large for the 32-bit deferred-update records used below:
+  if (nThreads <= 1 || endPts.size() < 64 ||
+      m_grid.getVoxelCount() >= std::numeric_limits<uint32_t>::max())
+  {
+    for (const auto& pt : endPts) insertRay(sensorPt, pt);
+    return;
+  }
 
-    insertRay(sensorPt, pt);
+  // The occupied and free probabilities (hoisted out of insertRay()):
+  const float maxCertainty = insertionOptions.maxOccupancyUpdateCertainty;
+  float maxFreeCertainty = insertionOptions.maxFreenessUpdateCertainty;
+  if (maxFreeCertainty == .0f) maxFreeCertainty = maxCertainty;
+
+  const voxelType logodd_observation_free = std::max<voxelType>(1, p2l(maxFreeCertainty));
+  const voxelType logodd_observation_occupied = 3 * std::max<voxelType>(1, p2l(maxCertainty));
+
+  const voxelType logodd_thres_occupied =
+      CLogOddsGridMap3D<voxelType>::CELLTYPE_MIN + logodd_observation_occupied;
+  const voxelType logodd_thres_free =
+      CLogOddsGridMap3D<voxelType>::CELLTYPE_MAX - logodd_observation_free;
+
+  const int sensor_cx = m_grid.x2idx(sensorPt.x);
+  const int sensor_cy = m_grid.y2idx(sensorPt.y);
+  const int sensor_cz = m_grid.z2idx(sensorPt.z);
+  if (m_grid.isOutOfBounds(sensor_cx, sensor_cy, sensor_cz)) return;
+
+  // Sector-parallel ray tracing: each worker traces a contiguous slice of
+  // the scan (an angular sector) and defers its voxel updates into a private
+  // buffer, so no atomics are needed on the int8 cells:
+  struct TDeferredUpdate
+  {
+    uint32_t cellIdx;
+    uint8_t occupied;
+  };
+  std::vector<std::vector<TDeferredUpdate>> buffers(nThreads);
+  const size_t chunk = (endPts.size() + nThreads - 1) / nThreads;
+
+  auto trace_sector = [&](size_t threadIdx)
+  {
+    auto& buf = buffers[threadIdx];
+    const size_t i0 = threadIdx * chunk;
+    const size_t i1 = std::min(endPts.size(), i0 + chunk);
+    buf.reserve(8 * (i1 - i0));
+
+    for (size_t i = i0; i < i1; i++)
+    {
+      const auto& end = endPts[i];
+
+      int cx = sensor_cx, cy = sensor_cy, cz = sensor_cz;
+      const int trg_cx = m_grid.x2idx(end.x);
+      const int trg_cy = m_grid.y2idx(end.y);
+      const int trg_cz = m_grid.z2idx(end.z);
+
+      // The occupied cell at the end:
+      if (!m_grid.isOutOfBounds(trg_cx, trg_cy, trg_cz))
+        buf.push_back(
+            {static_cast<uint32_t>(m_grid.cellAbsIndexFromCXCYCZ(trg_cx, trg_cy, trg_cz)), 1});
+
+      if (!insertionOptions.raytraceEmptyCells) continue;  // done!
+
+      // Use "fractional integers" to approximate float operations
+      //  during the ray tracing (same traversal as insertRay()):
+      const int Acx = trg_cx - cx;
+      const int Acy = trg_cy - cy;
+      const int Acz = trg_cz - cz;
+
+      const int Acx_ = std::abs(Acx);
+      const int Acy_ = std::abs(Acy);
+      const int Acz_ = std::abs(Acz);
+
+      const int nStepsRay = mrpt::max3(Acx_, Acy_, Acz_);
+      if (!nStepsRay) continue;  // May be...
+
+      const float N_1 = 1.0f / nStepsRay;
+
+      // Increments at each raytracing step:
+      const int frAcx = (Acx < 0 ? -1 : +1) * round((Acx_ << FRBITS) * N_1);
+      const int frAcy = (Acy < 0 ? -1 : +1) * round((Acy_ << FRBITS) * N_1);
+      const int frAcz = (Acz < 0 ? -1 : +1) * round((Acz_ << FRBITS) * N_1);
+
+      // fractional integers for the running raytracing point:
+      int frCX = cx << FRBITS;
+      int frCY = cy << FRBITS;
+      int frCZ = cz << FRBITS;
+
+      for (int nStep = 0; nStep < nStepsRay; nStep++)
+      {
+        buf.push_back({static_cast<uint32_t>(m_grid.cellAbsIndexFromCXCYCZ(cx, cy, cz)), 0});
+
+        frCX += frAcx;
+        frCY += frAcy;
+        frCZ += frAcz;
+
+        cx = frCX >> FRBITS;
+        cy = frCY >> FRBITS;
+        cz = frCZ >> FRBITS;
+
+        // Already out of bounds?
+        if (m_grid.isOutOfBounds(cx, cy, cz)) break;
+      }
+    }
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(nThreads);
+  for (size_t t = 0; t < nThreads; t++) workers.emplace_back(trace_sector, t);
+  for (auto& w : workers) w.join();
+
+  // Merge phase: concatenate the buffers in sector order (which preserves the
+  // serial per-cell update order), then stable-sort by cell index so the
+  // int8 voxel array is walked in memory order:
+  size_t nTotal = 0;
+  for (const auto& b : buffers) nTotal += b.size();
+  std::vector<TDeferredUpdate> updates;
+  updates.reserve(nTotal);
+  for (const auto& b : buffers) updates.insert(updates.end(), b.begin(), b.end());
+
+  std::stable_sort(
+      updates.begin(), updates.end(), [](const TDeferredUpdate& a, const TDeferredUpdate& b)
+      { return a.cellIdx < b.cellIdx; });
+
+  for (const auto& u : updates)
+  {
+    voxelType* cell = m_grid.cellByIndex(u.cellIdx);
+    if (u.occupied)
+      updateCell_fast_occupied(cell, logodd_observation_occupied, logodd_thres_occupied);
+    else
+      updateCell_fast_free(cell, logodd_observation_free, logodd_thres_free);
   }
 
   MRPT_END
@@ -10,6 +10,7 @@
 #include <gtest/gtest.h>
 #include <mrpt/io/CFileGZInputStream.h>
 #include <mrpt/maps/COccupancyGridMap3D.h>
+#include <mrpt/maps/CSimplePointsMap.h>
 #include <mrpt/obs/CObservation2DRangeScan.h>
 #include <mrpt/obs/CObservation3DRangeScan.h>
 #include <mrpt/obs/CSensoryFrame.h>
@@ -157,3 +158,33 @@ TEST(COccupancyGridMap3DTests, insertScan3D)
 }
 
 #endif
+
+TEST(COccupancyGridMap3DTests, parallelInsertPointCloudMatchesSerial)
+{
+  // Build a synthetic cloud large enough to trigger the parallel,
+  // deferred-update insertion path (>=64 rays):
+  mrpt::maps::CSimplePointsMap pts;
+  for (int i = 0; i < 200; i++)
+  {
+    const double ang = 2.0 * M_PI * i / 200.0;
+    pts.insertPoint(3.0 * cos(ang), 3.0 * sin(ang), 0.5 * sin(3 * ang));
+  }
+
+  const auto sensorPt = mrpt::math::TPoint3D(0, 0, 0);
+
+  mrpt::maps::COccupancyGridMap3D gridPar({-5.0f, -5.0f, -2.0f}, {5.0f, 5.0f, 2.0f}, 0.1f);
+  gridPar.insertPointCloud(sensorPt, pts);
+
+  // Reference: one ray at a time:
+  mrpt::maps::COccupancyGridMap3D gridRef({-5.0f, -5.0f, -2.0f}, {5.0f, 5.0f, 2.0f}, 0.1f);
+  const auto& xs = pts.getPointsBufferRef_x();
+  const auto& ys = pts.getPointsBufferRef_y();
+  const auto& zs = pts.getPointsBufferRef_z();
+  for (size_t i = 0; i < xs.size(); i++)
+    gridRef.insertRay(sensorPt, mrpt::math::TPoint3D(xs[i], ys[i], zs[i]));
+
+  // Both maps must be identical, voxel by voxel:
+  for (double x = -4.9; x < 4.9; x += 0.1)
+    for (double y = -4.9; y < 4.9; y += 0.1)
+      ASSERT_NEAR(gridPar.getFreenessByPos(x, y, 0.0), gridRef.getFreenessByPos(x, y, 0.0), 1e-6);
+}
@@ -18,6 +18,11 @@
 #include <octomap/OcTree.h>
 #include <octomap/octomap.h>
 
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
 #include "COctoMapBase_impl.h"
 
 // Explicit instantiation:
@@ -128,6 +133,94 @@ void COctoMap::serializeFrom(mrpt::serialization::CArchive& in, uint8_t version)
   };
 }
 
+namespace
+{
+/** 48-bit Morton (z-order) code from an octree key: keys with consecutive
+ * codes share most of their root-to-leaf path, so applying updates in this
+ * order keeps the upper levels of the tree hot in cache. */
+uint64_t mortonFromKey(const octomap::OcTreeKey& k)
+{
+  const auto splitBy3 = [](uint64_t v)
+  {
+    v &= 0xffffULL;
+    v = (v | (v << 32)) & 0x001f00000000ffffULL;
+    v = (v | (v << 16)) & 0x001f0000ff0000ffULL;
+    v = (v | (v << 8)) & 0x100f00f00f00f00fULL;
+    v = (v | (v << 4)) & 0x10c30c30c30c30c3ULL;
+    v = (v | (v << 2)) & 0x1249249249249249ULL;
+    return v;
+  };
+  return splitBy3(k[0]) | (splitBy3(k[1]) << 1) | (splitBy3(k[2]) << 2);
+}
+
+/** Batched scan insertion: aggregates per-voxel hit/miss counts for the
+ * whole scan, then applies one log-odds update per touched voxel, sorted by
+ * Morton code, with lazy inner-node evaluation and a single bottom-up
+ * refresh at the end. \sa TInsertionOptions::batchedUpdate */
+void insertPointCloudBatched(
+    octomap::OcTree& tree,
+    const octomap::Pointcloud& scan,
+    const octomap::point3d& sensorPt,
+    const double maxrange,
+    const bool pruning)
+{
+  struct KeyUpdate
+  {
+    uint64_t morton;
+    octomap::OcTreeKey key;
+    uint32_t hits{0}, misses{0};
+  };
+
+  std::vector<KeyUpdate> updates;
+  updates.reserve(scan.size() * 8);  // heuristic: ~8 crossed voxels per ray
+  std::unordered_map<octomap::OcTreeKey, size_t, octomap::OcTreeKey::KeyHash> keyToIdx;
+  keyToIdx.reserve(updates.capacity());
+
+  const auto updateFor = [&](const octomap::OcTreeKey& k) -> KeyUpdate&
+  {
+    const auto [it, isNew] = keyToIdx.try_emplace(k, updates.size());
+    if (isNew) updates.push_back({mortonFromKey(k), k, 0, 0});
+    return updates[it->second];
+  };
+
+  octomap::KeyRay ray;  // reused across rays
+  for (size_t i = 0; i < scan.size(); i++)
+  {
+    const octomap::point3d& p = scan[i];
+
+    // Same max-range policy than octomap::insertPointCloud():
+    const bool truncated = maxrange > 0 && (p - sensorPt).norm() > maxrange;
+    const octomap::point3d end =
+        truncated ? sensorPt + (p - sensorPt).normalized() * static_cast<float>(maxrange) : p;
+
+    if (tree.computeRayKeys(sensorPt, end, ray))
+      for (const auto& k : ray) updateFor(k).misses++;
+
+    if (!truncated)
+    {
+      octomap::OcTreeKey endKey;
+      if (tree.coordToKeyChecked(p, endKey)) updateFor(endKey).hits++;
+    }
+  }
+
+  std::sort(
+      updates.begin(), updates.end(),
+      [](const KeyUpdate& a, const KeyUpdate& b) { return a.morton < b.morton; });
+
+  const float lHit = tree.getProbHitLog(), lMiss = tree.getProbMissLog();
+  for (const auto& u : updates)
+  {
+    // Occupied-over-free priority within one scan, as in
+    // octomap::insertPointCloud(), but keeping the per-ray counts:
+    const float delta = u.hits ? u.hits * lHit : u.misses * lMiss;
+    tree.updateNode(u.key, delta, true /*lazy_eval*/);
+  }
+
+  tree.updateInnerOccupancy();  // one bottom-up pass
+  if (pruning) tree.prune();
+}
+}  // namespace
+
 bool COctoMap::internal_insertObservation(
     const mrpt::obs::CObservation& obs, const std::optional<const mrpt::poses::CPose3D>& robotPose)
 {
@@ -136,24 +229,216 @@ bool COctoMap::internal_insertObservation(
   if (!internal_build_PointCloud_for_observation(obs, robotPose, sensorPt, scan))
     return false;  // Nothing to do.
   // Insert rays:
-  m_impl->m_octomap.insertPointCloud(
-      scan, sensorPt, insertionOptions.maxrange, insertionOptions.pruning);
+  if (insertionOptions.batchedUpdate)
+  {
+    insertPointCloudBatched(
+        m_impl->m_octomap, scan, sensorPt, insertionOptions.maxrange, insertionOptions.pruning);
+  }
+  else
+  {
+    m_impl->m_octomap.insertPointCloud(
+        scan, sensorPt, insertionOptions.maxrange, insertionOptions.pruning);
+  }
   return true;
 }
 
+struct COctoMap::TVoxelExportCache
+{
+  /** The COctoMapVoxels instance the slots below refer to */
+  const void* targetObj = nullptr;
+  /** Snapshot of the render settings used at the last full rebuild */
+  uint64_t renderSignature = 0;
+  /** true if any leaf was exported at a coarser depth than the finest one
+   * (pruned subtrees): changed keys can then not be matched to slots. */
+  bool hasShallowLeaves = false;
+  /** morton(octree key) -> (voxel set, index into its buffer) */
+  std::unordered_map<uint64_t, std::pair<uint8_t, uint32_t>> keyToSlot;
+  /** Mirror of each voxel-set buffer, with the morton code of each slot */
+  std::vector<uint64_t> slotKeys[2];
+};
+
 /** Builds a renderizable representation of the octomap as a
  * mrpt::opengl::COctoMapVoxels object. */
 void COctoMap::getAsOctoMapVoxels(mrpt::opengl::COctoMapVoxels& gl_obj) const
 {
-  // Go thru all voxels:
-  // OcTreeVolume voxel; // current voxel, possibly transformed
-  octomap::OcTree::tree_iterator it_end = m_impl->m_octomap.end_tree();
+  auto& tree = m_impl->m_octomap;
 
   const unsigned char max_depth = 0;  // all
   const TColorf general_color = gl_obj.getColor();
   const TColor general_color_u(
       general_color.R * 255, general_color.G * 255, general_color.B * 255, general_color.A * 255);
 
+  double xmin, xmax, ymin, ymax, zmin, zmax, inv_dz;
+  this->getMetricMin(xmin, ymin, zmin);
+  this->getMetricMax(xmax, ymax, zmax);
+  inv_dz = 1 / (zmax - zmin + 0.01);
+
+  // Per-voxel color, shared by the full and the incremental export paths:
+  const auto voxelColor = [&](const double occ, const double z) -> mrpt::img::TColor
+  {
+    mrpt::img::TColor vx_color;
+    double coefc, coeft;
+    switch (gl_obj.getVisualizationMode())
+    {
+      case COctoMapVoxels::FIXED:
+        vx_color = general_color_u;
+        break;
+      case COctoMapVoxels::COLOR_FROM_HEIGHT:
+        coefc = 255 * inv_dz * (z - zmin);
+        vx_color = TColor(
+            coefc * general_color.R, coefc * general_color.G, coefc * general_color.B,
+            255.0 * general_color.A);
+        break;
+
+      case COctoMapVoxels::COLOR_FROM_OCCUPANCY:
+        coefc = 240 * (1 - occ) + 15;
+        vx_color = TColor(
+            coefc * general_color.R, coefc * general_color.G, coefc * general_color.B,
+            255.0 * general_color.A);
+        break;
+
+      case COctoMapVoxels::TRANSPARENCY_FROM_OCCUPANCY:
+        coeft = 255 - 510 * (1 - occ);
+        if (coeft < 0)
+        {
+          coeft = 0;
+        }
+        vx_color =
+            TColor(255 * general_color.R, 255 * general_color.G, 255 * general_color.B, coeft);
+        break;
+
+      case COctoMapVoxels::TRANS_AND_COLOR_FROM_OCCUPANCY:
+        coefc = 240 * (1 - occ) + 15;
+        vx_color =
+            TColor(coefc * general_color.R, coefc * general_color.G, coefc * general_color.B, 50);
+        break;
+
+      case COctoMapVoxels::MIXED:
+        coefc = 255 * inv_dz * (z - zmin);
+        coeft = 255 - 510 * (1 - occ);
+        if (coeft < 0)
+        {
+          coeft = 0;
+        }
+        vx_color = TColor(
+            coefc * general_color.R, coefc * general_color.G, coefc * general_color.B, coeft);
+        break;
+
+      default:
+        THROW_EXCEPTION("Unknown coloring scheme!");
+    }
+    return vx_color;
+  };
+
+  // Snapshot of every render setting the generated voxels depend on; any
+  // change invalidates the incremental bookkeeping below:
+  uint64_t sig = static_cast<uint64_t>(gl_obj.getVisualizationMode());
+  const auto mix = [&sig](uint64_t v)
+  { sig ^= v + 0x9e3779b97f4a7c15ULL + (sig << 6) + (sig >> 2); };
+  mix(general_color_u.R);
+  mix(general_color_u.G);
+  mix(general_color_u.B);
+  mix(general_color_u.A);
+  mix(renderingOptions.generateOccupiedVoxels ? 1 : 0);
+  mix(renderingOptions.generateFreeVoxels ? 1 : 0);
+  mix(renderingOptions.visibleOccupiedVoxels ? 1 : 0);
+  mix(renderingOptions.visibleFreeVoxels ? 1 : 0);
+  mix(renderingOptions.generateGridLines ? 1 : 0);
+  {
+    // COLOR_FROM_HEIGHT & MIXED depend on the current z span:
+    const float z0 = static_cast<float>(zmin), z1 = static_cast<float>(zmax);
+    uint32_t b0, b1;
+    std::memcpy(&b0, &z0, sizeof(b0));
+    std::memcpy(&b1, &z1, sizeof(b1));
+    mix(b0);
+    mix(b1);
+  }
+
+  auto& cache = m_voxelExportCache;
+
+  // Incremental path: patch only the voxels whose octree key changed since
+  // the last export of this same gl_obj. Not applicable with pruning (leafs
+  // merge/split), grid lines (inner nodes), or transparency (z-sorted
+  // buffers):
+  const bool deltaApplicable = cache && cache->targetObj == &gl_obj &&
+      cache->renderSignature == sig && !cache->hasShallowLeaves && !insertionOptions.pruning &&
+      !renderingOptions.generateGridLines && !gl_obj.isCubeTransparencyEnabled() &&
+      tree.isChangeDetectionEnabled() && gl_obj.getVoxelSetCount() == 2 &&
+      gl_obj.getVoxelCount(VOXEL_SET_OCCUPIED) == cache->slotKeys[VOXEL_SET_OCCUPIED].size() &&
+      gl_obj.getVoxelCount(VOXEL_SET_FREESPACE) == cache->slotKeys[VOXEL_SET_FREESPACE].size() &&
+      tree.numChangesDetected() < (1 + this->getNumLeafNodes() / 4);
+
+  if (deltaApplicable)
+  {
+    // Swap-removes one voxel slot, keeping the bookkeeping consistent:
+    const auto removeSlot = [&](const uint64_t morton, const uint8_t set, const uint32_t idx)
+    {
+      auto& keys = cache->slotKeys[set];
+      const auto last = static_cast<uint32_t>(keys.size() - 1);
+      if (idx != last)
+      {
+        gl_obj.getVoxelRef(set, idx) = gl_obj.getVoxel(set, last);
+        keys[idx] = keys[last];
+        cache->keyToSlot[keys[idx]] = {set, idx};
+      }
+      keys.pop_back();
+      gl_obj.resizeVoxels(set, keys.size());
+      cache->keyToSlot.erase(morton);
+    };
+
+    for (auto it = tree.changedKeysBegin(); it != tree.changedKeysEnd(); ++it)
+    {
+      const octomap::OcTreeKey& k = it->first;
+      const uint64_t morton = mortonFromKey(k);
+
+      const octomap::OcTreeNode* node = tree.search(k);
+      const double occ = node ? node->getOccupancy() : .0;
+      const bool generate = node &&
+          ((occ >= 0.5 && renderingOptions.generateOccupiedVoxels) ||
+           (occ < 0.5 && renderingOptions.generateFreeVoxels));
+      const auto newSet = static_cast<uint8_t>(
+          (node && tree.isNodeOccupied(*node)) ? VOXEL_SET_OCCUPIED : VOXEL_SET_FREESPACE);
+
+      auto slotIt = cache->keyToSlot.find(morton);
+      if (slotIt != cache->keyToSlot.end() && (!generate || slotIt->second.first != newSet))
+      {
+        removeSlot(morton, slotIt->second.first, slotIt->second.second);
+        slotIt = cache->keyToSlot.end();
+      }
+      if (!generate) continue;
+
+      const octomap::point3d c = tree.keyToCoord(k);
+      const COctoMapVoxels::TVoxel vx(
+          TPoint3D(c.x(), c.y(), c.z()), tree.getResolution(), voxelColor(occ, c.z()));
+
+      if (slotIt != cache->keyToSlot.end())
+      {
+        gl_obj.getVoxelRef(slotIt->second.first, slotIt->second.second) = vx;
+      }
+      else
+      {
+        cache->keyToSlot[morton] = {newSet, static_cast<uint32_t>(cache->slotKeys[newSet].size())};
+        cache->slotKeys[newSet].push_back(morton);
+        gl_obj.push_back_Voxel(newSet, vx);
+      }
+    }
+
+    const_cast<octomap::OcTree&>(tree).resetChangeDetection();
+
+    // Keep the bounding box up to date:
+    gl_obj.setBoundingBox({xmin, ymin, zmin}, {xmax, ymax, zmax});
+    return;
+  }
+
+  // ---- Full rebuild (also (re)creates the incremental bookkeeping): ----
+  if (!cache) cache = std::make_unique<TVoxelExportCache>();
+  cache->targetObj = &gl_obj;
+  cache->renderSignature = sig;
+  cache->hasShallowLeaves = false;
+  cache->keyToSlot.clear();
+  cache->slotKeys[VOXEL_SET_OCCUPIED].clear();
+  cache->slotKeys[VOXEL_SET_FREESPACE].clear();
+
   gl_obj.clear();
   gl_obj.reserveGridCubes(this->calcNumNodes());
 
@@ -166,13 +451,8 @@ void COctoMap::getAsOctoMapVoxels(mrpt::opengl::COctoMapVoxels& gl_obj) const
   gl_obj.reserveVoxels(VOXEL_SET_OCCUPIED, nLeafs);
   gl_obj.reserveVoxels(VOXEL_SET_FREESPACE, nLeafs);
 
-  double xmin, xmax, ymin, ymax, zmin, zmax, inv_dz;
-  this->getMetricMin(xmin, ymin, zmin);
-  this->getMetricMax(xmax, ymax, zmax);
-  inv_dz = 1 / (zmax - zmin + 0.01);
-
-  for (octomap::OcTree::tree_iterator it = m_impl->m_octomap.begin_tree(max_depth); it != it_end;
-       ++it)
+  octomap::OcTree::tree_iterator it_end = tree.end_tree();
+  for (octomap::OcTree::tree_iterator it = tree.begin_tree(max_depth); it != it_end; ++it)
   {
     const octomap::point3d vx_center = it.getCoordinate();
     const double vx_length = it.getSize();
@@ -185,60 +465,16 @@ void COctoMap::getAsOctoMapVoxels(mrpt::opengl::COctoMapVoxels& gl_obj) const
       if ((occ >= 0.5 && renderingOptions.generateOccupiedVoxels) ||
           (occ < 0.5 && renderingOptions.generateFreeVoxels))
       {
-        mrpt::img::TColor vx_color;
-        double coefc, coeft;
-        switch (gl_obj.getVisualizationMode())
-        {
-          case COctoMapVoxels::FIXED:
-            vx_color = general_color_u;
-            break;
-          case COctoMapVoxels::COLOR_FROM_HEIGHT:
-            coefc = 255 * inv_dz * (vx_center.z() - zmin);
-            vx_color = TColor(
-                coefc * general_color.R, coefc * general_color.G, coefc * general_color.B,
-                255.0 * general_color.A);
-            break;
-
-          case COctoMapVoxels::COLOR_FROM_OCCUPANCY:
-            coefc = 240 * (1 - occ) + 15;
-            vx_color = TColor(
-                coefc * general_color.R, coefc * general_color.G, coefc * general_color.B,
-                255.0 * general_color.A);
-            break;
-
-          case COctoMapVoxels::TRANSPARENCY_FROM_OCCUPANCY:
-            coeft = 255 - 510 * (1 - occ);
-            if (coeft < 0)
-            {
-              coeft = 0;
-            }
-            vx_color =
-                TColor(255 * general_color.R, 255 * general_color.G, 255 * general_color.B, coeft);
-            break;
-
-          case COctoMapVoxels::TRANS_AND_COLOR_FROM_OCCUPANCY:
-            coefc = 240 * (1 - occ) + 15;
-            vx_color = TColor(
-                coefc * general_color.R, coefc * general_color.G, coefc * general_color.B, 50);
-            break;
-
-          case COctoMapVoxels::MIXED:
-            coefc = 255 * inv_dz * (vx_center.z() - zmin);
-            coeft = 255 - 510 * (1 - occ);
-            if (coeft < 0)
-            {
-              coeft = 0;
-            }
-            vx_color = TColor(
-                coefc * general_color.R, coefc * general_color.G, coefc * general_color.B, coeft);
-            break;
-
-          default:
-            THROW_EXCEPTION("Unknown coloring scheme!");
-        }
+        const mrpt::img::TColor vx_color = voxelColor(occ, vx_center.z());
 
         const size_t vx_set =
-            (m_impl->m_octomap.isNodeOccupied(*it)) ? VOXEL_SET_OCCUPIED : VOXEL_SET_FREESPACE;
+            (tree.isNodeOccupied(*it)) ? VOXEL_SET_OCCUPIED : VOXEL_SET_FREESPACE;
+
+        if (it.getDepth() != tree.getTreeDepth()) cache->hasShallowLeaves = true;
+        const uint64_t morton = mortonFromKey(it.getKey());
+        cache->keyToSlot[morton] = {
+            static_cast<uint8_t>(vx_set), static_cast<uint32_t>(cache->slotKeys[vx_set].size())};
+        cache->slotKeys[vx_set].push_back(morton);
 
         gl_obj.push_back_Voxel(
             vx_set,
@@ -257,7 +493,20 @@ void COctoMap::getAsOctoMapVoxels(mrpt::opengl::COctoMapVoxels& gl_obj) const
 
   // if we use transparency, sort cubes by "Z" as an approximation to
   // far-to-near render ordering:
-  if (gl_obj.isCubeTransparencyEnabled()) gl_obj.sort_voxels_by_z();
+  if (gl_obj.isCubeTransparencyEnabled())
+  {
+    gl_obj.sort_voxels_by_z();
+    // Sorting reorders the buffers, so incremental refreshes are out:
+    cache.reset();
+    const_cast<octomap::OcTree&>(tree).enableChangeDetection(false);
+  }
+  else
+  {
+    // Track changed keys so the next export of this object can be a patch:
+    auto& rwTree = const_cast<octomap::OcTree&>(tree);
+    rwTree.enableChangeDetection(true);
+    rwTree.resetChangeDetection();
+  }
 
   // Set bounding box:
   {
@@ -350,4 +599,8 @@ float COctoMap::getClampingThresMaxLog() const
 {
   return m_impl->m_octomap.getClampingThresMaxLog();
 }
-void COctoMap::internal_clear() { m_impl->m_octomap.clear(); }
+void COctoMap::internal_clear()
+{
+  m_impl->m_octomap.clear();
+  m_voxelExportCache.reset();
+}
@@ -288,6 +288,7 @@ COctoMapBase<OCTREE, OCTREE_NODE>::TInsertionOptions::TInsertionOptions(
     COctoMapBase<OCTREE, OCTREE_NODE>& parent) :
     maxrange(-1.),
     pruning(true),
+    batchedUpdate(false),
     m_parent(&parent),
     // Default values from octomap:
     occupancyThres(0.5),
@@ -344,6 +345,7 @@ void COctoMapBase<OCTREE, OCTREE_NODE>::TInsertionOptions::dumpToTextStream(std:
 
   LOADABLEOPTS_DUMP_VAR(maxrange, double);
   LOADABLEOPTS_DUMP_VAR(pruning, bool);
+  LOADABLEOPTS_DUMP_VAR(batchedUpdate, bool);
 
   LOADABLEOPTS_DUMP_VAR(getOccupancyThres(), double);
   LOADABLEOPTS_DUMP_VAR(getProbHit(), double);
@@ -373,6 +375,7 @@ void COctoMapBase<OCTREE, OCTREE_NODE>::TInsertionOptions::loadFromConfigFile(
 {
   MRPT_LOAD_CONFIG_VAR(maxrange, double, iniFile, section);
   MRPT_LOAD_CONFIG_VAR(pruning, bool, iniFile, section);
+  MRPT_LOAD_CONFIG_VAR(batchedUpdate, bool, iniFile, section);
 
   MRPT_LOAD_CONFIG_VAR(occupancyThres, double, iniFile, section);
   MRPT_LOAD_CONFIG_VAR(probHit, double, iniFile, section);
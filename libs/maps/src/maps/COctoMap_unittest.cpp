@@ -60,3 +60,35 @@ TEST(COctoMapTests, insert2DScan)
     map.insertObservation(scan1);
   }
 }
+
+TEST(COctoMapTests, insert2DScanBatched)
+{
+  mrpt::obs::CObservation2DRangeScan scan1;
+  stock_observations::example2DRangeScan(scan1);
+
+  COctoMap mapRef(0.1), mapBatched(0.1);
+  mapBatched.insertionOptions.batchedUpdate = true;
+
+  mapRef.insertObservation(scan1);
+  mapBatched.insertObservation(scan1);
+
+  // Exact log-odds differ (the batched mode is count-weighted), but both
+  // insertions must agree on the free/occupied classification of the cells:
+  size_t nChecked = 0;
+  for (double x = -4.0; x < 4.0; x += 0.2)
+  {
+    for (double y = -4.0; y < 4.0; y += 0.2)
+    {
+      double occRef, occBatched;
+      const bool mappedRef = mapRef.getPointOccupancy(x, y, 0, occRef);
+      const bool mappedBatched = mapBatched.getPointOccupancy(x, y, 0, occBatched);
+      EXPECT_EQ(mappedRef, mappedBatched) << "x=" << x << " y=" << y;
+      if (!mappedRef || !mappedBatched) continue;
+      if (std::abs(occRef - 0.5) < 0.01) continue;  // borderline cell
+      EXPECT_EQ(occRef > 0.5, occBatched > 0.5) << "x=" << x << " y=" << y << " occRef=" << occRef
+                                                << " occBatched=" << occBatched;
+      nChecked++;
+    }
+  }
+  EXPECT_GT(nChecked, 10U);
+}
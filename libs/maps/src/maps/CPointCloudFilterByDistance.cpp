@@ -12,10 +12,21 @@
 #include <mrpt/config/CConfigFileBase.h>
 #include <mrpt/maps/CPointCloudFilterByDistance.h>
 
+#include <cmath>
+#include <thread>
 #include <vector>
 
 using namespace mrpt::maps;
 
+// Packs the voxel indices of a point into one hash key (21 bits per axis):
+static uint64_t voxel_key_of(double x, double y, double z, double voxel_inv)
+{
+  const auto qx = static_cast<uint64_t>(static_cast<int64_t>(std::floor(x * voxel_inv)) & 0x1fffff);
+  const auto qy = static_cast<uint64_t>(static_cast<int64_t>(std::floor(y * voxel_inv)) & 0x1fffff);
+  const auto qz = static_cast<uint64_t>(static_cast<int64_t>(std::floor(z * voxel_inv)) & 0x1fffff);
+  return qx | (qy << 21) | (qz << 42);
+}
+
 void CPointCloudFilterByDistance::filter(
     /** [in,out] The input pointcloud, which will be modified upon return after
        filtering. */
@@ -92,62 +103,121 @@ void CPointCloudFilterByDistance::filter(
     // composed with rel_pose
     // with the local points in time_{k-1}.
 
-    std::vector<TPoint3D> pt_km1(options.previous_keyframes);
+    // Coarse voxel-occupancy prefilter: a query point sharing a voxel with
+    // any previous-frame point has a neighbor within the voxel diagonal,
+    // which we make equal to options.min_dist, i.e. a guaranteed lower
+    // bound of the per-point distance threshold below. Such points pass
+    // that frame's check without touching its KD-tree. The voxel sets are
+    // cached in each FrameInfo across calls.
+    const double voxel = options.min_dist / std::sqrt(3.0);
+    const double voxel_inv = 1.0 / voxel;
+    for (auto* fr : prev_pc)
+    {
+      if (fr->coarseVoxelSize == voxel) continue;  // cache is up to date
+      fr->coarseVoxels.clear();
+      const size_t M = fr->pc->size();
+      fr->coarseVoxels.reserve(M);
+      for (size_t j = 0; j < M; j++)
+      {
+        float x, y, z;
+        fr->pc->getPointFast(j, x, y, z);
+        fr->coarseVoxels.insert(voxel_key_of(x, y, z, voxel_inv));
+      }
+      fr->coarseVoxelSize = voxel;
+    }
+
+    // Build all KD-trees up-front: the lazy build is not reentrant, but
+    // queries against an already-built index are const and thread-safe.
+    pc->kdTreeEnsureIndexBuilt3D();
+    for (auto* fr : prev_pc)
+      if (fr->pc->size() > 0) fr->pc->kdTreeEnsureIndexBuilt3D();
+
+    // Per-point checks, in parallel chunks (vector<bool> cannot take
+    // concurrent writes, hence the byte mask):
+    std::vector<uint8_t> deletion_mask8(N, 0);
 
-    for (size_t i = 0; i < N; i++)
+    const size_t nThreads = std::min<size_t>(
+        std::max(1u, std::thread::hardware_concurrency()), std::max<size_t>(1, N / 2000));
+    std::vector<size_t> perThreadDelCount(nThreads, 0);
+    std::vector<std::exception_ptr> excepts(nThreads);
+
+    const auto worker = [&](size_t threadIdx, size_t i0, size_t i1)
     {
-      // get i-th point in time=k:
-      TPoint3Df ptf_k;
-      pc->getPointFast(i, ptf_k.x, ptf_k.y, ptf_k.z);
-      const TPoint3D pt_k = TPoint3D(ptf_k);
-
-      // Point, referred to time=k-1 frame of reference
-      for (int k = 0; k < options.previous_keyframes; ++k)
-        rel_poses[k].composePoint(pt_k, pt_km1[k]);
-
-      // Look for neighbors in "time=k"
-      std::vector<TPoint3D> neig_k;
-      std::vector<float> neig_sq_dist_k;
-      pc->kdTreeNClosestPoint3D(pt_k, 2 /*num queries*/, neig_k, neig_sq_dist_k);
-
-      // Look for neighbors in "time=k-i"
-      std::vector<TPoint3D> neig_kmi(options.previous_keyframes);
-      std::vector<float> neig_sq_dist_kmi(
-          options.previous_keyframes, std::numeric_limits<float>::max());
-
-      for (int k = 0; k < options.previous_keyframes; ++k)
+      try
       {
-        for (int prev_tim_idx = 0; prev_tim_idx < options.previous_keyframes; prev_tim_idx++)
+        std::vector<TPoint3D> pt_km1(options.previous_keyframes);
+        std::vector<TPoint3D> neig_k;
+        std::vector<float> neig_sq_dist_k;
+
+        for (size_t i = i0; i < i1; i++)
         {
-          if (prev_pc[prev_tim_idx]->pc->size() > 0)
+          // get i-th point in time=k:
+          TPoint3Df ptf_k;
+          pc->getPointFast(i, ptf_k.x, ptf_k.y, ptf_k.z);
+          const TPoint3D pt_k = TPoint3D(ptf_k);
+
+          // Point, referred to time=k-1 frame of reference
+          for (int k = 0; k < options.previous_keyframes; ++k)
+            rel_poses[k].composePoint(pt_k, pt_km1[k]);
+
+          // Rule:
+          // we must have at least 1 neighbor in t=k, and 1 neighbor in t=k-i
+          const double max_allowed_dist_sq =
+              square(options.min_dist + options.angle_tolerance * pt_k.norm());
+
+          // Look for neighbors in "time=k"
+          pc->kdTreeNClosestPoint3D(pt_k, 2 /*num queries*/, neig_k, neig_sq_dist_k);
+
+          bool ok_total = neig_sq_dist_k.size() > 1 && neig_sq_dist_k[1] < max_allowed_dist_sq;
+
+          // Look for neighbors in "time=k-i"
+          for (int k = 0; ok_total && k < options.previous_keyframes; ++k)
           {
-            prev_pc[prev_tim_idx]->pc->kdTreeClosestPoint3D(
-                pt_km1[prev_tim_idx], neig_kmi[prev_tim_idx], neig_sq_dist_kmi[prev_tim_idx]);
+            const auto& p = pt_km1[k];
+            // coarse early-out: same voxel => neighbor within min_dist
+            if (prev_pc[k]->coarseVoxels.count(voxel_key_of(p.x, p.y, p.z, voxel_inv)))
+              continue;
+
+            float neig_sq_dist_kmi = std::numeric_limits<float>::max();
+            if (prev_pc[k]->pc->size() > 0)
+            {
+              TPoint3D neig_kmi;
+              prev_pc[k]->pc->kdTreeClosestPoint3D(p, neig_kmi, neig_sq_dist_kmi);
+            }
+            ok_total = ok_total && neig_sq_dist_kmi < max_allowed_dist_sq;
+          }
+
+          // Delete?
+          if (!ok_total)
+          {
+            deletion_mask8[i] = 1;
+            perThreadDelCount[threadIdx]++;
           }
         }
       }
-
-      // Rule:
-      // we must have at least 1 neighbor in t=k, and 1 neighbor in t=k-i
-      const double max_allowed_dist_sq =
-          square(options.min_dist + options.angle_tolerance * pt_k.norm());
-
-      bool ok_total = true;
-      const bool ok_t = neig_k.size() > 1 && neig_sq_dist_k[1] < max_allowed_dist_sq;
-      ok_total = ok_total && ok_t;
-
-      for (int k = 0; k < options.previous_keyframes; ++k)
+      catch (...)
       {
-        const bool ok_tm1 = neig_sq_dist_kmi[k] < max_allowed_dist_sq;
-        ok_total = ok_total && ok_tm1;
+        excepts[threadIdx] = std::current_exception();
       }
+    };
 
-      // Delete?
-      const bool do_delete = !(ok_total);
-      deletion_mask[i] = do_delete;
-
-      if (do_delete) del_count++;
+    if (nThreads == 1)
+    {
+      worker(0, 0, N);
     }
+    else
+    {
+      const size_t chunk = (N + nThreads - 1) / nThreads;
+      std::vector<std::thread> threads;
+      for (size_t t = 0; t < nThreads; t++)
+        threads.emplace_back(worker, t, t * chunk, std::min(N, (t + 1) * chunk));
+      for (auto& t : threads) t.join();
+    }
+    for (auto& e : excepts)
+      if (e) std::rethrow_exception(e);
+
+    for (size_t t = 0; t < nThreads; t++) del_count += perThreadDelCount[t];
+    for (size_t i = 0; i < N; i++) deletion_mask[i] = deletion_mask8[i] != 0;
 
     // Remove points:
     if ((params == nullptr || params->do_not_delete == false) && N > 0 &&
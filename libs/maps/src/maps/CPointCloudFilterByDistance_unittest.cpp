@@ -72,3 +72,28 @@ TEST(CPointCloudFilterByDistance, tooOldMap)
   run_pc_filter_test(
       .35 /*map2_x_off*/, 2.0 /*map2_tim_off*/, 8 /*expected_m1_count*/, 8 /*expected_m2_count*/);
 }
+
+// Large static cloud: exercises the multi-threaded per-point checks and the
+// coarse voxel early-out (every point re-observed at its previous position).
+TEST(CPointCloudFilterByDistance, largeStaticCloud)
+{
+  const size_t N = 10000;
+  const mrpt::poses::CPose3D pose(0, 0, 0, 0, 0, 0);
+  const auto tim1 = mrpt::Clock::now();
+  const auto tim2 = mrpt::system::timestampAdd(tim1, 0.2);
+
+  mrpt::maps::CSimplePointsMap map1, map2;
+  for (size_t i = 0; i < N; i++)
+  {
+    const double x = 1.0 + 0.02 * (i % 100), y = 0.02 * (i / 100), z = 0;
+    map1.insertPoint(x, y, z);
+    map2.insertPoint(x, y, z);
+  }
+
+  mrpt::maps::CPointCloudFilterByDistance pc_filter;
+  pc_filter.filter(&map1, tim1, pose, nullptr);
+  EXPECT_EQ(map1.size(), N);
+
+  pc_filter.filter(&map2, tim2, pose, nullptr);
+  EXPECT_EQ(map2.size(), N);
+}
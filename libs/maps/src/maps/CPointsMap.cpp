@@ -12,6 +12,7 @@
 #include <mrpt/config/CConfigFile.h>
 #include <mrpt/core/SSE_macros.h>
 #include <mrpt/core/SSE_types.h>
+#include <mrpt/core/WorkerThreadsPool.h>
 #include <mrpt/maps/CPointsMap.h>
 #include <mrpt/maps/CSimplePointsMap.h>
 #include <mrpt/math/TPose2D.h>
@@ -24,13 +25,16 @@
 #include <mrpt/obs/CObservationVelodyneScan.h>
 #include <mrpt/opengl/CPointCloud.h>
 #include <mrpt/opengl/CPointCloudColoured.h>
+#include <mrpt/poses/Lie/SE.h>
 #include <mrpt/serialization/CArchive.h>
 #include <mrpt/system/CTicTac.h>
 #include <mrpt/system/CTimeLogger.h>
 #include <mrpt/system/os.h>
 
 #include <fstream>
+#include <future>
 #include <sstream>
+#include <thread>
 
 #if MRPT_HAS_MATLAB
 #include <mexplus.h>
@@ -270,6 +274,19 @@ void CPointsMap::clipOutOfRange(const TPoint2D& p, float maxRange)
   mark_as_modified();
 }
 
+namespace
+{
+/** Per-thread accumulator for the sharded correspondence search of
+ * determineMatching2D/3D (see TMatchingParams::numThreads) */
+struct TMatchShard
+{
+  mrpt::tfest::TMatchingPairList corrs;
+  float sumSqrDist = 0;
+  size_t sumSqrCount = 0;
+  size_t nWithCorrespondence = 0;
+};
+}  // namespace
+
 void CPointsMap::determineMatching2D(
     const mrpt::maps::CMetricMap* otherMap2,
     const CPose2D& otherMapPose_,
@@ -296,12 +313,6 @@ void CPointsMap::determineMatching2D(
 
   auto bbLocal = mrpt::math::TBoundingBoxf::PlusMinusInfinity();
 
-  double maxDistForCorrespondenceSquared;
-  float x_local, y_local;
-  unsigned int localIdx;
-
-  const float *x_other_it, *y_other_it, *z_other_it;
-
   // Prepare output: no correspondences initially:
   correspondences.clear();
   correspondences.reserve(nLocalPoints);
@@ -420,67 +431,138 @@ void CPointsMap::determineMatching2D(
 
   // Loop for each point in local map:
   // --------------------------------------------------
-  for (localIdx = params.offset_other_map_points,
-      x_other_it = &otherMap->m_x[params.offset_other_map_points],
-      y_other_it = &otherMap->m_y[params.offset_other_map_points],
-      z_other_it = &otherMap->m_z[params.offset_other_map_points];
-       localIdx < nLocalPoints; x_other_it += params.decimation_other_map_points,
-      y_other_it += params.decimation_other_map_points,
-      z_other_it += params.decimation_other_map_points,
-      localIdx += params.decimation_other_map_points)
-  {
-    // For speed-up:
-    x_local = x_locals[localIdx];  // *x_locals_it;
-    y_local = y_locals[localIdx];  // *y_locals_it;
+  // The query points are sharded across worker threads (params.numThreads),
+  // each with its own pairings accumulator, and merged at the end.
+  const size_t nThreads = std::max<size_t>(
+      1, params.numThreads != 0 ? params.numThreads : std::thread::hardware_concurrency());
 
-    // Find all the matchings in the requested distance:
+  // Number of actually visited local points (after offset/decimation):
+  const size_t nQueries = (params.offset_other_map_points >= nLocalPoints)
+      ? 0
+      : (nLocalPoints - params.offset_other_map_points + params.decimation_other_map_points - 1) /
+          params.decimation_other_map_points;
 
-    // KD-TREE implementation =================================
-    // Use a KD-tree to look for the nearnest neighbor of:
-    //   (x_local, y_local, z_local)
-    // In "this" (global/reference) points map.
+  // Make sure the index exists *before* any concurrent queries:
+  kdTreeEnsureIndexBuilt2D();
 
-    float tentativ_err_sq;
-    unsigned int tentativ_this_idx = kdTreeClosestPoint2D(
-        x_local, y_local,  // Look closest to this guy
-        tentativ_err_sq    // save here the min. distance squared
-    );
+  const auto matchRange = [&](size_t qFirst, size_t qEnd, TMatchShard& res)
+  {
+    res.corrs.reserve(qEnd - qFirst);
 
-    // Compute max. allowed distance:
-    maxDistForCorrespondenceSquared = square(
-        params.maxAngularDistForCorrespondence *
-            std::sqrt(
-                square(params.angularDistPivotPoint.x - x_local) +
-                square(params.angularDistPivotPoint.y - y_local)) +
-        params.maxDistForCorrespondence);
+    // Consecutive queries are usually spatially coherent (e.g. scan
+    // points), so the previous neighbor provides a tight initial pruning
+    // bound for the capped kd-tree search below:
+    bool haveLast = false;
+    size_t lastIdx = 0;
 
-    // Distance below the threshold??
-    if (tentativ_err_sq < maxDistForCorrespondenceSquared)
+    for (size_t q = qFirst; q < qEnd; q++)
     {
-      // Save all the correspondences:
-      TMatchingPair& p = tempCorrs.emplace_back();
+      const size_t localIdx =
+          params.offset_other_map_points + q * params.decimation_other_map_points;
+
+      // For speed-up:
+      const float x_local = x_locals[localIdx];
+      const float y_local = y_locals[localIdx];
 
-      p.globalIdx = tentativ_this_idx;
-      p.global.x = m_x[tentativ_this_idx];
-      p.global.y = m_y[tentativ_this_idx];
-      p.global.z = m_z[tentativ_this_idx];
+      // Compute max. allowed distance:
+      const double maxDistForCorrespondenceSquared = square(
+          params.maxAngularDistForCorrespondence *
+              std::sqrt(
+                  square(params.angularDistPivotPoint.x - x_local) +
+                  square(params.angularDistPivotPoint.y - y_local)) +
+          params.maxDistForCorrespondence);
 
-      p.localIdx = localIdx;
-      p.local.x = *x_other_it;
-      p.local.y = *y_other_it;
-      p.local.z = *z_other_it;
+      // KD-TREE implementation =================================
+      // Use a KD-tree to look for the nearest neighbor of
+      // (x_local, y_local) in "this" (global/reference) points map, with
+      // the search capped at the pairing threshold (farther neighbors
+      // would be discarded anyway):
+      bool found = false;
+      size_t this_idx = 0;
+      float err_sq = 0;
+      float cap = d2f(maxDistForCorrespondenceSquared);
+      if (haveLast)
+      {
+        const float dLast = square(x_local - m_x[lastIdx]) + square(y_local - m_y[lastIdx]);
+        if (dLast < cap)
+        {
+          // The previous neighbor is already below the threshold: use it
+          // as the current best candidate and tighten the search cap.
+          found = true;
+          this_idx = lastIdx;
+          err_sq = dLast;
+          cap = dLast;
+        }
+      }
+      size_t nnIdx;
+      float nnDistSqr;
+      if (kdTreeClosestPoint2DCapped(x_local, y_local, cap, nnIdx, nnDistSqr))
+      {
+        found = true;
+        this_idx = nnIdx;
+        err_sq = nnDistSqr;
+      }
 
-      p.errorSquareAfterTransformation = tentativ_err_sq;
+      // Distance below the threshold??
+      if (found)
+      {
+        // Save all the correspondences:
+        TMatchingPair& p = res.corrs.emplace_back();
 
-      // At least one:
-      nOtherMapPointsWithCorrespondence++;
+        p.globalIdx = static_cast<uint32_t>(this_idx);
+        p.global.x = m_x[this_idx];
+        p.global.y = m_y[this_idx];
+        p.global.z = m_z[this_idx];
 
-      // Accumulate the MSE:
-      _sumSqrDist += p.errorSquareAfterTransformation;
-      _sumSqrCount++;
-    }
+        p.localIdx = static_cast<uint32_t>(localIdx);
+        p.local.x = otherMap->m_x[localIdx];
+        p.local.y = otherMap->m_y[localIdx];
+        p.local.z = otherMap->m_z[localIdx];
 
-  }  // For each local point
+        p.errorSquareAfterTransformation = err_sq;
+
+        // At least one:
+        res.nWithCorrespondence++;
+
+        // Accumulate the MSE:
+        res.sumSqrDist += err_sq;
+        res.sumSqrCount++;
+
+        lastIdx = this_idx;
+        haveLast = true;
+      }
+    }  // For each local point
+  };
+
+  std::vector<TMatchShard> shards(nThreads);
+  if (nThreads == 1 || nQueries < 2 * nThreads)
+  {
+    matchRange(0, nQueries, shards[0]);
+  }
+  else
+  {
+    mrpt::WorkerThreadsPool pool(nThreads, mrpt::WorkerThreadsPool::POLICY_FIFO, "detMatching2D");
+    std::vector<std::future<void>> futs;
+    futs.reserve(nThreads);
+    for (size_t w = 0; w < nThreads; w++)
+      futs.emplace_back(pool.enqueue(
+          [&, w]()
+          { matchRange((nQueries * w) / nThreads, (nQueries * (w + 1)) / nThreads, shards[w]); }));
+    for (auto& f : futs) f.wait();
+  }
+
+  // Merge the per-thread results, in shard order so the output does not
+  // depend on thread scheduling:
+  for (auto& s : shards)
+  {
+    if (tempCorrs.empty())
+      tempCorrs = std::move(s.corrs);
+    else
+      tempCorrs.insert(tempCorrs.end(), s.corrs.begin(), s.corrs.end());
+    _sumSqrDist += s.sumSqrDist;
+    _sumSqrCount += s.sumSqrCount;
+    nOtherMapPointsWithCorrespondence += s.nWithCorrespondence;
+  }
 
   // Additional consistency filter: "onlyKeepTheClosest" up to now
   //  led to just one correspondence for each "local map" point, but
@@ -518,17 +600,7 @@ void CPointsMap::determineMatching2D(
  ---------------------------------------------------------------*/
 void CPointsMap::changeCoordinatesReference(const CPose2D& newBase)
 {
-  const size_t N = m_x.size();
-
-  const CPose3D newBase3D(newBase);
-
-  for (size_t i = 0; i < N; i++)
-    newBase3D.composePoint(
-        m_x[i], m_y[i], m_z[i],  // In
-        m_x[i], m_y[i], m_z[i]   // Out
-    );
-
-  mark_as_modified();
+  changeCoordinatesReference(CPose3D(newBase));
 }
 
 /*---------------------------------------------------------------
@@ -536,13 +608,8 @@ void CPointsMap::changeCoordinatesReference(const CPose2D& newBase)
  ---------------------------------------------------------------*/
 void CPointsMap::changeCoordinatesReference(const CPose3D& newBase)
 {
-  const size_t N = m_x.size();
-
-  for (size_t i = 0; i < N; i++)
-    newBase.composePoint(
-        m_x[i], m_y[i], m_z[i],  // In
-        m_x[i], m_y[i], m_z[i]   // Out
-    );
+  // SIMD batch kernel over the whole SoA x/y/z buffers:
+  mrpt::poses::Lie::SE<3>::composePoints(newBase, m_x.data(), m_y.data(), m_z.data(), m_x.size());
 
   mark_as_modified();
 }
@@ -828,6 +895,77 @@ float CPointsMap::squareDistanceToClosestCorrespondence(float x0, float y0) cons
   return kdTreeClosestPoint2DsqrError(x0, y0);
 }
 
+const CPointsMap::TPointNormals2D& CPointsMap::pointNormals2D(const size_t knn) const
+{
+  MRPT_START
+  ASSERT_GE_(knn, 3);
+
+  // Cache still valid?
+  if (m_pointNormals2D_knn == knn) return m_pointNormals2D;
+
+  const size_t N = m_x.size();
+
+  auto& nx = m_pointNormals2D.nx;
+  auto& ny = m_pointNormals2D.ny;
+  nx.assign(N, .0f);
+  ny.assign(N, .0f);
+
+  if (N >= knn)
+  {
+    std::vector<size_t> idxs;
+    std::vector<float> sqDists;
+
+    for (size_t i = 0; i < N; i++)
+    {
+      kdTreeNClosestPoint2DIdx(m_x[i], m_y[i], knn, idxs, sqDists);
+
+      // 2x2 covariance of the neighborhood:
+      float sx = 0, sy = 0;
+      for (const size_t j : idxs)
+      {
+        sx += m_x[j];
+        sy += m_y[j];
+      }
+      const float mx = sx / idxs.size(), my = sy / idxs.size();
+
+      float cxx = 0, cxy = 0, cyy = 0;
+      for (const size_t j : idxs)
+      {
+        const float dx = m_x[j] - mx, dy = m_y[j] - my;
+        cxx += dx * dx;
+        cxy += dx * dy;
+        cyy += dy * dy;
+      }
+      if (cxx + cyy < 1e-12f) continue;  // degenerate (all points coincide)
+
+      // The normal is the eigenvector of the smallest eigenvalue of the
+      // covariance (closed form for the symmetric 2x2 case):
+      const float lMin = 0.5f * (cxx + cyy) - std::sqrt(square(0.5f * (cxx - cyy)) + square(cxy));
+
+      float vx, vy;
+      if (std::abs(cxy) > 1e-12f)
+      {
+        vx = cxy;
+        vy = lMin - cxx;
+      }
+      else
+      {
+        // Diagonal covariance: the normal is the axis of least variance
+        vx = (cxx <= cyy) ? 1.0f : .0f;
+        vy = (cxx <= cyy) ? .0f : 1.0f;
+      }
+      const float norm = std::sqrt(vx * vx + vy * vy);
+      if (norm < 1e-12f) continue;
+      nx[i] = vx / norm;
+      ny[i] = vy / norm;
+    }
+  }
+
+  m_pointNormals2D_knn = knn;
+  return m_pointNormals2D;
+  MRPT_END
+}
+
 mrpt::math::TBoundingBoxf CPointsMap::boundingBox() const
 {
   MRPT_START
@@ -920,6 +1058,41 @@ mrpt::math::TBoundingBoxf CPointsMap::boundingBox() const
   MRPT_END
 }
 
+namespace
+{
+// Edge length of the fixed 3D tiles of the coarse occupancy index:
+constexpr float TILE_INDEX_TILE_SIZE = 2.0f;  // [m]
+
+int64_t tileCoordOf(const double v)
+{
+  return static_cast<int64_t>(std::floor(v / TILE_INDEX_TILE_SIZE));
+}
+// Packs the three tile coordinates into one 21-bits-per-axis key:
+uint64_t tileKeyOf(const int64_t tx, const int64_t ty, const int64_t tz)
+{
+  const auto pack = [](int64_t t) -> uint64_t
+  { return static_cast<uint64_t>(t + (1 << 20)) & 0x1fffff; };
+  return pack(tx) | (pack(ty) << 21) | (pack(tz) << 42);
+}
+}  // namespace
+
+const std::unordered_map<uint64_t, std::vector<uint32_t>>& CPointsMap::tileOccupancyIndex() const
+{
+  if (!m_tileIndexIsUpdated)
+  {
+    m_tileIndex.clear();
+    const size_t n = m_x.size();
+    m_tileIndex.reserve(n / 64 + 16);
+    for (size_t k = 0; k < n; k++)
+    {
+      const auto key = tileKeyOf(tileCoordOf(m_x[k]), tileCoordOf(m_y[k]), tileCoordOf(m_z[k]));
+      m_tileIndex[key].push_back(static_cast<uint32_t>(k));
+    }
+    m_tileIndexIsUpdated = true;
+  }
+  return m_tileIndex;
+}
+
 /*---------------------------------------------------------------
         computeMatchingWith3D
 ---------------------------------------------------------------*/
@@ -948,8 +1121,6 @@ void CPointsMap::determineMatching3D(
 
   auto bbLocal = mrpt::math::TBoundingBoxf::PlusMinusInfinity();
 
-  double maxDistForCorrespondenceSquared;
-
   // Prepare output: no correspondences initially:
   correspondences.clear();
   correspondences.reserve(nLocalPoints);
@@ -989,60 +1160,137 @@ void CPointsMap::determineMatching3D(
 
   // Loop for each point in local map:
   // --------------------------------------------------
-  for (unsigned int localIdx = params.offset_other_map_points; localIdx < nLocalPoints;
-       localIdx += params.decimation_other_map_points)
+  // The query points are sharded across worker threads (params.numThreads),
+  // each with its own pairings accumulator, and merged at the end.
+  const size_t nThreads = std::max<size_t>(
+      1, params.numThreads != 0 ? params.numThreads : std::thread::hardware_concurrency());
+
+  // Number of actually visited local points (after offset/decimation):
+  const size_t nQueries = (params.offset_other_map_points >= nLocalPoints)
+      ? 0
+      : (nLocalPoints - params.offset_other_map_points + params.decimation_other_map_points - 1) /
+          params.decimation_other_map_points;
+
+  // Make sure the index exists *before* any concurrent queries:
+  kdTreeEnsureIndexBuilt3D();
+
+  const auto matchRange = [&](size_t qFirst, size_t qEnd, TMatchShard& res)
   {
-    // For speed-up:
-    const float x_local = x_locals[localIdx];
-    const float y_local = y_locals[localIdx];
-    const float z_local = z_locals[localIdx];
+    res.corrs.reserve(qEnd - qFirst);
+
+    // Consecutive queries are usually spatially coherent (e.g. scan
+    // points), so the previous neighbor provides a tight initial pruning
+    // bound for the capped kd-tree search below:
+    bool haveLast = false;
+    size_t lastIdx = 0;
 
+    for (size_t q = qFirst; q < qEnd; q++)
     {
-      // KD-TREE implementation
-      // Use a KD-tree to look for the nearnest neighbor of:
-      //   (x_local, y_local, z_local)
-      // In "this" (global/reference) points map.
+      const size_t localIdx =
+          params.offset_other_map_points + q * params.decimation_other_map_points;
 
-      float tentativ_err_sq;
-      const unsigned int tentativ_this_idx = kdTreeClosestPoint3D(
-          x_local, y_local, z_local,  // Look closest to this guy
-          tentativ_err_sq             // save here the min. distance squared
-      );
+      // For speed-up:
+      const float x_local = x_locals[localIdx];
+      const float y_local = y_locals[localIdx];
+      const float z_local = z_locals[localIdx];
 
       // Compute max. allowed distance:
-      maxDistForCorrespondenceSquared = square(
+      const double maxDistForCorrespondenceSquared = square(
           params.maxAngularDistForCorrespondence *
               params.angularDistPivotPoint.distanceTo(TPoint3D(x_local, y_local, z_local)) +
           params.maxDistForCorrespondence);
 
+      // KD-TREE implementation: look for the nearest neighbor of
+      // (x_local, y_local, z_local) in "this" (global/reference) points
+      // map, with the search capped at the pairing threshold (farther
+      // neighbors would be discarded anyway):
+      bool found = false;
+      size_t this_idx = 0;
+      float err_sq = 0;
+      float cap = d2f(maxDistForCorrespondenceSquared);
+      if (haveLast)
+      {
+        const float dLast = square(x_local - m_x[lastIdx]) + square(y_local - m_y[lastIdx]) +
+            square(z_local - m_z[lastIdx]);
+        if (dLast < cap)
+        {
+          // The previous neighbor is already below the threshold: use it
+          // as the current best candidate and tighten the search cap.
+          found = true;
+          this_idx = lastIdx;
+          err_sq = dLast;
+          cap = dLast;
+        }
+      }
+      size_t nnIdx;
+      float nnDistSqr;
+      if (kdTreeClosestPoint3DCapped(x_local, y_local, z_local, cap, nnIdx, nnDistSqr))
+      {
+        found = true;
+        this_idx = nnIdx;
+        err_sq = nnDistSqr;
+      }
+
       // Distance below the threshold??
-      if (tentativ_err_sq < maxDistForCorrespondenceSquared)
+      if (found)
       {
         // Save all the correspondences:
-        TMatchingPair& p = tempCorrs.emplace_back();
+        TMatchingPair& p = res.corrs.emplace_back();
 
-        p.globalIdx = tentativ_this_idx;
-        p.global.x = m_x[tentativ_this_idx];
-        p.global.y = m_y[tentativ_this_idx];
-        p.global.z = m_z[tentativ_this_idx];
+        p.globalIdx = static_cast<uint32_t>(this_idx);
+        p.global.x = m_x[this_idx];
+        p.global.y = m_y[this_idx];
+        p.global.z = m_z[this_idx];
 
-        p.localIdx = localIdx;
+        p.localIdx = static_cast<uint32_t>(localIdx);
         p.local.x = otherMap->m_x[localIdx];
         p.local.y = otherMap->m_y[localIdx];
         p.local.z = otherMap->m_z[localIdx];
 
-        p.errorSquareAfterTransformation = tentativ_err_sq;
+        p.errorSquareAfterTransformation = err_sq;
 
         // At least one:
-        nOtherMapPointsWithCorrespondence++;
+        res.nWithCorrespondence++;
 
         // Accumulate the MSE:
-        _sumSqrDist += p.errorSquareAfterTransformation;
-        _sumSqrCount++;
+        res.sumSqrDist += err_sq;
+        res.sumSqrCount++;
+
+        lastIdx = this_idx;
+        haveLast = true;
       }
+    }  // For each local point
+  };
 
-    }  // End of test_match
-  }    // For each local point
+  std::vector<TMatchShard> shards(nThreads);
+  if (nThreads == 1 || nQueries < 2 * nThreads)
+  {
+    matchRange(0, nQueries, shards[0]);
+  }
+  else
+  {
+    mrpt::WorkerThreadsPool pool(nThreads, mrpt::WorkerThreadsPool::POLICY_FIFO, "detMatching3D");
+    std::vector<std::future<void>> futs;
+    futs.reserve(nThreads);
+    for (size_t w = 0; w < nThreads; w++)
+      futs.emplace_back(pool.enqueue(
+          [&, w]()
+          { matchRange((nQueries * w) / nThreads, (nQueries * (w + 1)) / nThreads, shards[w]); }));
+    for (auto& f : futs) f.wait();
+  }
+
+  // Merge the per-thread results, in shard order so the output does not
+  // depend on thread scheduling:
+  for (auto& s : shards)
+  {
+    if (tempCorrs.empty())
+      tempCorrs = std::move(s.corrs);
+    else
+      tempCorrs.insert(tempCorrs.end(), s.corrs.begin(), s.corrs.end());
+    _sumSqrDist += s.sumSqrDist;
+    _sumSqrCount += s.sumSqrCount;
+    nOtherMapPointsWithCorrespondence += s.nWithCorrespondence;
+  }
 
   // Additional consistency filter: "onlyKeepTheClosest" up to now
   //  led to just one correspondence for each "local map" point, but
@@ -1108,12 +1356,54 @@ void CPointsMap::extractPoints(
   maxY = max(corner1.y, corner2.y);
   minZ = min(corner1.z, corner2.z);
   maxZ = max(corner1.z, corner2.z);
-  for (size_t k = 0; k < m_x.size(); k++)
+
+  const auto testAndInsert = [&](const size_t k)
   {
     if ((m_x[k] >= minX && m_x[k] <= maxX) && (m_y[k] >= minY && m_y[k] <= maxY) &&
         (m_z[k] >= minZ && m_z[k] <= maxZ))
       outMap->insertPointRGB(m_x[k], m_y[k], m_z[k], R, G, B);
+  };
+
+  // For large maps, use the coarse tile-occupancy index so repeated box
+  // queries (e.g. per-frame map cropping) only visit candidate tiles
+  // instead of rescanning all points:
+  constexpr size_t TILE_INDEX_MIN_MAP_SIZE = 10000;
+  if (m_x.size() >= TILE_INDEX_MIN_MAP_SIZE)
+  {
+    const auto& tiles = tileOccupancyIndex();
+
+    const int64_t tx0 = tileCoordOf(minX), tx1 = tileCoordOf(maxX);
+    const int64_t ty0 = tileCoordOf(minY), ty1 = tileCoordOf(maxY);
+    const int64_t tz0 = tileCoordOf(minZ), tz1 = tileCoordOf(maxZ);
+    const uint64_t nBoxTiles = static_cast<uint64_t>(tx1 - tx0 + 1) *
+                               static_cast<uint64_t>(ty1 - ty0 + 1) *
+                               static_cast<uint64_t>(tz1 - tz0 + 1);
+    if (nBoxTiles <= tiles.size())
+    {
+      // Few candidate tiles: probe them in the hash map.
+      for (int64_t tx = tx0; tx <= tx1; tx++)
+      {
+        for (int64_t ty = ty0; ty <= ty1; ty++)
+        {
+          for (int64_t tz = tz0; tz <= tz1; tz++)
+          {
+            const auto it = tiles.find(tileKeyOf(tx, ty, tz));
+            if (it == tiles.end()) continue;
+            for (const auto k : it->second) testAndInsert(k);
+          }
+        }
+      }
+    }
+    else
+    {
+      // Huge query box: cheaper to walk the occupied tiles instead.
+      for (const auto& [key, idxs] : tiles)
+        for (const auto k : idxs) testAndInsert(k);
+    }
+    return;
   }
+
+  for (size_t k = 0; k < m_x.size(); k++) testAndInsert(k);
 }
 
 /*---------------------------------------------------------------
@@ -1482,6 +1772,23 @@ void CPointsMap::PLY_import_set_vertex(
   this->setPoint(idx, pt.x, pt.y, pt.z);
 }
 
+void CPointsMap::PLY_import_set_vertex_block(
+    size_t first_idx,
+    size_t num_pts,
+    const mrpt::math::TPoint3Df* pts,
+    [[maybe_unused]] const mrpt::img::TColorf* colors)
+{
+  // Direct columnar writes; the vectors were already sized by
+  // PLY_import_set_vertex_count():
+  for (size_t i = 0; i < num_pts; i++)
+  {
+    m_x[first_idx + i] = pts[i].x;
+    m_y[first_idx + i] = pts[i].y;
+    m_z[first_idx + i] = pts[i].z;
+  }
+  mark_as_modified();
+}
+
 /** In a base class, return the number of vertices */
 size_t CPointsMap::PLY_export_get_vertex_count() const { return this->size(); }
 /** In a base class, will be called after PLY_export_get_vertex_count() once
@@ -1553,22 +1860,84 @@ void CPointsMap::insertAnotherMap(
     // filter NANs:
     if (pt.x != pt.x) continue;
 
-    // Add to this map:
+    // Add to this map, in the source frame of coordinates for now:
     this->insertPointFrom(*otherMap, src);
+  }
 
-    // and overwrite the XYZ, if needed:
-    if (!identity_tf)
-    {
-      // Translation:
-      mrpt::math::TPoint3D g;
-      otherPose.composePoint(pt.x, pt.y, pt.z, g.x, g.y, g.z);
-      m_x.back() = g.x;
-      m_y.back() = g.y;
-      m_z.back() = g.z;
-    }
+  // Transform the newly-appended tail as one batch, using the SIMD
+  // SoA kernels, instead of per-point composePoint() calls:
+  if (!identity_tf)
+  {
+    mrpt::poses::Lie::SE<3>::composePoints(
+        otherPose, m_x.data() + N_this, m_y.data() + N_this, m_z.data() + N_this,
+        m_x.size() - N_this);
+  }
+}
+
+void CPointsMap::insertAnotherMap(
+    CPointsMap&& otherMap, const CPose3D& otherPose, const bool filterOutPointsAtZero)
+{
+  // The buffers can only be stolen if nothing has to be appended-to or
+  // filtered out point by point:
+  if (this->size() != 0 || filterOutPointsAtZero)
+  {
+    insertAnotherMap(&otherMap, otherPose, filterOutPointsAtZero);
+    return;
+  }
+
+  mark_as_modified();
+
+  m_x = std::move(otherMap.m_x);
+  m_y = std::move(otherMap.m_y);
+  m_z = std::move(otherMap.m_z);
+
+  // Move over the per-point fields present in both classes; the rest are
+  // default-filled by the resize() below (as in base_copyFrom):
+  const auto moveField = [](auto* dst, auto* src)
+  {
+    if (dst && src) *dst = std::move(*src);
+  };
+  moveField(getPointsBufferRef_intensity(), otherMap.getPointsBufferRef_intensity());
+  moveField(getPointsBufferRef_ring(), otherMap.getPointsBufferRef_ring());
+  moveField(getPointsBufferRef_timestamp(), otherMap.getPointsBufferRef_timestamp());
+  moveField(getPointsBufferRef_color_R(), otherMap.getPointsBufferRef_color_R());
+  moveField(getPointsBufferRef_color_G(), otherMap.getPointsBufferRef_color_G());
+  moveField(getPointsBufferRef_color_B(), otherMap.getPointsBufferRef_color_B());
+
+  this->resize(m_x.size());
+
+  // Leave the source as a coherent, empty map:
+  otherMap.resize(0);
+  otherMap.mark_as_modified();
+
+  if (!(otherPose == CPose3D::Identity()))
+  {
+    mrpt::poses::Lie::SE<3>::composePoints(
+        otherPose, m_x.data(), m_y.data(), m_z.data(), m_x.size());
   }
 }
 
+void CPointsMap::setFromXYZBuffers(
+    mrpt::aligned_std_vector<float>&& xs,
+    mrpt::aligned_std_vector<float>&& ys,
+    mrpt::aligned_std_vector<float>&& zs)
+{
+  MRPT_START
+  ASSERT_EQUAL_(xs.size(), ys.size());
+  ASSERT_EQUAL_(xs.size(), zs.size());
+
+  mark_as_modified();
+
+  m_x = std::move(xs);
+  m_y = std::move(ys);
+  m_z = std::move(zs);
+
+  // Fill class-specific per-point fields with default values:
+  this->resize(m_x.size());
+
+  MRPT_END
+}
+
 /** Helper method for ::copyFrom() */
 void CPointsMap::base_copyFrom(const CPointsMap& obj)
 {
@@ -2078,14 +2447,8 @@ void CPointsMap::loadFromVelodyneScan(
 
 // =========== API of the NearestNeighborsCapable virtual interface ======
 // See docs in base class
-void CPointsMap::nn_prepare_for_2d_queries() const
-{
-  const_cast<CPointsMap*>(this)->kdTreeEnsureIndexBuilt2D();
-}
-void CPointsMap::nn_prepare_for_3d_queries() const
-{
-  const_cast<CPointsMap*>(this)->kdTreeEnsureIndexBuilt3D();
-}
+void CPointsMap::nn_prepare_for_2d_queries() const { kdTreeEnsureIndexBuilt2D(); }
+void CPointsMap::nn_prepare_for_3d_queries() const { kdTreeEnsureIndexBuilt3D(); }
 bool CPointsMap::nn_single_search(
     const mrpt::math::TPoint3Df& query,
     mrpt::math::TPoint3Df& result,
@@ -2121,6 +2484,54 @@ bool CPointsMap::nn_single_search(
     return false;
   }
 }
+bool CPointsMap::nn_single_search_approx(
+    const mrpt::math::TPoint3Df& query,
+    mrpt::math::TPoint3Df& result,
+    float& out_dist_sqr,
+    uint64_t& resultIndexOrID,
+    float maxSearchDistanceSqr,
+    float epsilon) const
+{
+  try
+  {
+    size_t idx;
+    if (!kdTreeClosestPoint3DCapped(
+            query.x, query.y, query.z, maxSearchDistanceSqr, idx, out_dist_sqr, epsilon))
+      return false;
+    getPointFast(idx, result.x, result.y, result.z);
+    resultIndexOrID = idx;
+    return true;
+  }
+  catch (const std::exception&)
+  {
+    // kdTree*() methods throw on empty map
+    return false;
+  }
+}
+bool CPointsMap::nn_single_search_approx(
+    const mrpt::math::TPoint2Df& query,
+    mrpt::math::TPoint2Df& result,
+    float& out_dist_sqr,
+    uint64_t& resultIndexOrID,
+    float maxSearchDistanceSqr,
+    float epsilon) const
+{
+  try
+  {
+    size_t idx;
+    if (!kdTreeClosestPoint2DCapped(query.x, query.y, maxSearchDistanceSqr, idx, out_dist_sqr, epsilon))
+      return false;
+    float dummyZ = 0;
+    getPointFast(idx, result.x, result.y, dummyZ);
+    resultIndexOrID = idx;
+    return true;
+  }
+  catch (const std::exception&)
+  {
+    // kdTree*() methods throw on empty map
+    return false;
+  }
+}
 void CPointsMap::nn_multiple_search(
     const mrpt::math::TPoint3Df& query,
     const size_t N,
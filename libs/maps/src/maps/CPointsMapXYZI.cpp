@@ -9,18 +9,22 @@
 
 #include "maps-precomp.h"  // Precomp header
 //
+#include <mrpt/core/WorkerThreadsPool.h>
 #include <mrpt/core/bits_mem.h>
 #include <mrpt/io/CFileGZInputStream.h>
 #include <mrpt/io/CFileGZOutputStream.h>
 #include <mrpt/io/CFileInputStream.h>
 #include <mrpt/maps/CPointsMapXYZI.h>
 #include <mrpt/obs/CObservation3DRangeScan.h>
+#include <mrpt/obs/CObservationStereoImages.h>
 #include <mrpt/opengl/CPointCloudColoured.h>
 #include <mrpt/serialization/aligned_serialization.h>
 #include <mrpt/system/filesystem.h>
 #include <mrpt/system/os.h>
 
+#include <future>
 #include <iostream>
+#include <thread>
 
 #include "CPointsMap_crtp_common.h"
 
@@ -479,3 +483,136 @@ bool CPointsMapXYZI::saveToKittiVelodyneFile(const std::string& filename) const
     return false;
   }
 }
+
+void CPointsMapXYZI::loadFromStereoDisparity(
+    const mrpt::obs::CObservationStereoImages& obs,
+    const mrpt::math::CMatrixFloat& disparity,
+    const float minDisparity,
+    const float maxRange,
+    const unsigned int decimation,
+    const unsigned int numThreads)
+{
+  MRPT_START
+
+  const auto& cam = obs.leftCamera;
+  const int nRows = disparity.rows(), nCols = disparity.cols();
+  ASSERT_EQUAL_(nRows, static_cast<int>(cam.nrows));
+  ASSERT_EQUAL_(nCols, static_cast<int>(cam.ncols));
+  ASSERT_GE_(decimation, 1U);
+
+  const float fx = d2f(cam.fx()), fy = d2f(cam.fy());
+  const float cx = d2f(cam.cx()), cy = d2f(cam.cy());
+  const float baseline = d2f(obs.rightCameraPose.x());
+  ASSERT_GT_(baseline, .0f);
+  ASSERT_GT_(fx, .0f);
+  ASSERT_GT_(fy, .0f);
+
+  // Left camera pose on the vehicle (includes the image-axes rotation):
+  const auto sensorPose = mrpt::poses::CPose3D(obs.cameraPose);
+  const auto& R = sensorPose.getRotationMatrix();
+  const float R00 = d2f(R(0, 0)), R01 = d2f(R(0, 1)), R02 = d2f(R(0, 2));
+  const float R10 = d2f(R(1, 0)), R11 = d2f(R(1, 1)), R12 = d2f(R(1, 2));
+  const float R20 = d2f(R(2, 0)), R21 = d2f(R(2, 1)), R22 = d2f(R(2, 2));
+  const float tx = d2f(sensorPose.x()), ty = d2f(sensorPose.y()), tz = d2f(sensorPose.z());
+
+  // Per-pixel intensity from the left image, if it matches the disparity:
+  const bool withIntensity = !obs.imageLeft.isEmpty() &&
+      obs.imageLeft.getWidth() == static_cast<size_t>(nCols) &&
+      obs.imageLeft.getHeight() == static_cast<size_t>(nRows);
+  const mrpt::img::CImage imGray = withIntensity
+      ? mrpt::img::CImage(obs.imageLeft, mrpt::img::FAST_REF_OR_CONVERT_TO_GRAY)
+      : mrpt::img::CImage();
+
+  // One independent output buffer per row stripe; stripes are merged in
+  // order at the end, so results are identical for any thread count:
+  struct TStripeOutput
+  {
+    std::vector<float> xs, ys, zs, is;
+  };
+
+  const auto processRows = [&](const int r0, const int r1, TStripeOutput& out)
+  {
+    const float fxb = fx * baseline;
+    for (int v = r0; v < r1; v += decimation)
+    {
+      const uint8_t* imRow = withIntensity ? imGray.ptrLine<uint8_t>(v) : nullptr;
+      for (int u = 0; u < nCols; u += static_cast<int>(decimation))
+      {
+        const float d = disparity(v, u);
+        if (d < minDisparity) continue;
+        const float Z = fxb / d;
+        if (maxRange > 0 && Z > maxRange) continue;
+        const float X = (u - cx) * Z / fx;
+        const float Y = (v - cy) * Z / fy;
+
+        out.xs.push_back(R00 * X + R01 * Y + R02 * Z + tx);
+        out.ys.push_back(R10 * X + R11 * Y + R12 * Z + ty);
+        out.zs.push_back(R20 * X + R21 * Y + R22 * Z + tz);
+        out.is.push_back(imRow ? imRow[u] * (1.0f / 255) : 1.0f);
+      }
+    }
+  };
+
+  unsigned int nThreads = numThreads != 0 ? numThreads : std::thread::hardware_concurrency();
+  nThreads = std::max(1U, std::min<unsigned int>(nThreads, nRows));
+
+  std::vector<TStripeOutput> stripes(nThreads);
+
+  if (nThreads == 1)
+  {
+    processRows(0, nRows, stripes[0]);
+  }
+  else
+  {
+    static mrpt::WorkerThreadsPool pool(
+        std::thread::hardware_concurrency(), mrpt::WorkerThreadsPool::POLICY_FIFO,
+        "stereoBackProject");
+
+    // Stripe boundaries snapped to the decimation grid so each stripe
+    // visits exactly the rows the sequential version would:
+    const int dec = static_cast<int>(decimation);
+    const int nT = static_cast<int>(nThreads);
+    const int nDecRows = (nRows + dec - 1) / dec;
+
+    std::vector<std::future<void>> futs;
+    futs.reserve(nThreads);
+    for (int c = 0; c < nT; c++)
+    {
+      const int r0 = dec * ((nDecRows * c) / nT);
+      const int r1 = std::min(nRows, dec * ((nDecRows * (c + 1)) / nT));
+      futs.emplace_back(pool.enqueue([&processRows, &stripes, c, r0, r1]()
+                                     { processRows(r0, r1, stripes[c]); }));
+    }
+    // Join all stripes before leaving this scope, keeping the first error
+    // (if any) to rethrow afterwards:
+    std::exception_ptr firstExcept;
+    for (auto& f : futs)
+    {
+      try
+      {
+        f.get();
+      }
+      catch (...)
+      {
+        if (!firstExcept) firstExcept = std::current_exception();
+      }
+    }
+    if (firstExcept) std::rethrow_exception(firstExcept);
+  }
+
+  // Merge, in row order:
+  this->clear();
+  size_t nTotal = 0;
+  for (const auto& s : stripes) nTotal += s.xs.size();
+  this->reserve(nTotal);
+  for (const auto& s : stripes)
+  {
+    m_x.insert(m_x.end(), s.xs.begin(), s.xs.end());
+    m_y.insert(m_y.end(), s.ys.begin(), s.ys.end());
+    m_z.insert(m_z.end(), s.zs.begin(), s.zs.end());
+    m_intensity.insert(m_intensity.end(), s.is.begin(), s.is.end());
+  }
+  mark_as_modified();
+
+  MRPT_END
+}
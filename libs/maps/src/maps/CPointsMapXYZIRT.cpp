@@ -9,18 +9,23 @@
 
 #include "maps-precomp.h"  // Precomp header
 //
+#include <mrpt/core/WorkerThreadsPool.h>
 #include <mrpt/core/bits_mem.h>
 #include <mrpt/maps/CPointsMapXYZI.h>
 #include <mrpt/maps/CPointsMapXYZIRT.h>
 #include <mrpt/obs/CObservation3DRangeScan.h>
 #include <mrpt/obs/CObservationVelodyneScan.h>
 #include <mrpt/opengl/CPointCloudColoured.h>
+#include <mrpt/poses/Lie/SE.h>
 #include <mrpt/serialization/aligned_serialization.h>
 #include <mrpt/system/filesystem.h>
 #include <mrpt/system/os.h>
 
+#include <cstring>
 #include <fstream>
+#include <future>
 #include <iostream>
+#include <thread>
 
 #include "CPointsMap_crtp_common.h"
 
@@ -473,6 +478,118 @@ bool CPointsMapXYZIRT::internal_insertObservation(
   return CPointsMap::internal_insertObservation(obs, robotPose);
 }
 
+void CPointsMapXYZIRT::loadFromVelodyneScanDirect(
+    const mrpt::obs::CObservationVelodyneScan& scan,
+    const std::optional<const mrpt::poses::CPose3D>& robotPose,
+    const mrpt::obs::CObservationVelodyneScan::TGeneratePointCloudParameters& params,
+    const unsigned int numThreads)
+{
+  using Velo = mrpt::obs::CObservationVelodyneScan;
+
+  this->mark_as_modified();
+
+  // Insert vs. load and replace:
+  if (!insertionOptions.addToExistingPointsMap)
+    resize_XYZIRT(0, true /*I*/, true /*R*/, true /*T*/);  // memory is kept for reuse
+
+  const size_t nPkts = scan.scan_packets.size();
+  if (!nPkts) return;
+
+  // Stage 1/2: decode the raw packets into SoA buffers, in parallel (they
+  // are mutually independent):
+  std::vector<Velo::TDecodedPacket> pkts(nPkts);
+
+  unsigned int nThreads = numThreads != 0 ? numThreads : std::thread::hardware_concurrency();
+  nThreads = std::max<size_t>(1, std::min<size_t>(nThreads, nPkts));
+
+  if (nThreads == 1)
+  {
+    for (size_t i = 0; i < nPkts; i++) scan.decodePacket(i, pkts[i], params);
+  }
+  else
+  {
+    static mrpt::WorkerThreadsPool pool(
+        std::thread::hardware_concurrency(), mrpt::WorkerThreadsPool::POLICY_FIFO,
+        "velodyneDecode");
+
+    std::vector<std::future<void>> futs;
+    futs.reserve(nThreads);
+    for (unsigned int t = 0; t < nThreads; t++)
+    {
+      const size_t i0 = (nPkts * t) / nThreads;
+      const size_t i1 = (nPkts * (t + 1)) / nThreads;
+      futs.emplace_back(pool.enqueue(
+          [&scan, &pkts, &params, i0, i1]()
+          { for (size_t i = i0; i < i1; i++) scan.decodePacket(i, pkts[i], params); }));
+    }
+    // Join all workers before anything on this stack can go away, keeping
+    // the first error (if any) to rethrow afterwards:
+    std::exception_ptr firstExcept;
+    for (auto& f : futs)
+    {
+      try
+      {
+        f.get();
+      }
+      catch (...)
+      {
+        if (!firstExcept) firstExcept = std::current_exception();
+      }
+    }
+    if (firstExcept) std::rethrow_exception(firstExcept);
+  }
+
+  // Stage 2/2: merge in packet order into the XYZIRT vectors:
+  size_t nNew = 0;
+  for (const auto& p : pkts) nNew += p.x.size();
+  if (!nNew) return;
+
+  const size_t n0 = this->size();
+  resize_XYZIRT(n0 + nNew, true /*I*/, true /*R*/, true /*T*/);
+
+  // Per-point time convention: seconds, centered (t=0) at mid-scan:
+  std::optional<double> minT, maxT;
+  for (const auto& p : pkts)
+  {
+    if (p.x.empty()) continue;
+    const double t = mrpt::Clock::toDouble(p.pkt_timestamp);
+    if (!minT)
+    {
+      minT = t;
+      maxT = t;
+    }
+    else
+    {
+      mrpt::keep_min(*minT, t);
+      mrpt::keep_max(*maxT, t);
+    }
+  }
+  const double Tmid = minT ? (*minT + *maxT) * 0.5 : .0;
+
+  size_t idx = n0;
+  for (const auto& p : pkts)
+  {
+    const size_t n = p.x.size();
+    if (!n) continue;
+    std::memcpy(&m_x[idx], p.x.data(), n * sizeof(float));
+    std::memcpy(&m_y[idx], p.y.data(), n * sizeof(float));
+    std::memcpy(&m_z[idx], p.z.data(), n * sizeof(float));
+    const auto dt = static_cast<float>(mrpt::Clock::toDouble(p.pkt_timestamp) - Tmid);
+    for (size_t i = 0; i < n; i++)
+    {
+      m_intensity[idx + i] = mrpt::u8tof(p.intensity[i]);
+      m_ring[idx + i] = p.laser_id[i];
+      m_time[idx + i] = dt;
+    }
+    idx += n;
+  }
+
+  // Transform all the new points at once through the batch (SIMD-dispatched)
+  // SE(3) kernel:
+  const CPose3D sensorGlobalPose = robotPose ? (*robotPose + scan.sensorPose) : scan.sensorPose;
+  mrpt::poses::Lie::SE<3>::composePoints(sensorGlobalPose, &m_x[n0], &m_y[n0], &m_z[n0], nNew);
+}
+
 namespace mrpt::maps::detail
 {
 using mrpt::maps::CPointsMapXYZIRT;
@@ -9,6 +9,7 @@
 
 #include <gtest/gtest.h>
 #include <mrpt/maps/CPointsMapXYZI.h>
+#include <mrpt/obs/CObservationStereoImages.h>
 #include <mrpt/system/filesystem.h>
 #include <test_mrpt_common.h>
 
@@ -29,3 +30,62 @@ TEST(CPointsMapXYZI, loadFromKittiVelodyneFile)
   EXPECT_TRUE(read_ok);
   EXPECT_EQ(124668U, m.size());
 }
+
+TEST(CPointsMapXYZI, loadFromStereoDisparity)
+{
+  const unsigned int W = 64, H = 48;
+  const float fx = 100.0f, fy = 100.0f, cx = 32.0f, cy = 24.0f;
+  const float baseline = 0.1f, d = 2.0f;
+
+  mrpt::obs::CObservationStereoImages obs;
+  obs.leftCamera.ncols = W;
+  obs.leftCamera.nrows = H;
+  obs.leftCamera.fx(fx);
+  obs.leftCamera.fy(fy);
+  obs.leftCamera.cx(cx);
+  obs.leftCamera.cy(cy);
+  obs.rightCameraPose.x(baseline);
+
+  // Constant disparity => all points on the plane Z = fx*b/d:
+  mrpt::math::CMatrixFloat disp(H, W);
+  disp.fill(d);
+
+  mrpt::maps::CPointsMapXYZI m;
+  m.loadFromStereoDisparity(obs, disp, 0.1f /*minDisparity*/, 0 /*maxRange*/, 1, 1 /*threads*/);
+
+  EXPECT_EQ(m.size(), static_cast<size_t>(W) * H);
+
+  const float Z = fx * baseline / d;
+  // Principal point back-projects to (0,0,Z) (default camera pose=identity):
+  float x, y, z;
+  m.getPoint(static_cast<size_t>(cy) * W + static_cast<size_t>(cx), x, y, z);
+  EXPECT_NEAR(x, .0f, 1e-4f);
+  EXPECT_NEAR(y, .0f, 1e-4f);
+  EXPECT_NEAR(z, Z, 1e-4f);
+  // No left image => intensity defaults to 1:
+  EXPECT_NEAR(m.getPointIntensity(0), 1.0f, 1e-6f);
+
+  // Threaded result must be identical, point by point:
+  mrpt::maps::CPointsMapXYZI m4;
+  m4.loadFromStereoDisparity(obs, disp, 0.1f, 0, 1, 4 /*threads*/);
+  ASSERT_EQ(m4.size(), m.size());
+  for (size_t i = 0; i < m.size(); i++)
+  {
+    float x4, y4, z4;
+    m4.getPoint(i, x4, y4, z4);
+    m.getPoint(i, x, y, z);
+    EXPECT_EQ(x, x4);
+    EXPECT_EQ(y, y4);
+    EXPECT_EQ(z, z4);
+  }
+
+  // Decimation visits every 2nd row & column only:
+  mrpt::maps::CPointsMapXYZI md;
+  md.loadFromStereoDisparity(obs, disp, 0.1f, 0, 2 /*decimation*/, 2 /*threads*/);
+  EXPECT_EQ(md.size(), static_cast<size_t>(W / 2) * (H / 2));
+
+  // maxRange culls everything beyond it:
+  mrpt::maps::CPointsMapXYZI mr;
+  mr.loadFromStereoDisparity(obs, disp, 0.1f, 0.5f * Z /*maxRange*/, 1, 2);
+  EXPECT_EQ(mr.size(), 0U);
+}
@@ -13,6 +13,7 @@
 #include <mrpt/maps/CSimplePointsMap.h>
 #include <mrpt/maps/CWeightedPointsMap.h>
 #include <mrpt/poses/CPoint2D.h>
+#include <mrpt/random.h>
 
 #include <sstream>
 
@@ -274,3 +275,299 @@ TEST(CSimplePointsMapTests, loadSaveStreams) { do_tests_loadSaveStreams<CSimpleP
 TEST(CWeightedPointsMapTests, loadSaveStreams) { do_tests_loadSaveStreams<CWeightedPointsMap>(); }
 
 TEST(CColouredPointsMapTests, loadSaveStreams) { do_tests_loadSaveStreams<CColouredPointsMap>(); }
+
+TEST(CSimplePointsMapTests, setFromXYZBuffers)
+{
+  mrpt::aligned_std_vector<float> xs, ys, zs;
+  for (size_t i = 0; i < demo9_N; i++)
+  {
+    xs.push_back(demo9_xs[i]);
+    ys.push_back(demo9_ys[i]);
+    zs.push_back(demo9_zs[i]);
+  }
+  const float* origDataPtr = xs.data();
+
+  CSimplePointsMap pts;
+  pts.setFromXYZBuffers(std::move(xs), std::move(ys), std::move(zs));
+
+  ASSERT_EQ(pts.size(), demo9_N);
+  // Zero-copy: the map must have adopted the very same buffer:
+  EXPECT_EQ(pts.getPointsBufferRef_x().data(), origDataPtr);
+
+  float x, y, z;
+  pts.getPoint(demo9_N - 1, x, y, z);
+  EXPECT_EQ(x, demo9_xs[demo9_N - 1]);
+  EXPECT_EQ(y, demo9_ys[demo9_N - 1]);
+  EXPECT_EQ(z, demo9_zs[demo9_N - 1]);
+}
+
+TEST(CSimplePointsMapTests, insertAnotherMapMove)
+{
+  CSimplePointsMap src;
+  load_demo_9pts_map(src);
+  const float* origDataPtr = src.getPointsBufferRef_x().data();
+
+  const CPose3D pose(1.0, -2.0, 0.5, 0.2, -0.1, 0.1);
+
+  // Reference result, with the copying overload:
+  CSimplePointsMap ref;
+  ref.insertAnotherMap(&src, pose);
+
+  // Move overload into an empty map: must steal the buffers:
+  CSimplePointsMap dst;
+  dst.insertAnotherMap(std::move(src), pose);
+
+  EXPECT_EQ(src.size(), 0U);
+  EXPECT_EQ(dst.getPointsBufferRef_x().data(), origDataPtr);
+
+  ASSERT_EQ(dst.size(), ref.size());
+  for (size_t i = 0; i < ref.size(); i++)
+  {
+    float xr, yr, zr, xd, yd, zd;
+    ref.getPoint(i, xr, yr, zr);
+    dst.getPoint(i, xd, yd, zd);
+    EXPECT_NEAR(xr, xd, 1e-5f);
+    EXPECT_NEAR(yr, yd, 1e-5f);
+    EXPECT_NEAR(zr, zd, 1e-5f);
+  }
+
+  // Move overload into a NON-empty map: must fall back to copying:
+  load_demo_9pts_map(src);
+  dst.insertAnotherMap(std::move(src), CPose3D::Identity());
+  EXPECT_EQ(dst.size(), 2 * demo9_N);
+  EXPECT_EQ(src.size(), demo9_N);  // Source untouched in the fallback
+}
+
+TEST(CSimplePointsMapTests, incrementalBoundingBox)
+{
+  CSimplePointsMap m;
+  load_demo_9pts_map(m);
+
+  const auto bb1 = m.boundingBox();
+  EXPECT_NEAR(bb1.min.x, 0.0f, 1e-6f);
+  EXPECT_NEAR(bb1.max.x, 2.0f, 1e-6f);
+
+  // Inserting after a cached bounding box must extend it incrementally,
+  // with the same result than a from-scratch recomputation:
+  m.insertPoint(5.0f, -3.0f, 7.0f);
+  const auto bb2 = m.boundingBox();
+  EXPECT_NEAR(bb2.max.x, 5.0f, 1e-6f);
+  EXPECT_NEAR(bb2.min.y, -3.0f, 1e-6f);
+  EXPECT_NEAR(bb2.max.z, 7.0f, 1e-6f);
+
+  // Point *modifications* can shrink the box, so they must still force a
+  // full recomputation:
+  m.setPoint(demo9_N, 0.5f, 0.5f, 0.5f);
+  const auto bb3 = m.boundingBox();
+  EXPECT_NEAR(bb3.max.x, 2.0f, 1e-6f);
+  EXPECT_NEAR(bb3.min.y, 0.0f, 1e-6f);
+
+  // Inserting into an empty map with a cached (0,0,0) placeholder box:
+  CSimplePointsMap m2;
+  m2.boundingBox();
+  m2.insertPoint(4.0f, 5.0f, 6.0f);
+  const auto bb4 = m2.boundingBox();
+  EXPECT_NEAR(bb4.min.x, 4.0f, 1e-6f);
+  EXPECT_NEAR(bb4.max.z, 6.0f, 1e-6f);
+}
+
+TEST(CSimplePointsMapTests, extractPointsTileIndex)
+{
+  auto& rnd = mrpt::random::getRandomGenerator();
+  rnd.randomize(333);
+
+  // Large enough to engage the coarse tile-occupancy index:
+  CSimplePointsMap m;
+  const size_t N = 20000;
+  for (size_t i = 0; i < N; i++)
+    m.insertPoint(
+        static_cast<float>(rnd.drawUniform(-50.0, 50.0)),
+        static_cast<float>(rnd.drawUniform(-50.0, 50.0)),
+        static_cast<float>(rnd.drawUniform(-5.0, 5.0)));
+
+  const TPoint3D c1(-10.0, -10.0, -2.0), c2(7.0, 12.0, 3.0);
+
+  CSimplePointsMap out;
+  m.extractPoints(c1, c2, &out);
+
+  // Reference: brute-force count.
+  size_t nRef = 0;
+  for (size_t i = 0; i < N; i++)
+  {
+    float x, y, z;
+    m.getPoint(i, x, y, z);
+    if (x >= c1.x && x <= c2.x && y >= c1.y && y <= c2.y && z >= c1.z && z <= c2.z) nRef++;
+  }
+  EXPECT_EQ(out.size(), nRef);
+  EXPECT_GT(nRef, 0U);
+  for (size_t i = 0; i < out.size(); i++)
+  {
+    float x, y, z;
+    out.getPoint(i, x, y, z);
+    EXPECT_TRUE(x >= c1.x && x <= c2.x && y >= c1.y && y <= c2.y && z >= c1.z && z <= c2.z);
+  }
+
+  // A box covering the whole map must return all points (walk-all-tiles
+  // fallback path):
+  CSimplePointsMap all;
+  m.extractPoints({-1e3, -1e3, -1e3}, {1e3, 1e3, 1e3}, &all);
+  EXPECT_EQ(all.size(), N);
+}
+
+TEST(CSimplePointsMapTests, determineMatching3DThreaded)
+{
+  auto& rnd = mrpt::random::getRandomGenerator();
+  rnd.randomize(333);
+
+  CSimplePointsMap globalMap;
+  const size_t nGlobal = 2000;
+  for (size_t i = 0; i < nGlobal; i++)
+    globalMap.insertPoint(
+        static_cast<float>(rnd.drawUniform(-10.0, 10.0)),
+        static_cast<float>(rnd.drawUniform(-10.0, 10.0)),
+        static_cast<float>(rnd.drawUniform(-2.0, 2.0)));
+
+  // A "scan": a spatially-coherent walk, some points far from the map:
+  CSimplePointsMap localMap;
+  const size_t nLocal = 300;
+  for (size_t i = 0; i < nLocal; i++)
+  {
+    const double t = i / double(nLocal);
+    localMap.insertPoint(
+        static_cast<float>(8.0 * cos(6.28 * t) + rnd.drawUniform(-0.1, 0.1)),
+        static_cast<float>(8.0 * sin(6.28 * t) + rnd.drawUniform(-0.1, 0.1)),
+        static_cast<float>(rnd.drawUniform(-3.0, 3.0)));
+  }
+
+  const CPose3D otherMapPose(0.2, -0.1, 0.05, 0.1, 0, 0);
+
+  TMatchingParams params;
+  params.maxDistForCorrespondence = 0.5f;
+
+  // Single-threaded reference:
+  mrpt::tfest::TMatchingPairList corrsRef;
+  TMatchingExtraResults resRef;
+  params.numThreads = 1;
+  globalMap.determineMatching3D(&localMap, otherMapPose, corrsRef, params, resRef);
+  EXPECT_GT(corrsRef.size(), 0U);
+
+  // Check the (capped, seeded) kd-tree search against brute force:
+  for (const auto& c : corrsRef)
+  {
+    float lx, ly, lz;
+    localMap.getPoint(c.localIdx, lx, ly, lz);
+    float gx, gy, gz;
+    otherMapPose.composePoint(lx, ly, lz, gx, gy, gz);
+    float bestD = std::numeric_limits<float>::max();
+    for (size_t i = 0; i < nGlobal; i++)
+    {
+      float x, y, z;
+      globalMap.getPoint(i, x, y, z);
+      bestD = std::min(bestD, square(x - gx) + square(y - gy) + square(z - gz));
+    }
+    EXPECT_NEAR(c.errorSquareAfterTransformation, bestD, 1e-4f);
+  }
+
+  // Sharded run must give the same pairings, in the same order:
+  mrpt::tfest::TMatchingPairList corrs;
+  TMatchingExtraResults res;
+  params.numThreads = 4;
+  globalMap.determineMatching3D(&localMap, otherMapPose, corrs, params, res);
+
+  ASSERT_EQ(corrs.size(), corrsRef.size());
+  for (size_t i = 0; i < corrs.size(); i++)
+  {
+    EXPECT_EQ(corrs[i].localIdx, corrsRef[i].localIdx);
+    EXPECT_EQ(corrs[i].globalIdx, corrsRef[i].globalIdx);
+  }
+  EXPECT_NEAR(res.sumSqrDist, resRef.sumSqrDist, 1e-4f);
+  EXPECT_NEAR(res.correspondencesRatio, resRef.correspondencesRatio, 1e-6f);
+
+  // Same check for the 2D variant:
+  mrpt::tfest::TMatchingPairList corrs2dRef, corrs2d;
+  TMatchingExtraResults res2dRef, res2d;
+  params.numThreads = 1;
+  globalMap.determineMatching2D(&localMap, CPose2D(0.2, -0.1, 0.05), corrs2dRef, params, res2dRef);
+  params.numThreads = 0;  // auto
+  globalMap.determineMatching2D(&localMap, CPose2D(0.2, -0.1, 0.05), corrs2d, params, res2d);
+  ASSERT_EQ(corrs2d.size(), corrs2dRef.size());
+  EXPECT_GT(corrs2dRef.size(), 0U);
+  for (size_t i = 0; i < corrs2d.size(); i++)
+    EXPECT_EQ(corrs2d[i].globalIdx, corrs2dRef[i].globalIdx);
+}
+
+TEST(CSimplePointsMapTests, nnSingleSearchApprox)
+{
+  auto& rnd = mrpt::random::getRandomGenerator();
+  rnd.randomize(333);
+
+  CSimplePointsMap m;
+  const size_t N = 1000;
+  for (size_t i = 0; i < N; i++)
+    m.insertPoint(
+        static_cast<float>(rnd.drawUniform(-5.0, 5.0)), static_cast<float>(rnd.drawUniform(-5.0, 5.0)),
+        static_cast<float>(rnd.drawUniform(-1.0, 1.0)));
+
+  const mrpt::maps::NearestNeighborsCapable& nn = m;
+
+  for (int rep = 0; rep < 50; rep++)
+  {
+    const mrpt::math::TPoint3Df query = {
+        static_cast<float>(rnd.drawUniform(-5.0, 5.0)), static_cast<float>(rnd.drawUniform(-5.0, 5.0)),
+        static_cast<float>(rnd.drawUniform(-1.0, 1.0))};
+
+    mrpt::math::TPoint3Df ptExact, ptApprox;
+    float dExact = 0, dApprox = 0;
+    uint64_t idExact = 0, idApprox = 0;
+
+    ASSERT_TRUE(nn.nn_single_search(query, ptExact, dExact, idExact));
+
+    // eps=0 with a generous bound must match the exact search:
+    EXPECT_TRUE(nn.nn_single_search_approx(query, ptApprox, dApprox, idApprox, 1e6f));
+    EXPECT_EQ(idApprox, idExact);
+    EXPECT_NEAR(dApprox, dExact, 1e-6f);
+
+    // A bound below the true NN distance must make the search fail:
+    EXPECT_FALSE(nn.nn_single_search_approx(query, ptApprox, dApprox, idApprox, 0.5f * dExact));
+
+    // eps>0: any answer must still honor the bound:
+    const float cap = 4.0f * dExact;
+    if (nn.nn_single_search_approx(query, ptApprox, dApprox, idApprox, cap, 0.5f))
+    {
+      EXPECT_LT(dApprox, cap);
+      EXPECT_GE(dApprox, dExact - 1e-6f);
+    }
+  }
+
+  // 2D overload, eps=0 vs exact:
+  const mrpt::math::TPoint2Df q2 = {1.5f, -2.0f};
+  mrpt::math::TPoint2Df p2e, p2a;
+  float d2e = 0, d2a = 0;
+  uint64_t i2e = 0, i2a = 0;
+  ASSERT_TRUE(nn.nn_single_search(q2, p2e, d2e, i2e));
+  EXPECT_TRUE(nn.nn_single_search_approx(q2, p2a, d2a, i2a, 1e6f));
+  EXPECT_EQ(i2a, i2e);
+  EXPECT_NEAR(d2a, d2e, 1e-6f);
+}
+
+TEST(CSimplePointsMapTests, pointNormals2D)
+{
+  CSimplePointsMap m;
+  // A straight wall along the X axis:
+  const size_t N = 50;
+  for (size_t i = 0; i < N; i++) m.insertPoint(0.05f * i, 1.0f, 0.0f);
+
+  const auto& normals = m.pointNormals2D(8);
+  ASSERT_EQ(normals.nx.size(), N);
+  ASSERT_EQ(normals.ny.size(), N);
+
+  for (size_t i = 0; i < N; i++)
+  {
+    EXPECT_NEAR(std::abs(normals.ny[i]), 1.0f, 1e-4f) << "i=" << i;
+    EXPECT_NEAR(normals.nx[i], 0.0f, 1e-4f) << "i=" << i;
+  }
+
+  // The cache must be invalidated by map changes:
+  m.insertPoint(10.0f, 10.0f, 0.0f);
+  EXPECT_EQ(m.pointNormals2D(8).nx.size(), N + 1);
+}
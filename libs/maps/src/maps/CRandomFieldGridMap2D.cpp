@@ -671,6 +671,8 @@ void CRandomFieldGridMap2D::TInsertionOptionsCommon::internal_dumpToTextStream_c
   out << mrpt::format(
       "GMRF_gridmap_image_cy                   = %u\n",
       static_cast<unsigned int>(GMRF_gridmap_image_cy));
+  out << mrpt::format(
+      "GMRF_use_iterative_solver               = %s\n", GMRF_use_iterative_solver ? "YES" : "NO");
 }
 
 /*---------------------------------------------------------------
@@ -705,6 +707,9 @@ void CRandomFieldGridMap2D::TInsertionOptionsCommon::internal_loadFromConfigFile
   GMRF_gridmap_image_res = iniFile.read_float(section.c_str(), "gridmap_image_res", 0.01f, false);
   GMRF_gridmap_image_cx = iniFile.read_int(section.c_str(), "gridmap_image_cx", 0, false);
   GMRF_gridmap_image_cy = iniFile.read_int(section.c_str(), "gridmap_image_cy", 0, false);
+
+  GMRF_use_iterative_solver =
+      iniFile.read_bool(section.c_str(), "GMRF_use_iterative_solver", GMRF_use_iterative_solver);
 }
 
 /*---------------------------------------------------------------
@@ -2333,6 +2338,10 @@ void CRandomFieldGridMap2D::insertObservation_GMRF(
 void CRandomFieldGridMap2D::updateMapEstimation_GMRF()
 {
   mrpt::math::CVectorDouble x_incr, x_var;
+  m_gmrf.setSolverAlgorithm(
+      m_insertOptions_common->GMRF_use_iterative_solver
+          ? mrpt::graphs::ScalarFactorGraph::saLSCG
+          : mrpt::graphs::ScalarFactorGraph::saSparseQR);
   m_gmrf.updateEstimation(x_incr, m_insertOptions_common->GMRF_skip_variance ? nullptr : &x_var);
 
   ASSERT_(size_t(m_map.size()) == size_t(x_incr.size()));
@@ -125,13 +125,24 @@ void CSimplePointsMap::serializeFrom(mrpt::serialization::CArchive& in, uint8_t
       uint32_t n;
       in >> n;
 
-      this->resize(n);
-
       if (n > 0)
       {
-        in.ReadBufferFixEndianness(&m_x[0], n);
-        in.ReadBufferFixEndianness(&m_y[0], n);
-        in.ReadBufferFixEndianness(&m_z[0], n);
+        // Prefer borrowed (zero-copy) reads, e.g. from memory-backed
+        // archives; fall back to the regular copying reads:
+        for (auto* vec : {&m_x, &m_y, &m_z})
+        {
+          if (const float* p = in.ReadBufferBorrowFixEndianness<float>(n); p)
+            vec->assign(p, p + n);
+          else
+          {
+            vec->resize(n);
+            in.ReadBufferFixEndianness(vec->data(), n);
+          }
+        }
+      }
+      else
+      {
+        this->resize(n);
       }
       if (version >= 9)
         in >> genericMapParams;
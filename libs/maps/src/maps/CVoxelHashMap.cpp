@@ -0,0 +1,551 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   +------------------------------------------------------------------------+ */
+
+#include "maps-precomp.h"  // Precomp header
+//
+#include <mrpt/maps/../obs/CObservationPointCloud.h>
+#include <mrpt/maps/CSimplePointsMap.h>
+#include <mrpt/maps/CVoxelHashMap.h>
+#include <mrpt/opengl/CPointCloud.h>
+#include <mrpt/opengl/Scene.h>
+#include <mrpt/serialization/CArchive.h>
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+using namespace mrpt::maps;
+using namespace std::string_literals;  // "..."s
+
+//  =========== Begin of Map definition ============
+MAP_DEFINITION_REGISTER("mrpt::maps::CVoxelHashMap,voxelHashMap", mrpt::maps::CVoxelHashMap)
+
+CVoxelHashMap::TMapDefinition::TMapDefinition() = default;
+void CVoxelHashMap::TMapDefinition::loadFromConfigFile_map_specific(
+    const mrpt::config::CConfigFileBase& source, const std::string& sectionNamePrefix)
+{
+  // [<sectionNamePrefix>+"_creationOpts"]
+  const std::string sSectCreation = sectionNamePrefix + "_creationOpts"s;
+  MRPT_LOAD_CONFIG_VAR(resolution, double, source, sSectCreation);
+  MRPT_LOAD_CONFIG_VAR(initial_capacity, uint64_t, source, sSectCreation);
+
+  insertionOpts.loadFromConfigFile(source, sectionNamePrefix + "_insertOpts"s);
+  likelihoodOpts.loadFromConfigFile(source, sectionNamePrefix + "_likelihoodOpts"s);
+}
+
+void CVoxelHashMap::TMapDefinition::dumpToTextStream_map_specific(std::ostream& out) const
+{
+  LOADABLEOPTS_DUMP_VAR(resolution, double);
+  LOADABLEOPTS_DUMP_VAR(initial_capacity, int);
+
+  this->insertionOpts.dumpToTextStream(out);
+  this->likelihoodOpts.dumpToTextStream(out);
+}
+
+mrpt::maps::CMetricMap::Ptr CVoxelHashMap::internal_CreateFromMapDefinition(
+    const mrpt::maps::TMetricMapInitializer& _def)
+{
+  const CVoxelHashMap::TMapDefinition& def =
+      *dynamic_cast<const CVoxelHashMap::TMapDefinition*>(&_def);
+  auto obj = CVoxelHashMap::Create(def.resolution, def.initial_capacity);
+  obj->insertionOptions = def.insertionOpts;
+  obj->likelihoodOptions = def.likelihoodOpts;
+  return obj;
+}
+//  =========== End of Map definition Block =========
+
+IMPLEMENTS_SERIALIZABLE(CVoxelHashMap, CMetricMap, mrpt::maps)
+
+// ---------------- Options ----------------
+void TVoxelHashMap_InsertionOptions::loadFromConfigFile(
+    const mrpt::config::CConfigFileBase& c, const std::string& s)
+{
+  MRPT_LOAD_CONFIG_VAR(max_range, double, c, s);
+  MRPT_LOAD_CONFIG_VAR(decimation, int, c, s);
+  MRPT_LOAD_CONFIG_VAR(num_threads, int, c, s);
+}
+void TVoxelHashMap_InsertionOptions::saveToConfigFile(
+    mrpt::config::CConfigFileBase& c, const std::string& s) const
+{
+  MRPT_SAVE_CONFIG_VAR(max_range, c, s);
+  MRPT_SAVE_CONFIG_VAR(decimation, c, s);
+  MRPT_SAVE_CONFIG_VAR(num_threads, c, s);
+}
+void TVoxelHashMap_InsertionOptions::writeToStream(mrpt::serialization::CArchive& out) const
+{
+  const int8_t version = 0;
+  out << version;
+  out << max_range << decimation << num_threads;
+}
+void TVoxelHashMap_InsertionOptions::readFromStream(mrpt::serialization::CArchive& in)
+{
+  int8_t version;
+  in >> version;
+  switch (version)
+  {
+    case 0:
+      in >> max_range >> decimation >> num_threads;
+      break;
+    default:
+      MRPT_THROW_UNKNOWN_SERIALIZATION_VERSION(version);
+  }
+}
+
+void TVoxelHashMap_LikelihoodOptions::loadFromConfigFile(
+    const mrpt::config::CConfigFileBase& c, const std::string& s)
+{
+  MRPT_LOAD_CONFIG_VAR(decimate_up_to, int, c, s);
+  MRPT_LOAD_CONFIG_VAR(occupiedThreshold, int, c, s);
+  MRPT_LOAD_CONFIG_VAR(saturation_hits, int, c, s);
+}
+void TVoxelHashMap_LikelihoodOptions::saveToConfigFile(
+    mrpt::config::CConfigFileBase& c, const std::string& s) const
+{
+  MRPT_SAVE_CONFIG_VAR(decimate_up_to, c, s);
+  MRPT_SAVE_CONFIG_VAR(occupiedThreshold, c, s);
+  MRPT_SAVE_CONFIG_VAR(saturation_hits, c, s);
+}
+void TVoxelHashMap_LikelihoodOptions::writeToStream(mrpt::serialization::CArchive& out) const
+{
+  const int8_t version = 0;
+  out << version;
+  out << decimate_up_to << occupiedThreshold << saturation_hits;
+}
+void TVoxelHashMap_LikelihoodOptions::readFromStream(mrpt::serialization::CArchive& in)
+{
+  int8_t version;
+  in >> version;
+  switch (version)
+  {
+    case 0:
+      in >> decimate_up_to >> occupiedThreshold >> saturation_hits;
+      break;
+    default:
+      MRPT_THROW_UNKNOWN_SERIALIZATION_VERSION(version);
+  }
+}
+
+// ---------------- The map class ----------------
+namespace
+{
+size_t roundUpToPow2(size_t v)
+{
+  size_t c = 1;
+  while (c < v) c <<= 1;
+  return c;
+}
+
+// Fibonacci hashing of the packed 63-bit key:
+inline size_t hashKey(uint64_t key) { return static_cast<size_t>(key * 0x9E3779B97F4A7C15ULL); }
+}  // namespace
+
+CVoxelHashMap::CVoxelHashMap(double resolution, size_t initialCapacity) :
+    m_resolution(resolution), m_invResolution(1.0 / resolution)
+{
+  ASSERT_GT_(resolution, .0);
+  m_capacity = roundUpToPow2(std::max<size_t>(64, initialCapacity));
+  m_table = std::make_unique<Bucket[]>(m_capacity);
+}
+
+CVoxelHashMap::~CVoxelHashMap() = default;
+
+CVoxelHashMap::CVoxelHashMap(const CVoxelHashMap& o) : CVoxelHashMap(o.m_resolution, o.m_capacity)
+{
+  *this = o;
+}
+
+CVoxelHashMap& CVoxelHashMap::operator=(const CVoxelHashMap& o)
+{
+  if (&o == this) return *this;
+
+  m_resolution = o.m_resolution;
+  m_invResolution = o.m_invResolution;
+  m_capacity = o.m_capacity;
+  m_table = std::make_unique<Bucket[]>(m_capacity);
+  for (size_t i = 0; i < m_capacity; i++)
+  {
+    m_table[i].key.store(o.m_table[i].key.load(std::memory_order_relaxed));
+    m_table[i].hits.store(o.m_table[i].hits.load(std::memory_order_relaxed));
+  }
+  m_used.store(o.m_used.load(std::memory_order_relaxed));
+  insertionOptions = o.insertionOptions;
+  likelihoodOptions = o.likelihoodOptions;
+  genericMapParams = o.genericMapParams;
+  return *this;
+}
+
+uint64_t CVoxelHashMap::packKey(int32_t cx, int32_t cy, int32_t cz)
+{
+  constexpr int32_t BIAS = 1 << 20;  // 21-bit signed range
+  const auto ux = static_cast<uint64_t>(cx + BIAS) & 0x1FFFFF;
+  const auto uy = static_cast<uint64_t>(cy + BIAS) & 0x1FFFFF;
+  const auto uz = static_cast<uint64_t>(cz + BIAS) & 0x1FFFFF;
+  return (ux << 42) | (uy << 21) | uz;
+}
+
+void CVoxelHashMap::unpackKey(uint64_t key, int32_t& cx, int32_t& cy, int32_t& cz)
+{
+  constexpr int32_t BIAS = 1 << 20;
+  cx = static_cast<int32_t>((key >> 42) & 0x1FFFFF) - BIAS;
+  cy = static_cast<int32_t>((key >> 21) & 0x1FFFFF) - BIAS;
+  cz = static_cast<int32_t>(key & 0x1FFFFF) - BIAS;
+}
+
+uint64_t CVoxelHashMap::coordToKey(double x, double y, double z) const
+{
+  const auto cx = static_cast<int32_t>(std::floor(x * m_invResolution));
+  const auto cy = static_cast<int32_t>(std::floor(y * m_invResolution));
+  const auto cz = static_cast<int32_t>(std::floor(z * m_invResolution));
+  return packKey(cx, cy, cz);
+}
+
+void CVoxelHashMap::accumulateHitByKey(uint64_t key)
+{
+  const size_t mask = m_capacity - 1;
+  size_t idx = hashKey(key) & mask;
+  for (size_t probe = 0; probe < m_capacity; probe++, idx = (idx + 1) & mask)
+  {
+    Bucket& b = m_table[idx];
+    uint64_t cur = b.key.load(std::memory_order_acquire);
+    if (cur == EMPTY_KEY)
+    {
+      // Try to claim this free bucket:
+      if (b.key.compare_exchange_strong(
+              cur, key, std::memory_order_acq_rel, std::memory_order_acquire))
+      {
+        m_used.fetch_add(1, std::memory_order_relaxed);
+        b.hits.fetch_add(1, std::memory_order_relaxed);
+        return;
+      }
+      // Lost the race; `cur` now holds the winner's key.
+    }
+    if (cur == key)
+    {
+      b.hits.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    // Collision: keep (linear) probing.
+  }
+  THROW_EXCEPTION("Voxel hash table full: missing call to ensureExtraCapacity()?");
+}
+
+void CVoxelHashMap::accumulateHit(double x, double y, double z)
+{
+  accumulateHitByKey(coordToKey(x, y, z));
+}
+
+int32_t CVoxelHashMap::voxelHits(double x, double y, double z) const
+{
+  const uint64_t key = coordToKey(x, y, z);
+  const size_t mask = m_capacity - 1;
+  size_t idx = hashKey(key) & mask;
+  for (size_t probe = 0; probe < m_capacity; probe++, idx = (idx + 1) & mask)
+  {
+    const uint64_t cur = m_table[idx].key.load(std::memory_order_acquire);
+    if (cur == EMPTY_KEY) return 0;
+    if (cur == key) return m_table[idx].hits.load(std::memory_order_relaxed);
+  }
+  return 0;
+}
+
+void CVoxelHashMap::ensureExtraCapacity(size_t extraVoxels)
+{
+  const size_t needed = m_used.load(std::memory_order_relaxed) + extraVoxels;
+  if (2 * needed <= m_capacity) return;
+
+  const size_t newCap = roundUpToPow2(2 * needed);
+  auto newTable = std::make_unique<Bucket[]>(newCap);
+  const size_t newMask = newCap - 1;
+
+  for (size_t i = 0; i < m_capacity; i++)
+  {
+    const uint64_t key = m_table[i].key.load(std::memory_order_relaxed);
+    if (key == EMPTY_KEY) continue;
+    size_t idx = hashKey(key) & newMask;
+    while (newTable[idx].key.load(std::memory_order_relaxed) != EMPTY_KEY)
+      idx = (idx + 1) & newMask;
+    newTable[idx].key.store(key, std::memory_order_relaxed);
+    newTable[idx].hits.store(
+        m_table[i].hits.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  }
+  m_table = std::move(newTable);
+  m_capacity = newCap;
+}
+
+void CVoxelHashMap::visitOccupiedVoxels(
+    const std::function<void(const mrpt::math::TPoint3D&, int32_t)>& f) const
+{
+  for (size_t i = 0; i < m_capacity; i++)
+  {
+    const uint64_t key = m_table[i].key.load(std::memory_order_acquire);
+    if (key == EMPTY_KEY) continue;
+    const int32_t hits = m_table[i].hits.load(std::memory_order_relaxed);
+    if (hits <= 0) continue;
+    int32_t cx, cy, cz;
+    unpackKey(key, cx, cy, cz);
+    const mrpt::math::TPoint3D center(
+        (cx + 0.5) * m_resolution, (cy + 0.5) * m_resolution, (cz + 0.5) * m_resolution);
+    f(center, hits);
+  }
+}
+
+std::string CVoxelHashMap::asString() const
+{
+  return mrpt::format(
+      "Voxel hash map, resolution=%.03f m, voxels=%u", m_resolution,
+      static_cast<unsigned>(voxelCount()));
+}
+
+bool CVoxelHashMap::isEmpty() const { return voxelCount() == 0; }
+
+void CVoxelHashMap::internal_clear()
+{
+  for (size_t i = 0; i < m_capacity; i++)
+  {
+    m_table[i].key.store(EMPTY_KEY, std::memory_order_relaxed);
+    m_table[i].hits.store(0, std::memory_order_relaxed);
+  }
+  m_used.store(0, std::memory_order_relaxed);
+}
+
+mrpt::math::TBoundingBoxf CVoxelHashMap::boundingBox() const
+{
+  auto bb = mrpt::math::TBoundingBoxf::PlusMinusInfinity();
+  bool any = false;
+  visitOccupiedVoxels(
+      [&](const mrpt::math::TPoint3D& pt, int32_t)
+      {
+        bb.updateWithPoint(
+            mrpt::math::TPoint3Df(mrpt::d2f(pt.x), mrpt::d2f(pt.y), mrpt::d2f(pt.z)));
+        any = true;
+      });
+  if (!any) return {};
+  return bb;
+}
+
+void CVoxelHashMap::getVisualizationInto(mrpt::opengl::CSetOfObjects& outObj) const
+{
+  auto glPts = mrpt::opengl::CPointCloud::Create();
+  glPts->setPointSize(3.0f);
+  visitOccupiedVoxels(
+      [&](const mrpt::math::TPoint3D& pt, int32_t hits)
+      {
+        if (hits < likelihoodOptions.occupiedThreshold) return;
+        glPts->insertPoint(pt);
+      });
+  outObj.insert(glPts);
+}
+
+void CVoxelHashMap::saveMetricMapRepresentationToFile(const std::string& filNamePrefix) const
+{
+  MRPT_START
+  // Save as 3D Scene:
+  mrpt::opengl::Scene scene;
+  scene.insert(this->getVisualization());
+  const std::string fil = filNamePrefix + std::string("_3D.3Dscene");
+  scene.saveToFile(fil);
+  MRPT_END
+}
+
+// ---------------- Serialization ----------------
+uint8_t CVoxelHashMap::serializeGetVersion() const { return 0; }
+void CVoxelHashMap::serializeTo(mrpt::serialization::CArchive& out) const
+{
+  insertionOptions.writeToStream(out);
+  likelihoodOptions.writeToStream(out);
+  out << genericMapParams;
+
+  out << m_resolution;
+  out << static_cast<uint64_t>(voxelCount());
+  for (size_t i = 0; i < m_capacity; i++)
+  {
+    const uint64_t key = m_table[i].key.load(std::memory_order_relaxed);
+    if (key == EMPTY_KEY) continue;
+    out << key << m_table[i].hits.load(std::memory_order_relaxed);
+  }
+}
+
+void CVoxelHashMap::serializeFrom(mrpt::serialization::CArchive& in, uint8_t version)
+{
+  switch (version)
+  {
+    case 0:
+    {
+      insertionOptions.readFromStream(in);
+      likelihoodOptions.readFromStream(in);
+      in >> genericMapParams;
+
+      in >> m_resolution;
+      m_invResolution = 1.0 / m_resolution;
+
+      uint64_t n;
+      in >> n;
+
+      m_capacity = roundUpToPow2(std::max<size_t>(64, 2 * n));
+      m_table = std::make_unique<Bucket[]>(m_capacity);
+      m_used.store(0, std::memory_order_relaxed);
+
+      for (uint64_t i = 0; i < n; i++)
+      {
+        uint64_t key;
+        int32_t hits;
+        in >> key >> hits;
+        accumulateHitByKey(key);
+        // accumulateHitByKey() set it to 1; overwrite with the stored
+        // counter:
+        const size_t mask = m_capacity - 1;
+        size_t idx = hashKey(key) & mask;
+        while (m_table[idx].key.load(std::memory_order_relaxed) != key) idx = (idx + 1) & mask;
+        m_table[idx].hits.store(hits, std::memory_order_relaxed);
+      }
+    }
+    break;
+    default:
+      MRPT_THROW_UNKNOWN_SERIALIZATION_VERSION(version);
+  };
+}
+
+// ---------------- Observation insertion ----------------
+void CVoxelHashMap::insertPointCloudParallel(
+    const mrpt::maps::CPointsMap& pts, const mrpt::poses::CPose3D& sensorPose)
+{
+  const auto& xs = pts.getPointsBufferRef_x();
+  const auto& ys = pts.getPointsBufferRef_y();
+  const auto& zs = pts.getPointsBufferRef_z();
+  const size_t N = xs.size();
+  if (!N) return;
+
+  const uint32_t decim = std::max<uint32_t>(1, insertionOptions.decimation);
+  const double maxRangeSqr =
+      insertionOptions.max_range > 0 ? mrpt::square(insertionOptions.max_range) : -1.0;
+
+  // Worst case: every point claims a new voxel.
+  ensureExtraCapacity(N / decim + 1);
+
+  size_t nThreads = insertionOptions.num_threads > 0 ? insertionOptions.num_threads
+                                                     : std::thread::hardware_concurrency();
+  nThreads = std::max<size_t>(1, std::min(nThreads, 1 + N / 1024));
+
+  const auto R = sensorPose.getRotationMatrix();
+  const double m00 = R(0, 0), m01 = R(0, 1), m02 = R(0, 2), tx = sensorPose.x();
+  const double m10 = R(1, 0), m11 = R(1, 1), m12 = R(1, 2), ty = sensorPose.y();
+  const double m20 = R(2, 0), m21 = R(2, 1), m22 = R(2, 2), tz = sensorPose.z();
+
+  const auto integrateSector = [&](size_t idxStart, size_t idxEnd)
+  {
+    for (size_t i = idxStart; i < idxEnd; i += decim)
+    {
+      const double lx = xs[i], ly = ys[i], lz = zs[i];
+      if (maxRangeSqr > 0 && (lx * lx + ly * ly + lz * lz) > maxRangeSqr) continue;
+      const double gx = m00 * lx + m01 * ly + m02 * lz + tx;
+      const double gy = m10 * lx + m11 * ly + m12 * lz + ty;
+      const double gz = m20 * lx + m21 * ly + m22 * lz + tz;
+      accumulateHit(gx, gy, gz);
+    }
+  };
+
+  if (nThreads == 1)
+  {
+    integrateSector(0, N);
+    return;
+  }
+
+  if (!m_insertPool || m_insertPool->size() < nThreads)
+    m_insertPool = std::make_shared<mrpt::WorkerThreadsPool>(
+        nThreads, mrpt::WorkerThreadsPool::POLICY_FIFO, "CVoxelHashMap_insert");
+
+  std::vector<std::future<void>> futs;
+  futs.reserve(nThreads);
+  const size_t chunk = (N + nThreads - 1) / nThreads;
+  for (size_t t = 0; t < nThreads; t++)
+  {
+    const size_t idxStart = t * chunk;
+    const size_t idxEnd = std::min(N, idxStart + chunk);
+    if (idxStart >= idxEnd) break;
+    futs.emplace_back(
+        m_insertPool->enqueue([integrateSector, idxStart, idxEnd]()
+                              { integrateSector(idxStart, idxEnd); }));
+  }
+  for (auto& f : futs) f.get();
+}
+
+bool CVoxelHashMap::internal_insertObservation_Pts(
+    const mrpt::obs::CObservationPointCloud& obs,
+    const std::optional<const mrpt::poses::CPose3D>& robotPose)
+{
+  if (!obs.pointcloud || obs.pointcloud->empty()) return false;
+
+  mrpt::poses::CPose3D localSensorPose, globalSensorPose;
+  obs.getSensorPose(localSensorPose);
+  if (robotPose)
+    globalSensorPose = *robotPose + localSensorPose;
+  else
+    globalSensorPose = localSensorPose;
+
+  insertPointCloudParallel(*obs.pointcloud, globalSensorPose);
+  return true;
+}
+
+bool CVoxelHashMap::internal_insertObservation(
+    const mrpt::obs::CObservation& obs, const std::optional<const mrpt::poses::CPose3D>& robotPose)
+{
+  if (auto obsPts = dynamic_cast<const mrpt::obs::CObservationPointCloud*>(&obs); obsPts)
+  {
+    return internal_insertObservation_Pts(*obsPts, robotPose);
+  }
+
+  // Auxiliary 3D point cloud, already in global coordinates:
+  mrpt::maps::CSimplePointsMap pts;
+  pts.insertObservation(obs, robotPose);
+
+  if (pts.empty()) return false;
+
+  insertPointCloudParallel(pts, mrpt::poses::CPose3D::Identity());
+  return true;
+}
+
+double CVoxelHashMap::internal_computeObservationLikelihood(
+    const mrpt::obs::CObservation& obs, const mrpt::poses::CPose3D& takenFrom) const
+{
+  // build aux 3D pointcloud:
+  mrpt::maps::CSimplePointsMap pts;
+  pts.insertObservation(obs, takenFrom);
+
+  if (pts.empty()) return 0;
+
+  const double satInv = 1.0 / std::max(1, likelihoodOptions.saturation_hits);
+
+  double log_lik = .0;  // cummulative log likelihood
+  auto lambdaPointLikelihood = [&](float x, float y, float z)
+  {
+    const int32_t hits = voxelHits(x, y, z);
+    if (hits < likelihoodOptions.occupiedThreshold) return;
+    log_lik += std::min(1.0, hits * satInv);
+  };
+
+  const auto& xs = pts.getPointsBufferRef_x();
+  const auto& ys = pts.getPointsBufferRef_y();
+  const auto& zs = pts.getPointsBufferRef_z();
+
+  if (likelihoodOptions.decimate_up_to <= 1 || pts.size() <= likelihoodOptions.decimate_up_to)
+  {
+    for (size_t i = 0; i < pts.size(); ++i) lambdaPointLikelihood(xs[i], ys[i], zs[i]);
+  }
+  else
+  {
+    const double delta = static_cast<double>(pts.size()) / likelihoodOptions.decimate_up_to;
+    for (size_t i = 0; i < likelihoodOptions.decimate_up_to; ++i)
+    {
+      const auto idx = static_cast<size_t>(i * delta);
+      lambdaPointLikelihood(xs[idx], ys[idx], zs[idx]);
+    }
+  }
+
+  return log_lik;
+}
@@ -0,0 +1,103 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/io/CMemoryStream.h>
+#include <mrpt/maps/CSimplePointsMap.h>
+#include <mrpt/maps/CVoxelHashMap.h>
+#include <mrpt/obs/CObservationPointCloud.h>
+#include <mrpt/random.h>
+#include <mrpt/serialization/CArchive.h>
+
+namespace
+{
+mrpt::obs::CObservationPointCloud makeRandomCloudObs(size_t numPts)
+{
+  auto& rnd = mrpt::random::getRandomGenerator();
+  auto pts = mrpt::maps::CSimplePointsMap::Create();
+  for (size_t i = 0; i < numPts; i++)
+    pts->insertPoint(
+        rnd.drawUniform(-20.0, 20.0), rnd.drawUniform(-20.0, 20.0), rnd.drawUniform(-5.0, 5.0));
+
+  mrpt::obs::CObservationPointCloud obs;
+  obs.pointcloud = pts;
+  return obs;
+}
+}  // namespace
+
+TEST(CVoxelHashMap, basicOps)
+{
+  mrpt::maps::CVoxelHashMap m(0.5);
+  EXPECT_TRUE(m.isEmpty());
+
+  m.accumulateHit(1.0, 2.0, 3.0);
+  m.accumulateHit(1.1, 2.1, 3.1);  // same voxel at 0.5 m resolution
+  m.accumulateHit(-4.0, 0.0, 0.0);
+
+  EXPECT_FALSE(m.isEmpty());
+  EXPECT_EQ(m.voxelCount(), 2U);
+  EXPECT_EQ(m.voxelHits(1.05, 2.05, 3.05), 2);
+  EXPECT_EQ(m.voxelHits(-4.0, 0.0, 0.0), 1);
+  EXPECT_EQ(m.voxelHits(10.0, 10.0, 10.0), 0);
+
+  m.clear();
+  EXPECT_TRUE(m.isEmpty());
+}
+
+TEST(CVoxelHashMap, growth)
+{
+  mrpt::maps::CVoxelHashMap m(0.1, 64 /*tiny initial capacity*/);
+  // Insert far more distinct voxels than the initial capacity:
+  for (int i = 0; i < 1000; i++)
+  {
+    m.ensureExtraCapacity(1);
+    m.accumulateHit(i * 0.2, 0, 0);
+  }
+  EXPECT_EQ(m.voxelCount(), 1000U);
+  EXPECT_GE(m.capacity(), 2000U);
+}
+
+TEST(CVoxelHashMap, parallelVsSequentialInsertion)
+{
+  mrpt::random::getRandomGenerator().randomize(42);
+  const auto obs = makeRandomCloudObs(50000);
+
+  mrpt::maps::CVoxelHashMap mSeq(0.25), mPar(0.25);
+  mSeq.insertionOptions.num_threads = 1;
+  mPar.insertionOptions.num_threads = 4;
+
+  EXPECT_TRUE(mSeq.insertObservation(obs));
+  EXPECT_TRUE(mPar.insertObservation(obs));
+
+  EXPECT_EQ(mSeq.voxelCount(), mPar.voxelCount());
+
+  // Hit counters must match voxel by voxel:
+  mSeq.visitOccupiedVoxels([&](const mrpt::math::TPoint3D& pt, int32_t hits)
+                           { EXPECT_EQ(mPar.voxelHits(pt.x, pt.y, pt.z), hits); });
+}
+
+TEST(CVoxelHashMap, serializationRoundtrip)
+{
+  mrpt::random::getRandomGenerator().randomize(7);
+  const auto obs = makeRandomCloudObs(5000);
+
+  mrpt::maps::CVoxelHashMap m1(0.25);
+  EXPECT_TRUE(m1.insertObservation(obs));
+
+  mrpt::io::CMemoryStream buf;
+  auto arch = mrpt::serialization::archiveFrom(buf);
+  arch << m1;
+  buf.Seek(0);
+
+  mrpt::maps::CVoxelHashMap m2;
+  arch >> m2;
+
+  EXPECT_EQ(m1.voxelCount(), m2.voxelCount());
+  m1.visitOccupiedVoxels([&](const mrpt::math::TPoint3D& pt, int32_t hits)
+                         { EXPECT_EQ(m2.voxelHits(pt.x, pt.y, pt.z), hits); });
+}
@@ -16,6 +16,10 @@
 
 #include <mrpt/maps/bonxai/serialization.hpp>
 
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
 using namespace mrpt::maps;
 using namespace std::string_literals;  // "..."s
 
@@ -146,42 +150,96 @@ bool CVoxelMapRGB::internal_insertObservation_3DScan(
     sensorPt = localSensorPose.translation();
   }
 
+  auto& grid = base_t::m_impl->grid;
+  using grid_t = std::decay_t<decltype(grid)>;
+
+  // 1) Project all (decimated, in-range) points into voxel coordinates and
+  // group them by the Bonxai inner grid (block) they fall into. Blocks are
+  // disjoint subtrees, so they can be updated by parallel workers without
+  // touching any shared state:
+  struct TPendingUpdate
+  {
+    Bonxai::CoordT coord;
+    float R, G, B;
+  };
+  std::unordered_map<Bonxai::CoordT, std::vector<TPendingUpdate>> blocks;
+
   for (size_t i = 0; i < xs.size(); i += insertionOptions.decimation)
   {
     if (insertionOptions.max_range > 0 &&
         (mrpt::math::TPoint3D(xs[i], ys[i], zs[i]) - sensorPt).sqrNorm() > maxSqrDist)
       continue;  // skip
 
-    voxel_node_t* cell = base_t::m_impl->accessor.value(
-        Bonxai::PosToCoord({xs[i], ys[i], zs[i]}, base_t::m_impl->grid.inv_resolution),
-        true /*create*/);
-    if (!cell) continue;  // should never happen?
-
-    // Update occupancy:
-    updateCell_fast_occupied(cell, logodd_observation_occupied, logodd_thres_occupied);
-
-    // and merge color:
-    mrpt::img::TColorf colF;
-    colPts.getPointColor(i, colF.R, colF.G, colF.B);
-#if 1  // fuse colors:
-    mrpt::img::TColorf oldCol(mrpt::img::TColor(cell->color.R, cell->color.G, cell->color.B));
-
-    mrpt::img::TColorf newF;
-    const float N_1 = 1.0f / (cell->numColObs + 1);
-
-    newF.R = N_1 * (oldCol.R * cell->numColObs + colF.R);
-    newF.G = N_1 * (oldCol.G * cell->numColObs + colF.G);
-    newF.B = N_1 * (oldCol.B * cell->numColObs + colF.B);
-
-    cell->numColObs++;
-    const auto nCol = newF.asTColor();
-    cell->color.R = nCol.R;
-    cell->color.G = nCol.G;
-    cell->color.B = nCol.B;
-#else
-    // just copy latest color:
-    cell->color = colF.asTColor();
-#endif
+    TPendingUpdate u;
+    u.coord = Bonxai::PosToCoord({xs[i], ys[i], zs[i]}, grid.inv_resolution);
+    colPts.getPointColor(i, u.R, u.G, u.B);
+    blocks[grid.getRootKey(u.coord)].emplace_back(u);
+  }
+  if (blocks.empty()) return true;
+
+  // 2) Make sure the inner grid of each block already exists, so the workers
+  // below never have to modify the (shared) root map:
+  std::vector<std::vector<TPendingUpdate>*> blockList;
+  blockList.reserve(blocks.size());
+  for (auto& [rootKey, upds] : blocks)
+  {
+    if (grid.root_map.find(rootKey) == grid.root_map.end())
+      grid.root_map.insert({rootKey, typename grid_t::InnerGrid(grid.INNER_BITS)});
+    blockList.push_back(&upds);
+  }
+
+  // 3) Per-block voxel updates: fused occupancy + color running average.
+  // Each worker uses its own accessor, and only ever creates leaf grids
+  // inside the blocks it owns:
+  auto process_block = [&](const std::vector<TPendingUpdate>& upds, grid_t::Accessor& accessor)
+  {
+    for (const auto& u : upds)
+    {
+      voxel_node_t* cell = accessor.value(u.coord, true /*create*/);
+      if (!cell) continue;  // should never happen?
+
+      // Update occupancy:
+      updateCell_fast_occupied(cell, logodd_observation_occupied, logodd_thres_occupied);
+
+      // and merge color (same math than the former TColorf-based code, but
+      // kept scalar & branchless so the compiler can vectorize it):
+      const float n = static_cast<float>(cell->numColObs);
+      const float N_1 = 1.0f / (n + 1);
+
+      const float newR = N_1 * (mrpt::u8tof(cell->color.R) * n + u.R);
+      const float newG = N_1 * (mrpt::u8tof(cell->color.G) * n + u.G);
+      const float newB = N_1 * (mrpt::u8tof(cell->color.B) * n + u.B);
+
+      cell->numColObs++;
+      cell->color.R = mrpt::f2u8(newR);
+      cell->color.G = mrpt::f2u8(newG);
+      cell->color.B = mrpt::f2u8(newB);
+    }
+  };
+
+  const size_t nThreads =
+      std::min<size_t>(std::max(1U, std::thread::hardware_concurrency()), blockList.size());
+
+  if (nThreads <= 1)
+  {
+    auto accessor = grid.createAccessor();
+    for (const auto* upds : blockList) process_block(*upds, accessor);
+  }
+  else
+  {
+    std::vector<std::thread> workers;
+    workers.reserve(nThreads);
+    for (size_t t = 0; t < nThreads; t++)
+    {
+      workers.emplace_back(
+          [&, t]()
+          {
+            auto accessor = grid.createAccessor();
+            for (size_t b = t; b < blockList.size(); b += nThreads)
+              process_block(*blockList[b], accessor);
+          });
+    }
+    for (auto& w : workers) w.join();
   }
 
   return true;
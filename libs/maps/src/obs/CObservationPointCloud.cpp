@@ -13,9 +13,13 @@
 #include <mrpt/core/lock_helper.h>
 #include <mrpt/io/CFileGZInputStream.h>
 #include <mrpt/io/CFileGZOutputStream.h>
+#include <mrpt/io/CFileInputStream.h>
+#include <mrpt/io/CFileOutputStream.h>
 #include <mrpt/io/lazy_load_path.h>
+#include <mrpt/io/zip.h>
 #include <mrpt/maps/CColouredPointsMap.h>
 #include <mrpt/maps/CPointsMapXYZI.h>
+#include <mrpt/maps/CPointsMapXYZIRT.h>
 #include <mrpt/maps/CSimplePointsMap.h>
 #include <mrpt/math/ops_containers.h>  // minimum_maximum()
 #include <mrpt/obs/CObservation3DRangeScan.h>
@@ -36,6 +40,20 @@ CObservationPointCloud::CObservationPointCloud(const CObservation3DRangeScan& o)
   pointcloud->loadFromRangeScan(o);
 }
 
+CObservationPointCloud::Ptr CObservationPointCloud::fromXYZBuffers(
+    mrpt::aligned_std_vector<float>&& xs,
+    mrpt::aligned_std_vector<float>&& ys,
+    mrpt::aligned_std_vector<float>&& zs,
+    const mrpt::poses::CPose3D& sensorPoseOnRobot)
+{
+  auto obs = CObservationPointCloud::Create();
+  auto pts = mrpt::maps::CSimplePointsMap::Create();
+  pts->setFromXYZBuffers(std::move(xs), std::move(ys), std::move(zs));
+  obs->pointcloud = pts;
+  obs->sensorPose = sensorPoseOnRobot;
+  return obs;
+}
+
 void CObservationPointCloud::getSensorPose(mrpt::poses::CPose3D& out_sensorPose) const
 {
   out_sensorPose = sensorPose;
@@ -133,6 +151,190 @@ void CObservationPointCloud::serializeFrom(mrpt::serialization::CArchive& in, ui
   };
 }
 
+namespace
+{
+// On-disk layout of ExternalStorageFormat::ColumnarFile:
+//   uint32_t magic, uint8_t version, uint64_t nPoints, uint8_t nCols,
+//   directory: nCols x {uint8_t colId, uint8_t elemSize,
+//                       uint64_t rawBytes, uint64_t compressedBytes},
+//   then one zlib-compressed block per column, in directory order.
+// Blocks hold the raw little-endian column buffers, so with the directory at
+// hand a reader can seek past the blocks of any column it does not need.
+constexpr uint32_t COLUMNAR_FILE_MAGIC = 0x31435043;  // "CPC1"
+constexpr uint8_t COLUMNAR_FILE_VERSION = 0;
+
+// Column ids: also the bit index of CObservationPointCloud::ColumnBits.
+enum : uint8_t
+{
+  COL_ID_X = 0,
+  COL_ID_Y,
+  COL_ID_Z,
+  COL_ID_INTENSITY,
+  COL_ID_RING,
+  COL_ID_TIMESTAMP
+};
+
+void columnarSave(const std::string& fileName, const mrpt::maps::CPointsMap& pts)
+{
+  const size_t n = pts.size();
+
+  struct ColumnToWrite
+  {
+    uint8_t id, elemSize;
+    const void* data;
+  };
+  std::vector<ColumnToWrite> cols = {
+      {COL_ID_X, sizeof(float), pts.getPointsBufferRef_x().data()},
+      {COL_ID_Y, sizeof(float), pts.getPointsBufferRef_y().data()},
+      {COL_ID_Z, sizeof(float), pts.getPointsBufferRef_z().data()},
+  };
+  if (auto* Is = pts.getPointsBufferRef_intensity(); Is && !Is->empty())
+  {
+    ASSERT_EQUAL_(Is->size(), n);
+    cols.push_back({COL_ID_INTENSITY, sizeof(float), Is->data()});
+  }
+  if (auto* Rs = pts.getPointsBufferRef_ring(); Rs && !Rs->empty())
+  {
+    ASSERT_EQUAL_(Rs->size(), n);
+    cols.push_back({COL_ID_RING, sizeof(uint16_t), Rs->data()});
+  }
+  if (auto* Ts = pts.getPointsBufferRef_timestamp(); Ts && !Ts->empty())
+  {
+    ASSERT_EQUAL_(Ts->size(), n);
+    cols.push_back({COL_ID_TIMESTAMP, sizeof(float), Ts->data()});
+  }
+
+  std::vector<std::vector<unsigned char>> blocks(cols.size());
+  for (size_t i = 0; i < cols.size(); i++)
+    if (n != 0)
+      mrpt::io::zip::compress(const_cast<void*>(cols[i].data), n * cols[i].elemSize, blocks[i]);
+
+  mrpt::io::CFileOutputStream f(fileName);
+  auto ar = mrpt::serialization::archiveFrom(f);
+  ar << COLUMNAR_FILE_MAGIC;
+  ar.WriteAs<uint8_t>(COLUMNAR_FILE_VERSION);
+  ar.WriteAs<uint64_t>(n);
+  ar.WriteAs<uint8_t>(cols.size());
+  for (size_t i = 0; i < cols.size(); i++)
+  {
+    ar.WriteAs<uint8_t>(cols[i].id);
+    ar.WriteAs<uint8_t>(cols[i].elemSize);
+    ar.WriteAs<uint64_t>(n * cols[i].elemSize);
+    ar.WriteAs<uint64_t>(blocks[i].size());
+  }
+  for (const auto& b : blocks)
+    if (!b.empty()) ar.WriteBuffer(b.data(), b.size());
+}
+
+mrpt::maps::CPointsMap::Ptr columnarLoad(const std::string& fileName, const uint8_t columnsMask)
+{
+  mrpt::io::CFileInputStream f(fileName);
+  auto ar = mrpt::serialization::archiveFrom(f);
+
+  uint32_t magic = 0;
+  ar >> magic;
+  ASSERTMSG_(
+      magic == COLUMNAR_FILE_MAGIC,
+      mrpt::format("Not a columnar point cloud file: '%s'", fileName.c_str()));
+  const auto version = ar.ReadAs<uint8_t>();
+  ASSERTMSG_(
+      version == COLUMNAR_FILE_VERSION,
+      mrpt::format("Unsupported columnar file version: %u", static_cast<unsigned>(version)));
+  const auto n = static_cast<size_t>(ar.ReadAs<uint64_t>());
+  const auto nCols = ar.ReadAs<uint8_t>();
+
+  struct DirEntry
+  {
+    uint8_t id = 0, elemSize = 0;
+    uint64_t rawBytes = 0, compBytes = 0;
+  };
+  std::vector<DirEntry> dir(nCols);
+  for (auto& d : dir)
+  {
+    d.id = ar.ReadAs<uint8_t>();
+    d.elemSize = ar.ReadAs<uint8_t>();
+    d.rawBytes = ar.ReadAs<uint64_t>();
+    d.compBytes = ar.ReadAs<uint64_t>();
+  }
+
+  const auto selected = [columnsMask](uint8_t id) { return (columnsMask & (1u << id)) != 0; };
+
+  bool hasI = false, hasR = false, hasT = false;
+  for (const auto& d : dir)
+  {
+    if (!selected(d.id)) continue;
+    if (d.id == COL_ID_INTENSITY) hasI = true;
+    if (d.id == COL_ID_RING) hasR = true;
+    if (d.id == COL_ID_TIMESTAMP) hasT = true;
+  }
+
+  auto pts = mrpt::maps::CPointsMapXYZIRT::Create();
+  pts->resize_XYZIRT(n, hasI, hasR, hasT);
+
+  mrpt::aligned_std_vector<float> xs, ys, zs;
+  std::vector<unsigned char> comp;
+
+  const auto readBlockInto = [&](const DirEntry& d, size_t dstElemSize, void* dst)
+  {
+    ASSERT_EQUAL_(d.elemSize, dstElemSize);
+    ASSERT_EQUAL_(static_cast<size_t>(d.rawBytes), n * d.elemSize);
+    if (!d.rawBytes)
+    {
+      ASSERT_EQUAL_(d.compBytes, 0U);
+      return;
+    }
+    comp.resize(d.compBytes);
+    ar.ReadBuffer(comp.data(), comp.size());
+    const size_t outLen = mrpt::io::zip::decompress(comp.data(), comp.size(), dst, d.rawBytes);
+    ASSERT_EQUAL_(outLen, static_cast<size_t>(d.rawBytes));
+  };
+
+  for (const auto& d : dir)
+  {
+    // Columns not selected (or unknown to this version) are seeked over,
+    // which is where the playback I/O savings come from:
+    if (!selected(d.id) || d.id > COL_ID_TIMESTAMP)
+    {
+      f.Seek(d.compBytes, mrpt::io::CStream::sFromCurrent);
+      continue;
+    }
+    switch (d.id)
+    {
+      case COL_ID_X:
+        xs.resize(n);
+        readBlockInto(d, sizeof(float), xs.data());
+        break;
+      case COL_ID_Y:
+        ys.resize(n);
+        readBlockInto(d, sizeof(float), ys.data());
+        break;
+      case COL_ID_Z:
+        zs.resize(n);
+        readBlockInto(d, sizeof(float), zs.data());
+        break;
+      case COL_ID_INTENSITY:
+        readBlockInto(d, sizeof(float), pts->getPointsBufferRef_intensity()->data());
+        break;
+      case COL_ID_RING:
+        readBlockInto(d, sizeof(uint16_t), pts->getPointsBufferRef_ring()->data());
+        break;
+      case COL_ID_TIMESTAMP:
+        readBlockInto(d, sizeof(float), pts->getPointsBufferRef_timestamp()->data());
+        break;
+    };
+  }
+
+  // Deselected x/y/z columns are zero-filled (from the resize above), so the
+  // point count is preserved:
+  if (!xs.empty() || !ys.empty() || !zs.empty())
+    for (size_t i = 0; i < n; i++)
+      pts->setPointFast(
+          i, xs.empty() ? .0f : xs[i], ys.empty() ? .0f : ys[i], zs.empty() ? .0f : zs[i]);
+
+  return pts;
+}
+}  // namespace
+
 void CObservationPointCloud::load_impl() const
 {
   MRPT_START
@@ -223,6 +425,12 @@ void CObservationPointCloud::load_impl() const
                           abs_filename.c_str()));
     }
     break;
+    case ExternalStorageFormat::ColumnarFile:
+    {
+      const_cast<mrpt::maps::CPointsMap::Ptr&>(pointcloud) =
+          columnarLoad(abs_filename, m_lazy_load_columns);
+    }
+    break;
   };
 
   MRPT_END
@@ -272,6 +480,11 @@ void CObservationPointCloud::unload() const
         ar << *pointcloud;
       }
       break;
+      case ExternalStorageFormat::ColumnarFile:
+      {
+        columnarSave(abs_filename, *pointcloud);
+      }
+      break;
     };
   }
 
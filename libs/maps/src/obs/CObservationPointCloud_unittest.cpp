@@ -0,0 +1,118 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/maps/CPointsMapXYZIRT.h>
+#include <mrpt/obs/CObservationPointCloud.h>
+#include <mrpt/system/filesystem.h>
+
+using namespace mrpt::obs;
+
+namespace
+{
+mrpt::maps::CPointsMapXYZIRT::Ptr buildTestCloud(const size_t n)
+{
+  auto pts = mrpt::maps::CPointsMapXYZIRT::Create();
+  pts->resize_XYZIRT(n, true /*I*/, true /*R*/, true /*T*/);
+  for (size_t i = 0; i < n; i++)
+  {
+    pts->setPointFast(i, 0.1f * i, -0.2f * i, 1.0f + 0.01f * i);
+    (*pts->getPointsBufferRef_intensity())[i] = (i % 256) / 255.0f;
+    (*pts->getPointsBufferRef_ring())[i] = static_cast<uint16_t>(i % 32);
+    (*pts->getPointsBufferRef_timestamp())[i] = 1e-4f * i;
+  }
+  return pts;
+}
+}  // namespace
+
+TEST(CObservationPointCloud, columnarFileRoundTrip)
+{
+  const size_t N = 200;
+  const auto tmpFile = mrpt::system::getTempFileName() + ".cols";
+
+  CObservationPointCloud obs;
+  obs.pointcloud = buildTestCloud(N);
+  obs.setAsExternalStorage(tmpFile, CObservationPointCloud::ExternalStorageFormat::ColumnarFile);
+
+  // unload() must write the file and free the in-memory cloud:
+  obs.unload();
+  EXPECT_FALSE(obs.pointcloud);
+  ASSERT_TRUE(mrpt::system::fileExists(tmpFile));
+
+  // Full reload: all channels must round-trip:
+  obs.load();
+  ASSERT_TRUE(obs.pointcloud);
+  auto pts = std::dynamic_pointer_cast<mrpt::maps::CPointsMapXYZIRT>(obs.pointcloud);
+  ASSERT_TRUE(pts);
+  ASSERT_EQ(pts->size(), N);
+  EXPECT_TRUE(pts->hasIntensityField());
+  EXPECT_TRUE(pts->hasRingField());
+  EXPECT_TRUE(pts->hasTimeField());
+
+  const auto groundTruth = buildTestCloud(N);
+  for (size_t i = 0; i < N; i += 13)
+  {
+    EXPECT_EQ(pts->getPointsBufferRef_x()[i], groundTruth->getPointsBufferRef_x()[i]) << "i=" << i;
+    EXPECT_EQ(pts->getPointsBufferRef_y()[i], groundTruth->getPointsBufferRef_y()[i]) << "i=" << i;
+    EXPECT_EQ(pts->getPointsBufferRef_z()[i], groundTruth->getPointsBufferRef_z()[i]) << "i=" << i;
+    EXPECT_EQ(
+        (*pts->getPointsBufferRef_intensity())[i],
+        (*groundTruth->getPointsBufferRef_intensity())[i])
+        << "i=" << i;
+    EXPECT_EQ((*pts->getPointsBufferRef_ring())[i], (*groundTruth->getPointsBufferRef_ring())[i])
+        << "i=" << i;
+    EXPECT_EQ(
+        (*pts->getPointsBufferRef_timestamp())[i], (*groundTruth->getPointsBufferRef_timestamp())[i])
+        << "i=" << i;
+  }
+
+  mrpt::system::deleteFile(tmpFile);
+}
+
+TEST(CObservationPointCloud, columnarFileSelectiveColumns)
+{
+  const size_t N = 150;
+  const auto tmpFile = mrpt::system::getTempFileName() + ".cols";
+
+  CObservationPointCloud obs;
+  obs.pointcloud = buildTestCloud(N);
+  obs.setAsExternalStorage(tmpFile, CObservationPointCloud::ExternalStorageFormat::ColumnarFile);
+  obs.unload();
+  ASSERT_TRUE(mrpt::system::fileExists(tmpFile));
+
+  // Analytics-style playback: only XY + intensity:
+  obs.setLazyLoadColumns(
+      CObservationPointCloud::COLUMN_X | CObservationPointCloud::COLUMN_Y |
+      CObservationPointCloud::COLUMN_INTENSITY);
+  obs.load();
+  ASSERT_TRUE(obs.pointcloud);
+  auto pts = std::dynamic_pointer_cast<mrpt::maps::CPointsMapXYZIRT>(obs.pointcloud);
+  ASSERT_TRUE(pts);
+
+  // Point count is preserved, deselected z is zero-filled, and the
+  // deselected ring/time channels are left empty:
+  ASSERT_EQ(pts->size(), N);
+  EXPECT_TRUE(pts->hasIntensityField());
+  EXPECT_FALSE(pts->hasRingField());
+  EXPECT_FALSE(pts->hasTimeField());
+
+  const auto groundTruth = buildTestCloud(N);
+  for (size_t i = 0; i < N; i += 7)
+  {
+    EXPECT_EQ(pts->getPointsBufferRef_x()[i], groundTruth->getPointsBufferRef_x()[i]) << "i=" << i;
+    EXPECT_EQ(pts->getPointsBufferRef_y()[i], groundTruth->getPointsBufferRef_y()[i]) << "i=" << i;
+    EXPECT_EQ(pts->getPointsBufferRef_z()[i], .0f) << "i=" << i;
+    EXPECT_EQ(
+        (*pts->getPointsBufferRef_intensity())[i],
+        (*groundTruth->getPointsBufferRef_intensity())[i])
+        << "i=" << i;
+  }
+
+  mrpt::system::deleteFile(tmpFile);
+}
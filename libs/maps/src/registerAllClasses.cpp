@@ -46,6 +46,7 @@ MRPT_INITIALIZER(registerAllClasses_mrpt_maps)
   registerClass(CLASS_ID(COctoMap));
   registerClass(CLASS_ID(CColouredOctoMap));
 
+  registerClass(CLASS_ID(CVoxelHashMap));
   registerClass(CLASS_ID(CVoxelMap));
   registerClass(CLASS_ID(CVoxelMapRGB));
 
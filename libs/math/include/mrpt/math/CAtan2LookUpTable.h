@@ -10,7 +10,11 @@
 
 #include <mrpt/containers/CDynamicGrid.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <map>
+#include <vector>
 
 namespace mrpt::math
 {
@@ -49,6 +53,12 @@ class CAtan2LookUpTable
     return true;
   }
 
+  /** Batch version of atan2() for whole arrays, as consumed by the grid-map
+   * likelihood loops: queries outside the grid bounds fall back to
+   * std::atan2(), so every output is always valid.
+   * \note [New in MRPT 2.14.5] */
+  void atan2Many(size_t n, const double* ys, const double* xs, double* outs) const noexcept;
+
   [[nodiscard]] double getXMin() const { return m_grid.getXMin(); }
   [[nodiscard]] double getXMax() const { return m_grid.getXMax(); }
   [[nodiscard]] double getYMin() const { return m_grid.getYMin(); }
@@ -87,12 +97,48 @@ class CAtan2LookUpTableMultiRes
 
   /** Returns the precomputed value for atan2(y,x). \return false if out of
    * grid bounds. */
-  [[nodiscard]] bool atan2(double y, double x, double& out_atan2) const noexcept;
+  [[nodiscard]] bool atan2(double y, double x, double& out_atan2) const noexcept
+  {
+    const double m = std::max(std::abs(x), std::abs(y));
+    for (const auto& lvl : m_levels)
+    {
+      if (m > lvl.extension) continue;
+      out_atan2 = lvl.lookup(y, x);
+      return true;
+    }
+    return false;
+  }
+
+  /** Batch version of atan2() for whole arrays, as consumed by the grid-map
+   * likelihood loops: queries beyond the largest extension fall back to
+   * std::atan2(), so every output is always valid.
+   * \note [New in MRPT 2.14.5] */
+  void atan2Many(size_t n, const double* ys, const double* xs, double* outs) const noexcept;
 
  private:
-  /** Maps from maximum (X,Y) coordinates to LUT for [-L,L]x[-L,L] square
-   * area. */
-  std::map<double, mrpt::containers::CDynamicGrid<double>> m_grids;
+  /** One resolution level: a flat, row-major LUT for the [-L,L]x[-L,L]
+   * square area, with the geometry cached so a lookup is just a clamped
+   * (branchless) index computation - the per-query std::map and
+   * CDynamicGrid overheads used to dominate; see perf-atan2lut.cpp.
+   * Levels are kept sorted by ascending extension. */
+  struct TLevel
+  {
+    double extension = 0;
+    double x_min = 0, y_min = 0;
+    double invRes = 0;
+    int32_t sizeX = 0, sizeY = 0;
+    std::vector<double> tab;
+
+    [[nodiscard]] double lookup(double y, double x) const noexcept
+    {
+      const auto ix = std::min<int32_t>(
+          sizeX - 1, std::max<int32_t>(0, static_cast<int32_t>((x - x_min) * invRes)));
+      const auto iy = std::min<int32_t>(
+          sizeY - 1, std::max<int32_t>(0, static_cast<int32_t>((y - y_min) * invRes)));
+      return tab[iy * sizeX + ix];
+    }
+  };
+  std::vector<TLevel> m_levels;
 };
 
 }  // namespace mrpt::math
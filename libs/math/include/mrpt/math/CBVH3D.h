@@ -0,0 +1,134 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+#pragma once
+
+#include <mrpt/math/TBoundingBox.h>
+#include <mrpt/math/TLine3D.h>
+#include <mrpt/math/TObject3D.h>
+#include <mrpt/math/TSegment3D.h>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace mrpt::math
+{
+/** A bounding-volume hierarchy (BVH) over a collection of TObject3D
+ * primitives, accelerating segment/ray intersection queries that would
+ * otherwise require testing every primitive with the pairwise
+ * mrpt::math::intersect() functions (O(N) per query -> O(log N) for
+ * well-distributed scenes).
+ *
+ * Bounded primitives (points, segments, polygons) are organized into a
+ * binary tree of axis-aligned boxes, built by median splits along the axis
+ * of largest centroid extent. Unbounded primitives (lines, planes) cannot be
+ * enclosed in a finite box, so they are kept in a side list which every
+ * query tests exactly.
+ *
+ * Candidate primitives surviving the box tests are confirmed with the exact
+ * pairwise mrpt::math::intersect(), so results match a brute-force loop over
+ * all primitives.
+ *
+ * \note [New in MRPT 2.14.5]
+ * \sa mrpt::math::intersect, TBoundingBox
+ * \ingroup geometry_grp
+ */
+class CBVH3D
+{
+ public:
+  CBVH3D() = default;
+
+  /** Builds the hierarchy over the given primitives. \sa build */
+  explicit CBVH3D(const std::vector<TObject3D>& objects) { build(objects); }
+
+  /** (Re)builds the hierarchy over a copy of the given primitives. Empty
+   * objects (monostate) are ignored. */
+  void build(const std::vector<TObject3D>& objects);
+
+  /** Number of primitives the structure was built over. */
+  size_t size() const { return m_objects.size(); }
+
+  /** The primitives, as passed to build(). */
+  const std::vector<TObject3D>& objects() const { return m_objects; }
+
+  /** Bounding box of all bounded primitives (undefined if none). */
+  const TBoundingBox& boundingBox() const { return m_rootBBox; }
+
+  /** Tests the segment against the hierarchy, returning as soon as any
+   * intersecting primitive is found.
+   * \param out_intersection The intersection object (point, segment, ...),
+   * as returned by the pairwise mrpt::math::intersect().
+   * \param out_objectIndex If not nullptr, the index of the hit primitive in
+   * objects().
+   * \return true if some primitive intersects the segment.
+   */
+  bool intersectsAny(
+      const TSegment3D& query,
+      TObject3D& out_intersection,
+      size_t* out_objectIndex = nullptr) const;
+
+  /** \overload For an (infinite) line query. */
+  bool intersectsAny(
+      const TLine3D& query, TObject3D& out_intersection, size_t* out_objectIndex = nullptr) const;
+
+  /** Collects all the primitives intersecting the segment, as pairs of
+   * (index in objects(), intersection object). */
+  void intersectionsWith(
+      const TSegment3D& query, std::vector<std::pair<size_t, TObject3D>>& out) const;
+
+  /** Batched version of intersectsAny() for many query segments:
+   * out_intersections is resized to queries.size(), with out_intersections[i]
+   * empty() if queries[i] hits nothing. */
+  void intersectMany(
+      const std::vector<TSegment3D>& queries, std::vector<TObject3D>& out_intersections) const;
+
+ private:
+  struct TNode
+  {
+    TBoundingBox bbox = TBoundingBox::PlusMinusInfinity();
+    /** Children node indices, or -1 for leaves */
+    int32_t left = -1, right = -1;
+    /** Leaf range [begin,end) into m_leafObjectIndices */
+    uint32_t begin = 0, end = 0;
+  };
+
+  /** Recursive builder over m_leafObjectIndices[first,last); returns the new
+   * node index. */
+  int32_t buildNode(std::vector<TBoundingBox>& bboxes, size_t first, size_t last);
+
+  /** Walks the tree gathering the leaf primitives whose box is hit by the
+   * ray org+t*dir, t in [tMin,tMax]. */
+  void gatherCandidates(
+      const TPoint3D& org,
+      const TPoint3D& dir,
+      double tMin,
+      double tMax,
+      std::vector<size_t>& out_candidates) const;
+
+  /** Shared implementation of both intersectsAny() overloads. */
+  bool internal_intersectsAny(
+      const TObject3D& queryObj,
+      const TPoint3D& org,
+      const TPoint3D& dir,
+      double tMin,
+      double tMax,
+      TObject3D& out_intersection,
+      size_t* out_objectIndex) const;
+
+  std::vector<TObject3D> m_objects;
+  std::vector<TNode> m_nodes;
+  /** Indices into m_objects of bounded primitives, reordered by the build */
+  std::vector<uint32_t> m_leafObjectIndices;
+  /** Indices into m_objects of unbounded primitives (lines, planes) */
+  std::vector<uint32_t> m_unboundedObjectIndices;
+  TBoundingBox m_rootBBox = TBoundingBox::PlusMinusInfinity();
+  int32_t m_rootNode = -1;
+};
+
+}  // namespace mrpt::math
@@ -9,12 +9,14 @@
 #pragma once
 
 #include <mrpt/containers/printf_vector.h>
+#include <mrpt/core/constexpr_for.h>
 #include <mrpt/math/CMatrixDynamic.h>
 #include <mrpt/math/CVectorDynamic.h>
 #include <mrpt/math/num_jacobian.h>
 #include <mrpt/math/ops_containers.h>
 #include <mrpt/system/COutputLogger.h>
 
+#include <cmath>
 #include <functional>
 
 namespace mrpt::math
@@ -24,6 +26,12 @@ namespace mrpt::math
  *
  * Refer to: \ref tutorial_math_levenberg_marquardt
  *
+ * Solver instances own their Jacobian/Hessian workspaces, which are sized on
+ * the first call to execute() and reused afterwards: keep one object alive
+ * across repeated small solves (e.g. per-frame calibration refinements) to
+ * avoid per-call heap allocations. Problems with 8 or fewer parameters are
+ * additionally solved with fixed-size linear algebra.
+ *
  * \tparam VECTORTYPE The type for input/output vectors
  * \tparam USERPARAM The type of the additional constant parameters input to the
  * user supplied evaluation functor. Default type is a vector of NUMTYPE.
@@ -61,6 +69,16 @@ class CLevenbergMarquardtTempl : public mrpt::system::COutputLogger
       const VECTORTYPE& x_incr,
       const USERPARAM& user_param)>;
 
+  /** The type of an optional functor passed to \a execute providing the
+   * analytic Jacobian of the error vector wrt the parameters, evaluated in
+   * one batch call (one row per error dimension, one column per parameter).
+   * When given, it replaces the one-parameter-at-a-time finite-difference
+   * approximation.
+   * \note [New in MRPT 2.14.5]
+   */
+  using TFunctorJacobian =
+      std::function<void(const VECTORTYPE& x, const USERPARAM& y, matrix_t& out_jacobian)>;
+
   struct TResultInfo
   {
     NUMTYPE final_sqr_err = 0, initial_sqr_err = 0;
@@ -93,6 +111,11 @@ class CLevenbergMarquardtTempl : public mrpt::system::COutputLogger
    *optimizer by
    *     any other operation. It can be used for example, in on-manifold
    *optimizations.
+   *
+   * \a jacobian_functor Optionally provides the analytic Jacobian of the
+   *error vector wrt \a x, evaluated in one batch call. If not given
+   *(default), the Jacobian is approximated with central finite differences of
+   *sizes \a increments, one parameter at a time. \note [New in MRPT 2.14.5]
    */
   void execute(
       VECTORTYPE& out_optimal_x,
@@ -107,7 +130,8 @@ class CLevenbergMarquardtTempl : public mrpt::system::COutputLogger
       const NUMTYPE e1 = 1e-8,
       const NUMTYPE e2 = 1e-8,
       bool returnPath = true,
-      TFunctorIncrement x_increment_adder = nullptr)
+      TFunctorIncrement x_increment_adder = nullptr,
+      TFunctorJacobian jacobian_functor = nullptr)
   {
     using namespace mrpt;
     using namespace mrpt::math;
@@ -119,39 +143,42 @@ class CLevenbergMarquardtTempl : public mrpt::system::COutputLogger
 
     VECTORTYPE& x = out_optimal_x;  // Var rename
 
-    // Asserts:
-    ASSERT_(increments.size() == x0.size());
+    // Asserts: (increments are only used by the finite-difference Jacobian)
+    if (!jacobian_functor) ASSERT_(increments.size() == x0.size());
 
-    x = x0;          // Start with the starting point
-    VECTORTYPE f_x;  // The vector error from the user function
-    matrix_t AUX;
-    matrix_t J;    // The Jacobian of "f"
-    VECTORTYPE g;  // The gradient
+    x = x0;  // Start with the starting point
+
+    // Evaluates the Jacobian of "f" into the m_J workspace:
+    const auto evalJacobian = [&](const VECTORTYPE& at_x)
+    {
+      if (jacobian_functor) jacobian_functor(at_x, userParam, m_J);
+      else
+        mrpt::math::estimateJacobian(at_x, functor, increments, userParam, m_J);
+    };
 
     // Compute the jacobian and the Hessian:
-    mrpt::math::estimateJacobian(x, functor, increments, userParam, J);
-    out_info.H.matProductOf_AtA(J);
+    evalJacobian(x);
+    out_info.H.matProductOf_AtA(m_J);
 
     const size_t H_len = out_info.H.cols();
 
     // Compute the gradient:
-    functor(x, userParam, f_x);
+    functor(x, userParam, m_f_x);
     // g <- J' * f_x
-    g.matProductOf_Atb(J, f_x);
+    m_g.matProductOf_Atb(m_J, m_f_x);
 
     // Start iterations:
-    bool found = math::norm_inf(g) <= e1;
+    bool found = math::norm_inf(m_g) <= e1;
     if (found)
       logFmt(
-          mrpt::system::LVL_INFO, "End condition: math::norm_inf(g)<=e1 :%f\n", math::norm_inf(g));
+          mrpt::system::LVL_INFO, "End condition: math::norm_inf(g)<=e1 :%f\n",
+          math::norm_inf(m_g));
 
     NUMTYPE lambda = tau * out_info.H.maximumDiagonal();
     size_t iter = 0;
     NUMTYPE v = 2;
 
-    VECTORTYPE h_lm;
-    VECTORTYPE xnew, f_xnew;
-    NUMTYPE F_x = pow(math::norm(f_x), 2);
+    NUMTYPE F_x = pow(math::norm(m_f_x), 2);
     out_info.initial_sqr_err = F_x;
 
     const size_t N = x.size();
@@ -166,16 +193,33 @@ class CLevenbergMarquardtTempl : public mrpt::system::COutputLogger
 
     while (!found && ++iter < maxIter)
     {
-      // H_lm = -( H + \lambda I ) ^-1 * g
-      matrix_t H = out_info.H;
-      for (size_t k = 0; k < H_len; k++) H(k, k) += lambda;
-
-      AUX = H.inverse_LLt();
-      // AUX.matProductOf_Ab(g,h_lm);	h_lm <- AUX*g
-      h_lm.matProductOf_Ab(AUX, g);
-      h_lm *= NUMTYPE(-1.0);
+      // h_lm = -( H + \lambda I ) ^-1 * g
+      m_H = out_info.H;
+      for (size_t k = 0; k < H_len; k++) m_H(k, k) += lambda;
+
+      // For problems of <=8 parameters (the common case in small calibration
+      // problems), dispatch to a fixed-size Cholesky solve: no temporaries on
+      // the heap, and the loops fully unroll:
+      bool solved = false;
+      if (H_len <= 8)
+      {
+        mrpt::for_<8>(
+            [&](auto idx)
+            {
+              constexpr int N_FIX = static_cast<int>(idx.value) + 1;
+              if (H_len != static_cast<size_t>(N_FIX)) return;
+              solved = solveDampedEqFixed<N_FIX>(m_H, m_g, m_h_lm);
+            });
+      }
+      if (!solved)
+      {
+        // Generic dynamic-size path:
+        m_AUX = m_H.inverse_LLt();
+        m_h_lm.matProductOf_Ab(m_AUX, m_g);
+        m_h_lm *= NUMTYPE(-1.0);
+      }
 
-      double h_lm_n2 = math::norm(h_lm);
+      double h_lm_n2 = math::norm(m_h_lm);
       double x_n2 = math::norm(x);
 
       MRPT_LOG_DEBUG_STREAM("Iter:" << iter << " x=" << mrpt::containers::sprintf_vector(" %f", x));
@@ -190,36 +234,37 @@ class CLevenbergMarquardtTempl : public mrpt::system::COutputLogger
       {
         // Improvement: xnew = x + h_lm;
         if (!x_increment_adder)
-          xnew = x + h_lm;  // Normal Euclidean space addition.
+        {
+          // Normal Euclidean space addition, reusing xnew's storage:
+          m_xnew = x;
+          m_xnew += m_h_lm;
+        }
         else
-          x_increment_adder(xnew, x, h_lm, userParam);
+          x_increment_adder(m_xnew, x, m_h_lm, userParam);
 
-        functor(xnew, userParam, f_xnew);
-        const double F_xnew = pow(math::norm(f_xnew), 2);
+        functor(m_xnew, userParam, m_f_xnew);
+        const double F_xnew = pow(math::norm(m_f_xnew), 2);
 
         // denom = h_lm^t * ( \lambda * h_lm - g )
-        VECTORTYPE tmp(h_lm);
-        tmp *= lambda;
-        tmp -= g;
-        const double denom = tmp.dot(h_lm);
+        const double denom = lambda * m_h_lm.dot(m_h_lm) - m_g.dot(m_h_lm);
         const double l = (F_x - F_xnew) / denom;
 
         if (l > 0)  // There is an improvement:
         {
           // Accept new point:
-          x = xnew;
-          f_x = f_xnew;
+          x = m_xnew;
+          m_f_x = m_f_xnew;
           F_x = F_xnew;
 
-          math::estimateJacobian(x, functor, increments, userParam, J);
-          out_info.H.matProductOf_AtA(J);
-          g.matProductOf_Atb(J, f_x);
+          evalJacobian(x);
+          out_info.H.matProductOf_AtA(m_J);
+          m_g.matProductOf_Atb(m_J, m_f_x);
 
-          found = math::norm_inf(g) <= e1;
+          found = math::norm_inf(m_g) <= e1;
           if (found)
             logFmt(
                 mrpt::system::LVL_INFO, "End condition: math::norm_inf(g)<=e1 : %e\n",
-                math::norm_inf(g));
+                math::norm_inf(m_g));
 
           lambda *= max(0.33, 1 - pow(2 * l - 1, 3));
           v = 2;
@@ -242,12 +287,68 @@ class CLevenbergMarquardtTempl : public mrpt::system::COutputLogger
     // Output info:
     out_info.final_sqr_err = F_x;
     out_info.iterations_executed = iter;
-    out_info.last_err_vector = f_x;
+    out_info.last_err_vector = m_f_x;
     if (returnPath) out_info.path.setSize(iter, N + 1);
 
     MRPT_END
   }
 
+ private:
+  /** Solves A*h = -g for a s.p.d. A (the damped Hessian) of compile-time
+   * size N, with a stack-allocated Cholesky factorization: used for problems
+   * of few parameters so the linear solve involves no heap temporaries and
+   * the loops fully unroll. Returns false if A is not numerically
+   * positive-definite (the caller then falls back to the generic path). */
+  template <int N>
+  bool solveDampedEqFixed(const matrix_t& A, const VECTORTYPE& g, VECTORTYPE& h) const
+  {
+    NUMTYPE L[N][N];
+    for (int j = 0; j < N; j++)
+    {
+      NUMTYPE sum = A(j, j);
+      for (int k = 0; k < j; k++) sum -= L[j][k] * L[j][k];
+      if (!(sum > 0)) return false;
+      L[j][j] = std::sqrt(sum);
+      for (int i = j + 1; i < N; i++)
+      {
+        NUMTYPE s = A(i, j);
+        for (int k = 0; k < j; k++) s -= L[i][k] * L[j][k];
+        L[i][j] = s / L[j][j];
+      }
+    }
+    // Forward substitution: L*y = -g
+    NUMTYPE y[N];
+    for (int i = 0; i < N; i++)
+    {
+      NUMTYPE s = -g[i];
+      for (int k = 0; k < i; k++) s -= L[i][k] * y[k];
+      y[i] = s / L[i][i];
+    }
+    // Backward substitution: L^t * h = y
+    if (h.size() != static_cast<size_t>(N)) h.resize(N);
+    for (int i = N - 1; i >= 0; i--)
+    {
+      NUMTYPE s = y[i];
+      for (int k = i + 1; k < N; k++) s -= L[k][i] * h[k];
+      h[i] = s / L[i][i];
+    }
+    return true;
+  }
+
+  /** \name Workspaces, sized on the first execute() and reused afterwards
+     (both across iterations and across repeated solves on this object).
+    @{ */
+  /** The Jacobian of "f" */
+  matrix_t m_J;
+  /** Damped Hessian H+lambda*I, and its inverse */
+  matrix_t m_H, m_AUX;
+  /** The gradient */
+  VECTORTYPE m_g;
+  /** The vector error from the user function */
+  VECTORTYPE m_f_x;
+  VECTORTYPE m_h_lm, m_xnew, m_f_xnew;
+  /** @} */
+
 };  // End of class def.
 
 /** The default name for the LM class is an instantiation for "double"
@@ -41,7 +41,10 @@ template <class T>
 class CMatrixDynamic : public MatrixBase<T, CMatrixDynamic<T>>
 {
  private:
-  static constexpr size_t small_size = 16;
+  /** Elements up to this count are stored inline (no heap allocation):
+   * 64 covers matrices up to 8x8, e.g. the Jacobian and innovation scratch
+   * matrices of typical KF / PF-localization problems. */
+  static constexpr size_t small_size = 64;
   using vec_t = mrpt::containers::
       vector_with_small_size_optimization<T, small_size, MRPT_MAX_STATIC_ALIGN_BYTES>;
 
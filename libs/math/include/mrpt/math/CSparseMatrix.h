@@ -17,6 +17,7 @@
 
 #include <cstring>  // memcpy
 #include <stdexcept>
+#include <vector>
 
 // Include CSparse lib headers, either from the system or embedded:
 #if MRPT_HAS_SUITESPARSE
@@ -97,6 +98,11 @@ class CSparseMatrix
  private:
   cs sparse_matrix;
 
+  /** Cached map from triplet entry index to position within the compressed
+   * "x" array, built on the first call to refreshCompressedFromTriplet() and
+   * invalidated whenever the compressed structure of this matrix changes. */
+  std::vector<int> m_triplet2csc;
+
   /** Initialization from a dense matrix of any kind existing in MRPT. */
   template <class MATRIX>
   void construct_from_mrpt_mat(const MATRIX& C)
@@ -230,11 +236,22 @@ class CSparseMatrix
 
   /** this = A+B */
   void add_AB(const CSparseMatrix& A, const CSparseMatrix& B);
-  /** this = A*B */
-  void multiply_AB(const CSparseMatrix& A, const CSparseMatrix& B);
-  /** out_res = this * b */
+  /** this = A*B
+   * \param numThreads If >1, the columns of B are multiplied in parallel
+   *  with that number of worker threads (0 = one per CPU core). The result
+   *  is identical to the single-threaded product.
+   *  \note numThreads: [New in MRPT 2.14.5]
+   */
+  void multiply_AB(const CSparseMatrix& A, const CSparseMatrix& B, unsigned int numThreads = 1);
+  /** out_res = this * b
+   * \param numThreads If >1, the columns of this matrix are processed in
+   *  parallel with that number of worker threads (0 = one per CPU core).
+   *  \note numThreads: [New in MRPT 2.14.5]
+   */
   void matProductOf_Ab(
-      const mrpt::math::CVectorDouble& b, mrpt::math::CVectorDouble& out_res) const;
+      const mrpt::math::CVectorDouble& b,
+      mrpt::math::CVectorDouble& out_res,
+      unsigned int numThreads = 1) const;
 
   inline CSparseMatrix operator+(const CSparseMatrix& other) const
   {
@@ -312,6 +329,29 @@ class CSparseMatrix
    */
   void compressFromTriplet();
 
+  /** ONLY for COLUMN-COMPRESSED matrices: overwrite the numeric values of
+   * this matrix with those of a TRIPLET matrix whose non-zero pattern is a
+   * subset of the one this matrix was compressed from, keeping the current
+   * compressed structure (and its memory) untouched.
+   *
+   *  This is much faster than rebuilding the matrix via compressFromTriplet()
+   * when the same sparse pattern is re-filled over and over (e.g. the
+   * iterations of GMRF or graph-SLAM solvers): the triplet-to-CCS index map
+   * is built on the first call and cached, so subsequent refreshes are a
+   * plain O(nnz) scatter-add without any memory allocation. Duplicated
+   * triplet entries are summed, as in compressFromTriplet().
+   *
+   *  Combine with CholeskyDecomp::update() to also reuse the symbolic
+   * factorization across solves.
+   *
+   * \exception std::exception If this matrix is not column-compressed, the
+   * input is not a triplet matrix, sizes differ, or a triplet entry does not
+   * exist in the compressed pattern.
+   * \note [New in MRPT 2.14.5]
+   * \sa compressFromTriplet, CholeskyDecomp::update
+   */
+  void refreshCompressedFromTriplet(const CSparseMatrix& triplet);
+
   /** Return a dense representation of the sparse matrix.
    * \sa saveToTextFile_dense
    */
@@ -469,6 +509,9 @@ class CSparseMatrix
      * original input, square definite-positive sparse matrix.
      *  NOTE: This new matrix MUST HAVE exactly the same sparse structure
      * than the original one.
+     *  The symbolic factorization is reused, so only the numeric
+     * factorization is recomputed.
+     * \sa CSparseMatrix::refreshCompressedFromTriplet
      */
     void update(const CSparseMatrix& new_SM);
   };
@@ -11,6 +11,7 @@
 #include <mrpt/serialization/CSerializable.h>
 
 #include <map>
+#include <vector>
 
 namespace mrpt::math
 {
@@ -33,6 +34,21 @@ class CSplineInterpolator1D : public mrpt::serialization::CSerializable
   /** Whether to wrap "y" */
   bool m_wrap2pi;
 
+  /** Precomputed per-segment cubic coefficients for queryMany():
+   *  y(x) = c3a*(x-x1)^3 + c3b*(x2-x)^3 + cA*(x-x1) + cB*(x2-x),
+   * with (x1,x2) the segment knots. \sa compile */
+  struct TSegmentCoefs
+  {
+    double x1, x2, c3a, c3b, cA, cB;
+  };
+
+  /** Flat, sorted copy of the knots and the per-segment coefficients
+   * ("compiled" spline) used by queryMany(), rebuilt on demand.
+   * \sa compile */
+  mutable std::vector<double> m_compiled_x, m_compiled_y;
+  mutable std::vector<TSegmentCoefs> m_compiled_coefs;
+  mutable bool m_compiled_dirty{true};
+
  public:
   /** Constructor with optional initial values. */
   template <class VECTOR>
@@ -47,7 +63,11 @@ class CSplineInterpolator1D : public mrpt::serialization::CSerializable
   CSplineInterpolator1D(bool wrap2pi = false);
 
   /** If set to true, the interpolated data will be wrapped to ]-pi,pi] */
-  void setWrap2pi(bool wrap) { m_wrap2pi = wrap; }
+  void setWrap2pi(bool wrap)
+  {
+    m_wrap2pi = wrap;
+    m_compiled_dirty = true;
+  }
   /** Return the wrap property */
   bool getWrap2pi() { return m_wrap2pi; }
   /** Set all the data at once .
@@ -61,6 +81,7 @@ class CSplineInterpolator1D : public mrpt::serialization::CSerializable
     ASSERT_EQUAL_(x.size(), y.size());
     const size_t n = size_t(x.size());
     for (size_t i = 0; i < n; i++) m_x2y[x[i]] = y[i];
+    m_compiled_dirty = true;
     MRPT_END
   }
 
@@ -68,7 +89,11 @@ class CSplineInterpolator1D : public mrpt::serialization::CSerializable
   void appendXY(double x, double y);
 
   /** Clears all stored points */
-  void clear() { m_x2y.clear(); }
+  void clear()
+  {
+    m_x2y.clear();
+    m_compiled_dirty = true;
+  }
   /** Query an interpolation of the curve at some "x".
    *   The result is stored in "y". If the "x" point is out of range,
    * "valid_out" is set to false.
@@ -95,6 +120,25 @@ class CSplineInterpolator1D : public mrpt::serialization::CSerializable
     }
     return anyValid;
   }
+
+  /** Batched version of query() for many "x" values at once, e.g. dense PTG
+   * sampling over a static spline. Queries run against a compiled flat table
+   * of per-segment cubic coefficients, so each lookup is a binary search on
+   * a contiguous array plus one polynomial evaluation instead of a std::map
+   * traversal and a local spline solve. The compiled table is rebuilt
+   * automatically after any appendXY()/setXY()/clear()/setWrap2pi().
+   * Output vectors are resized to xs.size(); out_valid[i] follows the same
+   * criteria than in query().
+   * \sa query, compile
+   * \note [New in MRPT 2.14.5] */
+  void queryMany(
+      const std::vector<double>& xs, std::vector<double>& out_y, std::vector<bool>& out_valid)
+      const;
+
+  /** Rebuilds the compiled coefficient table used by queryMany(). Called
+   * automatically when needed. \sa queryMany
+   * \note [New in MRPT 2.14.5] */
+  void compile() const;
 };
 
 }  // namespace mrpt::math
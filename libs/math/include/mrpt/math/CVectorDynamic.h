@@ -32,7 +32,10 @@ template <class T>
 class CVectorDynamic : public MatrixVectorBase<T, CVectorDynamic<T>>
 {
  protected:
-  static constexpr size_t small_size = 16;
+  /** Vectors up to this length live in inline storage, avoiding heap
+   * allocations for the state/observation sizes of typical estimation
+   * problems. */
+  static constexpr size_t small_size = 64;
   using vec_t = mrpt::containers::
       vector_with_small_size_optimization<T, small_size, MRPT_MAX_STATIC_ALIGN_BYTES>;
 
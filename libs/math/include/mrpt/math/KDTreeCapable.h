@@ -14,6 +14,7 @@
 #include <mrpt/math/TPoint2D.h>
 #include <mrpt/math/TPoint3D.h>
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <memory>  // unique_ptr
@@ -36,6 +37,43 @@ namespace mrpt::math
  *  \ingroup mrpt_math_grp
  *  @{ */
 
+namespace detail
+{
+/** A nanoflann result set for 1-NN searches whose pruning bound starts at a
+ * user-given maximum squared distance instead of infinity, so tree branches
+ * farther than the cap are never visited. Used by the `*Capped()` query
+ * methods of KDTreeCapable. \note (New in MRPT 2.14.5) */
+template <typename DistanceType, typename IndexType = std::size_t>
+class KNN1CappedResultSet
+{
+ public:
+  explicit KNN1CappedResultSet(DistanceType maxDistSqr) : m_worst(maxDistSqr) {}
+
+  inline bool addPoint(DistanceType dist, IndexType index)
+  {
+    if (dist < m_worst)
+    {
+      m_worst = dist;
+      m_index = index;
+      m_found = true;
+    }
+    return true;  // keep searching
+  }
+  inline DistanceType worstDist() const { return m_worst; }
+  inline bool full() const { return true; }
+  inline std::size_t size() const { return m_found ? 1 : 0; }
+
+  inline bool found() const { return m_found; }
+  inline IndexType index() const { return m_index; }
+  inline DistanceType distSqr() const { return m_worst; }
+
+ private:
+  DistanceType m_worst;
+  IndexType m_index = 0;
+  bool m_found = false;
+};
+}  // namespace detail
+
 /** Adaptor class providing Nearest Neighbor (NN) searcg via `nanoflann`,
  * making use of the CRTP design pattern.
  *
@@ -153,7 +191,7 @@ class KDTreeCapable
     const std::array<num_t, 2> query_point{
         {x0, y0}
     };
-    m_kdtree2d_data.index->findNeighbors(resultSet, &query_point[0], {});
+    m_kdtree2d_data.findNeighbors(resultSet, &query_point[0]);
 
     // Copy output to user vars:
     out_x = derived().kdtree_get_pt(ret_index, 0);
@@ -178,7 +216,7 @@ class KDTreeCapable
     const std::array<num_t, 2> query_point{
         {x0, y0}
     };
-    m_kdtree2d_data.index->findNeighbors(resultSet, &query_point[0], {});
+    m_kdtree2d_data.findNeighbors(resultSet, &query_point[0]);
 
     return ret_index;
     MRPT_END
@@ -252,7 +290,7 @@ class KDTreeCapable
     const std::array<num_t, 2> query_point{
         {x0, y0}
     };
-    m_kdtree2d_data.index->findNeighbors(resultSet, &query_point[0], {});
+    m_kdtree2d_data.findNeighbors(resultSet, &query_point[0]);
 
     // Copy output to user vars:
     out_x1 = derived().kdtree_get_pt(ret_indexes[0], 0);
@@ -331,7 +369,7 @@ class KDTreeCapable
       nanoflann::KNNResultSet<num_t> resultSet(knn);
       resultSet.init(&ret_indexes[0], &out_dist_sqr[0]);
 
-      m_kdtree2d_data.index->findNeighbors(resultSet, &query_point[0], {});
+      m_kdtree2d_data.findNeighbors(resultSet, &query_point[0]);
     }
     else
     {
@@ -339,7 +377,7 @@ class KDTreeCapable
       nanoflann::RKNNResultSet<num_t> resultSet(knn, *maximumSearchDistanceSqr);
       resultSet.init(&ret_indexes[0], &out_dist_sqr[0]);
 
-      m_kdtree2d_data.index->findNeighbors(resultSet, &query_point[0], {});
+      m_kdtree2d_data.findNeighbors(resultSet, &query_point[0]);
       ret_indexes.resize(resultSet.size());
       out_dist_sqr.resize(resultSet.size());
 #else
@@ -416,7 +454,7 @@ class KDTreeCapable
       nanoflann::KNNResultSet<num_t> resultSet(knn);
       resultSet.init(&out_idx[0], &out_dist_sqr[0]);
 
-      m_kdtree2d_data.index->findNeighbors(resultSet, &query_point[0], {});
+      m_kdtree2d_data.findNeighbors(resultSet, &query_point[0]);
     }
     else
     {
@@ -424,7 +462,7 @@ class KDTreeCapable
       nanoflann::RKNNResultSet<num_t> resultSet(knn, *maximumSearchDistanceSqr);
       resultSet.init(&out_idx[0], &out_dist_sqr[0]);
 
-      m_kdtree2d_data.index->findNeighbors(resultSet, &query_point[0], {});
+      m_kdtree2d_data.findNeighbors(resultSet, &query_point[0]);
       out_idx.resize(resultSet.size());
       out_dist_sqr.resize(resultSet.size());
 #else
@@ -479,7 +517,7 @@ class KDTreeCapable
     const std::array<num_t, 3> query_point{
         {x0, y0, z0}
     };
-    m_kdtree3d_data.index->findNeighbors(resultSet, &query_point[0], {});
+    m_kdtree3d_data.findNeighbors(resultSet, &query_point[0]);
 
     // Copy output to user vars:
     out_x = derived().kdtree_get_pt(ret_index, 0);
@@ -505,7 +543,7 @@ class KDTreeCapable
     const std::array<num_t, 3> query_point{
         {x0, y0, z0}
     };
-    m_kdtree3d_data.index->findNeighbors(resultSet, &query_point[0], {});
+    m_kdtree3d_data.findNeighbors(resultSet, &query_point[0]);
 
     return ret_index;
     MRPT_END
@@ -575,14 +613,14 @@ class KDTreeCapable
     {
       nanoflann::KNNResultSet<num_t> resultSet(knn);
       resultSet.init(&ret_indexes[0], &out_dist_sqr[0]);
-      m_kdtree3d_data.index->findNeighbors(resultSet, &query_point[0], {});
+      m_kdtree3d_data.findNeighbors(resultSet, &query_point[0]);
     }
     else
     {
 #if NANOFLANN_VERSION >= 0x151
       nanoflann::RKNNResultSet<num_t> resultSet(knn, *maximumSearchDistanceSqr);
       resultSet.init(&ret_indexes[0], &out_dist_sqr[0]);
-      m_kdtree3d_data.index->findNeighbors(resultSet, &query_point[0], {});
+      m_kdtree3d_data.findNeighbors(resultSet, &query_point[0]);
       ret_indexes.resize(resultSet.size());
       out_dist_sqr.resize(resultSet.size());
 #else
@@ -652,14 +690,14 @@ class KDTreeCapable
       nanoflann::KNNResultSet<num_t> resultSet(knn);
       resultSet.init(&out_idx[0], &out_dist_sqr[0]);
 
-      m_kdtree3d_data.index->findNeighbors(resultSet, &query_point[0], {});
+      m_kdtree3d_data.findNeighbors(resultSet, &query_point[0]);
     }
     else
     {
 #if NANOFLANN_VERSION >= 0x151
       nanoflann::RKNNResultSet<num_t> resultSet(knn, *maximumSearchDistanceSqr);
       resultSet.init(&out_idx[0], &out_dist_sqr[0]);
-      m_kdtree3d_data.index->findNeighbors(resultSet, &query_point[0], {});
+      m_kdtree3d_data.findNeighbors(resultSet, &query_point[0]);
       out_idx.resize(resultSet.size());
       out_dist_sqr.resize(resultSet.size());
 #else
@@ -725,7 +763,7 @@ class KDTreeCapable
     if (m_kdtree3d_data.m_num_points != 0)
     {
       const num_t xyz[3] = {x0, y0, z0};
-      m_kdtree3d_data.index->radiusSearch(&xyz[0], maxRadiusSqr, out_indices_dist, {});
+      m_kdtree3d_data.radiusSearch(&xyz[0], maxRadiusSqr, out_indices_dist);
     }
     return out_indices_dist.size();
     MRPT_END
@@ -759,7 +797,7 @@ class KDTreeCapable
     if (m_kdtree2d_data.m_num_points != 0)
     {
       const num_t xyz[2] = {x0, y0};
-      m_kdtree2d_data.index->radiusSearch(&xyz[0], maxRadiusSqr, out_indices_dist, {});
+      m_kdtree2d_data.radiusSearch(&xyz[0], maxRadiusSqr, out_indices_dist);
     }
     return out_indices_dist.size();
     MRPT_END
@@ -805,14 +843,14 @@ class KDTreeCapable
     {
       nanoflann::KNNResultSet<num_t> resultSet(knn);
       resultSet.init(&out_idx[0], &out_dist_sqr[0]);
-      m_kdtree3d_data.index->findNeighbors(resultSet, &query_point[0], {});
+      m_kdtree3d_data.findNeighbors(resultSet, &query_point[0]);
     }
     else
     {
 #if NANOFLANN_VERSION >= 0x151
       nanoflann::RKNNResultSet<num_t> resultSet(knn, *maximumSearchDistanceSqr);
       resultSet.init(&out_idx[0], &out_dist_sqr[0]);
-      m_kdtree3d_data.index->findNeighbors(resultSet, &query_point[0], {});
+      m_kdtree3d_data.findNeighbors(resultSet, &query_point[0]);
       out_idx.resize(resultSet.size());
       out_dist_sqr.resize(resultSet.size());
 #else
@@ -834,8 +872,89 @@ class KDTreeCapable
         d2f(p0.x), d2f(p0.y), d2f(p0.z), N, outIdx, outDistSqr, maximumSearchDistanceSqr);
   }
 
-  inline void kdTreeEnsureIndexBuilt3D() { rebuild_kdTree_3D(); }
-  inline void kdTreeEnsureIndexBuilt2D() { rebuild_kdTree_2D(); }
+  /** Like kdTreeClosestPoint2D(), but the search is pruned at the given
+   * maximum squared distance: branches of the tree farther than it are
+   * never visited, which is much faster when only neighbors below a known
+   * threshold are of interest (e.g. ICP correspondence thresholds).
+   * \return true if some point lies strictly closer than `maxDistSqr`, with
+   * its index and squared distance in the output parameters.
+   * \note The index must have been built beforehand (e.g. via
+   * kdTreeEnsureIndexBuilt2D()) so this method is safe to call concurrently
+   * from several threads.
+   * \param eps Optional approximation factor (nanoflann semantics): if >0,
+   * tree branches are pruned with a `(1+eps)` slack, so the returned point
+   * is only guaranteed to be within `(1+eps)` times the true nearest
+   * neighbor's distance. `0` (default) keeps the search exact.
+   * \note (New in MRPT 2.14.5)
+   */
+  inline bool kdTreeClosestPoint2DCapped(
+      float x0, float y0, float maxDistSqr, size_t& out_idx, float& out_dist_sqr, float eps = .0f)
+      const
+  {
+    rebuild_kdTree_2D();  // First: Create the 2D KD-Tree if required
+    if (!m_kdtree2d_data.m_num_points) THROW_EXCEPTION("There are no points in the KD-tree.");
+
+    detail::KNN1CappedResultSet<num_t> resultSet(maxDistSqr);
+    const std::array<num_t, 2> query_point{
+        {x0, y0}
+    };
+    m_kdtree2d_data.findNeighbors(resultSet, &query_point[0], nanoflann::SearchParameters(eps));
+    if (!resultSet.found()) return false;
+    out_idx = resultSet.index();
+    out_dist_sqr = resultSet.distSqr();
+    return true;
+  }
+
+  /// \overload For 3D queries \note (New in MRPT 2.14.5)
+  inline bool kdTreeClosestPoint3DCapped(
+      float x0,
+      float y0,
+      float z0,
+      float maxDistSqr,
+      size_t& out_idx,
+      float& out_dist_sqr,
+      float eps = .0f) const
+  {
+    rebuild_kdTree_3D();  // First: Create the 3D KD-Tree if required
+    if (!m_kdtree3d_data.m_num_points) THROW_EXCEPTION("There are no points in the KD-tree.");
+
+    detail::KNN1CappedResultSet<num_t> resultSet(maxDistSqr);
+    const std::array<num_t, 3> query_point{
+        {x0, y0, z0}
+    };
+    m_kdtree3d_data.findNeighbors(resultSet, &query_point[0], nanoflann::SearchParameters(eps));
+    if (!resultSet.found()) return false;
+    out_idx = resultSet.index();
+    out_dist_sqr = resultSet.distSqr();
+    return true;
+  }
+
+  inline void kdTreeEnsureIndexBuilt3D() const { rebuild_kdTree_3D(); }
+  inline void kdTreeEnsureIndexBuilt2D() const { rebuild_kdTree_2D(); }
+
+  /** Enables/disables the incremental (dynamic) KD-tree index, based on
+   * nanoflann's KDTreeSingleIndexDynamicAdaptor. In this mode, when child
+   * classes *append* points and report it via kdtree_mark_as_appended(),
+   * only the new batch is inserted into the index, at a cost proportional
+   * to the batch size instead of a full O(N log N) rebuild of the whole
+   * point set.
+   *
+   * Any call to kdtree_mark_as_outdated() (points modified or removed)
+   * still discards the index entirely.
+   *
+   * Disabled by default. \note (New in MRPT 2.14.5)
+   */
+  inline void kdtree_enable_incremental_updates(bool enable)
+  {
+    std::lock_guard<std::mutex> lck(m_kdtree_mtx);
+    m_kdtree_incremental = enable;
+    // Force a rebuild so the correct index flavor is created on the next
+    // query:
+    m_kdtree_is_uptodate = false;
+    m_kdtree_append_pending = false;
+  }
+
+  inline bool kdtree_incremental_updates_enabled() const { return m_kdtree_incremental; }
 
   /* @} */
 
@@ -845,6 +964,23 @@ class KDTreeCapable
   {
     std::lock_guard<std::mutex> lck(m_kdtree_mtx);
     m_kdtree_is_uptodate = false;
+    m_kdtree_append_pending = false;
+  }
+
+  /** To be called by child classes when new points have been *appended* to
+   * the data set, leaving all former points untouched. In incremental mode
+   * (see kdtree_enable_incremental_updates()) only the new points are
+   * added to the index; otherwise this is equivalent to
+   * kdtree_mark_as_outdated(). \note (New in MRPT 2.14.5)
+   */
+  inline void kdtree_mark_as_appended() const
+  {
+    std::lock_guard<std::mutex> lck(m_kdtree_mtx);
+    m_kdtree_is_uptodate = false;
+    if (m_kdtree_incremental)
+      m_kdtree_append_pending = true;
+    else
+      m_kdtree_append_pending = false;
   }
 
  private:
@@ -866,16 +1002,59 @@ class KDTreeCapable
     }
 
     /** Free memory (if allocated)  */
-    inline void clear() noexcept { index.reset(); }
+    inline void clear() noexcept
+    {
+      index.reset();
+      dynIndex.reset();
+    }
     using kdtree_index_t =
         nanoflann::KDTreeSingleIndexAdaptor<metric_t, Derived, _DIM, std::size_t /*index*/>;
+    using kdtree_dyn_index_t =
+        nanoflann::KDTreeSingleIndexDynamicAdaptor<metric_t, Derived, _DIM, std::size_t /*index*/>;
 
-    /** nullptr or the up-to-date index */
+    /** nullptr or the up-to-date index (regular, build-once mode) */
     std::unique_ptr<kdtree_index_t> index;
 
+    /** nullptr or the up-to-date index (incremental mode, see
+     * kdtree_enable_incremental_updates()) */
+    std::unique_ptr<kdtree_dyn_index_t> dynIndex;
+
     /** Dimensionality. typ: 2,3 */
     size_t m_dim = _DIM;
     size_t m_num_points = 0;
+
+    /** Runs the query against whichever index (regular or dynamic) is
+     * currently built. */
+    template <typename RESULTSET>
+    inline void findNeighbors(
+        RESULTSET& resultSet,
+        const num_t* query_point,
+        const nanoflann::SearchParameters& sp = {}) const
+    {
+      if (dynIndex)
+        dynIndex->findNeighbors(resultSet, query_point, sp);
+      else
+        index->findNeighbors(resultSet, query_point, sp);
+    }
+
+    inline size_t radiusSearch(
+        const num_t* query_point,
+        num_t radiusSqr,
+        std::vector<nanoflann::ResultItem<std::size_t, num_t>>& out_indices_dist) const
+    {
+      if (dynIndex)
+      {
+        // The dynamic adaptor lacks radiusSearch(): emulate it.
+        out_indices_dist.clear();
+        nanoflann::RadiusResultSet<num_t, std::size_t> resultSet(radiusSqr, out_indices_dist);
+        dynIndex->findNeighbors(resultSet, query_point, {});
+        std::sort(
+            out_indices_dist.begin(), out_indices_dist.end(),
+            [](const auto& a, const auto& b) { return a.second < b.second; });
+        return out_indices_dist.size();
+      }
+      return index->radiusSearch(query_point, radiusSqr, out_indices_dist, {});
+    }
   };
 
   mutable std::mutex m_kdtree_mtx;
@@ -883,6 +1062,42 @@ class KDTreeCapable
   mutable TKDTreeDataHolder<3> m_kdtree3d_data;
   /** whether the KD tree needs to be rebuilt or not. */
   mutable std::atomic_bool m_kdtree_is_uptodate{false};
+  /** See kdtree_enable_incremental_updates() */
+  bool m_kdtree_incremental = false;
+  /** In incremental mode: pending data change is append-only, so the
+   * dynamic index can be updated in place. */
+  mutable bool m_kdtree_append_pending = false;
+
+  /** Incremental-mode version of the index update: creates the dynamic
+   * index the first time, then appends new point batches in place.
+   * Returns with `holder` up to date. Assumes m_kdtree_mtx is held. */
+  template <int _DIM>
+  void update_dyn_index(TKDTreeDataHolder<_DIM>& holder) const
+  {
+    using tree_t = typename TKDTreeDataHolder<_DIM>::kdtree_dyn_index_t;
+
+    const size_t N = derived().kdtree_get_point_count();
+    // Appends never shrink the point count; anything else requires a
+    // fresh index:
+    if (holder.dynIndex && (!m_kdtree_append_pending || N < holder.m_num_points))
+      holder.dynIndex.reset();
+
+    if (!holder.dynIndex)
+    {
+      holder.clear();
+      holder.m_dim = _DIM;
+      // The dynamic adaptor indexes all existing dataset points at
+      // construction:
+      holder.dynIndex = std::make_unique<tree_t>(
+          _DIM, const_cast<Derived&>(derived()),
+          nanoflann::KDTreeSingleIndexAdaptorParams(kdtree_search_params.leaf_max_size));
+    }
+    else if (N > holder.m_num_points)
+    {
+      holder.dynIndex->addPoints(holder.m_num_points, N - 1);
+    }
+    holder.m_num_points = N;
+  }
 
   /// Rebuild, if needed the KD-tree for 2D (nDims=2), 3D (nDims=3), ...
   /// asking the child class for the data points.
@@ -893,6 +1108,16 @@ class KDTreeCapable
     std::lock_guard<std::mutex> lck(m_kdtree_mtx);
     using tree2d_t = typename TKDTreeDataHolder<2>::kdtree_index_t;
 
+    if (m_kdtree_incremental)
+    {
+      // Keep only one cached tree (see class docs):
+      m_kdtree3d_data.clear();
+      update_dyn_index(m_kdtree2d_data);
+      m_kdtree_append_pending = false;
+      m_kdtree_is_uptodate = true;
+      return;
+    }
+
     if (!m_kdtree_is_uptodate)
     {
       m_kdtree2d_data.clear();
@@ -926,6 +1151,16 @@ class KDTreeCapable
     std::lock_guard<std::mutex> lck(m_kdtree_mtx);
     using tree3d_t = typename TKDTreeDataHolder<3>::kdtree_index_t;
 
+    if (m_kdtree_incremental)
+    {
+      // Keep only one cached tree (see class docs):
+      m_kdtree2d_data.clear();
+      update_dyn_index(m_kdtree3d_data);
+      m_kdtree_append_pending = false;
+      m_kdtree_is_uptodate = true;
+      return;
+    }
+
     if (!m_kdtree_is_uptodate)
     {
       m_kdtree2d_data.clear();
@@ -10,6 +10,9 @@
 
 #include <mrpt/math/MatrixVectorBase.h>
 
+#include <cmath>
+#include <vector>
+
 namespace mrpt::math
 {
 /**  Base CRTP class for all MRPT matrices.
@@ -303,6 +306,128 @@ class MatrixBase : public MatrixVectorBase<Scalar, Derived>
     }
   }
 
+  /** SYRK-style symmetric rank-k update: `this += alpha * A * A`<sup>T</sup>,
+   * with `this` a symmetric NxN matrix and A of size NxK.
+   * Only the upper triangle is computed, then mirrored, halving the work
+   * compared to a general matrix product (useful for covariance updates).
+   * \note [New in MRPT 2.14.5]
+   * \sa matProductOf_AAt, cholUpdate */
+  template <typename MAT_A>
+  void matRankUpdate_AAt(const MAT_A& A, Scalar alpha = 1)
+  {
+    using Index = typename Derived::Index;
+    const auto N = A.rows(), Ninner = A.cols();
+    ASSERT_EQUAL_(mbDerived().rows(), N);
+    ASSERT_EQUAL_(mbDerived().cols(), N);
+    for (Index r = 0; r < N; r++)
+    {
+      for (Index c = r; c < N; c++)
+      {
+        typename Derived::Scalar s = 0;
+        for (Index i = 0; i < Ninner; i++) s += A(r, i) * A(c, i);
+        mbDerived()(r, c) += alpha * s;
+        if (c != r) mbDerived()(c, r) = mbDerived()(r, c);
+      }
+    }
+  }
+  /** SYRK-style symmetric rank-k update: `this += alpha * A`<sup>T</sup>` * A`,
+   * with `this` a symmetric NxN matrix and A of size KxN.
+   * \note [New in MRPT 2.14.5]
+   * \sa matProductOf_AtA, cholUpdate */
+  template <typename MAT_A>
+  void matRankUpdate_AtA(const MAT_A& A, Scalar alpha = 1)
+  {
+    using Index = typename Derived::Index;
+    const auto N = A.cols(), Ninner = A.rows();
+    ASSERT_EQUAL_(mbDerived().rows(), N);
+    ASSERT_EQUAL_(mbDerived().cols(), N);
+    for (Index r = 0; r < N; r++)
+    {
+      for (Index c = r; c < N; c++)
+      {
+        typename Derived::Scalar s = 0;
+        for (Index i = 0; i < Ninner; i++) s += A(i, r) * A(i, c);
+        mbDerived()(r, c) += alpha * s;
+        if (c != r) mbDerived()(c, r) = mbDerived()(r, c);
+      }
+    }
+  }
+
+  /** Rank-1 Cholesky update/downdate: with `this` holding the upper factor U
+   * of M=U<sup>T</sup>*U (as returned by chol()), rewrites it in place with
+   * the factor of `M + v*v`<sup>T</sup> (or `M - v*v`<sup>T</sup> if
+   * `subtract=true`) in O(N²), instead of the O(N³) of refactoring.
+   * \return false if a downdate would make the matrix lose positive
+   * definiteness (`this` is left in an undefined state in that case).
+   * \note [New in MRPT 2.14.5]
+   * \sa chol, matRankUpdate_AAt */
+  template <typename VECTOR_LIKE>
+  bool cholUpdate(const VECTOR_LIKE& v, bool subtract = false)
+  {
+    using Index = typename Derived::Index;
+    const auto N = mbDerived().rows();
+    ASSERT_EQUAL_(mbDerived().cols(), N);
+    ASSERT_EQUAL_(static_cast<Index>(v.size()), N);
+
+    std::vector<Scalar> w(v.size());
+    for (Index i = 0; i < N; i++) w[i] = v[i];
+
+    const Scalar sign = subtract ? -1 : 1;
+    for (Index k = 0; k < N; k++)
+    {
+      const Scalar Ukk = mbDerived()(k, k);
+      const Scalar r2 = Ukk * Ukk + sign * w[k] * w[k];
+      if (r2 <= 0 || Ukk == 0) return false;
+      const Scalar r = std::sqrt(r2);
+      const Scalar c = r / Ukk, s = w[k] / Ukk;
+      mbDerived()(k, k) = r;
+      for (Index i = k + 1; i < N; i++)
+      {
+        mbDerived()(k, i) = (mbDerived()(k, i) + sign * s * w[i]) / c;
+        w[i] = c * w[i] - s * mbDerived()(k, i);
+      }
+    }
+    return true;
+  }
+
+  /** Exports the upper triangle (diagonal included) of a symmetric NxN
+   * matrix into a packed row-major array of N*(N+1)/2 entries, halving the
+   * memory traffic of copying or serializing the full dense matrix.
+   * \note [New in MRPT 2.14.5]
+   * \sa loadFromPackedUpperTriangle */
+  template <typename VECTOR_LIKE>
+  void packedUpperTriangle(VECTOR_LIKE& out) const
+  {
+    using Index = typename Derived::Index;
+    const auto N = mbDerived().rows();
+    ASSERT_EQUAL_(mbDerived().cols(), N);
+    out.resize((N * (N + 1)) / 2);
+    std::size_t idx = 0;
+    for (Index r = 0; r < N; r++)
+      for (Index c = r; c < N; c++) out[idx++] = mbDerived()(r, c);
+  }
+
+  /** Rebuilds a symmetric NxN matrix from its packed upper triangle, as
+   * written by packedUpperTriangle().
+   * \note [New in MRPT 2.14.5] */
+  template <typename VECTOR_LIKE>
+  void loadFromPackedUpperTriangle(const std::size_t N, const VECTOR_LIKE& in)
+  {
+    using Index = typename Derived::Index;
+    ASSERT_EQUAL_(static_cast<std::size_t>(in.size()), (N * (N + 1)) / 2);
+    mbDerived().resize(N, N);
+    std::size_t idx = 0;
+    for (Index r = 0; r < static_cast<Index>(N); r++)
+    {
+      for (Index c = r; c < static_cast<Index>(N); c++)
+      {
+        mbDerived()(r, c) = in[idx];
+        mbDerived()(c, r) = in[idx];
+        idx++;
+      }
+    }
+  }
+
   /** @} */
 };
 
@@ -18,6 +18,14 @@
 #include <string>
 #include <vector>
 
+// Minimum Eigen forward declarations, for the lazy (expression-template)
+// operators below mixing MRPT matrices with raw Eigen expressions:
+namespace Eigen
+{
+template <typename Derived>
+class MatrixBase;
+}
+
 namespace mrpt::math
 {
 template <class T>
@@ -209,6 +217,41 @@ class MatrixVectorBase
     return mvbDerived().asEigen() * s;
   }
 
+  /** Lazy operators against raw Eigen expressions (blocks, products,
+   * transposes, ...). These keep composite expressions like
+   * `H * P * H.transpose() + R` as a single Eigen expression tree, evaluated
+   * only once upon assignment and with no intermediate MRPT temporaries. */
+  template <typename D2>
+  auto operator+(const Eigen::MatrixBase<D2>& m2) const
+  {
+    internalAssertEigenDefined<Derived>();
+    return mvbDerived().asEigen() + m2.derived();
+  }
+  template <typename D2>
+  void operator+=(const Eigen::MatrixBase<D2>& m2)
+  {
+    internalAssertEigenDefined<Derived>();
+    mvbDerived().asEigen() += m2.derived();
+  }
+  template <typename D2>
+  auto operator-(const Eigen::MatrixBase<D2>& m2) const
+  {
+    internalAssertEigenDefined<Derived>();
+    return mvbDerived().asEigen() - m2.derived();
+  }
+  template <typename D2>
+  void operator-=(const Eigen::MatrixBase<D2>& m2)
+  {
+    internalAssertEigenDefined<Derived>();
+    mvbDerived().asEigen() -= m2.derived();
+  }
+  template <typename D2>
+  auto operator*(const Eigen::MatrixBase<D2>& m2) const
+  {
+    internalAssertEigenDefined<Derived>();
+    return mvbDerived().asEigen() * m2.derived();
+  }
+
   template <int N>
   CMatrixFixed<Scalar, N, 1> tail() const
   {
@@ -396,6 +439,18 @@ class MatrixVectorBase
   /// \overload
   void loadFromTextFile(const std::string& file);
 
+  /** Parses a whole in-memory text buffer with the same format (and the same
+   * error conditions) as loadFromTextFile(), which delegates here after
+   * slurping the file in one bulk read. Large buffers are split at line
+   * boundaries and parsed by several worker threads, and numbers are decoded
+   * with a fast non-allocating parser, so loading million-row trajectory
+   * files is dominated by disk speed rather than by strtod() and
+   * std::getline().
+   * \note [New in MRPT 2.14.5]
+   * \sa loadFromTextFile
+   */
+  void loadFromTextBuffer(const std::string& buffer);
+
   template <typename OTHERMATVEC>
   bool operator==(const OTHERMATVEC& o) const
   {
@@ -434,6 +489,28 @@ namespace internal
 void printMatrixNoPrintErrorMsg(std::ostream& o);
 }
 
+/** @name Lazy operators with a raw Eigen expression on the left-hand side
+ * Counterparts of the member operators above, so expressions such as
+ * `(H * P) * Ht + R` remain lazy regardless of which side the MRPT
+ * matrix/vector sits on. Requires `#include <Eigen/Dense>` in user code.
+ * @{ */
+template <typename D1, typename S2, class D2>
+auto operator+(const Eigen::MatrixBase<D1>& m1, const MatrixVectorBase<S2, D2>& m2)
+{
+  return m1.derived() + m2.mvbDerived().asEigen();
+}
+template <typename D1, typename S2, class D2>
+auto operator-(const Eigen::MatrixBase<D1>& m1, const MatrixVectorBase<S2, D2>& m2)
+{
+  return m1.derived() - m2.mvbDerived().asEigen();
+}
+template <typename D1, typename S2, class D2>
+auto operator*(const Eigen::MatrixBase<D1>& m1, const MatrixVectorBase<S2, D2>& m2)
+{
+  return m1.derived() * m2.mvbDerived().asEigen();
+}
+/** @} */
+
 /** Stream as text. Implemented for all matrices and vectors, except for
  * non-square fixed-size matrices. */
 template <typename Scalar, class Derived>
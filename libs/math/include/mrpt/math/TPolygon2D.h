@@ -12,6 +12,8 @@
 #include <mrpt/math/TPoint2D.h>
 #include <mrpt/math/TPoseOrPoint.h>
 
+#include <cstdint>
+#include <limits>
 #include <tuple>
 #include <vector>
 
@@ -119,6 +121,65 @@ class TPolygon2D : public std::vector<TPoint2D>
 /** Text streaming function */
 std::ostream& operator<<(std::ostream& o, const TPolygon2D& p);
 
+/** A compiled, read-only representation of a TPolygon2D for fast repeated
+ * point-in-polygon queries: precomputes the bounding box and an edge table
+ * (canonicalized y-ranges and inverse slopes), plus an optional scanline
+ * table bucketing the edges into horizontal bands so each query only visits
+ * the edges whose y-span may contain it.
+ *
+ * Uses the crossing-number (even-odd) rule, which is equivalent to
+ * TPolygon2D::contains() for simple (non self-intersecting) polygons, e.g.
+ * robot footprints.
+ *
+ * \note [New in MRPT 2.14.5]
+ * \sa TPolygon2D::contains, CPolygon
+ * \ingroup geometry_grp
+ */
+class TCompiledPolygon2D
+{
+ public:
+  /** Default constructor: an empty polygon, contains() always false. */
+  TCompiledPolygon2D() = default;
+
+  /** Compiles the given polygon. \sa compile */
+  explicit TCompiledPolygon2D(const TPolygon2D& poly, size_t scanlineBands = 0)
+  {
+    compile(poly, scanlineBands);
+  }
+
+  /** (Re)builds the precomputed tables for the given polygon. If
+   * scanlineBands>0, also builds a scanline table with that number of
+   * horizontal bands, worthwhile for polygons with many vertices. */
+  void compile(const TPolygon2D& poly, size_t scanlineBands = 0);
+
+  /** Point-in-polygon test (crossing-number rule). */
+  bool contains(const TPoint2D& point) const;
+
+  /** Batch version of contains(): results is resized to points.size() and
+   * results[i] is set to whether points[i] lies inside the polygon. Amortizes
+   * the bounding-box and edge-table loads over many query points. */
+  void containsMany(const std::vector<TPoint2D>& points, std::vector<bool>& results) const;
+
+ private:
+  /** One non-horizontal polygon edge, canonicalized so yLo<yHi. */
+  struct TEdge
+  {
+    double yLo, yHi;
+    /** x at y=yLo, and dx/dy, so the crossing abscissa at query height y is
+     * xAtYLo+(y-yLo)*invSlope */
+    double xAtYLo, invSlope;
+  };
+
+  std::vector<TEdge> m_edges;
+  /** Bounding box; initialized so any query point is rejected while empty */
+  TPoint2D m_bbMin{std::numeric_limits<double>::max(), std::numeric_limits<double>::max()};
+  TPoint2D m_bbMax{-std::numeric_limits<double>::max(), -std::numeric_limits<double>::max()};
+  /** Scanline table (empty unless requested at compile()): indices into
+   * m_edges per horizontal band */
+  std::vector<std::vector<uint32_t>> m_bands;
+  double m_bandY0{0}, m_bandInvH{0};
+};
+
 }  // namespace mrpt::math
 
 namespace mrpt::typemeta
@@ -11,6 +11,8 @@
 #include <mrpt/math/CMatrixDynamic.h>
 #include <mrpt/math/CVectorDynamic.h>
 
+#include <vector>
+
 namespace mrpt::math
 {
 /** \addtogroup fourier_grp Fourier transform functions
@@ -95,6 +97,49 @@ void idft2_complex(
  */
 void cross_correlation_FFT(const CMatrixFloat& A, const CMatrixFloat& B, CMatrixFloat& out_corr);
 
+/** Reusable plan for repeated real 2D FFTs of one fixed size.
+ * The FFT kernels need bit-reversal and twiddle-factor work tables plus
+ * scratch buffers, whose allocation and setup used to be repeated on every
+ * call to dft2_real()/idft2_real(); this object computes them once on the
+ * first transform and keeps them across calls, which pays off when
+ * transforming many same-size matrices (grid-map correlation, image
+ * frequency filters, ...). The tables are rebuilt transparently if a matrix
+ * of a different size is passed.
+ *
+ * Both dimensions must be powers of two. A plan is not thread-safe: use one
+ * plan per thread.
+ *
+ * \sa dft2_real, idft2_real
+ * \note [New in MRPT 2.14.5]
+ */
+class CFFT2DPlan
+{
+ public:
+  CFFT2DPlan() = default;
+
+  /** Forward transform of a real matrix; equivalent to mrpt::math::dft2_real()
+   */
+  void dft2_real(const CMatrixFloat& in_data, CMatrixFloat& out_real, CMatrixFloat& out_imag);
+
+  /** Inverse transform back to a real matrix; equivalent to
+   * mrpt::math::idft2_real() */
+  void idft2_real(const CMatrixFloat& in_real, const CMatrixFloat& in_imag, CMatrixFloat& out_data);
+
+ private:
+  /** (Re)builds the work tables and scratch buffers if the size changed */
+  void prepare(size_t dim1, size_t dim2);
+
+  size_t m_dim1{0}, m_dim2{0};
+  /** Contiguous in-place transform buffer, plus the per-row pointers into it
+   * expected by the C FFT kernels */
+  std::vector<float> m_a_data;
+  std::vector<float*> m_a;
+  /** Scratch area and the bit-reversal / cos-sin work tables (see the docs of
+   * the internal rdft2d()) */
+  std::vector<float> m_t, m_w;
+  std::vector<int> m_ip;
+};
+
 /** @} */
 
 }  // namespace mrpt::math
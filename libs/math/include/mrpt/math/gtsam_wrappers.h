@@ -62,6 +62,52 @@ static gtsam::Matrix6 to_gtsam_se3_cov6_reordering(const mrpt::math::CMatrixDoub
   return C;
 }
 
+/** Zero-copy, read-only view of a **symmetric** fixed-size MRPT matrix (e.g.
+ * a covariance or information block) as the column-major Eigen type GTSAM
+ * expects. MRPT matrices are RowMajor, so the reinterpretation is only valid
+ * for symmetric contents; no element is copied or reordered.
+ * \note [New in MRPT 2.14.5] */
+template <std::size_t N>
+static Eigen::Map<const Eigen::Matrix<double, N, N>> view_sym_as_gtsam(
+    const mrpt::math::CMatrixFixed<double, N, N>& m)
+{
+  return Eigen::Map<const Eigen::Matrix<double, N, N>>(m.data());
+}
+
+/** \overload Writable view: lets GTSAM/Eigen expressions be evaluated
+ * directly into MRPT storage. The written result must be symmetric for the
+ * same reason as above.
+ * \note [New in MRPT 2.14.5] */
+template <std::size_t N>
+static Eigen::Map<Eigen::Matrix<double, N, N>> view_sym_as_gtsam(
+    mrpt::math::CMatrixFixed<double, N, N>& m)
+{
+  return Eigen::Map<Eigen::Matrix<double, N, N>>(m.data());
+}
+
+/** \overload writing into a caller-provided matrix (no temporary)
+ * \note [New in MRPT 2.14.5] */
+static void to_mrpt_se3_cov6(const gtsam::Matrix6& se3_cov, mrpt::math::CMatrixDouble66& C)
+{
+  // MRPT : X ,Y,Z,YAW,PITCH,ROLL
+  // GTSAM: RX RY RZ X Y Z
+  constexpr unsigned int mapping[6] = {5, 4, 3, 0, 1, 2};
+  for (int i = 0; i < 6; i++)
+    for (int j = 0; j < 6; j++) C(mapping[i], mapping[j]) = se3_cov(i, j);
+}
+
+/** \overload writing into a caller-provided matrix (no temporary)
+ * \note [New in MRPT 2.14.5] */
+static void to_gtsam_se3_cov6_reordering(
+    const mrpt::math::CMatrixDouble66& se3_cov, gtsam::Matrix6& C)
+{
+  // MRPT : X ,Y,Z,YAW,PITCH,ROLL
+  // GTSAM: RX RY RZ X Y Z
+  constexpr unsigned int mapping[6] = {5, 4, 3, 0, 1, 2};
+  for (int i = 0; i < 6; i++)
+    for (int j = 0; j < 6; j++) C(i, j) = se3_cov(mapping[i], mapping[j]);
+}
+
 static gtsam::Matrix6 to_gtsam_se3_cov6_isotropic(const mrpt::math::CMatrixDouble66& se3_cov)
 {
   gtsam::Matrix6 C = to_gtsam_se3_cov6_reordering(se3_cov);
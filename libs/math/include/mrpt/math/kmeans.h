@@ -15,6 +15,39 @@ namespace mrpt
 {
 namespace math
 {
+/** Options for the k-means front-ends kmeans() and kmeanspp().
+ * Calls with at least parallel_min_points input points, or explicitly
+ * requesting mini-batches, are clustered with a blocked multi-threaded Lloyd
+ * iteration; smaller problems keep using the bundled single-threaded kmeans++
+ * library, as before.
+ * \note [New in MRPT 2.14.5]
+ * \ingroup mrpt_math_grp
+ */
+struct TKMeansOptions
+{
+  TKMeansOptions() = default;
+
+  /** Maximum number of Lloyd (or mini-batch) iterations. */
+  size_t max_iterations{100};
+
+  /** Convergence threshold: iterations stop when the relative cost
+   * improvement of one full Lloyd pass falls below this value. */
+  double epsilon{1e-6};
+
+  /** If >0, runs mini-batch k-means (Sculley, 2010) with random batches of
+   * this size instead of full Lloyd passes: much faster on very large point
+   * sets, at a small cost in clustering quality. */
+  size_t minibatch_size{0};
+
+  /** Number of worker threads for the assignment step (0=all hardware
+   * threads). */
+  size_t num_threads{0};
+
+  /** Minimum number of input points to switch from the bundled
+   * single-threaded implementation to the multi-threaded one. */
+  size_t parallel_min_points{4096};
+};
+
 namespace detail
 {
 // Auxiliary method: templatized for working with float/double's.
@@ -27,18 +60,20 @@ double internal_kmeans(
     const SCALAR* points,
     const size_t attempts,
     SCALAR* out_center,
-    int* out_assignments);
+    int* out_assignments,
+    const TKMeansOptions& options);
 
 // Auxiliary method, the actual code of the two front-end functions offered to
 // the user below.
 template <class LIST_OF_VECTORS1, class LIST_OF_VECTORS2>
 double stub_kmeans(
-    [[maybe_unused]] const bool use_kmeansplusplus_method,
+    const bool use_kmeansplusplus_method,
     const size_t k,
     const LIST_OF_VECTORS1& points,
     std::vector<int>& assignments,
     LIST_OF_VECTORS2* out_centers,
-    const size_t attempts)
+    const size_t attempts,
+    const TKMeansOptions& options)
 {
   MRPT_START
   ASSERT_(k >= 1);
@@ -75,7 +110,8 @@ double stub_kmeans(
   // Call the internal implementation:
   std::vector<typename TInnerVectorCenters::value_type> centers(dims * k);
   const double ret = detail::internal_kmeans(
-      false, N, k, points.begin()->size(), &raw_vals[0], attempts, &centers[0], &assignments[0]);
+      use_kmeansplusplus_method, N, k, points.begin()->size(), &raw_vals[0], attempts, &centers[0],
+      &assignments[0], options);
   // Centers:
   if (out_centers)
   {
@@ -115,10 +151,12 @@ double stub_kmeans(
  *each group. Can be of any of the supported types of "points", but the basic
  *coordinates should be float or double exactly as in "points".
  *  \param attempts [IN] Number of attempts.
+ *  \param options [IN] Iteration limits, threading and mini-batch settings.
  *
  * \sa A more advanced algorithm, see: kmeanspp
  * \note Uses the kmeans++ implementation by David Arthur (2009,
- *http://www.stanford.edu/~darthur/kmpp.zip).
+ *http://www.stanford.edu/~darthur/kmpp.zip) for small point sets, and a
+ *blocked multi-threaded Lloyd iteration for large ones (see TKMeansOptions).
  */
 template <class LIST_OF_VECTORS1, class LIST_OF_VECTORS2>
 inline double kmeans(
@@ -126,10 +164,11 @@ inline double kmeans(
     const LIST_OF_VECTORS1& points,
     std::vector<int>& assignments,
     LIST_OF_VECTORS2* out_centers = nullptr,
-    const size_t attempts = 3)
+    const size_t attempts = 3,
+    const TKMeansOptions& options = TKMeansOptions())
 {
   return detail::stub_kmeans(
-      false /* standard method */, k, points, assignments, out_centers, attempts);
+      false /* standard method */, k, points, assignments, out_centers, attempts, options);
 }
 
 /** k-means++ algorithm to cluster a list of N points of arbitrary
@@ -151,10 +190,13 @@ inline double kmeans(
  *each group. Can be of any of the supported types of "points", but the basic
  *coordinates should be float or double exactly as in "points".
  *  \param attempts [IN] Number of attempts.
+ *  \param options [IN] Iteration limits, threading and mini-batch settings.
  *
  * \sa The standard kmeans algorithm, see: kmeans
  * \note Uses the kmeans++ implementation by David Arthur (2009,
- *http://www.stanford.edu/~darthur/kmpp.zip).
+ *http://www.stanford.edu/~darthur/kmpp.zip) for small point sets, and a
+ *blocked multi-threaded Lloyd iteration with kmeans++ seeding for large ones
+ *(see TKMeansOptions).
  */
 template <class LIST_OF_VECTORS1, class LIST_OF_VECTORS2 = LIST_OF_VECTORS1>
 inline double kmeanspp(
@@ -162,10 +204,11 @@ inline double kmeanspp(
     const LIST_OF_VECTORS1& points,
     std::vector<int>& assignments,
     LIST_OF_VECTORS2* out_centers = nullptr,
-    const size_t attempts = 3)
+    const size_t attempts = 3,
+    const TKMeansOptions& options = TKMeansOptions())
 {
   return detail::stub_kmeans(
-      true /* kmeans++ algorithm*/, k, points, assignments, out_centers, attempts);
+      true /* kmeans++ algorithm*/, k, points, assignments, out_centers, attempts, options);
 }
 
 /** @} */
@@ -81,6 +81,38 @@ class ModelSearch
       typename TModelFit::Model& p_bestModel,
       std::vector<size_t>& p_inliers);
 
+  /** Multi-threaded version of ransacSingleModel(), for costly models or
+   * dense sample sets (e.g. line/plane extraction over full scans).
+   *
+   * Candidate models are scored concurrently: candidate index `i` always
+   * draws its samples from a private RNG seeded with `p_seed + i`, candidates
+   * are processed in synchronized rounds, and ties between equally-scored
+   * models are broken towards the lowest candidate index, so the result is
+   * reproducible for a given seed regardless of the number of threads or
+   * their scheduling. Each worker keeps its own inlier set and the current
+   * best inlier count is shared through an atomic so hopeless candidates are
+   * abandoned early. As in ransacSingleModel(), the number of candidates
+   * actually evaluated adapts to the inlier ratio of the best model found,
+   * up to \a p_maxIterations.
+   *
+   * Requires the \a TModelFit callbacks (fitModel, testSample) to be
+   * const-thread-safe.
+   *
+   * \param p_numThreads Number of worker threads, or 0 (default) to use all
+   *   CPU cores.
+   * \note [New in MRPT 2.14.5]
+   */
+  template <typename TModelFit>
+  bool ransacSingleModelParallel(
+      const TModelFit& p_state,
+      size_t p_kernelSize,
+      const typename TModelFit::Real& p_fitnessThreshold,
+      typename TModelFit::Model& p_bestModel,
+      std::vector<size_t>& p_inliers,
+      size_t p_maxIterations = 100,
+      uint32_t p_seed = 0,
+      size_t p_numThreads = 0);
+
  private:
   template <typename TModelFit>
   struct TSpecies
@@ -15,11 +15,14 @@
 
 #include <mrpt/core/exceptions.h>  // ASSERT_()
 #include <mrpt/core/round.h>
+#include <mrpt/random/RandomGenerators.h>
 
 #include <algorithm>  // std::max(),...
+#include <atomic>
 #include <cmath>
 #include <limits>
 #include <string>
+#include <thread>
 
 namespace mrpt::math
 {
@@ -94,6 +97,156 @@ bool ModelSearch::ransacSingleModel(
   return true;
 }
 
+//----------------------------------------------------------------------
+//! Multi-threaded, reproducible version of ransacSingleModel()
+template <typename TModelFit>
+bool ModelSearch::ransacSingleModelParallel(
+    const TModelFit& p_state,
+    size_t p_kernelSize,
+    const typename TModelFit::Real& p_fitnessThreshold,
+    typename TModelFit::Model& p_bestModel,
+    std::vector<size_t>& p_inliers,
+    size_t p_maxIterations,
+    uint32_t p_seed,
+    size_t p_numThreads)
+{
+  const size_t NONE = std::string::npos;
+  const size_t nSamples = p_state.getSampleCount();
+  ASSERT_(nSamples >= p_kernelSize);
+
+  size_t nThreads =
+      p_numThreads ? p_numThreads : std::max<size_t>(1, std::thread::hardware_concurrency());
+
+  struct TBest
+  {
+    size_t score = 0;
+    size_t candidateIdx = std::string::npos;
+    typename TModelFit::Model model;
+    std::vector<size_t> inliers;
+  };
+  std::vector<TBest> threadBests(nThreads);
+  std::atomic<size_t> sharedBestScore{0};
+
+  // Candidates are processed in rounds of nThreads*CANDIDATES_PER_THREAD,
+  // with a deterministic merge + adaptive-iteration update between rounds:
+  // thread timing can therefore never change which candidates get evaluated.
+  const size_t CANDIDATES_PER_THREAD = 8;
+
+  TBest globalBest;
+  size_t nextCandidate = 0;
+  size_t softIterLimit = 1;  // updated after the first round, as in ransacSingleModel()
+  bool firstRound = true;
+
+  while (nextCandidate < p_maxIterations && (firstRound || nextCandidate < softIterLimit))
+  {
+    size_t roundEnd = std::min(p_maxIterations, nextCandidate + nThreads * CANDIDATES_PER_THREAD);
+    if (!firstRound) roundEnd = std::min(roundEnd, softIterLimit);
+
+    std::vector<std::exception_ptr> excepts(nThreads);
+
+    auto worker = [&](size_t threadIdx)
+    {
+      try
+      {
+        TBest& best = threadBests[threadIdx];
+        std::vector<size_t> ind(p_kernelSize);
+        std::vector<size_t> inliers;
+        for (size_t i = nextCandidate + threadIdx; i < roundEnd; i += nThreads)
+        {
+          // Deterministic per-candidate sampling:
+          mrpt::random::CRandomGenerator rng(static_cast<uint32_t>(p_seed + i));
+          for (size_t k = 0; k < p_kernelSize;)
+          {
+            const size_t idx = rng.drawUniform32bit() % nSamples;
+            bool dup = false;
+            for (size_t l = 0; l < k; l++)
+              if (ind[l] == idx)
+              {
+                dup = true;
+                break;
+              }
+            if (!dup) ind[k++] = idx;
+          }
+
+          typename TModelFit::Model model;
+          if (!p_state.fitModel(ind, model)) continue;  // degenerate sample
+
+          // Collect inliers, giving up as soon as this candidate cannot
+          // reach the best score found so far by any thread (a tie could
+          // still win on candidate index, hence the strict "<"):
+          const size_t bestSoFar = sharedBestScore.load(std::memory_order_relaxed);
+          inliers.clear();
+          bool hopeless = false;
+          for (size_t j = 0; j < nSamples; j++)
+          {
+            if (p_state.testSample(j, model) < p_fitnessThreshold)
+              inliers.push_back(j);
+            else if (inliers.size() + (nSamples - j - 1) < bestSoFar)
+            {
+              hopeless = true;
+              break;
+            }
+          }
+          if (hopeless || inliers.empty() || inliers.size() <= best.score) continue;
+
+          best.score = inliers.size();
+          best.candidateIdx = i;
+          best.model = model;
+          best.inliers.swap(inliers);
+
+          size_t prev = sharedBestScore.load(std::memory_order_relaxed);
+          while (best.score > prev && !sharedBestScore.compare_exchange_weak(prev, best.score))
+          {
+          }
+        }
+      }
+      catch (...)
+      {
+        excepts[threadIdx] = std::current_exception();
+      }
+    };
+
+    if (nThreads == 1) { worker(0); }
+    else
+    {
+      std::vector<std::thread> threads;
+      threads.reserve(nThreads);
+      for (size_t t = 0; t < nThreads; t++) threads.emplace_back(worker, t);
+      for (auto& t : threads) t.join();
+    }
+    for (auto& e : excepts)
+      if (e) std::rethrow_exception(e);
+
+    // Deterministic merge: best score, ties towards the lowest candidate:
+    for (const auto& b : threadBests)
+    {
+      if (b.candidateIdx == NONE) continue;
+      if (b.score > globalBest.score ||
+          (b.score == globalBest.score && b.candidateIdx < globalBest.candidateIdx))
+        globalBest = b;
+    }
+
+    // Update the estimation of the required number of iterations to pick a
+    // dataset with no outliers at probability p (same as ransacSingleModel):
+    {
+      const double f = globalBest.score / static_cast<double>(nSamples);
+      double p = 1 - std::pow(f, static_cast<double>(p_kernelSize));
+      const double eps = std::numeric_limits<double>::epsilon();
+      p = std::max(eps, p);      // Avoid division by -Inf
+      p = std::min(1 - eps, p);  // Avoid division by 0.
+      softIterLimit = mrpt::round(log(1 - p) / log(p));
+    }
+
+    firstRound = false;
+    nextCandidate = roundEnd;
+  }
+
+  if (globalBest.candidateIdx == NONE) return false;
+  p_bestModel = globalBest.model;
+  p_inliers = globalBest.inliers;
+  return true;
+}
+
 //----------------------------------------------------------------------
 //! Run a generic programming version of ransac searching for a single model
 template <typename TModelFit>
@@ -72,6 +72,26 @@ class RANSAC_Template : public mrpt::system::COutputLogger
   using TRansacDegenerateFunctor =
       std::function<bool(const DATASET& allData, const std::vector<size_t>& useIndices)>;
 
+  /** Per-point residual function for executeBatched(): returns the distance
+   * of the given data point to the given model.
+   * \note [New in MRPT 2.14.5] */
+  using TRansacPointDistanceFunctor =
+      std::function<NUMTYPE(const DATASET& allData, const MODEL& testModel, size_t pointIdx)>;
+
+  /** Optional bulk inlier-counting function for executeBatched(): returns
+   * the number of points whose distance to the model is below
+   * `distanceThreshold`. Implementations are allowed to bail out early,
+   * returning any value smaller than the real count, as soon as they can
+   * prove the count cannot reach `bailOutAt`. Specialized kernels can
+   * process the points in flat, vectorization-friendly blocks: see the
+   * built-in 3D-plane and 2D-line kernels in ransac_applications.cpp.
+   * \note [New in MRPT 2.14.5] */
+  using TRansacInlierCountFunctor = std::function<size_t(
+      const DATASET& allData,
+      const MODEL& testModel,
+      NUMTYPE distanceThreshold,
+      size_t bailOutAt)>;
+
   /** An implementation of the RANSAC algorithm for robust fitting of models
    * to data.
    *
@@ -97,6 +117,38 @@ class RANSAC_Template : public mrpt::system::COutputLogger
       const double prob_good_sample = 0.999,
       const size_t maxIter = 2000) const;
 
+  /** Batched, multi-threaded variant of execute(): hypotheses are generated
+   * up front in batches of `batchSize`, then scored concurrently in worker
+   * threads. Hopeless hypotheses are abandoned early via Wald's sequential
+   * probability ratio test (SPRT) plus an exact cannot-improve-on-the-best
+   * bound, so on large datasets most hypotheses are only partially
+   * evaluated.
+   *
+   * Scoring uses the per-point residual `point_dist_func` (also used to
+   * extract the final inlier set); an optional `inlier_count_func` bulk
+   * kernel can replace the generic per-point scoring loop, e.g. with a
+   * vectorized implementation for a concrete model type.
+   *
+   * \note Like any SPRT-based scheme, in rare cases the early bail-out may
+   * discard a hypothesis that a full evaluation would have kept; use
+   * execute() when exact Kovesi-style semantics are required.
+   * \note [New in MRPT 2.14.5]
+   * \return false if no good solution was found, true on success.
+   */
+  bool executeBatched(
+      const DATASET& data,
+      const TRansacFitFunctor& fit_func,
+      const TRansacPointDistanceFunctor& point_dist_func,
+      const TRansacDegenerateFunctor& degen_func,
+      const double distanceThreshold,
+      const unsigned int minimumSizeSamplesToFit,
+      std::vector<size_t>& out_best_inliers,
+      MODEL& out_best_model,
+      const double prob_good_sample = 0.999,
+      const size_t maxIter = 2000,
+      const size_t batchSize = 128,
+      const TRansacInlierCountFunctor& inlier_count_func = TRansacInlierCountFunctor()) const;
+
 };  // end class
 
 /** The default instance of RANSAC, for double type */
@@ -76,6 +76,66 @@ inline void ransac_detect_3D_planes(
   ransac_detect_3D_planes(xs, ys, zs, out_detected_planes, threshold, min_inliers_for_valid_plane);
 }
 
+/** @} */
+
+/** @name Built-in RANSAC model functors for 3D planes and 2D lines, usable
+  with RANSAC_Template::executeBatched() (instantiated for float and double)
+  \note [New in MRPT 2.14.5]
+  @{
+  */
+
+/** Fits a plane to 3 sample points of a 3xN dataset */
+template <typename T>
+void ransac3Dplane_fit(
+    const CMatrixDynamic<T>& allData,
+    const std::vector<size_t>& useIndices,
+    std::vector<CMatrixDynamic<T>>& fitModels);
+
+/** Always returns false (any 3 points define a candidate plane) */
+template <typename T>
+bool ransac3Dplane_degenerate(
+    const CMatrixDynamic<T>& allData, const std::vector<size_t>& useIndices);
+
+/** Point-to-plane distance of the i-th point of a 3xN dataset */
+template <typename T>
+T ransac3Dplane_point_distance(
+    const CMatrixDynamic<T>& allData, const CMatrixDynamic<T>& testModel, size_t i);
+
+/** Vectorization-friendly bulk inlier counter for 3D planes, with early
+ * bail-out once the count provably cannot reach `bailOutAt` */
+template <typename T>
+size_t ransac3Dplane_count(
+    const CMatrixDynamic<T>& allData,
+    const CMatrixDynamic<T>& testModel,
+    T distanceThreshold,
+    size_t bailOutAt);
+
+/** Fits a 2D line to 2 sample points of a 2xN dataset */
+template <typename T>
+void ransac2Dline_fit(
+    const CMatrixDynamic<T>& allData,
+    const std::vector<size_t>& useIndices,
+    std::vector<CMatrixDynamic<T>>& fitModels);
+
+/** Always returns false (any 2 points define a candidate line) */
+template <typename T>
+bool ransac2Dline_degenerate(
+    const CMatrixDynamic<T>& allData, const std::vector<size_t>& useIndices);
+
+/** Point-to-line distance of the i-th point of a 2xN dataset */
+template <typename T>
+T ransac2Dline_point_distance(
+    const CMatrixDynamic<T>& allData, const CMatrixDynamic<T>& testModel, size_t i);
+
+/** Vectorization-friendly bulk inlier counter for 2D lines, with early
+ * bail-out once the count provably cannot reach `bailOutAt` */
+template <typename T>
+size_t ransac2Dline_count(
+    const CMatrixDynamic<T>& allData,
+    const CMatrixDynamic<T>& testModel,
+    T distanceThreshold,
+    size_t bailOutAt);
+
 /** @} */
 /** @} */  // end of grouping
 
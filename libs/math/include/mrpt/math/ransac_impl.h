@@ -8,10 +8,15 @@
    +------------------------------------------------------------------------+ */
 #pragma once
 
+#include <mrpt/core/WorkerThreadsPool.h>
 #include <mrpt/core/exceptions.h>
 #include <mrpt/random/RandomGenerators.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <future>
+#include <thread>
 #include <vector>
 
 // To be included from ransac.h only
@@ -172,4 +177,205 @@ bool RANSAC_Template<NUMTYPE, DATASET, MODEL>::execute(
   MRPT_END
 }
 
+template <typename NUMTYPE, typename DATASET, typename MODEL>
+bool RANSAC_Template<NUMTYPE, DATASET, MODEL>::executeBatched(
+    const DATASET& data,
+    const TRansacFitFunctor& fit_func,
+    const TRansacPointDistanceFunctor& point_dist_func,
+    const TRansacDegenerateFunctor& degen_func,
+    const double distanceThreshold,
+    const unsigned int minimumSizeSamplesToFit,
+    std::vector<size_t>& out_best_inliers,
+    MODEL& out_best_model,
+    const double p,
+    const size_t maxIter,
+    const size_t batchSize,
+    const TRansacInlierCountFunctor& inlier_count_func) const
+{
+  MRPT_START
+
+  ASSERT_GE_(minimumSizeSamplesToFit, 1U);
+  ASSERT_GE_(batchSize, 1U);
+
+  const size_t Npts = ransacDatasetSize(data);
+  ASSERT_GT_(Npts, 1);
+
+  // Maximum number of attempts to select a non-degenerate data set.
+  const size_t maxDataTrials = 100;
+
+  out_best_model = MODEL();
+  out_best_inliers.clear();
+
+  // Generic SPRT-based scorer, used when no bulk kernel is provided:
+  const TRansacInlierCountFunctor genericCounter =
+      [&point_dist_func](const DATASET& d, const MODEL& m, NUMTYPE thr, size_t bailOutAt)
+  {
+    const size_t n = ransacDatasetSize(d);
+
+    // Wald's SPRT: test "this is a bad model" (inlier ratio delta) against
+    // "this is a good model" (inlier ratio epsilon, from the best score so
+    // far); reject the hypothesis once the likelihood ratio exceeds A.
+    const double eps = std::min(0.95, std::max(0.05, bailOutAt / double(n)));
+    const double delta = std::max(0.01, 0.25 * eps);
+    const double A = 1e4;
+    const double mulIn = delta / eps;
+    const double mulOut = (1.0 - delta) / (1.0 - eps);
+
+    double lambda = 1.0;
+    size_t cnt = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+      if (point_dist_func(d, m, i) < thr)
+      {
+        cnt++;
+        lambda *= mulIn;
+      }
+      else
+      {
+        lambda *= mulOut;
+      }
+
+      if ((i & 0xFF) == 0xFF)
+      {
+        // Exact bound: not enough points left to reach bailOutAt.
+        if (cnt + (n - i - 1) < bailOutAt) return cnt;
+        // SPRT rejection:
+        if (lambda > A) return cnt;
+        // Avoid underflow for very good models:
+        if (lambda < 1e-6) lambda = 1e-6;
+      }
+    }
+    return cnt;
+  };
+  const TRansacInlierCountFunctor& counter =
+      inlier_count_func ? inlier_count_func : genericCounter;
+
+  const size_t nWorkers = std::max(1u, std::thread::hardware_concurrency());
+  mrpt::WorkerThreadsPool pool(nWorkers, mrpt::WorkerThreadsPool::POLICY_FIFO, "ransac_batch");
+
+  size_t trialcount = 0;
+  size_t bestscore = std::string::npos;  // npos will mean "none"
+  size_t N = 1;  // Dummy initialisation for number of trials.
+
+  std::vector<size_t> ind(minimumSizeSamplesToFit);
+  std::vector<MODEL> batchModels;
+  std::vector<size_t> batchScores;
+
+  while (N > trialcount && trialcount <= maxIter)
+  {
+    // 1) Generate a batch of hypotheses up front.
+    //    (sequential: it shares the global random generator)
+    const size_t K = std::min(batchSize, 1 + maxIter - trialcount);
+    batchModels.clear();
+    for (size_t k = 0; k < K; k++)
+    {
+      bool degenerate = true;
+      size_t count = 1;
+      std::vector<MODEL> MODELS;
+      while (degenerate)
+      {
+        ind.resize(minimumSizeSamplesToFit);
+        mrpt::random::getRandomGenerator().drawUniformVector(ind, 0.0, Npts - 1 + 0.999999);
+        degenerate = degen_func(data, ind);
+        if (!degenerate)
+        {
+          fit_func(data, ind, MODELS);
+          degenerate = MODELS.empty();
+        }
+        if (++count > maxDataTrials)
+        {
+          MRPT_LOG_WARN("Unable to select a nondegenerate data set");
+          break;
+        }
+      }
+      if (!degenerate)
+        for (auto& m : MODELS) batchModels.push_back(std::move(m));
+    }
+
+    // 2) Score all the hypotheses of the batch in parallel. The score to
+    //    beat is shared so later hypotheses can bail out ever earlier.
+    const size_t nModels = batchModels.size();
+    batchScores.assign(nModels, 0);
+    std::atomic<size_t> bestKnown{bestscore == std::string::npos ? 0 : bestscore};
+
+    std::vector<std::future<void>> futs;
+    futs.reserve(nWorkers);
+    for (size_t w = 0; w < nWorkers; w++)
+    {
+      futs.emplace_back(pool.enqueue(
+          [&, w]()
+          {
+            const size_t i0 = (nModels * w) / nWorkers;
+            const size_t i1 = (nModels * (w + 1)) / nWorkers;
+            for (size_t i = i0; i < i1; i++)
+            {
+              const size_t bailOutAt = bestKnown.load(std::memory_order_relaxed) + 1;
+              const size_t sc = counter(
+                  data, batchModels[i], static_cast<NUMTYPE>(distanceThreshold), bailOutAt);
+              batchScores[i] = sc;
+              // lock-free max update:
+              size_t prev = bestKnown.load(std::memory_order_relaxed);
+              while (sc > prev && !bestKnown.compare_exchange_weak(prev, sc)) continue;
+            }
+          }));
+    }
+    for (auto& f : futs) f.wait();
+
+    // 3) Keep the best hypothesis of the batch, if it improves the overall
+    //    best, and re-estimate the required number of trials:
+    size_t bestOfBatch = 0;
+    for (size_t i = 1; i < nModels; i++)
+      if (batchScores[i] > batchScores[bestOfBatch]) bestOfBatch = i;
+
+    const size_t batchBestScore = nModels ? batchScores[bestOfBatch] : 0;
+    bool update_estim_num_iters = (trialcount == 0);
+
+    if (batchBestScore > bestscore || (bestscore == std::string::npos && batchBestScore != 0))
+    {
+      // Extract the exact inlier set of the winner (its parallel scoring
+      // might have bailed out before seeing all the points):
+      out_best_inliers.clear();
+      for (size_t i = 0; i < Npts; i++)
+        if (point_dist_func(data, batchModels[bestOfBatch], i) <
+            static_cast<NUMTYPE>(distanceThreshold))
+          out_best_inliers.push_back(i);
+
+      bestscore = out_best_inliers.size();
+      out_best_model = std::move(batchModels[bestOfBatch]);
+      update_estim_num_iters = true;
+    }
+
+    if (update_estim_num_iters)
+    {
+      const size_t ninliers = (bestscore == std::string::npos) ? 0 : bestscore;
+      double fracinliers = ninliers / static_cast<double>(Npts);
+      double pNoOutliers = 1 - pow(fracinliers, static_cast<double>(minimumSizeSamplesToFit));
+      pNoOutliers = std::max(std::numeric_limits<double>::epsilon(), pNoOutliers);
+      pNoOutliers = std::min(1.0 - std::numeric_limits<double>::epsilon(), pNoOutliers);
+      N = static_cast<size_t>(log(1 - p) / log(pNoOutliers));
+      MRPT_LOG_DEBUG_FMT(
+          "Batch of %u hypotheses. Estimated number of iters: %u  #inliers: %u",
+          (unsigned)nModels, (unsigned)N, (unsigned)ninliers);
+    }
+
+    trialcount += K;
+  }
+
+  if (trialcount > maxIter)
+    MRPT_LOG_WARN_FMT("Warning: maximum number of trials (%u) reached\n", (unsigned)maxIter);
+
+  if (!out_best_inliers.empty())
+  {  // We got a solution
+    MRPT_LOG_INFO_FMT("Finished in %u iterations.", (unsigned)trialcount);
+    return true;
+  }
+  else
+  {
+    MRPT_LOG_WARN("Finished without any proper solution");
+    return false;
+  }
+
+  MRPT_END
+}
+
 }  // namespace mrpt::math
@@ -51,6 +51,13 @@ void CAtan2LookUpTable::resize(
   }
 }
 
+void CAtan2LookUpTable::atan2Many(
+    size_t n, const double* ys, const double* xs, double* outs) const noexcept
+{
+  for (size_t i = 0; i < n; i++)
+    if (!atan2(ys[i], xs[i], outs[i])) outs[i] = ::atan2(ys[i], xs[i]);
+}
+
 CAtan2LookUpTableMultiRes::CAtan2LookUpTableMultiRes(
     const std::map<double, double>& lst_resolutions2extensions) noexcept
 {
@@ -59,48 +66,46 @@ CAtan2LookUpTableMultiRes::CAtan2LookUpTableMultiRes(
 void CAtan2LookUpTableMultiRes::resize(
     const std::map<double, double>& lst_resolutions2extensions) noexcept
 {
-  m_grids.clear();
+  m_levels.clear();
+  m_levels.reserve(lst_resolutions2extensions.size());
 
   for (const auto& it : lst_resolutions2extensions)
   {
     const double res = it.first;
     const double exten = it.second;
 
-    mrpt::containers::CDynamicGrid<double>& dg = m_grids[exten] =
-        mrpt::containers::CDynamicGrid<double>(-exten, exten, -exten, exten, res);
+    // Build through a CDynamicGrid so the cell geometry (and hence the
+    // accuracy) is identical to the former per-query grid storage:
+    const mrpt::containers::CDynamicGrid<double> dg(-exten, exten, -exten, exten, res);
 
-    const size_t nx = dg.getSizeX(), ny = dg.getSizeY();
-    std::vector<double> idx2x(nx), idx2y(ny);
+    TLevel lvl;
+    lvl.extension = exten;
+    lvl.x_min = dg.getXMin();
+    lvl.y_min = dg.getYMin();
+    lvl.invRes = 1.0 / dg.getResolution();
+    lvl.sizeX = static_cast<int32_t>(dg.getSizeX());
+    lvl.sizeY = static_cast<int32_t>(dg.getSizeY());
+    lvl.tab.resize(static_cast<size_t>(lvl.sizeX) * lvl.sizeY);
 
-    for (size_t ix = 0; ix < nx; ix++) idx2x[ix] = dg.idx2x(ix);
-    for (size_t iy = 0; iy < ny; iy++) idx2y[iy] = dg.idx2y(iy);
-
-    for (size_t ix = 0; ix < nx; ix++)
+    for (int32_t iy = 0; iy < lvl.sizeY; iy++)
     {
-      const double x = idx2x[ix];
-      for (size_t iy = 0; iy < ny; iy++)
-      {
-        const double y = idx2y[iy];
-        double* cp = dg.cellByIndex(ix, iy);
-        if (cp) *cp = ::atan2(y, x);
-      }
+      const double y = dg.idx2y(iy);
+      double* row = &lvl.tab[static_cast<size_t>(iy) * lvl.sizeX];
+      for (int32_t ix = 0; ix < lvl.sizeX; ix++) row[ix] = ::atan2(y, dg.idx2x(ix));
     }
+    m_levels.emplace_back(std::move(lvl));
   }
+
+  // std::map already iterates by ascending resolution, but sort by extension
+  // explicitly: the finest (smallest) level must be probed first.
+  std::sort(
+      m_levels.begin(), m_levels.end(),
+      [](const TLevel& a, const TLevel& b) { return a.extension < b.extension; });
 }
 
-bool CAtan2LookUpTableMultiRes::atan2(double y, double x, double& out_atan2) const noexcept
+void CAtan2LookUpTableMultiRes::atan2Many(
+    size_t n, const double* ys, const double* xs, double* outs) const noexcept
 {
-  for (const auto& it : m_grids)
-  {
-    const double exten = it.first;
-    const mrpt::containers::CDynamicGrid<double>& dg = it.second;
-
-    if (std::abs(x) > exten || std::abs(y) > exten) continue;
-
-    const double* cp = dg.cellByPos(x, y);
-    if (!cp) continue;
-    out_atan2 = *cp;
-    return true;
-  }
-  return false;
+  for (size_t i = 0; i < n; i++)
+    if (!atan2(ys[i], xs[i], outs[i])) outs[i] = ::atan2(ys[i], xs[i]);
 }
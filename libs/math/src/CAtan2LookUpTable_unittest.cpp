@@ -62,3 +62,46 @@ TEST(CAtan2LookUpTable, MultiResTest)
 
   atan2_lut_test(atan2lut, SIZE, 0.5 /*max error*/, 0.4 /* skip zone */);
 }
+
+TEST(CAtan2LookUpTable, batchQueries)
+{
+  const double SIZE = 20.0;
+  mrpt::math::CAtan2LookUpTableMultiRes atan2lut;
+  std::map<double, double> res2extension;
+  res2extension[0.01] = 2.0;  // 1.0 cm resolution
+  res2extension[0.05] = 8.0;  // 5.0 cm resolution
+  atan2lut.resize(res2extension);
+
+  const size_t N = 500;
+  std::vector<double> xs(N), ys(N), outs(N);
+  for (size_t i = 0; i < N; i++)
+  {
+    // Note the range exceeds the largest extension on purpose, to exercise
+    // the exact std::atan2() fallback of the batch API:
+    xs[i] = mrpt::random::getRandomGenerator().drawUniform(-SIZE, SIZE);
+    ys[i] = mrpt::random::getRandomGenerator().drawUniform(-SIZE, SIZE);
+  }
+
+  atan2lut.atan2Many(N, ys.data(), xs.data(), outs.data());
+
+  for (size_t i = 0; i < N; i++)
+  {
+    double scalarOut = 0;
+    if (atan2lut.atan2(ys[i], xs[i], scalarOut))
+      EXPECT_EQ(outs[i], scalarOut) << "i=" << i;
+    else
+      EXPECT_EQ(outs[i], ::atan2(ys[i], xs[i])) << "i=" << i;
+  }
+
+  // Same contract for the single-resolution LUT:
+  mrpt::math::CAtan2LookUpTable lut(-2.0, 2.0, -2.0, 2.0, 0.01);
+  lut.atan2Many(N, ys.data(), xs.data(), outs.data());
+  for (size_t i = 0; i < N; i++)
+  {
+    double scalarOut = 0;
+    if (lut.atan2(ys[i], xs[i], scalarOut))
+      EXPECT_EQ(outs[i], scalarOut) << "i=" << i;
+    else
+      EXPECT_EQ(outs[i], ::atan2(ys[i], xs[i])) << "i=" << i;
+  }
+}
@@ -0,0 +1,288 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include "math-precomp.h"  // Precompiled headers
+//
+#include <mrpt/math/CBVH3D.h>
+#include <mrpt/math/geometry.h>
+
+#include <algorithm>
+
+using namespace mrpt::math;
+
+namespace
+{
+constexpr size_t BVH_MAX_LEAF_SIZE = 4;
+
+// Bounding box of one bounded primitive; returns false for unbounded ones
+// (lines, planes) and for empty objects.
+bool boundedObjectBBox(const TObject3D& o, TBoundingBox& bb)
+{
+  bb = TBoundingBox::PlusMinusInfinity();
+  if (o.isPoint())
+  {
+    bb.updateWithPoint(o.getAs<TPoint3D>());
+    return true;
+  }
+  if (o.isSegment())
+  {
+    const auto& s = o.getAs<TSegment3D>();
+    bb.updateWithPoint(s.point1);
+    bb.updateWithPoint(s.point2);
+    return true;
+  }
+  if (o.isPolygon())
+  {
+    const auto& p = o.getAs<TPolygon3D>();
+    if (p.empty()) return false;
+    for (const auto& v : p) bb.updateWithPoint(v);
+    return true;
+  }
+  return false;  // line, plane, or monostate
+}
+
+// Slab test of the ray org+t*dir against bb, for t in [tMin,tMax].
+// Written with plain min/max ops (no per-axis branches for the generic
+// case) so the compiler can keep it in registers and vectorize it.
+bool rayHitsBox(
+    const TBoundingBox& bb,
+    const TPoint3D& org,
+    const TPoint3D& invDir,
+    double tMin,
+    double tMax)
+{
+  for (int i = 0; i < 3; i++)
+  {
+    if (std::isinf(invDir[i]))
+    {
+      // Ray parallel to this slab: hit iff the origin lies within it
+      if (org[i] < bb.min[i] || org[i] > bb.max[i]) return false;
+      continue;
+    }
+    const double t1 = (bb.min[i] - org[i]) * invDir[i];
+    const double t2 = (bb.max[i] - org[i]) * invDir[i];
+    tMin = std::max(tMin, std::min(t1, t2));
+    tMax = std::min(tMax, std::max(t1, t2));
+  }
+  return tMin <= tMax;
+}
+
+TPoint3D safeInverse(const TPoint3D& dir)
+{
+  const auto inv = [](double d)
+  { return d != 0 ? 1.0 / d : std::numeric_limits<double>::infinity(); };
+  return {inv(dir.x), inv(dir.y), inv(dir.z)};
+}
+}  // namespace
+
+void CBVH3D::build(const std::vector<TObject3D>& objects)
+{
+  m_objects = objects;
+  m_nodes.clear();
+  m_leafObjectIndices.clear();
+  m_unboundedObjectIndices.clear();
+  m_rootBBox = TBoundingBox::PlusMinusInfinity();
+  m_rootNode = -1;
+
+  std::vector<TBoundingBox> bboxes;
+  bboxes.reserve(m_objects.size());
+
+  for (uint32_t i = 0; i < m_objects.size(); i++)
+  {
+    if (m_objects[i].empty()) continue;
+    TBoundingBox bb;
+    if (boundedObjectBBox(m_objects[i], bb))
+    {
+      m_leafObjectIndices.push_back(i);
+      bboxes.push_back(bb);
+      m_rootBBox = m_rootBBox.unionWith(bb);
+    }
+    else
+    {
+      m_unboundedObjectIndices.push_back(i);
+    }
+  }
+
+  if (m_leafObjectIndices.empty()) return;
+
+  // bboxes[] is indexed in parallel to m_leafObjectIndices[]; buildNode()
+  // keeps both permuted consistently.
+  m_nodes.reserve(2 * m_leafObjectIndices.size());
+  m_rootNode = buildNode(bboxes, 0, m_leafObjectIndices.size());
+}
+
+int32_t CBVH3D::buildNode(std::vector<TBoundingBox>& bboxes, size_t first, size_t last)
+{
+  const auto nodeIdx = static_cast<int32_t>(m_nodes.size());
+  m_nodes.emplace_back();
+
+  TBoundingBox bb = TBoundingBox::PlusMinusInfinity();
+  for (size_t i = first; i < last; i++) bb = bb.unionWith(bboxes[i]);
+  m_nodes[nodeIdx].bbox = bb;
+
+  const size_t count = last - first;
+  if (count <= BVH_MAX_LEAF_SIZE)
+  {
+    m_nodes[nodeIdx].begin = static_cast<uint32_t>(first);
+    m_nodes[nodeIdx].end = static_cast<uint32_t>(last);
+    return nodeIdx;
+  }
+
+  // Split by the median centroid along the axis of largest extent:
+  const auto centroid = [&](size_t i, int axis)
+  { return 0.5 * (bboxes[i].min[axis] + bboxes[i].max[axis]); };
+
+  TBoundingBox cb = TBoundingBox::PlusMinusInfinity();
+  for (size_t i = first; i < last; i++)
+    cb.updateWithPoint({centroid(i, 0), centroid(i, 1), centroid(i, 2)});
+
+  int axis = 0;
+  double bestExtent = -1;
+  for (int a = 0; a < 3; a++)
+  {
+    const double ext = cb.max[a] - cb.min[a];
+    if (ext > bestExtent)
+    {
+      bestExtent = ext;
+      axis = a;
+    }
+  }
+
+  // Sort both parallel arrays around the median element:
+  std::vector<size_t> order(count);
+  for (size_t i = 0; i < count; i++) order[i] = i;
+  std::nth_element(
+      order.begin(), order.begin() + count / 2, order.end(),
+      [&](size_t a, size_t b) { return centroid(first + a, axis) < centroid(first + b, axis); });
+
+  std::vector<uint32_t> objTmp(count);
+  std::vector<TBoundingBox> bbTmp(count, TBoundingBox::PlusMinusInfinity());
+  for (size_t i = 0; i < count; i++)
+  {
+    objTmp[i] = m_leafObjectIndices[first + order[i]];
+    bbTmp[i] = bboxes[first + order[i]];
+  }
+  std::copy(objTmp.begin(), objTmp.end(), m_leafObjectIndices.begin() + first);
+  std::copy(bbTmp.begin(), bbTmp.end(), bboxes.begin() + first);
+
+  const size_t mid = first + count / 2;
+  const int32_t l = buildNode(bboxes, first, mid);
+  const int32_t r = buildNode(bboxes, mid, last);
+  m_nodes[nodeIdx].left = l;
+  m_nodes[nodeIdx].right = r;
+  return nodeIdx;
+}
+
+void CBVH3D::gatherCandidates(
+    const TPoint3D& org,
+    const TPoint3D& dir,
+    double tMin,
+    double tMax,
+    std::vector<size_t>& out_candidates) const
+{
+  out_candidates.clear();
+  if (m_rootNode < 0) return;
+
+  const TPoint3D invDir = safeInverse(dir);
+
+  std::vector<int32_t> stack;
+  stack.reserve(64);
+  stack.push_back(m_rootNode);
+  while (!stack.empty())
+  {
+    const TNode& n = m_nodes[stack.back()];
+    stack.pop_back();
+    if (!rayHitsBox(n.bbox, org, invDir, tMin, tMax)) continue;
+    if (n.left < 0)
+    {
+      for (uint32_t i = n.begin; i < n.end; i++)
+        out_candidates.push_back(m_leafObjectIndices[i]);
+    }
+    else
+    {
+      stack.push_back(n.left);
+      stack.push_back(n.right);
+    }
+  }
+}
+
+bool CBVH3D::internal_intersectsAny(
+    const TObject3D& queryObj,
+    const TPoint3D& org,
+    const TPoint3D& dir,
+    double tMin,
+    double tMax,
+    TObject3D& out_intersection,
+    size_t* out_objectIndex) const
+{
+  const auto testObject = [&](size_t idx)
+  {
+    if (!mrpt::math::intersect(m_objects[idx], queryObj, out_intersection)) return false;
+    if (out_objectIndex) *out_objectIndex = idx;
+    return true;
+  };
+
+  // Unbounded primitives (lines, planes) are always tested exactly:
+  for (uint32_t idx : m_unboundedObjectIndices)
+    if (testObject(idx)) return true;
+
+  std::vector<size_t> candidates;
+  gatherCandidates(org, dir, tMin, tMax, candidates);
+  for (size_t idx : candidates)
+    if (testObject(idx)) return true;
+
+  return false;
+}
+
+bool CBVH3D::intersectsAny(
+    const TSegment3D& query, TObject3D& out_intersection, size_t* out_objectIndex) const
+{
+  const TPoint3D dir = query.point2 - query.point1;
+  return internal_intersectsAny(
+      TObject3D::From(query), query.point1, dir, 0.0, 1.0, out_intersection, out_objectIndex);
+}
+
+bool CBVH3D::intersectsAny(
+    const TLine3D& query, TObject3D& out_intersection, size_t* out_objectIndex) const
+{
+  const TPoint3D& dir = query.director;
+  constexpr double INF = std::numeric_limits<double>::max();
+  return internal_intersectsAny(
+      TObject3D::From(query), query.pBase, dir, -INF, INF, out_intersection, out_objectIndex);
+}
+
+void CBVH3D::intersectionsWith(
+    const TSegment3D& query, std::vector<std::pair<size_t, TObject3D>>& out) const
+{
+  out.clear();
+  const TObject3D queryObj = TObject3D::From(query);
+  TObject3D inter;
+
+  for (uint32_t idx : m_unboundedObjectIndices)
+    if (mrpt::math::intersect(m_objects[idx], queryObj, inter)) out.emplace_back(idx, inter);
+
+  std::vector<size_t> candidates;
+  gatherCandidates(query.point1, query.point2 - query.point1, 0.0, 1.0, candidates);
+  for (size_t idx : candidates)
+    if (mrpt::math::intersect(m_objects[idx], queryObj, inter)) out.emplace_back(idx, inter);
+
+  std::sort(out.begin(), out.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+}
+
+void CBVH3D::intersectMany(
+    const std::vector<TSegment3D>& queries, std::vector<TObject3D>& out_intersections) const
+{
+  const size_t n = queries.size();
+  out_intersections.resize(n);
+  for (size_t i = 0; i < n; i++)
+  {
+    if (!intersectsAny(queries[i], out_intersections[i]))
+      out_intersections[i] = TObject3D();  // leave empty
+  }
+}
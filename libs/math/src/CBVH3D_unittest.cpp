@@ -0,0 +1,117 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/math/CBVH3D.h>
+#include <mrpt/math/geometry.h>
+#include <mrpt/random.h>
+
+#include <set>
+
+using namespace mrpt::math;
+
+static std::vector<TObject3D> buildTestScene()
+{
+  std::vector<TObject3D> objs;
+
+  // A grid of small triangles on the z=0 plane:
+  for (int ix = 0; ix < 6; ix++)
+  {
+    for (int iy = 0; iy < 6; iy++)
+    {
+      TPolygon3D tri;
+      tri.emplace_back(ix * 2.0, iy * 2.0, 0.0);
+      tri.emplace_back(ix * 2.0 + 1.0, iy * 2.0, 0.0);
+      tri.emplace_back(ix * 2.0, iy * 2.0 + 1.0, 0.0);
+      objs.emplace_back(TObject3D::From(tri));
+    }
+  }
+
+  // Some vertical segments:
+  for (int i = 0; i < 8; i++)
+    objs.emplace_back(
+        TObject3D::From(TSegment3D({i * 1.5, 3.0, -2.0}, {i * 1.5, 3.0, 2.0})));
+
+  // A couple of isolated points:
+  objs.emplace_back(TObject3D::From(TPoint3D(1.0, 1.0, 1.0)));
+  objs.emplace_back(TObject3D::From(TPoint3D(-3.0, -3.0, -3.0)));
+
+  // Unbounded primitives, kept outside the hierarchy:
+  objs.emplace_back(TObject3D::From(TPlane(0.0, 0.0, 1.0, 4.0)));  // z = -4
+  objs.emplace_back(
+      TObject3D::From(TLine3D::FromPointAndDirector({0, -10, 0}, {0, 1, 0})));
+
+  // An empty object, which build() must ignore:
+  objs.emplace_back(TObject3D());
+
+  return objs;
+}
+
+TEST(CBVH3D, matchesBruteForce)
+{
+  const auto objs = buildTestScene();
+  CBVH3D bvh(objs);
+  EXPECT_EQ(bvh.size(), objs.size());
+
+  auto& rng = mrpt::random::getRandomGenerator();
+  rng.randomize(42);
+
+  for (int iter = 0; iter < 200; iter++)
+  {
+    const TSegment3D q(
+        {rng.drawUniform(-5.0, 13.0), rng.drawUniform(-5.0, 13.0), rng.drawUniform(-6.0, 6.0)},
+        {rng.drawUniform(-5.0, 13.0), rng.drawUniform(-5.0, 13.0), rng.drawUniform(-6.0, 6.0)});
+    const TObject3D qObj = TObject3D::From(q);
+
+    // Brute force over all primitives:
+    std::set<size_t> expectedHits;
+    TObject3D inter;
+    for (size_t i = 0; i < objs.size(); i++)
+      if (!objs[i].empty() && intersect(objs[i], qObj, inter)) expectedHits.insert(i);
+
+    // Any-hit query:
+    size_t hitIdx = 0;
+    const bool anyHit = bvh.intersectsAny(q, inter, &hitIdx);
+    EXPECT_EQ(anyHit, !expectedHits.empty()) << "query: " << q;
+    if (anyHit) EXPECT_TRUE(expectedHits.count(hitIdx)) << "query: " << q;
+
+    // All-hits query:
+    std::vector<std::pair<size_t, TObject3D>> allHits;
+    bvh.intersectionsWith(q, allHits);
+    std::set<size_t> gotHits;
+    for (const auto& h : allHits) gotHits.insert(h.first);
+    EXPECT_EQ(gotHits, expectedHits) << "query: " << q;
+  }
+}
+
+TEST(CBVH3D, batchedQueries)
+{
+  const auto objs = buildTestScene();
+  CBVH3D bvh(objs);
+
+  std::vector<TSegment3D> queries = {
+      {{0.1, 0.1, -1.0}, {0.1, 0.1, 1.0}},    // crosses a triangle
+      {{50.0, 50.0, 50.0}, {51.0, 51.0, 51.0}},  // hits nothing
+      {{0.0, 0.0, -4.0}, {1.0, 1.0, -4.0}}    // lies on the z=-4 plane
+  };
+  std::vector<TObject3D> results;
+  bvh.intersectMany(queries, results);
+  ASSERT_EQ(results.size(), queries.size());
+  EXPECT_FALSE(results[0].empty());
+  EXPECT_TRUE(results[1].empty());
+  EXPECT_FALSE(results[2].empty());
+
+  // Line query against the unbounded list and the tree:
+  TObject3D inter;
+  EXPECT_TRUE(bvh.intersectsAny(TLine3D::FromPointAndDirector({0.1, 0.1, 5.0}, {0, 0, -1}), inter));
+
+  // Empty structure:
+  CBVH3D emptyBvh;
+  EXPECT_FALSE(emptyBvh.intersectsAny(queries[0], inter));
+}
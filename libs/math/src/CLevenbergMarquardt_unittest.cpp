@@ -17,3 +17,43 @@ TEST(LevMarq, optimizeTest)
   TestLevMarq();
   EXPECT_LT(levmarq_final_error, 1e-2);
 }
+
+// Analytic (batch) Jacobian + reuse of one solver object over several solves:
+TEST(LevMarq, analyticJacobianAndSolverReuse)
+{
+  using namespace mrpt::math;
+
+  // Linear residuals: r0 = x0 + 2*x1 - 7 ; r1 = 2*x0 + x1 - 5. Minimum (=0)
+  // at (1,3):
+  const auto err = [](const CVectorDouble& x, const CVectorDouble&, CVectorDouble& out)
+  {
+    out.resize(2);
+    out[0] = x[0] + 2 * x[1] - 7;
+    out[1] = 2 * x[0] + x[1] - 5;
+  };
+  const auto jacob = [](const CVectorDouble&, const CVectorDouble&, CMatrixDouble& J)
+  {
+    J.setSize(2, 2);
+    J(0, 0) = 1;
+    J(0, 1) = 2;
+    J(1, 0) = 2;
+    J(1, 1) = 1;
+  };
+
+  CLevenbergMarquardt lm;
+  CVectorDouble x0(2), increments(2), dummyParam, xOpt;
+  x0.fill(0);
+  increments.fill(1e-6);
+
+  for (int rep = 0; rep < 3; rep++)  // The same solver object, reused
+  {
+    CLevenbergMarquardt::TResultInfo info;
+    lm.execute(
+        xOpt, x0, err, increments, dummyParam, info, mrpt::system::LVL_ERROR, 100, 1e-3, 1e-9,
+        1e-9, false /*returnPath*/, nullptr /*x_increment_adder*/, jacob);
+
+    EXPECT_NEAR(xOpt[0], 1.0, 1e-6);
+    EXPECT_NEAR(xOpt[1], 3.0, 1e-6);
+    EXPECT_LT(info.final_sqr_err, 1e-10);
+  }
+}
@@ -77,6 +77,36 @@ TEST(CMatrixDynamic, Resizes)
   }
 }
 
+TEST(CMatrixDynamic, SmallSizeInlineStorage)
+{
+  using mrpt::math::CMatrixDouble;
+
+  // Small matrices (up to 8x8 doubles) must live in the object itself, with
+  // no heap allocation:
+  auto storedInline = [](const CMatrixDouble& m)
+  {
+    const auto* objBegin = reinterpret_cast<const char*>(&m);
+    const auto* objEnd = objBegin + sizeof(m);
+    const auto* dataPtr = reinterpret_cast<const char*>(m.data());
+    return dataPtr >= objBegin && dataPtr < objEnd;
+  };
+
+  CMatrixDouble S(6, 6), L(9, 9);
+  EXPECT_TRUE(storedInline(S));
+  EXPECT_FALSE(storedInline(L));
+
+  // Moves and copies of the inline case must preserve contents:
+  S.setIdentity();
+  CMatrixDouble S2 = std::move(S);
+  EXPECT_TRUE(storedInline(S2));
+  for (int i = 0; i < 6; i++) EXPECT_EQ(S2(i, i), 1.0);
+
+  // ...and the heap case as well:
+  L.setIdentity();
+  CMatrixDouble L2 = std::move(L);
+  for (int i = 0; i < 9; i++) EXPECT_EQ(L2(i, i), 1.0);
+}
+
 TEST(CVectorDynamic, segment)
 {
   using mrpt::math::CVectorDouble;
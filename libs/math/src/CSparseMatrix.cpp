@@ -11,9 +11,12 @@
 //
 #include <mrpt/math/CSparseMatrix.h>
 
+#include <algorithm>
 #include <cstring>
 #include <iostream>
 #include <string>
+#include <thread>
+#include <vector>
 
 using std::cout;
 using std::endl;
@@ -22,7 +25,8 @@ using namespace mrpt;
 using namespace mrpt::math;
 
 /** Copy constructor */
-CSparseMatrix::CSparseMatrix(const CSparseMatrix& other)
+CSparseMatrix::CSparseMatrix(const CSparseMatrix& other) :
+    m_triplet2csc(other.m_triplet2csc)
 {
   construct_from_existing_cs(other.sparse_matrix);
   copy(&other.sparse_matrix);
@@ -75,6 +79,9 @@ void CSparseMatrix::copy_fast(cs* const sm)
   sm->i = nullptr;
   sm->p = nullptr;
   sm->x = nullptr;
+
+  // The compressed structure changed:
+  m_triplet2csc.clear();
 }
 
 /** Fast swap contents with another sparse matrix */
@@ -89,6 +96,8 @@ void CSparseMatrix::swap(CSparseMatrix& other)
   std::swap(sparse_matrix.i, other.sparse_matrix.i);
   std::swap(sparse_matrix.p, other.sparse_matrix.p);
   std::swap(sparse_matrix.x, other.sparse_matrix.x);
+
+  m_triplet2csc.swap(other.m_triplet2csc);
 }
 
 // Dtor
@@ -108,6 +117,8 @@ void CSparseMatrix::clear(size_t nRows, size_t nCols)
   sparse_matrix.p = (int*)malloc(sizeof(int) * (sparse_matrix.n + 1));
   sparse_matrix.x = (double*)malloc(sizeof(double) * sparse_matrix.nzmax);
   sparse_matrix.nz = 0;  // >=0 -> triplet format.
+
+  m_triplet2csc.clear();
 }
 
 /** free buffers (deallocate the memory of the i,p,x buffers) */
@@ -179,6 +190,7 @@ CSparseMatrix& CSparseMatrix::operator=(const CSparseMatrix& other)
   sparse_matrix.p = (int*)malloc(sizeof(int) * (other.sparse_matrix.n + 1));
   sparse_matrix.x = (double*)malloc(sizeof(double) * other.sparse_matrix.nzmax);
   copy(&other.sparse_matrix);
+  m_triplet2csc = other.m_triplet2csc;
   return *this;
 }
 
@@ -192,24 +204,125 @@ void CSparseMatrix::add_AB(const CSparseMatrix& A, const CSparseMatrix& B)
   cs_spfree(sm);
 }
 
-void CSparseMatrix::multiply_AB(const CSparseMatrix& A, const CSparseMatrix& B)
+void CSparseMatrix::multiply_AB(
+    const CSparseMatrix& A, const CSparseMatrix& B, unsigned int numThreads)
 {
   ASSERT_(A.cols() == B.rows());
 
-  cs* sm = cs_multiply(&(A.sparse_matrix), &(B.sparse_matrix));
-  ASSERT_(sm);
-  this->copy_fast(sm);
-  cs_spfree(sm);
+  if (numThreads == 0) numThreads = std::max(1u, std::thread::hardware_concurrency());
+
+  const int nColsB = B.sparse_matrix.n;
+
+  if (numThreads <= 1 || !A.isColumnCompressed() || !B.isColumnCompressed() ||
+      nColsB < 2 * static_cast<int>(numThreads))
+  {
+    cs* sm = cs_multiply(&(A.sparse_matrix), &(B.sparse_matrix));
+    ASSERT_(sm);
+    this->copy_fast(sm);
+    cs_spfree(sm);
+    return;
+  }
+
+  // Parallel version: each worker multiplies A by a contiguous block of
+  // columns of B (via a shallow "cs" view sharing B's buffers), then the
+  // per-block CCS results are concatenated column-wise:
+  const int nT = std::min<int>(numThreads, nColsB);
+  std::vector<cs*> blocks(nT, nullptr);
+  std::vector<std::thread> threads;
+  threads.reserve(nT);
+
+  for (int t = 0; t < nT; t++)
+  {
+    const int j0 = (nColsB * t) / nT, j1 = (nColsB * (t + 1)) / nT;
+    threads.emplace_back(
+        [&, t, j0, j1]()
+        {
+          // Note: cs_multiply() indexes B->i / B->x through B->p, so a view
+          // with shifted "p" and reduced "n" is a valid CCS submatrix:
+          cs Bblock = B.sparse_matrix;
+          Bblock.n = j1 - j0;
+          Bblock.p = B.sparse_matrix.p + j0;
+          blocks[t] = cs_multiply(&(A.sparse_matrix), &Bblock);
+        });
+  }
+  for (auto& th : threads) th.join();
+  for (const cs* blk : blocks) ASSERT_(blk);
+
+  // Stitch the blocks together into a single CCS matrix:
+  int totalNZ = 0;
+  for (const cs* blk : blocks) totalNZ += blk->p[blk->n];
+
+  cs res;
+  res.m = A.sparse_matrix.m;
+  res.n = nColsB;
+  res.nz = -1;  // column-compressed
+  res.nzmax = std::max(1, totalNZ);
+  res.i = (int*)malloc(sizeof(int) * res.nzmax);
+  res.p = (int*)malloc(sizeof(int) * (nColsB + 1));
+  res.x = (double*)malloc(sizeof(double) * res.nzmax);
+
+  int nzOffset = 0, colOut = 0;
+  for (cs* blk : blocks)
+  {
+    const int blkNZ = blk->p[blk->n];
+    for (int j = 0; j < blk->n; j++) res.p[colOut++] = blk->p[j] + nzOffset;
+    std::memcpy(res.i + nzOffset, blk->i, sizeof(int) * blkNZ);
+    std::memcpy(res.x + nzOffset, blk->x, sizeof(double) * blkNZ);
+    nzOffset += blkNZ;
+    cs_spfree(blk);
+  }
+  res.p[nColsB] = nzOffset;
+
+  // Only now free our old contents, so "this==&A" or "this==&B" work:
+  this->copy_fast(&res);
 }
 
 void CSparseMatrix::matProductOf_Ab(
-    const mrpt::math::CVectorDouble& b, mrpt::math::CVectorDouble& out_res) const
+    const mrpt::math::CVectorDouble& b,
+    mrpt::math::CVectorDouble& out_res,
+    unsigned int numThreads) const
 {
   ASSERT_EQUAL_(int(b.size()), int(cols()));
   out_res.resize(rows());
   const double* y = &(b[0]);
   double* x = &(out_res[0]);
-  cs_gaxpy(&sparse_matrix, y, x);
+
+  if (numThreads == 0) numThreads = std::max(1u, std::thread::hardware_concurrency());
+
+  const int nCols = sparse_matrix.n;
+
+  if (numThreads <= 1 || !isColumnCompressed() || nCols < 2 * static_cast<int>(numThreads))
+  {
+    cs_gaxpy(&sparse_matrix, y, x);
+    return;
+  }
+
+  // Parallel version: each worker accumulates the product of a contiguous
+  // block of columns into its own local vector, summed at the end (keeping
+  // the accumulating semantics of cs_gaxpy):
+  const int nRows = sparse_matrix.m;
+  const int nT = std::min<int>(numThreads, nCols);
+  std::vector<std::vector<double>> partial(nT);
+  std::vector<std::thread> threads;
+  threads.reserve(nT);
+
+  for (int t = 0; t < nT; t++)
+  {
+    const int j0 = (nCols * t) / nT, j1 = (nCols * (t + 1)) / nT;
+    threads.emplace_back(
+        [&, t, j0, j1]()
+        {
+          auto& acc = partial[t];
+          acc.assign(nRows, 0.0);
+          for (int j = j0; j < j1; j++)
+            for (int p = sparse_matrix.p[j]; p < sparse_matrix.p[j + 1]; p++)
+              acc[sparse_matrix.i[p]] += sparse_matrix.x[p] * y[j];
+        });
+  }
+  for (auto& th : threads) th.join();
+
+  for (const auto& acc : partial)
+    for (int r = 0; r < nRows; r++) x[r] += acc[r];
 }
 
 CSparseMatrix CSparseMatrix::transpose() const
@@ -264,6 +377,51 @@ void CSparseMatrix::compressFromTriplet()
                   // internal buffers, now set to NULL.
 }
 
+void CSparseMatrix::refreshCompressedFromTriplet(const CSparseMatrix& triplet)
+{
+  if (!isColumnCompressed())
+    THROW_EXCEPTION(
+        "refreshCompressedFromTriplet(): This matrix must be in "
+        "column-compressed format.");
+  if (!triplet.isTriplet())
+    THROW_EXCEPTION(
+        "refreshCompressedFromTriplet(): The input matrix must be in "
+        "'triplet' format.");
+
+  const cs& T = triplet.sparse_matrix;
+  ASSERT_EQUAL_(T.m, sparse_matrix.m);
+  ASSERT_EQUAL_(T.n, sparse_matrix.n);
+
+  // Build the triplet->CCS index map once; it only depends on the sparse
+  // patterns, which by contract do not change between calls:
+  if (m_triplet2csc.size() != static_cast<size_t>(T.nz))
+  {
+    m_triplet2csc.assign(T.nz, -1);
+    for (int k = 0; k < T.nz; k++)
+    {
+      const int i = T.i[k], j = T.p[k];
+      for (int p = sparse_matrix.p[j]; p < sparse_matrix.p[j + 1]; p++)
+      {
+        if (sparse_matrix.i[p] == i)
+        {
+          m_triplet2csc[k] = p;
+          break;
+        }
+      }
+      ASSERTMSG_(
+          m_triplet2csc[k] >= 0,
+          "refreshCompressedFromTriplet(): Triplet entry not found in the "
+          "compressed sparse pattern.");
+    }
+  }
+
+  // Numeric refresh: plain O(nnz) scatter-add, no memory (re)allocation.
+  // Duplicated triplet entries add to each other, as in cs_compress():
+  const int nnz = sparse_matrix.p[sparse_matrix.n];
+  std::memset(sparse_matrix.x, 0, sizeof(double) * nnz);
+  for (int k = 0; k < T.nz; k++) sparse_matrix.x[m_triplet2csc[k]] += T.x[k];
+}
+
 /** save as a dense matrix to a text file \return False on any error.
  */
 bool CSparseMatrix::saveToTextFile_dense(const std::string& filName)
@@ -229,3 +229,89 @@ TEST(SparseMatrix, CholeskyDecomp)
   const double err = (Ud.transpose() - L.asEigen()).array().abs().mean();
   EXPECT_TRUE(err < 1e-8);
 }
+
+TEST(SparseMatrix, RefreshCompressedFromTriplet)
+{
+  const size_t N = 20, M = 30, nEntries = 50;
+
+  // A fixed sparse pattern, filled twice with different values:
+  std::vector<size_t> rows, cols;
+  for (size_t i = 0; i < nEntries; i++)
+  {
+    rows.push_back(mrpt::random::getRandomGenerator().drawUniform32bit() % N);
+    cols.push_back(mrpt::random::getRandomGenerator().drawUniform32bit() % M);
+  }
+
+  auto fillTriplet = [&](CSparseMatrix& T, double scale)
+  {
+    T.clear(N, M);
+    for (size_t i = 0; i < nEntries; i++) T.insert_entry(rows[i], cols[i], scale * (1.0 + i));
+  };
+
+  // Compress from the first filling:
+  CSparseMatrix SM(N, M);
+  fillTriplet(SM, 1.0);
+  SM.compressFromTriplet();
+
+  // Refresh in-place from a second filling, and compare against a fresh
+  // compression of the same values (twice, to also exercise the cached map):
+  for (double scale : {-3.0, 0.5})
+  {
+    CSparseMatrix T2(N, M);
+    fillTriplet(T2, scale);
+    SM.refreshCompressedFromTriplet(T2);
+
+    CSparseMatrix SM2(N, M);
+    fillTriplet(SM2, scale);
+    SM2.compressFromTriplet();
+
+    CMatrixDouble D, D2;
+    SM.get_dense(D);
+    SM2.get_dense(D2);
+    const double err = (D - D2).array().abs().maxCoeff();
+    EXPECT_TRUE(err < 1e-10) << "scale=" << scale << "\nrefreshed:\n"
+                             << D << "recompressed:\n"
+                             << D2;
+  }
+
+  // Wrong usage must throw:
+  CSparseMatrix T3(N, M);
+  fillTriplet(T3, 1.0);
+  EXPECT_ANY_THROW(T3.refreshCompressedFromTriplet(T3));  // not compressed
+  EXPECT_ANY_THROW(SM.refreshCompressedFromTriplet(SM));  // not a triplet
+}
+
+TEST(SparseMatrix, Op_Multiply_AB_Threaded)
+{
+  CSparseMatrix SM1, SM2;
+  generateRandomSparseMatrix(40, 70, 300, SM1);
+  generateRandomSparseMatrix(70, 50, 300, SM2);
+
+  CSparseMatrix res_serial, res_parallel;
+  res_serial.multiply_AB(SM1, SM2);
+  res_parallel.multiply_AB(SM1, SM2, 4 /*numThreads*/);
+
+  CMatrixDouble D1, D2;
+  res_serial.get_dense(D1);
+  res_parallel.get_dense(D2);
+  const double err = (D1 - D2).array().abs().maxCoeff();
+  EXPECT_TRUE(err < 1e-10) << "serial:\n" << D1 << "parallel:\n" << D2;
+}
+
+TEST(SparseMatrix, matProductOf_Ab_Threaded)
+{
+  CSparseMatrix SM;
+  generateRandomSparseMatrix(60, 80, 400, SM);
+
+  CVectorDouble b(80);
+  for (int i = 0; i < 80; i++) b[i] = mrpt::random::getRandomGenerator().drawGaussian1D(0, 1);
+
+  CVectorDouble res_serial, res_parallel;
+  res_serial.setZero(60);
+  res_parallel.setZero(60);
+  SM.matProductOf_Ab(b, res_serial);
+  SM.matProductOf_Ab(b, res_parallel, 4 /*numThreads*/);
+
+  const double err = (res_serial.asEigen() - res_parallel.asEigen()).array().abs().maxCoeff();
+  EXPECT_TRUE(err < 1e-10);
+}
@@ -11,9 +11,11 @@
 //
 #include <mrpt/math/CSplineInterpolator1D.h>  // for CSplineInterpolator1D
 #include <mrpt/math/CVectorDynamic.h>
+#include <mrpt/math/wrap2pi.h>                     // for wrapToPi
 #include <mrpt/serialization/CSerializable.h>      // for CSerializable, CSeriali...
 #include <mrpt/serialization/stl_serialization.h>  // for operator<<, operator>>
 
+#include <algorithm>  // for upper_bound
 #include <map>
 #include <mrpt/math/interp_fit.hpp>  // for spline
 
@@ -32,7 +34,129 @@ CSplineInterpolator1D::CSplineInterpolator1D(bool wrap2pi) : m_wrap2pi(wrap2pi)
 /*---------------------------------------------------------------
             appendXY
   ---------------------------------------------------------------*/
-void CSplineInterpolator1D::appendXY(double x, double y) { m_x2y[x] = y; }
+void CSplineInterpolator1D::appendXY(double x, double y)
+{
+  m_x2y[x] = y;
+  m_compiled_dirty = true;
+}
+
+/*---------------------------------------------------------------
+            compile
+  ---------------------------------------------------------------*/
+void CSplineInterpolator1D::compile() const
+{
+  const size_t n = m_x2y.size();
+  m_compiled_x.clear();
+  m_compiled_y.clear();
+  m_compiled_coefs.clear();
+  m_compiled_x.reserve(n);
+  m_compiled_y.reserve(n);
+  for (const auto& p : m_x2y)
+  {
+    m_compiled_x.push_back(p.first);
+    m_compiled_y.push_back(p.second);
+  }
+
+  // Precompute the cubic coefficients of each interpolable segment
+  // [k_i, k_{i+1}] (those with two knots at each side), replicating the
+  // local 4-point solve of mrpt::math::spline() for its middle branch:
+  if (n >= 4)
+  {
+    m_compiled_coefs.reserve(n - 3);
+    for (size_t i = 1; i + 2 < n; i++)
+    {
+      const double* xs = &m_compiled_x[i - 1];
+      const double h0 = xs[1] - xs[0], h1 = xs[2] - xs[1], h2 = xs[3] - xs[2];
+
+      const double k = 1 / (4 * h0 * h1 + 4 * h0 * h2 + 3 * h1 * h1 + 4 * h1 * h2);
+      const double a11 = 2 * (h1 + h2) * k;
+      const double a12 = -h1 * k;
+      const double a22 = 2 * (h0 + h1) * k;
+
+      double y0 = m_compiled_y[i - 1], y1 = m_compiled_y[i], y2 = m_compiled_y[i + 1],
+             y3 = m_compiled_y[i + 2];
+      if (m_wrap2pi)
+      {
+        // Assure the function is linear without jumps in the interval:
+        y0 = mrpt::math::wrapToPi(y0);
+        y1 = mrpt::math::wrapToPi(y1);
+        y2 = mrpt::math::wrapToPi(y2);
+        y3 = mrpt::math::wrapToPi(y3);
+
+        double Ay = y1 - y0;
+        if (Ay > M_PI)
+          y1 -= M_2PI;
+        else if (Ay < -M_PI)
+          y1 += M_2PI;
+
+        Ay = y2 - y1;
+        if (Ay > M_PI)
+          y2 -= M_2PI;
+        else if (Ay < -M_PI)
+          y2 += M_2PI;
+
+        Ay = y3 - y2;
+        if (Ay > M_PI)
+          y3 -= M_2PI;
+        else if (Ay < -M_PI)
+          y3 += M_2PI;
+      }
+
+      const double b1 = (y2 - y1) / h1 - (y1 - y0) / h0;
+      const double b2 = (y3 - y2) / h2 - (y2 - y1) / h1;
+
+      const double z1 = 6 * (a11 * b1 + a12 * b2);
+      const double z2 = 6 * (a12 * b1 + a22 * b2);
+
+      TSegmentCoefs c;
+      c.x1 = xs[1];
+      c.x2 = xs[2];
+      c.c3a = z2 / (6 * h1);
+      c.c3b = z1 / (6 * h1);
+      c.cA = y2 / h1 - h1 / 6 * z2;
+      c.cB = y1 / h1 - h1 / 6 * z1;
+      m_compiled_coefs.push_back(c);
+    }
+  }
+  m_compiled_dirty = false;
+}
+
+/*---------------------------------------------------------------
+            queryMany
+  ---------------------------------------------------------------*/
+void CSplineInterpolator1D::queryMany(
+    const std::vector<double>& xs, std::vector<double>& out_y, std::vector<bool>& out_valid) const
+{
+  if (m_compiled_dirty) compile();
+
+  const size_t nQ = xs.size(), n = m_compiled_x.size();
+  out_y.assign(nQ, 0);
+  out_valid.assign(nQ, false);
+
+  for (size_t i = 0; i < nQ; i++)
+  {
+    const double x = xs[i];
+    // Index of the first knot > x:
+    const size_t j =
+        std::upper_bound(m_compiled_x.begin(), m_compiled_x.end(), x) - m_compiled_x.begin();
+
+    // Exact match?
+    if (j > 0 && m_compiled_x[j - 1] == x)
+    {
+      out_y[i] = m_compiled_y[j - 1];
+      out_valid[i] = true;
+      continue;
+    }
+    // x in (k_{j-1}, k_j): interpolable iff two knots exist at each side:
+    if (j < 2 || j + 2 > n) continue;
+
+    const TSegmentCoefs& c = m_compiled_coefs[j - 2];
+    const double u = x - c.x1, v = c.x2 - x;
+    const double y = c.c3a * u * u * u + c.c3b * v * v * v + c.cA * u + c.cB * v;
+    out_y[i] = m_wrap2pi ? mrpt::math::wrapToPi(y) : y;
+    out_valid[i] = true;
+  }
+}
 /*---------------------------------------------------------------
             query
   ---------------------------------------------------------------*/
@@ -110,6 +234,7 @@ void CSplineInterpolator1D::serializeFrom(mrpt::serialization::CArchive& in, uin
     case 0:  // floats
     {
       in >> m_x2y >> m_wrap2pi;
+      m_compiled_dirty = true;
     }
     break;
     default:
@@ -0,0 +1,92 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/math/CSplineInterpolator1D.h>
+#include <mrpt/random.h>
+
+using namespace mrpt;
+using namespace mrpt::math;
+
+// Builds a spline with nKnots random knots and checks queryMany() against
+// per-point query() over a dense sampling plus all edge cases:
+static void run_queryMany_vs_query_test(bool wrap2pi)
+{
+  auto& rnd = mrpt::random::getRandomGenerator();
+  rnd.randomize(wrap2pi ? 333 : 42);
+
+  const size_t nKnots = 20;
+  CSplineInterpolator1D interp(wrap2pi);
+  double x = 0;
+  for (size_t i = 0; i < nKnots; i++)
+  {
+    x += rnd.drawUniform(0.1, 1.0);
+    interp.appendXY(x, rnd.drawUniform(-5.0, 5.0));
+  }
+
+  // Queries: dense sweep past both ends of the knot range:
+  std::vector<double> xs;
+  for (double q = -1.0; q < x + 1.0; q += 0.01) xs.push_back(q);
+
+  std::vector<double> ys;
+  std::vector<bool> valids;
+  interp.queryMany(xs, ys, valids);
+  ASSERT_EQ(ys.size(), xs.size());
+  ASSERT_EQ(valids.size(), xs.size());
+
+  for (size_t i = 0; i < xs.size(); i++)
+  {
+    double yRef;
+    bool validRef;
+    interp.query(xs[i], yRef, validRef);
+    EXPECT_EQ(valids[i], validRef) << "x=" << xs[i];
+    if (validRef) EXPECT_NEAR(ys[i], yRef, 1e-10) << "x=" << xs[i];
+  }
+}
+
+TEST(CSplineInterpolator1D, queryManyMatchesQuery)
+{
+  run_queryMany_vs_query_test(false /*wrap2pi*/);
+}
+
+TEST(CSplineInterpolator1D, queryManyMatchesQueryWrap2pi)
+{
+  run_queryMany_vs_query_test(true /*wrap2pi*/);
+}
+
+TEST(CSplineInterpolator1D, queryManyExactKnotsAndRecompile)
+{
+  CSplineInterpolator1D interp;
+  const std::vector<double> kx = {0, 1, 2, 3, 4, 5}, ky = {0, 1, 0, -1, 0, 1};
+  interp.setXY(kx, ky);
+
+  std::vector<double> ys;
+  std::vector<bool> valids;
+  interp.queryMany(kx, ys, valids);
+  for (size_t i = 0; i < kx.size(); i++)
+  {
+    EXPECT_TRUE(valids[i]) << "knot #" << i;
+    EXPECT_DOUBLE_EQ(ys[i], ky[i]) << "knot #" << i;
+  }
+
+  // Mutating the spline must invalidate the compiled table:
+  interp.appendXY(6.0, 2.0);
+  interp.queryMany({5.5}, ys, valids);
+  EXPECT_FALSE(valids[0]);  // only one knot at the right side now
+
+  interp.appendXY(7.0, 3.0);
+  interp.queryMany({5.5}, ys, valids);
+  EXPECT_TRUE(valids[0]);
+
+  double yRef;
+  bool validRef;
+  interp.query(5.5, yRef, validRef);
+  ASSERT_TRUE(validRef);
+  EXPECT_NEAR(ys[0], yRef, 1e-10);
+}
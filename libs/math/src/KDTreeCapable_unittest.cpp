@@ -17,3 +17,62 @@ using namespace mrpt::random;
 using namespace std;
 
 TEST(KDTreeCapable, test1) { MRPT_TODO("Write me!"); }
+
+namespace
+{
+// Minimal CRTP dataset over a flat XY(Z) point list:
+struct TestPointSet : public mrpt::math::KDTreeCapable<TestPointSet>
+{
+  std::vector<mrpt::math::TPoint3Df> pts;
+
+  void appendPoint(float x, float y, float z)
+  {
+    pts.emplace_back(x, y, z);
+    kdtree_mark_as_appended();
+  }
+
+  // nanoflann adaptor interface:
+  size_t kdtree_get_point_count() const { return pts.size(); }
+  float kdtree_get_pt(const size_t idx, int dim) const { return pts[idx][dim]; }
+  template <class BBOX>
+  bool kdtree_get_bbox(BBOX&) const
+  {
+    return false;
+  }
+};
+}  // namespace
+
+TEST(KDTreeCapable, incrementalUpdates)
+{
+  TestPointSet regular, incremental;
+  incremental.kdtree_enable_incremental_updates(true);
+  EXPECT_TRUE(incremental.kdtree_incremental_updates_enabled());
+
+  auto& rnd = mrpt::random::getRandomGenerator();
+  rnd.randomize(333);
+
+  // Interleave appends & queries so the incremental index is exercised:
+  for (int batch = 0; batch < 5; batch++)
+  {
+    for (int i = 0; i < 100; i++)
+    {
+      const float x = rnd.drawUniform(-10.0f, 10.0f);
+      const float y = rnd.drawUniform(-10.0f, 10.0f);
+      const float z = rnd.drawUniform(-10.0f, 10.0f);
+      regular.appendPoint(x, y, z);
+      incremental.appendPoint(x, y, z);
+    }
+
+    for (int i = 0; i < 20; i++)
+    {
+      const float qx = rnd.drawUniform(-10.0f, 10.0f);
+      const float qy = rnd.drawUniform(-10.0f, 10.0f);
+      const float qz = rnd.drawUniform(-10.0f, 10.0f);
+      float d1 = 0, d2 = 0;
+      mrpt::math::TPoint3Df p1, p2;
+      regular.kdTreeClosestPoint3D(qx, qy, qz, p1.x, p1.y, p1.z, d1);
+      incremental.kdTreeClosestPoint3D(qx, qy, qz, p2.x, p2.y, p2.z, d2);
+      EXPECT_NEAR(d1, d2, 1e-6f) << "query #" << i;
+    }
+  }
+}
@@ -13,11 +13,15 @@
 #include <mrpt/system/datetime.h>
 
 #include <Eigen/Dense>
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>   // fopen(),...
+#include <cstdlib>  // strtod()
+#include <cstring>  // memchr()
 #include <fstream>  // ifstream
 #include <sstream>  // stringstream
 #include <stdexcept>
+#include <thread>
 #include <vector>
 
 namespace mrpt::math
@@ -207,91 +211,251 @@ void MatrixVectorBase<Scalar, Derived>::saveToTextFile(
   ::fclose(f);
 }
 
+namespace detail_lft
+{
+// Fast, locale-independent number parser for loadFromTextBuffer(): the
+// classic "small mantissa & small exponent" exact fast path (Clinger), with
+// a strtod() fallback for anything unusual (long mantissas, hex floats,
+// inf/nan), so results are identical to the old strtod()-only reader.
+// Safe mid-buffer: the buffer is NUL-terminated and strtod() stops at the
+// first non-numeric char anyway.
+inline double fastParseDouble(const char*& ptr, const char* bufEnd, bool& ok)
+{
+  const char* p = ptr;
+  bool neg = false;
+  if (p < bufEnd && (*p == '+' || *p == '-'))
+  {
+    neg = (*p == '-');
+    p++;
+  }
+  uint64_t mant = 0;
+  int sigDigits = 0, exp10 = 0;
+  bool anyDigit = false;
+  for (; p < bufEnd && *p >= '0' && *p <= '9'; p++)
+  {
+    anyDigit = true;
+    if (sigDigits < 19)
+    {
+      mant = mant * 10 + static_cast<uint64_t>(*p - '0');
+      if (mant) sigDigits++;
+    }
+    else
+      exp10++;
+  }
+  // "0x..." hex floats must go through strtod():
+  const bool isHex = anyDigit && mant == 0 && p < bufEnd && (*p == 'x' || *p == 'X');
+  if (p < bufEnd && *p == '.')
+  {
+    p++;
+    for (; p < bufEnd && *p >= '0' && *p <= '9'; p++)
+    {
+      anyDigit = true;
+      if (sigDigits < 19)
+      {
+        mant = mant * 10 + static_cast<uint64_t>(*p - '0');
+        if (mant) sigDigits++;
+        exp10--;
+      }
+    }
+  }
+  if (anyDigit && p < bufEnd && (*p == 'e' || *p == 'E'))
+  {
+    const char* atE = p;
+    p++;
+    bool eneg = false;
+    if (p < bufEnd && (*p == '+' || *p == '-'))
+    {
+      eneg = (*p == '-');
+      p++;
+    }
+    int e = 0;
+    bool anyExpDigit = false;
+    for (; p < bufEnd && *p >= '0' && *p <= '9'; p++)
+    {
+      anyExpDigit = true;
+      if (e < 100000) e = e * 10 + (*p - '0');
+    }
+    if (!anyExpDigit)
+      p = atE;  // "1e" or "1e+": strtod() stops before the 'e' too
+    else
+      exp10 += eneg ? -e : e;
+  }
+
+  // The double conversion is exactly-rounded only within this range:
+  if (anyDigit && !isHex && sigDigits <= 15 && exp10 >= -22 && exp10 <= 22)
+  {
+    static const double pow10tbl[23] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                        1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                        1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    double v = static_cast<double>(mant);
+    v = (exp10 >= 0) ? v * pow10tbl[exp10] : v / pow10tbl[-exp10];
+    ptr = p;
+    ok = true;
+    return neg ? -v : v;
+  }
+
+  char* strtodEnd = nullptr;
+  const double v = strtod(ptr, &strtodEnd);
+  ok = (strtodEnd != ptr);
+  if (ok) ptr = strtodEnd;
+  return v;
+}
+
+inline bool isSeparator(char c)
+{
+  return c == ' ' || c == ',' || c == '\t' || c == '\r' || c == '\n';
+}
+
+struct TextChunkResult
+{
+  std::vector<double> values;
+  /** Number of parsed values of each non-comment, non-empty line */
+  std::vector<uint32_t> rowLens;
+};
+
+inline void parseTextChunk(const char* b, const char* e, TextChunkResult& out)
+{
+  const char* p = b;
+  while (p < e)
+  {
+    const char* lineEnd = static_cast<const char*>(memchr(p, '\n', e - p));
+    if (!lineEnd) lineEnd = e;
+    // Skip empty lines and comments ('#' or '%' in the first column):
+    if (lineEnd == p || *p == '#' || *p == '%')
+    {
+      p = lineEnd + 1;
+      continue;
+    }
+    uint32_t cnt = 0;
+    const char* q = p;
+    for (;;)
+    {
+      while (q < lineEnd && isSeparator(*q)) q++;
+      if (q >= lineEnd) break;
+      bool ok = false;
+      const double v = fastParseDouble(q, lineEnd, ok);
+      if (!ok) break;  // garbage: the rest of the line is ignored
+      out.values.push_back(v);
+      cnt++;
+    }
+    out.rowLens.push_back(cnt);
+    p = lineEnd + 1;
+  }
+}
+}  // namespace detail_lft
+
 template <typename Scalar, class Derived>
-void MatrixVectorBase<Scalar, Derived>::loadFromTextFile(std::istream& f)
+void MatrixVectorBase<Scalar, Derived>::loadFromTextBuffer(const std::string& buffer)
 {
   using Index = typename Derived::Index;
-  std::string str;
-  std::vector<double> fil(512);
-  size_t nRows = 0;
-  while (!f.eof() && !f.fail())
+
+  const char* base = buffer.c_str();
+  const size_t len = buffer.size();
+
+  // Chunk-parallel parsing for large buffers:
+  constexpr size_t BYTES_PER_THREAD = 1 << 20;
+  size_t nThreads = 1;
+  if (len >= 2 * BYTES_PER_THREAD)
+    nThreads = std::min<size_t>(
+        std::max<unsigned>(1, std::thread::hardware_concurrency()), len / BYTES_PER_THREAD);
+
+  std::vector<detail_lft::TextChunkResult> chunks(nThreads);
+  if (nThreads == 1)
   {
-    std::getline(f, str);
-    if (str.size() && str[0] != '#' && str[0] != '%')
+    detail_lft::parseTextChunk(base, base + len, chunks[0]);
+  }
+  else
+  {
+    // Chunk boundaries, snapped forward to the next start-of-line:
+    std::vector<size_t> bounds(nThreads + 1, len);
+    bounds[0] = 0;
+    for (size_t t = 1; t < nThreads; t++)
     {
-      // Parse row to floats:
-      const char* ptr = str.c_str();
-      char* ptrEnd = nullptr;
-      size_t i = 0;
-      // Process each number in this row:
-      while (ptr[0] && ptr != ptrEnd)
+      size_t b = std::max(bounds[t - 1], (t * len) / nThreads);
+      while (b < len && base[b] != '\n') b++;
+      if (b < len) b++;
+      bounds[t] = b;
+    }
+    std::vector<std::thread> threads;
+    threads.reserve(nThreads);
+    for (size_t t = 0; t < nThreads; t++)
+      threads.emplace_back([&, t]()
+                           { detail_lft::parseTextChunk(base + bounds[t], base + bounds[t + 1], chunks[t]); });
+    for (auto& th : threads) th.join();
+  }
+
+  // Shape checks (same error conditions as the old line-by-line reader):
+  size_t nRows = 0, nCols = 0;
+  for (const auto& c : chunks)
+  {
+    for (const auto cnt : c.rowLens)
+    {
+      if (nRows == 0)
       {
-        // Find next number: (non white-space character):
-        while (ptr[0] && (ptr[0] == ' ' || ptr[0] == ',' || ptr[0] == '\t' || ptr[0] == '\r' ||
-                          ptr[0] == '\n'))
-          ptr++;
-        if (fil.size() <= i) fil.resize(fil.size() + (fil.size() >> 1));
-        // Convert to "double":
-        fil[i] = strtod(ptr, &ptrEnd);
-        // A valid conversion has been done?
-        if (ptr != ptrEnd)
-        {
-          i++;  // Yes
-          ptr = ptrEnd;
-          ptrEnd = nullptr;
-        }
-      };  // end while procesing this row
-
-      if (!i && nRows == 0) throw std::runtime_error("loadFromTextFile: Empty first line!");
-
-      // "i": # of columns:
-      if ((Derived::ColsAtCompileTime != Eigen::Dynamic && Index(i) != Derived::ColsAtCompileTime))
+        if (!cnt) throw std::runtime_error("loadFromTextFile: Empty first line!");
+        nCols = cnt;
+      }
+      if (Derived::ColsAtCompileTime != Eigen::Dynamic &&
+          Index(cnt) != Derived::ColsAtCompileTime)
         throw std::runtime_error(
             "loadFromTextFile: The matrix in the text file does not "
             "match fixed matrix size");
-      if (Derived::ColsAtCompileTime == Eigen::Dynamic && nRows > 0 &&
-          Index(i) != mvbDerived().cols())
+      if (cnt != nCols)
         throw std::runtime_error(
             "loadFromTextFile: The matrix in the text file does not "
             "have the same number of columns in all rows");
-
-      // Append to the matrix:
-      if (Derived::RowsAtCompileTime == Eigen::Dynamic ||
-          Derived::ColsAtCompileTime == Eigen::Dynamic)
-      {
-        if (mvbDerived().rows() < static_cast<int>(nRows + 1) ||
-            mvbDerived().cols() < static_cast<int>(i))
-        {
-          const size_t extra_rows = std::max(static_cast<size_t>(1), nRows >> 1);
-          mvbDerived().resize(nRows + extra_rows, i);
-        }
-      }
-      else if (
-          Derived::RowsAtCompileTime != Eigen::Dynamic && int(nRows) >= Derived::RowsAtCompileTime)
-        throw std::runtime_error(
-            "loadFromTextFile: Read more rows than the capacity of the "
-            "fixed sized matrix.");
-
-      for (size_t q = 0; q < i; q++) mvbDerived()(nRows, q) = Scalar(fil[q]);
-
       nRows++;
-    }  // end if fgets
-  }    // end while not feof
+    }
+  }
+  if (!nRows) throw std::runtime_error("loadFromTextFile: Error loading from text file");
+  if (Derived::RowsAtCompileTime != Eigen::Dynamic && Index(nRows) > Derived::RowsAtCompileTime)
+    throw std::runtime_error(
+        "loadFromTextFile: Read more rows than the capacity of the "
+        "fixed sized matrix.");
 
-  // Final resize to the real size (in case we allocated space in advance):
+  // Single resize & bulk fill:
   if (Derived::RowsAtCompileTime == Eigen::Dynamic || Derived::ColsAtCompileTime == Eigen::Dynamic)
-    mvbDerived().resize(nRows, mvbDerived().cols());
+    mvbDerived().resize(nRows, nCols);
 
-  // Report error as exception
-  if (!nRows) throw std::runtime_error("loadFromTextFile: Error loading from text file");
+  size_t r = 0;
+  for (const auto& c : chunks)
+  {
+    size_t vi = 0;
+    for (const auto cnt : c.rowLens)
+    {
+      for (size_t q = 0; q < cnt; q++) mvbDerived()(r, q) = Scalar(c.values[vi++]);
+      r++;
+    }
+  }
+}
+
+template <typename Scalar, class Derived>
+void MatrixVectorBase<Scalar, Derived>::loadFromTextFile(std::istream& f)
+{
+  std::string buf;
+  {
+    std::ostringstream ss;
+    ss << f.rdbuf();
+    buf = ss.str();
+  }
+  loadFromTextBuffer(buf);
 }
 
 template <typename Scalar, class Derived>
 void MatrixVectorBase<Scalar, Derived>::loadFromTextFile(const std::string& file)
 {
-  std::ifstream f(file.c_str());
+  std::ifstream f(file.c_str(), std::ios::binary);
   if (f.fail()) throw std::runtime_error(std::string("loadFromTextFile: can't open file:") + file);
-  loadFromTextFile(f);
+
+  // Slurp the whole file in one bulk read:
+  f.seekg(0, std::ios::end);
+  const auto sz = f.tellg();
+  if (sz < 0) throw std::runtime_error(std::string("loadFromTextFile: can't read file:") + file);
+  f.seekg(0, std::ios::beg);
+  std::string buf;
+  buf.resize(static_cast<size_t>(sz));
+  if (sz > 0) f.read(&buf[0], sz);
+  loadFromTextBuffer(buf);
 }
 
 template <typename Scalar, class Derived>
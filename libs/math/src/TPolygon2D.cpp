@@ -17,6 +17,7 @@
 #include <mrpt/math/TSegment2D.h>
 #include <mrpt/math/epsilon.h>
 
+#include <algorithm>
 #include <iostream>
 
 #include "polygons_utils.h"
@@ -203,6 +204,85 @@ TPolygon2D TPolygon2D::FromYAML(const mrpt::containers::yaml& c)
   return p;
 }
 
+void TCompiledPolygon2D::compile(const TPolygon2D& poly, size_t scanlineBands)
+{
+  m_edges.clear();
+  m_bands.clear();
+  m_bandInvH = 0;
+  m_bbMin = {std::numeric_limits<double>::max(), std::numeric_limits<double>::max()};
+  m_bbMax = {-std::numeric_limits<double>::max(), -std::numeric_limits<double>::max()};
+
+  const size_t n = poly.size();
+  if (!n) return;
+  poly.getBoundingBox(m_bbMin, m_bbMax);
+
+  m_edges.reserve(n);
+  for (size_t i = 0; i < n; i++)
+  {
+    const TPoint2D &a = poly[i], &b = poly[(i + 1) % n];
+    if (a.y == b.y) continue;  // Horizontal edges are never crossed
+    TEdge e;
+    const TPoint2D& lo = (a.y < b.y) ? a : b;
+    const TPoint2D& hi = (a.y < b.y) ? b : a;
+    e.yLo = lo.y;
+    e.yHi = hi.y;
+    e.xAtYLo = lo.x;
+    e.invSlope = (hi.x - lo.x) / (hi.y - lo.y);
+    m_edges.push_back(e);
+  }
+
+  if (scanlineBands > 0 && !m_edges.empty() && m_bbMax.y > m_bbMin.y)
+  {
+    m_bandY0 = m_bbMin.y;
+    m_bandInvH = scanlineBands / (m_bbMax.y - m_bbMin.y);
+    m_bands.resize(scanlineBands);
+    for (uint32_t i = 0; i < m_edges.size(); i++)
+    {
+      const auto bandOf = [&](double y) {
+        return std::min<size_t>(
+            scanlineBands - 1, static_cast<size_t>(std::max(0.0, (y - m_bandY0) * m_bandInvH)));
+      };
+      for (size_t b = bandOf(m_edges[i].yLo); b <= bandOf(m_edges[i].yHi); b++)
+        m_bands[b].push_back(i);
+    }
+  }
+}
+
+bool TCompiledPolygon2D::contains(const TPoint2D& P) const
+{
+  if (P.x < m_bbMin.x || P.x > m_bbMax.x || P.y < m_bbMin.y || P.y > m_bbMax.y) return false;
+
+  bool inside = false;
+  const auto testEdge = [&](const TEdge& e)
+  {
+    if (P.y >= e.yLo && P.y < e.yHi)
+    {
+      const double xCross = e.xAtYLo + (P.y - e.yLo) * e.invSlope;
+      if (P.x < xCross) inside = !inside;
+    }
+  };
+
+  if (!m_bands.empty())
+  {
+    const auto b = std::min<size_t>(
+        m_bands.size() - 1, static_cast<size_t>(std::max(0.0, (P.y - m_bandY0) * m_bandInvH)));
+    for (uint32_t idx : m_bands[b]) testEdge(m_edges[idx]);
+  }
+  else
+  {
+    for (const auto& e : m_edges) testEdge(e);
+  }
+  return inside;
+}
+
+void TCompiledPolygon2D::containsMany(
+    const std::vector<TPoint2D>& points, std::vector<bool>& results) const
+{
+  const size_t n = points.size();
+  results.resize(n);
+  for (size_t i = 0; i < n; i++) results[i] = contains(points[i]);
+}
+
 mrpt::containers::yaml TPolygon2D::asYAML() const
 {
   mrpt::containers::yaml c = mrpt::containers::yaml::Sequence();
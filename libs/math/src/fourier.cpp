@@ -961,37 +961,50 @@ void mrpt::math::fft_real(
   MRPT_END
 }
 
-void math::dft2_real(const CMatrixFloat& in_data, CMatrixFloat& out_real, CMatrixFloat& out_imag)
+void CFFT2DPlan::prepare(size_t dim1, size_t dim2)
+{
+  MRPT_START
+  ASSERT_(dim1 >= 2 && dim2 >= 2);
+  if (mrpt::round2up(dim1) != dim1 || mrpt::round2up(dim2) != dim2)
+    THROW_EXCEPTION("Matrix sizes are not a power of two!");
+
+  if (dim1 == m_dim1 && dim2 == m_dim2) return;  // Tables already valid
+
+  m_dim1 = dim1;
+  m_dim2 = dim2;
+
+  m_a_data.resize(dim1 * dim2);
+  m_a.resize(dim1);
+  for (size_t i = 0; i < dim1; i++) m_a[i] = &m_a_data[i * dim2];
+
+  m_t.assign(2 * dim1 + 20, 0);
+  m_ip.assign((size_t)ceil(20 + 2 + sqrt((FFT_TYPE)max(dim1, dim2 / 2))), 0);
+  m_ip[0] = 0;  // Makes the first rdft2d() call build the work tables
+  m_w.assign(max(dim1 / 2, dim2 / 4) + dim2 / 4 + 20, 0);
+  MRPT_END
+}
+
+void CFFT2DPlan::dft2_real(
+    const CMatrixFloat& in_data, CMatrixFloat& out_real, CMatrixFloat& out_imag)
 {
   MRPT_START
 
   size_t i, j;
-  using float_ptr = FFT_TYPE*;
 
   // The dimensions:
   size_t dim1 = in_data.rows();
   size_t dim2 = in_data.cols();
 
+  prepare(dim1, dim2);
+  FFT_TYPE** a = m_a.data();
+  FFT_TYPE* t = m_t.data();
+  int* ip = m_ip.data();
+  FFT_TYPE* w = m_w.data();
+
   // Transform to format compatible with C routines:
   // ------------------------------------------------------------
-  FFT_TYPE** a;
-  FFT_TYPE* t;
-  int* ip;
-  FFT_TYPE* w;
-
-  // Reserve memory and copy data:
-  // --------------------------------------
-  a = new float_ptr[dim1];
   for (i = 0; i < dim1; i++)
-  {
-    a[i] = new FFT_TYPE[dim2];
     for (j = 0; j < dim2; j++) a[i][j] = in_data(i, j);
-  }
-
-  t = new FFT_TYPE[2 * dim1 + 20];
-  ip = new int[(int)ceil(20 + 2 + sqrt((FFT_TYPE)max(dim1, dim2 / 2)))];
-  ip[0] = 0;
-  w = new FFT_TYPE[max(dim1 / 2, dim2 / 4) + dim2 / 4 + 20];
 
   // Do the job!
   // --------------------------------------
@@ -1050,23 +1063,15 @@ void math::dft2_real(const CMatrixFloat& in_data, CMatrixFloat& out_real, CMatri
   out_real(dim1 / 2, 0) = (float)a[dim1 / 2][0];
   out_real(dim1 / 2, dim2 / 2) = (float)a[dim1 / 2][1];
 
-  // Free temporary memory:
-  for (i = 0; i < dim1; i++) delete[] a[i];
-  delete[] a;
-  delete[] t;
-  delete[] ip;
-  delete[] w;
-
   MRPT_END
 }
 
-void math::idft2_real(
+void CFFT2DPlan::idft2_real(
     const CMatrixFloat& in_real, const CMatrixFloat& in_imag, CMatrixFloat& out_data)
 {
   MRPT_START
 
   size_t i, j;
-  using float_ptr = FFT_TYPE*;
 
   ASSERT_(in_real.rows() == in_imag.rows());
   ASSERT_(in_real.cols() == in_imag.cols());
@@ -1075,21 +1080,14 @@ void math::idft2_real(
   size_t dim1 = in_real.rows();
   size_t dim2 = in_real.cols();
 
-  if (mrpt::round2up(dim1) != dim1 || mrpt::round2up(dim2) != dim2)
-    THROW_EXCEPTION("Matrix sizes are not a power of two!");
+  prepare(dim1, dim2);
+  FFT_TYPE** a = m_a.data();
+  FFT_TYPE* t = m_t.data();
+  int* ip = m_ip.data();
+  FFT_TYPE* w = m_w.data();
 
   // Transform to format compatible with C routines:
   // ------------------------------------------------------------
-  FFT_TYPE** a;
-  FFT_TYPE* t;
-  int* ip;
-  FFT_TYPE* w;
-
-  // Reserve memory and copy data:
-  // --------------------------------------
-  a = new float_ptr[dim1];
-  for (i = 0; i < dim1; i++) a[i] = new FFT_TYPE[dim2];
-
   // a[j1][2*j2] = R[j1][j2] = R[n1-j1][n2-j2],
   // a[j1][2*j2+1] = I[j1][j2] = -I[n1-j1][n2-j2],
   //    0<j1<n1, 0<j2<n2/2,
@@ -1131,11 +1129,6 @@ void math::idft2_real(
   a[dim1 / 2][0] = in_real(dim1 / 2, 0);
   a[dim1 / 2][1] = in_real(dim1 / 2, dim2 / 2);
 
-  t = new FFT_TYPE[2 * dim1 + 20];
-  ip = new int[(int)ceil(20 + 2 + sqrt((FFT_TYPE)max(dim1, dim2 / 2)))];
-  ip[0] = 0;
-  w = new FFT_TYPE[max(dim1 / 2, dim2 / 4) + dim2 / 4 + 20];
-
   // Do the job!
   // --------------------------------------
   rdft2d((int)dim1, (int)dim2, -1, a, t, ip, w);
@@ -1149,16 +1142,24 @@ void math::idft2_real(
   for (i = 0; i < dim1; i++)
     for (j = 0; j < dim2; j++) out_data(i, j) = (float)(a[i][j] * scale);
 
-  // Free temporary memory:
-  for (i = 0; i < dim1; i++) delete[] a[i];
-  delete[] a;
-  delete[] t;
-  delete[] ip;
-  delete[] w;
-
   MRPT_END
 }
 
+void math::dft2_real(const CMatrixFloat& in_data, CMatrixFloat& out_real, CMatrixFloat& out_imag)
+{
+  // One-shot use of a plan; repeated fixed-size callers should keep their own
+  // CFFT2DPlan instead.
+  CFFT2DPlan plan;
+  plan.dft2_real(in_data, out_real, out_imag);
+}
+
+void math::idft2_real(
+    const CMatrixFloat& in_real, const CMatrixFloat& in_imag, CMatrixFloat& out_data)
+{
+  CFFT2DPlan plan;
+  plan.idft2_real(in_real, in_imag, out_data);
+}
+
 /*---------------------------------------------------------------
             myGeneralDFT
 
@@ -1249,15 +1250,17 @@ void math::dft2_complex(
     using float_ptr = FFT_TYPE*;
 
     // Transform to format compatible with C routines:
+    // (thread_local so concurrent FFTs from different threads are safe:
+    //  each thread keeps its own cached work buffers)
     // ------------------------------------------------------------
-    static FFT_TYPE** a = nullptr;
-    static FFT_TYPE* t = nullptr;
-    static int* ip = nullptr;
-    static FFT_TYPE* w = nullptr;
+    thread_local FFT_TYPE** a = nullptr;
+    thread_local FFT_TYPE* t = nullptr;
+    thread_local int* ip = nullptr;
+    thread_local FFT_TYPE* w = nullptr;
 
     // Reserve memory
     // --------------------------------------
-    static int alreadyInitSize1 = -1, alreadyInitSize2 = -1;
+    thread_local int alreadyInitSize1 = -1, alreadyInitSize2 = -1;
 
     if (alreadyInitSize1 != (int)dim1 || alreadyInitSize2 != (int)dim2)
     {
@@ -1355,18 +1358,20 @@ void math::idft2_complex(
     // ----------------------------------------
 
     // Transform to format compatible with C routines:
+    // (thread_local so concurrent FFTs from different threads are safe:
+    //  each thread keeps its own cached work buffers)
     // ------------------------------------------------------------
-    static FFT_TYPE** a = nullptr;
-    static FFT_TYPE* t = nullptr;
-    static int* ip = nullptr;
-    static FFT_TYPE* w = nullptr;
+    thread_local FFT_TYPE** a = nullptr;
+    thread_local FFT_TYPE* t = nullptr;
+    thread_local int* ip = nullptr;
+    thread_local FFT_TYPE* w = nullptr;
 
     // Reserve memory
     // --------------------------------------
 
     // and copy data:
     // --------------------------------------
-    static int alreadyInitSize1 = -1, alreadyInitSize2 = -1;
+    thread_local int alreadyInitSize1 = -1, alreadyInitSize2 = -1;
 
     if (alreadyInitSize1 != (int)dim1 || alreadyInitSize2 != (int)dim2)
     {
@@ -0,0 +1,77 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/math/fourier.h>
+#include <mrpt/random.h>
+
+#include <Eigen/Dense>
+
+using namespace mrpt::math;
+
+static CMatrixFloat randomMatrix(size_t rows, size_t cols)
+{
+  auto& rnd = mrpt::random::getRandomGenerator();
+  CMatrixFloat m(rows, cols);
+  for (size_t i = 0; i < rows; i++)
+    for (size_t j = 0; j < cols; j++) m(i, j) = rnd.drawUniform(-1.0f, 1.0f);
+  return m;
+}
+
+TEST(fourier, dft2_real_roundTrip)
+{
+  const CMatrixFloat in = randomMatrix(16, 8);
+
+  CMatrixFloat re, im, out;
+  dft2_real(in, re, im);
+  idft2_real(re, im, out);
+
+  ASSERT_EQ(out.rows(), in.rows());
+  ASSERT_EQ(out.cols(), in.cols());
+  for (int i = 0; i < in.rows(); i++)
+    for (int j = 0; j < in.cols(); j++) EXPECT_NEAR(out(i, j), in(i, j), 1e-4) << "(" << i << "," << j << ")";
+}
+
+TEST(fourier, CFFT2DPlan_matchesFreeFunctions)
+{
+  CFFT2DPlan plan;
+
+  // Run several same-size transforms through one plan (tables are built once
+  // and reused) and check each against the one-shot free functions:
+  for (int iter = 0; iter < 3; iter++)
+  {
+    const CMatrixFloat in = randomMatrix(8, 16);
+
+    CMatrixFloat re1, im1, re2, im2;
+    plan.dft2_real(in, re1, im1);
+    dft2_real(in, re2, im2);
+
+    EXPECT_NEAR((re1.asEigen() - re2.asEigen()).cwiseAbs().maxCoeff(), 0, 1e-6f);
+    EXPECT_NEAR((im1.asEigen() - im2.asEigen()).cwiseAbs().maxCoeff(), 0, 1e-6f);
+
+    CMatrixFloat out;
+    plan.idft2_real(re1, im1, out);
+    EXPECT_NEAR((out.asEigen() - in.asEigen()).cwiseAbs().maxCoeff(), 0, 1e-4f);
+  }
+
+  // The plan must transparently rebuild its tables for a new size:
+  const CMatrixFloat in2 = randomMatrix(32, 4);
+  CMatrixFloat re, im, out;
+  plan.dft2_real(in2, re, im);
+  plan.idft2_real(re, im, out);
+  EXPECT_NEAR((out.asEigen() - in2.asEigen()).cwiseAbs().maxCoeff(), 0, 1e-4f);
+}
+
+TEST(fourier, CFFT2DPlan_rejectsNonPow2)
+{
+  CFFT2DPlan plan;
+  const CMatrixFloat in = randomMatrix(10, 16);
+  CMatrixFloat re, im;
+  EXPECT_ANY_THROW(plan.dft2_real(in, re, im));
+}
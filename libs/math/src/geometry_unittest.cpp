@@ -621,6 +621,47 @@ TEST(TPolygon2D, toFromYAML)
   EXPECT_TRUE(mrpt::math::TPolygon2D::FromYAML(mrpt::containers::yaml::Sequence()).empty());
 }
 
+TEST(TPolygon2D, compiledContains)
+{
+  using mrpt::math::TPoint2D;
+
+  // A concave polygon (arrow-like shape):
+  const mrpt::math::TPolygon2D p = {
+      {0.0, 0.0},
+      {4.0, 0.0},
+      {4.0, 4.0},
+      {2.0, 1.5},
+      {0.0, 4.0}
+  };
+
+  // Query points spread in & around the polygon (offset so none falls
+  // exactly on an edge, where the two inclusion rules may round differently);
+  // the compiled versions (with and without scanline table) must agree with
+  // TPolygon2D::contains():
+  std::vector<TPoint2D> queries;
+  for (double x = -1.013; x <= 5.0; x += 0.26)
+    for (double y = -1.013; y <= 5.0; y += 0.26) queries.emplace_back(x, y);
+
+  const mrpt::math::TCompiledPolygon2D cp(p);
+  const mrpt::math::TCompiledPolygon2D cpBands(p, 8 /*scanline bands*/);
+
+  std::vector<bool> res, resBands;
+  cp.containsMany(queries, res);
+  cpBands.containsMany(queries, resBands);
+
+  ASSERT_EQ(res.size(), queries.size());
+  for (size_t i = 0; i < queries.size(); i++)
+  {
+    EXPECT_EQ(res[i], p.contains(queries[i])) << "query: " << queries[i];
+    EXPECT_EQ(resBands[i], res[i]) << "query: " << queries[i];
+    EXPECT_EQ(cp.contains(queries[i]), res[i]) << "query: " << queries[i];
+  }
+
+  // Empty compiled polygon: never contains anything:
+  const mrpt::math::TCompiledPolygon2D empty;
+  EXPECT_FALSE(empty.contains({0, 0}));
+}
+
 TEST(TPolygon3D, toFromYAML)
 {
   const mrpt::math::TPolygon3D p = {
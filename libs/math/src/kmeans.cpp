@@ -10,9 +10,16 @@
 #include "math-precomp.h"  // Precompiled headers
 //
 #include <mrpt/math/kmeans.h>
+#include <mrpt/random.h>
 
-// This file is just a stub for the k-means++ library so MRPT users don't need
-//  to include those headers too.
+#include <algorithm>
+#include <limits>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// This file is a stub for the bundled k-means++ library (used for small point
+// sets) plus a blocked, multi-threaded Lloyd implementation for large ones.
 
 // Include the kmeans++ library, by David Arthur (darthur@gmail.com), 2009:
 #include "kmeans++/KMeans.h"
@@ -21,6 +28,232 @@ using namespace std;
 using namespace mrpt;
 using namespace mrpt::math;
 
+namespace
+{
+// Squared L2 distance between two contiguous d-dim rows. Kept as a plain
+// loop over contiguous memory so the compiler can vectorize it for the
+// target ISA (SSE2/AVX, depending on build flags).
+double dist2(const double* a, const double* b, const size_t d)
+{
+  double s = 0;
+  for (size_t j = 0; j < d; j++)
+  {
+    const double t = a[j] - b[j];
+    s += t * t;
+  }
+  return s;
+}
+
+// Index of the nearest center to "x" among the k contiguous rows of
+// "centers", plus the squared distance to it:
+std::pair<int, double> nearest_center(
+    const double* x, const double* centers, const size_t k, const size_t d)
+{
+  int best = 0;
+  double bestD2 = dist2(x, centers, d);
+  for (size_t c = 1; c < k; c++)
+  {
+    const double D2 = dist2(x, centers + c * d, d);
+    if (D2 < bestD2)
+    {
+      bestD2 = D2;
+      best = static_cast<int>(c);
+    }
+  }
+  return {best, bestD2};
+}
+
+// One blocked pass assigning each point (all of them, or the subset given by
+// "subset"/"nPts") to its nearest center, split into contiguous blocks over
+// up to nThreads worker threads. Optionally accumulates the per-center
+// coordinate sums and counts needed by the Lloyd center update. Returns the
+// total cost (sum of squared distances).
+double assign_pass(
+    const double* points,
+    const size_t* subset,
+    const size_t nPts,
+    const double* centers,
+    const size_t k,
+    const size_t d,
+    const size_t nThreads,
+    int* out_assignments,
+    double* out_sums,
+    size_t* out_counts)
+{
+  const size_t nT = std::max<size_t>(1, std::min(nThreads, nPts));
+
+  std::vector<double> costs(nT, 0);
+  std::vector<std::vector<double>> sums;
+  std::vector<std::vector<size_t>> counts;
+  if (out_sums)
+  {
+    sums.assign(nT, std::vector<double>(k * d, 0));
+    counts.assign(nT, std::vector<size_t>(k, 0));
+  }
+
+  const auto worker = [&](size_t t)
+  {
+    const size_t i0 = (nPts * t) / nT, i1 = (nPts * (t + 1)) / nT;
+    double costAcc = 0;
+    for (size_t i = i0; i < i1; i++)
+    {
+      const double* x = points + (subset ? subset[i] : i) * d;
+      const auto [c, D2] = nearest_center(x, centers, k, d);
+      if (out_assignments) out_assignments[i] = c;
+      costAcc += D2;
+      if (out_sums)
+      {
+        double* S = &sums[t][c * d];
+        for (size_t j = 0; j < d; j++) S[j] += x[j];
+        counts[t][c]++;
+      }
+    }
+    costs[t] = costAcc;
+  };
+
+  if (nT == 1)
+  {
+    worker(0);
+  }
+  else
+  {
+    std::vector<std::thread> threads;
+    threads.reserve(nT);
+    for (size_t t = 0; t < nT; t++) threads.emplace_back(worker, t);
+    for (auto& th : threads) th.join();
+  }
+
+  // Reduce the per-thread partials:
+  if (out_sums)
+  {
+    std::fill(out_sums, out_sums + k * d, 0.0);
+    std::fill(out_counts, out_counts + k, size_t(0));
+    for (size_t t = 0; t < nT; t++)
+    {
+      for (size_t j = 0; j < k * d; j++) out_sums[j] += sums[t][j];
+      for (size_t c = 0; c < k; c++) out_counts[c] += counts[t][c];
+    }
+  }
+  double cost = 0;
+  for (double c : costs) cost += c;
+  return cost;
+}
+
+// Blocked multi-threaded k-means with kmeans++ (D^2) seeding: full Lloyd
+// iterations, or mini-batch gradient steps if options.minibatch_size>0.
+double run_parallel_kmeans(
+    const size_t n,
+    const size_t k,
+    const size_t d,
+    const double* points,
+    const size_t attempts,
+    double* out_centers,
+    int* out_assignments,
+    const TKMeansOptions& options)
+{
+  auto& rng = mrpt::random::getRandomGenerator();
+
+  size_t nThreads = options.num_threads ? options.num_threads : std::thread::hardware_concurrency();
+  if (!nThreads) nThreads = 1;
+  // Don't spawn threads for workloads where they cannot pay off:
+  nThreads = std::min(nThreads, std::max<size_t>(1, n / 1024));
+
+  std::vector<double> centers(k * d), sums(k * d), bestCenters;
+  std::vector<size_t> cnts(k);
+  std::vector<int> assignments(n), bestAssignments;
+  double bestCost = std::numeric_limits<double>::max();
+
+  for (size_t attempt = 0; attempt < std::max<size_t>(1, attempts); attempt++)
+  {
+    // --- kmeans++ (D^2-sampling) seeding ---
+    std::vector<double> minD2(n, std::numeric_limits<double>::max());
+    {
+      const size_t i0 = rng.drawUniform32bit() % n;
+      std::copy(points + i0 * d, points + (i0 + 1) * d, centers.begin());
+    }
+    for (size_t c = 1; c < k; c++)
+    {
+      const double* lastCenter = &centers[(c - 1) * d];
+      double sumD2 = 0;
+      for (size_t i = 0; i < n; i++)
+      {
+        const double D2 = dist2(points + i * d, lastCenter, d);
+        if (D2 < minD2[i]) minD2[i] = D2;
+        sumD2 += minD2[i];
+      }
+      double r = rng.drawUniform(0.0, sumD2);
+      size_t pick = 0;
+      for (; pick + 1 < n; pick++)
+      {
+        r -= minD2[pick];
+        if (r <= 0) break;
+      }
+      std::copy(points + pick * d, points + (pick + 1) * d, centers.begin() + c * d);
+    }
+
+    double cost;
+    if (options.minibatch_size > 0 && options.minibatch_size < n)
+    {
+      // --- mini-batch k-means (Sculley, 2010) ---
+      std::vector<size_t> batch(options.minibatch_size), perCenterCount(k, 0);
+      std::vector<int> batchAssign(options.minibatch_size);
+      for (size_t iter = 0; iter < options.max_iterations; iter++)
+      {
+        for (auto& b : batch) b = rng.drawUniform32bit() % n;
+        assign_pass(
+            points, batch.data(), batch.size(), centers.data(), k, d, nThreads,
+            batchAssign.data(), nullptr, nullptr);
+        // Per-center gradient step with decaying learning rate:
+        for (size_t j = 0; j < batch.size(); j++)
+        {
+          const int c = batchAssign[j];
+          const double eta = 1.0 / double(++perCenterCount[c]);
+          double* C = &centers[c * d];
+          const double* x = points + batch[j] * d;
+          for (size_t t = 0; t < d; t++) C[t] += eta * (x[t] - C[t]);
+        }
+      }
+      // Final full pass to get the assignments and the cost:
+      cost = assign_pass(
+          points, nullptr, n, centers.data(), k, d, nThreads, assignments.data(), nullptr,
+          nullptr);
+    }
+    else
+    {
+      // --- full Lloyd iterations ---
+      cost = std::numeric_limits<double>::max();
+      for (size_t iter = 0; iter < options.max_iterations; iter++)
+      {
+        const double newCost = assign_pass(
+            points, nullptr, n, centers.data(), k, d, nThreads, assignments.data(), sums.data(),
+            cnts.data());
+        // Center update (empty clusters keep their old center):
+        for (size_t c = 0; c < k; c++)
+        {
+          if (!cnts[c]) continue;
+          const double inv = 1.0 / double(cnts[c]);
+          for (size_t j = 0; j < d; j++) centers[c * d + j] = sums[c * d + j] * inv;
+        }
+        const bool converged = (cost - newCost) <= options.epsilon * cost;
+        cost = newCost;
+        if (converged) break;
+      }
+    }
+
+    if (cost < bestCost)
+    {
+      bestCost = cost;
+      bestCenters = centers;
+      bestAssignments = assignments;
+    }
+  }
+
+  if (out_centers) std::copy(bestCenters.begin(), bestCenters.end(), out_centers);
+  if (out_assignments) std::copy(bestAssignments.begin(), bestAssignments.end(), out_assignments);
+  return bestCost;
+}
+}  // namespace
+
 namespace mrpt::math::detail
 {
 /* -------------------------------------------
@@ -28,37 +261,50 @@ namespace mrpt::math::detail
    ------------------------------------------- */
 template <>
 double internal_kmeans<double>(
-    [[maybe_unused]] const bool use_kmeansplusplus_method,
+    const bool use_kmeansplusplus_method,
     const size_t nPoints,
     const size_t k,
     const size_t dims,
     const double* points,
     const size_t attempts,
     double* out_center,
-    int* out_assignments)
+    int* out_assignments,
+    const TKMeansOptions& options)
 {
-  return RunKMeans(
-      nPoints, k, dims, const_cast<double*>(points), attempts, out_center, out_assignments);
+  // Large problems (and explicit mini-batch requests) go through the
+  // blocked multi-threaded implementation; small ones keep the bundled
+  // single-threaded kmeans++ library:
+  if (options.minibatch_size > 0 || nPoints >= options.parallel_min_points)
+    return run_parallel_kmeans(
+        nPoints, k, dims, points, attempts, out_center, out_assignments, options);
+
+  return use_kmeansplusplus_method
+      ? RunKMeansPlusPlus(
+            nPoints, k, dims, const_cast<double*>(points), attempts, out_center, out_assignments)
+      : RunKMeans(
+            nPoints, k, dims, const_cast<double*>(points), attempts, out_center, out_assignments);
 }
 
 template <>
 double internal_kmeans<float>(
-    [[maybe_unused]] const bool use_kmeansplusplus_method,
+    const bool use_kmeansplusplus_method,
     const size_t nPoints,
     const size_t k,
     const size_t dims,
     const float* points,
     const size_t attempts,
     float* out_center,
-    int* out_assignments)
+    int* out_assignments,
+    const TKMeansOptions& options)
 {
   std::vector<double> points_d(nPoints * dims);
   std::vector<double> centers_d(k * dims);
   // Convert: float -> double
   for (size_t i = 0; i < nPoints * dims; i++) points_d[i] = double(points[i]);
 
-  const double ret =
-      RunKMeans(nPoints, k, dims, &points_d[0], attempts, &centers_d[0], out_assignments);
+  const double ret = internal_kmeans<double>(
+      use_kmeansplusplus_method, nPoints, k, dims, &points_d[0], attempts, &centers_d[0],
+      out_assignments, options);
 
   // Convert: double -> float
   if (out_center)
@@ -0,0 +1,95 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/math/kmeans.h>
+#include <mrpt/random.h>
+
+#include <vector>
+
+// Two well-separated blobs; every path must find one center per blob and a
+// consistent assignment within each blob.
+static std::vector<std::vector<double>> generate_two_blobs(const size_t nPerBlob)
+{
+  auto& rng = mrpt::random::getRandomGenerator();
+  rng.randomize(333);
+
+  std::vector<std::vector<double>> pts;
+  pts.reserve(2 * nPerBlob);
+  for (size_t i = 0; i < nPerBlob; i++)
+    pts.push_back({rng.drawGaussian1D(0.0, 0.5), rng.drawGaussian1D(0.0, 0.5)});
+  for (size_t i = 0; i < nPerBlob; i++)
+    pts.push_back({rng.drawGaussian1D(10.0, 0.5), rng.drawGaussian1D(10.0, 0.5)});
+  return pts;
+}
+
+static void check_two_blob_clustering(
+    const std::vector<std::vector<double>>& pts,
+    const std::vector<int>& assignments,
+    const std::vector<std::vector<double>>& centers)
+{
+  ASSERT_EQ(centers.size(), 2U);
+  ASSERT_EQ(assignments.size(), pts.size());
+
+  const size_t nPerBlob = pts.size() / 2;
+  // All the points of one blob must end up in the same cluster, and the two
+  // blobs in different ones:
+  for (size_t i = 1; i < nPerBlob; i++) EXPECT_EQ(assignments[i], assignments[0]);
+  for (size_t i = nPerBlob + 1; i < pts.size(); i++)
+    EXPECT_EQ(assignments[i], assignments[nPerBlob]);
+  EXPECT_NE(assignments[0], assignments[nPerBlob]);
+
+  // One center near (0,0), the other near (10,10):
+  const auto& c0 = centers[assignments[0]];
+  const auto& c1 = centers[assignments[nPerBlob]];
+  EXPECT_NEAR(c0[0], 0.0, 0.2);
+  EXPECT_NEAR(c0[1], 0.0, 0.2);
+  EXPECT_NEAR(c1[0], 10.0, 0.2);
+  EXPECT_NEAR(c1[1], 10.0, 0.2);
+}
+
+TEST(KMeans, twoBlobsParallelLloyd)
+{
+  const auto pts = generate_two_blobs(500);
+
+  std::vector<int> assignments;
+  std::vector<std::vector<double>> centers;
+  mrpt::math::TKMeansOptions opts;
+  opts.parallel_min_points = 1;  // Force the multi-threaded path
+  const double cost = mrpt::math::kmeanspp(2, pts, assignments, &centers, 3, opts);
+
+  EXPECT_GT(cost, 0.0);
+  check_two_blob_clustering(pts, assignments, centers);
+}
+
+TEST(KMeans, twoBlobsMiniBatch)
+{
+  const auto pts = generate_two_blobs(500);
+
+  std::vector<int> assignments;
+  std::vector<std::vector<double>> centers;
+  mrpt::math::TKMeansOptions opts;
+  opts.minibatch_size = 64;
+  const double cost = mrpt::math::kmeanspp(2, pts, assignments, &centers, 3, opts);
+
+  EXPECT_GT(cost, 0.0);
+  check_two_blob_clustering(pts, assignments, centers);
+}
+
+TEST(KMeans, twoBlobsBundledImpl)
+{
+  const auto pts = generate_two_blobs(100);  // Below parallel_min_points
+
+  std::vector<int> assignments;
+  std::vector<std::vector<double>> centers;
+  const double cost = mrpt::math::kmeanspp(2, pts, assignments, &centers);
+
+  EXPECT_GT(cost, 0.0);
+  check_two_blob_clustering(pts, assignments, centers);
+}
@@ -64,6 +64,43 @@ TEST(Matrices, A_times_B_fix)
   EXPECT_NEAR(0, fabs(Err.asEigen().array().sum()), 1e-5);
 }
 
+TEST(Matrices, LazyMixedEigenOps)
+{
+  // Composite expressions mixing MRPT matrices and raw Eigen expressions
+  // must stay lazy and evaluate to the right values:
+  const double dat_H[] = {1, 2, 3, 4};
+  const double dat_P[] = {2, 0, 0, 3};
+  const double dat_R[] = {1, 1, 1, 1};
+  CMatrixDouble22 H(dat_H), P(dat_P), R(dat_R);
+
+  // H * P * H^t + R  (MRPT * MRPT * Eigen + MRPT):
+  CMatrixDouble22 S;
+  S = H * P * H.transpose() + R;
+
+  const auto S_ok = (H.asEigen() * P.asEigen() * H.asEigen().transpose() + R.asEigen()).eval();
+  EXPECT_NEAR(0, fabs((S.asEigen() - S_ok).sum()), 1e-10);
+
+  // Eigen expression on the left-hand side:
+  CMatrixDouble22 D;
+  D = H.transpose() * P - R;
+  const auto D_ok = (H.asEigen().transpose() * P.asEigen() - R.asEigen()).eval();
+  EXPECT_NEAR(0, fabs((D.asEigen() - D_ok).sum()), 1e-10);
+
+  // In-place variants with an Eigen rhs:
+  CMatrixDouble22 Acc = R;
+  Acc += H * P.asEigen();  // MRPT += Eigen product expression
+  Acc -= P.transpose();
+  const auto Acc_ok = (R.asEigen() + H.asEigen() * P.asEigen() - P.asEigen().transpose()).eval();
+  EXPECT_NEAR(0, fabs((Acc.asEigen() - Acc_ok).sum()), 1e-10);
+
+  // Same, with dynamic-size matrices (these are heap-backed, so laziness
+  // here is what removes the per-step temporaries):
+  CMatrixDouble Hd(2, 2, dat_H), Pd(2, 2, dat_P), Rd(2, 2, dat_R);
+  CMatrixDouble Sd;
+  Sd = Hd * Pd * Hd.transpose() + Rd;
+  EXPECT_NEAR(0, fabs((Sd.asEigen() - S_ok).sum()), 1e-10);
+}
+
 TEST(Matrices, SerializeCMatrixD)
 {
   CMatrixDouble A(3, 2, dat_A);
@@ -274,3 +274,40 @@ TEST(Matrices, loadFromTextFile)
     EXPECT_FALSE(retval) << "string:\n" << s1 << endl;
   }
 }
+
+TEST(Matrices, loadFromTextBuffer)
+{
+  // Small buffer (single-thread path), with comments and mixed separators:
+  {
+    const std::string buf =
+        "# a comment\n"
+        "1, 2.5e2, -3\n"
+        "% another comment\n"
+        "4\t5.125\t0.25\n";
+    CMatrixDouble M;
+    M.loadFromTextBuffer(buf);
+    EXPECT_EQ(M.rows(), 2);
+    EXPECT_EQ(M.cols(), 3);
+    EXPECT_DOUBLE_EQ(M(0, 1), 250.0);
+    EXPECT_DOUBLE_EQ(M(1, 2), 0.25);
+  }
+  // Large buffer (chunk-parallel path) must give the same result as
+  // feeding the same text through the std::istream reader:
+  {
+    std::string big;
+    big.reserve(4 << 20);
+    for (int i = 0; big.size() < (3u << 20); i++)
+    {
+      char line[128];
+      snprintf(line, sizeof(line), "%i %.6f %.9f %.3e\n", i, i * 0.001, i * 1e-9, i * 1e5);
+      big += line;
+    }
+    CMatrixDouble M1, M2;
+    M1.loadFromTextBuffer(big);
+    std::stringstream ss(big);
+    M2.loadFromTextFile(ss);
+    EXPECT_EQ(M1.rows(), M2.rows());
+    EXPECT_EQ(M1.cols(), M2.cols());
+    EXPECT_EQ(M1, M2);
+  }
+}
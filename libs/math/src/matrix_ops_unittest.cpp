@@ -146,3 +146,90 @@ TEST(Matrices, removeRows)
     EXPECT_ANY_THROW(M.removeRows({1}));
   }
 }
+
+TEST(Matrices, matRankUpdate)
+{
+  auto& rng = mrpt::random::getRandomGenerator();
+  rng.randomize(33);
+
+  CMatrixDouble A(5, 3);
+  for (int r = 0; r < 5; r++)
+    for (int c = 0; c < 3; c++) A(r, c) = rng.drawGaussian1D(0, 1);
+
+  // this += alpha * A*A^t vs. the expression computed via Eigen:
+  CMatrixDouble M(5, 5);
+  M.setDiagonal(5, 2.0);
+  CMatrixDouble expected = M;
+  expected.asEigen() += 0.5 * (A.asEigen() * A.asEigen().transpose());
+
+  M.matRankUpdate_AAt(A, 0.5);
+  EXPECT_NEAR((M - expected).sum_abs(), 0, 1e-10);
+
+  // this += alpha * A^t*A:
+  CMatrixDouble N(3, 3);
+  N.setDiagonal(3, 1.0);
+  CMatrixDouble expected2 = N;
+  expected2.asEigen() -= 0.25 * (A.asEigen().transpose() * A.asEigen());
+
+  N.matRankUpdate_AtA(A, -0.25);
+  EXPECT_NEAR((N - expected2).sum_abs(), 0, 1e-10);
+}
+
+TEST(Matrices, cholUpdate)
+{
+  auto& rng = mrpt::random::getRandomGenerator();
+  rng.randomize(34);
+
+  // A well-conditioned SPD matrix:
+  CMatrixDouble A(8, 4);
+  for (int r = 0; r < 8; r++)
+    for (int c = 0; c < 4; c++) A(r, c) = rng.drawGaussian1D(0, 1);
+  CMatrixDouble M;
+  M.matProductOf_AtA(A);
+  for (int i = 0; i < 4; i++) M(i, i) += 1.0;
+
+  std::vector<double> v = {0.3, -0.2, 0.5, 0.1};
+
+  // Update: chol(M) + rank-1 must equal chol(M + v*v^t):
+  CMatrixDouble U;
+  ASSERT_TRUE(M.chol(U));
+  ASSERT_TRUE(U.cholUpdate(v));
+
+  CMatrixDouble M2 = M;
+  for (int r = 0; r < 4; r++)
+    for (int c = 0; c < 4; c++) M2(r, c) += v[r] * v[c];
+  CMatrixDouble U2;
+  ASSERT_TRUE(M2.chol(U2));
+  EXPECT_NEAR((U - U2).sum_abs(), 0, 1e-9);
+
+  // Downdate must recover the original factor:
+  ASSERT_TRUE(U.cholUpdate(v, true /*subtract*/));
+  CMatrixDouble U0;
+  ASSERT_TRUE(M.chol(U0));
+  EXPECT_NEAR((U - U0).sum_abs(), 0, 1e-9);
+
+  // A downdate breaking positive definiteness must be reported:
+  CMatrixDouble Usmall(1, 1);
+  Usmall(0, 0) = 1.0;
+  std::vector<double> big = {10.0};
+  EXPECT_FALSE(Usmall.cholUpdate(big, true /*subtract*/));
+}
+
+TEST(Matrices, packedUpperTriangle)
+{
+  auto& rng = mrpt::random::getRandomGenerator();
+  rng.randomize(35);
+
+  CMatrixDouble A(6, 6), M;
+  for (int r = 0; r < 6; r++)
+    for (int c = 0; c < 6; c++) A(r, c) = rng.drawGaussian1D(0, 1);
+  M.matProductOf_AAt(A);  // symmetric
+
+  std::vector<double> packed;
+  M.packedUpperTriangle(packed);
+  EXPECT_EQ(packed.size(), 6u * 7u / 2);
+
+  CMatrixDouble M2;
+  M2.loadFromPackedUpperTriangle(6, packed);
+  EXPECT_NEAR((M - M2).sum_abs(), 0, 1e-15);
+}
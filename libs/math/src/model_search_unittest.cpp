@@ -0,0 +1,93 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/math/TLine2D.h>
+#include <mrpt/math/TPoint2D.h>
+#include <mrpt/math/model_search.h>
+#include <mrpt/random.h>
+
+using namespace mrpt;
+using namespace mrpt::math;
+
+// Minimal TModelFit fitting a 2D line through two samples:
+struct LineFit
+{
+  using Real = double;
+  using Model = TLine2D;
+
+  const std::vector<TPoint2D>& pts;
+
+  size_t getSampleCount() const { return pts.size(); }
+  bool fitModel(const std::vector<size_t>& idx, TLine2D& m) const
+  {
+    if (pts[idx[0]] == pts[idx[1]]) return false;  // degenerate
+    m = TLine2D(pts[idx[0]], pts[idx[1]]);
+    return true;
+  }
+  double testSample(size_t i, const TLine2D& m) const { return m.distance(pts[i]); }
+};
+
+// nInliers exact points on y = 0.5 x + 1, plus far-away outliers:
+static std::vector<TPoint2D> generateLineDataset(size_t nInliers, size_t nOutliers)
+{
+  auto& rnd = mrpt::random::getRandomGenerator();
+  rnd.randomize(42);
+
+  std::vector<TPoint2D> pts;
+  pts.reserve(nInliers + nOutliers);
+  for (size_t i = 0; i < nInliers; i++)
+  {
+    const double x = rnd.drawUniform(-10.0, 10.0);
+    pts.emplace_back(x, 0.5 * x + 1.0);
+  }
+  for (size_t i = 0; i < nOutliers; i++)
+    pts.emplace_back(rnd.drawUniform(-10.0, 10.0), rnd.drawUniform(10.0, 50.0));
+  return pts;
+}
+
+TEST(ModelSearch, ransacSingleModelParallelFindsLine)
+{
+  const size_t N_INLIERS = 200, N_OUTLIERS = 100;
+  const std::vector<TPoint2D> pts = generateLineDataset(N_INLIERS, N_OUTLIERS);
+  const LineFit state{pts};
+
+  ModelSearch search;
+  TLine2D model;
+  std::vector<size_t> inliers;
+  const bool ok = search.ransacSingleModelParallel(
+      state, 2 /*kernel size*/, 0.05 /*threshold*/, model, inliers);
+  ASSERT_TRUE(ok);
+
+  // All true inliers (and nothing else) must have been found:
+  ASSERT_EQ(inliers.size(), N_INLIERS);
+  for (size_t i = 0; i < N_INLIERS; i++) EXPECT_EQ(inliers[i], i);
+  for (size_t i = 0; i < pts.size(); i++)
+    EXPECT_EQ(model.distance(pts[i]) < 0.05, i < N_INLIERS) << "point #" << i;
+}
+
+TEST(ModelSearch, ransacSingleModelParallelDeterminism)
+{
+  const std::vector<TPoint2D> pts = generateLineDataset(200, 100);
+  const LineFit state{pts};
+
+  const uint32_t seed = 7;
+  std::vector<std::vector<size_t>> allInliers;
+  for (size_t nThreads : {1U, 2U, 4U, 7U})
+  {
+    ModelSearch search;
+    TLine2D model;
+    std::vector<size_t> inliers;
+    ASSERT_TRUE(search.ransacSingleModelParallel(
+        state, 2, 0.05, model, inliers, 100 /*max iters*/, seed, nThreads));
+    allInliers.push_back(inliers);
+  }
+  // Same seed => identical result, no matter the number of threads:
+  for (size_t i = 1; i < allInliers.size(); i++) EXPECT_EQ(allInliers[i], allInliers[0]);
+}
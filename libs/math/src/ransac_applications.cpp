@@ -11,6 +11,9 @@
 //
 #include <mrpt/math/ransac_applications.h>
 
+#include <algorithm>
+#include <cmath>
+
 using namespace mrpt;
 using namespace mrpt::math;
 using namespace std;
@@ -89,6 +92,52 @@ bool ransac3Dplane_degenerate(
 {
   return false;
 }
+
+template <typename T>
+T ransac3Dplane_point_distance(
+    const CMatrixDynamic<T>& allData, const CMatrixDynamic<T>& testModel, size_t i)
+{
+  TPlane plane;
+  for (int k = 0; k < 4; k++) plane.coefs[k] = testModel(0, k);
+  return T(plane.distance(TPoint3D(allData(0, i), allData(1, i), allData(2, i))));
+}
+
+/** Bulk inlier-counting kernel for 3D planes: processes the point
+ * coordinates as flat contiguous arrays (CMatrixDynamic is row-major, so
+ * each coordinate row is contiguous) in blocks whose inner loop is branchy
+ * only on the counter and auto-vectorizes well, with an exact bail-out test
+ * between blocks. */
+template <typename T>
+size_t ransac3Dplane_count(
+    const CMatrixDynamic<T>& allData,
+    const CMatrixDynamic<T>& testModel,
+    T distanceThreshold,
+    size_t bailOutAt)
+{
+  ASSERT_(testModel.rows() == 1 && testModel.cols() == 4);
+
+  const size_t N = allData.cols();
+  const T a = testModel(0, 0), b = testModel(0, 1), c = testModel(0, 2), d = testModel(0, 3);
+  // Premultiply the threshold by the normal norm so the inner loop can
+  // compare plain |a*x+b*y+c*z+d| residuals:
+  const T thr = distanceThreshold * std::sqrt(a * a + b * b + c * c);
+
+  const T* xs = &allData(0, 0);
+  const T* ys = &allData(1, 0);
+  const T* zs = &allData(2, 0);
+
+  constexpr size_t BLOCK = 4096;
+  size_t cnt = 0;
+  for (size_t i0 = 0; i0 < N; i0 += BLOCK)
+  {
+    const size_t i1 = std::min(i0 + BLOCK, N);
+    for (size_t i = i0; i < i1; i++) cnt += (std::abs(a * xs[i] + b * ys[i] + c * zs[i] + d) < thr);
+
+    // Exact bound: not enough points left to reach bailOutAt.
+    if (cnt + (N - i1) < bailOutAt) return cnt;
+  }
+  return cnt;
+}
 }  // namespace math
 }  // namespace mrpt
 
@@ -128,14 +177,16 @@ void mrpt::math::ransac_detect_3D_planes(
 
     math::RANSAC_Template<NUMTYPE> ransac;
     ransac.setVerbosityLevel(mrpt::system::LVL_INFO);
-    ransac.execute(
+    ransac.executeBatched(
         remainingPoints, mrpt::math::ransac3Dplane_fit<NUMTYPE>,
-        mrpt::math::ransac3Dplane_distance<NUMTYPE>, mrpt::math::ransac3Dplane_degenerate<NUMTYPE>,
-        threshold,
+        mrpt::math::ransac3Dplane_point_distance<NUMTYPE>,
+        mrpt::math::ransac3Dplane_degenerate<NUMTYPE>, threshold,
         3,  // Minimum set of points
         this_best_inliers, this_best_model,
-        0.999  // Prob. of good result
-    );
+        0.999,  // Prob. of good result
+        2000,  // Max. iterations
+        128,  // Batch size
+        mrpt::math::ransac3Dplane_count<NUMTYPE>);
 
     // Is this plane good enough?
     if (this_best_inliers.size() >= min_inliers_for_valid_plane)
@@ -172,6 +223,21 @@ void mrpt::math::ransac_detect_3D_planes(
 EXPLICIT_INST_ransac_detect_3D_planes(float);
 EXPLICIT_INST_ransac_detect_3D_planes(double);
 
+#define EXPLICIT_INST_ransac3Dplane_functors(_TYPE_)                                              \
+  template void mrpt::math::ransac3Dplane_fit<_TYPE_>(                                            \
+      const CMatrixDynamic<_TYPE_>& allData, const std::vector<size_t>& useIndices,               \
+      vector<CMatrixDynamic<_TYPE_>>& fitModels);                                                 \
+  template bool mrpt::math::ransac3Dplane_degenerate<_TYPE_>(                                     \
+      const CMatrixDynamic<_TYPE_>& allData, const std::vector<size_t>& useIndices);              \
+  template _TYPE_ mrpt::math::ransac3Dplane_point_distance<_TYPE_>(                               \
+      const CMatrixDynamic<_TYPE_>& allData, const CMatrixDynamic<_TYPE_>& testModel, size_t i);  \
+  template size_t mrpt::math::ransac3Dplane_count<_TYPE_>(                                        \
+      const CMatrixDynamic<_TYPE_>& allData, const CMatrixDynamic<_TYPE_>& testModel,             \
+      _TYPE_ distanceThreshold, size_t bailOutAt)
+
+EXPLICIT_INST_ransac3Dplane_functors(float);
+EXPLICIT_INST_ransac3Dplane_functors(double);
+
 /*---------------------------------------------------------------
     Aux. functions needed by ransac_detect_2D_lines
  ---------------------------------------------------------------*/
@@ -250,6 +316,45 @@ bool ransac2Dline_degenerate(
 {
   return false;
 }
+
+template <typename T>
+T ransac2Dline_point_distance(
+    const CMatrixDynamic<T>& allData, const CMatrixDynamic<T>& testModel, size_t i)
+{
+  TLine2D line;
+  for (int k = 0; k < 3; k++) line.coefs[k] = testModel(0, k);
+  return T(line.distance(TPoint2D(allData(0, i), allData(1, i))));
+}
+
+/** Bulk inlier-counting kernel for 2D lines: the analogous of
+ * ransac3Dplane_count() for |a*x+b*y+c| residuals. */
+template <typename T>
+size_t ransac2Dline_count(
+    const CMatrixDynamic<T>& allData,
+    const CMatrixDynamic<T>& testModel,
+    T distanceThreshold,
+    size_t bailOutAt)
+{
+  ASSERT_(testModel.rows() == 1 && testModel.cols() == 3);
+
+  const size_t N = allData.cols();
+  const T a = testModel(0, 0), b = testModel(0, 1), c = testModel(0, 2);
+  const T thr = distanceThreshold * std::sqrt(a * a + b * b);
+
+  const T* xs = &allData(0, 0);
+  const T* ys = &allData(1, 0);
+
+  constexpr size_t BLOCK = 4096;
+  size_t cnt = 0;
+  for (size_t i0 = 0; i0 < N; i0 += BLOCK)
+  {
+    const size_t i1 = std::min(i0 + BLOCK, N);
+    for (size_t i = i0; i < i1; i++) cnt += (std::abs(a * xs[i] + b * ys[i] + c) < thr);
+
+    if (cnt + (N - i1) < bailOutAt) return cnt;
+  }
+  return cnt;
+}
 }  // namespace math
 }  // namespace mrpt
 
@@ -285,13 +390,15 @@ void mrpt::math::ransac_detect_2D_lines(
 
     math::RANSAC_Template<NUMTYPE> ransac;
     ransac.setVerbosityLevel(mrpt::system::LVL_INFO);
-    ransac.execute(
-        remainingPoints, ransac2Dline_fit<NUMTYPE>, ransac2Dline_distance<NUMTYPE>,
+    ransac.executeBatched(
+        remainingPoints, ransac2Dline_fit<NUMTYPE>, ransac2Dline_point_distance<NUMTYPE>,
         ransac2Dline_degenerate<NUMTYPE>, threshold,
         2,  // Minimum set of points
         this_best_inliers, this_best_model,
-        0.99999  // Prob. of good result
-    );
+        0.99999,  // Prob. of good result
+        2000,  // Max. iterations
+        128,  // Batch size
+        ransac2Dline_count<NUMTYPE>);
 
     // Is this plane good enough?
     if (this_best_inliers.size() >= min_inliers_for_valid_line)
@@ -327,3 +434,18 @@ void mrpt::math::ransac_detect_2D_lines(
 
 EXPLICIT_INSTANT_ransac_detect_2D_lines(float);
 EXPLICIT_INSTANT_ransac_detect_2D_lines(double);
+
+#define EXPLICIT_INST_ransac2Dline_functors(_TYPE_)                                               \
+  template void mrpt::math::ransac2Dline_fit<_TYPE_>(                                             \
+      const CMatrixDynamic<_TYPE_>& allData, const std::vector<size_t>& useIndices,               \
+      vector<CMatrixDynamic<_TYPE_>>& fitModels);                                                 \
+  template bool mrpt::math::ransac2Dline_degenerate<_TYPE_>(                                      \
+      const CMatrixDynamic<_TYPE_>& allData, const std::vector<size_t>& useIndices);              \
+  template _TYPE_ mrpt::math::ransac2Dline_point_distance<_TYPE_>(                                \
+      const CMatrixDynamic<_TYPE_>& allData, const CMatrixDynamic<_TYPE_>& testModel, size_t i);  \
+  template size_t mrpt::math::ransac2Dline_count<_TYPE_>(                                         \
+      const CMatrixDynamic<_TYPE_>& allData, const CMatrixDynamic<_TYPE_>& testModel,             \
+      _TYPE_ distanceThreshold, size_t bailOutAt)
+
+EXPLICIT_INST_ransac2Dline_functors(float);
+EXPLICIT_INST_ransac2Dline_functors(double);
@@ -0,0 +1,138 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/math/ransac_applications.h>
+#include <mrpt/random.h>
+
+using namespace mrpt;
+using namespace mrpt::math;
+using namespace mrpt::random;
+using namespace std;
+
+// Build a synthetic dataset: nInliers points on the plane z=ax+by+d (plus
+// Gaussian noise), and nOutliers uniformly scattered points.
+static CMatrixDouble generateNoisyPlanePoints(
+    size_t nInliers, size_t nOutliers, double a, double b, double d, double noiseStd)
+{
+  auto& rnd = getRandomGenerator();
+  const size_t N = nInliers + nOutliers;
+  CMatrixDouble data(3, N);
+  for (size_t i = 0; i < nInliers; i++)
+  {
+    const double x = rnd.drawUniform(-10.0, 10.0);
+    const double y = rnd.drawUniform(-10.0, 10.0);
+    data(0, i) = x;
+    data(1, i) = y;
+    data(2, i) = a * x + b * y + d + rnd.drawGaussian1D(0, noiseStd);
+  }
+  for (size_t i = nInliers; i < N; i++)
+  {
+    data(0, i) = rnd.drawUniform(-10.0, 10.0);
+    data(1, i) = rnd.drawUniform(-10.0, 10.0);
+    data(2, i) = rnd.drawUniform(-50.0, 50.0);
+  }
+  return data;
+}
+
+TEST(Ransac, executeBatchedFindsPlane)
+{
+  getRandomGenerator().randomize(333);
+
+  const double PLANE_A = 0.1, PLANE_B = -0.3, PLANE_D = 2.0;
+  const size_t N_INLIERS = 600, N_OUTLIERS = 400;
+  const double DIST_THRESHOLD = 0.05;
+
+  const CMatrixDouble data =
+      generateNoisyPlanePoints(N_INLIERS, N_OUTLIERS, PLANE_A, PLANE_B, PLANE_D, 0.005);
+
+  RANSAC ransac;
+  ransac.setMinLoggingLevel(mrpt::system::LVL_ERROR);
+
+  std::vector<size_t> best_inliers;
+  CMatrixDouble best_model;
+  const bool ok = ransac.executeBatched(
+      data, ransac3Dplane_fit<double>, ransac3Dplane_point_distance<double>,
+      ransac3Dplane_degenerate<double>, DIST_THRESHOLD,
+      3,  // Minimum set of points
+      best_inliers, best_model, 0.999);
+
+  EXPECT_TRUE(ok);
+  ASSERT_EQ(best_model.rows(), 1);
+  ASSERT_EQ(best_model.cols(), 4);
+
+  // Most of the true inliers must be recovered (and few outliers picked up):
+  EXPECT_GT(best_inliers.size(), size_t(0.9 * N_INLIERS));
+  EXPECT_LT(best_inliers.size(), size_t(1.1 * N_INLIERS));
+
+  // The recovered plane must be close to the generating one:
+  TPlane plane(best_model(0, 0), best_model(0, 1), best_model(0, 2), best_model(0, 3));
+  plane.unitarize();
+  const TPlane gtPlane(PLANE_A, PLANE_B, -1.0, PLANE_D);
+  for (size_t i = 0; i < 20; i++)
+  {
+    const double x = getRandomGenerator().drawUniform(-10.0, 10.0);
+    const double y = getRandomGenerator().drawUniform(-10.0, 10.0);
+    const TPoint3D pt(x, y, PLANE_A * x + PLANE_B * y + PLANE_D);
+    EXPECT_LT(plane.distance(pt), DIST_THRESHOLD) << "gt plane: " << gtPlane.asString();
+  }
+}
+
+TEST(Ransac, executeBatchedWithBulkCountKernel)
+{
+  getRandomGenerator().randomize(333);
+
+  const CMatrixDouble data = generateNoisyPlanePoints(600, 400, 0.1, -0.3, 2.0, 0.005);
+
+  RANSAC ransac;
+  ransac.setMinLoggingLevel(mrpt::system::LVL_ERROR);
+
+  std::vector<size_t> best_inliers;
+  CMatrixDouble best_model;
+  const bool ok = ransac.executeBatched(
+      data, ransac3Dplane_fit<double>, ransac3Dplane_point_distance<double>,
+      ransac3Dplane_degenerate<double>, 0.05, 3, best_inliers, best_model, 0.999, 2000, 128,
+      ransac3Dplane_count<double>);
+
+  EXPECT_TRUE(ok);
+  EXPECT_GT(best_inliers.size(), size_t(0.9 * 600));
+}
+
+TEST(Ransac, detect3DPlanes)
+{
+  getRandomGenerator().randomize(333);
+
+  // Two parallel planes plus background outliers:
+  const size_t N1 = 500, N2 = 300, NO = 200;
+  const CMatrixDouble d1 = generateNoisyPlanePoints(N1, 0, 0.1, -0.3, 2.0, 0.005);
+  const CMatrixDouble d2 = generateNoisyPlanePoints(N2, NO, 0.1, -0.3, 12.0, 0.005);
+
+  CVectorDouble xs(N1 + N2 + NO), ys(N1 + N2 + NO), zs(N1 + N2 + NO);
+  for (size_t i = 0; i < N1; i++)
+  {
+    xs[i] = d1(0, i);
+    ys[i] = d1(1, i);
+    zs[i] = d1(2, i);
+  }
+  for (size_t i = 0; i < N2 + NO; i++)
+  {
+    xs[N1 + i] = d2(0, i);
+    ys[N1 + i] = d2(1, i);
+    zs[N1 + i] = d2(2, i);
+  }
+
+  std::vector<std::pair<size_t, TPlane>> detected;
+  ransac_detect_3D_planes(xs, ys, zs, detected, 0.05, 100);
+
+  ASSERT_EQ(detected.size(), 2U);
+  // Largest plane first is not guaranteed; just check both sizes:
+  const size_t s0 = detected[0].first, s1 = detected[1].first;
+  EXPECT_GT(std::max(s0, s1), size_t(0.9 * N1));
+  EXPECT_GT(std::min(s0, s1), size_t(0.9 * N2));
+}
@@ -11,6 +11,9 @@
 #include <mrpt/config/CLoadableOptions.h>
 #include <mrpt/obs/CSinCosLookUpTableFor2DScans.h>
 
+#include <utility>
+#include <vector>
+
 #include "CAbstractHolonomicReactiveMethod.h"
 
 namespace mrpt::nav
@@ -126,6 +129,36 @@ class CHolonomicFullEval : public CAbstractHolonomicReactiveMethod
   /** Evals one single target of the potentially many of them in NavInput */
   void evalSingleTarget(unsigned int target_idx, const NavInput& ni, EvalOutput& eo);
 
+  /** The user-configurable scoring "formula" (phases, factor indices and
+   * weights), pre-parsed once from `options` into flat tables so the
+   * per-direction evaluation loops do not need to walk the configuration
+   * containers for every direction and cycle. Rebuilt automatically whenever
+   * the relevant option fields change. \note [New in MRPT 2.14.5] */
+  struct TScoringTables
+  {
+    /** One entry per phase: flat list of (factor index, weight) terms */
+    std::vector<std::vector<std::pair<uint32_t, double>>> phaseTerms;
+    /** One entry per phase: 1/(sum of its term weights) */
+    std::vector<double> invWeightsSum;
+    /** Whether each factor appears in any phase */
+    std::vector<uint8_t> factorUsed;
+
+    bool upToDate(const TOptions& o) const;
+    void rebuild(const TOptions& o);
+
+   private:
+    // The option values the tables were built from, to detect changes:
+    std::vector<double> m_builtFromWeights;
+    std::vector<std::vector<int32_t>> m_builtFromPhaseFactors;
+  };
+  TScoringTables m_scoring_tables;
+
+  /** Per-factor contiguous buffers with log(max(1e-6,score)) for each
+   * direction; filled once per evalSingleTarget() call and shared by all
+   * evaluation phases. Members to save realloc time between calls. */
+  std::vector<std::vector<double>> m_log_scores;
+  std::vector<double> m_phase_acc;
+
   mrpt::obs::CSinCosLookUpTableFor2DScans m_sincos_lut;
 };  // end of CHolonomicFullEval
 
@@ -12,8 +12,10 @@
 #include <mrpt/maps/CSimplePointsMap.h>
 #include <mrpt/nav/planners/PlannerRRT_common.h>
 #include <mrpt/nav/planners/TMoveTree.h>
+#include <mrpt/system/WorkerThreadsPool.h>
 
 #include <numeric>
+#include <vector>
 
 namespace mrpt::nav
 {
@@ -104,6 +106,28 @@ class PlannerRRT_SE2_TPS : public PlannerTPS_VirtualBase
  protected:
   bool m_initialized{false};
 
+  /** Worker pool for the concurrent collision checks of the batched tree
+   * extension; spun up lazily when `params.samplesPerIteration>1` */
+  mrpt::system::WorkerThreadsPool m_extension_pool;
+  size_t m_extension_pool_threads{0};
+  /** Per-task local obstacle clouds, reused between iterations to save
+   * realloc time (the serial path keeps using the inherited m_local_obs) */
+  std::vector<mrpt::maps::CSimplePointsMap> m_local_obs_per_task;
+
+  /** Evaluates one candidate tree extension: nearest-node lookup for
+   * `x_rand` along the idxPTG-th PTG, plus its TP-space collision check.
+   * Read-only on the tree and the obstacles cloud, so it is safe to run
+   * concurrently for different candidates.
+   * \return true if `outEdge` holds a valid, collision-free new edge. */
+  bool evaluateCandidateExtension(
+      const TPlannerInput& pi,
+      const TPlannerResult& result,
+      const mrpt::math::TPose2D& x_rand,
+      const size_t idxPTG,
+      const double max_veh_radius,
+      mrpt::maps::CSimplePointsMap& localObs,
+      TMoveEdgeSE2_TP& outEdge);
+
 };  // end class PlannerRRT_SE2_TPS
 
 /** @} */
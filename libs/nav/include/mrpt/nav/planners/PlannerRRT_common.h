@@ -125,6 +125,16 @@ struct RRTAlgorithmParams
    * SceneViewer3D (default=0, disabled) */
   size_t save_3d_log_freq{0};
 
+  /** Number of random candidate states drawn per RRT iteration (default=1).
+   * With the default value the tree grows serially, exactly as in the
+   * original algorithm. Values >1 enable batched tree extension: the
+   * TP-space collision checks of all candidates are evaluated concurrently
+   * in a worker thread pool (the tree and the obstacle cloud are read-only
+   * during the checks) and the surviving nodes are then inserted
+   * sequentially. Useful to cut down planning time for dynamic replanning.
+   * \note [New in MRPT 2.14.5] */
+  size_t samplesPerIteration{1};
+
   RRTAlgorithmParams();
 };
 
@@ -8,6 +8,7 @@
    +------------------------------------------------------------------------+ */
 #pragma once
 
+#include <mrpt/core/WorkerThreadsPool.h>
 #include <mrpt/maps/CPointCloudFilterBase.h>
 #include <mrpt/math/CPolygon.h>
 #include <mrpt/math/filters.h>
@@ -18,10 +19,12 @@
 #include <mrpt/nav/reactive/CWaypointsNavigator.h>
 #include <mrpt/nav/reactive/TCandidateMovementPTG.h>
 #include <mrpt/nav/tpspace/CParameterizedTrajectoryGenerator.h>
+#include <mrpt/system/CLatencyMonitor.h>
 #include <mrpt/system/CTimeLogger.h>
 #include <mrpt/system/datetime.h>
 
 #include <memory>  // unique_ptr
+#include <mutex>
 
 namespace mrpt::nav
 {
@@ -210,6 +213,13 @@ class CAbstractPTGBasedReactive : public CWaypointsNavigator
     /** Max dist [meters] to use time-based path prediction for NOP
      * evaluation. */
     double max_dist_for_timebased_path_prediction{2.0};
+    /** Number of worker threads evaluating the per-PTG pipeline (obstacle
+     * transform, TP-obstacles, holonomic method) in parallel within one
+     * navigation cycle. 1 (default): sequential; 0: one per CPU core.
+     * When >1, the per-PTG sections of the navigation profiler are
+     * skipped, since they would overlap in time.
+     * [New in MRPT 2.14.5] */
+    uint32_t ptg_eval_threads{1};
 
     void loadFromConfigFile(const mrpt::config::CConfigFileBase& c, const std::string& s) override;
     void saveToConfigFile(mrpt::config::CConfigFileBase& c, const std::string& s) const override;
@@ -231,6 +241,17 @@ class CAbstractPTGBasedReactive : public CWaypointsNavigator
    * enableTimeLog */
   const mrpt::system::CTimeLogger& getTimeLogger() const { return m_timelogger; }
 
+  /** Access to the latency histogram & deadline watchdog of
+   * performNavigationStep(). Disabled by default; enable it either with
+   * `latencyMonitor().enable()` or, at runtime, by defining the environment
+   * variable `MRPT_NAV_LATENCY_MONITOR=1` (plus, optionally, a periodic
+   * percentile-table dump period in seconds in
+   * `MRPT_NAV_LATENCY_MONITOR_DUMP_PERIOD`, default: 10). Use
+   * `latencyMonitor().setDeadline()` to get notified of deadline overruns.
+   * \note [New in MRPT 2.14.5] */
+  mrpt::system::CLatencyMonitor& latencyMonitor() { return m_latencyMonitor; }
+  const mrpt::system::CLatencyMonitor& latencyMonitor() const { return m_latencyMonitor; }
+
   /** Returns the number of different PTGs that have been setup */
   virtual size_t getPTG_count() const = 0;
   /** Gets the i'th PTG */
@@ -289,6 +310,10 @@ class CAbstractPTGBasedReactive : public CWaypointsNavigator
 
   /** A complete time logger \sa enableTimeLog() */
   mrpt::system::CTimeLogger m_timelogger{false};  // default: disabled
+  /** Latency histograms & deadline watchdog of performNavigationStep()
+   * \sa latencyMonitor() */
+  mrpt::system::CLatencyMonitor m_latencyMonitor{
+      false, "mrpt::nav::CAbstractPTGBasedReactive"};  // default: disabled
   bool m_PTGsMustBeReInitialized{true};
 
   /** @name Variables for CReactiveNavigationSystem::performNavigationStep
@@ -302,6 +327,17 @@ class CAbstractPTGBasedReactive : public CWaypointsNavigator
       timoff_curPoseAndSpeed_avr{0.7}, timoff_sendVelCmd_avr{0.7};
   /** @} */
 
+  /** Worker threads for the per-PTG evaluation pipeline; created on demand
+   * when params_abstract_ptg_navigator.ptg_eval_threads != 1 */
+  std::unique_ptr<mrpt::WorkerThreadsPool> m_ptgEvalPool;
+  /** True while the per-PTG pipeline runs inside m_ptgEvalPool workers.
+   * Per-PTG profiler sections are skipped then: CTimeLogger does not
+   * support concurrent enter()/leave() of one same section. */
+  bool m_insideParallelPTGEval{false};
+  /** Protects the parts of the log record shared between PTGs
+   * (additional_debug_msgs) while they are evaluated in parallel. */
+  std::mutex m_logRecMutex;
+
   bool impl_waypoint_is_reachable(
       const mrpt::math::TPoint2D& wp_local_wrt_robot) const override;  // See docs in base class
 
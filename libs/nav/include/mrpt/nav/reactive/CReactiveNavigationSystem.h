@@ -8,6 +8,9 @@
    +------------------------------------------------------------------------+ */
 #pragma once
 
+#include <array>
+#include <mutex>
+
 #include "CAbstractPTGBasedReactive.h"
 
 namespace mrpt::nav
@@ -136,6 +139,14 @@ class CReactiveNavigationSystem : public CAbstractPTGBasedReactive
   mrpt::maps::CSimplePointsMap m_WS_Obstacles;
   /** Obstacle points, before filtering (if filtering is enabled). */
   mrpt::maps::CSimplePointsMap m_WS_Obstacles_original;
+  /** Scratch buffer where senseObstacles() writes each navigation cycle;
+   * only copied into m_WS_Obstacles / m_WS_Obstacles_original (and run
+   * through the optional filter) when the sensor actually produced a new
+   * cloud. \note [New in MRPT 2.14.5] */
+  mrpt::maps::CSimplePointsMap m_WS_Obstacles_sensed;
+  /** Timestamp of the cloud currently cached in m_WS_Obstacles; key for
+   * reusing the filtered obstacle set across cycles. */
+  mrpt::system::TTimeStamp m_WS_Obstacles_cache_timestamp{INVALID_TIMESTAMP};
   // See docs in parent class
   void STEP3_WSpaceToTPSpace(
       size_t ptg_idx,
@@ -144,5 +155,38 @@ class CReactiveNavigationSystem : public CAbstractPTGBasedReactive
       const mrpt::math::TPose2D& rel_pose_PTG_origin_wrt_sense,
       const bool eval_clearance) override;
 
+  /** Per-navigation-cycle cache with the sensed obstacle points already
+   * transformed into the PTG origin frame, culled by the workspace box and
+   * the obstacle height limits, and binned into coarse range rings, so each
+   * PTG only visits the points that can actually affect its TP-obstacles.
+   * Built once per cycle on the first call to STEP3_WSpaceToTPSpace() and
+   * shared by all PTGs (see `ptg_eval_threads`). \note [New in MRPT 2.14.5]
+   */
+  struct TTransformedObstacleBins
+  {
+    /** Number of coarse range rings */
+    static constexpr size_t NUM_RINGS = 8;
+
+    /** Timestamp of the obstacles this cache was built from */
+    mrpt::system::TTimeStamp timestamp{INVALID_TIMESTAMP};
+    /** Relative pose the points were transformed with */
+    mrpt::math::TPose2D rel_pose{0, 0, 0};
+    /** Radial width of each ring [m] */
+    double ring_width{.0};
+    /** Transformed point coordinates, stored contiguously, sorted by ring */
+    std::vector<float> xs, ys;
+    /** One-past-the-last index into `xs`/`ys` for each ring */
+    std::array<size_t, NUM_RINGS> ring_end{};
+  };
+
+  /** Rebuilds m_ws_obs_bins from m_WS_Obstacles for the given relative pose.
+   * Caller must hold m_ws_obs_bins_mtx. */
+  void rebuildObstacleBins(const mrpt::math::TPose2D& rel_pose, const float obs_max_xy);
+
+  TTransformedObstacleBins m_ws_obs_bins;
+  /** Protects the build of m_ws_obs_bins when PTGs are evaluated in parallel
+   */
+  std::mutex m_ws_obs_bins_mtx;
+
 };  // end class
 }  // namespace mrpt::nav
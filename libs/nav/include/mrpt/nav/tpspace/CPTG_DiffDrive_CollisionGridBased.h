@@ -9,10 +9,13 @@
 #pragma once
 
 #include <mrpt/containers/CDynamicGrid.h>
+#include <mrpt/io/CMemoryMappedFileStream.h>
 #include <mrpt/math/CPolygon.h>
 #include <mrpt/nav/tpspace/CParameterizedTrajectoryGenerator.h>
 #include <mrpt/typemeta/TEnumType.h>
 
+#include <memory>
+
 namespace mrpt
 {
 namespace nav
@@ -190,6 +193,26 @@ class CPTG_DiffDrive_CollisionGridBased : public CPTG_RobotShape_Polygonal
     bool loadFromFile(
         mrpt::serialization::CArchive* fil, const mrpt::math::CPolygon& current_robotShape);
 
+    /** Writes the flat binary cache file read back by attachFlatCacheFile(),
+     * true = OK. [New in MRPT 2.14.5] */
+    bool saveFlatCacheFile(
+        const std::string& filename, const mrpt::math::CPolygon& computed_robotShape) const;
+
+    /** Tries to attach this grid to a flat binary cache file (see
+     * saveFlatCacheFile()): the file is memory-mapped read-only, so cells
+     * are decoded lazily on first access (the OS pages them in on demand)
+     * and the mapping is shared with any other process using the same
+     * cache, e.g. the navigator and ptg-configurator.
+     * Returns false, leaving the grid untouched, if the file does not
+     * exist or its header (version, robot shape, PTG parameters, grid
+     * geometry) does not match this grid.
+     * \note Lazy decoding mutates an internal cache, so concurrent calls
+     * to getTPObstacle() from several threads require external
+     * synchronization (plain deserialized grids are read-only and safe).
+     * [New in MRPT 2.14.5] */
+    bool attachFlatCacheFile(
+        const std::string& filename, const mrpt::math::CPolygon& current_robotShape);
+
     /** For an obstacle (x,y), returns a vector with all the pairs (a,d)
      * such as the robot collides */
     const TCollisionCell& getTPObstacle(const float obsX, const float obsY) const;
@@ -203,6 +226,22 @@ class CPTG_DiffDrive_CollisionGridBased : public CPTG_RobotShape_Polygonal
     void updateCellInfo(
         const unsigned int icx, const unsigned int icy, const uint16_t k, const float dist);
 
+   private:
+    /** The mapping of the attached flat cache file, if any (see
+     * attachFlatCacheFile()); shared so copies of the grid reuse it. */
+    std::shared_ptr<mrpt::io::CMemoryMappedFileStream> m_flatCache;
+    /** Pointer into the mapping: size_x*size_y+1 record indices, cell
+     * (cx,cy) owns records [table[i], table[i+1]) with i=cx+cy*size_x. */
+    const uint64_t* m_flatCellTable{nullptr};
+    /** Pointer into the mapping: the 8-byte collision records. */
+    const uint8_t* m_flatRecords{nullptr};
+    /** Which cells of m_map already hold their decoded records. */
+    mutable std::vector<bool> m_cellDecoded;
+
+    /** Returns the (lazily decoded) cell in flat-cache mode, or nullptr if
+     * out of bounds. */
+    const TCollisionCell* lazyCell(const int icx, const int icy) const;
+
   };  // end of class CCollisionGrid
 
   // Save/Load from files.
@@ -531,7 +531,14 @@ class CPTG_RobotShape_Polygonal : public CParameterizedTrajectoryGenerator
   /** Will be called whenever the robot shape is set / updated */
   virtual void internal_processNewRobotShape() = 0;
   mrpt::math::CPolygon m_robotShape;
+  /** Precompiled version of m_robotShape for the point-in-shape tests in the
+   * collision-check inner loops; rebuilt by internal_updateRobotShapeCache()
+   * whenever the shape changes. */
+  mrpt::math::TCompiledPolygon2D m_robotShapeCompiled;
   double m_robotMaxRadius{.01};
+  /** Recompiles m_robotShapeCompiled and m_robotMaxRadius from m_robotShape
+   */
+  void internal_updateRobotShapeCache();
   void loadShapeFromConfigFile(
       const mrpt::config::CConfigFileBase& source, const std::string& section);
   void saveToConfigFile(
@@ -273,13 +273,20 @@ void CHolonomicFullEval::evalSingleTarget(
   const unsigned int NUM_PHASES = options.PHASE_FACTORS.size();
   ASSERT_(NUM_PHASES >= 1);
 
-  std::vector<double> weights_sum_phase(NUM_PHASES, .0), weights_sum_phase_inv(NUM_PHASES);
-  for (unsigned int i = 0; i < NUM_PHASES; i++)
+  // Pre-parse the configurable scoring formula (phases, factor indices and
+  // weights) into flat tables, only rebuilt if the user changed the options:
+  if (!m_scoring_tables.upToDate(options)) m_scoring_tables.rebuild(options);
+
+  // log() of each factor score, over contiguous per-direction arrays;
+  // computed once here and shared by all phases below (the same factor may
+  // appear in several phases):
+  m_log_scores.resize(NUM_FACTORS);
+  for (unsigned int l = 0; l < NUM_FACTORS; l++)
   {
-    for (unsigned int l : options.PHASE_FACTORS[i])
-      weights_sum_phase[i] += options.factorWeights.at(l);
-    ASSERT_(weights_sum_phase[i] > .0);
-    weights_sum_phase_inv[i] = 1.0 / weights_sum_phase[i];
+    if (!m_scoring_tables.factorUsed[l]) continue;
+    auto& lc = m_log_scores[l];
+    lc.resize(nDirs);
+    for (unsigned int i = 0; i < nDirs; i++) lc[i] = std::log(std::max(1e-6, m_dirs_scores(i, l)));
   }
 
   eo.phase_scores = std::vector<std::vector<double>>(NUM_PHASES, std::vector<double>(nDirs, .0));
@@ -288,11 +295,22 @@ void CHolonomicFullEval::evalSingleTarget(
 
   for (unsigned int phase_idx = 0; phase_idx < NUM_PHASES; phase_idx++)
   {
+    // Weighted sum of factor logs, fused over the contiguous per-factor
+    // arrays (direction-inner loops, so the compiler can vectorize them):
+    auto& acc = m_phase_acc;
+    acc.assign(nDirs, .0);
+    for (const auto& [l, w] : m_scoring_tables.phaseTerms[phase_idx])
+    {
+      const auto& lc = m_log_scores[l];
+      for (unsigned int i = 0; i < nDirs; i++) acc[i] += w * lc[i];
+    }
+    const double inv_weights_sum = m_scoring_tables.invWeightsSum[phase_idx];
+
     double phase_min = std::numeric_limits<double>::max(), phase_max = .0;
 
     for (unsigned int i = 0; i < nDirs; i++)
     {
-      double this_dir_eval = 0;
+      double this_dir_eval;
 
       if (ni.obstacles[i] < options.TOO_CLOSE_OBSTACLE ||  // Too close to obstacles ?
           (phase_idx > 0 &&
@@ -304,13 +322,8 @@ void CHolonomicFullEval::evalSingleTarget(
       }
       else
       {
-        // Weighted avrg of factors:
-        for (unsigned int l : options.PHASE_FACTORS[phase_idx])
-          this_dir_eval +=
-              options.factorWeights.at(l) * std::log(std::max(1e-6, m_dirs_scores(i, l)));
-
-        this_dir_eval *= weights_sum_phase_inv[phase_idx];
-        this_dir_eval = std::exp(this_dir_eval);
+        // Weighted geometric mean of factors:
+        this_dir_eval = std::exp(acc[i] * inv_weights_sum);
       }
       phase_scores[phase_idx][i] = this_dir_eval;
 
@@ -524,6 +537,36 @@ void CHolonomicFullEval::navigate(const NavInput& ni, NavOutput& no)
   }
 }
 
+bool CHolonomicFullEval::TScoringTables::upToDate(const TOptions& o) const
+{
+  return m_builtFromWeights == o.factorWeights && m_builtFromPhaseFactors == o.PHASE_FACTORS;
+}
+
+void CHolonomicFullEval::TScoringTables::rebuild(const TOptions& o)
+{
+  const size_t nPhases = o.PHASE_FACTORS.size();
+  phaseTerms.assign(nPhases, {});
+  invWeightsSum.assign(nPhases, .0);
+  factorUsed.assign(NUM_FACTORS, 0);
+
+  for (size_t p = 0; p < nPhases; p++)
+  {
+    double weights_sum = .0;
+    for (const int32_t l : o.PHASE_FACTORS[p])
+    {
+      const double w = o.factorWeights.at(l);
+      phaseTerms[p].emplace_back(static_cast<uint32_t>(l), w);
+      factorUsed.at(l) = 1;
+      weights_sum += w;
+    }
+    ASSERT_(weights_sum > .0);
+    invWeightsSum[p] = 1.0 / weights_sum;
+  }
+
+  m_builtFromWeights = o.factorWeights;
+  m_builtFromPhaseFactors = o.PHASE_FACTORS;
+}
+
 unsigned int CHolonomicFullEval::direction2sector(const double a, const unsigned int N)
 {
   const int idx = round(0.5 * (N * (1 + mrpt::math::wrapToPi(a) / M_PI) - 1));
@@ -15,6 +15,9 @@
 #include <mrpt/system/CTicTac.h>
 #include <mrpt/system/filesystem.h>
 
+#include <future>
+#include <thread>
+
 using namespace mrpt::nav;
 using namespace mrpt::math;
 using namespace mrpt::system;
@@ -40,6 +43,145 @@ void PlannerRRT_SE2_TPS::initialize()
   m_initialized = true;
 }
 
+bool PlannerRRT_SE2_TPS::evaluateCandidateExtension(
+    const PlannerRRT_SE2_TPS::TPlannerInput& pi,
+    const PlannerRRT_SE2_TPS::TPlannerResult& result,
+    const mrpt::math::TPose2D& x_rand,
+    const size_t idxPTG,
+    const double max_veh_radius,
+    mrpt::maps::CSimplePointsMap& localObs,
+    TMoveEdgeSE2_TP& outEdge)
+{
+  // [Algo `tp_space_rrt`: Line 5]: Search nearest neig. to x_rand
+  // -----------------------------------------------
+  const PoseDistanceMetric<TNodeSE2_TP> distance_evaluator(*m_PTGs[idxPTG]);
+
+  const TNodeSE2_TP query_node(x_rand);
+
+  const mrpt::graphs::TNodeID x_nearest_id =
+      result.move_tree.getNearestNode(query_node, distance_evaluator);
+
+  if (x_nearest_id == mrpt::graphs::INVALID_NODEID)
+  {
+    // We can't find any close node, at least with this PTG's paths: skip
+    return false;
+  }
+
+  const TNodeSE2_TP& x_nearest_node = result.move_tree.getAllNodes().find(x_nearest_id)->second;
+
+  // [Algo `tp_space_rrt`: Line 6]: Relative target
+  // -----------------------------------------------
+  const CPose2D x_rand_pose(x_rand);
+  const CPose2D x_nearest_pose(x_nearest_node.state);
+  const CPose2D x_rand_rel = x_rand_pose - x_nearest_pose;
+
+  // [Algo `tp_space_rrt`: Line 7]: Relative target in TP-Space
+  // ------------------------------------------------------------
+  const double D_max = std::min(params.maxLength, m_PTGs[idxPTG]->getRefDistance());
+
+  double d_rand;  // Coordinates in TP-space
+  int k_rand;     // k_rand is the index of target_alpha in PTGs
+  // corresponding to a specific d_rand
+  m_PTGs[idxPTG]->inverseMap_WS2TP(x_rand_rel.x(), x_rand_rel.y(), k_rand, d_rand);
+  d_rand *= m_PTGs[idxPTG]->getRefDistance();  // distance to target, in "real meters"
+
+  // [Algo `tp_space_rrt`: Line 8]: TP-Obstacles
+  // ------------------------------------------------------------
+  // Transform obstacles as seen from x_nearest_node -> TP_obstacles
+  double TP_Obstacles_k_rand = .0;
+  const double MAX_DIST_FOR_OBSTACLES =
+      1.5 * m_PTGs[idxPTG]->getRefDistance();  // Maximum Euclidean
+  // distance (radius)
+  // for considering
+  // obstacles around the
+  // current robot pose
+
+  ASSERT_GT_(
+      m_PTGs[idxPTG]->getRefDistance(),
+      1.1 * max_veh_radius);  // Make sure the PTG covers at least a
+  // bit more than the vehicle shape!!
+  // (should be much, much higher)
+
+  transformPointcloudWithSquareClipping(
+      pi.obstacles_points, localObs, CPose2D(x_nearest_node.state), MAX_DIST_FOR_OBSTACLES);
+
+  spaceTransformerOneDirectionOnly(
+      k_rand, localObs, m_PTGs[idxPTG].get(), MAX_DIST_FOR_OBSTACLES, TP_Obstacles_k_rand);
+
+  // directions k_rand in TP_obstacles[k_rand] = d_free
+  // this is the collision free distance to the TP_target
+  const double d_free = TP_Obstacles_k_rand;
+
+  // [Algo `tp_space_rrt`: Line 10]: d_new
+  // ------------------------------------------------------------
+  const double d_new = std::min(D_max,
+                                d_rand);  // distance of the new candidate state in TP-space
+
+  // [Algo `tp_space_rrt`: Line 13]: Do we have free space?
+  // ------------------------------------------------------------
+  if (d_free < d_new) return false;
+
+  // [Algo `tp_space_rrt`: Line 14]: PTG function
+  // ------------------------------------------------------------
+  // given d_rand and k_rand provides x,y,phi of the point in c-space
+  uint32_t nStep;
+  m_PTGs[idxPTG]->getPathStepForDist(k_rand, d_new, nStep);
+
+  mrpt::math::TPose2D rel_pose = m_PTGs[idxPTG]->getPathPose(k_rand, nStep);
+
+  // wrap to [-pi,pi] to avoid out of bounds errors:
+  mrpt::math::wrapToPiInPlace(rel_pose.phi);
+
+  // [Algo `tp_space_rrt`: Line 15]: pose composition
+  // ------------------------------------------------------------
+  const mrpt::poses::CPose2D new_state_rel(rel_pose);
+  const mrpt::poses::CPose2D new_state = x_nearest_pose + new_state_rel;  // compose the
+  // new_motion as the last nmotion and the new state
+
+  // Check whether there's already a too-close node around:
+  // --------------------------------------------------------
+  // Is this a potential solution
+  const double goal_dist = new_state.distance2DTo(pi.goal_pose.x, pi.goal_pose.y);
+  const double goal_ang = std::abs(mrpt::math::angDistance(new_state.phi(), pi.goal_pose.phi));
+  const bool is_acceptable_goal = (goal_dist < end_criteria.acceptedDistToTarget) &&
+                                  (goal_ang < end_criteria.acceptedAngToTarget);
+
+  if (!is_acceptable_goal)  // Only check for nearby nodes if this
+  // is not a solution!
+  {
+    const PoseDistanceMetric<TNodeSE2>
+        distance_evaluator_se2;  // Plain distances in SE(2), not along PTGs
+    double new_nearest_dist;
+    const TNodeSE2 new_state_node(new_state.asTPose());
+
+    const auto new_nearest_id = result.move_tree.getNearestNode(
+        new_state_node, distance_evaluator_se2, &new_nearest_dist,
+        &result.acceptable_goal_node_ids);
+
+    if (new_nearest_id != mrpt::graphs::INVALID_NODEID)
+    {
+      // Also check angular distance:
+      const double new_nearest_ang = std::abs(mrpt::math::angDistance(
+          new_state.phi(), result.move_tree.getAllNodes().find(new_nearest_id)->second.state.phi));
+      const bool accept_this_node =
+          (new_nearest_dist >= params.minDistanceBetweenNewNodes ||
+           new_nearest_ang >= params.minAngBetweenNewNodes);
+      if (!accept_this_node) return false;  // Too close node, skip!
+    }
+  }
+
+  // [Algo `tp_space_rrt`: Line 16]: Add to candidate solution set
+  // ------------------------------------------------------------
+  // Create "movement" (tree edge) object:
+  outEdge = TMoveEdgeSE2_TP(x_nearest_id, new_state.asTPose());
+  outEdge.cost = d_new;
+  outEdge.ptg_index = idxPTG;
+  outEdge.ptg_K = k_rand;
+  outEdge.ptg_dist = d_new;
+
+  return true;
+}
+
 /** The main API entry point: tries to find a planned path from 'goal' to
  * 'target' */
 void PlannerRRT_SE2_TPS::solve(
@@ -61,6 +203,25 @@ void PlannerRRT_SE2_TPS::solve(
     result.move_tree.insertNode(result.move_tree.root, TNodeSE2_TP(pi.start_pose));
   }
 
+  // Batched-parallel extension? (K>1) Make sure the worker pool and its
+  // per-task obstacle buffers are large enough:
+  const size_t nPTGs = m_PTGs.size();
+  const size_t K = std::max<size_t>(1, params.samplesPerIteration);
+  const size_t nTasks = K * nPTGs;
+  const bool run_parallel = (K > 1);
+  if (run_parallel)
+  {
+    const size_t desired_threads =
+        std::min<size_t>(std::max<size_t>(1, std::thread::hardware_concurrency()), nTasks);
+    if (desired_threads > m_extension_pool_threads)
+    {
+      // resize() *adds* that many worker threads:
+      m_extension_pool.resize(desired_threads - m_extension_pool_threads);
+      m_extension_pool_threads = desired_threads;
+    }
+    if (m_local_obs_per_task.size() < nTasks) m_local_obs_per_task.resize(nTasks);
+  }
+
   mrpt::system::CTicTac working_time;
   working_time.Tic();
   size_t rrt_iter_counter = 0;
@@ -89,261 +250,119 @@ void PlannerRRT_SE2_TPS::solve(
       break;
     }
 
-    // [Algo `tp_space_rrt`: Line 3]: sample random state (with goal
-    // biasing)
+    // [Algo `tp_space_rrt`: Line 3]: sample random states (with goal
+    // biasing). Done serially: the global RNG is not thread-safe.
     // -----------------------------------------
-    node_pose_t x_rand;
-    // bool rand_is_target=false;
-    if (mrpt::random::getRandomGenerator().drawUniform(0.0, 1.0) < params.goalBias)
-    {
-      x_rand = pi.goal_pose;
-      // rand_is_target=true;
-    }
-    else
+    std::vector<node_pose_t> x_rands(K);
+    for (auto& x_rand : x_rands)
     {
-      // Sample uniform:
-      for (int i = 0; i < node_pose_t::static_size; i++)
-        x_rand[i] = mrpt::random::getRandomGenerator().drawUniform(
-            pi.world_bbox_min[i], pi.world_bbox_max[i]);
+      if (mrpt::random::getRandomGenerator().drawUniform(0.0, 1.0) < params.goalBias)
+      {
+        x_rand = pi.goal_pose;
+      }
+      else
+      {
+        // Sample uniform:
+        for (int i = 0; i < node_pose_t::static_size; i++)
+          x_rand[i] = mrpt::random::getRandomGenerator().drawUniform(
+              pi.world_bbox_min[i], pi.world_bbox_max[i]);
+      }
     }
-    const CPose2D x_rand_pose(x_rand);
+    const CPose2D x_rand_pose(x_rands[0]);  // For the graphical logs below
 
-    // [Algo `tp_space_rrt`: Line 4]: Init empty solution set
+    // [Algo `tp_space_rrt`: Lines 4-16]: Evaluate all K x nPTGs candidate
+    // extensions. The tree and the obstacle cloud are strictly read-only
+    // during this stage, so with K>1 the (expensive) TP-space collision
+    // checks run concurrently in the worker pool.
     // -----------------------------------------
-    using sorted_solution_list_t = std::map<double, TMoveEdgeSE2_TP>;
-    sorted_solution_list_t candidate_new_nodes;  // Map: cost -> info. Pick
-    // begin() to select the
-    // lowest-cose one.
-
-    const PoseDistanceMetric<TNodeSE2>
-        distance_evaluator_se2;         // Plain distances in SE(2), not along PTGs
-    bool is_new_best_solution = false;  // Just for logging purposes
-
-    //#define DO_LOG_TXTS
-    std::string sLogTxt;
-
-    // [Algo `tp_space_rrt`: Line 5]: For each PTG
-    // -----------------------------------------
-    const size_t nPTGs = m_PTGs.size();
-    for (size_t idxPTG = 0; idxPTG < nPTGs; ++idxPTG)
+    struct TCandidate
     {
-      rrt_iter_counter++;
-
-      // [Algo `tp_space_rrt`: Line 5]: Search nearest neig. to x_rand
-      // -----------------------------------------------
-      const PoseDistanceMetric<TNodeSE2_TP> distance_evaluator(*m_PTGs[idxPTG]);
-
-      const TNodeSE2_TP query_node(x_rand);
+      bool valid = false;
+      TMoveEdgeSE2_TP edge;
+    };
+    std::vector<TCandidate> candidates(nTasks);
 
-      m_timelogger.enter("TMoveTree::getNearestNode");
-      mrpt::graphs::TNodeID x_nearest_id =
-          result.move_tree.getNearestNode(query_node, distance_evaluator);
-      m_timelogger.leave("TMoveTree::getNearestNode");
+    rrt_iter_counter += nTasks;
 
-      if (x_nearest_id == mrpt::graphs::INVALID_NODEID)
+    if (!run_parallel)
+    {
+      for (size_t idxPTG = 0; idxPTG < nPTGs; ++idxPTG)
+        candidates[idxPTG].valid = evaluateCandidateExtension(
+            pi, result, x_rands[0], idxPTG, max_veh_radius, m_local_obs, candidates[idxPTG].edge);
+    }
+    else
+    {
+      std::vector<std::future<void>> futs;
+      futs.reserve(nTasks);
+      for (size_t iSample = 0; iSample < K; iSample++)
       {
-        // We can't find any close node, at least with this PTG's paths:
-        // skip
-
-        // Before that, save log:
-        if (params.save_3d_log_freq > 0 &&
-            (++SAVE_3D_TREE_LOG_DECIMATION_CNT >= params.save_3d_log_freq))
+        for (size_t idxPTG = 0; idxPTG < nPTGs; ++idxPTG)
         {
-          SAVE_3D_TREE_LOG_DECIMATION_CNT = 0;  // Reset decimation counter
-          TRenderPlannedPathOptions render_options;
-          render_options.highlight_path_to_node_id = result.best_goal_node_id;
-          render_options.highlight_last_added_edge = false;
-          render_options.x_rand_pose = &x_rand_pose;
-          render_options.log_msg = "SKIP: Can't find any close node";
-          render_options.log_msg_position =
-              mrpt::math::TPoint3D(pi.world_bbox_min.x, pi.world_bbox_min.y, 0);
-          render_options.ground_xy_grid_frequency = 1.0;
-
-          mrpt::opengl::Scene scene;
-          renderMoveTree(scene, pi, result, render_options);
-          mrpt::system::createDirectory("./rrt_log_trees");
-          scene.saveToFile(mrpt::format(
-              "./rrt_log_trees/rrt_log_%03u_%06u.3Dscene",
-              static_cast<unsigned int>(SAVE_LOG_SOLVE_COUNT),
-              static_cast<unsigned int>(rrt_iter_counter)));
+          const size_t taskIdx = iSample * nPTGs + idxPTG;
+          futs.emplace_back(m_extension_pool.enqueue(
+              [this, &pi, &result, &x_rands, &candidates, iSample, idxPTG, taskIdx,
+               max_veh_radius]()
+              {
+                candidates[taskIdx].valid = evaluateCandidateExtension(
+                    pi, result, x_rands[iSample], idxPTG, max_veh_radius,
+                    m_local_obs_per_task[taskIdx], candidates[taskIdx].edge);
+              }));
         }
-
-        continue;  // Skip
       }
+      for (auto& f : futs) f.get();  // Also rethrows any exception
+    }
 
-      const TNodeSE2_TP& x_nearest_node = result.move_tree.getAllNodes().find(x_nearest_id)->second;
-
-      // [Algo `tp_space_rrt`: Line 6]: Relative target
-      // -----------------------------------------------
-      const CPose2D x_nearest_pose(x_nearest_node.state);
-      const CPose2D x_rand_rel = x_rand_pose - x_nearest_pose;
-
-      // [Algo `tp_space_rrt`: Line 7]: Relative target in TP-Space
-      // ------------------------------------------------------------
-      const double D_max = std::min(params.maxLength, m_PTGs[idxPTG]->getRefDistance());
-
-      double d_rand;  // Coordinates in TP-space
-      int k_rand;     // k_rand is the index of target_alpha in PTGs
-      // corresponding to a specific d_rand
-      // bool tp_point_is_exact =
-      m_PTGs[idxPTG]->inverseMap_WS2TP(x_rand_rel.x(), x_rand_rel.y(), k_rand, d_rand);
-      d_rand *= m_PTGs[idxPTG]->getRefDistance();  // distance to target, in "real meters"
-
-      float d_free;
-      // bool local_obs_ok = false; // Just for 3D log files: indicates
-      // whether obstacle points have been recomputed
-
-      // [Algo `tp_space_rrt`: Line 8]: TP-Obstacles
-      // ------------------------------------------------------------
-      // Transform obstacles as seen from x_nearest_node -> TP_obstacles
-      double TP_Obstacles_k_rand = .0;  // vector<double> TP_Obstacles;
-      const double MAX_DIST_FOR_OBSTACLES =
-          1.5 * m_PTGs[idxPTG]->getRefDistance();  // Maximum Euclidean
-      // distance (radius)
-      // for considering
-      // obstacles around the
-      // current robot pose
-
-      ASSERT_GT_(
-          m_PTGs[idxPTG]->getRefDistance(),
-          1.1 * max_veh_radius);  // Make sure the PTG covers at least a
-      // bit more than the vehicle shape!!
-      // (should be much, much higher)
+    // [Algo `tp_space_rrt`: Line 19]: Insert the best extension of each
+    // sample into the tree. This is the only stage that mutates shared
+    // state; it runs serially after all concurrent checks are done.
+    // ------------------------------------------------------------
+    bool is_new_best_solution = false;  // Just for logging purposes
+    const PoseDistanceMetric<TNodeSE2>
+        distance_evaluator_se2;  // Plain distances in SE(2), not along PTGs
 
+    for (size_t iSample = 0; iSample < K; iSample++)
+    {
+      // Lowest-cost valid candidate for this sample, if any:
+      const TCandidate* best = nullptr;
+      for (size_t idxPTG = 0; idxPTG < nPTGs; ++idxPTG)
       {
-        CTimeLoggerEntry tle(m_timelogger, "PT_RRT::solve.changeCoordinatesReference");
-        transformPointcloudWithSquareClipping(
-            pi.obstacles_points, m_local_obs, CPose2D(x_nearest_node.state),
-            MAX_DIST_FOR_OBSTACLES);
-        // local_obs_ok=true;
-      }
-      {
-        CTimeLoggerEntry tle(m_timelogger, "PT_RRT::solve.SpaceTransformer");
-        spaceTransformerOneDirectionOnly(
-            k_rand, m_local_obs, m_PTGs[idxPTG].get(), MAX_DIST_FOR_OBSTACLES, TP_Obstacles_k_rand);
+        const TCandidate& c = candidates[iSample * nPTGs + idxPTG];
+        if (c.valid && (!best || c.edge.cost < best->edge.cost)) best = &c;
       }
+      if (!best) continue;
 
-      // directions k_rand in TP_obstacles[k_rand] = d_free
-      // this is the collision free distance to the TP_target
-      d_free = TP_Obstacles_k_rand;  // TP_Obstacles[k_rand];
-
-      // [Algo `tp_space_rrt`: Line 10]: d_new
-      // ------------------------------------------------------------
-      double d_new = std::min(D_max,
-                              d_rand);  // distance of the new candidate state in TP-space
+      const TMoveEdgeSE2_TP& best_edge = best->edge;
 
-      // mrpt::poses::CPose2D *log_new_state_ptr=NULL; // For graphical
-      // logs only
+      // Distance to goal:
+      const double goal_dist =
+          mrpt::poses::CPose2D(best_edge.end_state).distance2DTo(pi.goal_pose.x, pi.goal_pose.y);
+      const double goal_ang =
+          std::abs(mrpt::math::angDistance(best_edge.end_state.phi, pi.goal_pose.phi));
 
-#ifdef DO_LOG_TXTS
-      sLogTxt += mrpt::format(
-          "tp_idx=%u tp_exact=%c\n d_free: %f d_rand=%f d_new=%f\n",
-          static_cast<unsigned int>(idxPTG), tp_point_is_exact ? 'Y' : 'N', d_free, d_rand, d_new);
-      sLogTxt += mrpt::format(" nearest:%s\n", x_nearest_pose.asString().c_str());
-#endif
+      const bool is_acceptable_goal = (goal_dist < end_criteria.acceptedDistToTarget) &&
+                                      (goal_ang < end_criteria.acceptedAngToTarget);
 
-      // [Algo `tp_space_rrt`: Line 13]: Do we have free space?
-      // ------------------------------------------------------------
-      if (d_free >= d_new)
+      // Candidates were checked for closeness against the tree as it was at
+      // the start of this batch, so re-check against the nodes inserted by
+      // the previous samples to keep the tree sparsity invariant:
+      if (!is_acceptable_goal && iSample > 0)
       {
-        // [Algo `tp_space_rrt`: Line 14]: PTG function
-        // ------------------------------------------------------------
-        // given d_rand and k_rand provides x,y,phi of the point in
-        // c-space
-        uint32_t nStep;
-        m_PTGs[idxPTG]->getPathStepForDist(k_rand, d_new, nStep);
-
-        mrpt::math::TPose2D rel_pose = m_PTGs[idxPTG]->getPathPose(k_rand, nStep);
-
-        // wrap to [-pi,pi] to avoid out of bounds errors:
-        mrpt::math::wrapToPiInPlace(rel_pose.phi);
-
-        // [Algo `tp_space_rrt`: Line 15]: pose composition
-        // ------------------------------------------------------------
-        const mrpt::poses::CPose2D new_state_rel(rel_pose);
-        mrpt::poses::CPose2D new_state = x_nearest_pose + new_state_rel;  // compose the new_motion
-        // as the last nmotion and
-        // the new state
-        // log_new_state_ptr = &new_state;
-
-        // Check whether there's already a too-close node around:
-        // --------------------------------------------------------
-        bool accept_this_node = true;
-
-        // Is this a potential solution
-        const double goal_dist = new_state.distance2DTo(pi.goal_pose.x, pi.goal_pose.y);
-        const double goal_ang =
-            std::abs(mrpt::math::angDistance(new_state.phi(), pi.goal_pose.phi));
-        const bool is_acceptable_goal = (goal_dist < end_criteria.acceptedDistToTarget) &&
-                                        (goal_ang < end_criteria.acceptedAngToTarget);
-
-        auto new_nearest_id = mrpt::graphs::INVALID_NODEID;
-        if (!is_acceptable_goal)  // Only check for nearby nodes if this
-        // is not a solution!
-        {
-          double new_nearest_dist;
-          const TNodeSE2 new_state_node(new_state.asTPose());
-
-          m_timelogger.enter("TMoveTree::getNearestNode");
-          new_nearest_id = result.move_tree.getNearestNode(
-              new_state_node, distance_evaluator_se2, &new_nearest_dist,
-              &result.acceptable_goal_node_ids);
-          m_timelogger.leave("TMoveTree::getNearestNode");
-
-          if (new_nearest_id != mrpt::graphs::INVALID_NODEID)
-          {
-            // Also check angular distance:
-            const double new_nearest_ang = std::abs(mrpt::math::angDistance(
-                new_state.phi(),
-                result.move_tree.getAllNodes().find(new_nearest_id)->second.state.phi));
-            accept_this_node =
-                (new_nearest_dist >= params.minDistanceBetweenNewNodes ||
-                 new_nearest_ang >= params.minAngBetweenNewNodes);
-          }
-        }
-
-        if (!accept_this_node)
+        double new_nearest_dist;
+        const TNodeSE2 new_state_node(best_edge.end_state);
+        const auto new_nearest_id = result.move_tree.getNearestNode(
+            new_state_node, distance_evaluator_se2, &new_nearest_dist,
+            &result.acceptable_goal_node_ids);
+        if (new_nearest_id != mrpt::graphs::INVALID_NODEID)
         {
-#ifdef DO_LOG_TXTS
-          if (new_nearest_id != mrpt::graphs::INVALID_NODEID)
-          {
-            sLogTxt += mrpt::format(
-                " -> new node NOT accepted for closeness to: %s\n", result.move_tree.getAllNodes()
-                                                                        .find(new_nearest_id)
-                                                                        ->second.state.asString()
-                                                                        .c_str());
-          }
-#endif
-          continue;  // Too close node, skip!
+          const double new_nearest_ang = std::abs(mrpt::math::angDistance(
+              best_edge.end_state.phi,
+              result.move_tree.getAllNodes().find(new_nearest_id)->second.state.phi));
+          if (new_nearest_dist < params.minDistanceBetweenNewNodes &&
+              new_nearest_ang < params.minAngBetweenNewNodes)
+            continue;  // Too close node, skip!
         }
-
-        // [Algo `tp_space_rrt`: Line 16]: Add to candidate solution set
-        // ------------------------------------------------------------
-        // Create "movement" (tree edge) object:
-        TMoveEdgeSE2_TP new_edge(x_nearest_id, new_state.asTPose());
-
-        new_edge.cost = d_new;
-        new_edge.ptg_index = idxPTG;
-        new_edge.ptg_K = k_rand;
-        new_edge.ptg_dist = d_new;
-
-        candidate_new_nodes[new_edge.cost] = new_edge;
-
-      }  // end if the path is obstacle free
-      else
-      {
-#ifdef DO_LOG_TXTS
-        sLogTxt += mrpt::format(" -> d_free NOT < d_rand\n");
-#endif
       }
 
-    }  // end for idxPTG
-
-    // [Algo `tp_space_rrt`: Line 19]: Any solution found?
-    // ------------------------------------------------------------
-    if (!candidate_new_nodes.empty())
-    {
-      const TMoveEdgeSE2_TP& best_edge = candidate_new_nodes.begin()->second;
       const TNodeSE2_TP new_state_node(best_edge.end_state);
 
       // Insert into the tree:
@@ -351,15 +370,6 @@ void PlannerRRT_SE2_TPS::solve(
       result.move_tree.insertNodeAndEdge(
           best_edge.parent_id, new_child_id, new_state_node, best_edge);
 
-      // Distance to goal:
-      const double goal_dist =
-          mrpt::poses::CPose2D(best_edge.end_state).distance2DTo(pi.goal_pose.x, pi.goal_pose.y);
-      const double goal_ang =
-          std::abs(mrpt::math::angDistance(best_edge.end_state.phi, pi.goal_pose.phi));
-
-      const bool is_acceptable_goal = (goal_dist < end_criteria.acceptedDistToTarget) &&
-                                      (goal_ang < end_criteria.acceptedAngToTarget);
-
       if (is_acceptable_goal) result.acceptable_goal_node_ids.insert(new_child_id);
 
       // Total path length:
@@ -383,7 +393,7 @@ void PlannerRRT_SE2_TPS::solve(
         result.best_goal_node_id = new_child_id;
         is_new_best_solution = true;
       }
-    }  // end if any candidate found
+    }  // end for each sample
 
     //  Graphical logging, if enabled:
     // ------------------------------------------------------
@@ -397,14 +407,9 @@ void PlannerRRT_SE2_TPS::solve(
       TRenderPlannedPathOptions render_options;
       render_options.highlight_path_to_node_id = result.best_goal_node_id;
       render_options.x_rand_pose = &x_rand_pose;
-      // render_options.x_nearest_pose = &x_nearest_pose;
-      // if (local_obs_ok) render_options.local_obs_from_nearest_pose =
-      // &m_local_obs;
-      // render_options.new_state = log_new_state_ptr;
       render_options.highlight_last_added_edge = true;
       render_options.ground_xy_grid_frequency = 1.0;
 
-      render_options.log_msg = sLogTxt;
       render_options.log_msg_position =
           mrpt::math::TPoint3D(pi.world_bbox_min.x, pi.world_bbox_min.y, 0);
 
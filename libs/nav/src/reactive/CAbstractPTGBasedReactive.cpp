@@ -11,6 +11,7 @@
 //
 #include <mrpt/containers/copy_container_typecasting.h>
 #include <mrpt/containers/printf_vector.h>
+#include <mrpt/core/get_env.h>
 #include <mrpt/core/lock_helper.h>
 #include <mrpt/io/CFileGZOutputStream.h>
 #include <mrpt/io/CMemoryStream.h>
@@ -22,7 +23,10 @@
 #include <mrpt/serialization/CArchive.h>
 #include <mrpt/system/filesystem.h>
 
+#include <future>
 #include <limits>
+#include <optional>
+#include <thread>
 
 using namespace mrpt;
 using namespace mrpt::io;
@@ -62,6 +66,16 @@ CAbstractPTGBasedReactive::CAbstractPTGBasedReactive(
     m_navlogfiles_dir(sLogDir)
 {
   this->enableLogFile(enableLogFile);
+
+  // Runtime switch for always-on latency monitoring of the nav step:
+  static const bool NAV_LATENCY_MONITOR = mrpt::get_env<bool>("MRPT_NAV_LATENCY_MONITOR", false);
+  if (NAV_LATENCY_MONITOR)
+  {
+    static const double NAV_LATENCY_MONITOR_DUMP_PERIOD =
+        mrpt::get_env<double>("MRPT_NAV_LATENCY_MONITOR_DUMP_PERIOD", 10.0);
+    m_latencyMonitor.enable();
+    m_latencyMonitor.enablePeriodicDump(NAV_LATENCY_MONITOR_DUMP_PERIOD);
+  }
 }
 
 void CAbstractPTGBasedReactive::preDestructor()
@@ -218,6 +232,7 @@ void CAbstractPTGBasedReactive::performNavigationStep()
 {
   mrpt::system::CTimeLoggerEntry tle(
       m_navProfiler, "CAbstractPTGBasedReactive::performNavigationStep()");
+  mrpt::system::CLatencyMonitorEntry lme(m_latencyMonitor, "performNavigationStep");
 
   // Security tests:
   if (m_closing_navigator) return;  // Are we closing in the main thread?
@@ -483,13 +498,8 @@ void CAbstractPTGBasedReactive::performNavigationStep()
         nPTGs + 1);  // the last extra one is for the evaluation of "NOP
     // motion command" choice.
 
-    for (size_t indexPTG = 0; indexPTG < nPTGs; indexPTG++)
+    const auto eval_one_PTG = [&](const size_t indexPTG)
     {
-      mrpt::system::CTimeLoggerEntry tle2(
-          m_navProfiler,
-          "CAbstractPTGBasedReactive::performNavigationStep().eval_"
-          "regular_PTG");
-
       CParameterizedTrajectoryGenerator* ptg = getPTG(indexPTG);
       TInfoPerPTG& ipf = m_infoPerPTG[indexPTG];
 
@@ -507,6 +517,52 @@ void CAbstractPTGBasedReactive::performNavigationStep()
           ptg, indexPTG, relTargets, rel_pose_PTG_origin_wrt_sense, ipf, cm, newLogRec,
           false /* this is a regular PTG reactive case */, *holoMethod, tim_start_iteration,
           *m_navigationParams);
+    };
+
+    size_t nEvalThreads = params_abstract_ptg_navigator.ptg_eval_threads;
+    if (nEvalThreads == 0) nEvalThreads = std::thread::hardware_concurrency();
+    nEvalThreads = std::min(nEvalThreads, nPTGs);
+
+    if (nEvalThreads > 1)
+    {
+      // Evaluate all PTGs in parallel: each one writes only to its own
+      // slots (m_infoPerPTG[i], candidate_movs[i], newLogRec.infoPerPTG[i]);
+      // the shared additional_debug_msgs map is mutex-protected inside.
+      if (!m_ptgEvalPool)
+        m_ptgEvalPool = std::make_unique<mrpt::WorkerThreadsPool>(
+            nEvalThreads, mrpt::WorkerThreadsPool::POLICY_FIFO, "ptg_eval");
+
+      m_insideParallelPTGEval = true;
+      std::vector<std::future<void>> futs;
+      futs.reserve(nPTGs);
+      for (size_t indexPTG = 0; indexPTG < nPTGs; indexPTG++)
+        futs.emplace_back(m_ptgEvalPool->enqueue(eval_one_PTG, indexPTG));
+
+      std::exception_ptr eptr;
+      for (auto& f : futs)
+      {
+        try
+        {
+          f.get();
+        }
+        catch (...)
+        {
+          if (!eptr) eptr = std::current_exception();
+        }
+      }
+      m_insideParallelPTGEval = false;
+      if (eptr) std::rethrow_exception(eptr);
+    }
+    else
+    {
+      for (size_t indexPTG = 0; indexPTG < nPTGs; indexPTG++)
+      {
+        mrpt::system::CTimeLoggerEntry tle2(
+            m_navProfiler,
+            "CAbstractPTGBasedReactive::performNavigationStep().eval_"
+            "regular_PTG");
+        eval_one_PTG(indexPTG);
+      }
     }  // end for each PTG
 
     // check for collision, which is reflected by ALL TP-Obstacles being
@@ -944,8 +1000,9 @@ void CAbstractPTGBasedReactive::calc_move_candidate_scores(
     const mrpt::nav::CHolonomicLogFileRecord::Ptr& hlfr)
 {
   MRPT_START
-  mrpt::system::CTimeLoggerEntry tle(
-      m_navProfiler, "CAbstractPTGBasedReactive::calc_move_candidate_scores()");
+  std::optional<mrpt::system::CTimeLoggerEntry> tle;
+  if (!m_insideParallelPTGEval)
+    tle.emplace(m_navProfiler, "CAbstractPTGBasedReactive::calc_move_candidate_scores()");
 
   const double ref_dist = cm.PTG->getRefDistance();
 
@@ -1010,6 +1067,7 @@ void CAbstractPTGBasedReactive::calc_move_candidate_scores(
         std::min(1.0, Vf + target_WS_d * (1.0 - Vf) / TARGET_SLOW_APPROACHING_DISTANCE);
     if (f < cm.speed)
     {
+      std::lock_guard<std::mutex> lck(m_logRecMutex);
       newLogRec.additional_debug_msgs["PTG_eval.speed"] = mrpt::format(
           "Relative speed reduced %.03f->%.03f based on Euclidean "
           "nearness to target.",
@@ -1419,8 +1477,14 @@ void CAbstractPTGBasedReactive::build_movement_candidate(
     const TNavigationParams& navp,
     const mrpt::math::TPose2D& rel_cur_pose_wrt_last_vel_cmd_NOP)
 {
-  mrpt::system::CTimeLoggerEntry tle(
-      m_navProfiler, "CAbstractPTGBasedReactive::build_movement_candidate()");
+  // Profiler section skipped while running inside the parallel PTG
+  // evaluation pool (sections would overlap between threads):
+  std::optional<mrpt::system::CTimeLoggerEntry> tle;
+  if (!m_insideParallelPTGEval)
+    tle.emplace(m_navProfiler, "CAbstractPTGBasedReactive::build_movement_candidate()");
+
+  // Local, since this method may run concurrently for several PTGs:
+  mrpt::system::CTicTac tictac;
 
   ASSERT_(ptg);
 
@@ -1469,6 +1533,7 @@ void CAbstractPTGBasedReactive::build_movement_candidate(
 
   if (!any_TPTarget_is_valid)
   {
+    std::lock_guard<std::mutex> lck(m_logRecMutex);
     newLogRec.additional_debug_msgs[mrpt::format(
         "mov_candidate_%u", static_cast<unsigned int>(indexPTG))] =
         "PTG discarded since target(s) is(are) out of domain.";
@@ -1504,7 +1569,7 @@ void CAbstractPTGBasedReactive::build_movement_candidate(
       for (size_t i = 0; i < Ki; i++) ipf.TP_Obstacles[i] *= _refD;
 
       timeForTPObsTransformation = tictac.Tac();
-      if (m_timelogger.isEnabled())
+      if (!m_insideParallelPTGEval && m_timelogger.isEnabled())
         m_timelogger.registerUserMeasure(
             "navigationStep.STEP3_WSpaceToTPSpace", timeForTPObsTransformation);
     }
@@ -1572,7 +1637,7 @@ void CAbstractPTGBasedReactive::build_movement_candidate(
       cm.speed *= velScale;
 
       timeForHolonomicMethod = tictac.Tac();
-      if (m_timelogger.isEnabled())
+      if (!m_insideParallelPTGEval && m_timelogger.isEnabled())
         m_timelogger.registerUserMeasure(
             "navigationStep.STEP4_HolonomicMethod", timeForHolonomicMethod);
     }
@@ -1587,7 +1652,9 @@ void CAbstractPTGBasedReactive::build_movement_candidate(
     // STEP5: Evaluate each movement to assign them a "evaluation" value.
     // ---------------------------------------------------------------------
     {
-      CTimeLoggerEntry tle2(m_timelogger, "navigationStep.calc_move_candidate_scores");
+      std::optional<CTimeLoggerEntry> tle2;
+      if (!m_insideParallelPTGEval)
+        tle2.emplace(m_timelogger, "navigationStep.calc_move_candidate_scores");
 
       calc_move_candidate_scores(
           cm, ipf.TP_Obstacles, ipf.clearance, relTargets, ipf.targets,
@@ -1656,6 +1723,7 @@ void CAbstractPTGBasedReactive::TAbstractPTGNavigatorParams::loadFromConfigFile(
   MRPT_LOAD_CONFIG_VAR_CS(enable_obstacle_filtering, bool);
   MRPT_LOAD_CONFIG_VAR_CS(evaluate_clearance, bool);
   MRPT_LOAD_CONFIG_VAR_CS(max_dist_for_timebased_path_prediction, double);
+  MRPT_LOAD_CONFIG_VAR_CS(ptg_eval_threads, uint64_t);
 
   MRPT_END
 }
@@ -1726,6 +1794,10 @@ void CAbstractPTGBasedReactive::TAbstractPTGNavigatorParams::saveToConfigFile(
       max_dist_for_timebased_path_prediction,
       "Max dist [meters] to use time-based path prediction for NOP "
       "evaluation");
+  MRPT_SAVE_CONFIG_VAR_COMMENT(
+      ptg_eval_threads,
+      "Worker threads to evaluate the PTGs in parallel within each "
+      "navigation cycle (1=sequential [default], 0=one per CPU core)");
 }
 
 CAbstractPTGBasedReactive::TAbstractPTGNavigatorParams::TAbstractPTGNavigatorParams() :
@@ -13,6 +13,9 @@
 #include <mrpt/nav/reactive/CReactiveNavigationSystem.h>
 #include <mrpt/system/filesystem.h>
 
+#include <cmath>
+#include <optional>
+
 using namespace mrpt;
 using namespace mrpt::poses;
 using namespace mrpt::system;
@@ -173,17 +176,30 @@ bool CReactiveNavigationSystem::implementSenseObstacles(
     {
       CTimeLoggerEntry tle1(m_timelogger, "navigationStep.STEP2_Sense");
       CTimeLoggerEntry tle2(m_timlog_delays, "senseObstacles()");
-      ret = m_robot.senseObstacles(m_WS_Obstacles, obstacles_timestamp);
+      ret = m_robot.senseObstacles(m_WS_Obstacles_sensed, obstacles_timestamp);
+    }
+
+    // If the sensor did not produce a new scan since the last cycle, keep
+    // the cached (already filtered) obstacle set: the cloud is expressed in
+    // the robot frame at `obstacles_timestamp`, and all downstream steps
+    // already compensate the robot motion since then through the relative
+    // pose `rel_pose_PTG_origin_wrt_sense`, so there is nothing to redo.
+    if (ret && obstacles_timestamp != INVALID_TIMESTAMP &&
+        obstacles_timestamp == m_WS_Obstacles_cache_timestamp)
+    {
+      return true;
     }
 
     // Optional filtering of obstacles:
-    m_WS_Obstacles_original = m_WS_Obstacles;
+    m_WS_Obstacles_original = m_WS_Obstacles_sensed;
+    m_WS_Obstacles = m_WS_Obstacles_sensed;
     if (ret && m_WS_filter)
     {
       m_WS_filter->filter(
           &m_WS_Obstacles, obstacles_timestamp,
           mrpt::poses::CPose3D(mrpt::math::TPose3D(m_curPoseVel.pose)));
     }
+    if (ret) m_WS_Obstacles_cache_timestamp = obstacles_timestamp;
 
     return ret;
     // Note: Clip obstacles by "z" axis coordinates is more efficiently done
@@ -209,31 +225,53 @@ void CReactiveNavigationSystem::STEP3_WSpaceToTPSpace(
     const mrpt::math::TPose2D& rel_pose_PTG_origin_wrt_sense_,
     const bool eval_clearance)
 {
-  mrpt::system::CTimeLoggerEntry tle(
-      m_navProfiler, "CReactiveNavigationSystem::STEP3_WSpaceToTPSpace()");
+  // Profiler section skipped in parallel PTG evaluation (sections of the
+  // several worker threads would overlap):
+  std::optional<mrpt::system::CTimeLoggerEntry> tle;
+  if (!m_insideParallelPTGEval)
+    tle.emplace(m_navProfiler, "CReactiveNavigationSystem::STEP3_WSpaceToTPSpace()");
 
   ASSERT_LT_(ptg_idx, this->getPTG_count());
   CParameterizedTrajectoryGenerator* ptg = this->getPTG(ptg_idx);
 
-  const mrpt::poses::CPose2D rel_pose_PTG_origin_wrt_sense(rel_pose_PTG_origin_wrt_sense_);
-
   const float OBS_MAX_XY = params_abstract_ptg_navigator.ref_distance * 1.1f;
 
+  // Shared pre-pass, done once per navigation cycle and reused by all PTGs:
+  // transform & cull the obstacle points and bin them into coarse range
+  // rings. All regular PTGs within a cycle are given the same relative pose,
+  // so once built the cache is only read (possibly concurrently, see
+  // `ptg_eval_threads`); the NOP-motion candidate arrives with a different
+  // pose but only after the parallel evaluation has joined.
+  {
+    std::lock_guard<std::mutex> lck(m_ws_obs_bins_mtx);
+    if (m_ws_obs_bins.timestamp != m_WS_Obstacles_timestamp ||
+        !(m_ws_obs_bins.rel_pose == rel_pose_PTG_origin_wrt_sense_))
+    {
+      rebuildObstacleBins(rel_pose_PTG_origin_wrt_sense_, OBS_MAX_XY);
+    }
+  }
+
+  // Points farther than refDistance + robot radius cannot bring any
+  // TP-obstacle below its initial value of refDistance (the transversed
+  // distance to a collision is at least the straight-line distance minus the
+  // robot radius), and clearance is normalized by refDistance and saturated
+  // at 1.0, so points beyond 2*refDistance + robot radius cannot lower it
+  // either. Visit only the rings that may contain effective points:
+  const double R = ptg->getMaxRobotRadius();
+  const double cull_radius =
+      eval_clearance ? 2 * ptg->getRefDistance() + R : ptg->getRefDistance() + R;
+
   // Merge all the (k,d) for which the robot collides with each obstacle
   // point:
-  size_t nObs;
-  const float *xs, *ys, *zs;
-  m_WS_Obstacles.getPointsBuffer(nObs, xs, ys, zs);
-
-  for (size_t obs = 0; obs < nObs; obs++)
+  const auto& bins = m_ws_obs_bins;
+  size_t obs = 0;
+  for (size_t ring = 0;
+       ring < TTransformedObstacleBins::NUM_RINGS && ring * bins.ring_width <= cull_radius;
+       obs = bins.ring_end[ring++])
   {
-    double ox, oy, oz = zs[obs];
-    rel_pose_PTG_origin_wrt_sense.composePoint(xs[obs], ys[obs], ox, oy);
-
-    if (ox > -OBS_MAX_XY && ox < OBS_MAX_XY && oy > -OBS_MAX_XY && oy < OBS_MAX_XY &&
-        oz >= params_reactive_nav.min_obstacles_height &&
-        oz <= params_reactive_nav.max_obstacles_height)
+    for (; obs < bins.ring_end[ring]; obs++)
     {
+      const double ox = bins.xs[obs], oy = bins.ys[obs];
       ptg->updateTPObstacle(ox, oy, out_TPObstacles);
       if (eval_clearance)
       {
@@ -243,6 +281,77 @@ void CReactiveNavigationSystem::STEP3_WSpaceToTPSpace(
   }
 }
 
+/** \callergraph */
+void CReactiveNavigationSystem::rebuildObstacleBins(
+    const mrpt::math::TPose2D& rel_pose, const float obs_max_xy)
+{
+  auto& b = m_ws_obs_bins;
+  b.timestamp = m_WS_Obstacles_timestamp;
+  b.rel_pose = rel_pose;
+  // Rings must cover up to the box corners:
+  b.ring_width = obs_max_xy * std::sqrt(2.0) / TTransformedObstacleBins::NUM_RINGS;
+
+  size_t nObs;
+  const float *xs, *ys, *zs;
+  m_WS_Obstacles.getPointsBuffer(nObs, xs, ys, zs);
+
+  // Transform all points at once: a tight loop over contiguous floats that
+  // the compiler can vectorize, instead of one CPose2D::composePoint() per
+  // point and per PTG:
+  const auto tx = static_cast<float>(rel_pose.x), ty = static_cast<float>(rel_pose.y);
+  const auto ccos = static_cast<float>(std::cos(rel_pose.phi)),
+             ssin = static_cast<float>(std::sin(rel_pose.phi));
+
+  const float zMin = params_reactive_nav.min_obstacles_height,
+              zMax = params_reactive_nav.max_obstacles_height;
+
+  constexpr uint8_t RING_CULLED = 0xff;
+  static_assert(TTransformedObstacleBins::NUM_RINGS < RING_CULLED);
+
+  // 1st pass: ring index (or culled) per point, and per-ring counts:
+  std::vector<float> ox(nObs), oy(nObs);
+  std::vector<uint8_t> ring_of(nObs);
+  std::array<size_t, TTransformedObstacleBins::NUM_RINGS> count{};
+  for (size_t i = 0; i < nObs; i++)
+  {
+    ox[i] = tx + ccos * xs[i] - ssin * ys[i];
+    oy[i] = ty + ssin * xs[i] + ccos * ys[i];
+
+    if (ox[i] > -obs_max_xy && ox[i] < obs_max_xy && oy[i] > -obs_max_xy && oy[i] < obs_max_xy &&
+        zs[i] >= zMin && zs[i] <= zMax)
+    {
+      const auto r = std::min<size_t>(
+          TTransformedObstacleBins::NUM_RINGS - 1,
+          static_cast<size_t>(std::hypot(ox[i], oy[i]) / b.ring_width));
+      ring_of[i] = static_cast<uint8_t>(r);
+      count[r]++;
+    }
+    else
+    {
+      ring_of[i] = RING_CULLED;
+    }
+  }
+
+  // 2nd pass: counting sort of the surviving points into ring-major order:
+  std::array<size_t, TTransformedObstacleBins::NUM_RINGS> write_idx;
+  size_t acc = 0;
+  for (size_t r = 0; r < TTransformedObstacleBins::NUM_RINGS; r++)
+  {
+    write_idx[r] = acc;
+    acc += count[r];
+    b.ring_end[r] = acc;
+  }
+  b.xs.resize(acc);
+  b.ys.resize(acc);
+  for (size_t i = 0; i < nObs; i++)
+  {
+    if (ring_of[i] == RING_CULLED) continue;
+    const size_t j = write_idx[ring_of[i]]++;
+    b.xs[j] = ox[i];
+    b.ys[j] = oy[i];
+  }
+}
+
 /** Generates a pointcloud of obstacles, and the robot shape, to be saved in the
  * logging record for the current timestep
  * \callergraph */
@@ -26,7 +26,8 @@ void run_rnav_test_impl(
     const TPoint2D& world_topleft,
     const TPoint2D& world_rightbottom,
     const TPoint2D& block_obstacle_topleft = TPoint2D(0, 0),
-    const TPoint2D& block_obstacle_rightbottom = TPoint2D(0, 0))
+    const TPoint2D& block_obstacle_rightbottom = TPoint2D(0, 0),
+    const unsigned int ptg_eval_threads = 1)
 {
   using namespace std;
   using namespace mrpt;
@@ -43,6 +44,7 @@ void run_rnav_test_impl(
 
   mrpt::config::CConfigFile cfg(sFil);
   cfg.write("CAbstractPTGBasedReactive", "holonomic_method", sHoloMethod);
+  cfg.write("CAbstractPTGBasedReactive", "ptg_eval_threads", ptg_eval_threads);
   cfg.discardSavingChanges();
 
   // Create a grid map with a synthetic test environment with a simple
@@ -191,13 +193,14 @@ void run_rnav_test(
     const TPoint2D& world_topleft,
     const TPoint2D& world_rightbottom,
     const TPoint2D& block_obstacle_topleft = TPoint2D(0, 0),
-    const TPoint2D& block_obstacle_rightbottom = TPoint2D(0, 0))
+    const TPoint2D& block_obstacle_rightbottom = TPoint2D(0, 0),
+    const unsigned int ptg_eval_threads = 1)
 {
   try
   {
     run_rnav_test_impl<RNAVCLASS>(
         sFilename, sHoloMethod, nav_target, world_topleft, world_rightbottom,
-        block_obstacle_topleft, block_obstacle_rightbottom);
+        block_obstacle_topleft, block_obstacle_rightbottom, ptg_eval_threads);
   }
   catch (const std::exception& e)
   {
@@ -261,6 +264,12 @@ TEST(CReactiveNavigationSystem, with_obstacle_nav_FullEval)
       "reactive2d_config.ini", "CHolonomicFullEval", with_obs_trg, with_obs_topleft,
       with_obs_bottomright, obs_tl, obs_br);
 }
+TEST(CReactiveNavigationSystem, with_obstacle_nav_FullEval_multithread)
+{
+  run_rnav_test<mrpt::nav::CReactiveNavigationSystem>(
+      "reactive2d_config.ini", "CHolonomicFullEval", with_obs_trg, with_obs_topleft,
+      with_obs_bottomright, obs_tl, obs_br, 4 /*ptg_eval_threads*/);
+}
 
 TEST(CReactiveNavigationSystem3D, with_obstacle_nav_VFF)
 {
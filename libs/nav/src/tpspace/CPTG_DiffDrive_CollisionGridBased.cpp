@@ -13,13 +13,16 @@
 #include <mrpt/core/get_env.h>
 #include <mrpt/io/CFileGZInputStream.h>
 #include <mrpt/io/CFileGZOutputStream.h>
+#include <mrpt/io/CFileOutputStream.h>
 #include <mrpt/kinematics/CVehicleVelCmd_DiffDriven.h>
 #include <mrpt/math/geometry.h>
 #include <mrpt/nav/tpspace/CPTG_DiffDrive_CollisionGridBased.h>
 #include <mrpt/serialization/CArchive.h>
 #include <mrpt/serialization/stl_serialization.h>
 #include <mrpt/system/CTicTac.h>
+#include <mrpt/system/filesystem.h>
 
+#include <cstring>
 #include <iostream>
 
 using namespace mrpt::nav;
@@ -282,7 +285,9 @@ CPTG_DiffDrive_CollisionGridBased::CCollisionGrid::getTPObstacle(
     const float obsX, const float obsY) const
 {
   static const TCollisionCell emptyCell;
-  const TCollisionCell* cell = cellByPos(obsX, obsY);
+  const TCollisionCell* cell = m_flatCache != nullptr
+                                   ? lazyCell(x2idx(obsX), y2idx(obsY))
+                                   : cellByPos(obsX, obsY);
   return cell != nullptr ? *cell : emptyCell;
 }
 
@@ -319,6 +324,12 @@ void CPTG_DiffDrive_CollisionGridBased::CCollisionGrid::updateCellInfo(
 /*---------------------------------------------------------------
           Save to file
   ---------------------------------------------------------------*/
+// The flat, mmap-able cache lives next to the legacy gz one:
+static std::string colGridFlatCacheName(const std::string& gzFilename)
+{
+  return gzFilename + std::string(".mmap");
+}
+
 bool CPTG_DiffDrive_CollisionGridBased::saveColGridsToFile(
     const std::string& filename, const mrpt::math::CPolygon& computed_robotShape) const
 {
@@ -330,7 +341,11 @@ bool CPTG_DiffDrive_CollisionGridBased::saveColGridsToFile(
     const uint32_t n = 1;  // for backwards compatibility...
     auto arch = mrpt::serialization::archiveFrom(fo);
     arch << n;
-    return m_collisionGrid.saveToFile(&arch, computed_robotShape);
+    if (!m_collisionGrid.saveToFile(&arch, computed_robotShape)) return false;
+
+    // Also write the flat cache, so this and other processes can mmap it:
+    m_collisionGrid.saveFlatCacheFile(colGridFlatCacheName(filename), computed_robotShape);
+    return true;
   }
   catch (...)
   {
@@ -344,6 +359,11 @@ bool CPTG_DiffDrive_CollisionGridBased::saveColGridsToFile(
 bool CPTG_DiffDrive_CollisionGridBased::loadColGridsFromFile(
     const std::string& filename, const mrpt::math::CPolygon& current_robotShape)
 {
+  // Try the flat, mmap-able cache first: no deserialization at all, cells
+  // are paged in lazily and the mapping is shared between processes:
+  if (m_collisionGrid.attachFlatCacheFile(colGridFlatCacheName(filename), current_robotShape))
+    return true;
+
   try
   {
     mrpt::io::CFileGZInputStream fi(filename);
@@ -355,7 +375,11 @@ bool CPTG_DiffDrive_CollisionGridBased::loadColGridsFromFile(
     if (n != 1) return false;  // Incompatible (old) format, just discard and
     // recompute.
 
-    return m_collisionGrid.loadFromFile(&arch, current_robotShape);
+    if (!m_collisionGrid.loadFromFile(&arch, current_robotShape)) return false;
+
+    // Upgrade old caches: persist the flat version for the next start-up.
+    m_collisionGrid.saveFlatCacheFile(colGridFlatCacheName(filename), current_robotShape);
+    return true;
   }
   catch (...)
   {
@@ -516,6 +540,221 @@ bool CPTG_DiffDrive_CollisionGridBased::CCollisionGrid::loadFromFile(
   }
 }
 
+/*---------------------------------------------------------------
+    Flat, mmap-able binary cache (see attachFlatCacheFile())
+  ---------------------------------------------------------------*/
+namespace
+{
+constexpr uint32_t COLGRID_FLAT_FILE_MAGIC = 0xC0C0C0F1;
+constexpr uint32_t COLGRID_FLAT_FILE_VERSION = 1;
+
+// On-disk header of the flat cache. All "*_offset" fields are absolute file
+// offsets, 8-byte aligned; multi-byte fields are in host endianness (the
+// magic doubles as an endianness check, so a cache written on a different
+// architecture is simply discarded and recomputed).
+struct TFlatColGridHeader
+{
+  uint32_t magic;
+  uint32_t version;
+  uint16_t alpha_values_count;
+  uint16_t num_shape_points;
+  float v_max, w_max;
+  double x_min, x_max, y_min, y_max, resolution;
+  uint32_t size_x, size_y;
+  uint64_t desc_offset;   //!< uint32_t length + the raw getDescription() bytes
+  uint64_t shape_offset;  //!< num_shape_points * 2 doubles (x,y interleaved)
+  uint64_t cell_table_offset;  //!< (size_x*size_y+1) uint64_t record indices
+  uint64_t records_offset;     //!< num_records TFlatColGridRecord entries
+  uint64_t num_records;
+};
+static_assert(sizeof(TFlatColGridHeader) == 112, "Unexpected header layout");
+
+// One (alpha,distance) collision entry of a cell:
+struct TFlatColGridRecord
+{
+  float dist;
+  uint16_t k;
+  uint16_t reserved;
+};
+static_assert(sizeof(TFlatColGridRecord) == 8, "Unexpected record layout");
+
+constexpr uint64_t flatAlign8(const uint64_t offset)
+{
+  return (offset + 7) & ~uint64_t(7);
+}
+}  // namespace
+
+bool CPTG_DiffDrive_CollisionGridBased::CCollisionGrid::saveFlatCacheFile(
+    const std::string& filename, const mrpt::math::CPolygon& computed_robotShape) const
+{
+  try
+  {
+    const std::string desc = m_parent->getDescription();
+    const uint64_t nCells = m_map.size();
+
+    TFlatColGridHeader hdr;
+    std::memset(&hdr, 0, sizeof(hdr));
+    hdr.magic = COLGRID_FLAT_FILE_MAGIC;
+    hdr.version = COLGRID_FLAT_FILE_VERSION;
+    hdr.alpha_values_count = m_parent->getAlphaValuesCount();
+    hdr.num_shape_points = static_cast<uint16_t>(computed_robotShape.size());
+    hdr.v_max = d2f(m_parent->getMax_V());
+    hdr.w_max = d2f(m_parent->getMax_W());
+    hdr.x_min = m_x_min;
+    hdr.x_max = m_x_max;
+    hdr.y_min = m_y_min;
+    hdr.y_max = m_y_max;
+    hdr.resolution = m_resolution;
+    hdr.size_x = m_size_x;
+    hdr.size_y = m_size_y;
+    hdr.desc_offset = sizeof(TFlatColGridHeader);
+    hdr.shape_offset = flatAlign8(hdr.desc_offset + sizeof(uint32_t) + desc.size());
+    hdr.cell_table_offset = flatAlign8(hdr.shape_offset + hdr.num_shape_points * 2 * sizeof(double));
+    hdr.records_offset = hdr.cell_table_offset + (nCells + 1) * sizeof(uint64_t);
+    hdr.num_records = 0;
+    for (const auto& cell : m_map) hdr.num_records += cell.size();
+
+    std::vector<uint8_t> buf(hdr.records_offset + hdr.num_records * sizeof(TFlatColGridRecord), 0);
+    std::memcpy(buf.data(), &hdr, sizeof(hdr));
+
+    // Description:
+    const auto descLen = static_cast<uint32_t>(desc.size());
+    std::memcpy(&buf[hdr.desc_offset], &descLen, sizeof(descLen));
+    std::memcpy(&buf[hdr.desc_offset + sizeof(descLen)], desc.data(), desc.size());
+
+    // Robot shape:
+    for (uint16_t i = 0; i < hdr.num_shape_points; i++)
+    {
+      const double xy[2] = {computed_robotShape.GetVertex_x(i), computed_robotShape.GetVertex_y(i)};
+      std::memcpy(&buf[hdr.shape_offset + i * 2 * sizeof(double)], xy, sizeof(xy));
+    }
+
+    // Cell table (prefix sum of record counts) + records:
+    uint64_t recIdx = 0;
+    for (uint64_t i = 0; i < nCells; i++)
+    {
+      std::memcpy(&buf[hdr.cell_table_offset + i * sizeof(uint64_t)], &recIdx, sizeof(recIdx));
+      for (const auto& e : m_map[i])
+      {
+        TFlatColGridRecord rec;
+        rec.dist = e.second;
+        rec.k = e.first;
+        rec.reserved = 0;
+        std::memcpy(&buf[hdr.records_offset + recIdx * sizeof(rec)], &rec, sizeof(rec));
+        recIdx++;
+      }
+    }
+    std::memcpy(&buf[hdr.cell_table_offset + nCells * sizeof(uint64_t)], &recIdx, sizeof(recIdx));
+
+    mrpt::io::CFileOutputStream fo(filename);
+    if (!fo.fileOpenCorrectly()) return false;
+    fo.Write(buf.data(), buf.size());
+    return true;
+  }
+  catch (...)
+  {
+    return false;
+  }
+}
+
+bool CPTG_DiffDrive_CollisionGridBased::CCollisionGrid::attachFlatCacheFile(
+    const std::string& filename, const mrpt::math::CPolygon& current_robotShape)
+{
+  try
+  {
+    if (!mrpt::system::fileExists(filename)) return false;
+
+    auto mapped = std::make_shared<mrpt::io::CMemoryMappedFileStream>();
+    if (!mapped->open(filename, mrpt::io::AccessPattern::Random)) return false;
+
+    const auto* base = static_cast<const uint8_t*>(mapped->getRawBufferData());
+    const uint64_t fileSize = mapped->getTotalBytesCount();
+    if (base == nullptr || fileSize < sizeof(TFlatColGridHeader)) return false;
+
+    TFlatColGridHeader hdr;
+    std::memcpy(&hdr, base, sizeof(hdr));
+    if (hdr.magic != COLGRID_FLAT_FILE_MAGIC || hdr.version != COLGRID_FLAT_FILE_VERSION)
+      return false;
+
+    // Same checks as the CArchive loader above: any mismatch means the cache
+    // belongs to another PTG/robot and must be discarded.
+    if (hdr.alpha_values_count != m_parent->getAlphaValuesCount()) return false;
+    if (std::abs(hdr.v_max - d2f(m_parent->getMax_V())) > 1e-4f) return false;
+    if (std::abs(hdr.w_max - d2f(m_parent->getMax_W())) > 1e-4f) return false;
+    if (std::abs(hdr.x_min - m_x_min) > 1e-6 || std::abs(hdr.x_max - m_x_max) > 1e-6) return false;
+    if (std::abs(hdr.y_min - m_y_min) > 1e-6 || std::abs(hdr.y_max - m_y_max) > 1e-6) return false;
+    if (std::abs(hdr.resolution - m_resolution) > 1e-6) return false;
+    if (hdr.size_x != m_size_x || hdr.size_y != m_size_y) return false;
+    if (hdr.num_shape_points != current_robotShape.size()) return false;
+
+    const uint64_t nCells = uint64_t(hdr.size_x) * hdr.size_y;
+
+    // Sanity of all file offsets before dereferencing anything:
+    if (hdr.desc_offset + sizeof(uint32_t) > fileSize) return false;
+    if (hdr.shape_offset + hdr.num_shape_points * 2 * sizeof(double) > fileSize) return false;
+    if (hdr.cell_table_offset % sizeof(uint64_t) != 0) return false;
+    if (hdr.cell_table_offset + (nCells + 1) * sizeof(uint64_t) > fileSize) return false;
+    if (hdr.records_offset + hdr.num_records * sizeof(TFlatColGridRecord) > fileSize) return false;
+
+    // Description:
+    uint32_t descLen;
+    std::memcpy(&descLen, base + hdr.desc_offset, sizeof(descLen));
+    if (hdr.desc_offset + sizeof(uint32_t) + descLen > fileSize) return false;
+    const std::string desc(
+        reinterpret_cast<const char*>(base + hdr.desc_offset + sizeof(uint32_t)), descLen);
+    if (desc != m_parent->getDescription()) return false;
+
+    // Robot shape:
+    for (uint16_t i = 0; i < hdr.num_shape_points; i++)
+    {
+      double xy[2];
+      std::memcpy(&xy, base + hdr.shape_offset + i * 2 * sizeof(double), sizeof(xy));
+      if (xy[0] != current_robotShape.GetVertex_x(i) || xy[1] != current_robotShape.GetVertex_y(i))
+        return false;
+    }
+
+    const auto* cellTable = reinterpret_cast<const uint64_t*>(base + hdr.cell_table_offset);
+    if (cellTable[nCells] != hdr.num_records) return false;
+
+    // All parameters match: attach. Cells start empty and are decoded on
+    // first access in lazyCell():
+    m_flatCache = std::move(mapped);
+    m_flatCellTable = cellTable;
+    m_flatRecords = base + hdr.records_offset;
+    for (auto& c : m_map) c.clear();
+    m_cellDecoded.assign(nCells, false);
+    return true;
+  }
+  catch (...)
+  {
+    return false;
+  }
+}
+
+const CPTG_DiffDrive_CollisionGridBased::TCollisionCell*
+CPTG_DiffDrive_CollisionGridBased::CCollisionGrid::lazyCell(const int icx, const int icy) const
+{
+  if (icx < 0 || icy < 0 || icx >= static_cast<int>(m_size_x) || icy >= static_cast<int>(m_size_y))
+    return nullptr;
+
+  const size_t idx = icx + icy * m_size_x;
+  // Logically const: the decoded cell is just a cache of the mapped file.
+  auto& cell = const_cast<CCollisionGrid*>(this)->m_map[idx];
+  if (!m_cellDecoded[idx])
+  {
+    const uint64_t i0 = m_flatCellTable[idx], i1 = m_flatCellTable[idx + 1];
+    cell.reserve(i1 - i0);
+    for (uint64_t i = i0; i < i1; i++)
+    {
+      TFlatColGridRecord rec;
+      std::memcpy(&rec, m_flatRecords + i * sizeof(rec), sizeof(rec));
+      cell.emplace_back(rec.k, rec.dist);
+    }
+    m_cellDecoded[idx] = true;
+  }
+  return &cell;
+}
+
 bool CPTG_DiffDrive_CollisionGridBased::inverseMap_WS2TP(
     double x, double y, int& out_k, double& out_d, double tolerance_dist) const
 {
@@ -23,10 +23,16 @@ void CPTG_RobotShape_Polygonal::setRobotShape(const mrpt::math::CPolygon& robotS
   ASSERT_GE_(robotShape.size(), 3u);
   m_robotShape = robotShape;
 
+  internal_updateRobotShapeCache();
+  internal_processNewRobotShape();
+}
+
+void CPTG_RobotShape_Polygonal::internal_updateRobotShapeCache()
+{
   m_robotMaxRadius = .0;  // Default minimum
   for (const auto& v : m_robotShape) mrpt::keep_max(m_robotMaxRadius, v.norm());
 
-  internal_processNewRobotShape();
+  m_robotShapeCompiled.compile(m_robotShape);
 }
 
 void CPTG_RobotShape_Polygonal::loadDefaultParams()
@@ -36,6 +42,7 @@ void CPTG_RobotShape_Polygonal::loadDefaultParams()
   m_robotShape.AddVertex(0.2, 0.1);
   m_robotShape.AddVertex(0.2, -0.1);
   m_robotShape.AddVertex(-0.15, -0.15);
+  internal_updateRobotShapeCache();
 }
 
 void CPTG_RobotShape_Polygonal::loadShapeFromConfigFile(
@@ -66,7 +73,11 @@ void CPTG_RobotShape_Polygonal::loadShapeFromConfigFile(
     m_robotShape.AddVertex(ptx, pty);
   }
 
-  if (any_pt) internal_processNewRobotShape();
+  if (any_pt)
+  {
+    internal_updateRobotShapeCache();
+    internal_processNewRobotShape();
+  }
 }
 
 void CPTG_RobotShape_Polygonal::saveToConfigFile(
@@ -123,6 +134,7 @@ void CPTG_RobotShape_Polygonal::internal_shape_loadFromStream(mrpt::serializatio
   {
     case 0:
       in >> m_robotShape;
+      internal_updateRobotShapeCache();
       break;
     default:
       MRPT_THROW_UNKNOWN_SERIALIZATION_VERSION(version);
@@ -142,7 +154,7 @@ double CPTG_RobotShape_Polygonal::getMaxRobotRadius() const { return m_robotMaxR
 
 bool CPTG_RobotShape_Polygonal::isPointInsideRobotShape(const double x, const double y) const
 {
-  return m_robotShape.contains(mrpt::math::TPoint2D(x, y));
+  return m_robotShapeCompiled.contains(mrpt::math::TPoint2D(x, y));
 }
 
 double CPTG_RobotShape_Polygonal::evalClearanceToRobotShape(const double ox, const double oy) const
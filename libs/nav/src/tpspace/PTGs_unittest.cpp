@@ -9,6 +9,8 @@
 
 #include <gtest/gtest.h>
 #include <mrpt/config/CConfigFile.h>
+#include <mrpt/config/CConfigFileMemory.h>
+#include <mrpt/nav/tpspace/CPTG_DiffDrive_C.h>
 #include <mrpt/nav/tpspace/CParameterizedTrajectoryGenerator.h>
 #include <mrpt/system/filesystem.h>
 #include <test_mrpt_common.h>
@@ -165,3 +167,60 @@ TEST(NavTests, PTGs_tests)
 
   }  // for each ptg
 }
+
+TEST(NavTests, PTG_CollisionGridFlatMmapCache)
+{
+  using namespace std;
+  using namespace mrpt;
+  using namespace mrpt::nav;
+
+  // Small PTG so the cold (compute) run stays fast:
+  mrpt::config::CConfigFileMemory cfg;
+  {
+    CPTG_DiffDrive_C tmp;
+    tmp.loadDefaultParams();
+    static_cast<CParameterizedTrajectoryGenerator&>(tmp).saveToConfigFile(cfg, "PTG");
+  }
+  cfg.write("PTG", "K", 1.0);
+  cfg.write("PTG", "refDistance", 2.0);
+  cfg.write("PTG", "resolution", 0.10);
+
+  const string cacheFil = mrpt::system::getTempFileName() + string("_ptg_cache.bin.gz");
+  const string flatFil = cacheFil + string(".mmap");
+
+  // Builds a PTG from the cache file (computing it on the 1st run) and
+  // samples TP-obstacles all over the workspace:
+  const auto buildAndSample = [&cfg, &cacheFil]() -> std::vector<double>
+  {
+    auto ptg = std::make_shared<CPTG_DiffDrive_C>();
+    auto& p = static_cast<CParameterizedTrajectoryGenerator&>(*ptg);
+    ptg->loadDefaultParams();
+    p.loadFromConfigFile(cfg, "PTG");
+    p.initialize(cacheFil, false /*verbose*/);
+
+    std::vector<double> tp_obstacles;
+    p.initTPObstacles(tp_obstacles);
+    for (double ox = -1.9; ox < 1.9; ox += 0.13)
+      for (double oy = -1.9; oy < 1.9; oy += 0.17) p.updateTPObstacle(ox, oy, tp_obstacles);
+    return tp_obstacles;
+  };
+
+  // 1st run: computes the grids and writes both the gz and the flat caches:
+  const auto tp_computed = buildAndSample();
+  EXPECT_TRUE(mrpt::system::fileExists(flatFil));
+
+  // 2nd run: attaches the flat cache (lazy, mmap-ed) and must give exactly
+  // the same TP-obstacles:
+  const auto tp_mmap = buildAndSample();
+  EXPECT_EQ(tp_computed, tp_mmap);
+
+  // 3rd run, with the flat cache removed: falls back to gz deserialization
+  // (and re-creates the flat cache for the next start-up):
+  mrpt::system::deleteFile(flatFil);
+  const auto tp_gz = buildAndSample();
+  EXPECT_EQ(tp_computed, tp_gz);
+  EXPECT_TRUE(mrpt::system::fileExists(flatFil));
+
+  mrpt::system::deleteFile(flatFil);
+  mrpt::system::deleteFile(cacheFil);
+}
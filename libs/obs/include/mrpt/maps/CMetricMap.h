@@ -154,6 +154,17 @@ class CMetricMap :
       const mrpt::obs::CObservation::Ptr& obs,
       const std::optional<const mrpt::poses::CPose3D>& robotPose = std::nullopt);
 
+  /** Returns true if this map allows insertObservation() to be invoked
+   * concurrently from several threads for *different* observations, i.e. the
+   * implementation performs its own internal synchronization. Most maps
+   * mutate shared storage during insertion and return false (the default);
+   * see CMultiMetricMap::enableParallelInsertion() for a map that can opt in.
+   * Used by CSensoryFrame::insertObservationsIntoParallel() to decide between
+   * concurrent and serial insertion.
+   * \note [New in MRPT 2.14.5]
+   */
+  virtual bool insertionIsThreadSafe() const { return false; }
+
 #if defined(MRPT_BUILDING_PYTHON_WRAPPER)
   bool insertObs(
       const mrpt::obs::CObservation& obs, const mrpt::poses::CPose3D* robotPose = nullptr)
@@ -41,6 +41,12 @@ struct TMatchingParams
    * the sensor for a 2D laser scanner. */
   mrpt::math::TPoint3D angularDistPivotPoint{0, 0, 0};
 
+  /** Number of threads to shard the correspondence search across: 1=serial
+   * (default), 0=one per hardware thread. Point-cloud maps shard the query
+   * points over worker threads, each with its own pairings accumulator,
+   * and merge the results. \note [New in MRPT 2.14.5] */
+  size_t numThreads{1};
+
   /** Ctor: default values */
   TMatchingParams() = default;
 };
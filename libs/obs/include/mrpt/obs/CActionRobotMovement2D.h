@@ -15,6 +15,8 @@
 #include <mrpt/poses/CPosePDF.h>
 #include <mrpt/typemeta/TEnumType.h>
 
+#include <vector>
+
 namespace mrpt::obs
 {
 /** Represents a probabilistic 2D movement of the robot mobile base
@@ -169,6 +171,18 @@ class CActionRobotMovement2D : public CAction
    */
   void drawSingleSample(mrpt::poses::CPose2D& outSample) const;
 
+  /** Batch version of drawSingleSample(): draws N independent samples of the
+   * pose increment, overwriting outSamples. All the underlying normalized
+   * Gaussian variates are generated in one batch
+   * (mrpt::random::CRandomGenerator::drawGaussian1DFill()), so with thousands
+   * of particles per prediction step this is much faster than N calls to
+   * drawSingleSample() - which costs 6+ scalar RNG calls per particle in the
+   * Thrun model.
+   * \sa drawSingleSample
+   * \note [New in MRPT 2.14.5]
+   */
+  void drawSamples(size_t N, std::vector<mrpt::poses::CPose2D>& outSamples) const;
+
   /** Call this before calling a high number of times "fastDrawSingleSample",
    * which is much faster than "drawSingleSample"
    */
@@ -208,6 +222,16 @@ class CActionRobotMovement2D : public CAction
    */
   void drawSingleSample_modelThrun(mrpt::poses::CPose2D& outSample) const;
 
+  /** The batch sample generator for the Gaussian model, internally called
+   * when the user invokes drawSamples().
+   */
+  void drawSamples_modelGaussian(size_t N, std::vector<mrpt::poses::CPose2D>& outSamples) const;
+
+  /** The batch sample generator for the Thrun model, internally called
+   * when the user invokes drawSamples().
+   */
+  void drawSamples_modelThrun(size_t N, std::vector<mrpt::poses::CPose2D>& outSamples) const;
+
   /** Internal use
    */
   void prepareFastDrawSingleSample_modelGaussian() const;
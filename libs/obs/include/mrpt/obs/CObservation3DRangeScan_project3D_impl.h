@@ -8,21 +8,28 @@
    +------------------------------------------------------------------------+ */
 #pragma once
 
-#include <mrpt/core/cpu.h>
+#include <mrpt/core/WorkerThreadsPool.h>
 #include <mrpt/core/round.h>  // round()
 #include <mrpt/math/CMatrixF.h>
 #include <mrpt/math/CVectorFixed.h>
+#include <mrpt/math/TPoint3D.h>
 #include <mrpt/obs/CObservation3DRangeScan.h>
 #include <mrpt/obs/T3DPointsProjectionParams.h>
 #include <mrpt/obs/TRangeImageFilter.h>
 #include <mrpt/opengl/pointcloud_adapters.h>
+#include <mrpt/poses/Lie/SE.h>
 
 #include <Eigen/Dense>  // block<>()
+#include <algorithm>    // min()
+#include <array>
+#include <cstdint>
+#include <future>
+#include <thread>
+#include <vector>
 
 namespace mrpt::obs::detail
 {
-// Auxiliary functions which implement SSE-optimized proyection of 3D point
-// cloud:
+// Auxiliary functions which implement the proyection of 3D point clouds:
 template <class POINTMAP>
 void do_project_3d_pointcloud(
     const int H,
@@ -38,8 +45,38 @@ void do_project_3d_pointcloud(
     const mrpt::obs::TRangeImageFilterParams& fp,
     bool MAKE_ORGANIZED,
     const int DECIM);
+
+/** Fused unprojection kernel over a flat span of `n` range image pixels:
+ * uint16_t->float range decode (with `rangeUnits` scaling), per-pixel
+ * multiplication by the K^-1 direction LUT, min/max range filtering into
+ * `validMask` (exactly the per-pixel semantics of
+ * TRangeImageFilter::do_range_filter()), and translation by (tx,ty,tz), all
+ * in one pass over memory.
+ * `maskMin`/`maskMax` may be nullptr. Outputs are dense: one (x,y,z,valid)
+ * entry per input pixel.
+ * Implemented in CObservation3DRangeScan_unproject.cpp and dispatched at
+ * runtime to the widest SIMD kernel (SSE2/AVX2) supported by the CPU.
+ */
+void unproject_ranges(
+    const uint16_t* ranges,
+    float rangeUnits,
+    const float* kxs,
+    const float* kys,
+    const float* kzs,
+    const float* maskMin,
+    const float* maskMax,
+    bool rangeCheckBetween,
+    float tx,
+    float ty,
+    float tz,
+    size_t n,
+    float* xs,
+    float* ys,
+    float* zs,
+    uint8_t* validMask);
+
 template <class POINTMAP>
-void do_project_3d_pointcloud_SSE2(
+void do_project_3d_pointcloud_fused(
     const int H,
     const int W,
     const float* kxs,
@@ -51,7 +88,9 @@ void do_project_3d_pointcloud_SSE2(
     std::vector<uint16_t>& idxs_x,
     std::vector<uint16_t>& idxs_y,
     const mrpt::obs::TRangeImageFilterParams& fp,
-    bool MAKE_ORGANIZED);
+    bool MAKE_ORGANIZED,
+    const mrpt::math::TPoint3Df& translation,
+    unsigned int numThreads);
 
 template <typename POINTMAP>
 inline void range2XYZ_LUT(
@@ -93,17 +132,24 @@ inline void range2XYZ_LUT(
   mrpt::math::CMatrix_u16* ri =
       pp.layer.empty() ? &src_obs.rangeImage : &src_obs.rangeImageOtherLayers.at(pp.layer);
 
-#if MRPT_HAS_SSE2
-  // if image width is not 8*N, use standard method
-  if ((W & 0x07) == 0 && pp.USE_SSE2 && DECIM == 1 && mrpt::cpu::supports(mrpt::cpu::feature::SSE2))
-    do_project_3d_pointcloud_SSE2(
-        H, W, kxs, kys, kzs, *ri, src_obs.rangeUnits, pca, src_obs.points3D_idxs_x,
-        src_obs.points3D_idxs_y, fp, pp.MAKE_ORGANIZED);
-  else
-#endif
-    do_project_3d_pointcloud(
+  if (pp.USE_SSE2 && DECIM == 1)
+  {
+    // Fused (SIMD-dispatched, optionally multi-threaded) path. If we are
+    // generating points in the vehicle frame, the final translation gets
+    // fused into the kernel too, so nothing remains to be done afterwards:
+    const auto trans = use_rotated_LUT
+        ? mrpt::math::TPoint3Df(
+              src_obs.sensorPose.x(), src_obs.sensorPose.y(), src_obs.sensorPose.z())
+        : mrpt::math::TPoint3Df(0, 0, 0);
+    do_project_3d_pointcloud_fused(
         H, W, kxs, kys, kzs, *ri, src_obs.rangeUnits, pca, src_obs.points3D_idxs_x,
-        src_obs.points3D_idxs_y, fp, pp.MAKE_ORGANIZED, DECIM);
+        src_obs.points3D_idxs_y, fp, pp.MAKE_ORGANIZED, trans, pp.numThreads);
+    return;
+  }
+
+  do_project_3d_pointcloud(
+      H, W, kxs, kys, kzs, *ri, src_obs.rangeUnits, pca, src_obs.points3D_idxs_x,
+      src_obs.points3D_idxs_y, fp, pp.MAKE_ORGANIZED, DECIM);
 
   // Do final traslation, if we were generating points in the vehicle frame:
   if (use_rotated_LUT)
@@ -322,17 +368,18 @@ void unprojectInto(
     if (pp.robotPoseInTheWorld)
       transf_to_apply.composeFrom(*pp.robotPoseInTheWorld, mrpt::poses::CPose3D(transf_to_apply));
 
-    const auto HM =
-        transf_to_apply.getHomogeneousMatrixVal<mrpt::math::CMatrixDouble44>().cast_float();
-    mrpt::math::CVectorFixedFloat<4> pt, pt_transf;
-    pt[3] = 1;
+    // Transform in SoA chunks through the batch (SIMD-dispatched) SE(3)
+    // kernel, instead of one homogeneous matrix-vector product per point:
+    constexpr size_t CHUNK = 1024;
+    std::array<float, CHUNK> cx, cy, cz;
 
     const size_t nPts = pca.size();
-    for (size_t i = 0; i < nPts; i++)
+    for (size_t i0 = 0; i0 < nPts; i0 += CHUNK)
     {
-      pca.getPointXYZ(i, pt[0], pt[1], pt[2]);
-      pt_transf = HM * pt;
-      pca.setPointXYZ(i, pt_transf[0], pt_transf[1], pt_transf[2]);
+      const size_t n = std::min(CHUNK, nPts - i0);
+      for (size_t k = 0; k < n; k++) pca.getPointXYZ(i0 + k, cx[k], cy[k], cz[k]);
+      mrpt::poses::Lie::SE<3>::composePoints(transf_to_apply, cx.data(), cy.data(), cz.data(), n);
+      for (size_t k = 0; k < n; k++) pca.setPointXYZ(i0 + k, cx[k], cy[k], cz[k]);
     }
   }
 }  // end of unprojectInto
@@ -424,7 +471,7 @@ inline void do_project_3d_pointcloud(
 
 // Auxiliary functions which implement (un)projection of 3D point clouds:
 template <class POINTMAP>
-inline void do_project_3d_pointcloud_SSE2(
+inline void do_project_3d_pointcloud_fused(
     const int H,
     const int W,
     const float* kxs,
@@ -436,132 +483,98 @@ inline void do_project_3d_pointcloud_SSE2(
     std::vector<uint16_t>& idxs_x,
     std::vector<uint16_t>& idxs_y,
     const mrpt::obs::TRangeImageFilterParams& fp,
-    bool MAKE_ORGANIZED)
+    bool MAKE_ORGANIZED,
+    const mrpt::math::TPoint3Df& translation,
+    unsigned int numThreads)
 {
-#if MRPT_HAS_SSE2
-  // Preconditions: minRangeMask() has the right size
-  // Use optimized version:
-  const int W_4 = W >> 2;  // /=4 , since we process 4 values at a time.
-  size_t idx = 0;
-  alignas(MRPT_MAX_STATIC_ALIGN_BYTES) float xs[4], ys[4], zs[4];
-  const __m128 D_zeros = _mm_set_ps(.0f, .0f, .0f, .0f);
-  const __m128 xormask = (fp.rangeCheckBetween) ? _mm_cmpneq_ps(D_zeros, D_zeros)
-                                                :  // want points BETWEEN min and max to be valid
-                             _mm_cmpeq_ps(
-                                 D_zeros,
-                                 D_zeros);  // want points OUTSIDE of min and max to be valid
-  for (int r = 0; r < H; r++)
+  const size_t WH = static_cast<size_t>(W) * H;
+
+  // Dense SoA outputs of the fused kernel. Kept across calls to avoid
+  // re-allocating ~4 MB per frame on this (hot, sensor-rate) path:
+  thread_local std::vector<float> xs, ys, zs;
+  thread_local std::vector<uint8_t> valid;
+  xs.resize(WH);
+  ys.resize(WH);
+  zs.resize(WH);
+  valid.resize(WH);
+
+  // Row-wise kernel invocations, so we never assume anything about the
+  // matrices inter-row memory layout:
+  const auto processRows = [&](int r0, int r1)
   {
-    const uint16_t* Du16_ptr = &rangeImage(r, 0);
-    const float* Dgt_ptr = !fp.rangeMask_min ? nullptr : &(*fp.rangeMask_min)(r, 0);
-    const float* Dlt_ptr = !fp.rangeMask_max ? nullptr : &(*fp.rangeMask_max)(r, 0);
+    for (int r = r0; r < r1; r++)
+    {
+      const size_t off = static_cast<size_t>(r) * W;
+      unproject_ranges(
+          &rangeImage(r, 0), rangeUnits, kxs + off, kys + off, kzs + off,
+          fp.rangeMask_min ? &(*fp.rangeMask_min)(r, 0) : nullptr,
+          fp.rangeMask_max ? &(*fp.rangeMask_max)(r, 0) : nullptr, fp.rangeCheckBetween,
+          translation.x, translation.y, translation.z, static_cast<size_t>(W), &xs[off], &ys[off],
+          &zs[off], &valid[off]);
+    }
+  };
+
+  unsigned int nThreads = numThreads != 0 ? numThreads : std::thread::hardware_concurrency();
+  nThreads = std::max(1u, std::min<unsigned int>(nThreads, H));
 
-    for (int c = 0; c < W_4; c++)
+  if (nThreads == 1)
+  {
+    processRows(0, H);
+  }
+  else
+  {
+    static mrpt::WorkerThreadsPool pool(
+        std::thread::hardware_concurrency(), mrpt::WorkerThreadsPool::POLICY_FIFO, "unproject3D");
+
+    std::vector<std::future<void>> futs;
+    futs.reserve(nThreads);
+    for (unsigned int t = 0; t < nThreads; t++)
     {
-      // Let the compiler optimize this as MMX instructions (tested in
-      // godbolt):
-      alignas(16) float tmp[4];
-      for (int b = 0; b < 4; b++) tmp[b] = Du16_ptr[b] * rangeUnits;
-
-      const __m128 D = _mm_load_ps(&tmp[0]);
-      const __m128 nz_mask = _mm_cmpgt_ps(D, D_zeros);
-      __m128 valid_range_mask;
-      if (!fp.rangeMask_min && !fp.rangeMask_max)
-      {  // No filter: just skip D=0 points
-        valid_range_mask = nz_mask;
-      }
-      else
+      const int r0 = (H * t) / nThreads;
+      const int r1 = (H * (t + 1)) / nThreads;
+      futs.emplace_back(pool.enqueue(processRows, r0, r1));
+    }
+    // Join all stripes before anything on this stack can go away, keeping
+    // the first error (if any) to rethrow afterwards:
+    std::exception_ptr firstExcept;
+    for (auto& f : futs)
+    {
+      try
       {
-        if (!fp.rangeMask_min || !fp.rangeMask_max)
-        {  // Only one filter
-          if (fp.rangeMask_min)
-          {
-            const __m128 Dmin = _mm_load_ps(Dgt_ptr);
-            valid_range_mask = _mm_or_ps(_mm_cmpgt_ps(D, Dmin), _mm_cmpeq_ps(Dmin, D_zeros));
-          }
-          else
-          {
-            const __m128 Dmax = _mm_load_ps(Dlt_ptr);
-            valid_range_mask = _mm_or_ps(_mm_cmplt_ps(D, Dmax), _mm_cmpeq_ps(Dmax, D_zeros));
-          }
-          valid_range_mask = _mm_and_ps(valid_range_mask, nz_mask);  // Filter out D=0 points
-        }
-        else
-        {
-          // We have both: D>Dmin and D<Dmax conditions, with XOR to
-          // optionally invert the selection:
-          const __m128 Dmin = _mm_load_ps(Dgt_ptr);
-          const __m128 Dmax = _mm_load_ps(Dlt_ptr);
-
-          const __m128 gt_mask = _mm_or_ps(_mm_cmpgt_ps(D, Dmin), _mm_cmpeq_ps(Dmin, D_zeros));
-          const __m128 lt_mask = _mm_or_ps(_mm_cmplt_ps(D, Dmax), _mm_cmpeq_ps(Dmax, D_zeros));
-          // (D>Dmin && D<Dmax) & skip points at zero
-          valid_range_mask = _mm_and_ps(nz_mask, _mm_and_ps(gt_mask, lt_mask));
-          valid_range_mask = _mm_xor_ps(valid_range_mask, xormask);
-          // Add the case of D_min & D_max = 0 (no filtering)
-          valid_range_mask = _mm_or_ps(
-              valid_range_mask,
-              _mm_and_ps(_mm_cmpeq_ps(Dmin, D_zeros), _mm_cmpeq_ps(Dmax, D_zeros)));
-          // Finally, ensure no invalid ranges get thru:
-          valid_range_mask = _mm_and_ps(valid_range_mask, nz_mask);
-        }
+        f.get();
       }
-      const int valid_range_maski =
-          _mm_movemask_epi8(_mm_castps_si128(valid_range_mask));  // 0x{f|0}{f|0}{f|0}{f|0}
-      if (valid_range_maski != 0)                                 // Any of the 4 values is valid?
+      catch (...)
       {
-        const __m128 KX = _mm_load_ps(kxs);
-        const __m128 KY = _mm_load_ps(kys);
-        const __m128 KZ = _mm_load_ps(kzs);
-
-        _mm_storeu_ps(xs, _mm_mul_ps(KX, D));
-        _mm_storeu_ps(ys, _mm_mul_ps(KY, D));
-        _mm_storeu_ps(zs, _mm_mul_ps(KZ, D));
+        if (!firstExcept) firstExcept = std::current_exception();
+      }
+    }
+    if (firstExcept) std::rethrow_exception(firstExcept);
+  }
 
-        for (int q = 0; q < 4; q++)
-        {
-          const int actual_c = (c << 2) + q;
-          if ((valid_range_maski & (1 << (q * 4))) != 0)
-          {
-            pca.setPointXYZ(idx, xs[q], ys[q], zs[q]);
-            idxs_x[idx] = actual_c;
-            idxs_y[idx] = r;
-            ++idx;
-          }
-          else
-          {
-            if (MAKE_ORGANIZED)
-            {
-              pca.setInvalidPoint(idx);
-              ++idx;
-            }
-            if (fp.mark_invalid_ranges) rangeImage.coeffRef(r, actual_c) = 0;
-          }
-        }
+  // Sequential compaction of valid points, in the same row-major order (and
+  // with the same organized/mark-invalid semantics) than the scalar path:
+  size_t idx = 0;
+  for (int r = 0; r < H; r++)
+    for (int c = 0; c < W; c++)
+    {
+      const size_t i = static_cast<size_t>(r) * W + c;
+      if (valid[i])
+      {
+        pca.setPointXYZ(idx, xs[i], ys[i], zs[i]);
+        idxs_x[idx] = c;
+        idxs_y[idx] = r;
+        ++idx;
       }
-      else if (MAKE_ORGANIZED)
+      else
       {
-        for (int q = 0; q < 4; q++)
-        {
-          pca.setInvalidPoint(idx);
-          ++idx;
-          const int actual_c = (c << 2) + q;
-          if (fp.mark_invalid_ranges) rangeImage.coeffRef(r, actual_c) = 0;
-        }
+        if (MAKE_ORGANIZED) pca.setInvalidPoint(idx++);
+        if (fp.mark_invalid_ranges) rangeImage.coeffRef(r, c) = 0;
       }
-      Du16_ptr += 4;
-      if (Dgt_ptr) Dgt_ptr += 4;
-      if (Dlt_ptr) Dlt_ptr += 4;
-      kxs += 4;
-      kys += 4;
-      kzs += 4;
     }
-  }
   pca.resize(idx);
   // Make sure indices are also resized down to the actual number of points,
   // even if they are not part of the object PCA refers to:
   idxs_x.resize(idx);
   idxs_y.resize(idx);
-#endif
 }
 }  // namespace mrpt::obs::detail
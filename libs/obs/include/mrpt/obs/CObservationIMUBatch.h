@@ -0,0 +1,98 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+#pragma once
+
+#include <mrpt/math/TPoint3D.h>
+#include <mrpt/obs/CObservation.h>
+#include <mrpt/poses/CPose3D.h>
+#include <mrpt/system/datetime.h>
+
+#include <vector>
+
+namespace mrpt::obs
+{
+/** A contiguous block of timestamped inertial samples (gyroscope and
+ * accelerometer) from one IMU, intended for high-rate streams.
+ *
+ *  Unlike CObservationIMU, which carries a single sample per observation
+ * object (so a 400 Hz IMU generates 400 heap-allocated observations per
+ * second through serialization), one CObservationIMUBatch groups all the
+ * samples of a grabbing period into three parallel vectors with one entry
+ * per sample. The layout keeps each signal contiguous in memory, so
+ * consumers (LiDAR de-skewing, factor-graph frontends, ...) can sweep the
+ * whole block in tight loops; see mrpt::obs::imu_preintegrate().
+ *
+ *  The base class `timestamp` field holds the time of the **first** sample;
+ * each sample stores its time as seconds elapsed since it in timeOffsets.
+ *
+ * \sa CObservationIMU, mrpt::obs::imu_preintegrate()
+ * \note [New in MRPT 2.14.5]
+ * \ingroup mrpt_obs_grp
+ */
+class CObservationIMUBatch : public CObservation
+{
+  DEFINE_SERIALIZABLE(CObservationIMUBatch, mrpt::obs)
+
+ public:
+  CObservationIMUBatch() = default;
+  ~CObservationIMUBatch() override = default;
+
+  /** The pose of the sensor on the robot. */
+  mrpt::poses::CPose3D sensorPose;
+
+  /** Time of each sample, as seconds elapsed since `timestamp` (the time of
+   * the first sample). Monotonically increasing; timeOffsets[0] is 0 by
+   * convention. */
+  std::vector<double> timeOffsets;
+
+  /** Angular velocity of each sample, in the sensor frame (rad/s) */
+  std::vector<mrpt::math::TVector3D> angularVelocities;
+
+  /** Linear acceleration of each sample, in the sensor frame, including
+   * gravity (m/s^2) */
+  std::vector<mrpt::math::TVector3D> accelerations;
+
+  /** Number of samples in the block */
+  size_t size() const { return timeOffsets.size(); }
+  bool empty() const { return timeOffsets.empty(); }
+
+  /** Reserves room for n samples in the three vectors */
+  void reserve(size_t n);
+
+  /** Removes all samples */
+  void clear();
+
+  /** Appends one sample; timeOffset is in seconds since `timestamp` */
+  void push_back(
+      double timeOffset, const mrpt::math::TVector3D& angularVelocity,
+      const mrpt::math::TVector3D& acceleration);
+
+  /** Absolute timestamp of the i-th sample */
+  mrpt::system::TTimeStamp sampleTimestamp(size_t idx) const
+  {
+    return mrpt::system::timestampAdd(timestamp, timeOffsets.at(idx));
+  }
+
+  /** Time span covered by the block, in seconds (0 if less than 2 samples) */
+  double duration() const { return timeOffsets.size() < 2 ? .0 : timeOffsets.back(); }
+
+  // See base class docs
+  void getSensorPose(mrpt::poses::CPose3D& out_sensorPose) const override
+  {
+    out_sensorPose = sensorPose;
+  }
+  void setSensorPose(const mrpt::poses::CPose3D& newSensorPose) override
+  {
+    sensorPose = newSensorPose;
+  }
+  void getDescriptionAsText(std::ostream& o) const override;
+
+};  // End of class def.
+
+}  // namespace mrpt::obs
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <mrpt/math/CMatrixDynamic.h>
+#include <mrpt/math/TTwist3D.h>
 #include <mrpt/obs/CObservation.h>
 #include <mrpt/obs/CSinCosLookUpTableFor2DScans.h>
 #include <mrpt/poses/CPose3D.h>
@@ -17,6 +18,11 @@
 #include <variant>
 #include <vector>
 
+namespace mrpt::poses
+{
+class CPose3DInterpolator;
+}
+
 namespace mrpt::obs
 {
 class CObservationVelodyneScan;
@@ -165,6 +171,34 @@ class CObservationRotatingScan : public CObservation
   bool fromGeneric(const mrpt::obs::CObservation& o);
   /** @} */
 
+  /** @name Scan deskew (motion compensation)
+   * @{ */
+
+  /** In-place motion compensation ("deskew") of the scan using the vehicle
+   * trajectory. Column `c` of the scan was captured at time
+   * `timestamp + sweepDuration*c/(columnCount-1)` (all rows within a column
+   * fire simultaneously); this method queries the vehicle path once per
+   * column (in one batched CPose3DInterpolator::interpolateMany() call) and
+   * rewrites organizedPoints so that all points become expressed in the
+   * sensor frame at the time of the **first** column, i.e. the `timestamp`
+   * of this observation, ready to be fed to ICP-based odometry without an
+   * extra point cloud copy.
+   * rangeImage and intensityImage are left untouched: ranges remain the raw
+   * measured ones.
+   * \return false, leaving the scan unmodified, if any column time cannot be
+   * interpolated from `vehiclePath`; true on success.
+   * \note [New in MRPT 2.14.5] */
+  bool deskew(const mrpt::poses::CPose3DInterpolator& vehiclePath);
+
+  /** \overload Constant-velocity model: `vehicleTwist` is the twist
+   * (vx,vy,vz,wx,wy,wz) of the vehicle in its own body frame at the start of
+   * the scan, e.g. built from CObservationIMU gyroscope rates and the
+   * current odometry velocity estimate.
+   * \note [New in MRPT 2.14.5] */
+  void deskew(const mrpt::math::TTwist3D& vehicleTwist);
+
+  /** @} */
+
   /** @name Delayed-load manual control methods.
     @{ */
   // See base class docs.
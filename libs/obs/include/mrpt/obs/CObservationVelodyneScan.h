@@ -334,6 +334,39 @@ class CObservationVelodyneScan : public CObservation
       PointCloudStorageWrapper& dest,
       const TGeneratePointCloudParameters& params = TGeneratePointCloudParameters());
 
+  /** Output of decodePacket(): the valid points of one raw data packet,
+   * decoded into structure-of-arrays vectors without any per-point virtual
+   * dispatch. All the points of a packet share its reception timestamp
+   * \a pkt_timestamp (one packet spans ~1.3 ms).
+   * \note [New in MRPT 2.14.5]
+   * \sa decodePacket() */
+  struct TDecodedPacket
+  {
+    std::vector<float> x, y, z;
+    std::vector<uint8_t> intensity;
+    /** Corrected azimuth of each point, in units of 0.01 degree (not yet
+     * wrapped to [0,36000)) */
+    std::vector<float> azimuth;
+    std::vector<uint16_t> laser_id;
+    mrpt::system::TTimeStamp pkt_timestamp = INVALID_TIMESTAMP;
+
+    void clear();
+  };
+
+  /** Decodes the `pktIdx`-th entry of \a scan_packets into `out` (whose
+   * former contents are discarded). This is the non-virtual building block
+   * underlying generatePointCloud(); it is safe to call concurrently from
+   * several threads on different `pktIdx`, so whole scans can be decoded in
+   * parallel with one worker per group of packets.
+   * \note [New in MRPT 2.14.5]
+   * \sa generatePointCloud(),
+   * mrpt::maps::CPointsMapXYZIRT::loadFromVelodyneScanDirect()
+   */
+  void decodePacket(
+      std::size_t pktIdx,
+      TDecodedPacket& out,
+      const TGeneratePointCloudParameters& params = TGeneratePointCloudParameters()) const;
+
   /** Results for generatePointCloudAlongSE3Trajectory() */
   struct TGeneratePointCloudSE3Results
   {
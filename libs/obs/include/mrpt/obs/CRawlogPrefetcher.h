@@ -0,0 +1,114 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+#pragma once
+
+#include <mrpt/obs/CRawlog.h>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <tuple>
+
+namespace mrpt::obs
+{
+/** Asynchronous read-ahead for rawlog playback.
+ *
+ * Wraps an input CArchive and reads entries ahead of the consumer on a
+ * background thread, calling CObservation::load() on each of them so that
+ * externally-stored data (images, 3D scans, point clouds) are already in
+ * memory by the time the consumer touches them, instead of stalling its
+ * pipeline with synchronous disk reads on every frame.
+ *
+ * read() is a drop-in replacement for CRawlog::ReadFromArchive(): it returns
+ * entries in exactly the same order and format, blocking only if the reader
+ * thread has not gotten that far yet.
+ *
+ * Read-ahead is bounded both by a number of entries and by a byte budget,
+ * where the cost of an entry is the total size of its external files (see
+ * TParams). The budget accounts for prefetched entries not yet handed over
+ * to the consumer; what the consumer keeps alive afterwards is up to it.
+ *
+ * \note The wrapped archive must not be used elsewhere while this object is
+ * alive: the reader thread owns its read cursor.
+ *
+ * \sa CRawlog::ReadFromArchive, CObservation::load, CRawlogStreamReader
+ * \ingroup mrpt_obs_grp
+ */
+class CRawlogPrefetcher
+{
+ public:
+  struct TParams
+  {
+    /** Maximum number of entries read ahead of the consumer (default=10) */
+    size_t readAheadLength{10};
+    /** Maximum total size, in bytes, of the external files loaded for the
+     * entries read ahead of the consumer (default=256 MiB) */
+    uint64_t maxBytesAhead{256 * 1024 * 1024UL};
+  };
+
+  /** Starts the reader thread on the given opened rawlog archive. */
+  CRawlogPrefetcher(mrpt::serialization::CArchive& archive, const TParams& params);
+  /** \overload with default parameters. */
+  explicit CRawlogPrefetcher(mrpt::serialization::CArchive& archive) :
+      CRawlogPrefetcher(archive, TParams())
+  {
+  }
+
+  /** Stops and joins the reader thread. */
+  ~CRawlogPrefetcher();
+
+  CRawlogPrefetcher(const CRawlogPrefetcher&) = delete;
+  CRawlogPrefetcher& operator=(const CRawlogPrefetcher&) = delete;
+
+  /** Returns the next rawlog entry, as CRawlog::ReadFromArchive() would:
+   * the tuple [readOk, rawlogEntryIndex, action, sf, obs], with readOk=false
+   * on EOF or error. Blocks while the read-ahead queue is empty. */
+  std::tuple<bool, size_t, CActionCollection::Ptr, CSensoryFrame::Ptr, CObservation::Ptr> read();
+
+  /** Number of entries currently read ahead of the consumer. */
+  size_t queuedEntries() const;
+
+  /** Total external-file bytes of the entries currently read ahead. */
+  uint64_t queuedBytes() const;
+
+ private:
+  struct TEntry
+  {
+    bool readOk{false};
+    size_t index{0};
+    CActionCollection::Ptr action;
+    CSensoryFrame::Ptr sf;
+    CObservation::Ptr obs;
+    /** External-file bytes loaded for this entry (approximate). */
+    uint64_t approxBytes{0};
+  };
+
+  void workerLoop();
+
+  /** Total size of the external files of an observation, for the classes
+   * with externally-storable fields; 0 for the rest. */
+  static uint64_t approxExternalBytes(const CObservation& obs);
+
+  mrpt::serialization::CArchive& m_archive;
+  const TParams m_params;
+
+  mutable std::mutex m_mtx;
+  std::condition_variable m_cvProduced, m_cvConsumed;
+  std::deque<TEntry> m_queue;
+  uint64_t m_queuedBytes{0};
+  size_t m_entryCounter{0};
+  bool m_eof{false};
+  bool m_stop{false};
+
+  std::thread m_thread;
+
+};  // End of class def.
+
+}  // namespace mrpt::obs
@@ -0,0 +1,155 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+#pragma once
+
+#include <mrpt/io/CFileInputStream.h>
+#include <mrpt/obs/CRawlog.h>
+
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace mrpt::obs
+{
+/** A constant-memory, index-backed view of a rawlog file on disk.
+ *
+ * Unlike CRawlog::loadFromRawLogFile(), which deserializes the whole dataset
+ * into memory, this class keeps only a per-entry index (byte offset,
+ * timestamp, class name and entry type) plus an LRU window of deserialized
+ * objects, seeking and reading entries on demand. This allows inspecting
+ * datasets of arbitrary size with a small, bounded memory footprint.
+ *
+ * The index is built with a single sequential pass the first time a file is
+ * opened, and saved next to it as `<file>.idx` so subsequent opens are
+ * instantaneous. A stale index (e.g. after the rawlog file changed size) is
+ * detected and rebuilt automatically.
+ *
+ * \note Random access requires a plain (non gz-compressed) rawlog file;
+ * open() throws for compressed inputs, which should be decompressed first
+ * (e.g. with `gunzip`).
+ *
+ * \sa CRawlog, [Dataset file format](robotics_file_formats.html#datasets).
+ * \ingroup mrpt_obs_grp
+ */
+class CRawlogStreamReader
+{
+ public:
+  /** The index data kept for each entry in the rawlog file. */
+  struct TEntryIndex
+  {
+    /** Byte offset of the entry within the rawlog file. */
+    uint64_t offset{0};
+    /** The entry timestamp: for sensory frames and action collections, that
+     * of their first element. INVALID_TIMESTAMP if not applicable. */
+    mrpt::system::TTimeStamp timestamp{INVALID_TIMESTAMP};
+    /** The runtime class name of the entry, e.g. "CObservation2DRangeScan" */
+    std::string className;
+    /** The sensor label: for sensory frames, that of their first
+     * observation. Empty if not applicable. */
+    std::string sensorLabel;
+    /** The entry type, as in CRawlog::getType() */
+    CRawlog::TEntryType type{CRawlog::etOther};
+  };
+
+  CRawlogStreamReader() = default;
+  /** \sa open() */
+  explicit CRawlogStreamReader(const std::string& fileName, size_t cacheWindowSize = 100);
+  ~CRawlogStreamReader() = default;
+
+  /** Opens a rawlog file for streamed access, loading its entry index from
+   * the side-car `<file>.idx` file, or building (and saving) it with one
+   * sequential pass if missing or stale.
+   * \return false if the file could not be opened.
+   * \exception std::exception If the file is gz-compressed (see class docs).
+   */
+  bool open(const std::string& fileName);
+
+  /** Closes the file and frees the index and the cache window. */
+  void close();
+
+  bool isOpen() const { return m_file.fileOpenCorrectly(); }
+
+  /** Returns the number of entries in the rawlog file. */
+  size_t size() const { return m_index.size(); }
+  bool empty() const { return m_index.empty(); }
+
+  /** Returns the type of the given entry, without deserializing it.
+   * \exception std::exception If index is out of bounds
+   */
+  CRawlog::TEntryType getType(size_t index) const;
+
+  /** Direct access to the index data of the given entry (offset, timestamp,
+   * class name), without deserializing it.
+   * \exception std::exception If index is out of bounds
+   */
+  const TEntryIndex& entry(size_t index) const;
+
+  /** Returns the i'th entry, deserializing it from the file unless it is
+   * already in the cache window.
+   * \exception std::exception If index is out of bounds
+   */
+  mrpt::serialization::CSerializable::Ptr getAsGeneric(size_t index) const;
+
+  /** Like CRawlog::getAsObservation(), reading the entry on demand.
+   * \exception std::exception If index is out of bounds or of another type
+   */
+  CObservation::Ptr getAsObservation(size_t index) const;
+
+  /** Like CRawlog::getAsAction(), reading the entry on demand.
+   * \exception std::exception If index is out of bounds or of another type
+   */
+  CActionCollection::Ptr getAsAction(size_t index) const;
+
+  /** Like CRawlog::getAsObservations(), reading the entry on demand.
+   * \exception std::exception If index is out of bounds or of another type
+   */
+  CSensoryFrame::Ptr getAsObservations(size_t index) const;
+
+  /** Returns the block of comment text of the rawlog, if any (read on
+   * demand from the first CObservationComment entry in the file). */
+  std::string getCommentText() const;
+
+  /** Maximum number of deserialized entries kept in memory (default=100).
+   * Shrinking it evicts the least-recently-used entries immediately. */
+  void setCacheWindowSize(size_t n);
+  size_t cacheWindowSize() const { return m_cacheWindowSize; }
+
+  /** Number of entries currently held in the cache window. */
+  size_t cachedEntriesCount() const { return m_cache.size(); }
+
+  /** The name of the side-car index file for a given rawlog file name:
+   * `<file>.idx` */
+  static std::string indexFileNameFor(const std::string& rawlogFileName);
+
+ private:
+  void buildIndex();
+  bool loadIndexFile();
+  void saveIndexFile() const;
+  /** Evicts LRU entries until the cache fits the window size. */
+  void enforceCacheLimit() const;
+
+  std::string m_fileName;
+  /** File kept open for on-demand seeks from const accessors. */
+  mutable mrpt::io::CFileInputStream m_file;
+  std::vector<TEntryIndex> m_index;
+
+  size_t m_cacheWindowSize{100};
+  /** Cached entry indices, most-recently-used first. */
+  mutable std::list<size_t> m_lru;
+  struct CachedEntry
+  {
+    mrpt::serialization::CSerializable::Ptr obj;
+    std::list<size_t>::iterator lruIt;
+  };
+  mutable std::map<size_t, CachedEntry> m_cache;
+
+};  // End of class def.
+
+}  // namespace mrpt::obs
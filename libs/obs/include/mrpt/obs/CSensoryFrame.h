@@ -124,6 +124,27 @@ class CSensoryFrame : public mrpt::serialization::CSerializable
     return insertObservationsInto(*theMap, robotPose);
   }
 
+  /** Parallel variant of insertObservationsInto(): if the target map declares
+   * thread-safe insertion (CMetricMap::insertionIsThreadSafe(), e.g. a
+   * mrpt::maps::CMultiMetricMap with enableParallelInsertion() active), the
+   * insertObservationInto() calls for all contained observations are
+   * dispatched onto a worker pool and joined, so a frame bundling several
+   * LiDARs and depth cameras overlaps their expensive inserts. For maps
+   * without thread-safe insertion this method falls back to the serial
+   * insertObservationsInto() and behaves identically.
+   *
+   * \param numThreads Number of worker threads; `0` means one per contained
+   *        observation (capped to std::thread::hardware_concurrency()).
+   *
+   * \note In the parallel path the relative order in which the observations
+   * reach the map is unspecified.
+   * \note [New in MRPT 2.14.5]
+   */
+  bool insertObservationsIntoParallel(
+      mrpt::maps::CMetricMap& theMap,
+      const std::optional<const mrpt::poses::CPose3D>& robotPose = std::nullopt,
+      size_t numThreads = 0) const;
+
   /** You can use "sf1+=sf2;" to add all observations in sf2 to sf1.
    */
   void operator+=(const CSensoryFrame& sf);
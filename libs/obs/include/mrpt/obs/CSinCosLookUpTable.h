@@ -0,0 +1,80 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+#pragma once
+
+#include <mrpt/core/aligned_std_vector.h>
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <tuple>
+
+namespace mrpt::obs
+{
+/** A generalized, thread-safe cache of sin/cos tables over uniform angular
+ * grids, shared across observation types: 2D scans, Velodyne azimuth
+ * decoding, spherical range-image projection, etc.
+ *
+ * Unlike CSinCosLookUpTableFor2DScans, entries are keyed on an arbitrary
+ * (first angle, angular step, count) grid rather than on 2D-scan properties,
+ * and the values are stored as interleaved consecutive (cos, sin) pairs, so
+ * rotation kernels can fetch both terms of each ray with one 8-byte load and
+ * feed them straight into fused multiply-adds.
+ *
+ * \note [New in MRPT 2.14.5]
+ * \sa CSinCosLookUpTableFor2DScans
+ * \ingroup mrpt_obs_grp
+ */
+class CSinCosLookUpTable
+{
+ public:
+  CSinCosLookUpTable() = default;
+  /** Do NOT copy neither the cache nor the mutex */
+  CSinCosLookUpTable(const CSinCosLookUpTable&) {}
+  CSinCosLookUpTable& operator=(const CSinCosLookUpTable&) { return *this; }
+
+  /** A uniform angular grid: `angle_i = firstAngle + i * angleStep`, for `i`
+   * in `[0, count)`. This is the cache key, so e.g. each (sensor model,
+   * angular resolution) pair maps to its own table. */
+  struct TAngularGrid
+  {
+    double firstAngle = 0;
+    double angleStep = 0;
+    size_t count = 0;
+
+    bool operator<(const TAngularGrid& o) const
+    {
+      return std::tie(firstAngle, angleStep, count) < std::tie(o.firstAngle, o.angleStep, o.count);
+    }
+  };
+
+  /** The interleaved table: `cs[2*i]` is the cosine and `cs[2*i+1]` the sine
+   * of the i-th grid angle. */
+  struct TSinCosValues
+  {
+    mrpt::aligned_std_vector<float> cs;
+
+    float ccos(size_t i) const { return cs[2 * i]; }
+    float csin(size_t i) const { return cs[2 * i + 1]; }
+    /** Pointer to the (cos,sin) pair of the i-th angle, for SIMD loads */
+    const float* pair(size_t i) const { return &cs[2 * i]; }
+  };
+
+  /** Returns the (cos,sin) table for the given angular grid, computing it
+   * only the first time and returning a cached copy afterwards. The returned
+   * reference remains valid while this object exists. */
+  const TSinCosValues& getSinCos(const TAngularGrid& grid) const;
+
+ private:
+  /** The cache of known grids and their sin/cos tables. */
+  mutable std::map<TAngularGrid, TSinCosValues> m_cache;
+  mutable std::recursive_mutex m_cache_mtx;
+};
+
+}  // namespace mrpt::obs
@@ -23,6 +23,7 @@ class CObservation2DRangeScan;
  *  Refer to the main method CSinCosLookUpTableFor2DScans::getSinCosForScan()
  *
  *  This class is used in mrpt::maps::CPointsMap
+ * \sa CSinCosLookUpTable for a generalized (non 2D-scan) angular grid cache
  * \ingroup mrpt_obs_grp
  */
 class CSinCosLookUpTableFor2DScans
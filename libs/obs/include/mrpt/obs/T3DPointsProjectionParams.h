@@ -31,9 +31,15 @@ struct T3DPointsProjectionParams
   /** (Default: none) Read takeIntoAccountSensorPoseOnRobot */
   std::optional<mrpt::poses::CPose3D> robotPoseInTheWorld = std::nullopt;
 
-  /** (Default:true) If possible, use SSE2 optimized code. */
+  /** (Default:true) If possible, use SIMD (SSE2/AVX2) optimized code. */
   bool USE_SSE2 = true;
 
+  /** (Default:1) Number of parallel threads to unproject rows of the range
+   * image with. 0 means use all CPU cores; 1 disables threading.
+   * Only used for decimation=1.
+   * \note (New in MRPT 2.14.5) */
+  unsigned int numThreads = 1;
+
   /** (Default:false) set to true if you want an organized point cloud */
   bool MAKE_ORGANIZED = false;
 
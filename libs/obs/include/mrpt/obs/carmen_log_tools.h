@@ -12,6 +12,8 @@
 #include <mrpt/obs/CObservation.h>
 #include <mrpt/system/datetime.h>
 
+#include <functional>
+
 namespace mrpt::obs
 {
 /** Parse one line from an text input stream and interpret it as a CARMEN log
@@ -63,4 +65,40 @@ bool carmen_log_parse_line(
     std::vector<mrpt::obs::CObservation::Ptr>& out_imported_observations,
     const mrpt::system::TTimeStamp& time_start_log);
 
+/** Options for carmen_log_import() \note [New in MRPT 2.14.5] */
+struct TCarmenLogImportOptions
+{
+  /** 0 (default): use all hardware threads; >=1: use that many parsing
+   * threads (1 = sequential). */
+  unsigned int numberOfThreads = 0;
+};
+
+/** Imports a whole CARMEN log file at once, parsing lines in parallel.
+ *
+ *  The file is loaded into memory, split on line boundaries into one
+ * contiguous chunk per worker thread, and each line is parsed with an
+ * allocation-free tokenizer (no std::istringstream) into the same
+ * observations carmen_log_parse_line() would produce. PARAM entries are
+ * pre-scanned sequentially so each chunk starts from the laser parameters in
+ * effect at its first line, preserving the sequential semantics.
+ *
+ *  `onParsedLine` is invoked from the calling thread, in original line
+ * order, once per non-empty log line: `lineIndex` is the 0-based index among
+ * non-empty lines, `lineCount` the total number of them, and `obs` the
+ * observations imported from that line (empty for PARAM or unrecognized
+ * entries; the callback may freely modify or move them out).
+ *
+ * \exception std::exception On I/O errors or any invalid line found.
+ * \sa carmen_log_parse_line
+ * \note [New in MRPT 2.14.5]
+ * \ingroup mrpt_obs_grp
+ */
+void carmen_log_import(
+    const std::string& logFileName,
+    const std::function<void(
+        size_t lineIndex, size_t lineCount, std::vector<mrpt::obs::CObservation::Ptr>& obs)>&
+        onParsedLine,
+    const mrpt::system::TTimeStamp& time_start_log,
+    const TCarmenLogImportOptions& options = {});
+
 }  // namespace mrpt::obs
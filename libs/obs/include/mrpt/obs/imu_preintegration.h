@@ -0,0 +1,94 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+#pragma once
+
+#include <mrpt/math/CMatrixFixed.h>
+#include <mrpt/math/TPoint3D.h>
+#include <mrpt/obs/CObservationIMUBatch.h>
+#include <mrpt/poses/CPose3D.h>
+
+#include <vector>
+
+namespace mrpt::obs
+{
+/** \addtogroup mrpt_obs_grp
+ * @{ */
+
+/** Parameters for imu_preintegrate()
+ * \note [New in MRPT 2.14.5] */
+struct TIMUPreintegrationParams
+{
+  /** Gyroscope bias, subtracted from every angular velocity (rad/s) */
+  mrpt::math::TVector3D gyroBias = {0, 0, 0};
+  /** Accelerometer bias, subtracted from every acceleration (m/s^2) */
+  mrpt::math::TVector3D accelBias = {0, 0, 0};
+};
+
+/** Output of imu_preintegrate(): the gravity-free relative motion increment
+ * accumulated over one sample block, expressed in the body frame of the
+ * first sample (the standard on-manifold preintegration deltas).
+ * \note [New in MRPT 2.14.5] */
+struct TIMUPreintegrationResult
+{
+  /** Accumulated rotation increment \f$ \Delta R \f$ */
+  mrpt::math::CMatrixDouble33 deltaR = mrpt::math::CMatrixDouble33::Identity();
+  /** Accumulated velocity increment \f$ \Delta v \f$ (m/s), gravity-free */
+  mrpt::math::TVector3D deltaV = {0, 0, 0};
+  /** Accumulated position increment \f$ \Delta p \f$ (m), gravity-free */
+  mrpt::math::TVector3D deltaP = {0, 0, 0};
+  /** Integrated time span (s) */
+  double deltaT = 0;
+
+  /** If requested via imu_preintegrate(), the rotation increment at the time
+   * of each sample ([0]=Identity, one entry per sample), for interpolating
+   * the body attitude inside the block, e.g. to de-skew a LiDAR sweep. */
+  std::vector<mrpt::math::CMatrixDouble33> sampleRotations;
+
+  /** Composes this increment onto an initial state, applying gravity, and
+   * returns the predicted pose and velocity at the end of the block.
+   * \param[in] pose0 Body pose at the first sample (navigation frame)
+   * \param[in] vel0 Body velocity at the first sample (navigation frame, m/s)
+   * \param[in] gravity Gravity vector in the navigation frame (m/s^2),
+   *            typically (0,0,-9.81)
+   * \param[out] pose1 Predicted pose at the last sample
+   * \param[out] vel1 Predicted velocity at the last sample
+   */
+  void predict(
+      const mrpt::poses::CPose3D& pose0, const mrpt::math::TVector3D& vel0,
+      const mrpt::math::TVector3D& gravity, mrpt::poses::CPose3D& pose1,
+      mrpt::math::TVector3D& vel1) const;
+};
+
+/** Integrates a whole block of IMU samples into one relative motion increment
+ * (delta rotation, velocity and position), without creating any per-sample
+ * objects: the batch SoA layout is swept in tight contiguous loops.
+ *
+ *  Samples are integrated with forward Euler over each inter-sample interval
+ * and rotations composed through the SO(3) exponential map. The resulting
+ * deltas are independent of the initial state and of gravity, so they can be
+ * reused across relinearizations in a factor-graph frontend; use
+ * TIMUPreintegrationResult::predict() to apply them to a concrete state.
+ *
+ * \param batch The IMU sample block to integrate (needs >= 2 samples for a
+ *        non-trivial result).
+ * \param params Biases to subtract from the raw measurements.
+ * \param keepPerSampleRotations If true, the per-sample rotation increments
+ *        are kept in TIMUPreintegrationResult::sampleRotations (for LiDAR
+ *        de-skewing).
+ *
+ * \sa CObservationIMUBatch
+ * \note [New in MRPT 2.14.5]
+ */
+TIMUPreintegrationResult imu_preintegrate(
+    const CObservationIMUBatch& batch, const TIMUPreintegrationParams& params = {},
+    bool keepPerSampleRotations = false);
+
+/** @} */
+
+}  // namespace mrpt::obs
@@ -29,6 +29,7 @@ class CObservationComment;
 class CObservationGPS;
 class CObservationGasSensors;
 class CObservationIMU;
+class CObservationIMUBatch;
 class CObservationImage;
 class CObservationOdometry;
 class CObservationRFID;
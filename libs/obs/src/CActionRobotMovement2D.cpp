@@ -466,29 +466,33 @@ void CActionRobotMovement2D::computeFromOdometry_modelThrun(
   double Atrans = odometryIncrement.norm();
   double Arot2 = math::wrapToPi(odometryIncrement.phi() - Arot1);
 
-  // Draw samples:
-  for (size_t i = 0; i < o.thrunModel.nParticlesCount; i++)
+  // The noise std. devs are the same for all particles:
+  const double stdRot1 =
+      o.thrunModel.alfa1_rot_rot * fabs(Arot1) + o.thrunModel.alfa2_rot_trans * Atrans;
+  const double stdTrans = o.thrunModel.alfa3_trans_trans * Atrans +
+                          o.thrunModel.alfa4_trans_rot * (fabs(Arot1) + fabs(Arot2));
+  const double stdRot2 =
+      o.thrunModel.alfa1_rot_rot * fabs(Arot2) + o.thrunModel.alfa2_rot_trans * Atrans;
+
+  // Draw samples: all 6 variates per particle come from one batched RNG fill,
+  // leaving a single fused loop of arithmetic per particle.
+  const size_t N = o.thrunModel.nParticlesCount;
+  std::vector<double> rnd(6 * N);
+  getRandomGenerator().drawGaussian1DFill(rnd.data(), rnd.size());
+
+  const double* r = rnd.data();
+  for (size_t i = 0; i < N; i++, r += 6)
   {
-    double Arot1_draw =
-        Arot1 - (o.thrunModel.alfa1_rot_rot * fabs(Arot1) + o.thrunModel.alfa2_rot_trans * Atrans) *
-                    getRandomGenerator().drawGaussian1D_normalized();
-    double Atrans_draw = Atrans - (o.thrunModel.alfa3_trans_trans * Atrans +
-                                   o.thrunModel.alfa4_trans_rot * (fabs(Arot1) + fabs(Arot2))) *
-                                      getRandomGenerator().drawGaussian1D_normalized();
-    double Arot2_draw =
-        Arot2 - (o.thrunModel.alfa1_rot_rot * fabs(Arot2) + o.thrunModel.alfa2_rot_trans * Atrans) *
-                    getRandomGenerator().drawGaussian1D_normalized();
+    const double Arot1_draw = Arot1 - stdRot1 * r[0];
+    const double Atrans_draw = Atrans - stdTrans * r[1];
+    const double Arot2_draw = Arot2 - stdRot2 * r[2];
 
     // Output:
     aux->m_particles[i].d.x =
-        Atrans_draw * cos(Arot1_draw) + motionModelConfiguration.thrunModel.additional_std_XY *
-                                            getRandomGenerator().drawGaussian1D_normalized();
+        Atrans_draw * cos(Arot1_draw) + o.thrunModel.additional_std_XY * r[3];
     aux->m_particles[i].d.y =
-        Atrans_draw * sin(Arot1_draw) + motionModelConfiguration.thrunModel.additional_std_XY *
-                                            getRandomGenerator().drawGaussian1D_normalized();
-    aux->m_particles[i].d.phi = Arot1_draw + Arot2_draw +
-                                motionModelConfiguration.thrunModel.additional_std_phi *
-                                    getRandomGenerator().drawGaussian1D_normalized();
+        Atrans_draw * sin(Arot1_draw) + o.thrunModel.additional_std_XY * r[4];
+    aux->m_particles[i].d.phi = Arot1_draw + Arot2_draw + o.thrunModel.additional_std_phi * r[5];
     aux->m_particles[i].d.normalizePhi();
   }
 }
@@ -568,6 +572,99 @@ void CActionRobotMovement2D::drawSingleSample_modelThrun(CPose2D& outSample) con
   outSample.normalizePhi();
 }
 
+/*---------------------------------------------------------------
+        drawSamples
+  ---------------------------------------------------------------*/
+void CActionRobotMovement2D::drawSamples(size_t N, std::vector<CPose2D>& outSamples) const
+{
+  outSamples.resize(N);
+  if (!N) return;
+
+  // Only in the case of "emOdometry" we have the rawOdometryMeasurement and
+  //  the parameters to draw new samples:
+  if (estimationMethod == emOdometry)
+  {
+    if (motionModelConfiguration.modelSelection == mmGaussian)
+      drawSamples_modelGaussian(N, outSamples);
+    else
+      drawSamples_modelThrun(N, outSamples);
+  }
+  else
+  {
+    // If is not odometry, just employ the stored distribution:
+    for (auto& s : outSamples) poseChange->drawSingleSample(s);
+  }
+}
+
+/*---------------------------------------------------------------
+        drawSamples_modelGaussian
+  ---------------------------------------------------------------*/
+void CActionRobotMovement2D::drawSamples_modelGaussian(
+    size_t N, std::vector<CPose2D>& outSamples) const
+{
+  // Reuse the eigendecomposition cache of the "fastDraw" API, then all N
+  // samples are just mean + Z * (3 batched normalized variates):
+  prepareFastDrawSingleSample_modelGaussian();
+
+  std::vector<double> rnd(3 * N);
+  getRandomGenerator().drawGaussian1DFill(rnd.data(), rnd.size());
+
+  const double mx = m_fastDrawGauss_M.x(), my = m_fastDrawGauss_M.y(),
+               mphi = m_fastDrawGauss_M.phi();
+  const double* r = rnd.data();
+  for (size_t i = 0; i < N; i++, r += 3)
+  {
+    outSamples[i] = CPose2D(
+        mx + m_fastDrawGauss_Z(0, 0) * r[0] + m_fastDrawGauss_Z(0, 1) * r[1] +
+            m_fastDrawGauss_Z(0, 2) * r[2],
+        my + m_fastDrawGauss_Z(1, 0) * r[0] + m_fastDrawGauss_Z(1, 1) * r[1] +
+            m_fastDrawGauss_Z(1, 2) * r[2],
+        mphi + m_fastDrawGauss_Z(2, 0) * r[0] + m_fastDrawGauss_Z(2, 1) * r[1] +
+            m_fastDrawGauss_Z(2, 2) * r[2]);
+  }
+}
+
+/*---------------------------------------------------------------
+        drawSamples_modelThrun
+  ---------------------------------------------------------------*/
+void CActionRobotMovement2D::drawSamples_modelThrun(
+    size_t N, std::vector<CPose2D>& outSamples) const
+{
+  // Same model as drawSingleSample_modelThrun(), with the per-sample noise
+  // std. devs hoisted out and all 6N variates drawn in one batched fill:
+  const auto& tm = motionModelConfiguration.thrunModel;
+
+  // The increments in odometry:
+  const double Arot1 =
+      (rawOdometryIncrementReading.y() != 0 || rawOdometryIncrementReading.x() != 0)
+          ? atan2(rawOdometryIncrementReading.y(), rawOdometryIncrementReading.x())
+          : 0;
+  const double Atrans = rawOdometryIncrementReading.norm();
+  const double Arot2 = math::wrapToPi(rawOdometryIncrementReading.phi() - Arot1);
+
+  const double stdRot1 = tm.alfa1_rot_rot * fabs(Arot1) + tm.alfa2_rot_trans * Atrans;
+  const double stdTrans =
+      tm.alfa3_trans_trans * Atrans + tm.alfa4_trans_rot * (fabs(Arot1) + fabs(Arot2));
+  const double stdRot2 = tm.alfa1_rot_rot * fabs(Arot2) + tm.alfa2_rot_trans * Atrans;
+
+  std::vector<double> rnd(6 * N);
+  getRandomGenerator().drawGaussian1DFill(rnd.data(), rnd.size());
+
+  const double* r = rnd.data();
+  for (size_t i = 0; i < N; i++, r += 6)
+  {
+    const double Arot1_draw = Arot1 - stdRot1 * r[0];
+    const double Atrans_draw = Atrans - stdTrans * r[1];
+    const double Arot2_draw = Arot2 - stdRot2 * r[2];
+
+    outSamples[i] = CPose2D(
+        Atrans_draw * cos(Arot1_draw) + tm.additional_std_XY * r[3],
+        Atrans_draw * sin(Arot1_draw) + tm.additional_std_XY * r[4],
+        Arot1_draw + Arot2_draw + tm.additional_std_phi * r[5]);
+    outSamples[i].normalizePhi();
+  }
+}
+
 /*---------------------------------------------------------------
         prepareFastDrawSingleSamples
   ---------------------------------------------------------------*/
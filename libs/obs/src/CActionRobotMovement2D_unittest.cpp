@@ -0,0 +1,93 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/math/wrap2pi.h>
+#include <mrpt/obs/CActionRobotMovement2D.h>
+#include <mrpt/random.h>
+
+using namespace mrpt::obs;
+using namespace mrpt::poses;
+
+static CActionRobotMovement2D makeAction(CActionRobotMovement2D::TDrawSampleMotionModel model)
+{
+  CActionRobotMovement2D act;
+  CActionRobotMovement2D::TMotionModelOptions opts;
+  opts.modelSelection = model;
+  act.computeFromOdometry(CPose2D(0.50, 0.10, mrpt::DEG2RAD(20.0)), opts);
+  act.rawOdometryIncrementReading = CPose2D(0.50, 0.10, mrpt::DEG2RAD(20.0));
+  act.estimationMethod = CActionRobotMovement2D::emOdometry;
+  return act;
+}
+
+// The batched drawSamples() must produce samples distributed around the
+// odometry increment, for both motion models:
+TEST(CActionRobotMovement2D, drawSamplesBatch)
+{
+  mrpt::random::getRandomGenerator().randomize(333);
+
+  for (const auto model :
+       {CActionRobotMovement2D::mmGaussian, CActionRobotMovement2D::mmThrun})
+  {
+    const auto act = makeAction(model);
+
+    const size_t N = 20000;
+    std::vector<CPose2D> samples;
+    act.drawSamples(N, samples);
+    ASSERT_EQ(samples.size(), N);
+
+    double mx = 0, my = 0, mphi = 0;
+    for (const auto& s : samples)
+    {
+      mx += s.x();
+      my += s.y();
+      mphi += s.phi();
+      // Angles must come out normalized:
+      EXPECT_LE(std::abs(s.phi()), M_PI);
+    }
+    mx /= N;
+    my /= N;
+    mphi /= N;
+
+    EXPECT_NEAR(mx, 0.50, 0.02) << "model=" << model;
+    EXPECT_NEAR(my, 0.10, 0.02) << "model=" << model;
+    EXPECT_NEAR(mphi, mrpt::DEG2RAD(20.0), 0.02) << "model=" << model;
+  }
+
+  // N=0 must be valid and clear the output:
+  const auto act = makeAction(CActionRobotMovement2D::mmThrun);
+  std::vector<CPose2D> samples(3);
+  act.drawSamples(0, samples);
+  EXPECT_TRUE(samples.empty());
+}
+
+// Batched and per-sample draws must follow the same distribution (compare
+// their scatter around the mean):
+TEST(CActionRobotMovement2D, drawSamplesMatchesSingle)
+{
+  mrpt::random::getRandomGenerator().randomize(42);
+  const auto act = makeAction(CActionRobotMovement2D::mmThrun);
+
+  const size_t N = 20000;
+  std::vector<CPose2D> batch;
+  act.drawSamples(N, batch);
+
+  double varBatch = 0, varSingle = 0;
+  for (const auto& s : batch) varBatch += mrpt::square(s.x() - 0.50);
+  for (size_t i = 0; i < N; i++)
+  {
+    CPose2D s;
+    act.drawSingleSample(s);
+    varSingle += mrpt::square(s.x() - 0.50);
+  }
+  varBatch /= N;
+  varSingle /= N;
+
+  EXPECT_NEAR(varBatch, varSingle, 0.2 * std::max(varBatch, varSingle));
+}
@@ -228,6 +228,35 @@ TEST(CObservation3DRangeScan, Project3D_filterMax)
   }
 }
 
+TEST(CObservation3DRangeScan, Project3D_threaded)
+{
+  mrpt::obs::T3DPointsProjectionParams pp;
+  mrpt::obs::TRangeImageFilterParams fp;
+
+  for (int i = 0; i < 4; i++)  // test all combinations of flags
+  {
+    mrpt::obs::CObservation3DRangeScan o1, o2;
+    fillSampleObs(o1, pp, i);
+    fillSampleObs(o2, pp, i);
+
+    pp.numThreads = 1;
+    o1.unprojectInto(o1, pp, fp);
+    pp.numThreads = 4;
+    o2.unprojectInto(o2, pp, fp);
+    pp.numThreads = 1;
+
+    // Multi-threaded unprojection must be bit-identical to sequential:
+    ASSERT_EQ(o1.points3D_x.size(), o2.points3D_x.size());
+    EXPECT_EQ(o1.points3D_x.size(), 21U) << " testcase flags: i=" << i << std::endl;
+    for (size_t k = 0; k < o1.points3D_x.size(); k++)
+    {
+      EXPECT_EQ(o1.points3D_x[k], o2.points3D_x[k]);
+      EXPECT_EQ(o1.points3D_y[k], o2.points3D_y[k]);
+      EXPECT_EQ(o1.points3D_z[k], o2.points3D_z[k]);
+    }
+  }
+}
+
 TEST(CObservation3DRangeScan, LoadAndCheckFloorPoints)
 {
   const string rawlog_fil = UNITTEST_BASEDIR() + string("/tests/test-3d-obs-ground.rawlog");
@@ -0,0 +1,111 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include "obs-precomp.h"  // Precompiled headers
+//
+#include <mrpt/config.h>
+
+#include "CObservation3DRangeScan_unproject_internal.h"
+
+#if MRPT_ARCH_INTEL_COMPATIBLE
+
+#include <immintrin.h>
+
+using namespace mrpt::obs;
+
+void detail::unproject_ranges_AVX2(
+    const uint16_t* ranges,
+    const float rangeUnits,
+    const float* kxs,
+    const float* kys,
+    const float* kzs,
+    const float* maskMin,
+    const float* maskMax,
+    const bool rangeCheckBetween,
+    const float tx,
+    const float ty,
+    const float tz,
+    const size_t n,
+    float* xs,
+    float* ys,
+    float* zs,
+    uint8_t* validMask)
+{
+  const __m256 zeros = _mm256_setzero_ps();
+  const __m256 ones = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+  const __m256 U = _mm256_set1_ps(rangeUnits);
+  const __m256 TX = _mm256_set1_ps(tx), TY = _mm256_set1_ps(ty), TZ = _mm256_set1_ps(tz);
+  // All-ones when the "between" check must be inverted:
+  const __m256 xormask = rangeCheckBetween ? zeros : ones;
+
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8)
+  {
+    // Fused u16 -> f32 range decode, with rangeUnits scaling:
+    const __m128i d16 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&ranges[i]));
+    const __m256 D = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(d16)), U);
+
+    const __m256 nz_mask = _mm256_cmp_ps(D, zeros, _CMP_GT_OQ);
+    __m256 valid_mask = nz_mask;
+    if (maskMin || maskMax)
+    {
+      if (!maskMax)
+      {
+        const __m256 Dmin = _mm256_loadu_ps(&maskMin[i]);
+        const __m256 gt_mask = _mm256_or_ps(
+            _mm256_cmp_ps(D, Dmin, _CMP_GE_OQ), _mm256_cmp_ps(Dmin, zeros, _CMP_EQ_OQ));
+        valid_mask = _mm256_and_ps(gt_mask, nz_mask);
+      }
+      else if (!maskMin)
+      {
+        const __m256 Dmax = _mm256_loadu_ps(&maskMax[i]);
+        const __m256 lt_mask = _mm256_or_ps(
+            _mm256_cmp_ps(D, Dmax, _CMP_LE_OQ), _mm256_cmp_ps(Dmax, zeros, _CMP_EQ_OQ));
+        valid_mask = _mm256_and_ps(lt_mask, nz_mask);
+      }
+      else
+      {
+        const __m256 Dmin = _mm256_loadu_ps(&maskMin[i]);
+        const __m256 Dmax = _mm256_loadu_ps(&maskMax[i]);
+        // A zero in a mask means "no filtering at this pixel" for that
+        // bound; the optional "rangeCheckBetween" inversion only applies
+        // to pixels where BOTH bounds are present:
+        const __m256 gt_mask = _mm256_or_ps(
+            _mm256_cmp_ps(D, Dmin, _CMP_GE_OQ), _mm256_cmp_ps(Dmin, zeros, _CMP_EQ_OQ));
+        const __m256 lt_mask = _mm256_or_ps(
+            _mm256_cmp_ps(D, Dmax, _CMP_LE_OQ), _mm256_cmp_ps(Dmax, zeros, _CMP_EQ_OQ));
+        const __m256 pass_both = _mm256_and_ps(gt_mask, lt_mask);
+        const __m256 has_both = _mm256_andnot_ps(
+            _mm256_or_ps(
+                _mm256_cmp_ps(Dmin, zeros, _CMP_EQ_OQ), _mm256_cmp_ps(Dmax, zeros, _CMP_EQ_OQ)),
+            ones);
+        valid_mask = _mm256_or_ps(
+            _mm256_and_ps(has_both, _mm256_xor_ps(pass_both, xormask)),
+            _mm256_andnot_ps(has_both, pass_both));
+        valid_mask = _mm256_and_ps(valid_mask, nz_mask);
+      }
+    }
+
+    const int vm = _mm256_movemask_ps(valid_mask);
+    for (int q = 0; q < 8; q++) validMask[i + q] = (vm >> q) & 1;
+
+    // K^-1 direction multiply + fused translation:
+    _mm256_storeu_ps(&xs[i], _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(&kxs[i]), D), TX));
+    _mm256_storeu_ps(&ys[i], _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(&kys[i]), D), TY));
+    _mm256_storeu_ps(&zs[i], _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(&kzs[i]), D), TZ));
+  }
+
+  // Tail:
+  detail::unproject_ranges_generic(
+      ranges + i, rangeUnits, kxs + i, kys + i, kzs + i, maskMin ? maskMin + i : nullptr,
+      maskMax ? maskMax + i : nullptr, rangeCheckBetween, tx, ty, tz, n - i, xs + i, ys + i,
+      zs + i, validMask + i);
+}
+
+#endif  // MRPT_ARCH_INTEL_COMPATIBLE
@@ -0,0 +1,110 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include "obs-precomp.h"  // Precompiled headers
+//
+#include <mrpt/config.h>
+
+#include "CObservation3DRangeScan_unproject_internal.h"
+
+#if MRPT_ARCH_INTEL_COMPATIBLE
+
+#include <mrpt/core/SSE_types.h>
+
+using namespace mrpt::obs;
+
+void detail::unproject_ranges_SSE2(
+    const uint16_t* ranges,
+    const float rangeUnits,
+    const float* kxs,
+    const float* kys,
+    const float* kzs,
+    const float* maskMin,
+    const float* maskMax,
+    const bool rangeCheckBetween,
+    const float tx,
+    const float ty,
+    const float tz,
+    const size_t n,
+    float* xs,
+    float* ys,
+    float* zs,
+    uint8_t* validMask)
+{
+  const __m128 zeros = _mm_setzero_ps();
+  const __m128 U = _mm_set1_ps(rangeUnits);
+  const __m128 TX = _mm_set1_ps(tx), TY = _mm_set1_ps(ty), TZ = _mm_set1_ps(tz);
+  // All-ones when the "between" check must be inverted:
+  const __m128 xormask =
+      rangeCheckBetween ? _mm_cmpneq_ps(zeros, zeros) : _mm_cmpeq_ps(zeros, zeros);
+
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+  {
+    // Fused u16 -> f32 range decode, with rangeUnits scaling:
+    const __m128i d16 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&ranges[i]));
+    const __m128i d32 = _mm_unpacklo_epi16(d16, _mm_setzero_si128());
+    const __m128 D = _mm_mul_ps(_mm_cvtepi32_ps(d32), U);
+
+    const __m128 nz_mask = _mm_cmpgt_ps(D, zeros);
+    __m128 valid_mask = nz_mask;
+    if (maskMin || maskMax)
+    {
+      if (!maskMax)
+      {
+        const __m128 Dmin = _mm_loadu_ps(&maskMin[i]);
+        const __m128 gt_mask = _mm_or_ps(_mm_cmpge_ps(D, Dmin), _mm_cmpeq_ps(Dmin, zeros));
+        valid_mask = _mm_and_ps(gt_mask, nz_mask);
+      }
+      else if (!maskMin)
+      {
+        const __m128 Dmax = _mm_loadu_ps(&maskMax[i]);
+        const __m128 lt_mask = _mm_or_ps(_mm_cmple_ps(D, Dmax), _mm_cmpeq_ps(Dmax, zeros));
+        valid_mask = _mm_and_ps(lt_mask, nz_mask);
+      }
+      else
+      {
+        const __m128 Dmin = _mm_loadu_ps(&maskMin[i]);
+        const __m128 Dmax = _mm_loadu_ps(&maskMax[i]);
+        // A zero in a mask means "no filtering at this pixel" for that
+        // bound; the optional "rangeCheckBetween" inversion only applies
+        // to pixels where BOTH bounds are present:
+        const __m128 gt_mask = _mm_or_ps(_mm_cmpge_ps(D, Dmin), _mm_cmpeq_ps(Dmin, zeros));
+        const __m128 lt_mask = _mm_or_ps(_mm_cmple_ps(D, Dmax), _mm_cmpeq_ps(Dmax, zeros));
+        const __m128 pass_both = _mm_and_ps(gt_mask, lt_mask);
+        const __m128 has_both = _mm_andnot_ps(
+            _mm_or_ps(_mm_cmpeq_ps(Dmin, zeros), _mm_cmpeq_ps(Dmax, zeros)),
+            _mm_cmpeq_ps(zeros, zeros));
+        valid_mask = _mm_or_ps(
+            _mm_and_ps(has_both, _mm_xor_ps(pass_both, xormask)),
+            _mm_andnot_ps(has_both, pass_both));
+        valid_mask = _mm_and_ps(valid_mask, nz_mask);
+      }
+    }
+
+    const int vm = _mm_movemask_ps(valid_mask);
+    validMask[i + 0] = (vm >> 0) & 1;
+    validMask[i + 1] = (vm >> 1) & 1;
+    validMask[i + 2] = (vm >> 2) & 1;
+    validMask[i + 3] = (vm >> 3) & 1;
+
+    // K^-1 direction multiply + fused translation:
+    _mm_storeu_ps(&xs[i], _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&kxs[i]), D), TX));
+    _mm_storeu_ps(&ys[i], _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&kys[i]), D), TY));
+    _mm_storeu_ps(&zs[i], _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&kzs[i]), D), TZ));
+  }
+
+  // Tail:
+  detail::unproject_ranges_generic(
+      ranges + i, rangeUnits, kxs + i, kys + i, kzs + i, maskMin ? maskMin + i : nullptr,
+      maskMax ? maskMax + i : nullptr, rangeCheckBetween, tx, ty, tz, n - i, xs + i, ys + i,
+      zs + i, validMask + i);
+}
+
+#endif  // MRPT_ARCH_INTEL_COMPATIBLE
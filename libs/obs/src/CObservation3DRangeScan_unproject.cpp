@@ -0,0 +1,109 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include "obs-precomp.h"  // Precompiled headers
+//
+#include <mrpt/core/cpu.h>
+#include <mrpt/obs/CObservation3DRangeScan.h>
+
+#include "CObservation3DRangeScan_unproject_internal.h"
+
+using namespace mrpt::obs;
+
+void detail::unproject_ranges_generic(
+    const uint16_t* ranges,
+    const float rangeUnits,
+    const float* kxs,
+    const float* kys,
+    const float* kzs,
+    const float* maskMin,
+    const float* maskMax,
+    const bool rangeCheckBetween,
+    const float tx,
+    const float ty,
+    const float tz,
+    const size_t n,
+    float* xs,
+    float* ys,
+    float* zs,
+    uint8_t* validMask)
+{
+  for (size_t i = 0; i < n; i++)
+  {
+    const float D = ranges[i] * rangeUnits;
+
+    // Same per-pixel logic than TRangeImageFilter::do_range_filter():
+    bool ok = D > .0f;
+    if (ok && (maskMin || maskMax))
+    {
+      bool pass_gt = true, pass_lt = true;
+      bool has_min_filter = false, has_max_filter = false;
+      if (maskMin && maskMin[i] != .0f)
+      {
+        has_min_filter = true;
+        pass_gt = (D >= maskMin[i]);
+      }
+      if (maskMax && maskMax[i] != .0f)
+      {
+        has_max_filter = true;
+        pass_lt = (D <= maskMax[i]);
+      }
+      if (has_min_filter && has_max_filter)
+        ok = rangeCheckBetween ? (pass_gt && pass_lt) : !(pass_gt && pass_lt);
+      else
+        ok = pass_gt && pass_lt;
+    }
+    validMask[i] = ok ? 1 : 0;
+
+    // Unconditional (branch-free) write; invalid entries are just never
+    // read back by the caller:
+    xs[i] = kxs[i] * D + tx;
+    ys[i] = kys[i] * D + ty;
+    zs[i] = kzs[i] * D + tz;
+  }
+}
+
+void detail::unproject_ranges(
+    const uint16_t* ranges,
+    const float rangeUnits,
+    const float* kxs,
+    const float* kys,
+    const float* kzs,
+    const float* maskMin,
+    const float* maskMax,
+    const bool rangeCheckBetween,
+    const float tx,
+    const float ty,
+    const float tz,
+    const size_t n,
+    float* xs,
+    float* ys,
+    float* zs,
+    uint8_t* validMask)
+{
+#if MRPT_ARCH_INTEL_COMPATIBLE
+  if (mrpt::cpu::supports(mrpt::cpu::feature::AVX2))
+  {
+    detail::unproject_ranges_AVX2(
+        ranges, rangeUnits, kxs, kys, kzs, maskMin, maskMax, rangeCheckBetween, tx, ty, tz, n, xs,
+        ys, zs, validMask);
+    return;
+  }
+  if (mrpt::cpu::supports(mrpt::cpu::feature::SSE2))
+  {
+    detail::unproject_ranges_SSE2(
+        ranges, rangeUnits, kxs, kys, kzs, maskMin, maskMax, rangeCheckBetween, tx, ty, tz, n, xs,
+        ys, zs, validMask);
+    return;
+  }
+#endif
+  detail::unproject_ranges_generic(
+      ranges, rangeUnits, kxs, kys, kzs, maskMin, maskMax, rangeCheckBetween, tx, ty, tz, n, xs,
+      ys, zs, validMask);
+}
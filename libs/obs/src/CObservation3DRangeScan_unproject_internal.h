@@ -0,0 +1,82 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#pragma once
+
+#include <mrpt/config.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace mrpt::obs::detail
+{
+/** Plain scalar version of unproject_ranges(), used as fallback and for the
+ * tail of the vectorized loops. This is the reference implementation of the
+ * filter semantics: it must behave exactly like
+ * TRangeImageFilter::do_range_filter() on each pixel.
+ */
+void unproject_ranges_generic(
+    const uint16_t* ranges,
+    float rangeUnits,
+    const float* kxs,
+    const float* kys,
+    const float* kzs,
+    const float* maskMin,
+    const float* maskMax,
+    bool rangeCheckBetween,
+    float tx,
+    float ty,
+    float tz,
+    size_t n,
+    float* xs,
+    float* ys,
+    float* zs,
+    uint8_t* validMask);
+
+#if MRPT_ARCH_INTEL_COMPATIBLE
+/// SSE2 version of unproject_ranges_generic(): 4-wide inner loop.
+void unproject_ranges_SSE2(
+    const uint16_t* ranges,
+    float rangeUnits,
+    const float* kxs,
+    const float* kys,
+    const float* kzs,
+    const float* maskMin,
+    const float* maskMax,
+    bool rangeCheckBetween,
+    float tx,
+    float ty,
+    float tz,
+    size_t n,
+    float* xs,
+    float* ys,
+    float* zs,
+    uint8_t* validMask);
+
+/// AVX2 version of unproject_ranges_generic(): 8-wide inner loop.
+void unproject_ranges_AVX2(
+    const uint16_t* ranges,
+    float rangeUnits,
+    const float* kxs,
+    const float* kys,
+    const float* kzs,
+    const float* maskMin,
+    const float* maskMax,
+    bool rangeCheckBetween,
+    float tx,
+    float ty,
+    float tz,
+    size_t n,
+    float* xs,
+    float* ys,
+    float* zs,
+    uint8_t* validMask);
+#endif
+
+}  // namespace mrpt::obs::detail
@@ -0,0 +1,105 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include "obs-precomp.h"  // Precompiled headers
+//
+#include <mrpt/obs/CObservationIMUBatch.h>
+#include <mrpt/serialization/CArchive.h>
+
+using namespace mrpt::obs;
+
+// This must be added to any CSerializable class implementation file.
+IMPLEMENTS_SERIALIZABLE(CObservationIMUBatch, CObservation, mrpt::obs)
+
+// Samples are (de)serialized as raw double blocks:
+static_assert(sizeof(mrpt::math::TVector3D) == 3 * sizeof(double));
+
+void CObservationIMUBatch::reserve(size_t n)
+{
+  timeOffsets.reserve(n);
+  angularVelocities.reserve(n);
+  accelerations.reserve(n);
+}
+
+void CObservationIMUBatch::clear()
+{
+  timeOffsets.clear();
+  angularVelocities.clear();
+  accelerations.clear();
+}
+
+void CObservationIMUBatch::push_back(
+    double timeOffset, const mrpt::math::TVector3D& angularVelocity,
+    const mrpt::math::TVector3D& acceleration)
+{
+  timeOffsets.push_back(timeOffset);
+  angularVelocities.push_back(angularVelocity);
+  accelerations.push_back(acceleration);
+}
+
+uint8_t CObservationIMUBatch::serializeGetVersion() const { return 0; }
+void CObservationIMUBatch::serializeTo(mrpt::serialization::CArchive& out) const
+{
+  ASSERT_EQUAL_(angularVelocities.size(), timeOffsets.size());
+  ASSERT_EQUAL_(accelerations.size(), timeOffsets.size());
+
+  out << sensorPose << timestamp << sensorLabel;
+
+  const auto N = static_cast<uint32_t>(timeOffsets.size());
+  out << N;
+  out.WriteBufferFixEndianness(timeOffsets.data(), N);
+  out.WriteBufferFixEndianness(reinterpret_cast<const double*>(angularVelocities.data()), 3 * N);
+  out.WriteBufferFixEndianness(reinterpret_cast<const double*>(accelerations.data()), 3 * N);
+}
+
+void CObservationIMUBatch::serializeFrom(mrpt::serialization::CArchive& in, uint8_t version)
+{
+  switch (version)
+  {
+    case 0:
+    {
+      in >> sensorPose >> timestamp >> sensorLabel;
+
+      uint32_t N;
+      in >> N;
+      timeOffsets.resize(N);
+      angularVelocities.resize(N);
+      accelerations.resize(N);
+      in.ReadBufferFixEndianness(timeOffsets.data(), N);
+      in.ReadBufferFixEndianness(reinterpret_cast<double*>(angularVelocities.data()), 3 * N);
+      in.ReadBufferFixEndianness(reinterpret_cast<double*>(accelerations.data()), 3 * N);
+    }
+    break;
+    default:
+      MRPT_THROW_UNKNOWN_SERIALIZATION_VERSION(version);
+  };
+}
+
+void CObservationIMUBatch::getDescriptionAsText(std::ostream& o) const
+{
+  using namespace std;
+  CObservation::getDescriptionAsText(o);
+
+  o << "Sensor pose on the robot: " << sensorPose << endl;
+  o << "Number of samples: " << timeOffsets.size() << endl;
+  if (!timeOffsets.empty())
+  {
+    o << mrpt::format("Block time span: %.06f s\n", duration());
+    if (timeOffsets.size() >= 2)
+      o << mrpt::format(
+          "Mean sample rate: %.02f Hz\n", (timeOffsets.size() - 1) / duration());
+
+    const auto& w = angularVelocities.front();
+    const auto& a = accelerations.front();
+    o << mrpt::format(
+        "First sample: w=(%.06f,%.06f,%.06f) rad/s  a=(%.06f,%.06f,%.06f) "
+        "m/s^2\n",
+        w.x, w.y, w.z, a.x, a.y, a.z);
+  }
+}
@@ -17,6 +17,8 @@
 #include <mrpt/obs/CObservation2DRangeScan.h>
 #include <mrpt/obs/CObservationRotatingScan.h>
 #include <mrpt/obs/CObservationVelodyneScan.h>
+#include <mrpt/poses/CPose3DInterpolator.h>
+#include <mrpt/poses/Lie/SE.h>
 #include <mrpt/serialization/CArchive.h>
 #include <mrpt/serialization/stl_serialization.h>
 #include <mrpt/system/filesystem.h>
@@ -453,6 +455,101 @@ bool RotScan::fromGeneric(const mrpt::obs::CObservation& o)
   MRPT_END
 }
 
+namespace
+{
+/** Shared final stage of the deskew() overloads: single pass over the
+ * organized points, applying to each valid point the correction pose of its
+ * column (sensor frame at the column time -> sensor frame at the first
+ * column). */
+void applyDeskew(RotScan& me, const std::vector<mrpt::poses::CPose3D>& colCorrections)
+{
+  const bool hasRanges = !me.rangeImage.empty();
+  for (size_t r = 0; r < me.rowCount; r++)
+  {
+    for (size_t c = 0; c < me.columnCount; c++)
+    {
+      if (hasRanges && !me.rangeImage(r, c)) continue;  // invalid return
+      auto& pt = me.organizedPoints(r, c);
+      pt = colCorrections[c].composePoint(pt);
+    }
+  }
+}
+
+/** Per-column time offsets since the first column, in seconds */
+std::vector<double> columnTimeOffsets(const RotScan& me)
+{
+  std::vector<double> dts(me.columnCount);
+  const double dt = me.columnCount > 1 ? me.sweepDuration / (me.columnCount - 1) : .0;
+  for (size_t c = 0; c < me.columnCount; c++) dts[c] = dt * c;
+  return dts;
+}
+}  // namespace
+
+bool RotScan::deskew(const mrpt::poses::CPose3DInterpolator& vehiclePath)
+{
+  MRPT_START
+  load();
+  if (organizedPoints.empty()) return true;
+  ASSERT_GT_(sweepDuration, .0);
+  ASSERT_EQUAL_(organizedPoints.rows(), rowCount);
+  ASSERT_EQUAL_(organizedPoints.cols(), columnCount);
+
+  // One pose query per column:
+  const auto dts = columnTimeOffsets(*this);
+  const double t0 = mrpt::Clock::toDouble(timestamp);
+  std::vector<mrpt::Clock::time_point> ts(columnCount);
+  for (size_t c = 0; c < columnCount; c++) ts[c] = mrpt::Clock::fromDouble(t0 + dts[c]);
+
+  std::vector<mrpt::math::TPose3D> colPoses;
+  std::vector<bool> colValid;
+  vehiclePath.interpolateMany(ts, colPoses, colValid);
+  for (size_t c = 0; c < columnCount; c++)
+    if (!colValid[c]) return false;
+
+  // Correction pose for column c, in the sensor frame at the first column:
+  //   corr_c = sensorPose^-1 * pose(t_0)^-1 * pose(t_c) * sensorPose
+  const auto refPose = mrpt::poses::CPose3D(colPoses[0]);
+  std::vector<mrpt::poses::CPose3D> colCorrections(columnCount);
+  for (size_t c = 0; c < columnCount; c++)
+  {
+    const auto rel = mrpt::poses::CPose3D(colPoses[c]) - refPose;
+    colCorrections[c] = (rel + sensorPose) - sensorPose;
+  }
+
+  applyDeskew(*this, colCorrections);
+  return true;
+  MRPT_END
+}
+
+void RotScan::deskew(const mrpt::math::TTwist3D& vehicleTwist)
+{
+  MRPT_START
+  load();
+  if (organizedPoints.empty()) return;
+  ASSERT_GT_(sweepDuration, .0);
+  ASSERT_EQUAL_(organizedPoints.rows(), rowCount);
+  ASSERT_EQUAL_(organizedPoints.cols(), columnCount);
+
+  const auto dts = columnTimeOffsets(*this);
+  std::vector<mrpt::poses::CPose3D> colCorrections(columnCount);
+  for (size_t c = 0; c < columnCount; c++)
+  {
+    // Constant-twist motion since the first column:
+    mrpt::poses::Lie::SE<3>::tangent_vector xi;
+    xi[0] = vehicleTwist.vx * dts[c];
+    xi[1] = vehicleTwist.vy * dts[c];
+    xi[2] = vehicleTwist.vz * dts[c];
+    xi[3] = vehicleTwist.wx * dts[c];
+    xi[4] = vehicleTwist.wy * dts[c];
+    xi[5] = vehicleTwist.wz * dts[c];
+    const auto rel = mrpt::poses::Lie::SE<3>::exp(xi);
+    colCorrections[c] = (rel + sensorPose) - sensorPose;
+  }
+
+  applyDeskew(*this, colCorrections);
+  MRPT_END
+}
+
 void RotScan::load_impl() const
 {
   // Already loaded?
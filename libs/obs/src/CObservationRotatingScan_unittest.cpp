@@ -14,6 +14,7 @@
 #include <mrpt/obs/CObservationRotatingScan.h>
 #include <mrpt/obs/CObservationVelodyneScan.h>
 #include <mrpt/obs/CRawlog.h>
+#include <mrpt/poses/CPose3DInterpolator.h>
 #include <mrpt/system/filesystem.h>
 #include <test_mrpt_common.h>
 
@@ -88,3 +89,76 @@ TEST(CObservationRotatingScan, from2DScan)
 
   // std::cout << rs.getDescriptionAsTextValue();
 }
+
+TEST(CObservationRotatingScan, deskew)
+{
+  using mrpt::math::TPoint3Df;
+
+  const auto t0 = mrpt::Clock::now();
+
+  mrpt::obs::CObservationRotatingScan rs;
+  rs.timestamp = t0;
+  rs.rowCount = 2;
+  rs.columnCount = 11;
+  rs.sweepDuration = 0.1;  // [s]
+  rs.rangeImage.setZero(rs.rowCount, rs.columnCount);
+  rs.organizedPoints.resize(rs.rowCount, rs.columnCount);
+
+  // Vehicle moving forward at vx: a static wall point at (5, y, 0) in the
+  // world frame at scan start is seen from column c (fired dt_c seconds
+  // later) at local coordinates (5 - vx*dt_c, y, 0):
+  const double vx = 1.0;
+  for (size_t c = 0; c < rs.columnCount; c++)
+  {
+    const double dt_c = rs.sweepDuration * c / (rs.columnCount - 1);
+    for (size_t r = 0; r < rs.rowCount; r++)
+    {
+      rs.rangeImage(r, c) = 100;  // mark as valid returns
+      rs.organizedPoints(r, c) = TPoint3Df(static_cast<float>(5.0 - vx * dt_c), 1.0f * r, .0f);
+    }
+  }
+
+  // 1) Constant-twist deskew: all points must collapse back onto the wall.
+  auto rs1 = rs;
+  mrpt::math::TTwist3D w;
+  w.vx = vx;
+  rs1.deskew(w);
+  for (size_t c = 0; c < rs.columnCount; c++)
+  {
+    for (size_t r = 0; r < rs.rowCount; r++)
+    {
+      EXPECT_NEAR(rs1.organizedPoints(r, c).x, 5.0, 1e-4) << "r=" << r << " c=" << c;
+      EXPECT_NEAR(rs1.organizedPoints(r, c).y, 1.0 * r, 1e-4);
+      EXPECT_NEAR(rs1.organizedPoints(r, c).z, .0, 1e-4);
+    }
+  }
+
+  // 2) Trajectory-based deskew must match the twist version for the
+  //    equivalent constant-velocity path:
+  mrpt::poses::CPose3DInterpolator path;
+  for (int i = -5; i <= 15; i++)
+  {
+    const double t = 0.01 * i;
+    path.insert(
+        t0 + std::chrono::milliseconds(10 * i), mrpt::math::TPose3D(vx * t, .0, .0, .0, .0, .0));
+  }
+  auto rs2 = rs;
+  EXPECT_TRUE(rs2.deskew(path));
+  for (size_t c = 0; c < rs.columnCount; c++)
+  {
+    for (size_t r = 0; r < rs.rowCount; r++)
+    {
+      EXPECT_NEAR(rs2.organizedPoints(r, c).x, rs1.organizedPoints(r, c).x, 1e-4);
+      EXPECT_NEAR(rs2.organizedPoints(r, c).y, rs1.organizedPoints(r, c).y, 1e-4);
+      EXPECT_NEAR(rs2.organizedPoints(r, c).z, rs1.organizedPoints(r, c).z, 1e-4);
+    }
+  }
+
+  // 3) A path not covering the scan period must fail, leaving it untouched:
+  mrpt::poses::CPose3DInterpolator shortPath;
+  shortPath.insert(t0 - std::chrono::seconds(20), mrpt::math::TPose3D());
+  shortPath.insert(t0 - std::chrono::seconds(10), mrpt::math::TPose3D());
+  auto rs3 = rs;
+  EXPECT_FALSE(rs3.deskew(shortPath));
+  EXPECT_EQ(rs3.organizedPoints(0, 5).x, rs.organizedPoints(0, 5).x);
+}
@@ -12,6 +12,7 @@
 #include <mrpt/containers/stl_containers_utils.h>
 #include <mrpt/core/round.h>
 #include <mrpt/obs/CObservationVelodyneScan.h>
+#include <mrpt/obs/CSinCosLookUpTable.h>
 #include <mrpt/poses/CPose3DInterpolator.h>
 #include <mrpt/serialization/CArchive.h>
 #include <mrpt/serialization/stl_serialization.h>
@@ -27,7 +28,7 @@ using Velo = mrpt::obs::CObservationVelodyneScan;
 // This must be added to any CSerializable class implementation file.
 IMPLEMENTS_SERIALIZABLE(CObservationVelodyneScan, CObservation, mrpt::obs)
 
-static CSinCosLookUpTableFor2DScans velodyne_sincos_tables;
+static CSinCosLookUpTable velodyne_sincos_tables;
 
 const float VLP16_BLOCK_TDURATION = 110.592f;  // [us]
 const float VLP16_DSR_TOFFSET = 2.304f;        // [us]
@@ -132,20 +133,59 @@ void velodyne_scan_to_pointcloud(
     const Velo& scan,
     const Velo::TGeneratePointCloudParameters& params,
     Velo::PointCloudStorageWrapper& out_pc)
+{
+  // This is: 16,32,64 depending on the LIDAR model
+  const size_t num_lasers = scan.calibration.laser_corrections.size();
+
+  out_pc.resizeLaserCount(num_lasers);
+  out_pc.reserve(Velo::SCANS_PER_BLOCK * scan.scan_packets.size() * Velo::BLOCKS_PER_PACKET + 16);
+
+  Velo::TDecodedPacket pkt;
+  for (size_t iPkt = 0; iPkt < scan.scan_packets.size(); iPkt++)
+  {
+    scan.decodePacket(iPkt, pkt, params);
+    for (size_t i = 0; i < pkt.x.size(); i++)
+      out_pc.add_point(
+          pkt.x[i], pkt.y[i], pkt.z[i], pkt.intensity[i], pkt.pkt_timestamp, pkt.azimuth[i],
+          pkt.laser_id[i]);
+  }
+}
+}  // namespace
+
+void Velo::TDecodedPacket::clear()
+{
+  x.clear();
+  y.clear();
+  z.clear();
+  intensity.clear();
+  azimuth.clear();
+  laser_id.clear();
+  pkt_timestamp = INVALID_TIMESTAMP;
+}
+
+void Velo::decodePacket(
+    std::size_t pktIdx, TDecodedPacket& out, const TGeneratePointCloudParameters& params) const
 {
   // Initially based on code from ROS velodyne & from
   // vtkVelodyneHDLReader::vtkInternal::ProcessHDLPacket().
   using mrpt::round;
 
-  // Access to sin/cos table:
-  mrpt::obs::T2DScanProperties scan_props;
-  scan_props.aperture = 2 * M_PI;
-  scan_props.nRays = Velo::ROTATION_MAX_UNITS;
-  scan_props.rightToLeft = true;
-  // The LUT contains sin/cos values for angles in this order: [180deg ... 0
-  // deg ... -180 deg]
-  const CSinCosLookUpTableFor2DScans::TSinCosValues& lut_sincos =
-      velodyne_sincos_tables.getSinCosForScan(scan_props);
+  const Velo& scan = *this;
+  ASSERT_LT_(pktIdx, scan.scan_packets.size());
+
+  out.clear();
+  out.x.reserve(Velo::SCANS_PER_BLOCK * Velo::BLOCKS_PER_PACKET);
+  out.y.reserve(Velo::SCANS_PER_BLOCK * Velo::BLOCKS_PER_PACKET);
+  out.z.reserve(Velo::SCANS_PER_BLOCK * Velo::BLOCKS_PER_PACKET);
+  out.intensity.reserve(Velo::SCANS_PER_BLOCK * Velo::BLOCKS_PER_PACKET);
+  out.azimuth.reserve(Velo::SCANS_PER_BLOCK * Velo::BLOCKS_PER_PACKET);
+  out.laser_id.reserve(Velo::SCANS_PER_BLOCK * Velo::BLOCKS_PER_PACKET);
+
+  // Access to the interleaved (cos,sin) azimuth table, keyed on the sensor
+  // angular resolution. The i-th entry holds the angle
+  // [-180 deg ... 0 deg ... +180 deg] of azimuth unit (i - 18000):
+  const CSinCosLookUpTable::TSinCosValues& lut_sincos = velodyne_sincos_tables.getSinCos(
+      {-M_PI, 2 * M_PI / (Velo::ROTATION_MAX_UNITS - 1), Velo::ROTATION_MAX_UNITS});
 
   const int minAzimuth_int = round(params.minAzimuth_deg * 100);
   const int maxAzimuth_int = round(params.maxAzimuth_deg * 100);
@@ -157,12 +197,8 @@ void velodyne_scan_to_pointcloud(
   // This is: 16,32,64 depending on the LIDAR model
   const size_t num_lasers = scan.calibration.laser_corrections.size();
 
-  out_pc.resizeLaserCount(num_lasers);
-  out_pc.reserve(Velo::SCANS_PER_BLOCK * scan.scan_packets.size() * Velo::BLOCKS_PER_PACKET + 16);
-
-  for (size_t iPkt = 0; iPkt < scan.scan_packets.size(); iPkt++)
   {
-    const Velo::TVelodyneRawPacket* raw = &scan.scan_packets[iPkt];
+    const Velo::TVelodyneRawPacket* raw = &scan.scan_packets[pktIdx];
 
     mrpt::system::TTimeStamp pkt_tim;  // Find out timestamp of this pkt
     {
@@ -174,6 +210,7 @@ void velodyne_scan_to_pointcloud(
                                        : (1000000UL * 3600UL + us_pkt_this - us_pkt0);
       pkt_tim = mrpt::system::timestampAdd(scan.timestamp, us_ellapsed * 1e-6);
     }
+    out.pkt_timestamp = pkt_tim;
 
     // Take the median rotational speed as a good value for interpolating
     // the missing azimuths:
@@ -340,8 +377,9 @@ void velodyne_scan_to_pointcloud(
 
         const int azimuth_corrected_for_lut =
             (azimuth_corrected + (Velo::ROTATION_MAX_UNITS / 2)) % Velo::ROTATION_MAX_UNITS;
-        const float cos_azimuth = lut_sincos.ccos[azimuth_corrected_for_lut];
-        const float sin_azimuth = lut_sincos.csin[azimuth_corrected_for_lut];
+        // One contiguous (cos,sin) pair per azimuth -> a single cache line:
+        const float cos_azimuth = lut_sincos.ccos(azimuth_corrected_for_lut);
+        const float sin_azimuth = lut_sincos.csin(azimuth_corrected_for_lut);
 
         // Compute raw position
         const mrpt::math::TPoint3Df pt(
@@ -363,15 +401,17 @@ void velodyne_scan_to_pointcloud(
         if (!add_point) continue;
 
         // Insert point:
-        out_pc.add_point(
-            pt.x, pt.y, pt.z, raw->blocks[block].laser_returns[k].intensity(), pkt_tim,
-            azimuth_corrected_f, laserId);
+        out.x.push_back(pt.x);
+        out.y.push_back(pt.y);
+        out.z.push_back(pt.z);
+        out.intensity.push_back(raw->blocks[block].laser_returns[k].intensity());
+        out.azimuth.push_back(azimuth_corrected_f);
+        out.laser_id.push_back(laserId);
 
       }  // end for k,dsr=[0,31]
     }    // end for each block [0,11]
-  }      // end for each data packet
+  }      // end of this data packet
 }
-}  // namespace
 
 void Velo::generatePointCloud(
     PointCloudStorageWrapper& dest, const TGeneratePointCloudParameters& params)
@@ -0,0 +1,183 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include "obs-precomp.h"  // Precompiled headers
+//
+#include <mrpt/obs/CObservation3DRangeScan.h>
+#include <mrpt/obs/CObservationImage.h>
+#include <mrpt/obs/CObservationStereoImages.h>
+#include <mrpt/obs/CRawlogPrefetcher.h>
+#include <mrpt/system/filesystem.h>
+
+#include <iostream>
+
+using namespace mrpt;
+using namespace mrpt::obs;
+using namespace mrpt::system;
+
+namespace
+{
+uint64_t fileSizeOrZero(const std::string& path)
+{
+  if (!mrpt::system::fileExists(path)) return 0;
+  return mrpt::system::getFileSize(path);
+}
+
+uint64_t externalImageBytes(const mrpt::img::CImage& im)
+{
+  if (!im.isExternallyStored()) return 0;
+  return fileSizeOrZero(im.getExternalStorageFileAbsolutePath());
+}
+}  // namespace
+
+CRawlogPrefetcher::CRawlogPrefetcher(
+    mrpt::serialization::CArchive& archive, const TParams& params) :
+    m_archive(archive), m_params(params)
+{
+  m_thread = std::thread(&CRawlogPrefetcher::workerLoop, this);
+}
+
+CRawlogPrefetcher::~CRawlogPrefetcher()
+{
+  {
+    std::lock_guard<std::mutex> lk(m_mtx);
+    m_stop = true;
+  }
+  m_cvConsumed.notify_all();
+  if (m_thread.joinable()) m_thread.join();
+}
+
+uint64_t CRawlogPrefetcher::approxExternalBytes(const CObservation& obs)
+{
+  uint64_t bytes = 0;
+  if (auto* oIm = dynamic_cast<const CObservationImage*>(&obs); oIm)
+  {
+    bytes += externalImageBytes(oIm->image);
+  }
+  else if (auto* oSt = dynamic_cast<const CObservationStereoImages*>(&obs); oSt)
+  {
+    bytes += externalImageBytes(oSt->imageLeft);
+    if (oSt->hasImageRight) bytes += externalImageBytes(oSt->imageRight);
+    if (oSt->hasImageDisparity) bytes += externalImageBytes(oSt->imageDisparity);
+  }
+  else if (auto* o3D = dynamic_cast<const CObservation3DRangeScan*>(&obs); o3D)
+  {
+    if (o3D->points3D_isExternallyStored())
+      bytes += fileSizeOrZero(o3D->points3D_getExternalStorageFileAbsolutePath());
+    if (o3D->rangeImage_isExternallyStored())
+    {
+      // The main range matrix, plus any extra layers:
+      bytes += fileSizeOrZero(o3D->rangeImage_getExternalStorageFileAbsolutePath(std::string()));
+      for (const auto& layer : o3D->rangeImageOtherLayers)
+        bytes += fileSizeOrZero(o3D->rangeImage_getExternalStorageFileAbsolutePath(layer.first));
+    }
+    if (o3D->hasIntensityImage) bytes += externalImageBytes(o3D->intensityImage);
+    if (o3D->hasConfidenceImage) bytes += externalImageBytes(o3D->confidenceImage);
+  }
+  return bytes;
+}
+
+void CRawlogPrefetcher::workerLoop()
+{
+  for (;;)
+  {
+    // Wait until there is room for reading further ahead:
+    {
+      std::unique_lock<std::mutex> lk(m_mtx);
+      m_cvConsumed.wait(
+          lk,
+          [this]()
+          {
+            return m_stop || (m_queue.size() < m_params.readAheadLength &&
+                              m_queuedBytes < m_params.maxBytesAhead);
+          });
+      if (m_stop) return;
+    }
+
+    TEntry e;
+    try
+    {
+      auto [readOk, idx, action, sf, obs] = CRawlog::ReadFromArchive(m_archive, m_entryCounter);
+      e.readOk = readOk;
+      e.index = idx;
+      e.action = action;
+      e.sf = sf;
+      e.obs = obs;
+      m_entryCounter = idx;
+
+      // Load external data while we are still ahead of the consumer:
+      if (e.readOk)
+      {
+        if (e.obs)
+        {
+          e.obs->load();
+          e.approxBytes += approxExternalBytes(*e.obs);
+        }
+        if (e.sf)
+        {
+          for (auto& o : *e.sf)
+          {
+            o->load();
+            e.approxBytes += approxExternalBytes(*o);
+          }
+        }
+      }
+    }
+    catch (const std::exception& ex)
+    {
+      std::cerr << "[CRawlogPrefetcher] Exception in reader thread:\n"
+                << mrpt::exception_to_str(ex) << std::endl;
+      e.readOk = false;
+    }
+
+    const bool isEOF = !e.readOk;
+    {
+      std::lock_guard<std::mutex> lk(m_mtx);
+      m_queuedBytes += e.approxBytes;
+      m_queue.push_back(std::move(e));
+      if (isEOF) m_eof = true;
+    }
+    m_cvProduced.notify_one();
+    if (isEOF) return;
+  }
+}
+
+std::tuple<bool, size_t, CActionCollection::Ptr, CSensoryFrame::Ptr, CObservation::Ptr>
+    CRawlogPrefetcher::read()
+{
+  std::unique_lock<std::mutex> lk(m_mtx);
+  m_cvProduced.wait(lk, [this]() { return !m_queue.empty() || m_eof; });
+
+  if (m_queue.empty())
+  {
+    // Past EOF:
+    return {false, m_entryCounter, CActionCollection::Ptr(), CSensoryFrame::Ptr(),
+            CObservation::Ptr()};
+  }
+
+  TEntry e = std::move(m_queue.front());
+  m_queue.pop_front();
+  m_queuedBytes -= e.approxBytes;
+  lk.unlock();
+  m_cvConsumed.notify_one();
+
+  return {e.readOk, e.index, e.action, e.sf, e.obs};
+}
+
+size_t CRawlogPrefetcher::queuedEntries() const
+{
+  std::lock_guard<std::mutex> lk(m_mtx);
+  return m_queue.size();
+}
+
+uint64_t CRawlogPrefetcher::queuedBytes() const
+{
+  std::lock_guard<std::mutex> lk(m_mtx);
+  return m_queuedBytes;
+}
@@ -0,0 +1,99 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/io/CFileInputStream.h>
+#include <mrpt/io/CFileOutputStream.h>
+#include <mrpt/obs/CObservation2DRangeScan.h>
+#include <mrpt/obs/CRawlogPrefetcher.h>
+#include <mrpt/obs/stock_observations.h>
+#include <mrpt/serialization/CArchive.h>
+#include <mrpt/system/filesystem.h>
+
+const size_t NUM_SCANS = 20;
+
+static std::string createTestRawlogFile()
+{
+  const std::string fil = mrpt::system::getTempFileName() + std::string(".rawlog");
+
+  mrpt::io::CFileOutputStream fo(fil);
+  auto arch = mrpt::serialization::archiveFrom(fo);
+  for (size_t i = 0; i < NUM_SCANS; i++)
+  {
+    mrpt::obs::CObservation2DRangeScan scan;
+    mrpt::obs::stock_observations::example2DRangeScan(scan, i % 2);
+    scan.timestamp = mrpt::Clock::fromDouble(1000.0 + i);
+    arch << scan;
+  }
+  return fil;
+}
+
+TEST(CRawlogPrefetcher, sameResultsAsReadFromArchive)
+{
+  const auto fil = createTestRawlogFile();
+
+  mrpt::io::CFileInputStream fi(fil);
+  auto arch = mrpt::serialization::archiveFrom(fi);
+
+  mrpt::obs::CRawlogPrefetcher prefetcher(arch);
+
+  for (size_t i = 0; i < NUM_SCANS; i++)
+  {
+    const auto [readOk, idx, action, sf, obs] = prefetcher.read();
+    EXPECT_TRUE(readOk);
+    EXPECT_FALSE(action);
+    EXPECT_FALSE(sf);
+    ASSERT_TRUE(obs);
+    EXPECT_NEAR(mrpt::Clock::toDouble(obs->timestamp), 1000.0 + i, 1e-3);
+  }
+
+  // EOF, also if read repeatedly:
+  for (int i = 0; i < 2; i++)
+  {
+    const auto [readOk, idx, action, sf, obs] = prefetcher.read();
+    EXPECT_FALSE(readOk);
+    EXPECT_FALSE(obs);
+  }
+}
+
+TEST(CRawlogPrefetcher, boundedReadAhead)
+{
+  const auto fil = createTestRawlogFile();
+
+  mrpt::io::CFileInputStream fi(fil);
+  auto arch = mrpt::serialization::archiveFrom(fi);
+
+  mrpt::obs::CRawlogPrefetcher::TParams params;
+  params.readAheadLength = 4;
+
+  mrpt::obs::CRawlogPrefetcher prefetcher(arch, params);
+
+  // Regardless of how fast the reader thread is, it never reads further
+  // ahead than the configured window:
+  for (size_t i = 0; i < NUM_SCANS; i++)
+  {
+    EXPECT_LE(prefetcher.queuedEntries(), params.readAheadLength);
+    const auto [readOk, idx, action, sf, obs] = prefetcher.read();
+    EXPECT_TRUE(readOk);
+  }
+}
+
+TEST(CRawlogPrefetcher, earlyDestruction)
+{
+  const auto fil = createTestRawlogFile();
+
+  mrpt::io::CFileInputStream fi(fil);
+  auto arch = mrpt::serialization::archiveFrom(fi);
+
+  // Destroying the prefetcher with unconsumed entries must cleanly stop
+  // and join the reader thread:
+  mrpt::obs::CRawlogPrefetcher prefetcher(arch);
+  const auto [readOk, idx, action, sf, obs] = prefetcher.read();
+  EXPECT_TRUE(readOk);
+}
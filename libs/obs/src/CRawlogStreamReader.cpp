@@ -0,0 +1,311 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include "obs-precomp.h"  // Precompiled headers
+//
+#include <mrpt/io/CFileInputStream.h>
+#include <mrpt/io/CFileOutputStream.h>
+#include <mrpt/obs/CRawlogStreamReader.h>
+#include <mrpt/serialization/CArchive.h>
+#include <mrpt/system/filesystem.h>
+
+#include <iostream>
+
+using namespace mrpt;
+using namespace mrpt::io;
+using namespace mrpt::obs;
+using namespace mrpt::system;
+using namespace mrpt::serialization;
+
+static const char* INDEX_FILE_MAGIC = "MRPT-RAWLOG-INDEX";
+static const uint8_t INDEX_FILE_VERSION = 1;  // v1: added sensorLabel
+
+CRawlogStreamReader::CRawlogStreamReader(const std::string& fileName, size_t cacheWindowSize) :
+    m_cacheWindowSize(cacheWindowSize)
+{
+  if (!open(fileName)) THROW_EXCEPTION_FMT("Error opening rawlog file: '%s'", fileName.c_str());
+}
+
+std::string CRawlogStreamReader::indexFileNameFor(const std::string& rawlogFileName)
+{
+  return rawlogFileName + std::string(".idx");
+}
+
+bool CRawlogStreamReader::open(const std::string& fileName)
+{
+  MRPT_START
+  close();
+
+  if (!m_file.open(fileName)) return false;
+
+  // Random seeks do not work on gz streams, so refuse compressed inputs
+  // with a clear error instead of failing with garbage reads later:
+  uint8_t header[2] = {0, 0};
+  if (m_file.Read(header, 2) == 2 && header[0] == 0x1f && header[1] == 0x8b)
+  {
+    m_file.close();
+    THROW_EXCEPTION_FMT(
+        "Rawlog file is gz-compressed, which does not support the random "
+        "access required for streamed reading. Decompress it first (e.g. "
+        "with `gunzip`): '%s'",
+        fileName.c_str());
+  }
+  m_file.Seek(0);
+  m_fileName = fileName;
+
+  if (!loadIndexFile())
+  {
+    buildIndex();
+    saveIndexFile();
+  }
+  return true;
+  MRPT_END
+}
+
+void CRawlogStreamReader::close()
+{
+  m_file.close();
+  m_fileName.clear();
+  m_index.clear();
+  m_cache.clear();
+  m_lru.clear();
+}
+
+namespace
+{
+mrpt::system::TTimeStamp entryTimestamp(const mrpt::serialization::CSerializable& o)
+{
+  if (auto* obs = dynamic_cast<const CObservation*>(&o); obs) return obs->timestamp;
+  if (auto* sf = dynamic_cast<const CSensoryFrame*>(&o); sf && !sf->empty())
+    return sf->getObservationByIndex(0)->timestamp;
+  if (auto* acts = dynamic_cast<const CActionCollection*>(&o); acts && acts->size())
+    return acts->get(0).timestamp;
+  return INVALID_TIMESTAMP;
+}
+
+std::string entrySensorLabel(const mrpt::serialization::CSerializable& o)
+{
+  if (auto* obs = dynamic_cast<const CObservation*>(&o); obs) return obs->sensorLabel;
+  if (auto* sf = dynamic_cast<const CSensoryFrame*>(&o); sf && !sf->empty())
+    return sf->getObservationByIndex(0)->sensorLabel;
+  return {};
+}
+
+CRawlog::TEntryType entryType(const mrpt::serialization::CSerializable& o)
+{
+  if (o.GetRuntimeClass()->derivedFrom(CLASS_ID(CObservation)))
+    return CRawlog::etObservation;
+  else if (o.GetRuntimeClass() == CLASS_ID(CActionCollection))
+    return CRawlog::etActionCollection;
+  else if (o.GetRuntimeClass() == CLASS_ID(CSensoryFrame))
+    return CRawlog::etSensoryFrame;
+  else
+    return CRawlog::etOther;
+}
+}  // namespace
+
+void CRawlogStreamReader::buildIndex()
+{
+  MRPT_START
+  m_index.clear();
+  m_file.Seek(0);
+  auto arch = archiveFrom(m_file);
+
+  bool keepReading = true;
+  while (keepReading)
+  {
+    TEntryIndex e;
+    e.offset = m_file.getPosition();
+    try
+    {
+      CSerializable::Ptr obj;
+      arch >> obj;
+      if (!obj) continue;
+
+      e.className = obj->GetRuntimeClass()->className;
+      e.type = entryType(*obj);
+      e.timestamp = entryTimestamp(*obj);
+      e.sensorLabel = entrySensorLabel(*obj);
+      m_index.push_back(std::move(e));
+    }
+    catch (CExceptionEOF&)
+    {  // EOF, just finish the loop
+      keepReading = false;
+    }
+    catch (const std::exception& ex)
+    {
+      std::cerr << mrpt::exception_to_str(ex) << std::endl;
+      keepReading = false;
+    }
+  }
+  MRPT_END
+}
+
+bool CRawlogStreamReader::loadIndexFile()
+{
+  const std::string idxFil = indexFileNameFor(m_fileName);
+  if (!mrpt::system::fileExists(idxFil)) return false;
+  try
+  {
+    CFileInputStream fi;
+    if (!fi.open(idxFil)) return false;
+    auto a = archiveFrom(fi);
+
+    std::string magic;
+    a >> magic;
+    if (magic != INDEX_FILE_MAGIC) return false;
+    if (a.ReadAs<uint8_t>() != INDEX_FILE_VERSION) return false;
+
+    // Detect a stale index, e.g. the rawlog has grown since indexing:
+    if (a.ReadAs<uint64_t>() != mrpt::system::getFileSize(m_fileName)) return false;
+
+    m_index.resize(a.ReadAs<uint64_t>());
+    for (auto& e : m_index)
+    {
+      a >> e.offset >> e.timestamp >> e.className >> e.sensorLabel;
+      e.type = static_cast<CRawlog::TEntryType>(a.ReadAs<uint8_t>());
+    }
+    return true;
+  }
+  catch (const std::exception&)
+  {
+    m_index.clear();
+    return false;
+  }
+}
+
+void CRawlogStreamReader::saveIndexFile() const
+{
+  const std::string idxFil = indexFileNameFor(m_fileName);
+  try
+  {
+    CFileOutputStream fo(idxFil);
+    auto a = archiveFrom(fo);
+    a << std::string(INDEX_FILE_MAGIC);
+    a << INDEX_FILE_VERSION;
+    a << static_cast<uint64_t>(mrpt::system::getFileSize(m_fileName));
+    a << static_cast<uint64_t>(m_index.size());
+    for (const auto& e : m_index)
+    {
+      a << e.offset << e.timestamp << e.className << e.sensorLabel;
+      a << static_cast<uint8_t>(e.type);
+    }
+  }
+  catch (const std::exception& ex)
+  {
+    // A missing index is only a performance issue, not an error:
+    std::cerr << "[CRawlogStreamReader] Cannot write index file '" << idxFil
+              << "': " << mrpt::exception_to_str(ex) << std::endl;
+  }
+}
+
+CRawlog::TEntryType CRawlogStreamReader::getType(size_t index) const
+{
+  MRPT_START
+  if (index >= m_index.size()) THROW_EXCEPTION("Index out of bounds");
+  return m_index[index].type;
+  MRPT_END
+}
+
+const CRawlogStreamReader::TEntryIndex& CRawlogStreamReader::entry(size_t index) const
+{
+  MRPT_START
+  if (index >= m_index.size()) THROW_EXCEPTION("Index out of bounds");
+  return m_index[index];
+  MRPT_END
+}
+
+CSerializable::Ptr CRawlogStreamReader::getAsGeneric(size_t index) const
+{
+  MRPT_START
+  if (index >= m_index.size()) THROW_EXCEPTION("Index out of bounds");
+
+  // Cache window hit?
+  if (auto it = m_cache.find(index); it != m_cache.end())
+  {
+    m_lru.splice(m_lru.begin(), m_lru, it->second.lruIt);
+    return it->second.obj;
+  }
+
+  ASSERTMSG_(m_file.fileOpenCorrectly(), "No rawlog file is open");
+
+  m_file.Seek(m_index[index].offset);
+  auto arch = archiveFrom(m_file);
+  CSerializable::Ptr obj;
+  arch >> obj;
+
+  m_lru.push_front(index);
+  m_cache[index] = {obj, m_lru.begin()};
+  enforceCacheLimit();
+
+  return obj;
+  MRPT_END
+}
+
+CObservation::Ptr CRawlogStreamReader::getAsObservation(size_t index) const
+{
+  MRPT_START
+  CSerializable::Ptr obj = getAsGeneric(index);
+  if (obj->GetRuntimeClass()->derivedFrom(CLASS_ID(CObservation)))
+    return std::dynamic_pointer_cast<CObservation>(obj);
+  else
+    THROW_EXCEPTION_FMT("Element at index %i is not a CObservation", (int)index);
+  MRPT_END
+}
+
+CActionCollection::Ptr CRawlogStreamReader::getAsAction(size_t index) const
+{
+  MRPT_START
+  CSerializable::Ptr obj = getAsGeneric(index);
+  if (obj->GetRuntimeClass() == CLASS_ID(CActionCollection))
+    return std::dynamic_pointer_cast<CActionCollection>(obj);
+  else
+    THROW_EXCEPTION_FMT("Element at index %i is not a CActionCollection", (int)index);
+  MRPT_END
+}
+
+CSensoryFrame::Ptr CRawlogStreamReader::getAsObservations(size_t index) const
+{
+  MRPT_START
+  CSerializable::Ptr obj = getAsGeneric(index);
+  if (obj->GetRuntimeClass()->derivedFrom(CLASS_ID(CSensoryFrame)))
+    return std::dynamic_pointer_cast<CSensoryFrame>(obj);
+  else
+    THROW_EXCEPTION_FMT("Element at index %i is not a CSensoryFrame", (int)index);
+  MRPT_END
+}
+
+std::string CRawlogStreamReader::getCommentText() const
+{
+  MRPT_START
+  for (size_t i = 0; i < m_index.size(); i++)
+  {
+    if (m_index[i].className != std::string("CObservationComment")) continue;
+    auto o = std::dynamic_pointer_cast<CObservationComment>(getAsGeneric(i));
+    ASSERT_(o);
+    return o->text;
+  }
+  return {};
+  MRPT_END
+}
+
+void CRawlogStreamReader::setCacheWindowSize(size_t n)
+{
+  m_cacheWindowSize = n;
+  enforceCacheLimit();
+}
+
+void CRawlogStreamReader::enforceCacheLimit() const
+{
+  while (m_cache.size() > m_cacheWindowSize && !m_lru.empty())
+  {
+    m_cache.erase(m_lru.back());
+    m_lru.pop_back();
+  }
+}
@@ -0,0 +1,103 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/io/CFileOutputStream.h>
+#include <mrpt/obs/CObservation2DRangeScan.h>
+#include <mrpt/obs/CRawlogStreamReader.h>
+#include <mrpt/obs/stock_observations.h>
+#include <mrpt/serialization/CArchive.h>
+#include <mrpt/system/filesystem.h>
+
+const size_t NUM_SCANS = 10;
+
+// Writes a small plain (non gz-compressed) rawlog and returns its file name:
+static std::string createTestRawlogFile()
+{
+  const std::string fil = mrpt::system::getTempFileName() + std::string(".rawlog");
+
+  mrpt::io::CFileOutputStream fo(fil);
+  auto arch = mrpt::serialization::archiveFrom(fo);
+  for (size_t i = 0; i < NUM_SCANS; i++)
+  {
+    mrpt::obs::CObservation2DRangeScan scan;
+    mrpt::obs::stock_observations::example2DRangeScan(scan, i % 2);
+    scan.timestamp = mrpt::Clock::fromDouble(1000.0 + i);
+    arch << scan;
+  }
+  return fil;
+}
+
+TEST(CRawlogStreamReader, buildIndexAndRandomAccess)
+{
+  const auto fil = createTestRawlogFile();
+
+  mrpt::obs::CRawlogStreamReader r;
+  ASSERT_TRUE(r.open(fil));
+  EXPECT_TRUE(r.isOpen());
+  EXPECT_EQ(r.size(), NUM_SCANS);
+
+  // The index file must have been created next to the rawlog:
+  EXPECT_TRUE(mrpt::system::fileExists(mrpt::obs::CRawlogStreamReader::indexFileNameFor(fil)));
+
+  // Check index metadata, without deserializing:
+  for (size_t i = 0; i < r.size(); i++)
+  {
+    EXPECT_EQ(r.getType(i), mrpt::obs::CRawlog::etObservation);
+    EXPECT_EQ(r.entry(i).className, std::string("CObservation2DRangeScan"));
+    EXPECT_NEAR(mrpt::Clock::toDouble(r.entry(i).timestamp), 1000.0 + i, 1e-3);
+  }
+
+  // Random (out-of-order) access:
+  for (size_t i : {size_t(7), size_t(0), size_t(9), size_t(3)})
+  {
+    const auto obs = r.getAsObservation(i);
+    ASSERT_TRUE(obs);
+    EXPECT_NEAR(mrpt::Clock::toDouble(obs->timestamp), 1000.0 + i, 1e-3);
+  }
+}
+
+TEST(CRawlogStreamReader, reopenFromIndexFile)
+{
+  const auto fil = createTestRawlogFile();
+
+  {  // First open: builds & saves the index.
+    mrpt::obs::CRawlogStreamReader r(fil);
+    EXPECT_EQ(r.size(), NUM_SCANS);
+  }
+  {  // Second open: must load the saved index and give the same view.
+    mrpt::obs::CRawlogStreamReader r(fil);
+    EXPECT_EQ(r.size(), NUM_SCANS);
+    const auto obs = r.getAsObservation(NUM_SCANS - 1);
+    ASSERT_TRUE(obs);
+    EXPECT_NEAR(mrpt::Clock::toDouble(obs->timestamp), 1000.0 + NUM_SCANS - 1, 1e-3);
+  }
+}
+
+TEST(CRawlogStreamReader, lruWindow)
+{
+  const auto fil = createTestRawlogFile();
+
+  mrpt::obs::CRawlogStreamReader r(fil, 3 /*cacheWindowSize*/);
+
+  // Repeated access to a cached entry must return the very same object:
+  const auto o1 = r.getAsGeneric(1);
+  EXPECT_EQ(o1.get(), r.getAsGeneric(1).get());
+
+  // The window never holds more than its configured size:
+  for (size_t i = 0; i < NUM_SCANS; i++) r.getAsGeneric(i);
+  EXPECT_EQ(r.cachedEntriesCount(), 3U);
+
+  // Entry "1" was evicted by now, so it gets deserialized again:
+  EXPECT_NE(o1.get(), r.getAsGeneric(1).get());
+
+  // Shrinking the window evicts immediately:
+  r.setCacheWindowSize(1);
+  EXPECT_EQ(r.cachedEntriesCount(), 1U);
+}
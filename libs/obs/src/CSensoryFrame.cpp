@@ -9,13 +9,18 @@
 
 #include "obs-precomp.h"  // Precompiled headers
 //
+#include <mrpt/core/WorkerThreadsPool.h>
+#include <mrpt/maps/CMetricMap.h>
 #include <mrpt/obs/CObservation2DRangeScan.h>
 #include <mrpt/obs/CSensoryFrame.h>
 #include <mrpt/serialization/CArchive.h>
 #include <mrpt/serialization/metaprogramming_serialization.h>
 #include <mrpt/system/os.h>
 
+#include <algorithm>
+#include <future>
 #include <iterator>
+#include <thread>
 
 using namespace mrpt::obs;
 using namespace mrpt::poses;
@@ -229,3 +234,31 @@ bool CSensoryFrame::insertObservationsInto(
   for (const auto& it : *this) anyone |= it->insertObservationInto(theMap, robotPose);
   return anyone;
 }
+
+bool CSensoryFrame::insertObservationsIntoParallel(
+    maps::CMetricMap& theMap,
+    const std::optional<const mrpt::poses::CPose3D>& robotPose,
+    size_t numThreads) const
+{
+  // Serial fallback, for maps that do not support concurrent insertion:
+  if (size() < 2 || !theMap.insertionIsThreadSafe())
+    return insertObservationsInto(theMap, robotPose);
+
+  if (numThreads == 0)
+    numThreads = std::min<size_t>(size(), std::thread::hardware_concurrency());
+
+  // Inserts of independent observations are typically expensive (ray casting,
+  // point transformations...), so a per-call pool is in the noise:
+  mrpt::WorkerThreadsPool pool(
+      numThreads, mrpt::WorkerThreadsPool::POLICY_FIFO, "CSensoryFrame_insert");
+
+  std::vector<std::future<bool>> futs;
+  futs.reserve(size());
+  for (const auto& it : *this)
+    futs.emplace_back(pool.enqueue([&theMap, &robotPose, &it]()
+                                   { return it->insertObservationInto(theMap, robotPose); }));
+
+  bool anyone = false;
+  for (auto& f : futs) anyone |= f.get();
+  return anyone;
+}
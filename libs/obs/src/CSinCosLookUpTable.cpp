@@ -0,0 +1,47 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include "obs-precomp.h"  // Precompiled headers
+//
+#include <mrpt/core/bits_math.h>  // d2f()
+#include <mrpt/core/lock_helper.h>
+#include <mrpt/obs/CSinCosLookUpTable.h>
+
+#include <cmath>
+
+using namespace mrpt::obs;
+
+const CSinCosLookUpTable::TSinCosValues& CSinCosLookUpTable::getSinCos(
+    const TAngularGrid& grid) const
+{
+  auto lck = mrpt::lockHelper(m_cache_mtx);
+
+  auto it = m_cache.find(grid);
+  if (it != m_cache.end()) return it->second;
+
+  // As in CSinCosLookUpTableFor2DScans: seeing many different grids means
+  // something is wrong upstream, so just bound the memory use:
+  if (m_cache.size() > 20) m_cache.clear();
+
+  // Compute and insert in the cache:
+  TSinCosValues& new_entry = m_cache[grid];
+
+  // Pad with 4 extra (cos,sin) pairs so SIMD code may safely read a whole
+  // vector register at the last valid index:
+  new_entry.cs.resize(2 * (grid.count + 4));
+
+  double ang = grid.firstAngle;
+  for (size_t i = 0; i < grid.count; i++)
+  {
+    new_entry.cs[2 * i] = mrpt::d2f(std::cos(ang));
+    new_entry.cs[2 * i + 1] = mrpt::d2f(std::sin(ang));
+    ang += grid.angleStep;
+  }
+  return new_entry;
+}
@@ -0,0 +1,50 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/obs/CSinCosLookUpTable.h>
+
+#include <cmath>
+
+using mrpt::obs::CSinCosLookUpTable;
+
+TEST(CSinCosLookUpTable, valuesAndLayout)
+{
+  CSinCosLookUpTable lut;
+
+  const CSinCosLookUpTable::TAngularGrid grid = {-M_PI / 4, M_PI / 180.0, 91};
+  const auto& v = lut.getSinCos(grid);
+
+  double ang = grid.firstAngle;
+  for (size_t i = 0; i < grid.count; i++, ang += grid.angleStep)
+  {
+    EXPECT_NEAR(v.ccos(i), std::cos(ang), 1e-6) << "i=" << i;
+    EXPECT_NEAR(v.csin(i), std::sin(ang), 1e-6) << "i=" << i;
+
+    // Interleaved layout: one contiguous (cos,sin) pair per angle:
+    EXPECT_EQ(v.pair(i), &v.cs[2 * i]);
+    EXPECT_EQ(v.pair(i)[0], v.ccos(i));
+    EXPECT_EQ(v.pair(i)[1], v.csin(i));
+  }
+}
+
+TEST(CSinCosLookUpTable, cachePerGrid)
+{
+  CSinCosLookUpTable lut;
+
+  const CSinCosLookUpTable::TAngularGrid g1 = {0, M_PI / 100, 50};
+  const CSinCosLookUpTable::TAngularGrid g2 = {0, M_PI / 200, 50};
+
+  const auto& v1 = lut.getSinCos(g1);
+  const auto& v2 = lut.getSinCos(g2);
+  EXPECT_NE(&v1, &v2);
+
+  // Asking again for a known grid returns the cached entry:
+  EXPECT_EQ(&lut.getSinCos(g1), &v1);
+}
@@ -16,6 +16,12 @@
 #include <mrpt/obs/carmen_log_tools.h>
 #include <mrpt/system/string_utils.h>
 
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <string_view>
+#include <thread>
+
 using namespace mrpt;
 using namespace mrpt::obs;
 using namespace mrpt::poses;
@@ -234,3 +240,322 @@ bool mrpt::obs::carmen_log_parse_line(
 
   return true;  // OK
 }
+
+// ===========================================================================
+// carmen_log_import(): whole-file, multi-threaded importer
+// ===========================================================================
+namespace
+{
+/** The laser PARAM values that affect FLASER/RLASER parsing (the parallel
+ * importer's thread-local replacement for the static yaml above). */
+struct TCarmenLaserParams
+{
+  double front_max = 81.0, front_res_deg = 0.5;
+  double rear_max = 81.0, rear_res_deg = 0.5;
+};
+
+/** In-place whitespace tokenizer over one log line: no stream, no copies */
+struct TCarmenTokenizer
+{
+  const char* p;
+  const char* end;
+
+  TCarmenTokenizer(const char* b, const char* e) : p(b), end(e) {}
+
+  void skipSpaces()
+  {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) ++p;
+  }
+  bool next(std::string_view& tok)
+  {
+    skipSpaces();
+    if (p >= end) return false;
+    const char* b = p;
+    while (p < end && *p != ' ' && *p != '\t' && *p != '\r') ++p;
+    tok = std::string_view(b, static_cast<size_t>(p - b));
+    return true;
+  }
+  // strtod/strtol stop at the terminating '\n' (or final NUL) by themselves;
+  // we only have to refuse to start a token past the line end.
+  bool next(double& v)
+  {
+    skipSpaces();
+    if (p >= end) return false;
+    char* q = nullptr;
+    v = std::strtod(p, &q);
+    if (q == p) return false;
+    p = q;
+    return true;
+  }
+  bool next(long& v)
+  {
+    skipSpaces();
+    if (p >= end) return false;
+    char* q = nullptr;
+    v = std::strtol(p, &q, 10);
+    if (q == p) return false;
+    p = q;
+    return true;
+  }
+};
+
+bool startsWithI(const std::string_view& s, const char* prefix)
+{
+  size_t i = 0;
+  for (; prefix[i]; i++)
+    if (i >= s.size() || std::tolower(static_cast<unsigned char>(s[i])) != prefix[i]) return false;
+  return true;
+}
+
+/** Common tail of all laser entries: poses, timestamp, and the odometry +
+ * laser observations pushed to `out` */
+void finishLaserEntry(
+    TCarmenTokenizer& S, const std::string_view& line, CObservation2DRangeScan::Ptr& obsLaser_ptr,
+    bool isRobotLaser, const mrpt::system::TTimeStamp& time_start_log,
+    std::vector<CObservation::Ptr>& out)
+{
+  mrpt::math::TPose2D globalLaserPose;
+  mrpt::math::TPose2D globalRobotPose;
+  if (!(S.next(globalLaserPose.x) && S.next(globalLaserPose.y) && S.next(globalLaserPose.phi) &&
+        S.next(globalRobotPose.x) && S.next(globalRobotPose.y) && S.next(globalRobotPose.phi)))
+    THROW_EXCEPTION_FMT(
+        "Error parsing line from CARMEN log (poses):\n'%s'\n", std::string(line).c_str());
+
+  // Compute pose of laser on the robot:
+  obsLaser_ptr->sensorPose = CPose3D(CPose2D(globalLaserPose) - CPose2D(globalRobotPose));
+
+  if (isRobotLaser)
+  {
+    double tv, rv, fw_dist, side_dist, turn_axis;
+    S.next(tv);
+    S.next(rv);
+    S.next(fw_dist);
+    S.next(side_dist);
+    S.next(turn_axis);
+  }
+
+  double timestamp = 0;
+  std::string_view robotName;
+  S.next(timestamp);
+  S.next(robotName);
+
+  const mrpt::system::TTimeStamp obs_time =
+      time_start_log + std::chrono::microseconds(static_cast<uint64_t>(1e-6 * timestamp));
+
+  obsLaser_ptr->timestamp = obs_time;
+
+  // Create odometry observation:
+  {
+    auto obsOdo_ptr = std::make_shared<CObservationOdometry>();
+    obsOdo_ptr->timestamp = obs_time;
+    obsOdo_ptr->odometry = CPose2D(globalRobotPose);
+    obsOdo_ptr->sensorLabel = "ODOMETRY";
+    out.push_back(obsOdo_ptr);
+  }
+
+  // Send out laser observation:
+  out.push_back(obsLaser_ptr);
+}
+
+/** Parses one non-empty log line (same semantics as carmen_log_parse_line(),
+ * with the PARAM state passed explicitly instead of a static) */
+void parseCarmenLineFast(
+    const std::string_view& line, TCarmenLaserParams& params,
+    const mrpt::system::TTimeStamp& time_start_log, std::vector<CObservation::Ptr>& out)
+{
+  TCarmenTokenizer S(line.data(), line.data() + line.size());
+
+  if (startsWithI(line, "robotlaser"))
+  {
+    auto obsLaser_ptr = std::make_shared<CObservation2DRangeScan>();
+    CObservation2DRangeScan* obsLaser = obsLaser_ptr.get();
+
+    std::string_view label;
+    long laser_type, remission_mode;
+    double start_angle, aperture, angular_resolution, maxRange, accuracy;
+
+    if (!(S.next(label) && S.next(laser_type) && S.next(start_angle) && S.next(aperture) &&
+          S.next(angular_resolution) && S.next(maxRange) && S.next(accuracy) &&
+          S.next(remission_mode)))
+      THROW_EXCEPTION_FMT(
+          "Error parsing line from CARMEN log (params):\n'%s'\n", std::string(line).c_str());
+
+    obsLaser->sensorLabel = std::string(label);
+    obsLaser->aperture = d2f(aperture);
+    obsLaser->maxRange = d2f(maxRange);
+
+    long nRanges = 0;
+    S.next(nRanges);
+    obsLaser->resizeScan(nRanges);
+
+    for (long i = 0; i < nRanges; i++)
+    {
+      double range;
+      if (!S.next(range))
+        THROW_EXCEPTION_FMT(
+            "Error parsing line from CARMEN log (ranges):\n'%s'\n", std::string(line).c_str());
+      obsLaser->setScanRange(i, d2f(range));
+      obsLaser->setScanRangeValidity(i, !(range >= obsLaser->maxRange || range <= 0));
+    }
+
+    long remission_count = 0;
+    if (!S.next(remission_count))
+      THROW_EXCEPTION_FMT(
+          "Error parsing line from CARMEN log (remmision_count):\n'%s'\n",
+          std::string(line).c_str());
+
+    for (long i = 0; i < remission_count; i++)
+    {
+      double remission;
+      if (!S.next(remission))
+        THROW_EXCEPTION_FMT(
+            "Error parsing line from CARMEN log (remmision "
+            "vals):\n'%s'\n",
+            std::string(line).c_str());
+    }
+
+    finishLaserEntry(S, line, obsLaser_ptr, true /*isRobotLaser*/, time_start_log, out);
+  }
+  else if (startsWithI(line, "flaser") || startsWithI(line, "rlaser"))
+  {
+    auto obsLaser_ptr = std::make_shared<CObservation2DRangeScan>();
+    CObservation2DRangeScan* obsLaser = obsLaser_ptr.get();
+
+    std::string_view label;
+    long nRanges = 0;
+    if (!(S.next(label) && S.next(nRanges)))
+      THROW_EXCEPTION_FMT(
+          "Error parsing line from CARMEN log (params):\n'%s'\n", std::string(line).c_str());
+
+    obsLaser->sensorLabel = std::string(label);
+
+    const bool isFront = (line[0] == 'F' || line[0] == 'f');
+    const double maxRange = isFront ? params.front_max : params.rear_max;
+    const double resolutionDeg = isFront ? params.front_res_deg : params.rear_res_deg;
+    obsLaser->maxRange = d2f(maxRange);
+    obsLaser->aperture = d2f(DEG2RAD(resolutionDeg) * nRanges);
+
+    obsLaser->resizeScan(nRanges);
+
+    for (long i = 0; i < nRanges; i++)
+    {
+      double range;
+      if (!S.next(range))
+        THROW_EXCEPTION_FMT(
+            "Error parsing line from CARMEN log (ranges):\n'%s'\n", std::string(line).c_str());
+      obsLaser->setScanRange(i, d2f(range));
+      obsLaser->setScanRangeValidity(i, !(range >= obsLaser->maxRange || range <= 0));
+    }
+
+    finishLaserEntry(S, line, obsLaser_ptr, false /*isRobotLaser*/, time_start_log, out);
+  }
+  else if (startsWithI(line, "param "))
+  {
+    TCarmenTokenizer P(line.data(), line.data() + line.size());
+    std::string_view tag, key;
+    double val;
+    if (!(P.next(tag) && P.next(key) && P.next(val))) return;  // non-numeric PARAMs are ignored
+
+    std::string k(key);
+    for (auto& c : k) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+
+    if (k == "robot_front_laser_max") params.front_max = val;
+    else if (k == "laser_front_laser_resolution") params.front_res_deg = val;
+    else if (k == "robot_rear_laser_max") params.rear_max = val;
+    else if (k == "laser_rear_laser_resolution") params.rear_res_deg = val;
+  }
+}
+
+}  // namespace
+
+// Read the declaration in the .h file for documentation.
+void mrpt::obs::carmen_log_import(
+    const std::string& logFileName,
+    const std::function<void(
+        size_t lineIndex, size_t lineCount, std::vector<mrpt::obs::CObservation::Ptr>& obs)>&
+        onParsedLine,
+    const mrpt::system::TTimeStamp& time_start_log, const TCarmenLogImportOptions& options)
+{
+  // Slurp the whole file: CARMEN logs are line-oriented plain text, so one
+  // contiguous buffer lets us hand byte ranges to the workers without any
+  // copies.
+  std::string buf;
+  {
+    std::ifstream f(logFileName, std::ios::binary);
+    if (!f.is_open())
+      THROW_EXCEPTION_FMT("Error opening for read: '%s'", logFileName.c_str());
+    f.seekg(0, std::ios::end);
+    buf.resize(static_cast<size_t>(f.tellg()));
+    f.seekg(0);
+    f.read(buf.data(), buf.size());
+  }
+
+  // Split on line boundaries, dropping empty lines (as the line-by-line
+  // parser does):
+  std::vector<std::string_view> lines;
+  for (size_t pos = 0; pos < buf.size();)
+  {
+    size_t eol = buf.find('\n', pos);
+    if (eol == std::string::npos) eol = buf.size();
+    std::string_view l(buf.data() + pos, eol - pos);
+    pos = eol + 1;
+
+    // trim:
+    while (!l.empty() && std::isspace(static_cast<unsigned char>(l.front()))) l.remove_prefix(1);
+    while (!l.empty() && std::isspace(static_cast<unsigned char>(l.back()))) l.remove_suffix(1);
+    if (!l.empty()) lines.push_back(l);
+  }
+  const size_t nLines = lines.size();
+  if (!nLines) return;
+
+  const size_t nThreads = options.numberOfThreads != 0
+      ? options.numberOfThreads
+      : std::max(1u, std::thread::hardware_concurrency());
+  const size_t chunkSize = (nLines + nThreads - 1) / std::max<size_t>(1, nThreads);
+
+  // PARAM entries carry state into later lines. Pre-scan them sequentially
+  // (they are rare and short) so each chunk starts from the parameters in
+  // effect at its first line; workers keep applying in-chunk PARAMs as they
+  // pass over them.
+  std::vector<TCarmenLaserParams> chunkStartParams;
+  {
+    TCarmenLaserParams running;
+    std::vector<CObservation::Ptr> dummy;
+    for (size_t i = 0; i < nLines; i++)
+    {
+      if (i % chunkSize == 0) chunkStartParams.push_back(running);
+      if (startsWithI(lines[i], "param ")) parseCarmenLineFast(lines[i], running, time_start_log, dummy);
+    }
+  }
+
+  std::vector<std::vector<CObservation::Ptr>> perLine(nLines);
+
+  std::vector<std::thread> workers;
+  std::vector<std::exception_ptr> excepts(chunkStartParams.size());
+
+  for (size_t chunk = 0; chunk < chunkStartParams.size(); chunk++)
+  {
+    const size_t i0 = chunk * chunkSize;
+    const size_t i1 = std::min(nLines, i0 + chunkSize);
+    workers.emplace_back(
+        [&, chunk, i0, i1]()
+        {
+          try
+          {
+            TCarmenLaserParams params = chunkStartParams[chunk];
+            for (size_t i = i0; i < i1; i++)
+              parseCarmenLineFast(lines[i], params, time_start_log, perLine[i]);
+          }
+          catch (...)
+          {
+            excepts[chunk] = std::current_exception();
+          }
+        });
+  }
+  for (auto& t : workers) t.join();
+  for (auto& e : excepts)
+    if (e) std::rethrow_exception(e);
+
+  // Deliver in original line order:
+  for (size_t i = 0; i < nLines; i++) onParsedLine(i, nLines, perLine[i]);
+}
@@ -0,0 +1,95 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/obs/CObservation2DRangeScan.h>
+#include <mrpt/obs/carmen_log_tools.h>
+#include <mrpt/system/filesystem.h>
+
+#include <fstream>
+#include <sstream>
+
+using namespace mrpt::obs;
+
+namespace
+{
+// A tiny synthetic CARMEN log: PARAMs followed by FLASER entries whose
+// max-range depends on the preceding PARAM state.
+const char* TEST_LOG =
+    "PARAM robot_front_laser_max 50.0\n"
+    "PARAM laser_front_laser_resolution 1.0\n"
+    "FLASER 4 1.0 2.0 3.0 60.0 1.0 2.0 0.1 1.0 2.0 0.1 0.1 myrobot\n"
+    "\n"
+    "PARAM robot_front_laser_max 30.0\n"
+    "FLASER 4 1.0 2.0 3.0 40.0 1.5 2.5 0.2 1.5 2.5 0.2 0.2 myrobot\n";
+
+std::vector<std::vector<CObservation::Ptr>> parseSequentially(const mrpt::system::TTimeStamp& t0)
+{
+  std::istringstream ss(TEST_LOG);
+  std::vector<std::vector<CObservation::Ptr>> ret;
+  std::vector<CObservation::Ptr> obs;
+  while (carmen_log_parse_line(ss, obs, t0))
+    if (!obs.empty()) ret.push_back(obs);
+  return ret;
+}
+}  // namespace
+
+TEST(carmen_log_tools, parallelImportMatchesSequential)
+{
+  const auto t0 = mrpt::Clock::now();
+
+  const std::string tmpFile = mrpt::system::getTempFileName();
+  {
+    std::ofstream f(tmpFile);
+    f << TEST_LOG;
+  }
+
+  const auto seq = parseSequentially(t0);
+  ASSERT_EQ(seq.size(), 2U);
+
+  for (unsigned int nThreads : {1U, 4U})
+  {
+    TCarmenLogImportOptions opts;
+    opts.numberOfThreads = nThreads;
+
+    std::vector<std::vector<CObservation::Ptr>> par;
+    size_t linesSeen = 0;
+    carmen_log_import(
+        tmpFile,
+        [&](size_t lineIdx, size_t lineCount, std::vector<CObservation::Ptr>& obs)
+        {
+          EXPECT_EQ(lineIdx, linesSeen++);
+          EXPECT_EQ(lineCount, 5U);  // empty line is skipped
+          if (!obs.empty()) par.push_back(obs);
+        },
+        t0, opts);
+
+    ASSERT_EQ(par.size(), seq.size());
+    for (size_t i = 0; i < seq.size(); i++)
+    {
+      ASSERT_EQ(par[i].size(), seq[i].size());  // odometry + laser
+      const auto seqScan = std::dynamic_pointer_cast<CObservation2DRangeScan>(seq[i].back());
+      const auto parScan = std::dynamic_pointer_cast<CObservation2DRangeScan>(par[i].back());
+      ASSERT_TRUE(seqScan && parScan);
+
+      // PARAM state must be applied per-line even across chunk boundaries:
+      EXPECT_FLOAT_EQ(parScan->maxRange, seqScan->maxRange);
+      EXPECT_FLOAT_EQ(parScan->aperture, seqScan->aperture);
+      ASSERT_EQ(parScan->getScanSize(), seqScan->getScanSize());
+      for (size_t k = 0; k < seqScan->getScanSize(); k++)
+      {
+        EXPECT_FLOAT_EQ(parScan->getScanRange(k), seqScan->getScanRange(k));
+        EXPECT_EQ(parScan->getScanRangeValidity(k), seqScan->getScanRangeValidity(k));
+      }
+      EXPECT_EQ(parScan->sensorPose, seqScan->sensorPose);
+    }
+  }
+
+  mrpt::system::deleteFile(tmpFile);
+}
@@ -0,0 +1,96 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include "obs-precomp.h"  // Precompiled headers
+//
+#include <mrpt/obs/imu_preintegration.h>
+#include <mrpt/poses/Lie/SO.h>
+
+#include <Eigen/Dense>
+
+using namespace mrpt::obs;
+using namespace mrpt::math;
+
+/** Applies a rotation matrix to a vector */
+static TVector3D rotate(const CMatrixDouble33& R, const TVector3D& v)
+{
+  return {
+      R(0, 0) * v.x + R(0, 1) * v.y + R(0, 2) * v.z,
+      R(1, 0) * v.x + R(1, 1) * v.y + R(1, 2) * v.z,
+      R(2, 0) * v.x + R(2, 1) * v.y + R(2, 2) * v.z};
+}
+
+TIMUPreintegrationResult mrpt::obs::imu_preintegrate(
+    const CObservationIMUBatch& batch, const TIMUPreintegrationParams& params,
+    bool keepPerSampleRotations)
+{
+  ASSERT_EQUAL_(batch.angularVelocities.size(), batch.timeOffsets.size());
+  ASSERT_EQUAL_(batch.accelerations.size(), batch.timeOffsets.size());
+
+  TIMUPreintegrationResult r;
+
+  const size_t N = batch.size();
+  if (keepPerSampleRotations)
+  {
+    r.sampleRotations.reserve(N);
+    if (N) r.sampleRotations.push_back(r.deltaR);
+  }
+  if (N < 2) return r;
+
+  // Contiguous sample block: one sweep, forward Euler per interval.
+  const double* ts = batch.timeOffsets.data();
+  const TVector3D* ws = batch.angularVelocities.data();
+  const TVector3D* as = batch.accelerations.data();
+
+  for (size_t i = 0; i + 1 < N; i++)
+  {
+    const double dt = ts[i + 1] - ts[i];
+    ASSERT_GE_(dt, 0);
+
+    const TVector3D a = as[i] - params.accelBias;
+    const TVector3D aRot = rotate(r.deltaR, a);
+
+    // Order matters: position uses the velocity and attitude at t_i.
+    r.deltaP += r.deltaV * dt + aRot * (0.5 * dt * dt);
+    r.deltaV += aRot * dt;
+
+    const TVector3D w = ws[i] - params.gyroBias;
+    mrpt::poses::Lie::SO<3>::tangent_vector wdt;
+    wdt[0] = w.x * dt;
+    wdt[1] = w.y * dt;
+    wdt[2] = w.z * dt;
+    const CMatrixDouble33 incR = mrpt::poses::Lie::SO<3>::exp(wdt);
+    r.deltaR.asEigen() = (r.deltaR.asEigen() * incR.asEigen()).eval();
+
+    if (keepPerSampleRotations) r.sampleRotations.push_back(r.deltaR);
+  }
+  r.deltaT = ts[N - 1] - ts[0];
+
+  return r;
+}
+
+void TIMUPreintegrationResult::predict(
+    const mrpt::poses::CPose3D& pose0, const TVector3D& vel0, const TVector3D& gravity,
+    mrpt::poses::CPose3D& pose1, TVector3D& vel1) const
+{
+  const CMatrixDouble33& R0 = pose0.getRotationMatrix();
+
+  CMatrixDouble33 R1;
+  R1.asEigen() = R0.asEigen() * deltaR.asEigen();
+
+  const TVector3D p0 = {pose0.x(), pose0.y(), pose0.z()};
+  const TVector3D p1 =
+      p0 + vel0 * deltaT + gravity * (0.5 * deltaT * deltaT) + rotate(R0, deltaP);
+
+  vel1 = vel0 + gravity * deltaT + rotate(R0, deltaV);
+
+  const double t_vals[3] = {p1.x, p1.y, p1.z};
+  const CVectorFixedDouble<3> t(t_vals);
+  pose1 = mrpt::poses::CPose3D(R1, t);
+}
@@ -108,6 +108,8 @@ class Buffer
 
   /** Reserves byteCount bytes in the buffer and copy to it the provided data.
    * create() and bind() must be called before using this method.
+   * `data` can be nullptr to just reserve uninitialized storage, to be
+   * filled later with update().
    */
   void allocate(const void* data, int byteCount)
   {
@@ -115,6 +117,26 @@ class Buffer
     m_impl.allocate(data, byteCount);
   }
 
+  /** Overwrites a sub-range of an already allocate()'d buffer (via
+   * glBufferSubData()), without reallocating the GPU storage.
+   * create() and bind() must be called before using this method, and
+   * `offset + byteCount` must not exceed byteCount().
+   * \note [New in MRPT 2.14.5]
+   */
+  void update(const void* data, int byteCount, int offset = 0)
+  {
+    auto lck = mrpt::lockHelper(m_implMtx.data);
+    m_impl.update(data, byteCount, offset);
+  }
+
+  /** Size, in bytes, of the GPU storage from the last call to allocate(), or
+   * 0 if never allocated. \note [New in MRPT 2.14.5] */
+  int byteCount() const
+  {
+    auto lck = mrpt::lockHelper(m_implMtx.data);
+    return m_impl.byte_count;
+  }
+
  private:
   struct RAII_Impl
   {
@@ -129,9 +151,11 @@ class Buffer
     void bind();
     void unbind();
     void allocate(const void* data, int byteCount);
+    void update(const void* data, int byteCount, int offset);
 
     bool created = false;
     unsigned int buffer_id = 0;
+    int byte_count = 0;
     std::thread::id created_from;
   };
   RAII_Impl m_impl;
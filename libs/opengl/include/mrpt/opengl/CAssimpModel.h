@@ -98,13 +98,25 @@ class CAssimpModel :
        loadScene(). \note (New in MRPT 2.5.0) */
       IgnoreMaterialColor = 0x0100,
       /** Displays messages on loaded textures, etc. */
-      Verbose = 0x1000
+      Verbose = 0x1000,
+      /** Neither read nor write the baked binary cache sidecar file, always
+       running the full Assimp import. \note (New in MRPT 2.14.5) */
+      IgnoreBakedCache = 0x2000
     };
   };
 
   using filepath_t = std::string;
 
   /**  Loads a scene from a file in any supported file.
+   *
+   * After a successful first import, the post-processed scene is baked into
+   * a binary sidecar file (`<file_name>.assbin-cache`) so later loads of the
+   * unmodified model skip the full Assimp import and just bulk-read the
+   * blob, which is typically an order of magnitude faster. The cache is
+   * transparently rebuilt whenever the source file or the import flags
+   * change, and can be disabled with LoadFlags::IgnoreBakedCache.
+   * \note (Baked cache: new in MRPT 2.14.5)
+   *
    * \exception std::runtime_error On any error during loading or importing
    * the file.
    */
@@ -173,6 +185,16 @@ class CAssimpModel :
 
   void after_load_model();
 
+  /** Tries to load the baked "assbin" sidecar written by a former import of
+   * the same model file with the same flags; returns false if it is
+   * missing, stale, or unreadable. \sa loadScene */
+  bool internal_load_baked_cache(
+      const std::string& cacheFile, const std::string& modelFile, const uint32_t pFlags);
+  /** Best-effort write of the baked cache sidecar; failures (e.g. read-only
+   * model directory) are silently ignored. \sa loadScene */
+  void internal_save_baked_cache(
+      const std::string& cacheFile, const std::string& modelFile, const uint32_t pFlags);
+
 };  // namespace mrpt::opengl
 
 }  // namespace mrpt::opengl
@@ -0,0 +1,101 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#pragma once
+
+#include <mrpt/opengl/CFBORender.h>
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mrpt::opengl
+{
+/** Pool of CFBORender workers for high-throughput off-screen rendering.
+ *
+ * Each worker thread owns one persistent CFBORender instance (hence one EGL
+ * context, created once and kept current on that thread), so rendering many
+ * views per second does not pay the per-render context creation/switch cost
+ * that creating throw-away CFBORender objects would incur. Typical use case:
+ * simulating depth/RGBD cameras for dozens of robots from the same world
+ * model.
+ *
+ * Render requests are queued and return a std::future with the resulting
+ * images; any worker may serve any request. Since scene objects keep
+ * per-thread GPU buffer state, repeatedly rendering the same Scene::Ptr lets
+ * each worker reuse its already-uploaded vertex buffers across calls; the
+ * first render on each worker uploads them once.
+ *
+ * The caller must not modify a scene while render requests on it are
+ * in flight.
+ *
+ * \note [New in MRPT 2.14.5]
+ * \sa CFBORender
+ * \ingroup mrpt_opengl_grp
+ */
+class CFBORenderPool
+{
+ public:
+  /** Output of one asynchronous render request. */
+  struct TRenderResult
+  {
+    mrpt::img::CImage rgb;           //!< Left empty if RGB was not requested
+    mrpt::math::CMatrixFloat depth;  //!< Left empty if depth was not requested
+  };
+
+  /** Starts `numThreads` workers, each with its own CFBORender built from
+   * the given parameters. Contexts are created lazily, upon each worker's
+   * first render request. */
+  CFBORenderPool(size_t numThreads, const CFBORender::Parameters& p = CFBORender::Parameters());
+
+  /** Waits for pending requests, then stops and joins all workers. */
+  ~CFBORenderPool();
+
+  /** Enqueues rendering the scene from the given camera pose, returning both
+   * the RGB image and the linear depth image (see CFBORender::render_RGBD()
+   * for conventions on depth values).
+   * The future throws if rendering failed (e.g. no EGL support). */
+  std::future<TRenderResult> render_RGBD_async(const Scene::Ptr& scene, const CCamera& camera);
+
+  /** Like render_RGBD_async(), but renders the depth image only, which is
+   * cheaper if the RGB channel is not needed. */
+  std::future<TRenderResult> render_depth_async(const Scene::Ptr& scene, const CCamera& camera);
+
+  size_t size() const { return m_threads.size(); }
+
+  /** Number of requests enqueued and not yet taken by a worker. */
+  size_t pendingTasks() const;
+
+ private:
+  struct TTask
+  {
+    Scene::Ptr scene;
+    CCamera camera;
+    bool withRGB = true;
+    std::promise<TRenderResult> result;
+  };
+
+  std::future<TRenderResult> internal_enqueue(
+      const Scene::Ptr& scene, const CCamera& camera, const bool withRGB);
+
+  void internal_workerLoop(const CFBORender::Parameters p);
+
+  mutable std::mutex m_queueMtx;
+  std::condition_variable m_queueCV;
+  std::deque<TTask> m_queue;
+  bool m_shutdown = false;
+
+  std::vector<std::thread> m_threads;
+};
+
+}  // namespace mrpt::opengl
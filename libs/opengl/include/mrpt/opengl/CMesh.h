@@ -129,6 +129,19 @@ class CMesh : public CRenderizableShaderTexturedTriangles, public CRenderizableS
    * mesh grid */
   void setZ(const mrpt::math::CMatrixDynamic<float>& in_Z);
 
+  /** Overwrites the block of the Z matrix starting at (row0,col0) with \a
+   * patch, then regenerates in place only the triangles and vertex normals
+   * affected by that dirty sub-rectangle: much faster than setZ() plus a
+   * full triangle rebuild for small patches over large meshes.
+   * Automatically falls back to marking the whole mesh as outdated when the
+   * in-place patch is not possible (mask in use, color-from-Z mode, or
+   * triangles not built yet).
+   * \note The object bounding box is only ever enlarged by this method; call
+   * setZ() to shrink it back.
+   * \note [New in MRPT 2.14.5] \sa setZ */
+  void setZPartial(
+      const mrpt::math::CMatrixDynamic<float>& patch, const size_t row0, const size_t col0);
+
   /** Returns a reference to the internal Z matrix, allowing changing it
    * efficiently */
   inline void getZ(mrpt::math::CMatrixFloat& out) const { out = Z; }
@@ -62,6 +62,17 @@ class CPointCloud :
   /** Do needed internal work if all points are new (octree rebuilt,...) */
   void markAllPointsAsNew();
 
+  /** Records the partial VBO update hint for a change to the i'th point:
+   * only valid while not coloring from depth, since in that mode a single
+   * point may shift the color mapping of the whole cloud. */
+  void internal_markPointDirty(const size_t i)
+  {
+    if (m_colorFromDepth == colNone)
+      markPointsDirtyFrom(i);
+    else
+      resetPointsDirtyHint();
+  }
+
  protected:
   /** @name PLY Import virtual methods to implement in base classes
     @{ */
@@ -131,6 +142,7 @@ class CPointCloud :
     m_minmax_valid = false;
     wfWriteLock.unlock();
     markAllPointsAsNew();
+    resetPointsDirtyHint();
   }
 
   /** Like STL std::vector's reserve */
@@ -154,6 +166,7 @@ class CPointCloud :
     m_minmax_valid = false;
     wfWriteLock.unlock();
     markAllPointsAsNew();
+    resetPointsDirtyHint();
   }
 
   /// \overload Prefer setAllPointsFast() instead
@@ -170,6 +183,7 @@ class CPointCloud :
     m_minmax_valid = false;
     wfWriteLock.unlock();
     markAllPointsAsNew();
+    resetPointsDirtyHint();
     CRenderizable::notifyChange();
   }
 
@@ -232,6 +246,7 @@ class CPointCloud :
     m_minmax_valid = false;
     wfWriteLock.unlock();
     markAllPointsAsNew();
+    internal_markPointDirty(i);
   }
 
   /** Load the points from any other point map class supported by the
@@ -272,16 +287,19 @@ class CPointCloud :
   void enableColorFromX(bool v = true)
   {
     m_colorFromDepth = v ? CPointCloud::colX : CPointCloud::colNone;
+    resetPointsDirtyHint();
     CRenderizable::notifyChange();
   }
   void enableColorFromY(bool v = true)
   {
     m_colorFromDepth = v ? CPointCloud::colY : CPointCloud::colNone;
+    resetPointsDirtyHint();
     CRenderizable::notifyChange();
   }
   void enableColorFromZ(bool v = true)
   {
     m_colorFromDepth = v ? CPointCloud::colZ : CPointCloud::colNone;
+    resetPointsDirtyHint();
     CRenderizable::notifyChange();
   }
 
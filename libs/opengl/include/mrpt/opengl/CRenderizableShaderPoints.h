@@ -13,6 +13,9 @@
 #include <mrpt/opengl/CRenderizable.h>
 #include <mrpt/opengl/VertexArrayObject.h>
 
+#include <algorithm>
+#include <optional>
+
 namespace mrpt::opengl
 {
 /** Renderizable generic renderer for objects using the points shader.
@@ -67,14 +70,61 @@ class CRenderizableShaderPoints : public virtual CRenderizable
   void setVariablePointSize_DepthScale(float v) { m_variablePointSize_DepthScale = v; }
   float getVariablePointSize_DepthScale() const { return m_variablePointSize_DepthScale; }
 
+  /** @name Screen-size driven level-of-detail (LOD) decimation
+   * @{ */
+  /** Enables/disables LOD decimation (default: disabled).
+   *
+   * When enabled, points are drawn through an index table holding a random
+   * permutation of all point indices, so any prefix of it is a uniform
+   * subsample of the cloud. Each frame, the number of indices actually drawn
+   * is chosen from the on-screen projected area of the (cached) bounding
+   * box times mrpt::global_settings::OCTREE_RENDER_MAX_DENSITY_POINTS_PER_SQPIXEL(),
+   * so e.g. a zoomed-out view of a city-sized cloud renders only a small
+   * fraction of its points.
+   *
+   * Points appended after the table is built are shuffled among themselves
+   * only, so heavily-decimated views may under-represent the newest points
+   * of an incrementally-grown cloud until it is rebuilt (e.g. clear()+load).
+   *
+   * This flag is a run-time rendering option: it is *not* serialized.
+   * \note [New in MRPT 2.14.5]
+   */
+  void enablePointCloudLOD(bool enable = true)
+  {
+    m_lodEnabled = enable;
+    notifyChange();
+  }
+  bool isPointCloudLODEnabled() const { return m_lodEnabled; }
+
+  /** Minimum number of points to draw when LOD decimation kicks in
+   * (default: 1000). \sa enablePointCloudLOD() */
+  void setPointCloudLODMinPoints(size_t n) { m_lodMinPointCount = n; }
+  size_t getPointCloudLODMinPoints() const { return m_lodMinPointCount; }
+  /** @} */
+
   // See base docs
   void freeOpenGLResources() override
   {
     m_vertexBuffer.destroy();
     m_colorBuffer.destroy();
+    m_lodIndexBuffer.destroy();
     m_vao.destroy();
   }
 
+  // See base docs. Overriden here to invalidate the partial-update hint,
+  // since changing the object color affects the whole color buffer:
+  using CRenderizable::setColor_u8;
+  CRenderizable& setColor_u8(const mrpt::img::TColor& c) override
+  {
+    resetPointsDirtyHint();
+    return CRenderizable::setColor_u8(c);
+  }
+  CRenderizable& setColorA_u8(const uint8_t a) override
+  {
+    resetPointsDirtyHint();
+    return CRenderizable::setColorA_u8(a);
+  }
+
   /** @name Raw access to point shader buffer data
    * @{ */
   const auto& shaderPointsVertexPointBuffer() const { return m_vertex_buffer_data; }
@@ -100,9 +150,54 @@ class CRenderizableShaderPoints : public virtual CRenderizable
   void params_serialize(mrpt::serialization::CArchive& out) const;
   void params_deserialize(mrpt::serialization::CArchive& in);
 
+  /** For derived classes: hints that, since the last render, only the points
+   * with indices >= firstIdx changed (or were appended) in both
+   * m_vertex_buffer_data and m_color_buffer_data, so renderUpdateBuffers()
+   * can upload just that sub-range instead of re-uploading the whole VBOs.
+   * The hint is consumed (reset) by the next upload; mutations that may
+   * touch earlier points must instead use resetPointsDirtyHint() (or just
+   * notifyChange(), if the hint was never set since the last render).
+   * \note [New in MRPT 2.14.5]
+   */
+  void markPointsDirtyFrom(const size_t firstIdx)
+  {
+    auto lck = mrpt::lockHelper(m_dirtyHintMtx.data);
+    m_firstDirtyIdx = std::min(m_firstDirtyIdx.value_or(firstIdx), firstIdx);
+  }
+
+  /** Discards any pending partial-update hint, forcing the next
+   * renderUpdateBuffers() to re-upload the whole buffers.
+   * \sa markPointsDirtyFrom() */
+  void resetPointsDirtyHint()
+  {
+    auto lck = mrpt::lockHelper(m_dirtyHintMtx.data);
+    m_firstDirtyIdx.reset();
+  }
+
  private:
   mutable Buffer m_vertexBuffer, m_colorBuffer;
   mutable VertexArrayObject m_vao;
+
+  /** See markPointsDirtyFrom() */
+  mutable std::optional<size_t> m_firstDirtyIdx;
+  mutable mrpt::containers::NonCopiableData<std::mutex> m_dirtyHintMtx;
+
+  /** \sa enablePointCloudLOD() */
+  bool m_lodEnabled = false;
+  /** \sa setPointCloudLODMinPoints() */
+  size_t m_lodMinPointCount = 1000;
+  /** Random permutation of [0, N) point indices; any prefix is a uniform
+   * subsample. \sa enablePointCloudLOD() */
+  mutable std::vector<uint32_t> m_lodIndices;
+  mutable Buffer m_lodIndexBuffer{Buffer::Type::ElementIndex};
+
+  /** Refreshes m_lodIndices & its GPU buffer after the point count changed.
+   * Called from renderUpdateBuffers() with m_pointsMtx already held. */
+  void internal_updateLodIndexBuffer() const;
+
+  /** Number of LOD points to draw for the current viewpoint, from the
+   * projected screen area of the cached bounding box. */
+  size_t internal_lodPointCount(const TRenderMatrices& state) const;
 };
 
 }  // namespace mrpt::opengl
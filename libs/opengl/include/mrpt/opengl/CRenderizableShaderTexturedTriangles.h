@@ -15,6 +15,7 @@
 #include <mrpt/opengl/Texture.h>
 #include <mrpt/opengl/VertexArrayObject.h>
 
+#include <cstdint>
 #include <shared_mutex>
 
 namespace mrpt::opengl
@@ -57,6 +58,9 @@ class CRenderizableShaderTexturedTriangles : public virtual CRenderizable
    * the images are not 2^N x 2^M, they will be internally filled to its
    * dimensions to be powers of two)
    * \note Images are copied, the original ones can be deleted.
+   * \note [New in MRPT 2.14.5] Re-assigning images whose pixel content is
+   * identical to the current ones is detected (via a content hash) and
+   * becomes a no-op, avoiding the costly texture re-upload.
    */
   void assignImage(const mrpt::img::CImage& img, const mrpt::img::CImage& imgAlpha);
 
@@ -129,6 +133,10 @@ class CRenderizableShaderTexturedTriangles : public virtual CRenderizable
   mutable mrpt::img::CImage m_textureImage{4, 4};
   mutable mrpt::img::CImage m_textureImageAlpha;
 
+  /** Content hash of the assigned texture image(s), used by assignImage()
+   * to skip redundant re-uploads. Runtime state only, not serialized. */
+  uint64_t m_textureContentHash = 0;
+
   /** Of the texture using "m_textureImageAlpha" */
   mutable bool m_enableTransparency{false};
   bool m_textureInterpolate = false;
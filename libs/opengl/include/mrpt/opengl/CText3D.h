@@ -47,6 +47,7 @@ class CText3D : public CRenderizableShaderText
   /** Sets the displayed string */
   inline void setString(const std::string& s)
   {
+    if (m_str == s) return;
     m_str = s;
     CRenderizable::notifyChange();
   }
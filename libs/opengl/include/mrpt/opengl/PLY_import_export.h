@@ -68,11 +68,38 @@ class PLY_Importer
 
   virtual void PLY_import_set_vertex_timestamp(size_t idx, const double unixTimestamp) = 0;
 
+  /** Called with blocks of consecutive vertices instead of one
+   * PLY_import_set_vertex() call per point: the fast import path for binary
+   * little-endian PLY files parses the file in chunks and hands each chunk
+   * here as soon as it is decoded, avoiding both the per-point virtual call
+   * and a full-file staging buffer. `colors` is nullptr if the file carries
+   * no color information.
+   * The default implementation forwards to PLY_import_set_vertex() for each
+   * point, so existing importers keep working unchanged; containers with
+   * columnar storage should override it with a direct bulk write.
+   * \note [New in MRPT 2.14.5]
+   */
+  virtual void PLY_import_set_vertex_block(
+      size_t first_idx,
+      size_t num_pts,
+      const mrpt::math::TPoint3Df* pts,
+      const mrpt::img::TColorf* colors);
+
   /** @} */
 
  private:
   std::string m_ply_import_last_error;
 
+  /** Fast path of loadFromPlyFile() for binary little-endian files:
+   * memory-mapped input and chunked parallel parsing.
+   * \return 1 on success, 0 if the file requires the generic parser (ASCII,
+   * big-endian, exotic layouts...), -1 on error (m_ply_import_last_error is
+   * then set). */
+  int internal_loadFromPlyBinaryFast(
+      const std::string& filename,
+      std::vector<std::string>* file_comments,
+      std::vector<std::string>* file_obj_info);
+
 };  // End of class def.
 
 /** A virtual base class that implements the capability of exporting 3D point
@@ -12,6 +12,8 @@
 #include <mrpt/opengl/CRenderizable.h>
 #include <mrpt/opengl/Viewport.h>
 
+#include <optional>
+
 /** The namespace for 3D scene representation and rendering. See also the <a
  * href="mrpt-opengl.html" > summary page</a> of the mrpt-opengl library for
  * more info and thumbnails of many of the render primitive.
@@ -197,6 +199,55 @@ class Scene : public mrpt::serialization::CSerializable
    */
   bool loadFromFile(const std::string& fil);
 
+  /** One entry of the object directory of the chunked ".3Dscene" format.
+   * \sa readChunkedDirectory, saveToFileChunked
+   * \note [New in MRPT 2.14.5] */
+  struct TChunkedObjectEntry
+  {
+    uint32_t viewportIndex = 0;
+    /** Runtime class name of the stored object, e.g. "mrpt::opengl::CPointCloud" */
+    std::string className;
+    /** Object bounding box, in scene coordinates. Only meaningful if bboxValid */
+    mrpt::math::TBoundingBox bbox = mrpt::math::TBoundingBox::PlusMinusInfinity();
+    bool bboxValid = false;
+    /** Byte range of the gz-compressed object block within the file */
+    uint64_t fileOffset = 0, compressedSize = 0, uncompressedSize = 0;
+  };
+
+  /** Saves the scene in the chunked ".3Dscene" binary format (v2): each
+   * object is stored as an independent gz-compressed block, and an object
+   * directory (viewport, class name, bounding box, byte range) is appended at
+   * the end of the file. Unlike the monolithic gz stream of saveToFile(),
+   * this format allows parallel decompression and partial (e.g.
+   * frustum-driven) loading; see loadFromFileChunked().
+   * `compress_level`: 0=none, 1=best speed (default), 9=maximum.
+   * \return false on any error.
+   * \note [New in MRPT 2.14.5]
+   */
+  bool saveToFileChunked(const std::string& fil, int compress_level = 1) const;
+
+  /** Loads a scene stored in the chunked format of saveToFileChunked().
+   * If `onlyObjectsIntersecting` is given, only objects whose stored bounding
+   * box intersects it are loaded (objects without a valid bbox are always
+   * loaded); the rest can be fetched later by re-loading with a larger box,
+   * e.g. as the viewport frustum moves. Object blocks are decompressed and
+   * deserialized concurrently by `num_threads` threads (0=auto: half the
+   * hardware threads).
+   * \return false on any error (including: not a chunked-format file).
+   * \note [New in MRPT 2.14.5]
+   */
+  bool loadFromFileChunked(
+      const std::string& fil,
+      const std::optional<mrpt::math::TBoundingBox>& onlyObjectsIntersecting = std::nullopt,
+      unsigned int num_threads = 0);
+
+  /** Reads the object directory of a chunked ".3Dscene" file without loading
+   * any object, e.g. for a viewer to decide what to load first.
+   * \return false on any error (including: not a chunked-format file).
+   * \note [New in MRPT 2.14.5]
+   */
+  static bool readChunkedDirectory(const std::string& fil, std::vector<TChunkedObjectEntry>& dir);
+
   /** Traces a ray
    */
   bool traceRay(const mrpt::poses::CPose3D& o, double& dist) const;
@@ -12,6 +12,7 @@
 #include <mrpt/img/CImage.h>
 
 #include <array>
+#include <cstdint>
 #include <optional>
 
 namespace mrpt::opengl
@@ -76,6 +77,10 @@ class Texture
   /** This is how an 2D texture image is loaded into this object, and a
    * texture ID is generated underneath. Valid image formats are 8bit per
    * channel RGB or RGBA.
+   *
+   * \note [New in MRPT 2.14.5] Pixel data is staged through a small ring of
+   * pixel-unpack buffer objects (when supported by the OpenGL driver), so
+   * this call no longer blocks on the GPU transfer itself.
    */
   void assignImage2D(const mrpt::img::CImage& rgb, const Options& o, int textureUnit = 0);
 
@@ -132,4 +137,10 @@ class Texture
 texture_name_t getNewTextureNumber();
 void releaseTextureName(const texture_name_t& t);
 
+/** Computes a 64-bit hash (FNV-1a over the image dimensions and pixel rows)
+ * of an image, used to detect and skip redundant texture re-uploads.
+ * Lazy-load images are forceLoad()'ed first.
+ * \note [New in MRPT 2.14.5] */
+uint64_t textureImageContentHash(const mrpt::img::CImage& im);
+
 }  // namespace mrpt::opengl
@@ -74,6 +74,7 @@ void Buffer::RAII_Impl::destroy()
   }
 #endif
   buffer_id = 0;
+  byte_count = 0;
   created = false;
 }
 
@@ -100,5 +101,15 @@ void Buffer::RAII_Impl::allocate(const void* data, int byteCount)
 #if MRPT_HAS_OPENGL_GLUT || MRPT_HAS_EGL
   ASSERT_(created);
   glBufferData(static_cast<GLenum>(type), byteCount, data, static_cast<GLenum>(usage));
+  byte_count = byteCount;
+#endif
+}
+
+void Buffer::RAII_Impl::update(const void* data, int byteCount, int offset)
+{
+#if MRPT_HAS_OPENGL_GLUT || MRPT_HAS_EGL
+  ASSERT_(created);
+  ASSERT_LE_(offset + byteCount, byte_count);
+  glBufferSubData(static_cast<GLenum>(type), offset, byteCount, data);
 #endif
 }
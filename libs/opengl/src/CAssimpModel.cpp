@@ -34,6 +34,8 @@
 
 #include <mrpt/core/lock_helper.h>
 #include <mrpt/core/round.h>
+#include <mrpt/io/CFileInputStream.h>
+#include <mrpt/io/CFileOutputStream.h>
 #include <mrpt/opengl/opengl_api.h>
 #include <mrpt/serialization/CArchive.h>
 #include <mrpt/system/filesystem.h>
@@ -43,6 +45,7 @@
 #include <mrpt/3rdparty/do_opencv_includes.h>
 #endif
 
+#include <cstring>
 #include <mutex>
 #include <optional>
 
@@ -478,6 +481,20 @@ void CAssimpModel::loadScene(const std::string& filepath, int flags)
   m_verboseLoad = !!(flags & LoadFlags::Verbose);
   m_ignoreMaterialColor = !!(flags & LoadFlags::IgnoreMaterialColor);
 
+  // Baked binary cache: once a model has been imported and post-processed,
+  // the result is stored as an "assbin" blob sidecar, so warm starts just
+  // bulk-read it and skip the full Assimp import:
+  const std::string cacheFile = filepath + ".assbin-cache";
+  const bool useBakedCache = !(flags & LoadFlags::IgnoreBakedCache);
+
+  if (useBakedCache && internal_load_baked_cache(cacheFile, filepath, pFlags))
+  {
+    if (m_verboseLoad) std::cout << "[CAssimpModel] Loaded baked cache: " << cacheFile << "\n";
+    m_modelPath = filepath;
+    after_load_model();
+    return;
+  }
+
   m_assimp_scene->scene = m_assimp_scene->importer.ReadFile(filepath.c_str(), pFlags);
 
   if (!m_assimp_scene->scene)
@@ -487,6 +504,8 @@ void CAssimpModel::loadScene(const std::string& filepath, int flags)
   }
   m_modelPath = filepath;
 
+  if (useBakedCache) internal_save_baked_cache(cacheFile, filepath, pFlags);
+
   after_load_model();
 
 #else
@@ -494,6 +513,98 @@ void CAssimpModel::loadScene(const std::string& filepath, int flags)
 #endif
 }
 
+#if (MRPT_HAS_OPENGL_GLUT || MRPT_HAS_EGL) && MRPT_HAS_ASSIMP
+namespace
+{
+// Header of the baked cache sidecar files (\sa CAssimpModel::loadScene):
+constexpr char BAKED_CACHE_MAGIC[8] = {'M', 'R', 'P', 'T', 'a', 's', 's', 'b'};
+constexpr uint32_t BAKED_CACHE_VERSION = 1;
+
+int64_t file_mtime_counts(const std::string& f)
+{
+  return mrpt::system::getFileModificationTime(f).time_since_epoch().count();
+}
+}  // namespace
+#endif
+
+bool CAssimpModel::internal_load_baked_cache(
+    [[maybe_unused]] const std::string& cacheFile,
+    [[maybe_unused]] const std::string& modelFile,
+    [[maybe_unused]] const uint32_t pFlags)
+{
+#if (MRPT_HAS_OPENGL_GLUT || MRPT_HAS_EGL) && MRPT_HAS_ASSIMP
+  try
+  {
+    if (!mrpt::system::fileExists(cacheFile)) return false;
+
+    mrpt::io::CFileInputStream f;
+    if (!f.open(cacheFile)) return false;
+    auto arch = mrpt::serialization::archiveFrom(f);
+
+    // Validate the header against the current source model file, so edited
+    // models (or different import flags) transparently rebuild the cache:
+    char magic[sizeof(BAKED_CACHE_MAGIC)];
+    arch.ReadBuffer(magic, sizeof(magic));
+    if (std::memcmp(magic, BAKED_CACHE_MAGIC, sizeof(magic)) != 0) return false;
+    if (arch.ReadAs<uint32_t>() != BAKED_CACHE_VERSION) return false;
+    if (arch.ReadAs<uint32_t>() != pFlags) return false;
+    if (arch.ReadAs<uint64_t>() != mrpt::system::getFileSize(modelFile)) return false;
+    if (arch.ReadAs<int64_t>() != file_mtime_counts(modelFile)) return false;
+
+    const auto blobSize = arch.ReadAs<uint64_t>();
+    ASSERT_(blobSize > 0);
+    std::vector<uint8_t> buf(blobSize);
+    arch.ReadBuffer(buf.data(), buf.size());
+
+    // Post-processing was already applied before baking => flags=0:
+    m_assimp_scene->scene =
+        m_assimp_scene->importer.ReadFileFromMemory(buf.data(), buf.size(), 0 /*flags*/);
+    return m_assimp_scene->scene != nullptr;
+  }
+  catch (const std::exception&)
+  {
+    // Stale or corrupted cache: fall back to the full import.
+    return false;
+  }
+#else
+  return false;
+#endif
+}
+
+void CAssimpModel::internal_save_baked_cache(
+    [[maybe_unused]] const std::string& cacheFile,
+    [[maybe_unused]] const std::string& modelFile,
+    [[maybe_unused]] const uint32_t pFlags)
+{
+#if (MRPT_HAS_OPENGL_GLUT || MRPT_HAS_EGL) && MRPT_HAS_ASSIMP
+  try
+  {
+    ASSERT_(m_assimp_scene->scene);
+    const auto* blob = m_assimp_scene->exporter.ExportToBlob(m_assimp_scene->scene, "assbin");
+    if (!blob || !blob->size) return;
+
+    mrpt::io::CFileOutputStream f;
+    if (!f.open(cacheFile)) return;  // e.g. read-only model directory
+    auto arch = mrpt::serialization::archiveFrom(f);
+
+    arch.WriteBuffer(BAKED_CACHE_MAGIC, sizeof(BAKED_CACHE_MAGIC));
+    arch.WriteAs<uint32_t>(BAKED_CACHE_VERSION);
+    arch.WriteAs<uint32_t>(pFlags);
+    arch.WriteAs<uint64_t>(mrpt::system::getFileSize(modelFile));
+    arch.WriteAs<int64_t>(file_mtime_counts(modelFile));
+    arch.WriteAs<uint64_t>(blob->size);
+    arch.WriteBuffer(blob->data, blob->size);
+
+    if (m_verboseLoad) std::cout << "[CAssimpModel] Wrote baked cache: " << cacheFile << "\n";
+  }
+  catch (const std::exception& e)
+  {
+    if (m_verboseLoad)
+      std::cerr << "[CAssimpModel] Ignoring error writing baked cache: " << e.what() << "\n";
+  }
+#endif
+}
+
 void CAssimpModel::after_load_model()
 {
 #if (MRPT_HAS_OPENGL_GLUT || MRPT_HAS_EGL) && MRPT_HAS_ASSIMP
@@ -0,0 +1,113 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include "opengl-precomp.h"  // Precompiled header
+//
+#include <mrpt/opengl/CFBORenderPool.h>
+#include <mrpt/system/thread_name.h>
+
+using namespace mrpt::opengl;
+
+CFBORenderPool::CFBORenderPool(size_t numThreads, const CFBORender::Parameters& p)
+{
+  ASSERT_GT_(numThreads, 0U);
+
+  m_threads.reserve(numThreads);
+  for (size_t i = 0; i < numThreads; i++)
+    m_threads.emplace_back(&CFBORenderPool::internal_workerLoop, this, p);
+}
+
+CFBORenderPool::~CFBORenderPool()
+{
+  {
+    std::unique_lock<std::mutex> lck(m_queueMtx);
+    m_shutdown = true;
+  }
+  m_queueCV.notify_all();
+  for (auto& t : m_threads)
+    if (t.joinable()) t.join();
+}
+
+std::future<CFBORenderPool::TRenderResult> CFBORenderPool::render_RGBD_async(
+    const Scene::Ptr& scene, const CCamera& camera)
+{
+  return internal_enqueue(scene, camera, true /*withRGB*/);
+}
+
+std::future<CFBORenderPool::TRenderResult> CFBORenderPool::render_depth_async(
+    const Scene::Ptr& scene, const CCamera& camera)
+{
+  return internal_enqueue(scene, camera, false /*withRGB*/);
+}
+
+size_t CFBORenderPool::pendingTasks() const
+{
+  std::unique_lock<std::mutex> lck(m_queueMtx);
+  return m_queue.size();
+}
+
+std::future<CFBORenderPool::TRenderResult> CFBORenderPool::internal_enqueue(
+    const Scene::Ptr& scene, const CCamera& camera, const bool withRGB)
+{
+  ASSERT_(scene);
+
+  TTask t;
+  t.scene = scene;
+  t.camera = camera;
+  t.withRGB = withRGB;
+  auto fut = t.result.get_future();
+  {
+    std::unique_lock<std::mutex> lck(m_queueMtx);
+    m_queue.emplace_back(std::move(t));
+  }
+  m_queueCV.notify_one();
+  return fut;
+}
+
+void CFBORenderPool::internal_workerLoop(const CFBORender::Parameters p)
+{
+  mrpt::system::thread_name("fboRenderPool");
+
+  // One renderer (and EGL context) per worker, built on this thread the
+  // first time it is needed and reused for all subsequent requests:
+  std::unique_ptr<CFBORender> render;
+
+  for (;;)
+  {
+    TTask task;
+    {
+      std::unique_lock<std::mutex> lck(m_queueMtx);
+      m_queueCV.wait(lck, [this]() { return m_shutdown || !m_queue.empty(); });
+      // Keep draining pending tasks during shutdown so no future is left
+      // with a broken promise:
+      if (m_queue.empty()) break;  // m_shutdown must be set
+      task = std::move(m_queue.front());
+      m_queue.pop_front();
+    }
+
+    try
+    {
+      if (!render) render = std::make_unique<CFBORender>(p);
+
+      render->setCamera(*task.scene, task.camera);
+
+      TRenderResult res;
+      if (task.withRGB)
+        render->render_RGBD(*task.scene, res.rgb, res.depth);
+      else
+        render->render_depth(*task.scene, res.depth);
+
+      task.result.set_value(std::move(res));
+    }
+    catch (...)
+    {
+      task.result.set_exception(std::current_exception());
+    }
+  }
+}
@@ -0,0 +1,103 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/opengl/CBox.h>
+#include <mrpt/opengl/CFBORenderPool.h>
+#include <mrpt/opengl/CGridPlaneXY.h>
+#include <mrpt/opengl/CSphere.h>
+#include <mrpt/poses/CPose3D.h>
+//
+#include <Eigen/Dense>
+//
+#include <mrpt/config.h>  // for MRPT_HAS_*
+//
+#include <optional>
+
+#if MRPT_HAS_OPENCV && MRPT_HAS_OPENGL_GLUT && MRPT_HAS_EGL
+#define RUN_OFFSCREEN_RENDER_TESTS
+#endif
+
+// Same archs excluded as in CFBORender_unittest.cpp (autobuilder crashes):
+#if defined(__mips__) || defined(__mips)
+#undef RUN_OFFSCREEN_RENDER_TESTS
+#endif
+#if defined(__powerpc) || defined(__powerpc__) || defined(__powerpc64__) ||               \
+    defined(__POWERPC__) || defined(__ppc__) || defined(__PPC__) || defined(_ARCH_PPC) || \
+    defined(__PPC64__) || defined(__ppc64__) || defined(_ARCH_PPC64)
+#undef RUN_OFFSCREEN_RENDER_TESTS
+#endif
+#if defined(__arm__) && MRPT_WORD_SIZE == 32
+#undef RUN_OFFSCREEN_RENDER_TESTS
+#endif
+#if defined(__riscv)
+#undef RUN_OFFSCREEN_RENDER_TESTS
+#endif
+#if defined(__loongarch__)
+#undef RUN_OFFSCREEN_RENDER_TESTS
+#endif
+
+#if defined(RUN_OFFSCREEN_RENDER_TESTS)
+TEST(OpenGL, CFBORenderPool_depth_batch)
+#else
+TEST(OpenGL, DISABLED_CFBORenderPool_depth_batch)
+#endif
+{
+  using namespace mrpt;  // _deg
+  using namespace mrpt::opengl;
+
+  const unsigned int width = 160, height = 120;
+
+  auto scene = Scene::Create();
+  {
+    auto obj = CGridPlaneXY::Create(-20, 20, -20, 20, 0, 5);
+    scene->insert(obj);
+  }
+  {
+    auto obj = CSphere::Create();
+    obj->setRadius(1.0f);
+    obj->setLocation(0, 1, 0);
+    scene->insert(obj);
+  }
+  scene->getViewport()->setViewportClipDistances(0.1, 25.0f);
+
+  CCamera camera;
+  camera.setProjectiveFOVdeg(90.0);
+  camera.set6DOFMode(true);
+  const auto robotPose = mrpt::poses::CPose3D(0, 0, 10.0, 0.0_deg, 90.0_deg, 0.0_deg);
+  camera.setPose(
+      robotPose + mrpt::poses::CPose3D::FromYawPitchRoll(90.0_deg, 0.0_deg, 90.0_deg));
+
+  CFBORenderPool pool(2 /*threads*/, CFBORender::Parameters(width, height));
+
+  // Enqueue a batch of identical requests, served by different workers:
+  std::vector<std::future<CFBORenderPool::TRenderResult>> futs;
+  for (int i = 0; i < 8; i++) futs.emplace_back(pool.render_depth_async(scene, camera));
+
+  std::optional<mrpt::math::CMatrixFloat> firstDepth;
+  for (auto& f : futs)
+  {
+    auto res = f.get();
+    EXPECT_EQ(res.depth.cols(), static_cast<int>(width));
+    EXPECT_EQ(res.depth.rows(), static_cast<int>(height));
+    EXPECT_TRUE(res.rgb.isEmpty());  // depth-only request
+
+    // All renders of the same static scene must be identical:
+    if (!firstDepth)
+      firstDepth = res.depth;
+    else
+      EXPECT_NEAR((*firstDepth - res.depth).asEigen().array().abs().maxCoeff(), .0f, 1e-4f);
+  }
+
+  // RGBD variant fills both channels:
+  auto res = pool.render_RGBD_async(scene, camera).get();
+  EXPECT_EQ(res.rgb.getWidth(), width);
+  EXPECT_EQ(res.rgb.getHeight(), height);
+  EXPECT_EQ(res.depth.cols(), static_cast<int>(width));
+}
@@ -19,6 +19,8 @@
 #include <mrpt/poses/CPose3D.h>
 #include <mrpt/serialization/CArchive.h>
 
+#include <thread>
+
 using namespace mrpt;
 using namespace mrpt::opengl;
 using namespace mrpt::poses;
@@ -101,12 +103,21 @@ void CMesh::updateTriangles() const
 
   const auto myColor = getColor_u8();
 
-  mrpt::opengl::TTriangle tri;
-
   m_zMin = std::numeric_limits<float>::max();
   m_zMax = -std::numeric_limits<float>::max();
 
-  for (int iX = 0; iX < rows - 1; iX++)
+  // Triangle generation for one band of grid rows. Bands write into private
+  // buffers, so they can run in parallel worker threads; the normals are
+  // accumulated later, at merge time, since boundary vertices are shared
+  // between adjacent bands:
+  using mesh_entry_t = std::pair<mrpt::opengl::TTriangle, TTriangleVertexIndices>;
+
+  const auto process_rows =
+      [&](const int ix0, const int ix1, std::vector<mesh_entry_t>& outTris, float& zMin, float& zMax)
+  {
+  mrpt::opengl::TTriangle tri;
+
+  for (int iX = ix0; iX < ix1; iX++)
     for (int iY = 0; iY < cols - 1; iY++)
     {
       if (useMask && (!mask(iX, iY) || !mask(iX + 1, iY + 1))) continue;
@@ -174,35 +185,17 @@ void CMesh::updateTriangles() const
           tri.b(0) = tri.b(1) = tri.b(2) = u8tof(myColor.B);
         }
 
-        // Compute normal of this triangle, and add it up to the 3
-        // neighboring vertices:
-        // A = P1 - P0, B = P2 - P0
-        float ax = tri.x(1) - tri.x(0);
-        float bx = tri.x(2) - tri.x(0);
-        float ay = tri.y(1) - tri.y(0);
-        float by = tri.y(2) - tri.y(0);
-        float az = tri.z(1) - tri.z(0);
-        float bz = tri.z(2) - tri.z(0);
-        const TPoint3D this_normal(ay * bz - az * by, az * bx - ax * bz, ax * by - ay * bx);
-
         // Vertex indices:
         tvi.vind[1] = iX + 1 + rows * iY;
 
         // Add triangle:
-        actualMesh.emplace_back(tri, tvi);
+        outTris.emplace_back(tri, tvi);
 
         // ... and update z bbox:
         for (int i = 0; i < 3; i++)
         {
-          mrpt::keep_min(m_zMin, tri.z(i));
-          mrpt::keep_max(m_zMax, tri.z(i));
-        }
-
-        // For averaging normals:
-        for (unsigned long k : tvi.vind)
-        {
-          vertex_normals[k].first += this_normal * normalSign;
-          vertex_normals[k].second++;
+          mrpt::keep_min(zMin, tri.z(i));
+          mrpt::keep_max(zMax, tri.z(i));
         }
       }
       // 2:
@@ -259,49 +252,113 @@ void CMesh::updateTriangles() const
           tri.b(0) = tri.b(1) = tri.b(2) = u8tof(myColor.B);
         }
 
-        // Compute normal of this triangle, and add it up to the 3
-        // neighboring vertices:
-        // A = P1 - P0, B = P2 - P0
-        float ax = tri.x(1) - tri.x(0);
-        float bx = tri.x(2) - tri.x(0);
-        float ay = tri.y(1) - tri.y(0);
-        float by = tri.y(2) - tri.y(0);
-        float az = tri.z(1) - tri.z(0);
-        float bz = tri.z(2) - tri.z(0);
-        const TPoint3D this_normal(ay * bz - az * by, az * bx - ax * bz, ax * by - ay * bx);
-
         // Vertex indices:
         tvi.vind[1] = tvi.vind[2];
         tvi.vind[2] = iX + rows * (iY + 1);
 
         // Add triangle:
-        actualMesh.emplace_back(tri, tvi);
+        outTris.emplace_back(tri, tvi);
 
         // ... and update z bbox:
         for (int i = 0; i < 3; i++)
         {
-          mrpt::keep_min(m_zMin, tri.z(i));
-          mrpt::keep_max(m_zMax, tri.z(i));
+          mrpt::keep_min(zMin, tri.z(i));
+          mrpt::keep_max(zMax, tri.z(i));
         }
+      }
+    }
+  };  // end process_rows
 
-        // For averaging normals:
-        for (unsigned long k : tvi.vind)
-        {
-          vertex_normals[k].first += this_normal * normalSign;
-          vertex_normals[k].second++;
-        }
+  const int nCellRows = rows - 1;
+  size_t nThreads =
+      std::min<size_t>(std::max(1U, std::thread::hardware_concurrency()), nCellRows);
+  // Not worth spawning threads for small meshes:
+  if (static_cast<size_t>(nCellRows) * (cols - 1) < 64 * 64) nThreads = 1;
+
+  std::vector<std::vector<mesh_entry_t>> bandTris(nThreads);
+  std::vector<float> bandZMin(nThreads, std::numeric_limits<float>::max());
+  std::vector<float> bandZMax(nThreads, -std::numeric_limits<float>::max());
+
+  if (nThreads <= 1)
+  {
+    process_rows(0, nCellRows, bandTris[0], bandZMin[0], bandZMax[0]);
+  }
+  else
+  {
+    const int band = (nCellRows + nThreads - 1) / nThreads;
+    std::vector<std::thread> workers;
+    workers.reserve(nThreads);
+    for (size_t t = 0; t < nThreads; t++)
+    {
+      const int ix0 = t * band;
+      const int ix1 = std::min<int>(nCellRows, ix0 + band);
+      workers.emplace_back(
+          [&, t, ix0, ix1]() { process_rows(ix0, ix1, bandTris[t], bandZMin[t], bandZMax[t]); });
+    }
+    for (auto& w : workers) w.join();
+  }
+
+  // Merge bands, in order, and accumulate per-vertex normals:
+  size_t nTris = 0;
+  for (const auto& b : bandTris) nTris += b.size();
+  actualMesh.reserve(nTris);
+
+  for (size_t t = 0; t < nThreads; t++)
+  {
+    mrpt::keep_min(m_zMin, bandZMin[t]);
+    mrpt::keep_max(m_zMax, bandZMax[t]);
+
+    for (auto& e : bandTris[t])
+    {
+      // Compute normal of this triangle, and add it up to the 3
+      // neighboring vertices:
+      // A = P1 - P0, B = P2 - P0
+      const auto& tri = e.first;
+      const float ax = tri.x(1) - tri.x(0);
+      const float bx = tri.x(2) - tri.x(0);
+      const float ay = tri.y(1) - tri.y(0);
+      const float by = tri.y(2) - tri.y(0);
+      const float az = tri.z(1) - tri.z(0);
+      const float bz = tri.z(2) - tri.z(0);
+      const TPoint3D this_normal(ay * bz - az * by, az * bx - ax * bz, ax * by - ay * bx);
+
+      for (unsigned long k : e.second.vind)
+      {
+        vertex_normals[k].first += this_normal * normalSign;
+        vertex_normals[k].second++;
       }
+
+      actualMesh.emplace_back(std::move(e));
     }
+  }
 
-  // Average normals:
-  for (auto& vertex_normal : vertex_normals)
+  // Average normals (in parallel: entries are independent):
+  const auto average_normals = [this](const size_t i0, const size_t i1)
   {
-    const size_t N = vertex_normal.second;
-    if (N > 0)
+    for (size_t i = i0; i < i1; i++)
     {
-      vertex_normal.first *= 1.0 / N;
-      vertex_normal.first = vertex_normal.first.unitarize();
+      auto& vertex_normal = vertex_normals[i];
+      const size_t N = vertex_normal.second;
+      if (N > 0)
+      {
+        vertex_normal.first *= 1.0 / N;
+        vertex_normal.first = vertex_normal.first.unitarize();
+      }
     }
+  };
+  if (nThreads <= 1)
+  {
+    average_normals(0, vertex_normals.size());
+  }
+  else
+  {
+    const size_t chunk = (vertex_normals.size() + nThreads - 1) / nThreads;
+    std::vector<std::thread> workers;
+    workers.reserve(nThreads);
+    for (size_t t = 0; t < nThreads; t++)
+      workers.emplace_back(
+          average_normals, t * chunk, std::min(vertex_normals.size(), (t + 1) * chunk));
+    for (auto& w : workers) w.join();
   }
 
   m_trianglesUpToDate = true;
@@ -588,6 +645,128 @@ void CMesh::setZ(const mrpt::math::CMatrixDynamic<float>& in_Z)
   CRenderizable::notifyChange();
 }
 
+void CMesh::setZPartial(
+    const mrpt::math::CMatrixDynamic<float>& patch, const size_t row0, const size_t col0)
+{
+  MRPT_START
+
+  std::unique_lock<std::shared_mutex> lckWrite(m_meshDataMtx.data);
+
+  const int rows = Z.rows(), cols = Z.cols();
+  ASSERT_LE_(row0 + patch.rows(), static_cast<size_t>(rows));
+  ASSERT_LE_(col0 + patch.cols(), static_cast<size_t>(cols));
+
+  Z.asEigen().block(row0, col0, patch.rows(), patch.cols()) = patch.asEigen();
+
+  // The in-place patch below relies on the regular two-triangles-per-cell
+  // layout of actualMesh, and on colors not depending on Z:
+  const bool canPatch = m_trianglesUpToDate && !m_colorFromZ && mask.empty() && rows > 1 &&
+      cols > 1 &&
+      actualMesh.size() == static_cast<size_t>(2 * (rows - 1) * (cols - 1));
+
+  if (!canPatch)
+  {
+    m_modified_Z = true;
+    m_trianglesUpToDate = false;
+    lckWrite.unlock();
+    CRenderizable::notifyChange();
+    return;
+  }
+
+  float normalSign = 1.0f;
+  if (m_xMax < m_xMin) normalSign *= -1.0f;
+  if (m_yMax < m_yMin) normalSign *= -1.0f;
+
+  // Cells whose triangles read any of the patched Z entries:
+  const int cX0 = row0 > 0 ? static_cast<int>(row0) - 1 : 0;
+  const int cX1 = std::min<int>(rows - 2, row0 + patch.rows() - 1);
+  const int cY0 = col0 > 0 ? static_cast<int>(col0) - 1 : 0;
+  const int cY1 = std::min<int>(cols - 2, col0 + patch.cols() - 1);
+
+  // 1) Refresh the z coordinates of the triangles of the dirty cells (their
+  // x,y and colors do not depend on Z):
+  for (int iX = cX0; iX <= cX1; iX++)
+    for (int iY = cY0; iY <= cY1; iY++)
+    {
+      const size_t ti = 2 * (iX * (cols - 1) + iY);
+      auto& tri1 = actualMesh[ti].first;
+      tri1.z(0) = Z(iX, iY);
+      tri1.z(1) = Z(iX + 1, iY);
+      tri1.z(2) = Z(iX + 1, iY + 1);
+      auto& tri2 = actualMesh[ti + 1].first;
+      tri2.z(0) = Z(iX, iY);
+      tri2.z(1) = Z(iX + 1, iY + 1);
+      tri2.z(2) = Z(iX, iY + 1);
+
+      for (int i = 0; i < 3; i++)
+      {
+        mrpt::keep_min(m_zMin, tri1.z(i));
+        mrpt::keep_max(m_zMax, tri1.z(i));
+        mrpt::keep_min(m_zMin, tri2.z(i));
+        mrpt::keep_max(m_zMax, tri2.z(i));
+      }
+    }
+
+  // 2) Rebuild the normals of the vertices of those cells. Any triangle of a
+  // neighboring cell may contribute to them, so scan one extra ring of cells
+  // and only accumulate into the vertices being reset:
+  const auto inResetBox = [&](const size_t vind)
+  {
+    const int vx = static_cast<int>(vind % rows);
+    const int vy = static_cast<int>(vind / rows);
+    return vx >= cX0 && vx <= cX1 + 1 && vy >= cY0 && vy <= cY1 + 1;
+  };
+
+  for (int vx = cX0; vx <= cX1 + 1; vx++)
+    for (int vy = cY0; vy <= cY1 + 1; vy++)
+      vertex_normals[vx + rows * vy] = {TPoint3D(0, 0, 0), 0};
+
+  const int aX0 = std::max(0, cX0 - 1), aX1 = std::min(rows - 2, cX1 + 1);
+  const int aY0 = std::max(0, cY0 - 1), aY1 = std::min(cols - 2, cY1 + 1);
+
+  for (int iX = aX0; iX <= aX1; iX++)
+    for (int iY = aY0; iY <= aY1; iY++)
+    {
+      const size_t ti = 2 * (iX * (cols - 1) + iY);
+      for (size_t j = ti; j < ti + 2; j++)
+      {
+        const auto& tri = actualMesh[j].first;
+        const float ax = tri.x(1) - tri.x(0);
+        const float bx = tri.x(2) - tri.x(0);
+        const float ay = tri.y(1) - tri.y(0);
+        const float by = tri.y(2) - tri.y(0);
+        const float az = tri.z(1) - tri.z(0);
+        const float bz = tri.z(2) - tri.z(0);
+        const TPoint3D this_normal(ay * bz - az * by, az * bx - ax * bz, ax * by - ay * bx);
+
+        for (unsigned long k : actualMesh[j].second.vind)
+        {
+          if (!inResetBox(k)) continue;
+          vertex_normals[k].first += this_normal * normalSign;
+          vertex_normals[k].second++;
+        }
+      }
+    }
+
+  for (int vx = cX0; vx <= cX1 + 1; vx++)
+    for (int vy = cY0; vy <= cY1 + 1; vy++)
+    {
+      auto& vn = vertex_normals[vx + rows * vy];
+      if (vn.second > 0)
+      {
+        vn.first *= 1.0 / vn.second;
+        vn.first = vn.first.unitarize();
+      }
+    }
+
+  m_polygonsUpToDate = false;
+
+  lckWrite.unlock();
+  CRenderizable::notifyChange();
+
+  MRPT_END
+}
+
 void CMesh::setMask(const mrpt::math::CMatrixDynamic<float>& in_mask)
 {
   mask = in_mask;
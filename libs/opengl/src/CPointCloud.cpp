@@ -336,6 +336,7 @@ void CPointCloud::serializeFrom(mrpt::serialization::CArchive& in, uint8_t versi
 
   wfWriteLock.unlock();
   markAllPointsAsNew();
+  resetPointsDirtyHint();
   CRenderizable::notifyChange();
 }
 
@@ -348,6 +349,7 @@ void CPointCloud::clear()
   }
 
   markAllPointsAsNew();
+  resetPointsDirtyHint();
   CRenderizable::notifyChange();
 }
 
@@ -356,13 +358,15 @@ void CPointCloud::insertPoint(float x, float y, float z)
   std::unique_lock<std::shared_mutex> wfWriteLock(CRenderizableShaderPoints::m_pointsMtx.data);
 
   m_points.emplace_back(x, y, z);
+  const size_t newIdx = m_points.size() - 1;
 
   m_minmax_valid = false;
 
-  // JL: TODO note: Well, this can be clearly done much more efficiently
-  // but...I don't have time! :-(
   wfWriteLock.unlock();
   markAllPointsAsNew();
+  // Incremental growth: let renderUpdateBuffers() upload just the appended
+  // point(s) instead of the whole VBOs:
+  internal_markPointDirty(newIdx);
   CRenderizable::notifyChange();
 }
 
@@ -377,10 +381,9 @@ void CPointCloud::setPoint(size_t i, const float x, const float y, const float z
 
   m_minmax_valid = false;
 
-  // JL: TODO note: Well, this can be clearly done much more efficiently
-  // but...I don't have time! :-(
   wfWriteLock.unlock();
   markAllPointsAsNew();
+  internal_markPointDirty(i);
   CRenderizable::notifyChange();
 }
 
@@ -392,6 +395,7 @@ void CPointCloud::setGradientColors(
 {
   m_colorFromDepth_min = colorMin;
   m_colorFromDepth_max = colorMax;
+  resetPointsDirtyHint();
 }
 
 // Do needed internal work if all points are new (octree rebuilt,...)
@@ -9,11 +9,16 @@
 
 #include "opengl-precomp.h"  // Precompiled header
 //
+#include <mrpt/opengl/COctreePointRenderer.h>  // global_settings::OCTREE_RENDER_MAX_DENSITY_POINTS_PER_SQPIXEL()
 #include <mrpt/opengl/CRenderizableShaderPoints.h>
 #include <mrpt/opengl/Shader.h>
 #include <mrpt/opengl/opengl_api.h>
 #include <mrpt/serialization/CArchive.h>
 
+#include <limits>
+#include <numeric>
+#include <random>
+
 using namespace mrpt;
 using namespace mrpt::opengl;
 
@@ -31,23 +36,174 @@ void CRenderizableShaderPoints::renderUpdateBuffers() const
 
   std::shared_lock<std::shared_mutex> wfReadLock(CRenderizableShaderPoints::m_pointsMtx.data);
 
+  // Consume the partial-update hint, if a derived class set one:
+  std::optional<size_t> firstDirtyIdx;
+  {
+    auto lck = mrpt::lockHelper(m_dirtyHintMtx.data);
+    firstDirtyIdx.swap(m_firstDirtyIdx);
+  }
+
+  const auto nPts = m_vertex_buffer_data.size();
+  const int vtxBytes = sizeof(m_vertex_buffer_data[0]) * nPts;
+  const int colBytes = sizeof(m_color_buffer_data[0]) * m_color_buffer_data.size();
+
   // Define OpenGL buffers:
   m_vertexBuffer.createOnce();
-  m_vertexBuffer.bind();
-  m_vertexBuffer.allocate(
-      m_vertex_buffer_data.data(), sizeof(m_vertex_buffer_data[0]) * m_vertex_buffer_data.size());
-
-  // color buffer:
   m_colorBuffer.createOnce();
-  m_colorBuffer.bind();
-  m_colorBuffer.allocate(
-      m_color_buffer_data.data(), sizeof(m_color_buffer_data[0]) * m_color_buffer_data.size());
+
+  // Can we get away with uploading only the appended/modified tail of the
+  // buffers? Requires an explicit hint from the derived class, and that the
+  // already-allocated GPU storage is large enough:
+  const bool partialUpdate = firstDirtyIdx.has_value() && *firstDirtyIdx <= nPts &&
+      m_color_buffer_data.size() == nPts && vtxBytes <= m_vertexBuffer.byteCount() &&
+      colBytes <= m_colorBuffer.byteCount();
+
+  // Uploads one whole VBO. If this object is being grown incrementally
+  // (dirty hints in use), over-allocate with some headroom so subsequent
+  // appends become sub-range updates instead of reallocations:
+  const bool withSlack = firstDirtyIdx.has_value();
+  const auto uploadFull = [withSlack](Buffer& buf, const void* data, const int dataBytes)
+  {
+    buf.bind();
+    if (dataBytes <= buf.byteCount() && buf.byteCount() > 0)
+    {
+      buf.update(data, dataBytes);
+      return;
+    }
+    if (!withSlack)
+    {
+      buf.allocate(data, dataBytes);
+      return;
+    }
+    const int newCapacity = std::max(dataBytes, 2 * buf.byteCount());
+    buf.allocate(nullptr, newCapacity);  // reserve
+    buf.update(data, dataBytes);
+  };
+
+  if (partialUpdate)
+  {
+    const size_t i0 = *firstDirtyIdx;
+    if (i0 < nPts)
+    {
+      m_vertexBuffer.bind();
+      m_vertexBuffer.update(
+          &m_vertex_buffer_data[i0], sizeof(m_vertex_buffer_data[0]) * (nPts - i0),
+          sizeof(m_vertex_buffer_data[0]) * i0);
+
+      m_colorBuffer.bind();
+      m_colorBuffer.update(
+          &m_color_buffer_data[i0], sizeof(m_color_buffer_data[0]) * (nPts - i0),
+          sizeof(m_color_buffer_data[0]) * i0);
+    }
+  }
+  else
+  {
+    uploadFull(m_vertexBuffer, m_vertex_buffer_data.data(), vtxBytes);
+    uploadFull(m_colorBuffer, m_color_buffer_data.data(), colBytes);
+  }
+
+  // LOD decimation index table (only if the feature is enabled):
+  if (m_lodEnabled) internal_updateLodIndexBuffer();
+  else if (!m_lodIndices.empty())
+  {
+    m_lodIndices.clear();
+    m_lodIndices.shrink_to_fit();
+    m_lodIndexBuffer.destroy();
+  }
 
   // VAO: required to use glEnableVertexAttribArray()
   m_vao.createOnce();
 #endif
 }
 
+void CRenderizableShaderPoints::internal_updateLodIndexBuffer() const
+{
+#if MRPT_HAS_OPENGL_GLUT || MRPT_HAS_EGL
+  const size_t N = m_vertex_buffer_data.size();
+  size_t prevN = m_lodIndices.size();
+
+  // Note: the table is a permutation of *indices*, so it only needs
+  // refreshing when the point count changes, not when point data changes.
+  if (N < prevN)
+  {
+    // Cloud shrunk: rebuild from scratch.
+    m_lodIndices.clear();
+    prevN = 0;
+  }
+
+  if (N != prevN)
+  {
+    m_lodIndices.resize(N);
+    std::iota(m_lodIndices.begin() + prevN, m_lodIndices.end(), static_cast<uint32_t>(prevN));
+    // Shuffle the new entries so any prefix of the table is a uniform
+    // subsample. Fixed seed: deterministic, reproducible renders.
+    std::mt19937 rng(static_cast<uint32_t>(0x51dc10u ^ prevN));
+    std::shuffle(m_lodIndices.begin() + prevN, m_lodIndices.end(), rng);
+  }
+
+  if (N == 0) return;
+
+  m_lodIndexBuffer.createOnce();
+  m_lodIndexBuffer.bind();
+  const int idxBytes = sizeof(m_lodIndices[0]) * N;
+  if (idxBytes <= m_lodIndexBuffer.byteCount())
+  {
+    if (prevN == 0 || N != prevN)
+    {
+      // Upload (or re-upload after a rebuild) only the changed tail:
+      m_lodIndexBuffer.update(
+          &m_lodIndices[prevN], sizeof(m_lodIndices[0]) * (N - prevN),
+          sizeof(m_lodIndices[0]) * prevN);
+    }
+  }
+  else
+  {
+    // Over-allocate with headroom, like the vertex/color buffers above,
+    // since LOD clouds are typically grown incrementally:
+    const int newCapacity = std::max(idxBytes, 2 * m_lodIndexBuffer.byteCount());
+    m_lodIndexBuffer.allocate(nullptr, newCapacity);  // reserve
+    m_lodIndexBuffer.update(m_lodIndices.data(), idxBytes);
+  }
+#endif
+}
+
+size_t CRenderizableShaderPoints::internal_lodPointCount(const TRenderMatrices& state) const
+{
+  const size_t N = m_lodIndices.size();
+
+  // Project the 8 corners of the (cached) local bounding box to estimate
+  // the on-screen area of this object:
+  const auto bb = getBoundingBoxLocalf();
+  const mrpt::math::TPoint3Df ends[2] = {bb.min, bb.max};
+
+  float px_min_u = std::numeric_limits<float>::max(), px_min_v = px_min_u;
+  float px_max_u = -px_min_u, px_max_v = -px_min_u;
+  for (int i = 0; i < 8; i++)
+  {
+    float u, v, depth;
+    state.projectPointPixels(ends[i & 1].x, ends[(i >> 1) & 1].y, ends[(i >> 2) & 1].z, u, v, depth);
+    // Camera inside (or right next to) the bbox: projection is unreliable,
+    // and we want full detail at close range anyway:
+    if (depth <= 0) return N;
+    mrpt::keep_min(px_min_u, u);
+    mrpt::keep_max(px_max_u, u);
+    mrpt::keep_min(px_min_v, v);
+    mrpt::keep_max(px_max_v, v);
+  }
+
+  // Clip to the viewport:
+  const float u0 = std::max(px_min_u, .0f), u1 = std::min(px_max_u, 1.0f * state.viewport_width);
+  const float v0 = std::max(px_min_v, .0f), v1 = std::min(px_max_v, 1.0f * state.viewport_height);
+  if (u1 <= u0 || v1 <= v0) return 0;  // off-screen
+
+  const float area_sqpixels = (u1 - u0) * (v1 - v0);
+  const auto density = mrpt::global_settings::OCTREE_RENDER_MAX_DENSITY_POINTS_PER_SQPIXEL();
+
+  auto n = static_cast<size_t>(density * area_sqpixels);
+  mrpt::keep_max(n, std::min(N, m_lodMinPointCount));
+  return std::min(n, N);
+}
+
 void CRenderizableShaderPoints::render(const RenderContext& rc) const
 {
 #if MRPT_HAS_OPENGL_GLUT || MRPT_HAS_EGL
@@ -55,6 +211,11 @@ void CRenderizableShaderPoints::render(const RenderContext& rc) const
   // Skip these geometric entities when in the 1st pass of shadow map:
   if (rc.state->is1stShadowMapPass) return;
 
+  // LOD decimation: decide how many points to draw *before* locking the
+  // points mutex, since the bounding-box getter may need to lock it too:
+  std::optional<size_t> lodDrawCount;
+  if (m_lodEnabled && !m_lodIndices.empty()) lodDrawCount = internal_lodPointCount(*rc.state);
+
   std::shared_lock<std::shared_mutex> wfReadLock(CRenderizableShaderPoints::m_pointsMtx.data);
 
   // Point size as uniform:
@@ -103,7 +264,18 @@ void CRenderizableShaderPoints::render(const RenderContext& rc) const
     CHECK_OPENGL_ERROR_IN_DEBUG();
   }
 
-  glDrawArrays(GL_POINTS, 0, m_vertex_buffer_data.size());
+  if (lodDrawCount && m_lodIndices.size() == m_vertex_buffer_data.size())
+  {
+    if (*lodDrawCount > 0)
+    {
+      m_lodIndexBuffer.bind();
+      glDrawElements(GL_POINTS, *lodDrawCount, GL_UNSIGNED_INT, BUFFER_OFFSET(0));
+    }
+  }
+  else
+  {
+    glDrawArrays(GL_POINTS, 0, m_vertex_buffer_data.size());
+  }
   CHECK_OPENGL_ERROR_IN_DEBUG();
 
   if (attr_position) glDisableVertexAttribArray(*attr_position);
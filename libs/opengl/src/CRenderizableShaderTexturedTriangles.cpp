@@ -185,10 +185,26 @@ void CRenderizableShaderTexturedTriangles::render(const RenderContext& rc) const
 #endif
 }
 
+namespace
+{
+// Combined hash of an RGB + (optional) alpha image pair:
+uint64_t textureImagesHash(const CImage& img, const CImage* imgAlpha)
+{
+  uint64_t h = mrpt::opengl::textureImageContentHash(img);
+  if (imgAlpha) h ^= mrpt::opengl::textureImageContentHash(*imgAlpha) * 0x9e3779b97f4a7c15ULL;
+  return h;
+}
+}  // namespace
+
 void CRenderizableShaderTexturedTriangles::assignImage(const CImage& img, const CImage& imgAlpha)
 {
   MRPT_START
 
+  // Skip the texture unload & costly re-upload if the caller is
+  // re-assigning identical images (frequent in scene-update loops):
+  const uint64_t newHash = textureImagesHash(img, &imgAlpha);
+  if (m_textureImageAssigned && m_enableTransparency && newHash == m_textureContentHash) return;
+
   CRenderizable::notifyChange();
 
   m_glTexture.unloadTexture();
@@ -197,6 +213,7 @@ void CRenderizableShaderTexturedTriangles::assignImage(const CImage& img, const
   m_textureImage = img;
   m_textureImageAlpha = imgAlpha;
   m_textureImageAssigned = true;
+  m_textureContentHash = newHash;
 
   m_enableTransparency = true;
 
@@ -207,6 +224,10 @@ void CRenderizableShaderTexturedTriangles::assignImage(const CImage& img)
 {
   MRPT_START
 
+  // See note on redundant re-assignments in the overload above:
+  const uint64_t newHash = textureImagesHash(img, nullptr);
+  if (m_textureImageAssigned && !m_enableTransparency && newHash == m_textureContentHash) return;
+
   CRenderizable::notifyChange();
 
   m_glTexture.unloadTexture();
@@ -214,6 +235,7 @@ void CRenderizableShaderTexturedTriangles::assignImage(const CImage& img)
   // Make a copy:
   m_textureImage = img;
   m_textureImageAssigned = true;
+  m_textureContentHash = newHash;
 
   m_enableTransparency = false;
 
@@ -224,6 +246,10 @@ void CRenderizableShaderTexturedTriangles::assignImage(CImage&& img, CImage&& im
 {
   MRPT_START
 
+  // See note on redundant re-assignments in the first overload:
+  const uint64_t newHash = textureImagesHash(img, &imgAlpha);
+  if (m_textureImageAssigned && m_enableTransparency && newHash == m_textureContentHash) return;
+
   CRenderizable::notifyChange();
 
   m_glTexture.unloadTexture();
@@ -231,6 +257,7 @@ void CRenderizableShaderTexturedTriangles::assignImage(CImage&& img, CImage&& im
   m_textureImage = std::move(img);
   m_textureImageAlpha = std::move(imgAlpha);
   m_textureImageAssigned = true;
+  m_textureContentHash = newHash;
 
   m_enableTransparency = true;
 
@@ -241,12 +268,17 @@ void CRenderizableShaderTexturedTriangles::assignImage(CImage&& img)
 {
   MRPT_START
 
+  // See note on redundant re-assignments in the first overload:
+  const uint64_t newHash = textureImagesHash(img, nullptr);
+  if (m_textureImageAssigned && !m_enableTransparency && newHash == m_textureContentHash) return;
+
   CRenderizable::notifyChange();
 
   m_glTexture.unloadTexture();
 
   m_textureImage = std::move(img);
   m_textureImageAssigned = true;
+  m_textureContentHash = newHash;
 
   m_enableTransparency = false;
 
@@ -39,7 +39,17 @@ void CRenderizableShaderTriangles::renderUpdateBuffers() const
   // Define OpenGL buffers:
   m_trianglesBuffer.createOnce();
   m_trianglesBuffer.bind();
-  m_trianglesBuffer.allocate(tris.data(), sizeof(tris[0]) * n);
+  const int nBytes = sizeof(tris[0]) * n;
+  if (nBytes <= m_trianglesBuffer.byteCount() && m_trianglesBuffer.byteCount() > 0)
+  {
+    // Overwrite in-place: avoids reallocating the GPU storage every time
+    // the object geometry is regenerated:
+    m_trianglesBuffer.update(tris.data(), nBytes);
+  }
+  else
+  {
+    m_trianglesBuffer.allocate(tris.data(), nBytes);
+  }
 
   // VAO: required to use glEnableVertexAttribArray()
   m_vao.createOnce();
@@ -58,6 +58,7 @@ bool CTextMessageCapable::updateTextMessage(size_t unique_index, const std::stri
     return false;
   else
   {
+    if (it->second.text == text) return true;  // nothing to regenerate
     it->second.text = text;
     it->second.gl_text_outdated = true;
     return true;
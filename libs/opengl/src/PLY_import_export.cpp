@@ -49,12 +49,18 @@ WARRANTY OF MERCHANTABILITY OR FITNESS FOR A PARTICULAR PURPOSE.
 //
 #include <mrpt/core/exceptions.h>
 #include <mrpt/core/reverse_bytes.h>
+#include <mrpt/io/CMemoryMappedFileStream.h>
 #include <mrpt/opengl/PLY_import_export.h>
 #include <mrpt/system/string_utils.h>
 
 #include <array>
+#include <atomic>
 #include <cstdio>
+#include <cstring>
 #include <map>
+#include <mutex>
+#include <sstream>
+#include <thread>
 
 using namespace std;
 using namespace mrpt;
@@ -1841,11 +1847,285 @@ const PlyProperty face_props[] = {
 /*
     Loads from a PLY file.
 */
+void PLY_Importer::PLY_import_set_vertex_block(
+    size_t first_idx, size_t num_pts, const TPoint3Df* pts, const TColorf* colors)
+{
+  for (size_t i = 0; i < num_pts; i++)
+    PLY_import_set_vertex(first_idx + i, pts[i], colors ? &colors[i] : nullptr);
+}
+
+namespace
+{
+// Size in bytes of a scalar PLY property type, or 0 if unknown:
+size_t fast_ply_type_size(const std::string& t)
+{
+  if (t == "char" || t == "int8" || t == "uchar" || t == "uint8") return 1;
+  if (t == "short" || t == "int16" || t == "ushort" || t == "uint16") return 2;
+  if (t == "int" || t == "int32" || t == "uint" || t == "uint32" || t == "float" || t == "float32")
+    return 4;
+  if (t == "double" || t == "float64") return 8;
+  return 0;
+}
+}  // namespace
+
+int PLY_Importer::internal_loadFromPlyBinaryFast(
+    const std::string& filename,
+    std::vector<std::string>* file_comments,
+    std::vector<std::string>* file_obj_info)
+{
+#if MRPT_IS_BIG_ENDIAN
+  // The raw byte-copy decoders below assume a little-endian host:
+  return 0;
+#endif
+  try
+  {
+    mrpt::io::CMemoryMappedFileStream f;
+    if (!f.open(filename, mrpt::io::AccessPattern::Sequential)) return 0;
+    const auto* base = static_cast<const uint8_t*>(f.getRawBufferData());
+    const uint64_t fileSize = f.getTotalBytesCount();
+    if (!base || fileSize < 16) return 0;
+
+    // ---- Parse the text header (PLY headers are tiny; bound the search) ----
+    const size_t maxHdr = static_cast<size_t>(std::min<uint64_t>(fileSize, 1 << 20));
+    const std::string endTag = "end_header\n";
+    const char* hdrBegin = reinterpret_cast<const char*>(base);
+    const char* hdrEnd = std::search(hdrBegin, hdrBegin + maxHdr, endTag.begin(), endTag.end());
+    if (hdrEnd == hdrBegin + maxHdr) return 0;
+    const uint64_t dataStart = (hdrEnd - hdrBegin) + endTag.size();
+
+    std::istringstream hdr(std::string(hdrBegin, hdrEnd));
+    std::string line;
+    if (!std::getline(hdr, line) || mrpt::system::trim(line) != "ply") return 0;
+
+    struct TElement
+    {
+      std::string name;
+      size_t count = 0;
+      size_t stride = 0;
+      bool hasList = false;
+    };
+    std::vector<TElement> elems;
+    bool isBinaryLE = false;
+
+    // Layout of the needed vertex properties (record offsets; npos = absent).
+    // Note: to exactly match the generic parser below, only x/y/z, intensity
+    // and timestamp are imported (vert_props does not register r/g/b either):
+    constexpr size_t npos = std::string::npos;
+    size_t offX = npos, offY = npos, offZ = npos, offI = npos, offT = npos;
+    bool xDouble = false, yDouble = false, zDouble = false;
+    bool intensityDouble = false, timeDouble = false;
+
+    while (std::getline(hdr, line))
+    {
+      std::istringstream ls(line);
+      std::string tok;
+      if (!(ls >> tok)) continue;
+
+      if (tok == "format")
+      {
+        std::string fmt;
+        ls >> fmt;
+        isBinaryLE = (fmt == "binary_little_endian");
+        if (!isBinaryLE) return 0;  // ASCII or big-endian: generic parser
+      }
+      else if (tok == "comment" || tok == "obj_info")
+      {
+        auto* lst = (tok == "comment") ? file_comments : file_obj_info;
+        if (lst)
+        {
+          std::string rest;
+          std::getline(ls, rest);
+          lst->push_back(mrpt::system::trim(rest));
+        }
+      }
+      else if (tok == "element")
+      {
+        auto& e = elems.emplace_back();
+        ls >> e.name >> e.count;
+      }
+      else if (tok == "property")
+      {
+        if (elems.empty()) return 0;
+        auto& e = elems.back();
+        std::string type;
+        ls >> type;
+        if (type == "list")
+        {
+          e.hasList = true;
+          continue;
+        }
+        const size_t sz = fast_ply_type_size(type);
+        if (sz == 0) return 0;
+        std::string pname;
+        ls >> pname;
+
+        if (e.name == "vertex")
+        {
+          const bool isF = (type == "float" || type == "float32");
+          const bool isD = (type == "double" || type == "float64");
+          if (isF || isD)
+          {
+            // clang-format off
+            if      (pname == "x") { offX = e.stride; xDouble = isD; }
+            else if (pname == "y") { offY = e.stride; yDouble = isD; }
+            else if (pname == "z") { offZ = e.stride; zDouble = isD; }
+            else if (pname == "intensity") { offI = e.stride; intensityDouble = isD; }
+            else if (pname == "timestamp") { offT = e.stride; timeDouble = isD; }
+            // clang-format on
+          }
+        }
+        e.stride += sz;
+      }
+    }
+    if (!isBinaryLE) return 0;
+
+    // Locate the vertex element data; preceding elements must have a fixed
+    // record size for its offset to be computable:
+    uint64_t dataOfs = dataStart;
+    const TElement* vertexElem = nullptr;
+    for (const auto& e : elems)
+    {
+      if (e.name == "vertex")
+      {
+        vertexElem = &e;
+        break;
+      }
+      if (e.hasList) return 0;
+      dataOfs += static_cast<uint64_t>(e.count) * e.stride;
+    }
+    if (!vertexElem || vertexElem->hasList) return 0;
+    if (offX == npos || offY == npos || offZ == npos) return 0;
+
+    const size_t stride = vertexElem->stride;
+    const size_t N = vertexElem->count;
+    if (dataOfs + static_cast<uint64_t>(N) * stride > fileSize)
+    {
+      m_ply_import_last_error = "Truncated binary PLY file: " + filename;
+      return -1;
+    }
+
+    this->PLY_import_set_vertex_count(N);
+    if (N == 0) return 1;
+
+    const uint8_t* data = base + dataOfs;
+    const bool hasIntensity = (offI != npos);
+
+    const auto readScalarF = [](const uint8_t* p, bool isDouble) -> float
+    {
+      if (isDouble)
+      {
+        double d;
+        std::memcpy(&d, p, sizeof(d));
+        return static_cast<float>(d);
+      }
+      float v;
+      std::memcpy(&v, p, sizeof(v));
+      return v;
+    };
+
+    // Chunked parallel parse: worker threads decode disjoint chunks into
+    // local buffers and stream them out via PLY_import_set_vertex_block().
+    // The callbacks themselves are serialized with a mutex, so importer
+    // implementations need not be thread-safe; decoding still overlaps with
+    // the bulk writes.
+    constexpr size_t CHUNK = 1 << 16;  // points per work unit
+    const size_t numChunks = (N + CHUNK - 1) / CHUNK;
+    unsigned int nThreads = std::max(1u, std::thread::hardware_concurrency() / 2);
+    nThreads = static_cast<unsigned int>(std::min<size_t>(nThreads, numChunks));
+
+    std::atomic<size_t> nextChunk{0};
+    std::atomic_bool anyError{false};
+    std::mutex importerMtx;
+
+    const auto worker = [&]()
+    {
+      std::vector<TPoint3Df> pts;
+      std::vector<TColorf> cols;
+      while (!anyError)
+      {
+        const size_t c = nextChunk++;
+        if (c >= numChunks) break;
+        const size_t i0 = c * CHUNK, i1 = std::min(N, i0 + CHUNK), n = i1 - i0;
+        pts.resize(n);
+        if (hasIntensity) cols.resize(n);
+        try
+        {
+          for (size_t i = 0; i < n; i++)
+          {
+            const uint8_t* rec = data + (i0 + i) * stride;
+            pts[i] = TPoint3Df(
+                readScalarF(rec + offX, xDouble), readScalarF(rec + offY, yDouble),
+                readScalarF(rec + offZ, zDouble));
+            if (hasIntensity)
+            {
+              const float ity = readScalarF(rec + offI, intensityDouble);
+              cols[i] = TColorf(ity, ity, ity);
+            }
+          }
+
+          std::lock_guard<std::mutex> lck(importerMtx);
+          this->PLY_import_set_vertex_block(i0, n, pts.data(), hasIntensity ? cols.data() : nullptr);
+          if (offT != npos)
+            for (size_t i = 0; i < n; i++)
+            {
+              const uint8_t* rec = data + (i0 + i) * stride;
+              double ts;
+              if (timeDouble)
+                std::memcpy(&ts, rec + offT, sizeof(ts));
+              else
+              {
+                float tf;
+                std::memcpy(&tf, rec + offT, sizeof(tf));
+                ts = tf;
+              }
+              this->PLY_import_set_vertex_timestamp(i0 + i, ts);
+            }
+        }
+        catch (const std::exception& e)
+        {
+          anyError = true;
+          std::lock_guard<std::mutex> lck(importerMtx);
+          m_ply_import_last_error = e.what();
+        }
+      }
+    };
+
+    if (nThreads <= 1)
+    {
+      worker();
+    }
+    else
+    {
+      std::vector<std::thread> threads;
+      threads.reserve(nThreads);
+      for (unsigned int t = 0; t < nThreads; t++) threads.emplace_back(worker);
+      for (auto& t : threads) t.join();
+    }
+    return anyError ? -1 : 1;
+  }
+  catch (...)
+  {
+    return 0;  // let the generic parser report any error
+  }
+}
+
 bool PLY_Importer::loadFromPlyFile(
     const std::string& filename,
     std::vector<std::string>* file_comments,
     std::vector<std::string>* file_obj_info)
 {
+  // Fast path for binary little-endian files (memory-mapped, parallel):
+  switch (internal_loadFromPlyBinaryFast(filename, file_comments, file_obj_info))
+  {
+    case 1:
+      m_ply_import_last_error.clear();
+      return true;
+    case -1:
+      return false;  // m_ply_import_last_error is already set
+    default:
+      break;  // 0: the file needs the generic parser below
+  }
+
   try
   {
     /* open a PLY file for reading */
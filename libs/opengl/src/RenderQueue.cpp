@@ -11,13 +11,18 @@
 //
 #include <Eigen/Dense>  // First! to avoid conflicts with X.h
 //
+#include <mrpt/core/WorkerThreadsPool.h>
+#include <mrpt/core/get_env.h>
 #include <mrpt/opengl/CSetOfObjects.h>
 #include <mrpt/opengl/CText.h>
 #include <mrpt/opengl/RenderQueue.h>
 #include <mrpt/opengl/opengl_api.h>
 #include <mrpt/system/os.h>
 
+#include <future>
 #include <map>
+#include <thread>
+#include <vector>
 
 using namespace std;
 using namespace mrpt;
@@ -248,119 +253,261 @@ std::tuple<double, bool, bool> mrpt::opengl::depthAndVisibleInView(
   return {lrpDepth, anyVisible, allVisible};
 }
 
-// Render a set of objects
-void mrpt::opengl::enqueueForRendering(
-    const mrpt::opengl::CListOpenGLObjects& objs,
+#if MRPT_HAS_OPENGL_GLUT || MRPT_HAS_EGL
+namespace
+{
+/** While a render queue shard is being built from a worker thread, this
+ * points to the shard's list of objects whose GL vertex buffers may need
+ * regeneration: workers cannot touch the GL context, so the actual uploads
+ * are deferred and run on the GL thread after all shards are merged.
+ * nullptr (the default) means "we are on the GL thread": update in place. */
+thread_local std::vector<const CRenderizable*>* tl_deferredBufferUpdates = nullptr;
+
+/** One per worker thread in the parallel queue build, merged afterwards */
+struct RenderQueueShard
+{
+  RenderQueue rq;
+  std::vector<const CRenderizable*> deferredBufferUpdates;
+  RenderQueueStats stats;
+};
+
+// Processes one renderizable for enqueueForRendering(): early-out checks,
+// model-view matrix composition, culling, and enqueueing of the object, its
+// label, and (recursively) its children.
+void enqueueSingleObject(
+    const CRenderizable* obj,
     const mrpt::opengl::TRenderMatrices& state,
     RenderQueue& rq,
     const bool skipCullChecks,
     const bool is1stShadowMapPass,
     RenderQueueStats* stats)
 {
-#if MRPT_HAS_OPENGL_GLUT || MRPT_HAS_EGL
   using mrpt::math::CMatrixDouble44;
 
 #ifdef MRPT_OPENGL_PROFILER
-  mrpt::system::CTimeLoggerEntry tle(opengl_profiler(), "enqueueForRendering");
+  if (stats) stats->numObjTotal++;
 #endif
 
-  const char* curClassName = nullptr;
-  try
+  // Quick check: if we are in a shadow generation pass where this
+  // object does not render, skip it:
+  const auto lst_shaders = obj->requiredShaders();
+  if (lst_shaders.size() == 1 && lst_shaders.at(0) == DefaultShaderID::NONE) return;
+
+  if (!obj->isVisible()) return;
+
+  // Skip objects that do not cast shadows, if we are in that first
+  // shadow map pass.
+  if (is1stShadowMapPass && !obj->castShadows()) return;
+
+  // Regenerate opengl vertex buffers?
+  if (tl_deferredBufferUpdates)
   {
-    for (const auto& objPtr : objs)
-    {
-      if (!objPtr) continue;
+    // building a shard in a worker thread: no GL context here.
+    tl_deferredBufferUpdates->push_back(obj);
+  }
+  else if (obj->hasToUpdateBuffers())
+  {
+    obj->updateBuffers();
+  }
 
-#ifdef MRPT_OPENGL_PROFILER
-      if (stats) stats->numObjTotal++;
-#endif
+  const CPose3D thisPose = obj->getCPose();
+  CMatrixFloat44 HM = thisPose.getHomogeneousMatrixVal<CMatrixDouble44>().cast_float();
 
-      // Use plain pointers, faster than smart pointers:
-      const CRenderizable* obj = objPtr.get();
+  // Scaling:
+  if (obj->getScaleX() != 1 || obj->getScaleY() != 1 || obj->getScaleZ() != 1)
+  {
+    auto scale = CMatrixFloat44::Identity();
+    scale(0, 0) = obj->getScaleX();
+    scale(1, 1) = obj->getScaleY();
+    scale(2, 2) = obj->getScaleZ();
+    HM.asEigen() = HM.asEigen() * scale.asEigen();
+  }
 
-      // Quick check: if we are in a shadow generation pass where this
-      // object does not render, skip it:
-      const auto lst_shaders = obj->requiredShaders();
-      if (lst_shaders.size() == 1 && lst_shaders.at(0) == DefaultShaderID::NONE) continue;
+  // Make a copy of rendering state, so we always have the
+  // original version of my parent intact.
+  auto _ = state;
 
-      // Save class name: just in case we have an exception, for error
-      // reporting:
-      curClassName = obj->GetRuntimeClass()->className;
+  // Compose relative to my parent pose:
+  _.m_matrix.asEigen() = _.m_matrix.asEigen() * HM.asEigen();
 
-      if (!obj->isVisible()) continue;
+  // Precompute matrices to be used in shaders:
+  _.mv_matrix.asEigen() = _.v_matrix.asEigen() * _.m_matrix.asEigen();
 
-      // Skip objects that do not cast shadows, if we are in that first
-      // shadow map pass.
-      if (is1stShadowMapPass && !obj->castShadows()) continue;
+  // PMV = P*V*M (observe the weird notation order)
+  _.pmv_matrix.asEigen() = _.p_matrix.asEigen() * _.mv_matrix.asEigen();
 
-      // Regenerate opengl vertex buffers?
-      if (obj->hasToUpdateBuffers()) obj->updateBuffers();
+  // PMV for the light = P*V*M (observe the weird notation order)
+  _.light_pmv.asEigen() = _.light_pv.asEigen() * _.m_matrix.asEigen();
 
-      const CPose3D thisPose = obj->getCPose();
-      CMatrixFloat44 HM = thisPose.getHomogeneousMatrixVal<CMatrixDouble44>().cast_float();
+  // Let the culling algorithm know whether we are looking from the
+  // camera or from the light:
+  _.is1stShadowMapPass = is1stShadowMapPass;
 
-      // Scaling:
-      if (obj->getScaleX() != 1 || obj->getScaleY() != 1 || obj->getScaleZ() != 1)
-      {
-        auto scale = CMatrixFloat44::Identity();
-        scale(0, 0) = obj->getScaleX();
-        scale(1, 1) = obj->getScaleY();
-        scale(2, 2) = obj->getScaleZ();
-        HM.asEigen() = HM.asEigen() * scale.asEigen();
-      }
+  const auto [depth, withinView, wholeInView] = depthAndVisibleInView(obj, _, skipCullChecks);
 
-      // Make a copy of rendering state, so we always have the
-      // original version of my parent intact.
-      auto _ = state;
+  if (withinView)
+  {
+#ifdef MRPT_OPENGL_PROFILER
+    if (stats) stats->numObjRendered++;
+#endif
 
-      // Compose relative to my parent pose:
-      _.m_matrix.asEigen() = _.m_matrix.asEigen() * HM.asEigen();
+    // Enqueue this object...
+    for (const auto shader_id : lst_shaders)
+    {
+      // eye-to-object depth:
+      rq[shader_id].emplace(depth, RenderQueueElement(obj, _));
+    }
 
-      // Precompute matrices to be used in shaders:
-      _.mv_matrix.asEigen() = _.v_matrix.asEigen() * _.m_matrix.asEigen();
+    if (obj->isShowNameEnabled())
+    {
+      CText& label = obj->labelObject();
 
-      // PMV = P*V*M (observe the weird notation order)
-      _.pmv_matrix.asEigen() = _.p_matrix.asEigen() * _.mv_matrix.asEigen();
+      // Update the label, only if it changed:
+      if (label.getString() != obj->getName()) label.setString(obj->getName());
 
-      // PMV for the light = P*V*M (observe the weird notation order)
-      _.light_pmv.asEigen() = _.light_pv.asEigen() * _.m_matrix.asEigen();
+      // Regenerate opengl vertex buffers, if first time or
+      // label changed:
+      if (tl_deferredBufferUpdates)
+        tl_deferredBufferUpdates->push_back(&label);
+      else if (label.hasToUpdateBuffers())
+        label.updateBuffers();
 
-      // Let the culling algorithm know whether we are looking from the
-      // camera or from the light:
-      _.is1stShadowMapPass = is1stShadowMapPass;
+      rq[DefaultShaderID::TEXT].emplace(depth, RenderQueueElement(&label, _));
+    }
+  }
 
-      const auto [depth, withinView, wholeInView] = depthAndVisibleInView(obj, _, skipCullChecks);
+  // ...and its children:
+  obj->enqueueForRenderRecursive(_, rq, wholeInView, is1stShadowMapPass);
+}
+}  // namespace
+#endif
+
+// Render a set of objects
+void mrpt::opengl::enqueueForRendering(
+    const mrpt::opengl::CListOpenGLObjects& objs,
+    const mrpt::opengl::TRenderMatrices& state,
+    RenderQueue& rq,
+    const bool skipCullChecks,
+    const bool is1stShadowMapPass,
+    RenderQueueStats* stats)
+{
+#if MRPT_HAS_OPENGL_GLUT || MRPT_HAS_EGL
 
-      if (withinView)
-      {
 #ifdef MRPT_OPENGL_PROFILER
-        if (stats) stats->numObjRendered++;
+  mrpt::system::CTimeLoggerEntry tle(opengl_profiler(), "enqueueForRendering");
 #endif
 
-        // Enqueue this object...
-        for (const auto shader_id : lst_shaders)
-        {
-          // eye-to-object depth:
-          rq[shader_id].emplace(depth, RenderQueueElement(obj, _));
-        }
+  // Worker threads to build the queue of large object lists. Environment
+  // variable MRPT_OPENGL_QUEUE_THREADS: 0 (default)=one per CPU core,
+  // 1=single-threaded traversal:
+  const size_t nWorkers = [&objs]() -> size_t
+  {
+    if (tl_deferredBufferUpdates) return 1;  // already inside a worker
+    static const int envThreads = mrpt::get_env<int>("MRPT_OPENGL_QUEUE_THREADS", 0);
+    if (envThreads == 1) return 1;
+    const size_t maxThreads =
+        envThreads > 0 ? static_cast<size_t>(envThreads) : std::thread::hardware_concurrency();
+    // Do not spawn threads for short lists, the task overhead would
+    // dominate:
+    constexpr size_t MIN_OBJS_PER_WORKER = 512;
+    return std::min<size_t>(maxThreads, objs.size() / MIN_OBJS_PER_WORKER);
+  }();
+
+  if (nWorkers > 1)
+  {
+    // Parallel queue build: each worker culls and enqueues a chunk of the
+    // list (and, recursively, its subtrees) into its own shard, merged
+    // below. GL buffer regeneration is deferred to this (the GL) thread:
+    static mrpt::WorkerThreadsPool pool(
+        std::thread::hardware_concurrency(), mrpt::WorkerThreadsPool::POLICY_FIFO,
+        "opengl_render_queue");
+
+    std::vector<RenderQueueShard> shards(nWorkers);
+    const size_t chunk = (objs.size() + nWorkers - 1) / nWorkers;
+
+    std::vector<std::future<void>> futs;
+    futs.reserve(nWorkers);
+    for (size_t w = 0; w < nWorkers; w++)
+    {
+      futs.emplace_back(pool.enqueue(
+          [&objs, &state, &shards, skipCullChecks, is1stShadowMapPass, chunk, w]()
+          {
+            auto& shard = shards[w];
+            tl_deferredBufferUpdates = &shard.deferredBufferUpdates;
+            const char* curClassName = nullptr;
+            try
+            {
+              const size_t i0 = w * chunk, i1 = std::min(objs.size(), i0 + chunk);
+              for (size_t i = i0; i < i1; i++)
+              {
+                const auto& objPtr = objs[i];
+                if (!objPtr) continue;
+                curClassName = objPtr->GetRuntimeClass()->className;
+                enqueueSingleObject(
+                    objPtr.get(), state, shard.rq, skipCullChecks, is1stShadowMapPass,
+                    &shard.stats);
+              }
+              tl_deferredBufferUpdates = nullptr;
+            }
+            catch (const exception& e)
+            {
+              tl_deferredBufferUpdates = nullptr;
+              THROW_EXCEPTION_FMT(
+                  "Exception while rendering class '%s':\n%s",
+                  curClassName ? curClassName : "(undefined)", e.what());
+            }
+          }));
+    }
 
-        if (obj->isShowNameEnabled())
-        {
-          CText& label = obj->labelObject();
+    // Join all workers before touching the shards, even on error:
+    std::exception_ptr firstExcept;
+    for (auto& f : futs)
+    {
+      try
+      {
+        f.get();
+      }
+      catch (...)
+      {
+        if (!firstExcept) firstExcept = std::current_exception();
+      }
+    }
+    if (firstExcept) std::rethrow_exception(firstExcept);
 
-          // Update the label, only if it changed:
-          if (label.getString() != obj->getName()) label.setString(obj->getName());
+    for (auto& shard : shards)
+    {
+      // Splice the shard queues into the output queue:
+      for (auto& [shaderId, mmap] : shard.rq) rq[shaderId].merge(mmap);
 
-          // Regenerate opengl vertex buffers, if first time or
-          // label changed:
-          if (label.hasToUpdateBuffers()) label.updateBuffers();
+      if (stats)
+      {
+        stats->numObjTotal += shard.stats.numObjTotal;
+        stats->numObjRendered += shard.stats.numObjRendered;
+      }
 
-          rq[DefaultShaderID::TEXT].emplace(depth, RenderQueueElement(&label, _));
-        }
+      // Run the deferred GL buffer updates, now that we are back on the
+      // GL thread (hasToUpdateBuffers() keeps per-thread outdate flags,
+      // so re-checking it here is accurate):
+      for (const auto* o : shard.deferredBufferUpdates)
+      {
+        if (o->hasToUpdateBuffers()) o->updateBuffers();
       }
+    }
+    return;
+  }
+
+  const char* curClassName = nullptr;
+  try
+  {
+    for (const auto& objPtr : objs)
+    {
+      if (!objPtr) continue;
+
+      // Save class name: just in case we have an exception, for error
+      // reporting:
+      curClassName = objPtr->GetRuntimeClass()->className;
 
-      // ...and its children:
-      obj->enqueueForRenderRecursive(_, rq, wholeInView, is1stShadowMapPass);
+      enqueueSingleObject(objPtr.get(), state, rq, skipCullChecks, is1stShadowMapPass, stats);
 
     }  // end foreach object
   }
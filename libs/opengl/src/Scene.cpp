@@ -11,12 +11,20 @@
 //
 #include <mrpt/io/CFileGZInputStream.h>
 #include <mrpt/io/CFileGZOutputStream.h>
+#include <mrpt/io/CFileInputStream.h>
+#include <mrpt/io/CFileOutputStream.h>
+#include <mrpt/io/CMemoryStream.h>
+#include <mrpt/io/zip.h>
 #include <mrpt/opengl/CRenderizable.h>
 #include <mrpt/opengl/Scene.h>
 #include <mrpt/opengl/opengl_api.h>
 #include <mrpt/serialization/CArchive.h>
 #include <mrpt/serialization/metaprogramming_serialization.h>
 
+#include <atomic>
+#include <cstring>
+#include <thread>
+
 using namespace mrpt;
 using namespace mrpt::opengl;
 using namespace mrpt::serialization::metaprogramming;
@@ -316,6 +324,290 @@ bool Scene::loadFromFile(const std::string& fil)
   }
 }
 
+// ====================================================================
+//  Chunked ".3Dscene" format (v2):
+//   MAGIC (16 bytes) | uint8 fmtVersion | bool followCamera | uint32 nVp
+//   | nVp x { uint32 blockSize; gz block: serialized Viewport w/o objects }
+//   | uint64 directoryOffset (placeholder, patched after writing the blocks)
+//   | per-object gz blocks...
+//   | directory: uint32 nEntries x { uint32 vpIdx; string className;
+//     bool bboxValid; 6 x double bbox; uint64 offset, compSize, uncompSize }
+// ====================================================================
+namespace
+{
+constexpr char CHUNKED_SCENE_MAGIC[] = "MRPT-3DSCENE-V2\n";  // 16 chars + NUL
+constexpr size_t CHUNKED_SCENE_MAGIC_LEN = 16;
+constexpr uint8_t CHUNKED_SCENE_FMT_VERSION = 0;
+
+std::vector<uint8_t> serializeToGzBlock(
+    const mrpt::serialization::CSerializable& o, int compress_level, uint64_t& uncompressedSize)
+{
+  mrpt::io::CMemoryStream buf;
+  mrpt::serialization::archiveFrom(buf) << o;
+  uncompressedSize = buf.getTotalBytesCount();
+
+  std::vector<uint8_t> raw(uncompressedSize);
+  std::memcpy(raw.data(), buf.getRawBufferData(), raw.size());
+
+  std::vector<uint8_t> gz;
+  if (!mrpt::io::zip::compress_gz_data_block(raw, gz, compress_level))
+    THROW_EXCEPTION("compress_gz_data_block() failed");
+  return gz;
+}
+
+mrpt::serialization::CSerializable::Ptr deserializeFromGzBlock(const std::vector<uint8_t>& gz)
+{
+  std::vector<uint8_t> raw;
+  if (!mrpt::io::zip::decompress_gz_data_block(gz, raw))
+    THROW_EXCEPTION("decompress_gz_data_block() failed");
+
+  mrpt::io::CMemoryStream buf;
+  buf.assignMemoryNotOwn(raw.data(), raw.size());
+  mrpt::serialization::CSerializable::Ptr o;
+  mrpt::serialization::archiveFrom(buf) >> o;
+  return o;
+}
+
+/** Reads everything but the object blocks themselves. Returns false if the
+ * file is not in the chunked format. */
+bool readChunkedHeaderAndDirectory(
+    mrpt::io::CFileInputStream& f,
+    bool& followCamera,
+    std::vector<std::vector<uint8_t>>& vpShellBlocks,
+    std::vector<Scene::TChunkedObjectEntry>& dir)
+{
+  char magic[CHUNKED_SCENE_MAGIC_LEN];
+  if (f.Read(magic, sizeof(magic)) != sizeof(magic) ||
+      std::memcmp(magic, CHUNKED_SCENE_MAGIC, sizeof(magic)) != 0)
+    return false;
+
+  auto arch = mrpt::serialization::archiveFrom(f);
+  uint8_t fmt;
+  arch >> fmt;
+  if (fmt != CHUNKED_SCENE_FMT_VERSION) return false;
+
+  uint32_t nVp;
+  arch >> followCamera >> nVp;
+  vpShellBlocks.resize(nVp);
+  for (auto& blk : vpShellBlocks)
+  {
+    uint32_t n;
+    arch >> n;
+    blk.resize(n);
+    if (n != 0 && f.Read(blk.data(), n) != n) return false;
+  }
+
+  uint64_t dirOffset = 0;
+  arch >> dirOffset;
+  f.Seek(dirOffset);
+
+  uint32_t nEntries;
+  arch >> nEntries;
+  dir.resize(nEntries);
+  for (auto& e : dir)
+    arch >> e.viewportIndex >> e.className >> e.bboxValid >> e.bbox.min.x >> e.bbox.min.y >>
+        e.bbox.min.z >> e.bbox.max.x >> e.bbox.max.y >> e.bbox.max.z >> e.fileOffset >>
+        e.compressedSize >> e.uncompressedSize;
+  return true;
+}
+}  // namespace
+
+bool Scene::saveToFileChunked(const std::string& fil, int compress_level) const
+{
+  try
+  {
+    mrpt::io::CFileOutputStream f(fil);
+    if (!f.fileOpenCorrectly()) return false;
+    auto arch = mrpt::serialization::archiveFrom(f);
+
+    f.Write(CHUNKED_SCENE_MAGIC, CHUNKED_SCENE_MAGIC_LEN);
+    arch << CHUNKED_SCENE_FMT_VERSION << m_followCamera
+         << static_cast<uint32_t>(m_viewports.size());
+
+    // Viewport "shells": each viewport serialized with its object list
+    // temporarily stashed away, so huge objects do not end up in this
+    // eagerly-loaded part of the file:
+    for (const auto& vp : m_viewports)
+    {
+      auto& objs = const_cast<Viewport&>(*vp).m_objects;
+      CListOpenGLObjects stashed;
+      stashed.swap(objs);
+      std::vector<uint8_t> gz;
+      try
+      {
+        uint64_t uncomp = 0;
+        gz = serializeToGzBlock(*vp, compress_level, uncomp);
+      }
+      catch (...)
+      {
+        stashed.swap(objs);
+        throw;
+      }
+      stashed.swap(objs);
+
+      arch << static_cast<uint32_t>(gz.size());
+      if (!gz.empty()) f.Write(gz.data(), gz.size());
+    }
+
+    const uint64_t dirOffsetPos = f.getPosition();
+    arch << static_cast<uint64_t>(0);  // directory offset, patched below
+
+    // Per-object compressed blocks:
+    std::vector<TChunkedObjectEntry> dir;
+    for (uint32_t vpIdx = 0; vpIdx < m_viewports.size(); vpIdx++)
+      for (const auto& obj : m_viewports[vpIdx]->m_objects)
+      {
+        if (!obj) continue;
+        TChunkedObjectEntry e;
+        e.viewportIndex = vpIdx;
+        e.className = obj->GetRuntimeClass()->className;
+        try
+        {
+          e.bbox = obj->getBoundingBox();
+          e.bboxValid = true;
+        }
+        catch (...)
+        {
+          e.bboxValid = false;
+        }
+
+        const std::vector<uint8_t> gz = serializeToGzBlock(*obj, compress_level, e.uncompressedSize);
+        e.fileOffset = f.getPosition();
+        e.compressedSize = gz.size();
+        if (!gz.empty()) f.Write(gz.data(), gz.size());
+        dir.push_back(std::move(e));
+      }
+
+    // Directory, and patch its offset in the header:
+    const uint64_t dirOffset = f.getPosition();
+    arch << static_cast<uint32_t>(dir.size());
+    for (const auto& e : dir)
+      arch << e.viewportIndex << e.className << e.bboxValid << e.bbox.min.x << e.bbox.min.y
+           << e.bbox.min.z << e.bbox.max.x << e.bbox.max.y << e.bbox.max.z << e.fileOffset
+           << e.compressedSize << e.uncompressedSize;
+
+    f.Seek(dirOffsetPos);
+    arch << dirOffset;
+    return true;
+  }
+  catch (...)
+  {
+    return false;
+  }
+}
+
+bool Scene::loadFromFileChunked(
+    const std::string& fil,
+    const std::optional<mrpt::math::TBoundingBox>& onlyObjectsIntersecting,
+    unsigned int num_threads)
+{
+  try
+  {
+    mrpt::io::CFileInputStream f(fil);
+    if (!f.fileOpenCorrectly()) return false;
+
+    bool followCamera = false;
+    std::vector<std::vector<uint8_t>> vpShellBlocks;
+    std::vector<TChunkedObjectEntry> dir;
+    if (!readChunkedHeaderAndDirectory(f, followCamera, vpShellBlocks, dir)) return false;
+
+    m_followCamera = followCamera;
+    clear(false);
+    for (const auto& blk : vpShellBlocks)
+    {
+      auto vp = std::dynamic_pointer_cast<Viewport>(deserializeFromGzBlock(blk));
+      if (!vp) return false;
+      vp->m_parent = this;
+      m_viewports.push_back(vp);
+    }
+
+    // Select the objects to load and read their blocks (sequential I/O):
+    struct TJob
+    {
+      const TChunkedObjectEntry* e = nullptr;
+      std::vector<uint8_t> gz;
+      CRenderizable::Ptr obj;
+    };
+    std::vector<TJob> jobs;
+    for (const auto& e : dir)
+    {
+      if (e.viewportIndex >= m_viewports.size()) return false;
+      // Objects without a valid bbox are always loaded:
+      if (onlyObjectsIntersecting && e.bboxValid && !e.bbox.intersection(*onlyObjectsIntersecting))
+        continue;
+
+      auto& j = jobs.emplace_back();
+      j.e = &e;
+      j.gz.resize(e.compressedSize);
+      f.Seek(e.fileOffset);
+      if (e.compressedSize != 0 && f.Read(j.gz.data(), j.gz.size()) != j.gz.size())
+        return false;
+    }
+
+    // Decompress + deserialize the blocks, concurrently if requested:
+    unsigned int nThreads =
+        num_threads != 0 ? num_threads : std::max(1u, std::thread::hardware_concurrency() / 2);
+    nThreads = std::min<unsigned int>(nThreads, std::max<size_t>(1, jobs.size()));
+
+    std::atomic_bool anyError{false};
+    const auto runRange = [&jobs, &anyError](size_t i0, size_t i1)
+    {
+      for (size_t i = i0; i < i1 && !anyError; i++)
+      {
+        try
+        {
+          jobs[i].obj = std::dynamic_pointer_cast<CRenderizable>(deserializeFromGzBlock(jobs[i].gz));
+          if (!jobs[i].obj) anyError = true;
+        }
+        catch (...)
+        {
+          anyError = true;
+        }
+      }
+    };
+    if (nThreads <= 1)
+    {
+      runRange(0, jobs.size());
+    }
+    else
+    {
+      std::vector<std::thread> threads;
+      threads.reserve(nThreads);
+      for (unsigned int b = 0; b < nThreads; b++)
+        threads.emplace_back(
+            runRange, (jobs.size() * b) / nThreads, (jobs.size() * (b + 1)) / nThreads);
+      for (auto& t : threads) t.join();
+    }
+    if (anyError) return false;
+
+    // Insert the objects, keeping the on-disk order:
+    for (auto& j : jobs) m_viewports[j.e->viewportIndex]->m_objects.push_back(std::move(j.obj));
+
+    return true;
+  }
+  catch (...)
+  {
+    return false;
+  }
+}
+
+bool Scene::readChunkedDirectory(const std::string& fil, std::vector<TChunkedObjectEntry>& dir)
+{
+  try
+  {
+    mrpt::io::CFileInputStream f(fil);
+    if (!f.fileOpenCorrectly()) return false;
+
+    bool followCamera = false;
+    std::vector<std::vector<uint8_t>> vpShellBlocks;
+    return readChunkedHeaderAndDirectory(f, followCamera, vpShellBlocks, dir);
+  }
+  catch (...)
+  {
+    return false;
+  }
+}
+
 /** Evaluates the bounding box of this object (including possible children) in
  * the coordinate frame of the object parent. */
 auto Scene::getBoundingBox(const std::string& vpn) const -> mrpt::math::TBoundingBox
@@ -14,6 +14,7 @@
 #include <mrpt/opengl/Texture.h>
 #include <mrpt/opengl/opengl_api.h>
 
+#include <cstring>
 #include <iostream>
 #include <mutex>
 #include <set>
@@ -223,8 +224,123 @@ unsigned char* reserveDataBuffer(size_t len, std::vector<uint8_t>& data)
   size_t space = len;
   return reinterpret_cast<unsigned char*>(std::align(16, 1 /*dummy size*/, ptr, space));
 }
+
+#if MRPT_HAS_OPENGL_GLUT || MRPT_HAS_EGL
+#if defined(GL_PIXEL_UNPACK_BUFFER) && defined(GL_MAP_WRITE_BIT) && \
+    defined(GL_MAP_INVALIDATE_BUFFER_BIT)
+#define TEXTURE_UPLOAD_HAS_PBO 1
+#endif
+#endif
+
+/** Binds and maps one slot of a small per-GL-thread ring of pixel-unpack
+ * buffer objects (PBOs), used as staging memory for texture uploads: the
+ * subsequent glTexImage2D() then sources its data from the GPU-visible
+ * buffer and returns without blocking on a client-memory copy, so the
+ * actual transfer overlaps with the rest of the scene load.
+ * Returns nullptr if PBOs are unsupported, so callers can fall back to the
+ * regular client-memory upload path.
+ * Note that the buffer names belong to the thread's GL context and are
+ * released together with it, hence no explicit glDeleteBuffers() here. */
+unsigned char* mapPboForTextureUpload(const size_t len)
+{
+#ifdef TEXTURE_UPLOAD_HAS_PBO
+  constexpr size_t RING_LEN = 3;
+  struct TPboRing
+  {
+    GLuint ids[RING_LEN] = {0, 0, 0};
+    size_t capacities[RING_LEN] = {0, 0, 0};
+    size_t next = 0;
+  };
+  thread_local TPboRing ring;
+
+  const size_t slot = ring.next;
+  ring.next = (ring.next + 1) % RING_LEN;
+
+  if (!ring.ids[slot])
+  {
+    glGenBuffers(1, &ring.ids[slot]);
+    if (!ring.ids[slot]) return nullptr;
+  }
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, ring.ids[slot]);
+  CHECK_OPENGL_ERROR_IN_DEBUG();
+
+  // (Re)allocate the data store, orphaning any former contents the driver
+  // may still be DMA-ing from, so we never synchronize with it:
+  if (ring.capacities[slot] < len) ring.capacities[slot] = len;
+  glBufferData(GL_PIXEL_UNPACK_BUFFER, ring.capacities[slot], nullptr, GL_STREAM_DRAW);
+  CHECK_OPENGL_ERROR_IN_DEBUG();
+
+  void* ptr = glMapBufferRange(
+      GL_PIXEL_UNPACK_BUFFER, 0, len, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+  if (!ptr)
+  {
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    return nullptr;
+  }
+  return reinterpret_cast<unsigned char*>(ptr);
+#else
+  (void)len;
+  return nullptr;
+#endif
+}
+
+/** Unmaps the PBO from mapPboForTextureUpload(). Returns false if the driver
+ * discarded the buffer contents (rare; e.g. a display mode switch), in which
+ * case the caller must re-upload from client memory. */
+bool unmapUploadPbo()
+{
+#ifdef TEXTURE_UPLOAD_HAS_PBO
+  return glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER) == GL_TRUE;
+#else
+  return false;
+#endif
+}
+
+void unbindUploadPbo()
+{
+#ifdef TEXTURE_UPLOAD_HAS_PBO
+  glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+  CHECK_OPENGL_ERROR_IN_DEBUG();
+#endif
+}
 }  // namespace
 
+uint64_t mrpt::opengl::textureImageContentHash(const mrpt::img::CImage& im)
+{
+  // FNV-1a over the image geometry and pixel rows, consuming 8 bytes per
+  // round so hashing runs at near-memcpy speed:
+  uint64_t h = 0xcbf29ce484222325ULL;
+  const auto fnv = [&h](const uint8_t* d, size_t n)
+  {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+      uint64_t v;
+      std::memcpy(&v, d + i, 8);
+      h ^= v;
+      h *= 0x100000001b3ULL;
+    }
+    for (; i < n; i++)
+    {
+      h ^= d[i];
+      h *= 0x100000001b3ULL;
+    }
+  };
+
+  if (im.isEmpty()) return h;
+  im.forceLoad();  // in case it is an external-storage (lazy load) image
+
+  const uint32_t geometry[3] = {
+      static_cast<uint32_t>(im.getWidth()), static_cast<uint32_t>(im.getHeight()),
+      static_cast<uint32_t>(im.channelCount())};
+  fnv(reinterpret_cast<const uint8_t*>(&geometry), sizeof(geometry));
+
+  const size_t rowBytes = im.getWidth() * im.channelCount();
+  for (size_t y = 0; y < im.getHeight(); y++) fnv(im.ptrLine<uint8_t>(y), rowBytes);
+
+  return h;
+}
+
 void Texture::internalAssignImage_2D(
     const mrpt::img::CImage* in_rgb,
     const mrpt::img::CImage* in_alpha,
@@ -354,26 +470,44 @@ void Texture::internalAssignImage_2D(
     tim.enter(sSec.c_str());
 #endif
 
-    dataAligned = reserveDataBuffer(height * width * 4 + 512, data);
-
-#ifdef TEXTUREOBJ_PROFILE_MEM_ALLOC
-    tim.leave(sSec.c_str());
-#endif
-
-    for (int y = 0; y < height; y++)
+    const auto fillRGBA = [&](unsigned char* dst)
     {
-      unsigned char* ptrSrcCol = rgb(0, y, 0);
-      unsigned char* ptrSrcAlfa = alpha(0, y);
-      unsigned char* ptr = dataAligned + y * width * 4;
-
-      for (int x = 0; x < width; x++)
+      for (int y = 0; y < height; y++)
       {
-        *ptr++ = *ptrSrcCol++;
-        *ptr++ = *ptrSrcCol++;
-        *ptr++ = *ptrSrcCol++;
-        *ptr++ = *ptrSrcAlfa++;
+        unsigned char* ptrSrcCol = rgb(0, y, 0);
+        unsigned char* ptrSrcAlfa = alpha(0, y);
+        unsigned char* ptr = dst + y * width * 4;
+
+        for (int x = 0; x < width; x++)
+        {
+          *ptr++ = *ptrSrcCol++;
+          *ptr++ = *ptrSrcCol++;
+          *ptr++ = *ptrSrcCol++;
+          *ptr++ = *ptrSrcAlfa++;
+        }
       }
+    };
+
+    // Try to interleave the pixels straight into a mapped staging PBO, so
+    // the glTexImage2D() below is asynchronous:
+    const size_t nBytes = static_cast<size_t>(height) * width * 4;
+    bool viaPBO = false;
+    if (unsigned char* pboDest = mapPboForTextureUpload(nBytes); pboDest)
+    {
+      fillRGBA(pboDest);
+      viaPBO = unmapUploadPbo();
+      if (!viaPBO) unbindUploadPbo();
     }
+    if (!viaPBO)
+    {
+      // Fallback: regular upload from client memory.
+      dataAligned = reserveDataBuffer(nBytes + 512, data);
+      fillRGBA(dataAligned);
+    }
+
+#ifdef TEXTUREOBJ_PROFILE_MEM_ALLOC
+    tim.leave(sSec.c_str());
+#endif
 
     // Prepare image data types:
     const GLenum img_type = GL_UNSIGNED_BYTE;
@@ -386,11 +520,13 @@ void Texture::internalAssignImage_2D(
     glPixelStorei(GL_UNPACK_ROW_LENGTH, width);
     glTexImage2D(
         GL_TEXTURE_2D, 0 /*level*/, GL_RGBA8 /* RGB components */, width, height, 0 /*border*/,
-        img_format, img_type, dataAligned);
+        img_format, img_type, viaPBO ? nullptr : dataAligned);
     CHECK_OPENGL_ERROR_IN_DEBUG();
     glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);  // Reset
     CHECK_OPENGL_ERROR_IN_DEBUG();
 
+    if (viaPBO) unbindUploadPbo();
+
   }  // End of color texture WITH trans.
   else
   {
@@ -416,17 +552,32 @@ void Texture::internalAssignImage_2D(
       THROW_EXCEPTION("Invalid texture image channel count.");
     }();
 
+    // Try to stage a packed copy of the pixel rows in a PBO, so the
+    // glTexImage2D() below is asynchronous:
+    const size_t rowBytes = static_cast<size_t>(width) * nBytesPerPixel;
+    bool viaPBO = false;
+    if (unsigned char* pboDest = mapPboForTextureUpload(rowBytes * height); pboDest)
+    {
+      for (int y = 0; y < height; y++)
+        std::memcpy(pboDest + y * rowBytes, rgb.ptrLine<uint8_t>(y), rowBytes);
+      viaPBO = unmapUploadPbo();
+      if (!viaPBO) unbindUploadPbo();
+    }
+
     // Send image data to OpenGL:
     glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
     CHECK_OPENGL_ERROR_IN_DEBUG();
-    glPixelStorei(GL_UNPACK_ROW_LENGTH, rgb.getRowStride() / nBytesPerPixel);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, viaPBO ? width : rgb.getRowStride() / nBytesPerPixel);
     CHECK_OPENGL_ERROR_IN_DEBUG();
     glTexImage2D(
         GL_TEXTURE_2D, 0 /*level*/, nBytesPerPixel == 3 ? GL_RGB8 : GL_RGBA8 /* RGB components */,
-        width, height, 0 /*border*/, img_format, img_type, rgb.ptrLine<uint8_t>(0));
+        width, height, 0 /*border*/, img_format, img_type,
+        viaPBO ? nullptr : rgb.ptrLine<uint8_t>(0));
     CHECK_OPENGL_ERROR_IN_DEBUG();
     glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);  // Reset
     CHECK_OPENGL_ERROR_IN_DEBUG();
+
+    if (viaPBO) unbindUploadPbo();
   }  // End of color texture WITHOUT trans.
 
   if (o.generateMipMaps)
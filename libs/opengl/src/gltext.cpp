@@ -19,6 +19,8 @@
 #include <cassert>
 #include <cmath>
 #include <map>
+#include <mutex>
+#include <tuple>
 
 #include "gltext.h"
 
@@ -153,6 +155,55 @@ void glSetFont(const std::string& fontname)
 
 const std::string& glGetFont() { return data.currentFontName; }
 
+// Shared cache of tessellated string geometry: monitoring GUIs re-generate
+// hundreds of labels per frame, most of them with recurring strings (numbers,
+// status words), so once a (font,style,text) combination has been tessellated
+// we keep the resulting triangles/lines and re-append them on the next request
+// instead of walking the font tables again.
+namespace
+{
+struct TextCacheKey
+{
+  const Font* font;
+  TEXT_STYLE style;
+  double spacing, kerning;
+  std::string text;
+
+  bool operator<(const TextCacheKey& o) const
+  {
+    return std::tie(font, style, spacing, kerning, text) <
+           std::tie(o.font, o.style, o.spacing, o.kerning, o.text);
+  }
+};
+struct TextCacheEntry
+{
+  std::vector<mrpt::opengl::TTriangle> tris;
+  std::vector<mrpt::math::TPoint3Df> lines;
+  std::pair<double, double> extends;
+};
+
+std::mutex textCacheMtx;
+std::map<TextCacheKey, TextCacheEntry> textCache;
+// Cap the cache memory for pathological workloads (e.g. free-running counters
+// that never repeat a string): wiping it entirely is cheap since entries are
+// regenerated on demand.
+constexpr size_t MAX_CACHED_STRINGS = 1024;
+
+std::pair<double, double> glDrawTextUncached(
+    const std::string& text,
+    std::vector<mrpt::opengl::TTriangle>& tris,
+    std::vector<mrpt::math::TPoint3Df>& render_lines,
+    TEXT_STYLE style,
+    double spacing,
+    double kerning);
+}  // namespace
+
+void glClearTextCache()
+{
+  std::lock_guard<std::mutex> lck(textCacheMtx);
+  textCache.clear();
+}
+
 std::pair<double, double> glDrawText(
     const std::string& text,
     std::vector<mrpt::opengl::TTriangle>& tris,
@@ -160,6 +211,33 @@ std::pair<double, double> glDrawText(
     TEXT_STYLE style,
     double spacing,
     double kerning)
+{
+  TextCacheKey key{data.currentFont(), style, spacing, kerning, text};
+
+  std::lock_guard<std::mutex> lck(textCacheMtx);
+  auto it = textCache.find(key);
+  if (it == textCache.end())
+  {
+    if (textCache.size() >= MAX_CACHED_STRINGS) textCache.clear();
+    it = textCache.emplace(std::move(key), TextCacheEntry()).first;
+    TextCacheEntry& e = it->second;
+    e.extends = glDrawTextUncached(text, e.tris, e.lines, style, spacing, kerning);
+  }
+  const TextCacheEntry& e = it->second;
+  tris.insert(tris.end(), e.tris.begin(), e.tris.end());
+  render_lines.insert(render_lines.end(), e.lines.begin(), e.lines.end());
+  return e.extends;
+}
+
+namespace
+{
+std::pair<double, double> glDrawTextUncached(
+    const std::string& text,
+    std::vector<mrpt::opengl::TTriangle>& tris,
+    std::vector<mrpt::math::TPoint3Df>& render_lines,
+    TEXT_STYLE style,
+    double spacing,
+    double kerning)
 {
   // Was: glPushMatrix();
   mrpt::math::TPoint2Df cursor = {0, 0};
@@ -234,6 +312,7 @@ std::pair<double, double> glDrawText(
   max_total = std::max(total, max_total);
   return std::make_pair(max_total, (lines + 1) * spacing);
 }
+}  // namespace
 
 std::pair<double, double> glGetExtends(const std::string& text, double spacing, double kerning)
 {
@@ -36,6 +36,12 @@ void glSetFont(const std::string& fontname);
 /// returns the name of the currently active font
 const std::string& glGetFont();
 
+/// empties the shared cache of tessellated string geometry kept by
+/// glDrawText(). The cache is self-bounded and regenerated on demand, so
+/// calling this is only needed to release its memory.
+/// \note [New in MRPT 2.14.5]
+void glClearTextCache();
+
 /// different style for font rendering
 using TEXT_STYLE = TOpenGLFontStyle;
 
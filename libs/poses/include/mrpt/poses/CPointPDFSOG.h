@@ -118,6 +118,18 @@ class CPointPDFSOG : public CPointPDF
   /** Normalize the weights in m_modes such as the maximum log-weight is 0 */
   void normalizeWeights();
 
+  /** Merge very close modes so the overall number of modes is reduced while
+   * preserving the total distribution.
+   *  This method uses the approach described in the paper:
+   *  - "Kullback-Leibler Approach to Gaussian Mixture Reduction" AR
+   * Runnalls. IEEE Transactions on Aerospace and Electronic Systems, 2007.
+   *
+   *  \param max_KLd The maximum KL-divergence to consider the merge of two
+   * nodes (and then stops the process).
+   * \note [New in MRPT 2.14.5]
+   */
+  void mergeModes(double max_KLd = 0.5, bool verbose = false);
+
   /** Return the Gaussian mode with the highest likelihood (or an empty
    * Gaussian if there are no modes in this SOG) */
   void getMostLikelyMode(CPointPDFGaussian& outVal) const;
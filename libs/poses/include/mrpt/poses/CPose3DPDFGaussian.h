@@ -171,6 +171,27 @@ class CPose3DPDFGaussian : public CPose3DPDF, public mrpt::Stringifyable
    */
   void operator-=(const CPose3DPDFGaussian& Ap);
 
+  /** this = x (+) u: pose composition writing the result straight into this
+   * object (which may be uninitialized), without the mean/covariance copies
+   * that `res = x; res += u;` requires \sa operator+=, inverseComposeFrom
+   * \note [New in MRPT 2.14.5] */
+  void composeFrom(const CPose3DPDFGaussian& x, const CPose3DPDFGaussian& u);
+
+  /** this = x (-) u: pose inverse composition writing the result straight
+   * into this object (which may be uninitialized) \sa operator-=, composeFrom
+   * \note [New in MRPT 2.14.5] */
+  void inverseComposeFrom(const CPose3DPDFGaussian& x, const CPose3DPDFGaussian& u);
+
+  /** Batch version of repeated operator+=: returns
+   * origin (+) increments[0] (+) ... (+) increments[n-1].
+   * The accumulator is kept in the intermediate quaternion representation
+   * for the whole chain, so the 7D<->6D conversions (and their Jacobians)
+   * are computed once instead of once per increment; useful when fusing
+   * long chains of edge PDFs \sa operator+=
+   * \note [New in MRPT 2.14.5] */
+  static CPose3DPDFGaussian composeChain(
+      const CPose3DPDFGaussian& origin, const std::vector<CPose3DPDFGaussian>& increments);
+
   /** Evaluates the PDF at a given point.
    */
   double evaluatePDF(const CPose3D& x) const;
@@ -198,8 +219,8 @@ class CPose3DPDFGaussian : public CPose3DPDF, public mrpt::Stringifyable
  * +=  */
 inline CPose3DPDFGaussian operator+(const CPose3DPDFGaussian& x, const CPose3DPDFGaussian& u)
 {
-  CPose3DPDFGaussian res(x);
-  res += u;
+  CPose3DPDFGaussian res(UNINITIALIZED_POSE);
+  res.composeFrom(x, u);
   return res;
 }
 
@@ -207,8 +228,8 @@ inline CPose3DPDFGaussian operator+(const CPose3DPDFGaussian& x, const CPose3DPD
  * -=  */
 inline CPose3DPDFGaussian operator-(const CPose3DPDFGaussian& x, const CPose3DPDFGaussian& u)
 {
-  CPose3DPDFGaussian res(x);
-  res -= u;
+  CPose3DPDFGaussian res(UNINITIALIZED_POSE);
+  res.inverseComposeFrom(x, u);
   return res;
 }
 
@@ -166,6 +166,17 @@ class CPose3DQuat :
     composePoint(L[0], L[1], L[2], G[0], G[1], G[2]);
   }
 
+  /** Batched version of composePoint() (without Jacobians): G[i] = this
+   * \f$\oplus\f$ L[i], for all the points in the input array. It is valid for
+   * G and L to be the same vector (in-place operation). Rotation is done
+   * through CQuaternion::rotatePoints(), which precomputes the rotation terms
+   * once for the whole array.
+   * \note [New in MRPT 2.14.5]
+   * \sa composePoint, mrpt::math::CQuaternion::rotatePoints
+   */
+  void composePoints(
+      const std::vector<mrpt::math::TPoint3D>& L, std::vector<mrpt::math::TPoint3D>& G) const;
+
   /**  Computes the 3D point L such as \f$ L = G \ominus this \f$.  \sa
    * inverseComposePoint */
   template <class POINT1, class POINT2>
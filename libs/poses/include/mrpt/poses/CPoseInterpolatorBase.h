@@ -14,6 +14,8 @@
 #include <mrpt/poses/poses_frwds.h>
 #include <mrpt/typemeta/TEnumType.h>
 
+#include <vector>
+
 namespace mrpt::poses
 {
 /** Type to select the interpolation method in CPoseInterpolatorBase derived
@@ -94,6 +96,7 @@ class CPoseInterpolatorBase
 
   iterator erase(iterator element_to_erase)
   {
+    m_compiled_dirty = true;
     m_path.erase(element_to_erase++);
     return element_to_erase;
   }
@@ -127,6 +130,28 @@ class CPoseInterpolatorBase
   cpose_t& interpolate(
       const mrpt::Clock::time_point& t, cpose_t& out_interp, bool& out_valid_interp) const;
 
+  /** Batched version of interpolate() for many timestamps at once, e.g. one
+   * query per point when deskewing a lidar scan. Queries run against a
+   * compiled (flat, time-sorted) copy of the trajectory, so each lookup is a
+   * cache-friendly binary search on a contiguous array instead of a std::map
+   * traversal. The compiled copy is rebuilt automatically after any
+   * insert()/erase()/clear(); if poses are modified in-place through
+   * non-const iterators, call compileTrajectory() before querying.
+   * Output vectors are resized to ts.size(); out_valid[i] follows the same
+   * criteria than in interpolate().
+   * \sa interpolate, compileTrajectory
+   * \note [New in MRPT 2.14.5] */
+  void interpolateMany(
+      const std::vector<mrpt::Clock::time_point>& ts,
+      std::vector<pose_t>& out_interp,
+      std::vector<bool>& out_valid) const;
+
+  /** Rebuilds the compiled trajectory used by interpolateMany(). Called
+   * automatically when needed; only required explicitly after modifying
+   * poses in-place through non-const iterators. \sa interpolateMany
+   * \note [New in MRPT 2.14.5] */
+  void compileTrajectory() const;
+
   /** Clears the current sequence of poses */
   void clear();
 
@@ -213,6 +238,12 @@ class CPoseInterpolatorBase
   mrpt::Clock::duration maxTimeInterpolation;
   TInterpolatorMethod m_method{mrpt::poses::imLinearSlerp};
 
+  /** Flat, time-sorted copy of m_path ("compiled" trajectory) used by
+   * interpolateMany(), rebuilt on demand. \sa compileTrajectory */
+  mutable std::vector<mrpt::Clock::time_point> m_compiled_ts;
+  mutable std::vector<pose_t> m_compiled_poses;
+  mutable bool m_compiled_dirty{true};
+
   void impl_interpolation(
       const TTimePosePair& p1,
       const TTimePosePair& p2,
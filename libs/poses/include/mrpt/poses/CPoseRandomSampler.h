@@ -16,6 +16,7 @@
 #include <mrpt/poses/CPosePDF.h>
 
 #include <memory>  // unique_ptr
+#include <vector>
 
 namespace mrpt::poses
 {
@@ -93,6 +94,21 @@ class CPoseRandomSampler
    */
   CPose3D& drawSample(CPose3D& p) const;
 
+  /** Batch version of drawSample(): generates \a N new samples into \a
+   * outSamples (resized to \a N). For Gaussian PDFs, all the underlying
+   * normalized variates are produced with one batch fill and expanded
+   * through the covariance factor cached by setPosePDF(), which is much
+   * faster than N individual draws; other PDF types fall back to per-sample
+   * drawSample() calls. As with drawSample(), 2D samples can be drawn from a
+   * 3D PDF and vice versa.
+   * \note [New in MRPT 2.14.5]
+   * \sa setPosePDF, drawSample
+   */
+  void drawSamples(size_t N, std::vector<CPose2D>& outSamples) const;
+
+  /// \overload
+  void drawSamples(size_t N, std::vector<CPose3D>& outSamples) const;
+
   /** Return true if samples can be generated, which only requires a previous
    * call to setPosePDF */
   bool isPrepared() const;
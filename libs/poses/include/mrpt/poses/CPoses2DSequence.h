@@ -56,11 +56,23 @@ class CPoses2DSequence : public mrpt::serialization::CSerializable
    * returned, and for "n=posesCount()", the pose
    *  of robot after moving ALL poses is returned, all of them relative to the
    * starting pose.
+   *  Since MRPT 2.14.5, cumulative poses are cached internally, so repeated
+   * queries at arbitrary indices cost O(1) instead of recomposing the whole
+   * chain each time.
    * \exception std::exception On invalid index value
-   * \sa absolutePoseAfterAll
+   * \sa absolutePoseAfterAll, absolutePosesOfRange
    */
   CPose2D absolutePoseOf(unsigned int n);
 
+  /** Batched version of absolutePoseOf(): returns the absolute poses for all
+   * the indices n = first, first+1, ..., last (both included), with the same
+   * convention for "n" than absolutePoseOf().
+   * \exception std::exception On invalid index values
+   * \note [New in MRPT 2.14.5]
+   * \sa absolutePoseOf
+   */
+  void absolutePosesOfRange(unsigned int first, unsigned int last, std::vector<CPose2D>& outPoses);
+
   /** A shortcut for "absolutePoseOf( posesCount() )".
    * \sa absolutePoseOf, posesCount
    */
@@ -88,5 +100,14 @@ class CPoses2DSequence : public mrpt::serialization::CSerializable
    */
   std::vector<CPose2D> poses;
 
+  /** Cache of cumulative poses: m_absPoseCache[n] is the absolute pose after
+   * the first "n" relative poses, with m_absPoseCache[0]=(0,0,0deg). Extended
+   * lazily by updateAbsPoseCache(); mid-sequence edits via changePose() only
+   * invalidate the suffix starting at the edited index. */
+  std::vector<CPose2D> m_absPoseCache;
+
+  /** Makes sure m_absPoseCache holds (at least) the entries [0,n] */
+  void updateAbsPoseCache(size_t n);
+
 };  // End of class def.
 }  // namespace mrpt::poses
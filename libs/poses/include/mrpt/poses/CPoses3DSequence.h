@@ -11,6 +11,8 @@
 #include <mrpt/poses/CPose3D.h>
 #include <mrpt/serialization/CSerializable.h>
 
+#include <vector>
+
 namespace mrpt::poses
 {
 /** This class stores a sequence of relative, incremental 3D poses. It is useful
@@ -54,11 +56,23 @@ class CPoses3DSequence : public mrpt::serialization::CSerializable
    * returned, and for "n=posesCount()", the pose
    *  of robot after moving ALL poses is returned, all of them relative to the
    * starting pose.
+   *  Since MRPT 2.14.5, cumulative poses are cached internally, so repeated
+   * queries at arbitrary indices cost O(1) instead of recomposing the whole
+   * chain each time.
    * \exception std::exception On invalid index value
-   * \sa absolutePoseAfterAll
+   * \sa absolutePoseAfterAll, absolutePosesOfRange
    */
   CPose3D absolutePoseOf(unsigned int n);
 
+  /** Batched version of absolutePoseOf(): returns the absolute poses for all
+   * the indices n = first, first+1, ..., last (both included), with the same
+   * convention for "n" than absolutePoseOf().
+   * \exception std::exception On invalid index values
+   * \note [New in MRPT 2.14.5]
+   * \sa absolutePoseOf
+   */
+  void absolutePosesOfRange(unsigned int first, unsigned int last, std::vector<CPose3D>& outPoses);
+
   /** A shortcut for "absolutePoseOf( posesCount() )".
    * \sa absolutePoseOf, posesCount
    */
@@ -86,5 +100,14 @@ class CPoses3DSequence : public mrpt::serialization::CSerializable
    */
   std::vector<mrpt::math::TPose3D> m_poses;
 
+  /** Cache of cumulative poses: m_absPoseCache[n] is the absolute pose after
+   * the first "n" relative poses, with m_absPoseCache[0]=(0,0,0). Extended
+   * lazily by updateAbsPoseCache(); mid-sequence edits via changePose() only
+   * invalidate the suffix starting at the edited index. */
+  std::vector<CPose3D> m_absPoseCache;
+
+  /** Makes sure m_absPoseCache holds (at least) the entries [0,n] */
+  void updateAbsPoseCache(size_t n);
+
 };  // End of class def.
 }  // namespace mrpt::poses
@@ -12,7 +12,11 @@
 #include <mrpt/system/datetime.h>
 
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace mrpt::poses
 {
@@ -84,6 +88,16 @@ class FrameTransformerInterface
 
 /** See docs in FrameTransformerInterface.
  *   This class is an implementation for standalone (non ROS) applications.
+ *
+ * Thread-safety: the frame tree is kept as an immutable snapshot behind an
+ * atomic pointer (RCU style). sendTransform() builds a new snapshot and swaps
+ * it in; lookupTransform() just grabs the current snapshot, so concurrent
+ * readers never block, neither among themselves nor against a publisher.
+ * Each frame pair additionally caches a small history of its most recent
+ * stamped transforms, so lookups at a given `query_time` are answered by
+ * geodesic (SE(n)) interpolation between the two bracketing samples.
+ * [New in MRPT 2.14.5]
+ *
  * \ingroup poses_grp
  * \sa FrameTransformerInterface
  */
@@ -129,14 +143,21 @@ class FrameTransformer : public FrameTransformerInterface<DIM>
  protected:
   // double m_max_extrapolation_time;  //!< for extrapolation in the past or
   // in the future [s]
-  // double m_max_age_pose_cache;      //!< Max age of stored poses [s]
+
+  /** Max number of stamped transforms cached per frame pair for
+   * time-interpolated lookups */
+  static constexpr size_t MAX_EDGE_HISTORY = 16;
 
   struct TF_TreeEdge
   {
-    // TODO: CPose{2,3}DInterpolator?
+    /** Latest received transform */
     typename base_t::pose_t pose;
     mrpt::system::TTimeStamp timestamp;
 
+    /** Small per-frame-pair cache of the most recent (timestamp, pose)
+     * samples, sorted by ascending time, for interpolated lookups */
+    std::vector<std::pair<mrpt::system::TTimeStamp, typename base_t::pose_t>> history;
+
     TF_TreeEdge(const typename base_t::pose_t& pose_, const mrpt::system::TTimeStamp& timestamp_) :
         pose(pose_), timestamp(timestamp_)
     {
@@ -146,7 +167,15 @@ class FrameTransformer : public FrameTransformerInterface<DIM>
 
   // map: [parent] -> { [child] -> relPoseChildWRTParent }
   using pose_tree_t = std::map<std::string, std::map<std::string, TF_TreeEdge>>;
-  pose_tree_t m_pose_edges_buffer;
+
+  /** Immutable snapshot of the frame tree: sendTransform() clones it,
+   * applies the update and publishes the result with an atomic pointer
+   * swap, so lookupTransform() readers never block. Always access through
+   * std::atomic_load() / std::atomic_store(). */
+  std::shared_ptr<const pose_tree_t> m_tree{std::make_shared<pose_tree_t>()};
+
+  /** Serializes concurrent publishers; readers never take it */
+  std::mutex m_write_mtx;
 };
 
 }  // namespace mrpt::poses
@@ -153,6 +153,56 @@ struct SE<3>
       const type& P2,
       mrpt::optional_ref<matrix_TxT> df_de1 = std::nullopt,
       mrpt::optional_ref<matrix_TxT> df_de2 = std::nullopt);
+
+  /** Batched version of jacob_dexpe_de(): evaluates the Jacobians of "num"
+   * tangent-space vectors, writing them into the caller-provided contiguous
+   * array `out` (at least `num` elements). The constant blocks shared by all
+   * the outputs are built only once.
+   * \note [New in MRPT 2.14.5]
+   * \sa jacob_dexpe_de
+   */
+  static void jacob_dexpe_de_many(const tangent_vector* x, tang2mat_jacob* out, size_t num);
+
+  /** Batched version of jacob_dDinvP1invP2_de1e2(): evaluates the pair of
+   * 6x6 Jacobians of "num" graph-slam edges at once, writing them into the
+   * caller-provided contiguous arrays `df_de1` / `df_de2` (either may be
+   * nullptr if that Jacobian is not needed). The per-edge intermediate terms
+   * are computed only once and shared between both Jacobians, so this is the
+   * preferred entry point for relinearizing large batches of edges, e.g.
+   * from optimize_graph_spa_levmarq().
+   * \note [New in MRPT 2.14.5]
+   * \sa jacob_dDinvP1invP2_de1e2
+   */
+  static void jacob_dDinvP1invP2_de1e2_many(
+      const type* Dinv,
+      const type* P1,
+      const type* P2,
+      matrix_TxT* df_de1,
+      matrix_TxT* df_de2,
+      size_t num);
+
+  /** Applies `pose` in-place to a batch of 3D points stored as separate
+   * x/y/z arrays (structure-of-arrays layout): each point becomes
+   * \f$ pose \oplus [x~y~z] \f$.
+   *
+   * Unlike CPose3D::composePoint(), this is a Jacobian-free bulk operation:
+   * the pose matrix is flattened once, and the loop is dispatched at runtime
+   * to the widest vector kernel supported by the CPU (AVX2/SSE2 on Intel
+   * architectures, with a scalar fallback elsewhere). Use it in hot loops
+   * transforming whole point clouds (projection, ICP, map insertion).
+   *
+   * \note [New in MRPT 2.14.5]
+   * \sa inverseComposePoints, CPose3D::composePoint
+   */
+  static void composePoints(const type& pose, float* x, float* y, float* z, size_t num);
+
+  /** The inverse operation of composePoints(): each point becomes
+   * \f$ pose \ominus [x~y~z] \f$, i.e. global points are mapped into the
+   * `pose` frame of reference.
+   * \note [New in MRPT 2.14.5]
+   * \sa composePoints, CPose3D::inverseComposePoint
+   */
+  static void inverseComposePoints(const type& pose, float* x, float* y, float* z, size_t num);
 };
 
 /** Traits for SE(2), rigid-body transformations in R^2 space.
@@ -234,6 +284,20 @@ struct SE<2>
       const type& P2,
       mrpt::optional_ref<matrix_TxT> df_de1 = std::nullopt,
       mrpt::optional_ref<matrix_TxT> df_de2 = std::nullopt);
+
+  /** Batched version of jacob_dDinvP1invP2_de1e2(), with the same semantics
+   * than the SE(3) overload: evaluates "num" edges into the caller-provided
+   * contiguous arrays (either may be nullptr).
+   * \note [New in MRPT 2.14.5]
+   * \sa jacob_dDinvP1invP2_de1e2
+   */
+  static void jacob_dDinvP1invP2_de1e2_many(
+      const type* Dinv,
+      const type* P1,
+      const type* P2,
+      matrix_TxT* df_de1,
+      matrix_TxT* df_de2,
+      size_t num);
 };
 
 }  // namespace mrpt::poses::Lie
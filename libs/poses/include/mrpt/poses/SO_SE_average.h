@@ -12,6 +12,8 @@
 #include <mrpt/poses/CPose2D.h>
 #include <mrpt/poses/CPose3D.h>
 
+#include <vector>
+
 namespace mrpt::poses
 {
 /** \addtogroup poses_grp
@@ -166,6 +168,37 @@ class SE_average<3>
   /** Adds a new pose to the weighted-average computation \sa get_average */
   void append(const mrpt::poses::CPose3D& p, const double weight);
   void append(const mrpt::math::TPose3D& p, const double weight);
+
+  /** Batch version of append() for whole sets of pose samples, with optional
+   * per-sample weights (leave empty for uniform 1.0). Batches of several
+   * thousand samples are accumulated in parallel with per-thread partial
+   * sums, which is exact since the accumulator is a plain weighted sum.
+   * \note [New in MRPT 2.14.5] \sa append, get_robust_average */
+  void append_many(
+      const std::vector<mrpt::poses::CPose3D>& poses, const std::vector<double>& weights = {});
+
+  /** Robust average of a set of SE(3) pose samples, down-weighting outliers
+   * by iterative re-weighting with a Huber-like weight on the combined
+   * translation (meters) + rotation (radians) residual; the cutoff is picked
+   * from the median residual of the initial uniform pass. Instead of
+   * restarting the accumulation from scratch on each pass, the accumulators
+   * are updated incrementally with each sample's weight *change*, so later
+   * passes only touch the samples whose weight actually moved.
+   * Any previously accumulated state of this object is discarded; upon
+   * return, the accumulators hold the final weighted sample set.
+   * \param poses The input pose samples (e.g. relative-pose hypotheses for
+   *        one map-merging edge).
+   * \param out_mean The robust average.
+   * \param out_weights If non-null, the final per-sample weights in [0,1]
+   *        (outliers end up with lower values).
+   * \param maxIterations Maximum number of re-weighting passes.
+   * \note [New in MRPT 2.14.5] \sa append_many, get_average */
+  void get_robust_average(
+      const std::vector<mrpt::poses::CPose3D>& poses,
+      mrpt::poses::CPose3D& out_mean,
+      std::vector<double>* out_weights = nullptr,
+      const size_t maxIterations = 10);
+
   /** Returns the average pose.
    * \exception std::logic_error If no data point were inserted.
    * \exception std::runtime_error Upon undeterminate average value (ie the
@@ -47,6 +47,41 @@ static mrpt::math::TPose3D toTPose3D(const gtsam::Pose3& p)
   return mrpt::poses::CPose3D(H).asTPose();
 }
 
+/** Zero-copy, read-only Eigen view of the 3x3 rotation block of a CPose3D,
+ * in its native RowMajor layout. Usable anywhere an Eigen expression is
+ * accepted (e.g. the gtsam::Rot3 constructor) without building a temporary
+ * matrix. Valid while the pose is alive and unmodified.
+ * \note [New in MRPT 2.14.5] */
+static Eigen::Map<const Eigen::Matrix<double, 3, 3, Eigen::RowMajor>> viewRotation(
+    const mrpt::poses::CPose3D& p)
+{
+  return Eigen::Map<const Eigen::Matrix<double, 3, 3, Eigen::RowMajor>>(
+      p.getRotationMatrix().data());
+}
+
+/** Zero-copy, read-only Eigen view of the [x y z] translation of a CPose3D
+ * (same lifetime rules as viewRotation()).
+ * \note [New in MRPT 2.14.5] */
+static Eigen::Map<const Eigen::Vector3d> viewTranslation(const mrpt::poses::CPose3D& p)
+{
+  return Eigen::Map<const Eigen::Vector3d>(p.m_coords.data());
+}
+
+/** \overload writing into a caller-provided pose: rotation and translation
+ * are assigned straight from the gtsam::Pose3 storage, without the 4x4
+ * homogeneous-matrix and TPose3D temporaries of toTPose3D().
+ * \note [New in MRPT 2.14.5] */
+static void toMRPT(const gtsam::Pose3& p, mrpt::poses::CPose3D& out)
+{
+  mrpt::math::CMatrixDouble33 R;
+  R.asEigen() = p.rotation().matrix();
+  out.setRotationMatrix(R);
+  const auto& t = p.translation();
+  out.x(t.x());
+  out.y(t.y());
+  out.z(t.z());
+}
+
 static void to_gtsam_se3_cov6(
     const mrpt::poses::CPose3DPDFGaussian& in, gtsam::Pose3& pose_out, gtsam::Matrix6& cov_out)
 {
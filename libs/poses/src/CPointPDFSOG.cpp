@@ -20,6 +20,7 @@
 #include <mrpt/system/os.h>
 
 #include <Eigen/Dense>
+#include <iostream>
 
 using namespace mrpt::poses;
 using namespace mrpt::math;
@@ -401,6 +402,126 @@ void CPointPDFSOG::normalizeWeights()
   MRPT_END
 }
 
+/*---------------------------------------------------------------
+            mergeModes
+ ---------------------------------------------------------------*/
+void CPointPDFSOG::mergeModes(double max_KLd, bool verbose)
+{
+  MRPT_START
+
+  normalizeWeights();
+
+  size_t N = m_modes.size();
+  if (N < 2) return;  // Nothing to do
+
+  // Method described in:
+  // "Kullback-Leibler Approach to Gaussian Mixture Reduction", A.R. Runnalls.
+  // IEEE Transactions on Aerospace and Electronic Systems, 2007.
+  //  See Eq.(21) for Bij !!
+
+  for (size_t i = 0; i < (N - 1);)
+  {
+    N = m_modes.size();  // It might have changed.
+
+    // For getting linear weights:
+    double sumW = 0;
+    for (size_t j = 0; j < N; j++) sumW += exp(m_modes[j].log_w);
+    ASSERT_(sumW);
+
+    const double Wi = exp(m_modes[i].log_w) / sumW;
+
+    double min_Bij = std::numeric_limits<double>::max();
+
+    CMatrixDouble33 min_Bij_COV;
+    size_t best_j = 0;
+
+    const auto& MUi = m_modes[i].val.mean;
+
+    // Compute B(i,j), j=[i+1,N-1]  (the discriminant)
+    for (size_t j = 0; j < N; j++)
+      if (i != j)
+      {
+        const double Wj = exp(m_modes[j].log_w) / sumW;
+        const double Wij_ = 1.0 / (Wi + Wj);
+
+        auto Pij = CMatrixDouble33(m_modes[i].val.cov.asEigen() * Wi * Wij_);
+        Pij.asEigen() += m_modes[j].val.cov.asEigen() * Wj * Wij_;
+
+        CMatrixDouble31 MUij;
+        MUij(0, 0) = m_modes[j].val.mean.x() - MUi.x();
+        MUij(1, 0) = m_modes[j].val.mean.y() - MUi.y();
+        MUij(2, 0) = m_modes[j].val.mean.z() - MUi.z();
+
+        CMatrixDouble33 AUX;
+        AUX.matProductOf_AAt(MUij);  // AUX = MUij * MUij^T
+
+        AUX *= Wi * Wj * Wij_ * Wij_;
+        Pij += AUX;
+
+        double Bij = (Wi + Wj) * log(Pij.det()) - Wi * log(m_modes[i].val.cov.det()) -
+                     Wj * log(m_modes[j].val.cov.det());
+        if (verbose)
+        {
+          cout << "try merge[" << i << ", " << j << "] -> Bij: " << Bij << endl;
+          cout << "Pij: " << Pij << endl
+               << " Pi: " << m_modes[i].val.cov << endl
+               << " Pj: " << m_modes[j].val.cov << endl;
+        }
+
+        if (Bij < min_Bij)
+        {
+          min_Bij = Bij;
+          best_j = j;
+          min_Bij_COV = Pij;
+        }
+      }
+
+    // Is a good move to merge (i,j)??
+    if (verbose) cout << "merge[" << i << ", " << best_j << "] Tempting merge: KLd = " << min_Bij;
+
+    if (min_Bij < max_KLd)
+    {
+      if (verbose) cout << " Accepted." << endl;
+
+      // Do the merge (i,j):
+      TGaussianMode Mij;
+      TGaussianMode& Mi = m_modes[i];
+      TGaussianMode& Mj = m_modes[best_j];
+
+      // Weight:
+      Mij.log_w = log(exp(Mi.log_w) + exp(Mj.log_w));
+
+      // Mean:
+      const double Wj = exp(Mj.log_w) / sumW;
+      const double Wij_ = 1.0 / (Wi + Wj);
+      const double Wi_ = Wi * Wij_;
+      const double Wj_ = Wj * Wij_;
+
+      Mij.val.mean = CPoint3D(
+          Wi_ * Mi.val.mean.x() + Wj_ * Mj.val.mean.x(),
+          Wi_ * Mi.val.mean.y() + Wj_ * Mj.val.mean.y(),
+          Wi_ * Mi.val.mean.z() + Wj_ * Mj.val.mean.z());
+
+      // Cov:
+      Mij.val.cov = min_Bij_COV;
+
+      // Replace Mi <- Mij:
+      m_modes[i] = Mij;
+      m_modes.erase(m_modes.begin() + best_j);  // erase Mj
+    }                                           // end merge
+    else
+    {
+      if (verbose) cout << " Nope." << endl;
+
+      i++;
+    }
+  }  // for i
+
+  normalizeWeights();
+
+  MRPT_END
+}
+
 /*---------------------------------------------------------------
             ESS
  ---------------------------------------------------------------*/
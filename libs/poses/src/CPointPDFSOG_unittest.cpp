@@ -0,0 +1,50 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/poses/CPointPDFSOG.h>
+
+using namespace mrpt::poses;
+
+static CPointPDFSOG::TGaussianMode makeMode(double x, double y, double z, double log_w)
+{
+  CPointPDFSOG::TGaussianMode m;
+  m.val.mean = CPoint3D(x, y, z);
+  m.val.cov.setDiagonal(3, 0.01);
+  m.log_w = log_w;
+  return m;
+}
+
+TEST(CPointPDFSOG, mergeModes)
+{
+  CPointPDFSOG sog(0);
+  // Two nearly-identical modes, plus a third far-away one:
+  sog.push_back(makeMode(1.0, 2.0, 3.0, .0));
+  sog.push_back(makeMode(1.001, 2.0, 3.0, .0));
+  sog.push_back(makeMode(50.0, -20.0, 3.0, .0));
+
+  CPoint3D meanBefore;
+  sog.getMean(meanBefore);
+
+  sog.mergeModes(0.5 /* max KLd */);
+
+  // Only the two close ones must have been merged:
+  EXPECT_EQ(sog.size(), 2U);
+
+  // The overall mean must be (almost) unmodified:
+  CPoint3D meanAfter;
+  sog.getMean(meanAfter);
+  EXPECT_NEAR(meanBefore.x(), meanAfter.x(), 1e-6);
+  EXPECT_NEAR(meanBefore.y(), meanAfter.y(), 1e-6);
+  EXPECT_NEAR(meanBefore.z(), meanAfter.z(), 1e-6);
+
+  // Far-away modes: nothing to merge:
+  sog.mergeModes(0.5);
+  EXPECT_EQ(sog.size(), 2U);
+}
@@ -18,6 +18,7 @@
 #include <mrpt/poses/CPose3D.h>
 #include <mrpt/serialization/CArchive.h>
 #include <mrpt/serialization/CSchemeArchiveBase.h>
+#include <mrpt/serialization/TFieldsSchema.h>
 
 #include <Eigen/Dense>
 #include <limits>
@@ -52,11 +53,28 @@ CPose2D::CPose2D(const CPose3D& p) : m_phi(p.yaw()), m_cossin_uptodate(false)
   m_coords[1] = p.y();
 }
 
+namespace
+{
+// Bulk layout of the v1 stream format (x,y,phi as doubles), so poses are
+// (de)serialized in one buffer operation instead of three:
+const auto& pose2DSchema()
+{
+  static const auto schema = []
+  {
+    CPose2D p;
+    mrpt::serialization::TFieldsSchema<CPose2D> s;
+    s.add(p, p[0]).add(p, p[1]).add(p, p[2]);
+    return s;
+  }();
+  return schema;
+}
+}  // namespace
+
 uint8_t CPose2D::serializeGetVersion() const { return 1; }
 void CPose2D::serializeTo(mrpt::serialization::CArchive& out) const
 {
   // The coordinates:
-  out << m_coords[0] << m_coords[1] << m_phi;
+  pose2DSchema().writeTo(out, *this);
 }
 void CPose2D::serializeFrom(mrpt::serialization::CArchive& in, uint8_t version)
 {
@@ -75,7 +93,7 @@ void CPose2D::serializeFrom(mrpt::serialization::CArchive& in, uint8_t version)
     case 1:
     {
       // The coordinates:
-      in >> m_coords[0] >> m_coords[1] >> m_phi;
+      pose2DSchema().readFrom(in, *this);
       m_cossin_uptodate = false;
     }
     break;
@@ -48,6 +48,7 @@ void CPose3DInterpolator::serializeFrom(mrpt::serialization::CArchive& in, uint8
     default:
       MRPT_THROW_UNKNOWN_SERIALIZATION_VERSION(version);
   };
+  m_compiled_dirty = true;
 }
 
 namespace mrpt::poses
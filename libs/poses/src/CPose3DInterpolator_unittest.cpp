@@ -49,3 +49,55 @@ TEST(CPose3DInterpolator, interp)
           .sum(),
       2e-4);
 }
+
+TEST(CPose3DInterpolator, interpolateMany)
+{
+  using namespace mrpt::poses;
+  using namespace mrpt;  // for 0.0_deg
+  using mrpt::math::TPose3D;
+
+  const auto t0 = mrpt::Clock::now();
+  const mrpt::Clock::duration dt(std::chrono::milliseconds(100));
+
+  CPose3DInterpolator pose_path;
+  for (int i = 0; i < 10; i++)
+  {
+    pose_path.insert(
+        t0 + i * dt,
+        TPose3D(0.1 * i, 0.2 * i, 0.05 * i * i, DEG2RAD(3.0 * i), DEG2RAD(0.5 * i), .0_deg));
+  }
+
+  // Queries: exact matches, in-between, and out-of-range timestamps:
+  std::vector<mrpt::Clock::time_point> ts;
+  for (int i = -2; i < 22; i++) ts.push_back(t0 + i * (dt / 2));
+
+  for (const auto method : {imSpline, imLinear2Neig, imLinear4Neig, imLinearSlerp, imSplineSlerp})
+  {
+    pose_path.setInterpolationMethod(method);
+
+    std::vector<TPose3D> many_poses;
+    std::vector<bool> many_valid;
+    pose_path.interpolateMany(ts, many_poses, many_valid);
+    ASSERT_EQ(many_poses.size(), ts.size());
+    ASSERT_EQ(many_valid.size(), ts.size());
+
+    // Must match the one-by-one queries exactly:
+    for (size_t i = 0; i < ts.size(); i++)
+    {
+      TPose3D p;
+      bool valid;
+      pose_path.interpolate(ts[i], p, valid);
+      EXPECT_EQ(valid, static_cast<bool>(many_valid[i])) << "method=" << method << " i=" << i;
+      if (!valid) continue;
+      for (int k = 0; k < 6; k++)
+        EXPECT_DOUBLE_EQ(p[k], many_poses[i][k]) << "method=" << method << " i=" << i << " k=" << k;
+    }
+  }
+
+  // The compiled cache must refresh after editing the path:
+  pose_path.insert(t0 + 20 * dt, TPose3D(5., 5., 5., .0_deg, .0_deg, .0_deg));
+  std::vector<TPose3D> many_poses;
+  std::vector<bool> many_valid;
+  pose_path.interpolateMany({t0 + mrpt::Clock::duration(15 * dt)}, many_poses, many_valid);
+  EXPECT_TRUE(static_cast<bool>(many_valid.at(0)));
+}
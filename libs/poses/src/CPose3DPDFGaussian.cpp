@@ -292,7 +292,6 @@ void CPose3DPDFGaussian::changeCoordinatesReference(const CPose3D& newReferenceB
   // this = p (+) this
 
   // COV:
-  const CMatrixDouble66 OLD_COV = this->cov;
   CMatrixDouble66 df_dx(UNINITIALIZED_MATRIX), df_du(UNINITIALIZED_MATRIX);
 
   CPose3DPDF::jacobiansPoseComposition(
@@ -301,8 +300,8 @@ void CPose3DPDFGaussian::changeCoordinatesReference(const CPose3D& newReferenceB
       df_dx, df_du);
 
   // this->cov = H1*this->cov*H1' + H2* 0 *H2';
-  const CMatrixDouble66 covNew = mrpt::math::multiply_HCHt(df_du, OLD_COV);
-  cov = covNew;
+  // (multiply_HCHt() returns by value, so no aliasing issue here)
+  cov = mrpt::math::multiply_HCHt(df_du, cov);
 
   // MEAN:
   this->mean.composeFrom(newReferenceBase, this->mean);
@@ -413,7 +412,6 @@ void CPose3DPDFGaussian::inverse(CPose3DPDF& o) const
 void CPose3DPDFGaussian::operator+=(const CPose3D& Ap)
 {
   // COV:
-  const CMatrixDouble66 OLD_COV = this->cov;
   CMatrixDouble66 df_dx(UNINITIALIZED_MATRIX), df_du(UNINITIALIZED_MATRIX);
 
   CPose3DPDF::jacobiansPoseComposition(
@@ -422,7 +420,8 @@ void CPose3DPDFGaussian::operator+=(const CPose3D& Ap)
       df_dx, df_du);
 
   // this->cov = H1*this->cov*H1' + H2*Ap.cov*H2';
-  cov = mrpt::math::multiply_HCHt(df_dx, OLD_COV);
+  // (multiply_HCHt() returns by value, so no aliasing issue here)
+  cov = mrpt::math::multiply_HCHt(df_dx, cov);
   // df_du: Nothing to do, since COV(Ap) = zeros
 
   // MEAN:
@@ -432,7 +431,12 @@ void CPose3DPDFGaussian::operator+=(const CPose3D& Ap)
 /*---------------------------------------------------------------
               +=
  ---------------------------------------------------------------*/
-void CPose3DPDFGaussian::operator+=(const CPose3DPDFGaussian& Ap)
+void CPose3DPDFGaussian::operator+=(const CPose3DPDFGaussian& Ap) { composeFrom(*this, Ap); }
+
+/*---------------------------------------------------------------
+              composeFrom
+ ---------------------------------------------------------------*/
+void CPose3DPDFGaussian::composeFrom(const CPose3DPDFGaussian& x, const CPose3DPDFGaussian& u)
 {
   // Direct equations (for the covariances) in yaw-pitch-roll are too complex.
   //  Make a way around them and consider instead this path:
@@ -450,8 +454,8 @@ void CPose3DPDFGaussian::operator+=(const CPose3DPDFGaussian& Ap)
   //              v
   //            RES(6D)
   //
-  CPose3DQuatPDFGaussian X7(*this);
-  const CPose3DQuatPDFGaussian U7(Ap);
+  CPose3DQuatPDFGaussian X7(x);
+  const CPose3DQuatPDFGaussian U7(u);
 
   X7 += U7;
 
@@ -462,6 +466,14 @@ void CPose3DPDFGaussian::operator+=(const CPose3DPDFGaussian& Ap)
               -=
  ---------------------------------------------------------------*/
 void CPose3DPDFGaussian::operator-=(const CPose3DPDFGaussian& Ap)
+{
+  inverseComposeFrom(*this, Ap);
+}
+
+/*---------------------------------------------------------------
+              inverseComposeFrom
+ ---------------------------------------------------------------*/
+void CPose3DPDFGaussian::inverseComposeFrom(const CPose3DPDFGaussian& x, const CPose3DPDFGaussian& u)
 {
   // Direct equations (for the covariances) in yaw-pitch-roll are too complex.
   //  Make a way around them and consider instead this path:
@@ -479,14 +491,31 @@ void CPose3DPDFGaussian::operator-=(const CPose3DPDFGaussian& Ap)
   //              v
   //            RES(6D)
   //
-  CPose3DQuatPDFGaussian X7(*this);
-  const CPose3DQuatPDFGaussian U7(Ap);
+  CPose3DQuatPDFGaussian X7(x);
+  const CPose3DQuatPDFGaussian U7(u);
 
   X7 -= U7;
 
   this->copyFrom(X7);
 }
 
+/*---------------------------------------------------------------
+              composeChain
+ ---------------------------------------------------------------*/
+CPose3DPDFGaussian CPose3DPDFGaussian::composeChain(
+    const CPose3DPDFGaussian& origin, const std::vector<CPose3DPDFGaussian>& increments)
+{
+  // Accumulate in the 7D quaternion representation for the whole chain:
+  // the repeated operator+= would convert the accumulator 6D->7D and back
+  // once per increment.
+  CPose3DQuatPDFGaussian X7(origin);
+  for (const auto& u : increments) X7 += CPose3DQuatPDFGaussian(u);
+
+  CPose3DPDFGaussian res(UNINITIALIZED_POSE);
+  res.copyFrom(X7);
+  return res;
+}
+
 /*---------------------------------------------------------------
             evaluatePDF
  ---------------------------------------------------------------*/
@@ -450,6 +450,47 @@ TEST_F(Pose3DPDFGaussTests, AllOperators)
       1, 2, 3, 0.0_deg, 0.0_deg, 0.0_deg, 0.1, -8, 45, 10, 0.0_deg, 0.0_deg, 10.0_deg, 0.1);
 }
 
+TEST_F(Pose3DPDFGaussTests, ComposeFromAndChain)
+{
+  const CPose3DPDFGaussian p1 =
+      generateRandomPose3DPDF(1, 2, 3, 20.0_deg, 80.0_deg, 70.0_deg, 0.1);
+  const CPose3DPDFGaussian p2 =
+      generateRandomPose3DPDF(-8, 45, 10, 50.0_deg, -10.0_deg, 30.0_deg, 0.1);
+  const CPose3DPDFGaussian p3 =
+      generateRandomPose3DPDF(4, -2, 1, -30.0_deg, 5.0_deg, -40.0_deg, 0.1);
+
+  // composeFrom() / inverseComposeFrom() must match the classic operators:
+  {
+    CPose3DPDFGaussian ref = p1;
+    ref += p2;
+    CPose3DPDFGaussian q(UNINITIALIZED_POSE);
+    q.composeFrom(p1, p2);
+    EXPECT_NEAR((q.cov - ref.cov).sum_abs(), 0, 1e-10);
+    EXPECT_NEAR(
+        (q.mean.asVectorVal() - ref.mean.asVectorVal()).sum_abs(), 0, 1e-10);
+  }
+  {
+    CPose3DPDFGaussian ref = p1;
+    ref -= p2;
+    CPose3DPDFGaussian q(UNINITIALIZED_POSE);
+    q.inverseComposeFrom(p1, p2);
+    EXPECT_NEAR((q.cov - ref.cov).sum_abs(), 0, 1e-10);
+    EXPECT_NEAR(
+        (q.mean.asVectorVal() - ref.mean.asVectorVal()).sum_abs(), 0, 1e-10);
+  }
+
+  // composeChain() must match repeated operator+=:
+  {
+    CPose3DPDFGaussian ref = p1;
+    ref += p2;
+    ref += p3;
+    const auto q = CPose3DPDFGaussian::composeChain(p1, {p2, p3});
+    EXPECT_NEAR((q.cov - ref.cov).sum_abs(), 0, 1e-8);
+    EXPECT_NEAR(
+        (q.mean.asVectorVal() - ref.mean.asVectorVal()).sum_abs(), 0, 1e-8);
+  }
+}
+
 TEST_F(Pose3DPDFGaussTests, ChangeCoordsRef)
 {
   testChangeCoordsRef(0, 0, 0, 0.0_deg, 0.0_deg, 0.0_deg, 0.1, 0, 0, 0, 0.0_deg, 0.0_deg, 0.0_deg);
@@ -183,6 +183,15 @@ void CPose3DQuat::composePoint(
   gz += m_coords[2];
 }
 
+void CPose3DQuat::composePoints(
+    const std::vector<mrpt::math::TPoint3D>& L, std::vector<mrpt::math::TPoint3D>& G) const
+{
+  if (&G != &L) G = L;
+  m_quat.rotatePoints(G.data(), G.size());
+  const mrpt::math::TPoint3D t(m_coords[0], m_coords[1], m_coords[2]);
+  for (auto& p : G) p += t;
+}
+
 /**  Computes the 3D point G such as \f$ L = G \ominus this \f$.
  * \sa composeFrom
  */
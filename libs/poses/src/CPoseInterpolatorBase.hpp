@@ -36,6 +36,7 @@ template <int DIM>
 void CPoseInterpolatorBase<DIM>::clear()
 {
 	m_path.clear();
+	m_compiled_dirty = true;
 }
 
 template <int DIM>
@@ -43,12 +44,14 @@ void CPoseInterpolatorBase<DIM>::insert(
 	const mrpt::Clock::time_point& t, const cpose_t& p)
 {
 	m_path[t] = p.asTPose();
+	m_compiled_dirty = true;
 }
 template <int DIM>
 void CPoseInterpolatorBase<DIM>::insert(
 	const mrpt::Clock::time_point& t, const pose_t& p)
 {
 	m_path[t] = p;
+	m_compiled_dirty = true;
 }
 
 /*---------------------------------------------------------------
@@ -174,6 +177,122 @@ typename CPoseInterpolatorBase<DIM>::pose_t&
 
 }  // end interpolate
 
+template <int DIM>
+void CPoseInterpolatorBase<DIM>::compileTrajectory() const
+{
+	const size_t n = m_path.size();
+	m_compiled_ts.resize(n);
+	m_compiled_poses.resize(n);
+	size_t i = 0;
+	for (const auto& tp : m_path)
+	{
+		m_compiled_ts[i] = tp.first;
+		m_compiled_poses[i] = tp.second;
+		i++;
+	}
+	m_compiled_dirty = false;
+}
+
+template <int DIM>
+void CPoseInterpolatorBase<DIM>::interpolateMany(
+	const std::vector<mrpt::Clock::time_point>& ts,
+	std::vector<pose_t>& out_interp, std::vector<bool>& out_valid) const
+{
+	if (m_compiled_dirty) compileTrajectory();
+
+	const size_t nQueries = ts.size();
+	out_interp.resize(nQueries);
+	out_valid.resize(nQueries);
+
+	pose_t zero_pose;
+	for (size_t k = 0; k < pose_t::static_size; k++)
+		zero_pose[k] = 0;
+
+	bool interp_method_requires_4pts;
+	switch (m_method)
+	{
+		case imLinear2Neig:
+		case imSplineSlerp:
+		case imLinearSlerp: interp_method_requires_4pts = false; break;
+		default: interp_method_requires_4pts = true; break;
+	};
+
+	const size_t n = m_compiled_ts.size();
+
+	for (size_t q = 0; q < nQueries; q++)
+	{
+		const mrpt::Clock::time_point& t = ts[q];
+		out_interp[q] = zero_pose;
+		out_valid[q] = false;
+		if (!n) continue;
+
+		// lower_bound over the flat timestamp array. Written so the
+		// comparison maps onto a conditional move instead of a
+		// hard-to-predict branch:
+		size_t first = 0;
+		for (size_t len = n; len > 0;)
+		{
+			const size_t half = len >> 1;
+			const bool pred = m_compiled_ts[first + half] < t;
+			first = pred ? first + half + 1 : first;
+			len = pred ? len - half - 1 : half;
+		}
+
+		// Exact match?
+		if (first < n && m_compiled_ts[first] == t)
+		{
+			out_interp[q] = m_compiled_poses[first];
+			out_valid[q] = true;
+			continue;
+		}
+
+		// Are we in the beginning or the end of the path?
+		if (first == n || first == 0) continue;
+
+		// Same 4-point window criteria than interpolate():
+		TTimePosePair p1, p2, p3, p4;
+		p1.second = p2.second = p3.second = p4.second = zero_pose;
+
+		p3 = {m_compiled_ts[first], m_compiled_poses[first]};
+		if (first + 1 < n)
+		{
+			p4 = {m_compiled_ts[first + 1], m_compiled_poses[first + 1]};
+		}
+		else if (interp_method_requires_4pts)
+		{
+			continue;
+		}
+
+		p2 = {m_compiled_ts[first - 1], m_compiled_poses[first - 1]};
+		if (first >= 2)
+		{
+			p1 = {m_compiled_ts[first - 2], m_compiled_poses[first - 2]};
+		}
+		else if (interp_method_requires_4pts)
+		{
+			continue;
+		}
+
+		const mrpt::Clock::duration dt12 = interp_method_requires_4pts
+			? (p2.first - p1.first)
+			: mrpt::Clock::duration(0);
+		const mrpt::Clock::duration dt23 = (p3.first - p2.first);
+		const mrpt::Clock::duration dt34 = interp_method_requires_4pts
+			? (p4.first - p3.first)
+			: mrpt::Clock::duration(0);
+
+		if (maxTimeInterpolation.count() > 0 &&
+			(dt12 > maxTimeInterpolation || dt23 > maxTimeInterpolation ||
+			 dt34 > maxTimeInterpolation))
+		{
+			continue;
+		}
+
+		impl_interpolation(p1, p2, p3, p4, m_method, t, out_interp[q]);
+		out_valid[q] = true;
+	}
+}
+
 template <int DIM>
 bool CPoseInterpolatorBase<DIM>::getPreviousPoseWithMinDistance(
 	const mrpt::Clock::time_point& t, double distance, cpose_t& out_pose)
@@ -491,5 +610,6 @@ void CPoseInterpolatorBase<DIM>::filter(
 		aux[it1->first] = pose_t(auxPose.asTPose());
 	}  // end for it1
 	m_path = aux;
+	m_compiled_dirty = true;
 }
 }  // namespace mrpt::poses
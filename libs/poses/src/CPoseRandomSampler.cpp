@@ -222,6 +222,96 @@ CPose3D& CPoseRandomSampler::drawSample(CPose3D& p) const
   MRPT_END
 }
 
+/*---------------------------------------------------------------
+          drawSamples (batch)
+  ---------------------------------------------------------------*/
+void CPoseRandomSampler::drawSamples(size_t N, std::vector<CPose2D>& outSamples) const
+{
+  MRPT_START
+
+  outSamples.resize(N);
+  if (!N) return;
+
+  if (m_pdf2D && IS_CLASS(*m_pdf2D, CPosePDFGaussian))
+  {
+    // One batch fill of all the normalized variates, then expand each
+    // triplet through the factor cached by setPosePDF() (same expansion
+    // as do_sample_2D):
+    std::vector<double> rnd(3 * N);
+    getRandomGenerator().drawGaussian1DFill(rnd.data(), rnd.size());
+
+    const double* r = rnd.data();
+    for (size_t i = 0; i < N; i++, r += 3)
+    {
+      double v[3] = {0, 0, 0};
+      for (size_t k = 0; k < 3; k++)
+        for (size_t d = 0; d < 3; d++) v[d] += m_fastdraw_gauss_Z3(d, k) * r[k];
+
+      CPose2D& p = outSamples[i];
+      p.x(m_fastdraw_gauss_M_2D.x() + v[0]);
+      p.y(m_fastdraw_gauss_M_2D.y() + v[1]);
+      p.phi(m_fastdraw_gauss_M_2D.phi() + v[2]);
+      p.normalizePhi();
+    }
+  }
+  else if (m_pdf3D && IS_CLASS(*m_pdf3D, CPose3DPDFGaussian))
+  {
+    // Draw in 3D with the fast batch path, then keep (x,y,yaw):
+    std::vector<CPose3D> tmp;
+    drawSamples(N, tmp);
+    for (size_t i = 0; i < N; i++) outSamples[i] = CPose2D(tmp[i]);
+  }
+  else
+  {
+    // Particles, etc.: no cached factor to exploit, draw singly:
+    for (auto& p : outSamples) drawSample(p);
+  }
+
+  MRPT_END
+}
+
+void CPoseRandomSampler::drawSamples(size_t N, std::vector<CPose3D>& outSamples) const
+{
+  MRPT_START
+
+  outSamples.resize(N);
+  if (!N) return;
+
+  if (m_pdf3D && IS_CLASS(*m_pdf3D, CPose3DPDFGaussian))
+  {
+    std::vector<double> rnd(6 * N);
+    getRandomGenerator().drawGaussian1DFill(rnd.data(), rnd.size());
+
+    const double* r = rnd.data();
+    for (size_t i = 0; i < N; i++, r += 6)
+    {
+      double v[6] = {0, 0, 0, 0, 0, 0};
+      for (size_t k = 0; k < 6; k++)
+        for (size_t d = 0; d < 6; d++) v[d] += m_fastdraw_gauss_Z6(d, k) * r[k];
+
+      outSamples[i].setFromValues(
+          m_fastdraw_gauss_M_3D.x() + v[0], m_fastdraw_gauss_M_3D.y() + v[1],
+          m_fastdraw_gauss_M_3D.z() + v[2], m_fastdraw_gauss_M_3D.yaw() + v[3],
+          m_fastdraw_gauss_M_3D.pitch() + v[4], m_fastdraw_gauss_M_3D.roll() + v[5]);
+    }
+  }
+  else if (m_pdf2D && IS_CLASS(*m_pdf2D, CPosePDFGaussian))
+  {
+    // Draw in 2D with the fast batch path, then embed in SE(3):
+    std::vector<CPose2D> tmp;
+    drawSamples(N, tmp);
+    for (size_t i = 0; i < N; i++)
+      outSamples[i].setFromValues(tmp[i].x(), tmp[i].y(), 0, tmp[i].phi(), 0, 0);
+  }
+  else
+  {
+    // Particles, etc.: no cached factor to exploit, draw singly:
+    for (auto& p : outSamples) drawSample(p);
+  }
+
+  MRPT_END
+}
+
 /*---------------------------------------------------------------
           do_sample_2D: Sample from a 2D PDF
   ---------------------------------------------------------------*/
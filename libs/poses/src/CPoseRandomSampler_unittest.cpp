@@ -9,6 +9,89 @@
 
 #include <CTraitsTest.h>
 #include <gtest/gtest.h>
+#include <mrpt/poses/CPose3DPDFGaussian.h>
+#include <mrpt/poses/CPosePDFGaussian.h>
 #include <mrpt/poses/CPoseRandomSampler.h>
+#include <mrpt/random.h>
 
 template class mrpt::CTraitsTest<mrpt::poses::CPoseRandomSampler>;
+
+TEST(CPoseRandomSampler, drawSamplesBatchGaussian2D)
+{
+  using namespace mrpt::poses;
+
+  mrpt::random::getRandomGenerator().randomize(333);
+
+  mrpt::math::CMatrixDouble33 cov2;
+  cov2.setDiagonal(3, 0.04);
+  CPosePDFGaussian pdf(CPose2D(1.0, -2.0, 0.5), cov2);
+
+  CPoseRandomSampler sampler;
+  sampler.setPosePDF(pdf);
+
+  const size_t N = 20000;
+  std::vector<CPose2D> samples;
+  sampler.drawSamples(N, samples);
+  ASSERT_EQ(samples.size(), N);
+
+  double mx = 0, my = 0, mphi = 0;
+  for (const auto& p : samples)
+  {
+    mx += p.x();
+    my += p.y();
+    mphi += p.phi();
+  }
+  mx /= N;
+  my /= N;
+  mphi /= N;
+
+  EXPECT_NEAR(mx, pdf.mean.x(), 0.01);
+  EXPECT_NEAR(my, pdf.mean.y(), 0.01);
+  EXPECT_NEAR(mphi, pdf.mean.phi(), 0.01);
+
+  double vx = 0;
+  for (const auto& p : samples) vx += mrpt::square(p.x() - mx);
+  vx /= N;
+  EXPECT_NEAR(vx, 0.04, 0.005);
+
+  // N=0 must clear the output:
+  sampler.drawSamples(0, samples);
+  EXPECT_TRUE(samples.empty());
+}
+
+TEST(CPoseRandomSampler, drawSamplesBatchGaussian3D)
+{
+  using namespace mrpt::poses;
+
+  mrpt::random::getRandomGenerator().randomize(333);
+
+  mrpt::math::CMatrixDouble66 cov6;
+  cov6.setDiagonal(6, 0.01);
+  CPose3DPDFGaussian pdf(CPose3D(1.0, -2.0, 3.0, 0.4, -0.2, 0.1), cov6);
+
+  CPoseRandomSampler sampler;
+  sampler.setPosePDF(pdf);
+
+  const size_t N = 20000;
+  std::vector<CPose3D> samples;
+  sampler.drawSamples(N, samples);
+  ASSERT_EQ(samples.size(), N);
+
+  double mx = 0, my = 0, mz = 0;
+  for (const auto& p : samples)
+  {
+    mx += p.x();
+    my += p.y();
+    mz += p.z();
+  }
+  EXPECT_NEAR(mx / N, pdf.mean.x(), 0.01);
+  EXPECT_NEAR(my / N, pdf.mean.y(), 0.01);
+  EXPECT_NEAR(mz / N, pdf.mean.z(), 0.01);
+
+  // Cross-dimensional query: 2D samples from the 3D pdf keep (x,y,yaw):
+  std::vector<CPose2D> samples2D;
+  sampler.drawSamples(N, samples2D);
+  double mphi = 0;
+  for (const auto& p : samples2D) mphi += p.phi();
+  EXPECT_NEAR(mphi / N, pdf.mean.yaw(), 0.01);
+}
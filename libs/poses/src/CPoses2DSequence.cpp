@@ -33,6 +33,7 @@ void CPoses2DSequence::serializeFrom(mrpt::serialization::CArchive& in, uint8_t
     {
       poses.resize(in.ReadAs<uint32_t>());
       for (auto& p : poses) in >> p;
+      m_absPoseCache.clear();
     }
     break;
     default:
@@ -59,19 +60,33 @@ void CPoses2DSequence::changePose(unsigned int ind, CPose2D& inPose)
 {
   if (ind >= poses.size()) THROW_EXCEPTION("Index out of range!!");
 
-  *((&(poses[ind])) + ind) = inPose;
+  poses[ind] = inPose;
+
+  // Invalidate only the cached cumulative poses from this index on:
+  if (m_absPoseCache.size() > ind + 1) m_absPoseCache.resize(ind + 1);
 }
 
 /*---------------------------------------------------------------
   Appends a new pose at the end of sequence. Remember that poses are relative,
  incremental to the last one.
  ---------------------------------------------------------------*/
-void CPoses2DSequence::appendPose(CPose2D& newPose) { poses.push_back(newPose); }
+void CPoses2DSequence::appendPose(CPose2D& newPose)
+{
+  poses.push_back(newPose);
+
+  // If the cumulative-pose cache was complete, extend it incrementally:
+  if (m_absPoseCache.size() == poses.size())
+    m_absPoseCache.push_back(m_absPoseCache.back() + newPose);
+}
 
 /*---------------------------------------------------------------
       Clears the sequence.
  ---------------------------------------------------------------*/
-void CPoses2DSequence::clear() { poses.clear(); }
+void CPoses2DSequence::clear()
+{
+  poses.clear();
+  m_absPoseCache.clear();
+}
 /*---------------------------------------------------------------
  ---------------------------------------------------------------*/
 /** Returns the absolute pose of a robot after moving "n" poses, so for "n=0"
@@ -82,14 +97,33 @@ void CPoses2DSequence::clear() { poses.clear(); }
  */
 CPose2D CPoses2DSequence::absolutePoseOf(unsigned int n)
 {
-  CPose2D ret(0, 0, 0);
-  unsigned int i;
-
   if (n > poses.size()) THROW_EXCEPTION("Index out of range!!");
 
-  for (i = 0; i < n; i++) ret = ret + poses[i];
+  updateAbsPoseCache(n);
+  return m_absPoseCache[n];
+}
 
-  return ret;
+void CPoses2DSequence::absolutePosesOfRange(
+    unsigned int first, unsigned int last, std::vector<CPose2D>& outPoses)
+{
+  if (first > last || last > poses.size()) THROW_EXCEPTION("Index out of range!!");
+
+  updateAbsPoseCache(last);
+  outPoses.assign(m_absPoseCache.begin() + first, m_absPoseCache.begin() + last + 1);
+}
+
+void CPoses2DSequence::updateAbsPoseCache(size_t n)
+{
+  if (m_absPoseCache.empty())
+  {
+    m_absPoseCache.reserve(poses.size() + 1);
+    m_absPoseCache.emplace_back(0, 0, 0);
+  }
+  while (m_absPoseCache.size() <= n)
+  {
+    const size_t i = m_absPoseCache.size() - 1;
+    m_absPoseCache.push_back(m_absPoseCache.back() + poses[i]);
+  }
 }
 
 CPose2D CPoses2DSequence::absolutePoseAfterAll() { return absolutePoseOf(posesCount()); }
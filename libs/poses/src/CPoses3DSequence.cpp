@@ -34,6 +34,7 @@ void CPoses3DSequence::serializeFrom(mrpt::serialization::CArchive& in, uint8_t
     {
       m_poses.resize(in.ReadAs<uint32_t>());
       for (auto& p : m_poses) in >> p;
+      m_absPoseCache.clear();
     }
     break;
     default:
@@ -60,18 +61,32 @@ void CPoses3DSequence::changePose(unsigned int ind, CPose3D& inPose)
 {
   if (ind >= m_poses.size()) THROW_EXCEPTION("getPose: Index out of range!!");
   m_poses[ind] = inPose.asTPose();
+
+  // Invalidate only the cached cumulative poses from this index on:
+  if (m_absPoseCache.size() > ind + 1) m_absPoseCache.resize(ind + 1);
 }
 
 /*---------------------------------------------------------------
   Appends a new pose at the end of sequence. Remember that poses are relative,
  incremental to the last one.
  ---------------------------------------------------------------*/
-void CPoses3DSequence::appendPose(CPose3D& newPose) { m_poses.push_back(newPose.asTPose()); }
+void CPoses3DSequence::appendPose(CPose3D& newPose)
+{
+  m_poses.push_back(newPose.asTPose());
+
+  // If the cumulative-pose cache was complete, extend it incrementally:
+  if (m_absPoseCache.size() == m_poses.size())
+    m_absPoseCache.push_back(m_absPoseCache.back() + newPose);
+}
 
 /*---------------------------------------------------------------
       Clears the sequence.
  ---------------------------------------------------------------*/
-void CPoses3DSequence::clear() { m_poses.clear(); }
+void CPoses3DSequence::clear()
+{
+  m_poses.clear();
+  m_absPoseCache.clear();
+}
 /*---------------------------------------------------------------
  ---------------------------------------------------------------*/
 /** Returns the absolute pose of a robot after moving "n" poses, so for "n=0"
@@ -82,14 +97,34 @@ void CPoses3DSequence::clear() { m_poses.clear(); }
  */
 CPose3D CPoses3DSequence::absolutePoseOf(unsigned int n)
 {
-  CPose3D ret(0, 0, 0);
-  unsigned int i;
-
   if (n > m_poses.size()) THROW_EXCEPTION("absolutePoseOf: Index out of range!!");
 
-  for (i = 0; i < n; i++) ret = ret + CPose3D(m_poses[i]);
+  updateAbsPoseCache(n);
+  return m_absPoseCache[n];
+}
 
-  return ret;
+void CPoses3DSequence::absolutePosesOfRange(
+    unsigned int first, unsigned int last, std::vector<CPose3D>& outPoses)
+{
+  if (first > last || last > m_poses.size())
+    THROW_EXCEPTION("absolutePosesOfRange: Index out of range!!");
+
+  updateAbsPoseCache(last);
+  outPoses.assign(m_absPoseCache.begin() + first, m_absPoseCache.begin() + last + 1);
+}
+
+void CPoses3DSequence::updateAbsPoseCache(size_t n)
+{
+  if (m_absPoseCache.empty())
+  {
+    m_absPoseCache.reserve(m_poses.size() + 1);
+    m_absPoseCache.emplace_back(0, 0, 0);
+  }
+  while (m_absPoseCache.size() <= n)
+  {
+    const size_t i = m_absPoseCache.size() - 1;
+    m_absPoseCache.push_back(m_absPoseCache.back() + CPose3D(m_poses[i]));
+  }
 }
 
 /*---------------------------------------------------------------
@@ -0,0 +1,118 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/math/TPose3D.h>
+#include <mrpt/poses/CPoses3DSequence.h>
+#include <mrpt/random.h>
+
+using namespace mrpt;
+using namespace mrpt::poses;
+
+static CPose3D randomIncrement()
+{
+  auto& rn = mrpt::random::getRandomGenerator();
+  return {
+      rn.drawUniform(-1.0, 1.0), rn.drawUniform(-1.0, 1.0), rn.drawUniform(-0.1, 0.1),
+      rn.drawUniform(-0.5, 0.5), rn.drawUniform(-0.2, 0.2), rn.drawUniform(-0.2, 0.2)};
+}
+
+// Reference implementation: recompose the whole chain:
+static CPose3D naiveAbsolutePoseOf(CPoses3DSequence& seq, unsigned int n)
+{
+  CPose3D ret(0, 0, 0);
+  for (unsigned int i = 0; i < n; i++)
+  {
+    CPose3D p;
+    seq.getPose(i, p);
+    ret = ret + p;
+  }
+  return ret;
+}
+
+TEST(CPoses3DSequence, absolutePoseOfMatchesNaive)
+{
+  mrpt::random::getRandomGenerator().randomize(333);
+
+  CPoses3DSequence seq;
+  const unsigned int N = 50;
+  for (unsigned int i = 0; i < N; i++)
+  {
+    CPose3D p = randomIncrement();
+    seq.appendPose(p);
+  }
+
+  // Random-order queries, hitting the cached path repeatedly:
+  for (unsigned int n : {N, 0u, 13u, 49u, 13u, 1u, N})
+  {
+    const CPose3D expected = naiveAbsolutePoseOf(seq, n);
+    const CPose3D got = seq.absolutePoseOf(n);
+    EXPECT_NEAR(
+        (expected.asVectorVal() - got.asVectorVal()).sum_abs(), 0, 1e-10)
+        << "n=" << n;
+  }
+}
+
+TEST(CPoses3DSequence, changePoseInvalidatesSuffix)
+{
+  mrpt::random::getRandomGenerator().randomize(333);
+
+  CPoses3DSequence seq;
+  const unsigned int N = 30;
+  for (unsigned int i = 0; i < N; i++)
+  {
+    CPose3D p = randomIncrement();
+    seq.appendPose(p);
+  }
+
+  // Populate the cache:
+  (void)seq.absolutePoseAfterAll();
+
+  // Edit a mid-sequence pose and check that queries before & after the edit
+  // point are still correct:
+  CPose3D newPose = randomIncrement();
+  seq.changePose(10, newPose);
+
+  for (unsigned int n : {5u, 10u, 11u, N})
+  {
+    const CPose3D expected = naiveAbsolutePoseOf(seq, n);
+    const CPose3D got = seq.absolutePoseOf(n);
+    EXPECT_NEAR(
+        (expected.asVectorVal() - got.asVectorVal()).sum_abs(), 0, 1e-10)
+        << "n=" << n;
+  }
+}
+
+TEST(CPoses3DSequence, absolutePosesOfRange)
+{
+  mrpt::random::getRandomGenerator().randomize(333);
+
+  CPoses3DSequence seq;
+  const unsigned int N = 20;
+  for (unsigned int i = 0; i < N; i++)
+  {
+    CPose3D p = randomIncrement();
+    seq.appendPose(p);
+  }
+
+  std::vector<CPose3D> absPoses;
+  seq.absolutePosesOfRange(5, 15, absPoses);
+  ASSERT_EQ(absPoses.size(), 11U);
+
+  for (unsigned int n = 5; n <= 15; n++)
+  {
+    const CPose3D expected = naiveAbsolutePoseOf(seq, n);
+    EXPECT_NEAR(
+        (expected.asVectorVal() - absPoses[n - 5].asVectorVal()).sum_abs(), 0, 1e-10)
+        << "n=" << n;
+  }
+
+  EXPECT_ANY_THROW(seq.absolutePosesOfRange(10, 5, absPoses));
+  EXPECT_ANY_THROW(seq.absolutePosesOfRange(0, N + 1, absPoses));
+}
@@ -13,6 +13,7 @@
 #include <mrpt/math/CVectorDynamic.h>
 #include <mrpt/poses/CPose3D.h>
 #include <mrpt/poses/CPose3DQuat.h>
+#include <mrpt/random.h>
 
 #include <Eigen/Dense>
 
@@ -219,3 +220,68 @@ TEST_F(QuaternionTests, ensurePositiveRealPart)
     EXPECT_GE(q.r(), 0.0);
   }
 }
+
+TEST_F(QuaternionTests, batchRotatePointsAndComposeMany)
+{
+  mrpt::random::getRandomGenerator().randomize(333);
+
+  CQuaternionDouble q;
+  CPose3D(0, 0, 0, 10.0_deg, 30.0_deg, -20.0_deg).getAsQuaternion(q);
+
+  // rotatePoints() must match per-point rotatePoint():
+  std::vector<mrpt::math::TPoint3D> pts(37);
+  for (auto& p : pts)
+  {
+    p.x = mrpt::random::getRandomGenerator().drawUniform(-10.0, 10.0);
+    p.y = mrpt::random::getRandomGenerator().drawUniform(-10.0, 10.0);
+    p.z = mrpt::random::getRandomGenerator().drawUniform(-10.0, 10.0);
+  }
+  const auto ptsOrg = pts;
+  q.rotatePoints(pts);
+
+  for (size_t i = 0; i < pts.size(); i++)
+  {
+    mrpt::math::TPoint3D g;
+    q.rotatePoint(ptsOrg[i].x, ptsOrg[i].y, ptsOrg[i].z, g.x, g.y, g.z);
+    EXPECT_NEAR(pts[i].distanceTo(g), 0, 1e-10) << "i=" << i;
+  }
+
+  // composeMany() must match per-element crossProduct():
+  std::vector<CQuaternionDouble> q1s, q2s, q3s;
+  for (int i = 0; i < 9; i++)
+  {
+    CQuaternionDouble qa, qb;
+    CPose3D(
+        0, 0, 0, mrpt::random::getRandomGenerator().drawUniform(-1.0, 1.0),
+        mrpt::random::getRandomGenerator().drawUniform(-1.0, 1.0),
+        mrpt::random::getRandomGenerator().drawUniform(-1.0, 1.0))
+        .getAsQuaternion(qa);
+    CPose3D(
+        0, 0, 0, mrpt::random::getRandomGenerator().drawUniform(-1.0, 1.0),
+        mrpt::random::getRandomGenerator().drawUniform(-1.0, 1.0),
+        mrpt::random::getRandomGenerator().drawUniform(-1.0, 1.0))
+        .getAsQuaternion(qb);
+    q1s.push_back(qa);
+    q2s.push_back(qb);
+  }
+  CQuaternionDouble::composeMany(q1s, q2s, q3s);
+  ASSERT_EQ(q3s.size(), q1s.size());
+  for (size_t i = 0; i < q1s.size(); i++)
+  {
+    CQuaternionDouble expected;
+    expected.crossProduct(q1s[i], q2s[i]);
+    EXPECT_NEAR(std::abs((expected - q3s[i]).sum()), 0, 1e-10) << "i=" << i;
+  }
+
+  // CPose3DQuat::composePoints() must match per-point composePoint(),
+  // including in-place operation:
+  const CPose3DQuat pq(CPose3D(1.0, -2.0, 3.0, 10.0_deg, 30.0_deg, -20.0_deg));
+  auto ptsG = ptsOrg;
+  pq.composePoints(ptsG, ptsG);
+  for (size_t i = 0; i < ptsOrg.size(); i++)
+  {
+    mrpt::math::TPoint3D g;
+    pq.composePoint(ptsOrg[i], g);
+    EXPECT_NEAR(ptsG[i].distanceTo(g), 0, 1e-10) << "i=" << i;
+  }
+}
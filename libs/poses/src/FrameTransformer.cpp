@@ -13,9 +13,13 @@
 #include <mrpt/poses/CPose2D.h>
 #include <mrpt/poses/CPose3D.h>
 #include <mrpt/poses/FrameTransformer.h>  // for FrameTransformer, FrameTran...
+#include <mrpt/poses/Lie/SE.h>            // for geodesic interpolation
 #include <mrpt/system/datetime.h>         // for TTimeStamp, INVALID_TIMESTAMP
 
-#include <string>  // for string
+#include <algorithm>  // for upper_bound
+#include <memory>     // for atomic_load/atomic_store
+#include <mutex>      // for lock_guard
+#include <string>     // for string
 
 using namespace mrpt::poses;
 
@@ -48,7 +52,27 @@ void FrameTransformer<DIM>::sendTransform(
     const typename base_t::pose_t& child_wrt_parent,
     const mrpt::system::TTimeStamp& timestamp)
 {
-  m_pose_edges_buffer[parent_frame][child_frame] = TF_TreeEdge(child_wrt_parent, timestamp);
+  // RCU-style update: clone the current snapshot, modify the copy, then
+  // publish it with an atomic pointer swap. Readers holding the old
+  // snapshot keep it alive via its shared_ptr until they are done.
+  std::lock_guard<std::mutex> lck(m_write_mtx);
+
+  auto newTree = std::make_shared<pose_tree_t>(*std::atomic_load(&m_tree));
+
+  TF_TreeEdge& te = (*newTree)[parent_frame][child_frame];
+  te.pose = child_wrt_parent;
+  te.timestamp = timestamp;
+
+  // Keep the per-pair history sorted by time (stamps may arrive
+  // out-of-order), bounded to the most recent MAX_EDGE_HISTORY samples:
+  auto& h = te.history;
+  const auto it = std::upper_bound(
+      h.begin(), h.end(), timestamp,
+      [](const mrpt::system::TTimeStamp& t, const auto& e) { return t < e.first; });
+  h.insert(it, {timestamp, child_wrt_parent});
+  if (h.size() > MAX_EDGE_HISTORY) h.erase(h.begin());
+
+  std::atomic_store(&m_tree, std::shared_ptr<const pose_tree_t>(std::move(newTree)));
 }
 
 // future work: allow graph traversal and do pose chain composition?
@@ -64,11 +88,13 @@ FrameLookUpStatus FrameTransformer<DIM>::lookupTransform(
     const double timeout_secs)
 {
   ASSERTMSG_(timeout_secs == .0, "timeout_secs!=0: Blocking calls not supported yet!");
-  ASSERTMSG_(
-      query_time == INVALID_TIMESTAMP, "`query_time` different than 'latest' not supported yet!");
 
-  const auto& it_src = m_pose_edges_buffer.find(source_frame);
-  if (it_src == m_pose_edges_buffer.end())
+  // Wait-free read: grab the current immutable snapshot; publishers swap in
+  // entire new trees, so this one stays consistent for as long as we hold it.
+  const std::shared_ptr<const pose_tree_t> tree = std::atomic_load(&m_tree);
+
+  const auto& it_src = tree->find(source_frame);
+  if (it_src == tree->end())
   {
     return LKUP_UNKNOWN_FRAME;
   }
@@ -80,8 +106,40 @@ FrameLookUpStatus FrameTransformer<DIM>::lookupTransform(
   }
 
   const TF_TreeEdge& te = it_dst->second;
-  child_wrt_parent = te.pose.asTPose();
 
+  if (query_time == INVALID_TIMESTAMP)
+  {
+    // "latest":
+    child_wrt_parent = te.pose.asTPose();
+    return LKUP_GOOD;
+  }
+
+  // Time-interpolated query against the per-pair history cache:
+  const auto& h = te.history;
+  if (h.empty() || query_time < h.front().first || query_time > h.back().first)
+  {
+    return LKUP_EXTRAPOLATION_ERROR;
+  }
+
+  const auto it1 = std::lower_bound(
+      h.begin(), h.end(), query_time,
+      [](const auto& e, const mrpt::system::TTimeStamp& t) { return e.first < t; });
+  if (it1->first == query_time)
+  {
+    // Exact hit:
+    child_wrt_parent = it1->second.asTPose();
+    return LKUP_GOOD;
+  }
+
+  // Geodesic SE(n) interpolation between the two bracketing samples:
+  const auto it0 = std::prev(it1);
+  const double f = mrpt::system::timeDifference(it0->first, query_time) /
+      mrpt::system::timeDifference(it0->first, it1->first);
+
+  auto incr = Lie::SE<DIM>::log(typename base_t::pose_t(it1->second - it0->second));
+  for (size_t k = 0; k < Lie::SE<DIM>::DOFs; k++) incr[k] *= f;
+
+  child_wrt_parent = (it0->second + Lie::SE<DIM>::exp(incr)).asTPose();
   return LKUP_GOOD;
 }
 
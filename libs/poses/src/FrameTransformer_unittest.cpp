@@ -14,6 +14,10 @@
 
 #include <Eigen/Dense>
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 template <int DIM>
 void run_tf_test1(const mrpt::poses::CPose2D& A2B_)
 {
@@ -42,3 +46,82 @@ TEST(FrameTransformer, SimplePublishAndLookup)
   run_tf_test1<2>(test_A2B);
   run_tf_test1<3>(test_A2B);
 }
+
+template <int DIM>
+void run_tf_interpolation_test()
+{
+  using namespace mrpt::poses;
+  using namespace std::chrono_literals;
+
+  FrameTransformer<DIM> tf;
+
+  const auto t0 = mrpt::Clock::now();
+  const auto t1 = t0 + 1s;
+
+  const auto p0 = (typename FrameTransformer<DIM>::pose_t)(mrpt::poses::CPose2D(1.0, 0.0, 0.0));
+  const auto p1 = (typename FrameTransformer<DIM>::pose_t)(mrpt::poses::CPose2D(3.0, 2.0, 0.4));
+
+  tf.sendTransform("A", "B", p0, t0);
+  tf.sendTransform("A", "B", p1, t1);
+
+  // Midpoint query -> geodesic interpolation:
+  {
+    typename FrameTransformer<DIM>::pose_t p;
+    const auto ret = tf.lookupTransform("B", "A", p, t0 + 500ms);
+    EXPECT_EQ(ret, mrpt::poses::LKUP_GOOD);
+    EXPECT_NEAR(p.asVectorVal()[0], 2.0, 0.05);
+    EXPECT_NEAR(p.asVectorVal()[1], 1.0, 0.05);
+  }
+  // Exact stamps:
+  {
+    typename FrameTransformer<DIM>::pose_t p;
+    EXPECT_EQ(tf.lookupTransform("B", "A", p, t0), mrpt::poses::LKUP_GOOD);
+    EXPECT_NEAR(.0, (p.asVectorVal() - p0.asVectorVal()).array().abs().sum(), 1e-6);
+  }
+  // Out of the cached time range:
+  {
+    typename FrameTransformer<DIM>::pose_t p;
+    EXPECT_EQ(tf.lookupTransform("B", "A", p, t1 + 1s), mrpt::poses::LKUP_EXTRAPOLATION_ERROR);
+    EXPECT_EQ(tf.lookupTransform("B", "A", p, t0 - 1s), mrpt::poses::LKUP_EXTRAPOLATION_ERROR);
+  }
+  // "latest" must keep working:
+  {
+    typename FrameTransformer<DIM>::pose_t p;
+    EXPECT_EQ(tf.lookupTransform("B", "A", p), mrpt::poses::LKUP_GOOD);
+    EXPECT_NEAR(.0, (p.asVectorVal() - p1.asVectorVal()).array().abs().sum(), 1e-6);
+  }
+}
+
+TEST(FrameTransformer, InterpolatedLookup)
+{
+  run_tf_interpolation_test<2>();
+  run_tf_interpolation_test<3>();
+}
+
+TEST(FrameTransformer, ConcurrentPublishAndLookup)
+{
+  using namespace mrpt::poses;
+
+  FrameTransformer<3> tf;
+  tf.sendTransform("A", "B", CPose3D(0, 0, 0, 0, 0, 0));
+
+  std::atomic_bool done{false};
+  std::atomic<size_t> nBad{0};
+
+  // Readers hammer lookupTransform() while a writer keeps publishing:
+  std::vector<std::thread> readers;
+  for (int r = 0; r < 4; r++)
+    readers.emplace_back(
+        [&]()
+        {
+          CPose3D p;
+          while (!done)
+            if (tf.lookupTransform("B", "A", p) != mrpt::poses::LKUP_GOOD) nBad++;
+        });
+
+  for (int i = 0; i < 2000; i++) tf.sendTransform("A", "B", CPose3D(i * 0.001, 0, 0, 0, 0, 0));
+  done = true;
+  for (auto& th : readers) th.join();
+
+  EXPECT_EQ(nBad, 0U);
+}
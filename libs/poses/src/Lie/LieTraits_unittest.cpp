@@ -275,3 +275,114 @@ TEST_F(SE3_traits_tests, SE3_jacobs_dAB_dAB) { tests_jacobs_dAB_dAB(); }
 
 TEST_F(SE2_traits_tests, SE2_jacobs_DinvP1InvP2) { tests_jacobs_DinvP1InvP2(); }
 TEST_F(SE2_traits_tests, SE2_jacobs_dAB_dAB) { tests_jacobs_dAB_dAB(); }
+
+TEST(SE3, composePointsBatch)
+{
+  // Sizes chosen to exercise the 8-wide / 4-wide SIMD loops and their
+  // scalar tails:
+  for (size_t N : {size_t(0), size_t(1), size_t(7), size_t(8), size_t(259)})
+  {
+    for (const auto& p : ptc)
+    {
+      std::vector<float> xs(N), ys(N), zs(N);
+      for (size_t i = 0; i < N; i++)
+      {
+        xs[i] = 0.1f * i - 3.0f;
+        ys[i] = -0.2f * i + 1.0f;
+        zs[i] = 0.05f * i;
+      }
+      const auto xs0 = xs, ys0 = ys, zs0 = zs;
+
+      Lie::SE<3>::composePoints(p, xs.data(), ys.data(), zs.data(), N);
+
+      for (size_t i = 0; i < N; i++)
+      {
+        mrpt::math::TPoint3D g;
+        p.composePoint({xs0[i], ys0[i], zs0[i]}, g);
+        EXPECT_NEAR(xs[i], g.x, 1e-4) << "N=" << N << " i=" << i << " p=" << p << "\n";
+        EXPECT_NEAR(ys[i], g.y, 1e-4);
+        EXPECT_NEAR(zs[i], g.z, 1e-4);
+      }
+
+      // And back (round-trip through the inverse batch op):
+      Lie::SE<3>::inverseComposePoints(p, xs.data(), ys.data(), zs.data(), N);
+      for (size_t i = 0; i < N; i++)
+      {
+        EXPECT_NEAR(xs[i], xs0[i], 1e-3) << "N=" << N << " i=" << i << " p=" << p << "\n";
+        EXPECT_NEAR(ys[i], ys0[i], 1e-3);
+        EXPECT_NEAR(zs[i], zs0[i], 1e-3);
+      }
+    }
+  }
+}
+
+TEST(SE3, batchJacobiansMatchPerEdge)
+{
+  // Build a set of (Dinv, P1, P2) edges from the test pose combinations:
+  std::vector<CPose3D> Dinvs, P1s, P2s;
+  for (const auto& p1 : ptc)
+    for (const auto& p2 : ptc)
+      for (const auto& pd : ptc)
+      {
+        Dinvs.push_back(-pd);
+        P1s.push_back(p1);
+        P2s.push_back(p2);
+      }
+  const size_t N = Dinvs.size();
+
+  std::vector<Lie::SE<3>::matrix_TxT> J1s(N), J2s(N);
+  Lie::SE<3>::jacob_dDinvP1invP2_de1e2_many(
+      Dinvs.data(), P1s.data(), P2s.data(), J1s.data(), J2s.data(), N);
+
+  for (size_t i = 0; i < N; i++)
+  {
+    Lie::SE<3>::matrix_TxT J1, J2;
+    Lie::SE<3>::jacob_dDinvP1invP2_de1e2(Dinvs[i], P1s[i], P2s[i], J1, J2);
+    EXPECT_NEAR((J1 - J1s[i]).sum_abs(), 0, 1e-12) << "i=" << i;
+    EXPECT_NEAR((J2 - J2s[i]).sum_abs(), 0, 1e-12) << "i=" << i;
+  }
+}
+
+TEST(SE3, batchJacobDexpeDe)
+{
+  std::vector<Lie::SE<3>::tangent_vector> xs;
+  for (const auto& p : ptc) xs.push_back(Lie::SE<3>::log(p));
+
+  std::vector<Lie::SE<3>::tang2mat_jacob> Js(xs.size());
+  Lie::SE<3>::jacob_dexpe_de_many(xs.data(), Js.data(), xs.size());
+
+  for (size_t i = 0; i < xs.size(); i++)
+  {
+    const auto J = Lie::SE<3>::jacob_dexpe_de(xs[i]);
+    EXPECT_NEAR((J - Js[i]).sum_abs(), 0, 1e-12) << "i=" << i;
+  }
+}
+
+TEST(SE2, batchJacobiansMatchPerEdge)
+{
+  const std::vector<CPose2D> pt2 = {
+      {0, 0, 0.0_deg}, {1, -2, 40.0_deg}, {-3, 0.5, -179.0_deg}, {0.1, 0.2, 90.0_deg}};
+
+  std::vector<CPose2D> Dinvs, P1s, P2s;
+  for (const auto& p1 : pt2)
+    for (const auto& p2 : pt2)
+      for (const auto& pd : pt2)
+      {
+        Dinvs.push_back(-pd);
+        P1s.push_back(p1);
+        P2s.push_back(p2);
+      }
+  const size_t N = Dinvs.size();
+
+  std::vector<Lie::SE<2>::matrix_TxT> J1s(N), J2s(N);
+  Lie::SE<2>::jacob_dDinvP1invP2_de1e2_many(
+      Dinvs.data(), P1s.data(), P2s.data(), J1s.data(), J2s.data(), N);
+
+  for (size_t i = 0; i < N; i++)
+  {
+    Lie::SE<2>::matrix_TxT J1, J2;
+    Lie::SE<2>::jacob_dDinvP1invP2_de1e2(Dinvs[i], P1s[i], P2s[i], J1, J2);
+    EXPECT_NEAR((J1 - J1s[i]).sum_abs(), 0, 1e-12) << "i=" << i;
+    EXPECT_NEAR((J2 - J2s[i]).sum_abs(), 0, 1e-12) << "i=" << i;
+  }
+}
@@ -169,6 +169,50 @@ void SE<3>::jacob_dDinvP1invP2_de1e2(
   }
 }
 
+void SE<3>::jacob_dexpe_de_many(const tangent_vector* x, tang2mat_jacob* out, size_t num)
+{
+  // The zero pattern and the identity block of the translational part are
+  // identical for all the outputs; build the template only once:
+  tang2mat_jacob J0 = tang2mat_jacob::Zero();
+  J0.block<3, 3>(9, 0) = Eigen::Matrix3d::Identity();
+
+  for (size_t i = 0; i < num; i++)
+  {
+    out[i] = J0;
+    const auto w = SO<3>::tangent_vector(x[i].tail<3>());
+    out[i].block<9, 3>(0, 3) = SO<3>::jacob_dexpe_de(w).asEigen();
+  }
+}
+
+void SE<3>::jacob_dDinvP1invP2_de1e2_many(
+    const type* Dinv, const type* P1, const type* P2, matrix_TxT* df_de1, matrix_TxT* df_de2,
+    size_t num)
+{
+  using namespace mrpt::math;
+
+  for (size_t i = 0; i < num; i++)
+  {
+    // Intermediate terms shared between both Jacobians of this edge:
+    const CPose3D P1inv = -P1[i];
+    const CPose3D P1invP2 = P1inv + P2[i];
+    const CPose3D DinvP1invP2 = Dinv[i] + P1invP2;
+
+    const auto dLnT_dT = SE<3>::jacob_dlogv_dv(DinvP1invP2);
+
+    if (df_de1)
+    {
+      const CMatrixFixed<double, 12, 12> J1a = SE<3>::jacob_dAB_dA(Dinv[i], P1invP2);
+      const auto J1b = CMatrixDouble12_6(-SE<3>::jacob_dDexpe_de(Dinv[i]));
+      df_de1[i] = dLnT_dT.asEigen() * J1a.asEigen() * J1b.asEigen();
+    }
+    if (df_de2)
+    {
+      const auto dAe_de = SE<3>::jacob_dDexpe_de(DinvP1invP2);
+      df_de2[i] = dLnT_dT * dAe_de;
+    }
+  }
+}
+
 SE<3>::matrix_MxM SE<3>::jacob_dAB_dA(const SE<3>::type& A, const SE<3>::type& B)
 {
   using namespace mrpt::math;
@@ -284,3 +328,18 @@ void SE<2>::jacob_dDinvP1invP2_de1e2(
     J2 = SE<2>::jacob_dDexpe_de(DinvP1invP2);
   }
 }
+
+void SE<2>::jacob_dDinvP1invP2_de1e2_many(
+    const type* Dinv, const type* P1, const type* P2, matrix_TxT* df_de1, matrix_TxT* df_de2,
+    size_t num)
+{
+  for (size_t i = 0; i < num; i++)
+  {
+    const CPose2D P1inv = -P1[i];
+    const CPose2D P1invP2 = P1inv + P2[i];
+    const CPose2D DinvP1invP2 = Dinv[i] + P1invP2;
+
+    if (df_de1) df_de1[i] = jacob_dAB_dA(Dinv[i], P1invP2).asEigen() * (-jacob_dDexpe_de(Dinv[i]));
+    if (df_de2) df_de2[i] = SE<2>::jacob_dDexpe_de(DinvP1invP2);
+  }
+}
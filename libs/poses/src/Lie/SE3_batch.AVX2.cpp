@@ -0,0 +1,56 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include "poses-precomp.h"  // Precompiled headers
+//
+#include <mrpt/config.h>
+
+#include "SE3_batch_internal.h"
+
+#if MRPT_ARCH_INTEL_COMPATIBLE
+
+#include <immintrin.h>
+
+using namespace mrpt::poses::Lie;
+
+void internal::composePoints3x4_AVX2(
+    float* x, float* y, float* z, size_t num_points, const float m[12])
+{
+  const __m256 r00 = _mm256_set1_ps(m[0]), r01 = _mm256_set1_ps(m[1]), r02 = _mm256_set1_ps(m[2]);
+  const __m256 r10 = _mm256_set1_ps(m[4]), r11 = _mm256_set1_ps(m[5]), r12 = _mm256_set1_ps(m[6]);
+  const __m256 r20 = _mm256_set1_ps(m[8]), r21 = _mm256_set1_ps(m[9]), r22 = _mm256_set1_ps(m[10]);
+  const __m256 tx = _mm256_set1_ps(m[3]), ty = _mm256_set1_ps(m[7]), tz = _mm256_set1_ps(m[11]);
+
+  size_t i = 0;
+  for (; i + 8 <= num_points; i += 8)
+  {
+    const __m256 lx = _mm256_loadu_ps(&x[i]);
+    const __m256 ly = _mm256_loadu_ps(&y[i]);
+    const __m256 lz = _mm256_loadu_ps(&z[i]);
+
+    const __m256 gx = _mm256_add_ps(
+        _mm256_add_ps(_mm256_mul_ps(r00, lx), _mm256_mul_ps(r01, ly)),
+        _mm256_add_ps(_mm256_mul_ps(r02, lz), tx));
+    const __m256 gy = _mm256_add_ps(
+        _mm256_add_ps(_mm256_mul_ps(r10, lx), _mm256_mul_ps(r11, ly)),
+        _mm256_add_ps(_mm256_mul_ps(r12, lz), ty));
+    const __m256 gz = _mm256_add_ps(
+        _mm256_add_ps(_mm256_mul_ps(r20, lx), _mm256_mul_ps(r21, ly)),
+        _mm256_add_ps(_mm256_mul_ps(r22, lz), tz));
+
+    _mm256_storeu_ps(&x[i], gx);
+    _mm256_storeu_ps(&y[i], gy);
+    _mm256_storeu_ps(&z[i], gz);
+  }
+
+  // Tail:
+  internal::composePoints3x4_generic(x + i, y + i, z + i, num_points - i, m);
+}
+
+#endif  // MRPT_ARCH_INTEL_COMPATIBLE
@@ -0,0 +1,53 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include "poses-precomp.h"  // Precompiled headers
+//
+#include <mrpt/config.h>
+
+#include "SE3_batch_internal.h"
+
+#if MRPT_ARCH_INTEL_COMPATIBLE
+
+#include <mrpt/core/SSE_types.h>
+
+using namespace mrpt::poses::Lie;
+
+void internal::composePoints3x4_SSE2(
+    float* x, float* y, float* z, size_t num_points, const float m[12])
+{
+  const __m128 r00 = _mm_set1_ps(m[0]), r01 = _mm_set1_ps(m[1]), r02 = _mm_set1_ps(m[2]);
+  const __m128 r10 = _mm_set1_ps(m[4]), r11 = _mm_set1_ps(m[5]), r12 = _mm_set1_ps(m[6]);
+  const __m128 r20 = _mm_set1_ps(m[8]), r21 = _mm_set1_ps(m[9]), r22 = _mm_set1_ps(m[10]);
+  const __m128 tx = _mm_set1_ps(m[3]), ty = _mm_set1_ps(m[7]), tz = _mm_set1_ps(m[11]);
+
+  size_t i = 0;
+  for (; i + 4 <= num_points; i += 4)
+  {
+    const __m128 lx = _mm_loadu_ps(&x[i]);
+    const __m128 ly = _mm_loadu_ps(&y[i]);
+    const __m128 lz = _mm_loadu_ps(&z[i]);
+
+    const __m128 gx = _mm_add_ps(
+        _mm_add_ps(_mm_mul_ps(r00, lx), _mm_mul_ps(r01, ly)), _mm_add_ps(_mm_mul_ps(r02, lz), tx));
+    const __m128 gy = _mm_add_ps(
+        _mm_add_ps(_mm_mul_ps(r10, lx), _mm_mul_ps(r11, ly)), _mm_add_ps(_mm_mul_ps(r12, lz), ty));
+    const __m128 gz = _mm_add_ps(
+        _mm_add_ps(_mm_mul_ps(r20, lx), _mm_mul_ps(r21, ly)), _mm_add_ps(_mm_mul_ps(r22, lz), tz));
+
+    _mm_storeu_ps(&x[i], gx);
+    _mm_storeu_ps(&y[i], gy);
+    _mm_storeu_ps(&z[i], gz);
+  }
+
+  // Tail:
+  internal::composePoints3x4_generic(x + i, y + i, z + i, num_points - i, m);
+}
+
+#endif  // MRPT_ARCH_INTEL_COMPATIBLE
@@ -0,0 +1,85 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include "poses-precomp.h"  // Precompiled headers
+//
+#include <mrpt/core/cpu.h>
+#include <mrpt/poses/CPose3D.h>
+#include <mrpt/poses/Lie/SE.h>
+
+#include "SE3_batch_internal.h"
+
+using namespace mrpt::poses;
+using namespace mrpt::poses::Lie;
+
+void internal::pose_to_3x4_matrix(const CPose3D& p, float m[12])
+{
+  const auto& R = p.getRotationMatrix();
+  for (int r = 0; r < 3; r++)
+    for (int c = 0; c < 3; c++) m[4 * r + c] = static_cast<float>(R(r, c));
+  m[3] = static_cast<float>(p.x());
+  m[7] = static_cast<float>(p.y());
+  m[11] = static_cast<float>(p.z());
+}
+
+void internal::inverse_pose_to_3x4_matrix(const CPose3D& p, float m[12])
+{
+  const auto& R = p.getRotationMatrix();
+  // R^t:
+  for (int r = 0; r < 3; r++)
+    for (int c = 0; c < 3; c++) m[4 * r + c] = static_cast<float>(R(c, r));
+  // -R^t * t:
+  const double tx = p.x(), ty = p.y(), tz = p.z();
+  m[3] = static_cast<float>(-(R(0, 0) * tx + R(1, 0) * ty + R(2, 0) * tz));
+  m[7] = static_cast<float>(-(R(0, 1) * tx + R(1, 1) * ty + R(2, 1) * tz));
+  m[11] = static_cast<float>(-(R(0, 2) * tx + R(1, 2) * ty + R(2, 2) * tz));
+}
+
+void internal::composePoints3x4_generic(
+    float* x, float* y, float* z, size_t num_points, const float m[12])
+{
+  for (size_t i = 0; i < num_points; i++)
+  {
+    const float lx = x[i], ly = y[i], lz = z[i];
+    x[i] = m[0] * lx + m[1] * ly + m[2] * lz + m[3];
+    y[i] = m[4] * lx + m[5] * ly + m[6] * lz + m[7];
+    z[i] = m[8] * lx + m[9] * ly + m[10] * lz + m[11];
+  }
+}
+
+void internal::composePoints3x4(float* x, float* y, float* z, size_t num_points, const float m[12])
+{
+#if MRPT_ARCH_INTEL_COMPATIBLE
+  if (mrpt::cpu::supports(mrpt::cpu::feature::AVX2))
+  {
+    internal::composePoints3x4_AVX2(x, y, z, num_points, m);
+    return;
+  }
+  if (mrpt::cpu::supports(mrpt::cpu::feature::SSE2))
+  {
+    internal::composePoints3x4_SSE2(x, y, z, num_points, m);
+    return;
+  }
+#endif
+  internal::composePoints3x4_generic(x, y, z, num_points, m);
+}
+
+void SE<3>::composePoints(const type& pose, float* x, float* y, float* z, size_t num)
+{
+  float m[12];
+  internal::pose_to_3x4_matrix(pose, m);
+  internal::composePoints3x4(x, y, z, num, m);
+}
+
+void SE<3>::inverseComposePoints(const type& pose, float* x, float* y, float* z, size_t num)
+{
+  float m[12];
+  internal::inverse_pose_to_3x4_matrix(pose, m);
+  internal::composePoints3x4(x, y, z, num, m);
+}
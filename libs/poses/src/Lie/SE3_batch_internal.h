@@ -0,0 +1,51 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#pragma once
+
+#include <mrpt/config.h>
+#include <mrpt/poses/CPose3D.h>
+
+#include <cstddef>
+
+namespace mrpt::poses::Lie::internal
+{
+/** Flattens the homogeneous matrix of `p` into the 3x4 row-major float
+ * layout expected by composePoints3x4() and its SIMD variants: rotation in
+ * m[0..2], m[4..6], m[8..10]; translation in m[3], m[7], m[11].
+ */
+void pose_to_3x4_matrix(const mrpt::poses::CPose3D& p, float m[12]);
+
+/** Same layout as pose_to_3x4_matrix(), but for the inverse transformation:
+ * [R^t | -R^t t].
+ */
+void inverse_pose_to_3x4_matrix(const mrpt::poses::CPose3D& p, float m[12]);
+
+/** Applies in-place the SE(3) transformation given by the 3x4 row-major
+ * matrix `m` to the structure-of-arrays point buffers x/y/z.
+ *
+ * Plain scalar version, used as fallback and for the tail of the
+ * vectorized loops.
+ */
+void composePoints3x4_generic(float* x, float* y, float* z, size_t num_points, const float m[12]);
+
+#if MRPT_ARCH_INTEL_COMPATIBLE
+/// SSE2 version of composePoints3x4_generic(): 4-wide inner loop.
+void composePoints3x4_SSE2(float* x, float* y, float* z, size_t num_points, const float m[12]);
+
+/// AVX2 version of composePoints3x4_generic(): 8-wide inner loop.
+void composePoints3x4_AVX2(float* x, float* y, float* z, size_t num_points, const float m[12]);
+#endif
+
+/** Dispatches at runtime to the widest kernel supported by the current CPU
+ * (via mrpt::cpu::supports()).
+ */
+void composePoints3x4(float* x, float* y, float* z, size_t num_points, const float m[12]);
+
+}  // namespace mrpt::poses::Lie::internal
@@ -15,6 +15,10 @@
 
 #include <Eigen/Dense>
 
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
 using namespace mrpt;
 using namespace mrpt::math;
 using namespace mrpt::poses;
@@ -148,6 +152,134 @@ void SE_average<3>::append(const mrpt::math::TPose3D& p, const double weight)
 {
   append(CPose3D(p), weight);
 }
+
+void SE_average<3>::append_many(
+    const std::vector<mrpt::poses::CPose3D>& poses, const std::vector<double>& weights)
+{
+  ASSERT_(weights.empty() || weights.size() == poses.size());
+  const size_t N = poses.size();
+
+  // Per-thread partial sums are exact: the accumulator is a plain weighted
+  // sum, so merge order does not matter.
+  constexpr size_t MIN_SAMPLES_PER_THREAD = 2048;
+  const size_t nThreads = std::min<size_t>(
+      std::max<unsigned int>(1, std::thread::hardware_concurrency()), N / MIN_SAMPLES_PER_THREAD);
+
+  if (nThreads < 2)
+  {
+    for (size_t i = 0; i < N; i++) append(poses[i], weights.empty() ? 1.0 : weights[i]);
+    return;
+  }
+
+  struct TPartial
+  {
+    double count = 0, x = 0, y = 0, z = 0;
+    Eigen::Matrix3d rot = Eigen::Matrix3d::Zero();
+  };
+  std::vector<TPartial> partials(nThreads);
+
+  std::vector<std::thread> workers;
+  workers.reserve(nThreads);
+  for (size_t t = 0; t < nThreads; t++)
+    workers.emplace_back(
+        [&, t]()
+        {
+          const size_t i0 = (t * N) / nThreads, i1 = ((t + 1) * N) / nThreads;
+          TPartial& acc = partials[t];
+          for (size_t i = i0; i < i1; i++)
+          {
+            const double w = weights.empty() ? 1.0 : weights[i];
+            const auto& p = poses[i];
+            acc.count += w;
+            acc.x += w * p.x();
+            acc.y += w * p.y();
+            acc.z += w * p.z();
+            acc.rot += w * p.getRotationMatrix().asEigen();
+          }
+        });
+  for (auto& th : workers) th.join();
+
+  for (const auto& acc : partials)
+  {
+    if (acc.count == 0) continue;
+    m_count += acc.count;
+    m_accum_x += acc.x;
+    m_accum_y += acc.y;
+    m_accum_z += acc.z;
+    // append(M,w) adds w*M, so feed the partial sum scaled back by its
+    // weight to keep the rotation accumulator and its count consistent:
+    m_rot_part.append(mrpt::math::CMatrixDouble33(acc.rot * (1.0 / acc.count)), acc.count);
+  }
+}
+
+void SE_average<3>::get_robust_average(
+    const std::vector<mrpt::poses::CPose3D>& poses,
+    mrpt::poses::CPose3D& out_mean,
+    std::vector<double>* out_weights,
+    const size_t maxIterations)
+{
+  const size_t N = poses.size();
+  ASSERT_(N > 0);
+
+  // Initial pass: uniform weights, threaded accumulation:
+  clear();
+  append_many(poses);
+
+  std::vector<double> w(N, 1.0), res(N);
+  CPose3D mean;
+  get_average(mean);
+
+  double cutoff = 0;
+  for (size_t iter = 0; iter < maxIterations; iter++)
+  {
+    // Residual of each sample vs. the current mean: combined translation
+    // [m] and rotation geodesic distance [rad]:
+    const auto Rm = mean.getRotationMatrix().asEigen();
+    for (size_t i = 0; i < N; i++)
+    {
+      const auto& p = poses[i];
+      const double dt2 =
+          square(p.x() - mean.x()) + square(p.y() - mean.y()) + square(p.z() - mean.z());
+      const double cosAng = std::min(
+          1.0,
+          std::max(-1.0, ((Rm.transpose() * p.getRotationMatrix().asEigen()).trace() - 1) * 0.5));
+      res[i] = std::sqrt(dt2 + square(std::acos(cosAng)));
+    }
+
+    if (iter == 0)
+    {
+      // Huber-like cutoff from the median residual of the uniform pass:
+      std::vector<double> tmp = res;
+      std::nth_element(tmp.begin(), tmp.begin() + N / 2, tmp.end());
+      cutoff = std::max(3.0 * tmp[N / 2], 1e-6);
+    }
+
+    // Incremental re-weighting: only samples whose weight moved touch the
+    // accumulators, instead of re-averaging everything from scratch.
+    size_t nChanged = 0;
+    for (size_t i = 0; i < N; i++)
+    {
+      const double wNew = res[i] <= cutoff ? 1.0 : cutoff / res[i];
+      const double dw = wNew - w[i];
+      if (std::abs(dw) < 1e-9) continue;
+      append(poses[i], dw);
+      w[i] = wNew;
+      nChanged++;
+    }
+    if (!nChanged) break;
+
+    CPose3D newMean;
+    get_average(newMean);
+    const bool converged = square(newMean.x() - mean.x()) + square(newMean.y() - mean.y()) +
+            square(newMean.z() - mean.z()) <
+        square(1e-9);
+    mean = newMean;
+    if (converged) break;
+  }
+
+  out_mean = mean;
+  if (out_weights) *out_weights = w;
+}
 void SE_average<3>::get_average(mrpt::poses::CPose3D& ret_mean) const
 {
   ASSERT_GT_(m_count, 0);
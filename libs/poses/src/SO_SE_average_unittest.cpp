@@ -10,6 +10,7 @@
 #include <gtest/gtest.h>
 #include <mrpt/math/wrap2pi.h>
 #include <mrpt/poses/SO_SE_average.h>
+#include <mrpt/random.h>
 
 #include <Eigen/Dense>
 
@@ -102,3 +103,78 @@ TEST(SE2_SE3_avrg, SO3_average)
     run_test_so3_avrg(angs, sizeof(angs) / (3 * sizeof(angs[0])), correct_avr);
   }
 }
+
+static std::vector<CPose3D> samplesAround(
+    const CPose3D& center, size_t N, double std_xyz, double std_ang)
+{
+  auto& rng = mrpt::random::getRandomGenerator();
+  std::vector<CPose3D> poses;
+  poses.reserve(N);
+  for (size_t i = 0; i < N; i++)
+    poses.emplace_back(
+        center.x() + rng.drawGaussian1D(0, std_xyz), center.y() + rng.drawGaussian1D(0, std_xyz),
+        center.z() + rng.drawGaussian1D(0, std_xyz), center.yaw() + rng.drawGaussian1D(0, std_ang),
+        center.pitch() + rng.drawGaussian1D(0, std_ang),
+        center.roll() + rng.drawGaussian1D(0, std_ang));
+  return poses;
+}
+
+// Threaded batch accumulation must match per-sample append():
+TEST(SE2_SE3_avrg, SE3_append_many)
+{
+  mrpt::random::getRandomGenerator().randomize(1234);
+  const auto center = CPose3D(1.0, -2.0, 0.5, 0.3, -0.2, 0.1);
+  const auto poses = samplesAround(center, 20000, 0.5, 0.2);
+
+  std::vector<double> weights(poses.size());
+  for (size_t i = 0; i < weights.size(); i++) weights[i] = 0.5 + (i % 10) * 0.1;
+
+  SE_average<3> avSerial, avBatch;
+  for (size_t i = 0; i < poses.size(); i++) avSerial.append(poses[i], weights[i]);
+  avBatch.append_many(poses, weights);
+
+  CPose3D meanSerial, meanBatch;
+  avSerial.get_average(meanSerial);
+  avBatch.get_average(meanBatch);
+
+  EXPECT_NEAR(meanSerial.x(), meanBatch.x(), 1e-10);
+  EXPECT_NEAR(meanSerial.y(), meanBatch.y(), 1e-10);
+  EXPECT_NEAR(meanSerial.z(), meanBatch.z(), 1e-10);
+  EXPECT_NEAR(meanSerial.yaw(), meanBatch.yaw(), 1e-8);
+  EXPECT_NEAR(meanSerial.pitch(), meanBatch.pitch(), 1e-8);
+  EXPECT_NEAR(meanSerial.roll(), meanBatch.roll(), 1e-8);
+}
+
+// The robust average must shrug off gross outliers that drag the plain
+// average far away:
+TEST(SE2_SE3_avrg, SE3_robust_average)
+{
+  mrpt::random::getRandomGenerator().randomize(42);
+  const auto center = CPose3D(2.0, 1.0, -0.5, 0.4, 0.1, -0.2);
+  auto poses = samplesAround(center, 900, 0.02, 0.01);
+  // 10% gross outliers:
+  const auto outliers = samplesAround(CPose3D(20.0, -15.0, 8.0, -2.0, 0.8, 1.5), 100, 0.5, 0.3);
+  poses.insert(poses.end(), outliers.begin(), outliers.end());
+
+  SE_average<3> av;
+  CPose3D robustMean;
+  std::vector<double> w;
+  av.get_robust_average(poses, robustMean, &w);
+
+  EXPECT_NEAR(robustMean.x(), center.x(), 0.05);
+  EXPECT_NEAR(robustMean.y(), center.y(), 0.05);
+  EXPECT_NEAR(robustMean.z(), center.z(), 0.05);
+  EXPECT_NEAR(robustMean.yaw(), center.yaw(), 0.02);
+
+  // The plain mean is dragged towards the outlier cluster:
+  SE_average<3> avPlain;
+  avPlain.append_many(poses);
+  CPose3D plainMean;
+  avPlain.get_average(plainMean);
+  EXPECT_GT(std::abs(plainMean.x() - center.x()), 0.5);
+
+  // The final weights must separate inliers from outliers:
+  ASSERT_EQ(w.size(), poses.size());
+  for (size_t i = 0; i < 900; i += 100) EXPECT_GT(w[i], 0.9) << "inlier i=" << i;
+  for (size_t i = 900; i < poses.size(); i += 20) EXPECT_LT(w[i], 0.2) << "outlier i=" << i;
+}
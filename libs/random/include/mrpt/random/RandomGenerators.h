@@ -59,23 +59,76 @@ class Generator_MT19937
   void generateNumbers();
 };
 
-/** A thred-safe pseudo random number generator, based on an internal MT19937
- * randomness generator.
+/** Portable counter-based Philox4x32-10 random generator, C++11
+ * UniformRandomBitGenerator compliant.
+ *
+ * It is ensured to generate the same numbers on any compiler and system.
+ * Unlike Generator_MT19937, its state is a tiny (counter, key) pair, so:
+ * - discard() (skip-ahead) is O(1), and
+ * - explicit **streams** are supported: each (seed, stream) pair yields an
+ *   independent sequence, so N worker threads can each own one stream of a
+ *   common seed and sample in parallel, reproducibly, without sharing any
+ *   state (see getRandomGeneratorPerThread()).
+ *
+ * Reference: Salmon et al., "Parallel random numbers: as easy as 1, 2, 3"
+ * (SC'11).
+ * \note [New in MRPT 2.14.5]
+ * \ingroup mrpt_random_grp
+ */
+class Generator_Philox4x32
+{
+ public:
+  using result_type = uint32_t;
+  static constexpr result_type min() { return std::numeric_limits<result_type>::min(); }
+  static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+  Generator_Philox4x32() = default;
+  explicit Generator_Philox4x32(uint64_t seed, uint64_t stream = 0) { this->seed(seed, stream); }
+
+  /** Seeds the generator and (optionally) selects its stream; the counter
+   * is rewound to the sequence start. */
+  void seed(uint64_t seed, uint64_t stream = 0);
+
+  /** Jumps to another stream of the current seed, rewinding the counter */
+  void setStream(uint64_t stream);
+  uint64_t stream() const { return m_stream; }
+
+  result_type operator()();
+
+  /** Advances the sequence n steps in O(1) time */
+  void discard(uint64_t n);
+
+ private:
+  uint32_t m_key[2] = {0, 0};
+  uint32_t m_ctr[4] = {0, 0, 0, 0};  //!< 128-bit block counter
+  uint64_t m_seed{0}, m_stream{0};
+  uint32_t m_buf[4] = {0, 0, 0, 0};  //!< Outputs of the current block
+  unsigned m_bufPos{4};              //!< 4: buffer empty
+  bool m_seed_initialized{false};
+
+  void generateBlock();  //!< Runs the 10 Philox rounds into m_buf
+};
+
+/** A thred-safe pseudo random number generator, based on an internal
+ * randomness engine (the portable MT19937 one, unless another URBG is given
+ * as template argument: see CRandomGeneratorPhilox).
  * The base algorithm for randomness is platform-independent. See
  * http://en.wikipedia.org/wiki/Mersenne_twister
  *
  * For real thread-safety, each thread must create and use its own instance of
- * this class.
+ * this class, or use its own stream of a CRandomGeneratorPhilox (see
+ * getRandomGeneratorPerThread()).
  *
  * Single-thread programs can use the static object
  * mrpt::random::randomGenerator
  * \ingroup mrpt_random_grp
  */
-class CRandomGenerator
+template <class URBG = Generator_MT19937>
+class CRandomGeneratorT
 {
  protected:
-  /** Data used internally by the MT19937 PRNG algorithm. */
-  Generator_MT19937 m_MT19937;
+  /** The underlying randomness engine (PRNG algorithm). */
+  URBG m_engine;
 
   std::normal_distribution<double> m_normdistribution;
   std::uniform_int_distribution<uint32_t> m_uint32;
@@ -86,32 +139,38 @@ class CRandomGenerator
    @{ */
 
   /** Default constructor: initialize random seed based on current time */
-  CRandomGenerator() { randomize(); }
+  CRandomGeneratorT() { randomize(); }
   /** Constructor for providing a custom random seed to initialize the PRNG */
-  CRandomGenerator(const uint32_t seed) { randomize(seed); }
+  CRandomGeneratorT(const uint32_t seed) { randomize(seed); }
   /** Initialize the PRNG from the given random seed */
-  void randomize(const uint32_t seed);
+  void randomize(const uint32_t seed) { m_engine.seed(seed); }
   /** Randomize the generators, based on std::random_device */
-  void randomize();
+  void randomize() { m_engine.seed(std::random_device{}()); }
+
+  /** Direct access to the underlying randomness engine, e.g. to select the
+   * stream of a Generator_Philox4x32-based instance.
+   * \note [New in MRPT 2.14.5] */
+  URBG& engine() { return m_engine; }
+  const URBG& engine() const { return m_engine; }
 
   /** @} */
 
   /** @name Uniform pdf
    @{ */
 
-  /** Generate a uniformly distributed pseudo-random number using the MT19937
-   * algorithm, in the whole range of 32-bit integers.
+  /** Generate a uniformly distributed pseudo-random number using the
+   * underlying engine, in the whole range of 32-bit integers.
    *  See: http://en.wikipedia.org/wiki/Mersenne_twister */
-  uint32_t drawUniform32bit();
+  uint32_t drawUniform32bit() { return m_uint32(m_engine); }
 
   /** Returns a uniformly distributed pseudo-random number by joining two
    * 32bit numbers from \a drawUniform32bit() */
-  uint64_t drawUniform64bit();
+  uint64_t drawUniform64bit() { return m_uint64(m_engine); }
 
   /** You can call this overloaded method with either 32 or 64bit unsigned
    * ints for the sake of general coding. */
-  void drawUniformUnsignedInt(uint32_t& ret_number) { ret_number = m_uint32(m_MT19937); }
-  void drawUniformUnsignedInt(uint64_t& ret_number) { ret_number = m_uint64(m_MT19937); }
+  void drawUniformUnsignedInt(uint32_t& ret_number) { ret_number = m_uint32(m_engine); }
+  void drawUniformUnsignedInt(uint64_t& ret_number) { ret_number = m_uint64(m_engine); }
 
   /** Return a uniform unsigned integer in the range [min_val,max_val] (both
    * inclusive) */
@@ -158,6 +217,18 @@ class CRandomGenerator
           static_cast<typename std::decay<decltype(v[c])>::type>(drawUniform(unif_min, unif_max));
   }
 
+  /** Bulk fill of a raw buffer with n independent, uniformly distributed
+   * samples in [unif_min, unif_max). Lower per-sample overhead than
+   * drawUniformVector()
+   * \note [New in MRPT 2.14.5] \sa drawGaussian1DFill */
+  template <typename T>
+  void drawUniformFill(T* out, const size_t n, const double unif_min = 0, const double unif_max = 1)
+  {
+    constexpr double k = 2.3283064370807973754314699618685e-10;  // 0xFFFFFFFF ^ -1
+    const double range_k = (unif_max - unif_min) * k;
+    for (size_t i = 0; i < n; i++) out[i] = static_cast<T>(unif_min + range_k * m_engine());
+  }
+
   /** @} */
 
   /** @name Normal/Gaussian pdf
@@ -168,7 +239,7 @@ class CRandomGenerator
    * receive the likelihood of the given sample to have been obtained, that
    * is, the value of the normal pdf at the sample value.
    */
-  double drawGaussian1D_normalized();
+  double drawGaussian1D_normalized() { return m_normdistribution(m_engine); }
 
   /** Generate a normally distributed pseudo-random number.
    * \param mean The mean value of desired normal distribution
@@ -224,6 +295,29 @@ class CRandomGenerator
       v[c] = static_cast<std::remove_reference_t<decltype(v[c])>>(drawGaussian1D(mean, std));
   }
 
+  /** Bulk fill of a raw buffer with n independent, normally distributed
+   * samples, using pairwise Box-Muller over whole batches instead of one
+   * std::normal_distribution call per element. Lower per-sample overhead
+   * than drawGaussian1DVector(); note it draws from a *different*
+   * pseudo-random sub-sequence than the element-wise methods.
+   * \note [New in MRPT 2.14.5] \sa drawUniformFill */
+  template <typename T>
+  void drawGaussian1DFill(T* out, const size_t n, const double mean = 0, const double std = 1)
+  {
+    constexpr double k = 2.3283064370807973754314699618685e-10;  // 0xFFFFFFFF ^ -1
+    constexpr double TWO_PI = 6.283185307179586476925286766559;
+
+    for (size_t i = 0; i < n; i += 2)
+    {
+      // u1 in (0,1]: never zero, so std::log() is safe:
+      const double u1 = (static_cast<double>(m_engine()) + 1.0) * k;
+      const double u2 = static_cast<double>(m_engine()) * k;
+      const double r = std * std::sqrt(-2.0 * std::log(u1));
+      out[i] = static_cast<T>(mean + r * std::cos(TWO_PI * u2));
+      if (i + 1 < n) out[i + 1] = static_cast<T>(mean + r * std::sin(TWO_PI * u2));
+    }
+  }
+
   /** Generate multidimensional random samples according to a given covariance
    * matrix.
    *  Mean is assumed to be zero if mean==nullptr.
@@ -378,13 +472,38 @@ class CRandomGenerator
 
   /** @} */
 
-};  // end of CRandomGenerator
+};  // end of CRandomGeneratorT
 // --------------------------------------------------------------
 
+/** The classic MT19937-backed generator (same behavior, and pseudo-random
+ * sequences, as in all former MRPT versions) */
+using CRandomGenerator = CRandomGeneratorT<Generator_MT19937>;
+
+/** A generator backed by the counter-based Philox4x32-10 engine, with
+ * explicit stream support for reproducible parallel sampling: see
+ * Generator_Philox4x32 and getRandomGeneratorPerThread().
+ * \note [New in MRPT 2.14.5] */
+using CRandomGeneratorPhilox = CRandomGeneratorT<Generator_Philox4x32>;
+
 /** A static instance of a CRandomGenerator class, for use in single-thread
  * applications */
 CRandomGenerator& getRandomGenerator();
 
+/** Returns a thread-local Philox-backed generator. All of them share one
+ * common base seed (see RandomizePerThreadStreams()) but each thread gets
+ * its own, independent stream of it, assigned in first-use order, so
+ * parallel sampling (e.g. particle-filter prediction stages) never shares
+ * generator state across threads and remains reproducible.
+ * \note [New in MRPT 2.14.5] */
+CRandomGeneratorPhilox& getRandomGeneratorPerThread();
+
+/** Changes the common base seed used by getRandomGeneratorPerThread() and
+ * re-seeds the calling thread's generator; for reproducible runs, call it
+ * before the worker threads first use their generators. Stream numbering
+ * restarts at 0 (calling thread first).
+ * \note [New in MRPT 2.14.5] */
+void RandomizePerThreadStreams(const uint64_t baseSeed);
+
 /** A random number generator for usage in STL algorithms expecting a function
  * like this (eg, random_shuffle):
  */
@@ -11,6 +11,9 @@
 //
 #include <mrpt/random/RandomGenerators.h>
 
+#include <atomic>
+#include <mutex>
+
 using namespace mrpt::random;
 
 // The global instance of CRandomGenerator for single-thread programs:
@@ -82,11 +85,149 @@ void Generator_MT19937::seed(const uint32_t seed)
   m_index = 0;
 }
 
+// ---------------------------------------------------------------------------
+// Generator_Philox4x32: Philox4x32-10, from Salmon et al. (SC'11).
+// ---------------------------------------------------------------------------
+namespace
+{
+// Round multipliers and Weyl key increments (Salmon et al., Table 2):
+constexpr uint32_t PHILOX_M0 = 0xD2511F53u, PHILOX_M1 = 0xCD9E8D57u;
+constexpr uint32_t PHILOX_W0 = 0x9E3779B9u, PHILOX_W1 = 0xBB67AE85u;
+
+inline void philoxRound(uint32_t ctr[4], const uint32_t key[2])
+{
+  const uint64_t p0 = static_cast<uint64_t>(PHILOX_M0) * ctr[0];
+  const uint64_t p1 = static_cast<uint64_t>(PHILOX_M1) * ctr[2];
+  const uint32_t hi0 = static_cast<uint32_t>(p0 >> 32), lo0 = static_cast<uint32_t>(p0);
+  const uint32_t hi1 = static_cast<uint32_t>(p1 >> 32), lo1 = static_cast<uint32_t>(p1);
+  ctr[0] = hi1 ^ ctr[1] ^ key[0];
+  ctr[1] = lo1;
+  ctr[2] = hi0 ^ ctr[3] ^ key[1];
+  ctr[3] = lo0;
+}
+}  // namespace
+
+void Generator_Philox4x32::seed(const uint64_t seed, const uint64_t stream)
+{
+  m_seed_initialized = true;
+  m_seed = seed;
+  m_stream = stream;
+  m_key[0] = static_cast<uint32_t>(seed);
+  m_key[1] = static_cast<uint32_t>(seed >> 32);
+  // The stream selects the upper 64 bits of the 128-bit counter, so streams
+  // of a common seed are just disjoint 2^66-sample windows of one sequence:
+  m_ctr[0] = m_ctr[1] = 0;
+  m_ctr[2] = static_cast<uint32_t>(stream);
+  m_ctr[3] = static_cast<uint32_t>(stream >> 32);
+  m_bufPos = 4;
+}
+
+void Generator_Philox4x32::setStream(const uint64_t stream) { this->seed(m_seed, stream); }
+
+void Generator_Philox4x32::generateBlock()
+{
+  if (!m_seed_initialized) this->seed(std::random_device{}());
+
+  uint32_t ctr[4] = {m_ctr[0], m_ctr[1], m_ctr[2], m_ctr[3]};
+  uint32_t key[2] = {m_key[0], m_key[1]};
+  for (int round = 0; round < 10; round++)
+  {
+    if (round) key[0] += PHILOX_W0, key[1] += PHILOX_W1;
+    philoxRound(ctr, key);
+  }
+  for (int i = 0; i < 4; i++) m_buf[i] = ctr[i];
+
+  // Increment the 128-bit counter (lower 64 bits only: the upper half is the
+  // stream id, and 2^66 samples per stream will never wrap in practice):
+  if (++m_ctr[0] == 0) ++m_ctr[1];
+  m_bufPos = 0;
+}
+
+Generator_Philox4x32::result_type Generator_Philox4x32::operator()()
+{
+  if (m_bufPos >= 4) generateBlock();
+  return m_buf[m_bufPos++];
+}
+
+void Generator_Philox4x32::discard(const uint64_t n)
+{
+  if (!m_seed_initialized) this->seed(std::random_device{}());
+
+  // Consume first whatever remains buffered from the current block:
+  const uint64_t buffered = (m_bufPos < 4) ? (4 - m_bufPos) : 0;
+  if (n < buffered)
+  {
+    m_bufPos += static_cast<unsigned>(n);
+    return;
+  }
+  uint64_t left = n - buffered;
+  m_bufPos = 4;
+
+  // Then jump whole blocks in O(1) via counter arithmetic:
+  const uint64_t blocks = left / 4;
+  const uint32_t prevLo = m_ctr[0];
+  m_ctr[0] += static_cast<uint32_t>(blocks);
+  m_ctr[1] += static_cast<uint32_t>(blocks >> 32) + ((m_ctr[0] < prevLo) ? 1 : 0);
+
+  // And the remaining (<4) samples from a fresh block:
+  left %= 4;
+  if (left)
+  {
+    generateBlock();
+    m_bufPos = static_cast<unsigned>(left);
+  }
+}
+
+// ---------------------------------------------------------------------------
+// Global generator instances
+// ---------------------------------------------------------------------------
 CRandomGenerator& mrpt::random::getRandomGenerator() { return randomGenerator; }
-uint64_t CRandomGenerator::drawUniform64bit() { return m_uint64(m_MT19937); }
-uint32_t CRandomGenerator::drawUniform32bit() { return m_uint32(m_MT19937); }
-void CRandomGenerator::randomize(const uint32_t seed) { m_MT19937.seed(seed); }
 
-void CRandomGenerator::randomize() { m_MT19937.seed(std::random_device{}()); }
+namespace
+{
+// Common base seed, next free stream id, and re-seeding epoch for the
+// per-thread generators:
+std::atomic<uint64_t> ptBaseSeed{0};
+std::atomic<uint64_t> ptNextStream{0};
+std::atomic<uint64_t> ptEpoch{0};
+std::once_flag ptBaseSeedInitFlag;
+
+struct PerThreadGenerator
+{
+  CRandomGeneratorPhilox gen;
+  // Any value != ptEpoch forces (re-)seeding on first use:
+  uint64_t seenEpoch = std::numeric_limits<uint64_t>::max();
+};
+}  // namespace
 
-double CRandomGenerator::drawGaussian1D_normalized() { return m_normdistribution(m_MT19937); }
+CRandomGeneratorPhilox& mrpt::random::getRandomGeneratorPerThread()
+{
+  std::call_once(
+      ptBaseSeedInitFlag,
+      []()
+      {
+        std::random_device rd;
+        ptBaseSeed = (static_cast<uint64_t>(rd()) << 32) | rd();
+      });
+
+  static thread_local PerThreadGenerator ptg;
+  const uint64_t epoch = ptEpoch;
+  if (ptg.seenEpoch != epoch)
+  {
+    // First use from this thread, or RandomizePerThreadStreams() was called
+    // since: take the next free stream of the current base seed.
+    ptg.seenEpoch = epoch;
+    ptg.gen.engine().seed(ptBaseSeed, ptNextStream++);
+  }
+  return ptg.gen;
+}
+
+void mrpt::random::RandomizePerThreadStreams(const uint64_t baseSeed)
+{
+  // Mark the base seed as initialized so it is not overwritten later:
+  std::call_once(ptBaseSeedInitFlag, []() {});
+  ptBaseSeed = baseSeed;
+  ptNextStream = 0;
+  ++ptEpoch;
+  getRandomGeneratorPerThread();  // the calling thread takes stream #0
+}
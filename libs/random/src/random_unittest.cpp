@@ -12,6 +12,9 @@
 #include <mrpt/random/RandomGenerators.h>
 #include <mrpt/random/random_shuffle.h>
 
+#include <cmath>
+#include <thread>
+
 TEST(Random, Randomize)
 {
   using namespace mrpt::random;
@@ -141,6 +144,114 @@ TEST(Random, portable_uniform_distribution)
   }
 }
 
+TEST(Random, philoxKnownAnswer)
+{
+  // Known-answer test vector for Philox4x32-10 with key=0, counter=0, from
+  // the Random123 reference implementation (Salmon et al., SC'11):
+  mrpt::random::Generator_Philox4x32 rnd;
+  rnd.seed(0, 0);
+  EXPECT_EQ(rnd(), 0x6627e8d5U);
+  EXPECT_EQ(rnd(), 0xe169c58dU);
+  EXPECT_EQ(rnd(), 0xbc57ac4cU);
+  EXPECT_EQ(rnd(), 0x9b00dbd8U);
+}
+
+TEST(Random, philoxStreams)
+{
+  mrpt::random::Generator_Philox4x32 rnd(1234, 0);
+
+  // Same (seed, stream) => same sequence:
+  std::vector<uint32_t> seq0(20);
+  for (auto& v : seq0) v = rnd();
+  rnd.seed(1234, 0);
+  for (size_t i = 0; i < seq0.size(); i++) EXPECT_EQ(rnd(), seq0[i]) << "i=" << i;
+
+  // Other streams of the same seed are independent sequences:
+  rnd.setStream(1);
+  EXPECT_EQ(rnd.stream(), 1U);
+  size_t nCoincidences = 0;
+  for (const auto v0 : seq0)
+    if (rnd() == v0) nCoincidences++;
+  EXPECT_LT(nCoincidences, seq0.size());
+
+  // O(1) discard() must be equivalent to drawing and dropping n samples:
+  for (const uint64_t n : {0UL, 1UL, 3UL, 4UL, 5UL, 1000003UL})
+  {
+    rnd.seed(1234, 0);
+    rnd.discard(n);
+    const auto vSkip = rnd();
+    rnd.seed(1234, 0);
+    for (uint64_t i = 0; i < n; i++) (void)rnd();
+    EXPECT_EQ(rnd(), vSkip) << "n=" << n;
+  }
+}
+
+TEST(Random, perThreadStreams)
+{
+  using namespace mrpt::random;
+
+  RandomizePerThreadStreams(42);
+  auto& rnd = getRandomGeneratorPerThread();
+  const auto v1 = rnd.drawUniform32bit();
+
+  // Reproducible: re-seeding with the same base seed repeats the sequence,
+  // with the calling thread always on stream #0:
+  RandomizePerThreadStreams(42);
+  EXPECT_EQ(getRandomGeneratorPerThread().engine().stream(), 0U);
+  EXPECT_EQ(getRandomGeneratorPerThread().drawUniform32bit(), v1);
+
+  // Each thread must get its own stream of the common base seed:
+  uint64_t otherStream = 0;
+  uint32_t otherV1 = 0;
+  std::thread t(
+      [&]()
+      {
+        auto& r = getRandomGeneratorPerThread();
+        otherStream = r.engine().stream();
+        otherV1 = r.drawUniform32bit();
+      });
+  t.join();
+  EXPECT_NE(otherStream, 0U);
+  EXPECT_NE(otherV1, v1);
+}
+
+TEST(Random, bulkFills)
+{
+  using namespace mrpt::random;
+
+  CRandomGeneratorPhilox rnd;
+  rnd.randomize(7);
+
+  const size_t N = 100000;
+  std::vector<double> v(N);
+
+  rnd.drawUniformFill(v.data(), N, -2.0, 4.0);
+  double mean = 0;
+  for (const auto x : v)
+  {
+    EXPECT_GE(x, -2.0);
+    EXPECT_LE(x, 4.0);
+    mean += x;
+  }
+  mean /= N;
+  EXPECT_NEAR(mean, 1.0, 0.05);
+
+  rnd.drawGaussian1DFill(v.data(), N, 10.0, 2.0);
+  mean = 0;
+  for (const auto x : v) mean += x;
+  mean /= N;
+  double var = 0;
+  for (const auto x : v) var += (x - mean) * (x - mean);
+  var /= N;
+  EXPECT_NEAR(mean, 10.0, 0.05);
+  EXPECT_NEAR(std::sqrt(var), 2.0, 0.05);
+
+  // Odd sample count must also fill the last element:
+  std::vector<float> v3 = {-1e9f, -1e9f, -1e9f};
+  rnd.drawGaussian1DFill(v3.data(), 3);
+  for (const auto x : v3) EXPECT_GT(x, -100.0f);
+}
+
 TEST(Random, shuffle)
 {
   // Fixed, platform-independent RNG, so we have reproducible results below:
@@ -74,6 +74,9 @@ std::set<std::string> extractFields(const sensor_msgs::msg::PointCloud2& msg);
  * Generated sensor_msgs::PointCloud2::channels: `x`, `y`, `z`.
  *
  * \return true on sucessful conversion, false on any error.
+ * \note Repeated calls reusing the same `msg` object (this overload and the
+ * ones below) reuse its internal buffers, so no per-call allocation happens
+ * once the message reaches its steady-state size.
  * \sa fromROS
  */
 bool toROS(
@@ -20,6 +20,7 @@
 #include <cstring>  // size_t
 #include <geometry_msgs/msg/pose_with_covariance.hpp>
 #include <geometry_msgs/msg/quaternion.hpp>
+#include <vector>
 
 namespace mrpt::ros2bridge
 {
@@ -50,11 +51,38 @@ geometry_msgs::msg::PoseWithCovariance toROS(const mrpt::poses::CPosePDFGaussian
 
 geometry_msgs::msg::Quaternion toROS(const mrpt::math::CQuaternionDouble& src);
 
+/** Batch conversion of an array of poses, e.g. to build path or trajectory
+ * messages: `des` is resized once and each element converted in place, with no
+ * intermediate PDF/message temporaries. The covariance axis remapping uses a
+ * compile-time index-permutation table.
+ * \note [New in MRPT 2.14.5]
+ */
+void toROS_Pose(
+    const std::vector<mrpt::poses::CPose3D>& src, std::vector<geometry_msgs::msg::Pose>& des);
+
+/** \overload For arrays of poses with covariance. \note [New in MRPT 2.14.5]
+ */
+void toROS_Pose(
+    const std::vector<mrpt::poses::CPose3DPDFGaussian>& src,
+    std::vector<geometry_msgs::msg::PoseWithCovariance>& des);
+
 mrpt::poses::CPose3D fromROS(const tf2::Transform& src);
 mrpt::math::CMatrixDouble33 fromROS(const tf2::Matrix3x3& src);
 mrpt::poses::CPose3D fromROS(const geometry_msgs::msg::Pose& src);
 mrpt::poses::CPose3DPDFGaussian fromROS(const geometry_msgs::msg::PoseWithCovariance& src);
 mrpt::math::CQuaternionDouble fromROS(const geometry_msgs::msg::Quaternion& src);
 
+/** Batch version of the Pose/PoseWithCovariance fromROS() conversions: `des`
+ * is resized once and each element converted in place.
+ * \note [New in MRPT 2.14.5]
+ */
+void fromROS(
+    const std::vector<geometry_msgs::msg::Pose>& src, std::vector<mrpt::poses::CPose3D>& des);
+
+/** \overload \note [New in MRPT 2.14.5] */
+void fromROS(
+    const std::vector<geometry_msgs::msg::PoseWithCovariance>& src,
+    std::vector<mrpt::poses::CPose3DPDFGaussian>& des);
+
 /** @} */
 }  // namespace mrpt::ros2bridge
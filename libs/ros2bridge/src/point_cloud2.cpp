@@ -19,6 +19,7 @@
 #include <mrpt/config.h>  // MRPT_IS_BIG_ENDIAN
 
 #include <cstdlib>
+#include <cstring>
 
 using namespace mrpt::maps;
 
@@ -101,6 +102,149 @@ void get_uint32_from_field(
   else
     output = 0;
 }
+
+// --- Bulk (de)interleave kernels -----------------------------------------
+// The get_*_from_field() helpers above re-dispatch on the field datatype for
+// every single point; for the common all-FLOAT32 LiDAR layouts that turns the
+// hot conversion loops into chains of per-point branches. The kernels below
+// dispatch once per *field* and then run plain strided loops the compiler can
+// vectorize, reading/writing the SoA point buffers directly.
+
+/** True if all the given non-null fields are FLOAT32: the layout emitted by
+ * virtually every ROS 2 LiDAR driver, and the precondition for the fast x/y/z
+ * deinterleave path. */
+bool all_fields_are_float32(
+    const std::initializer_list<const sensor_msgs::msg::PointField*>& fields)
+{
+  for (const auto* f : fields)
+    if (f && f->datatype != sensor_msgs::msg::PointField::FLOAT32) return false;
+  return true;
+}
+
+/** Deinterleaves the three FLOAT32 x/y/z fields of the message into the map
+ * point buffers in a single strided pass. The map must have been resized to
+ * msg.width*msg.height points beforehand. */
+template <class POINTSMAP>
+void deinterleave_xyz_f32(
+    const sensor_msgs::msg::PointCloud2& msg,
+    const sensor_msgs::msg::PointField& xf,
+    const sensor_msgs::msg::PointField& yf,
+    const sensor_msgs::msg::PointField& zf,
+    POINTSMAP& obj)
+{
+  size_t idx = 0;
+  for (unsigned int row = 0; row < msg.height; ++row)
+  {
+    const unsigned char* p = &msg.data[row * msg.row_step];
+    for (uint32_t col = 0; col < msg.width; ++col, ++idx, p += msg.point_step)
+    {
+      float x, y, z;
+      std::memcpy(&x, p + xf.offset, sizeof(float));
+      std::memcpy(&y, p + yf.offset, sizeof(float));
+      std::memcpy(&z, p + zf.offset, sizeof(float));
+      obj.setPointFast(idx, x, y, z);
+    }
+  }
+}
+
+/** Deinterleaves one FLOAT32/FLOAT64 field into a contiguous float column.
+ * Other datatypes leave the column as zeros, mirroring get_float_from_field().
+ */
+void deinterleave_field_to_floats(
+    const sensor_msgs::msg::PointField& field, const sensor_msgs::msg::PointCloud2& msg, float* out)
+{
+  for (unsigned int row = 0; row < msg.height; ++row)
+  {
+    const unsigned char* p = &msg.data[row * msg.row_step] + field.offset;
+    if (field.datatype == sensor_msgs::msg::PointField::FLOAT32)
+    {
+      for (uint32_t col = 0; col < msg.width; ++col, p += msg.point_step)
+        std::memcpy(out++, p, sizeof(float));
+    }
+    else if (field.datatype == sensor_msgs::msg::PointField::FLOAT64)
+    {
+      for (uint32_t col = 0; col < msg.width; ++col, p += msg.point_step)
+      {
+        double v;
+        std::memcpy(&v, p, sizeof(double));
+        *out++ = static_cast<float>(v);
+      }
+    }
+    else
+      out += msg.width;
+  }
+}
+
+/** Deinterleaves one UINT16/UINT8 field into a contiguous uint16_t column. */
+void deinterleave_field_to_uint16(
+    const sensor_msgs::msg::PointField& field,
+    const sensor_msgs::msg::PointCloud2& msg,
+    uint16_t* out)
+{
+  for (unsigned int row = 0; row < msg.height; ++row)
+  {
+    const unsigned char* p = &msg.data[row * msg.row_step] + field.offset;
+    if (field.datatype == sensor_msgs::msg::PointField::UINT16)
+    {
+      for (uint32_t col = 0; col < msg.width; ++col, p += msg.point_step)
+        std::memcpy(out++, p, sizeof(uint16_t));
+    }
+    else if (field.datatype == sensor_msgs::msg::PointField::UINT8)
+    {
+      for (uint32_t col = 0; col < msg.width; ++col, p += msg.point_step) *out++ = *p;
+    }
+    else
+      out += msg.width;
+  }
+}
+
+/** Deinterleaves a per-point timestamp field into a contiguous double column,
+ * in seconds: FLOAT32/FLOAT64 are taken as-is, UINT32 is assumed to be
+ * nanoseconds (the usual driver convention). */
+void deinterleave_time_to_doubles(
+    const sensor_msgs::msg::PointField& field,
+    const sensor_msgs::msg::PointCloud2& msg,
+    double* out)
+{
+  for (unsigned int row = 0; row < msg.height; ++row)
+  {
+    const unsigned char* p = &msg.data[row * msg.row_step] + field.offset;
+    if (field.datatype == sensor_msgs::msg::PointField::FLOAT64)
+    {
+      for (uint32_t col = 0; col < msg.width; ++col, p += msg.point_step)
+        std::memcpy(out++, p, sizeof(double));
+    }
+    else if (field.datatype == sensor_msgs::msg::PointField::FLOAT32)
+    {
+      for (uint32_t col = 0; col < msg.width; ++col, p += msg.point_step)
+      {
+        float v;
+        std::memcpy(&v, p, sizeof(float));
+        *out++ = static_cast<double>(v);
+      }
+    }
+    else if (field.datatype == sensor_msgs::msg::PointField::UINT32)
+    {
+      for (uint32_t col = 0; col < msg.width; ++col, p += msg.point_step)
+      {
+        uint32_t v;
+        std::memcpy(&v, p, sizeof(uint32_t));
+        *out++ = v * 1e-9;
+      }
+    }
+    else
+      out += msg.width;
+  }
+}
+
+/** Interleaves one contiguous float column into the message buffer at the
+ * given field offset (reverse of deinterleave_field_to_floats). */
+void interleave_floats(
+    const float* src, size_t n, size_t field_offset, sensor_msgs::msg::PointCloud2& msg)
+{
+  uint8_t* p = msg.data.data() + field_offset;
+  for (size_t i = 0; i < n; i++, p += msg.point_step) memcpy(p, &src[i], sizeof(float));
+}
 }  // namespace
 
 std::set<std::string> mrpt::ros2bridge::extractFields(const sensor_msgs::msg::PointCloud2& msg)
@@ -133,7 +277,16 @@ bool mrpt::ros2bridge::fromROS(const sensor_msgs::msg::PointCloud2& msg, CSimple
 
   if (incompatible || (!x_field || !y_field || !z_field)) return false;
 
-  // If not, memcpy each group of contiguous fields separately
+  // Fast path for the common all-FLOAT32 layout: size the buffers once and
+  // deinterleave in a single strided pass.
+  if (all_fields_are_float32({x_field, y_field, z_field}))
+  {
+    obj.resize(num_points);
+    deinterleave_xyz_f32(msg, *x_field, *y_field, *z_field, obj);
+    return true;
+  }
+
+  // Generic (FLOAT64 or mixed) layouts: per-point path.
   for (unsigned int row = 0; row < msg.height; ++row)
   {
     const unsigned char* row_data = &msg.data[row * msg.row_step];
@@ -173,6 +326,15 @@ bool mrpt::ros2bridge::fromROS(const sensor_msgs::msg::PointCloud2& msg, CPoints
 
   if (incompatible || (!x_field || !y_field || !z_field || !i_field)) return false;
 
+  // Fast path: deinterleave x/y/z and intensity with one strided pass each.
+  if (all_fields_are_float32({x_field, y_field, z_field}))
+  {
+    obj.resize(num_points);  // also sizes the intensity channel
+    deinterleave_xyz_f32(msg, *x_field, *y_field, *z_field, obj);
+    deinterleave_field_to_floats(*i_field, msg, obj.getPointsBufferRef_intensity()->data());
+    return true;
+  }
+
   for (unsigned int row = 0; row < msg.height; ++row)
   {
     const unsigned char* row_data = &msg.data[row * msg.row_step];
@@ -218,6 +380,42 @@ bool mrpt::ros2bridge::fromROS(const sensor_msgs::msg::PointCloud2& msg, CPoints
 
   obj.resize_XYZIRT(num_points, !!i_field, !!r_field, !!t_field);
 
+  // Fast path: per-field strided kernels writing straight into the SoA
+  // columns. Intensity/ring/time keep their own per-datatype dispatch inside
+  // the kernels, so only x/y/z need to be FLOAT32 here.
+  if (all_fields_are_float32({x_field, y_field, z_field}))
+  {
+    deinterleave_xyz_f32(msg, *x_field, *y_field, *z_field, obj);
+
+    if (i_field)
+      deinterleave_field_to_floats(*i_field, msg, obj.getPointsBufferRef_intensity()->data());
+
+    if (r_field) deinterleave_field_to_uint16(*r_field, msg, obj.getPointsBufferRef_ring()->data());
+
+    if (t_field)
+    {
+      std::vector<double> ts(num_points);
+      deinterleave_time_to_doubles(*t_field, msg, ts.data());
+
+      // If the sensor uses absolute timestamps, convert them to relative
+      // since otherwise precision is lost in the double->float conversion:
+      float* T = obj.getPointsBufferRef_timestamp()->data();
+      std::optional<double> baseTime;
+      for (size_t i = 0; i < num_points; i++)
+      {
+        const double t = ts[i];
+        if (std::abs(t) > 5.0)
+        {
+          if (!baseTime) baseTime = t;
+          T[i] = static_cast<float>(t - *baseTime);
+        }
+        else
+          T[i] = static_cast<float>(t);
+      }
+    }
+    return true;
+  }
+
   unsigned int idx = 0;
   std::optional<double> baseTimeStamp;
   for (unsigned int row = 0; row < msg.height; ++row)
@@ -450,31 +648,32 @@ bool mrpt::ros2bridge::toROS(
 
   msg.row_step = msg.width * msg.point_step;
 
-  // data:
+  // data: resize() reuses the buffer of a preallocated message, so steady
+  // state repeated calls with the same msg object allocate nothing.
   msg.data.resize(msg.row_step * msg.height);
 
   const auto& xs = obj.getPointsBufferRef_x();
   const auto& ys = obj.getPointsBufferRef_y();
   const auto& zs = obj.getPointsBufferRef_z();
-  const auto& Is = *obj.getPointsBufferRef_intensity();
-  const auto& Rs = *obj.getPointsBufferRef_ring();
-  const auto& Ts = *obj.getPointsBufferRef_timestamp();
 
-  uint8_t* pointDest = msg.data.data();
-  for (size_t i = 0; i < xs.size(); i++)
-  {
-    int f = 0;
-    memcpy(pointDest + offsets[f++], &xs[i], sizeof(float));
-    memcpy(pointDest + offsets[f++], &ys[i], sizeof(float));
-    memcpy(pointDest + offsets[f++], &zs[i], sizeof(float));
+  // One branch-free strided pass per field instead of per-point branching:
+  const size_t n = xs.size();
+  size_t f = 0;
+  interleave_floats(xs.data(), n, offsets[f++], msg);
+  interleave_floats(ys.data(), n, offsets[f++], msg);
+  interleave_floats(zs.data(), n, offsets[f++], msg);
 
-    if (obj.hasIntensityField()) memcpy(pointDest + offsets[f++], &Is[i], sizeof(float));
-
-    if (obj.hasTimeField()) memcpy(pointDest + offsets[f++], &Ts[i], sizeof(float));
+  if (obj.hasIntensityField())
+    interleave_floats(obj.getPointsBufferRef_intensity()->data(), n, offsets[f++], msg);
 
-    if (obj.hasRingField()) memcpy(pointDest + offsets[f++], &Rs[i], sizeof(uint16_t));
+  if (obj.hasTimeField())
+    interleave_floats(obj.getPointsBufferRef_timestamp()->data(), n, offsets[f++], msg);
 
-    pointDest += msg.point_step;
+  if (obj.hasRingField())
+  {
+    const uint16_t* Rs = obj.getPointsBufferRef_ring()->data();
+    uint8_t* p = msg.data.data() + offsets[f++];
+    for (size_t i = 0; i < n; i++, p += msg.point_step) memcpy(p, &Rs[i], sizeof(uint16_t));
   }
 
   return true;
@@ -102,3 +102,43 @@ TEST(PointCloud2, toROS)
     EXPECT_TRUE(pt1 == pt2);
   }
 }
+
+TEST(PointCloud2, toROSfromROS_XYZIRT)
+{
+  mrpt::maps::CPointsMapXYZIRT pc1;
+
+  const size_t num_points = 1000;
+  pc1.resize_XYZIRT(num_points, true /*I*/, true /*R*/, true /*T*/);
+
+  for (size_t i = 0; i < num_points; i++)
+  {
+    const float i_f = static_cast<float>(i);
+    pc1.setPointFast(i, i_f, -i_f, -2 * i_f);
+    pc1.setPointIntensity(i, i_f / num_points);
+    pc1.setPointRing(i, static_cast<uint16_t>(i % 16));
+    pc1.setPointTime(i, 1e-3f * i_f);
+  }
+
+  sensor_msgs::msg::PointCloud2 pc_msg;
+  std_msgs::msg::Header hdr;
+  hdr.frame_id = "map";
+  bool ok = mrpt::ros2bridge::toROS(pc1, hdr, pc_msg);
+  ASSERT_(ok);
+
+  mrpt::maps::CPointsMapXYZIRT pc2;
+  bool ok2 = mrpt::ros2bridge::fromROS(pc_msg, pc2);
+  ASSERT_(ok2);
+
+  ASSERT_EQUAL_(pc1.size(), pc2.size());
+  for (size_t i = 0; i < pc1.size(); i++)
+  {
+    mrpt::math::TPoint3D pt1, pt2;
+    pc1.getPoint(i, pt1);
+    pc2.getPoint(i, pt2);
+    EXPECT_TRUE(pt1 == pt2);
+
+    EXPECT_FLOAT_EQ(pc1.getPointIntensity(i), pc2.getPointIntensity(i));
+    EXPECT_EQ(pc1.getPointRing(i), pc2.getPointRing(i));
+    EXPECT_FLOAT_EQ(pc1.getPointTime(i), pc2.getPointTime(i));
+  }
+}
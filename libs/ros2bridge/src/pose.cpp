@@ -32,6 +32,7 @@
 #include <geometry_msgs/msg/quaternion.hpp>
 #endif
 
+#include <mrpt/core/constexpr_for.h>
 #include <mrpt/core/exceptions.h>
 #include <mrpt/math/CQuaternion.h>
 #include <mrpt/math/TPose2D.h>
@@ -44,6 +45,57 @@
 #include <mrpt/ros2bridge/pose.h>
 #include <tf2/LinearMath/Matrix3x3.h>
 
+#include <array>
+
+namespace
+{
+// Read REP103: http://ros.org/reps/rep-0103.html#covariance-representation
+// ROS stores the 6x6 covariance row-major in (x, y, z, rotation about X,
+// rotation about Y, rotation about Z) order, while MRPT uses
+// (x, y, z, yaw, pitch, roll). No Jacobian is needed (non-fixed z-y-x equals
+// fixed x-y-z rotations), only an axis reordering, so the full 36-entry
+// MRPT(row-major) -> ROS(row-major) index permutation can be baked at compile
+// time and the copy loops below become plain gather/scatter with no
+// per-element index arithmetic.
+constexpr std::array<std::size_t, 36> build_cov_idx_mrpt2ros()
+{
+  // X,Y,Z,YAW,PITCH,ROLL -> X,Y,Z,rotX,rotY,rotZ
+  constexpr std::size_t axis_map[6] = {0, 1, 2, 5, 4, 3};
+  std::array<std::size_t, 36> tbl{};
+  for (std::size_t i = 0; i < 6; i++)
+    for (std::size_t j = 0; j < 6; j++) tbl[i * 6 + j] = axis_map[i] * 6 + axis_map[j];
+  return tbl;
+}
+constexpr auto cov_idx_mrpt2ros = build_cov_idx_mrpt2ros();
+
+template <class ROSCOV>
+void cov_mrpt_to_ros(const mrpt::math::CMatrixDouble66& cov, ROSCOV& des)
+{
+  mrpt::for_<36>([&](auto i) { des[cov_idx_mrpt2ros[i.value]] = cov(i.value / 6, i.value % 6); });
+}
+
+template <class ROSCOV>
+void cov_ros_to_mrpt(const ROSCOV& src, mrpt::math::CMatrixDouble66& cov)
+{
+  mrpt::for_<36>([&](auto i) { cov(i.value / 6, i.value % 6) = src[cov_idx_mrpt2ros[i.value]]; });
+}
+
+// SE(2) covariances only fill the (x,y,rotZ) entries of the REP-103 matrix:
+template <class ROSCOV>
+void cov2d_mrpt_to_ros(const mrpt::math::CMatrixDouble33& cov, ROSCOV& des)
+{
+  des[0] = cov(0, 0);
+  des[1] = cov(0, 1);
+  des[5] = cov(0, 2);
+  des[6] = cov(1, 0);
+  des[7] = cov(1, 1);
+  des[11] = cov(1, 2);
+  des[30] = cov(2, 0);
+  des[31] = cov(2, 1);
+  des[35] = cov(2, 2);
+}
+}  // namespace
+
 // MRPT -> ROS functions:
 tf2::Matrix3x3 mrpt::ros2bridge::toROS(const mrpt::math::CMatrixDouble33& src)
 {
@@ -151,18 +203,17 @@ geometry_msgs::msg::PoseWithCovariance mrpt::ros2bridge::toROS_Pose(
   //           JL ==> Nope! non-fixed z-y-x equals fixed x-y-z rotations.
 
   // X,Y,Z,YAW,PITCH,ROLL
-  const unsigned int indxs_map[6] = {0, 1, 2, 5, 4, 3};
-  for (int i = 0; i < 6; i++)
-    for (int j = 0; j < 6; j++) des.covariance[indxs_map[i] * 6 + indxs_map[j]] = src.cov(i, j);
+  cov_mrpt_to_ros(src.cov, des.covariance);
   return des;
 }
 
 geometry_msgs::msg::PoseWithCovariance mrpt::ros2bridge::toROS(
     const mrpt::poses::CPose3DPDFGaussianInf& src)
 {
-  mrpt::poses::CPose3DPDFGaussian src2;
-  src2.copyFrom(src);
-  return toROS_Pose(src2);
+  geometry_msgs::msg::PoseWithCovariance des;
+  des.pose = toROS_Pose(src.mean);
+  cov_mrpt_to_ros(src.cov_inv.inverse_LLt(), des.covariance);
+  return des;
 }
 
 geometry_msgs::msg::PoseWithCovariance mrpt::ros2bridge::toROS(
@@ -187,15 +238,7 @@ geometry_msgs::msg::PoseWithCovariance mrpt::ros2bridge::toROS(
   // [ 24  25  26  27  28  29 ]
   // [ 30  31  32  33  34  35 ]
 
-  des.covariance[0] = src.cov(0, 0);
-  des.covariance[1] = src.cov(0, 1);
-  des.covariance[5] = src.cov(0, 2);
-  des.covariance[6] = src.cov(1, 0);
-  des.covariance[7] = src.cov(1, 1);
-  des.covariance[11] = src.cov(1, 2);
-  des.covariance[30] = src.cov(2, 0);
-  des.covariance[31] = src.cov(2, 1);
-  des.covariance[35] = src.cov(2, 2);
+  cov2d_mrpt_to_ros(src.cov, des.covariance);
 
   return des;
 }
@@ -203,10 +246,10 @@ geometry_msgs::msg::PoseWithCovariance mrpt::ros2bridge::toROS(
 geometry_msgs::msg::PoseWithCovariance mrpt::ros2bridge::toROS(
     const mrpt::poses::CPosePDFGaussianInf& src)
 {
-  mrpt::poses::CPosePDFGaussian src2;
-  src2.copyFrom(src);
-
-  return toROS(src2);
+  geometry_msgs::msg::PoseWithCovariance des;
+  des.pose = toROS_Pose(src.mean);
+  cov2d_mrpt_to_ros(src.cov_inv.inverse_LLt(), des.covariance);
+  return des;
 }
 
 geometry_msgs::msg::Quaternion mrpt::ros2bridge::toROS(const mrpt::math::CQuaternionDouble& src)
@@ -252,14 +295,51 @@ mrpt::poses::CPose3DPDFGaussian mrpt::ros2bridge::fromROS(
 
   des.mean = fromROS(src.pose);
 
-  const unsigned int indxs_map[6] = {0, 1, 2, 5, 4, 3};
-
-  for (int i = 0; i < 6; i++)
-    for (int j = 0; j < 6; j++) des.cov(i, j) = src.covariance[indxs_map[i] * 6 + indxs_map[j]];
+  cov_ros_to_mrpt(src.covariance, des.cov);
 
   return des;
 }
 
+// Batch versions: output vectors are resized once, then each element is
+// converted in place, so no per-pose message/PDF temporaries are created.
+void mrpt::ros2bridge::toROS_Pose(
+    const std::vector<mrpt::poses::CPose3D>& src, std::vector<geometry_msgs::msg::Pose>& des)
+{
+  des.resize(src.size());
+  for (size_t i = 0; i < src.size(); i++) des[i] = toROS_Pose(src[i]);
+}
+
+void mrpt::ros2bridge::toROS_Pose(
+    const std::vector<mrpt::poses::CPose3DPDFGaussian>& src,
+    std::vector<geometry_msgs::msg::PoseWithCovariance>& des)
+{
+  des.resize(src.size());
+  for (size_t i = 0; i < src.size(); i++)
+  {
+    des[i].pose = toROS_Pose(src[i].mean);
+    cov_mrpt_to_ros(src[i].cov, des[i].covariance);
+  }
+}
+
+void mrpt::ros2bridge::fromROS(
+    const std::vector<geometry_msgs::msg::Pose>& src, std::vector<mrpt::poses::CPose3D>& des)
+{
+  des.resize(src.size());
+  for (size_t i = 0; i < src.size(); i++) des[i] = fromROS(src[i]);
+}
+
+void mrpt::ros2bridge::fromROS(
+    const std::vector<geometry_msgs::msg::PoseWithCovariance>& src,
+    std::vector<mrpt::poses::CPose3DPDFGaussian>& des)
+{
+  des.resize(src.size());
+  for (size_t i = 0; i < src.size(); i++)
+  {
+    des[i].mean = fromROS(src[i].pose);
+    cov_ros_to_mrpt(src[i].covariance, des[i].cov);
+  }
+}
+
 mrpt::math::CQuaternionDouble mrpt::ros2bridge::fromROS(const geometry_msgs::msg::Quaternion& src)
 {
   mrpt::math::CQuaternionDouble des;
@@ -159,3 +159,39 @@ TEST(PoseConversions, check_CPose2D_to_ROS)
       << "p3D_ros: " << p3D_ros << endl
       << "p3D: " << p3D << endl;
 }
+
+// Declare a test
+TEST(PoseConversions, batch_pose_with_covariance_roundtrip)
+{
+  using mrpt::poses::CPose3D;
+  using mrpt::poses::CPose3DPDFGaussian;
+
+  std::vector<CPose3DPDFGaussian> pdfs(5);
+  for (size_t k = 0; k < pdfs.size(); k++)
+  {
+    pdfs[k].mean = CPose3D(0.1 * k, -0.2 * k, 0.3 * k, 0.1 * k, -0.05 * k, 0.02 * k);
+    for (int i = 0; i < 6; i++)
+      for (int j = 0; j < 6; j++) pdfs[k].cov(i, j) = (i == j) ? (1.0 + i + k) : 0.1 * (i + j);
+  }
+
+  // Batch MRPT->ROS->MRPT:
+  std::vector<geometry_msgs::msg::PoseWithCovariance> msgs;
+  mrpt::ros2bridge::toROS_Pose(pdfs, msgs);
+  ASSERT_EQUAL_(msgs.size(), pdfs.size());
+
+  std::vector<CPose3DPDFGaussian> pdfs2;
+  mrpt::ros2bridge::fromROS(msgs, pdfs2);
+  ASSERT_EQUAL_(pdfs2.size(), pdfs.size());
+
+  for (size_t k = 0; k < pdfs.size(); k++)
+  {
+    // Each batch element must match its scalar conversion counterpart:
+    const auto msg_scalar = mrpt::ros2bridge::toROS_Pose(pdfs[k]);
+    for (int i = 0; i < 36; i++) EXPECT_DOUBLE_EQ(msgs[k].covariance[i], msg_scalar.covariance[i]);
+
+    EXPECT_NEAR(
+        (pdfs2[k].mean.asVectorVal() - pdfs[k].mean.asVectorVal()).array().abs().maxCoeff(), 0,
+        1e-4);
+    EXPECT_NEAR((pdfs2[k].cov - pdfs[k].cov).asEigen().array().abs().maxCoeff(), 0, 1e-9);
+  }
+}
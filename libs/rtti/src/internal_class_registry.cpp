@@ -12,9 +12,12 @@
 #include <mrpt/rtti/CObject.h>
 
 #include <cstdarg>
+#include <cstdint>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <shared_mutex>
+#include <vector>
 
 #include "internal_class_registry.h"
 
@@ -44,6 +47,63 @@ namespace mrpt::rtti
 {
 using TClassnameToRuntimeId = std::map<std::string, const TRuntimeClassId*>;
 
+/** An immutable open-addressing hash table over the registered classes,
+ * published atomically as a whole: since the registry is effectively
+ * write-once after registerAllClasses(), lookups can then proceed without
+ * taking any lock. Rebuilt (cheaply, registration is a startup-time event)
+ * on each Add().
+ */
+struct RegistrySnapshot
+{
+  struct Entry
+  {
+    std::string name;
+    const TRuntimeClassId* id = nullptr;
+  };
+
+  std::vector<Entry> nsTable, noNsTable;
+  size_t nsMask = 0, noNsMask = 0;
+
+  /// FNV-1a, 64 bit
+  static uint64_t hash(const std::string& s)
+  {
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (const char c : s)
+    {
+      h ^= static_cast<uint8_t>(c);
+      h *= 0x100000001b3ULL;
+    }
+    return h;
+  }
+
+  /// Fills in `tbl` as a linear-probing table with load factor <= 0.5
+  static void build(const TClassnameToRuntimeId& m, std::vector<Entry>& tbl, size_t& mask)
+  {
+    size_t cap = 16;
+    while (cap < 2 * m.size()) cap <<= 1;
+    tbl.assign(cap, {});
+    mask = cap - 1;
+    for (const auto& kv : m)
+    {
+      size_t i = hash(kv.first) & mask;
+      while (tbl[i].id) i = (i + 1) & mask;
+      tbl[i].name = kv.first;
+      tbl[i].id = kv.second;
+    }
+  }
+
+  static const TRuntimeClassId* find(
+      const std::vector<Entry>& tbl, const size_t mask, const std::string& name)
+  {
+    for (size_t i = hash(name) & mask;; i = (i + 1) & mask)
+    {
+      const Entry& e = tbl[i];
+      if (!e.id) return nullptr;
+      if (e.name == name) return e.id;
+    }
+  }
+};
+
 /** A singleton with the central registry for CSerializable run-time classes:
  * users do not use this class in any direct way.
  * \note Class is thread-safe.
@@ -80,29 +140,31 @@ class CClassRegistry
 
     // Also register without NS (backwards compatible datasets):
     m_no_ns_classes[stripNamespace(className)] = &id;
+
+    // Publish a fresh lock-free snapshot for readers:
+    auto snap = std::make_shared<RegistrySnapshot>();
+    RegistrySnapshot::build(m_ns_classes, snap->nsTable, snap->nsMask);
+    RegistrySnapshot::build(m_no_ns_classes, snap->noNsTable, snap->noNsMask);
+    std::atomic_store_explicit(
+        &m_snapshot, std::shared_ptr<const RegistrySnapshot>(std::move(snap)),
+        std::memory_order_release);
   }
 
   const TRuntimeClassId* Get(const std::string& className, const bool allow_ignore_namespace)
   {
-    std::shared_lock<std::shared_mutex> lk(m_mtx);
-    const TRuntimeClassId* ret = nullptr;
-    const auto itEntry = m_ns_classes.find(className);
-    if (itEntry != m_ns_classes.end())
-    {
-      // found:
-      ret = itEntry->second;
-    }
-    else if (allow_ignore_namespace)
+    // Lock-free read path: grab the latest published snapshot.
+    const auto snap = std::atomic_load_explicit(&m_snapshot, std::memory_order_acquire);
+    if (!snap) return nullptr;
+
+    if (const auto* ret = RegistrySnapshot::find(snap->nsTable, snap->nsMask, className); ret)
+      return ret;
+
+    if (allow_ignore_namespace)
     {
       // 2nd attempt: search for class name only:
-      const auto itEntry2 = m_no_ns_classes.find(stripNamespace(className));
-      if (itEntry2 != m_no_ns_classes.end())
-      {
-        // found:
-        ret = itEntry2->second;
-      }
+      return RegistrySnapshot::find(snap->noNsTable, snap->noNsMask, stripNamespace(className));
     }
-    return ret;
+    return nullptr;
   }
 
   std::vector<const TRuntimeClassId*> getListOfAllRegisteredClasses()
@@ -134,6 +196,9 @@ class CClassRegistry
   // The auxiliary copy of "m_ns_classes", w/o namespace prefixes:
   TClassnameToRuntimeId m_no_ns_classes;
 
+  // Read-only view of the maps above, swapped atomically on each Add():
+  std::shared_ptr<const RegistrySnapshot> m_snapshot;
+
   std::shared_mutex m_mtx;
 };
 
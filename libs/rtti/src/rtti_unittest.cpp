@@ -80,6 +80,29 @@ TEST(rtti, Factory)
   }
 }
 
+TEST(rtti, FindRegisteredClass)
+{
+  do_register();
+
+  // Fully-qualified name:
+  const auto* id = mrpt::rtti::findRegisteredClass("MyNS::MyDerived1");
+  ASSERT_TRUE(id != nullptr);
+  EXPECT_EQ(std::string(id->className), "MyNS::MyDerived1");
+
+  // Without namespace (backwards-compatible datasets):
+  EXPECT_EQ(mrpt::rtti::findRegisteredClass("MyDerived1"), id);
+
+  // allow_ignore_namespace=false must not strip the namespace:
+  EXPECT_TRUE(mrpt::rtti::findRegisteredClass("MyDerived1", false) == nullptr);
+
+  // Unknown classes:
+  EXPECT_TRUE(mrpt::rtti::findRegisteredClass("NoSuchClassAnywhere") == nullptr);
+
+  // Lookups must keep working as more classes are registered (the lock-free
+  // snapshot is rebuilt on each registration):
+  EXPECT_EQ(mrpt::rtti::findRegisteredClass("MyNS::MyDerived1"), id);
+}
+
 TEST(rtti, CreateSmartPointerTypes)
 {
   using T = MyNS::MyDerived1;
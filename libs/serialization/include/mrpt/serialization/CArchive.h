@@ -18,6 +18,7 @@
 
 #include <cstdint>
 #include <cstring>  // memcpy
+#include <map>
 #include <stdexcept>
 #include <string>
 #include <type_traits>  // remove_reference_t, is_polymorphic
@@ -33,6 +34,7 @@
 namespace mrpt::serialization
 {
 class CMessage;
+class CObjectPool;
 
 /** Used in mrpt::serialization::CArchive */
 class CExceptionEOF : public std::runtime_error
@@ -106,6 +108,60 @@ class CArchive
 #endif
   }
 
+  /** Attempts a zero-copy read: if the underlying storage of the archive is
+   * directly addressable (e.g. a CMemoryStream, or a memory-mapped file),
+   * returns a read-only pointer to the next Count bytes in place, advancing
+   * the read cursor past them, so they can be used without copying them out
+   * of the stream.
+   * Returns nullptr, leaving the read cursor untouched, if the archive does
+   * not support borrowing, fewer than Count bytes remain, or the data does
+   * not satisfy the given Alignment (in bytes); callers must then fall back
+   * to a copying read with ReadBuffer().
+   * The returned pointer is only valid while the underlying storage is: do
+   * not keep it beyond the life of the stream or of its mapped buffer.
+   * \note [New in MRPT 2.14.5]
+   * \sa ReadBufferBorrowFixEndianness, ReadBuffer
+   */
+  const uint8_t* ReadBufferBorrow(size_t Count, size_t Alignment = 1)
+  {
+    return borrowRead(Count, Alignment);
+  }
+
+  /** Typed version of ReadBufferBorrow() for arrays of elemental datatypes:
+   * tries to borrow ElementCount elements of type T, already stored in the
+   * format of the running architecture, or returns nullptr if borrowing is
+   * not possible, in which case fall back to ReadBufferFixEndianness().
+   * On big endian architectures this always returns nullptr, since the
+   * borrowed bytes cannot be reordered in place.
+   *  Example of usage:
+   *  \code
+   *   uint32_t  N;
+   *   s >> N;
+   *   vector<float>  vec;
+   *   if (const float* p = s.ReadBufferBorrowFixEndianness<float>(N); p)
+   *     vec.assign(p, p + N);
+   *   else
+   *   {
+   *     vec.resize(N);
+   *     if (N) s.ReadBufferFixEndianness<float>(&vec[0], N);
+   *   }
+   *  \endcode
+   * \note [New in MRPT 2.14.5]
+   * \sa ReadBufferBorrow, ReadBufferFixEndianness
+   */
+  template <typename T>
+  const T* ReadBufferBorrowFixEndianness([[maybe_unused]] size_t ElementCount)
+  {
+#if !MRPT_IS_BIG_ENDIAN
+    // little endian: borrowed data can be aliased as-is.
+    return reinterpret_cast<const T*>(borrowRead(ElementCount * sizeof(T), alignof(T)));
+#else
+    // big endian: the bytes would need reordering, which cannot be done
+    // in place on a borrowed (read-only) buffer.
+    return nullptr;
+#endif
+  }
+
   /** Writes a block of bytes to the stream from Buffer.
    *	\exception std::exception On any error
    *  \sa Important, see: WriteBufferFixEndianness
@@ -199,11 +255,11 @@ class CArchive
     internal_ReadObjectHeader(strClassName, isOldFormat, version);
     if (strClassName != "nullptr")
     {
-      const mrpt::rtti::TRuntimeClassId* classId = mrpt::rtti::findRegisteredClass(strClassName);
+      const mrpt::rtti::TRuntimeClassId* classId = lookupClassId(strClassName);
       if (!classId)
         THROW_EXCEPTION_FMT(
             "Stored object has class '%s' which is not registered!", strClassName.c_str());
-      obj = mrpt::ptr_cast<CSerializable>::from(classId->createObject());
+      obj = mrpt::ptr_cast<CSerializable>::from(createOrRecycleObject(classId));
     }
     internal_ReadObject(
         obj.get() /* may be nullptr */, strClassName, isOldFormat,
@@ -222,6 +278,19 @@ class CArchive
    * description of the underlying stream (e.g. filename) */
   virtual std::string getArchiveDescription() const { return "generic CArchive"; }
 
+  /** Attaches an object recycling pool, used by ReadObject() & ReadVariant()
+   * to reuse instances previously given back to the pool instead of
+   * allocating fresh ones, cutting the malloc traffic of deserialization.
+   * The pool is borrowed, not owned: it must outlive this archive.
+   * Pass nullptr to detach (the default state).
+   * \note [New in MRPT 2.14.5]
+   * \sa CObjectPool
+   */
+  void setObjectPool(CObjectPool* pool) { m_objectPool = pool; }
+  /** The attached object recycling pool, or nullptr (default) if none.
+   * \sa setObjectPool */
+  CObjectPool* objectPool() const { return m_objectPool; }
+
  private:
   template <typename RET>
   RET ReadVariant_helper(CSerializable::Ptr& ptr)
@@ -268,13 +337,13 @@ class CArchive
     int8_t version;
     internal_ReadObjectHeader(strClassName, isOldFormat, version);
     if (strClassName == "std::monostate") return {};
-    const mrpt::rtti::TRuntimeClassId* classId = mrpt::rtti::findRegisteredClass(strClassName);
+    const mrpt::rtti::TRuntimeClassId* classId = lookupClassId(strClassName);
     if (!classId)
       THROW_EXCEPTION_FMT(
           "Stored object has class '%s' which is not registered!", strClassName.c_str());
     if (strClassName != "nullptr")
     {
-      obj = mrpt::ptr_cast<CSerializable>::from(classId->createObject());
+      obj = mrpt::ptr_cast<CSerializable>::from(createOrRecycleObject(classId));
     }
     internal_ReadObject(obj.get(), strClassName, isOldFormat, version);
     if (!obj)
@@ -384,6 +453,15 @@ class CArchive
    * \return Number of bytes actually read if >0.
    */
   virtual size_t read(void* buf, size_t len) = 0;
+  /** Tries to get direct read-only access to the next block of bytes, see
+   * ReadBufferBorrow(). The default implementation returns nullptr
+   * ("borrowing not supported"), so archives over non-addressable storage
+   * need not implement it.
+   */
+  virtual const uint8_t* borrowRead([[maybe_unused]] size_t len, [[maybe_unused]] size_t alignment)
+  {
+    return nullptr;
+  }
   /** @} */
 
   /** Read the object */
@@ -392,6 +470,29 @@ class CArchive
 
   /** Read the object Header*/
   void internal_ReadObjectHeader(std::string& className, bool& isOldFormat, int8_t& version);
+
+  /** Returns an instance from the attached object pool if possible, or a
+   * freshly created one. */
+  std::shared_ptr<mrpt::rtti::CObject> createOrRecycleObject(
+      const mrpt::rtti::TRuntimeClassId* classId);
+
+  /** As mrpt::rtti::findRegisteredClass(), but memoized per archive:
+   * repeated objects of one type resolve their class name against the
+   * global registry only once per stream. */
+  const mrpt::rtti::TRuntimeClassId* lookupClassId(const std::string& strClassName)
+  {
+    if (auto it = m_readClassIdCache.find(strClassName); it != m_readClassIdCache.end())
+      return it->second;
+    const auto* id = mrpt::rtti::findRegisteredClass(strClassName);
+    if (id) m_readClassIdCache[strClassName] = id;
+    return id;
+  }
+
+  /** Optional object recycling pool (borrowed), see setObjectPool(). */
+  CObjectPool* m_objectPool = nullptr;
+
+  /** Memoized classname -> class ID resolutions, see lookupClassId(). */
+  std::map<std::string, const mrpt::rtti::TRuntimeClassId*> m_readClassIdCache;
 };
 
 // Note: write op accepts parameters by value on purpose, to avoid misaligned
@@ -602,15 +703,72 @@ template <class STREAM>
 class CArchiveStreamBase : public CArchive
 {
   STREAM& m_s;
+  /** Write-combining buffer; empty (the default) = unbuffered writes. */
+  std::vector<uint8_t> m_wrBuf;
+  size_t m_wrBufUsed = 0;
 
  public:
-  CArchiveStreamBase(STREAM& s) : m_s(s) {}
+  /** \param write_buffer_size If non-zero, writes are combined into an
+   * internal buffer of this size and handed to the underlying stream in
+   * large blocks, so serializing an object made of many small fields issues
+   * one Write() (i.e. typically one syscall) instead of one per field.
+   * Do not interleave direct writes to the stream with archive writes while
+   * buffering is on, or call flushWriteBuffer() in between.
+   * \note [New in MRPT 2.14.5] */
+  CArchiveStreamBase(STREAM& s, size_t write_buffer_size = 0) : m_s(s)
+  {
+    m_wrBuf.resize(write_buffer_size);
+  }
+  ~CArchiveStreamBase() override
+  {
+    try
+    {
+      flushWriteBuffer();
+    }
+    catch (...)
+    {
+    }
+  }
+
+  /** Hands any pending write-combined bytes to the underlying stream.
+   * \note [New in MRPT 2.14.5] */
+  void flushWriteBuffer()
+  {
+    if (!m_wrBufUsed) return;
+    const size_t toWrite = m_wrBufUsed;
+    m_wrBufUsed = 0;
+    if (m_s.Write(m_wrBuf.data(), toWrite) != toWrite)
+      THROW_EXCEPTION("flushWriteBuffer(): short write in underlying stream");
+  }
 
   std::string getArchiveDescription() const override { return m_s.getStreamDescription(); }
 
  protected:
-  size_t write(const void* d, size_t n) override { return m_s.Write(d, n); }
-  size_t read(void* d, size_t n) override { return m_s.Read(d, n); }
+  size_t write(const void* d, size_t n) override
+  {
+    if (m_wrBuf.empty()) return m_s.Write(d, n);
+    // Blocks larger than the buffer go straight through:
+    if (n >= m_wrBuf.size())
+    {
+      flushWriteBuffer();
+      return m_s.Write(d, n);
+    }
+    if (m_wrBufUsed + n > m_wrBuf.size()) flushWriteBuffer();
+    std::memcpy(m_wrBuf.data() + m_wrBufUsed, d, n);
+    m_wrBufUsed += n;
+    return n;
+  }
+  size_t read(void* d, size_t n) override
+  {
+    // Keep read-after-write coherent on read/write streams:
+    flushWriteBuffer();
+    return m_s.Read(d, n);
+  }
+  const uint8_t* borrowRead(size_t n, size_t alignment) override
+  {
+    flushWriteBuffer();
+    return m_s.borrowReadBuffer(n, alignment);
+  }
 };
 
 /** Helper function to create a templatized wrapper CArchive object for a:
@@ -0,0 +1,78 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+#pragma once
+
+#include <mrpt/rtti/CObject.h>
+
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace mrpt::serialization
+{
+/** A bounded, thread-safe recycling pool for deserialized objects, keyed by
+ * their runtime class.
+ *
+ * Deserializing a rawlog entry allocates dozens of small blocks through the
+ * global allocator: the observation object itself plus its internal vectors,
+ * matrices and strings. When an application is done with an object it can
+ * recycle() it here instead of letting it die; a CArchive with this pool
+ * attached (see CArchive::setObjectPool()) will then hand the instance back
+ * from ReadObject() for the next entry of the same class, and deserializing
+ * *into* it reuses the capacity of its internal buffers, so steady-state
+ * playback performs almost no heap allocation.
+ *
+ * Reading into a recycled instance is exactly the in-place
+ * `CArchive::ReadObject(CSerializable*)` path that every serializable class
+ * already supports, so no per-class work is needed.
+ *
+ * recycle() is O(1), and the memory of a recycled object is reused rather
+ * than returned to the allocator, so dropping a whole processing window of
+ * sensory frames into the pool is cheap. The pool keeps at most
+ * `maxObjectsPerClass` instances per class; excess objects are freed
+ * normally.
+ *
+ * \note The pool holds plain object instances, not an arena backing their
+ * internal containers: MRPT containers are not allocator-parameterized, so
+ * capacity reuse via recycling is the supported way to avoid their
+ * allocations.
+ *
+ * \sa CArchive::setObjectPool, mrpt::system::CGenericMemoryPool
+ * \ingroup mrpt_serialization_grp
+ */
+class CObjectPool
+{
+ public:
+  explicit CObjectPool(size_t maxObjectsPerClass = 100) : m_maxObjectsPerClass(maxObjectsPerClass)
+  {
+  }
+
+  /** Takes a previously recycled instance of the given class out of the
+   * pool, or returns nullptr if none is available (then create a fresh one).
+   */
+  mrpt::rtti::CObject::Ptr acquire(const mrpt::rtti::TRuntimeClassId* classId);
+
+  /** Donates an object to the pool for later reuse. Only objects with no
+   * other owners (use_count()==1) are stored; otherwise, or if the per-class
+   * limit has been reached, the object is simply released. */
+  void recycle(mrpt::rtti::CObject::Ptr&& obj);
+
+  /** Total number of objects currently stored, over all classes. */
+  size_t size() const;
+
+  /** Frees all stored objects. */
+  void clear();
+
+ private:
+  mutable std::mutex m_mtx;
+  size_t m_maxObjectsPerClass;
+  std::map<const mrpt::rtti::TRuntimeClassId*, std::vector<mrpt::rtti::CObject::Ptr>> m_pool;
+};  // End of class def.
+
+}  // namespace mrpt::serialization
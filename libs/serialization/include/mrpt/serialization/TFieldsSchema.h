@@ -0,0 +1,138 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+#pragma once
+
+#include <mrpt/serialization/CArchive.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace mrpt::serialization
+{
+/** Describes the in-memory layout of the POD fields of a fixed-layout type,
+ * so whole runs of consecutive fields can be (de)serialized with a few large
+ * buffer operations instead of one virtual stream call per field.
+ *
+ * The stream format is byte-identical to writing the fields one by one with
+ * `operator<<` in the same order, so a type can switch the serializeTo() /
+ * serializeFrom() code of its **current** version to a schema while keeping
+ * the field-by-field path for legacy stream versions.
+ *
+ * Build the schema once (e.g. as a function-local static) from any instance
+ * of the type, used only to capture the field offsets:
+ *
+ *  \code
+ *  static const auto schema = [] {
+ *    MyType p;
+ *    mrpt::serialization::TFieldsSchema<MyType> s;
+ *    s.add(p, p.x).add(p, p.y).add(p, p.count);
+ *    return s;
+ *  }();
+ *  // In serializeTo():    schema.writeTo(out, *this);
+ *  // In serializeFrom():  schema.readFrom(in, *this);
+ *  \endcode
+ *
+ *  On little-endian builds, fields that are adjacent both in the stream and
+ *  in memory are merged into single buffer operations; on big-endian builds
+ *  each field is written individually with its bytes reversed, preserving
+ *  the (little-endian) MRPT stream standard.
+ *
+ * \note [New in MRPT 2.14.5]
+ * \sa CArchive, CSerializable
+ * \ingroup mrpt_serialization_grp
+ */
+template <typename Struct>
+class TFieldsSchema
+{
+ public:
+  TFieldsSchema() = default;
+
+  /** Appends one field to the schema. `prototype` can be any instance of
+   * the type: it is used only to capture the offset of `field` within it.
+   * Returns `*this` to allow chaining. */
+  template <typename FIELD>
+  TFieldsSchema& add(const Struct& prototype, const FIELD& field)
+  {
+    static_assert(
+        std::is_trivially_copyable_v<FIELD>, "Schema fields must be trivially copyable");
+    static_assert(
+        sizeof(FIELD) == 1 || sizeof(FIELD) == 2 || sizeof(FIELD) == 4 || sizeof(FIELD) == 8,
+        "Schema fields must be elemental (1,2,4, or 8 bytes) for endianness "
+        "translation; register arrays/structs element by element");
+
+    const auto off =
+        reinterpret_cast<const char*>(&field) - reinterpret_cast<const char*>(&prototype);
+    ASSERT_(off >= 0 && static_cast<size_t>(off) + sizeof(FIELD) <= sizeof(Struct));
+
+    m_fields.push_back({static_cast<size_t>(off), sizeof(FIELD)});
+
+    // Merge with the former field if adjacent both in the stream (by
+    // construction) and in memory:
+    if (!m_spans.empty() && m_spans.back().offset + m_spans.back().length == static_cast<size_t>(off))
+      m_spans.back().length += sizeof(FIELD);
+    else
+      m_spans.push_back({static_cast<size_t>(off), sizeof(FIELD)});
+
+    m_streamLength += sizeof(FIELD);
+    return *this;
+  }
+
+  /** Writes all registered fields of `obj`, in registration order. */
+  void writeTo(CArchive& out, const Struct& obj) const
+  {
+    const auto* base = reinterpret_cast<const uint8_t*>(&obj);
+#if !MRPT_IS_BIG_ENDIAN
+    for (const auto& s : m_spans) out.WriteBuffer(base + s.offset, s.length);
+#else
+    for (const auto& f : m_fields)
+    {
+      uint8_t tmp[8];
+      for (size_t i = 0; i < f.length; i++) tmp[i] = base[f.offset + f.length - 1 - i];
+      out.WriteBuffer(tmp, f.length);
+    }
+#endif
+  }
+
+  /** Reads all registered fields into `obj`, in registration order. */
+  void readFrom(CArchive& in, Struct& obj) const
+  {
+    auto* base = reinterpret_cast<uint8_t*>(&obj);
+#if !MRPT_IS_BIG_ENDIAN
+    for (const auto& s : m_spans) in.ReadBuffer(base + s.offset, s.length);
+#else
+    for (const auto& f : m_fields)
+    {
+      uint8_t tmp[8];
+      in.ReadBuffer(tmp, f.length);
+      for (size_t i = 0; i < f.length; i++) base[f.offset + i] = tmp[f.length - 1 - i];
+    }
+#endif
+  }
+
+  /** Number of registered fields. */
+  size_t numFields() const { return m_fields.size(); }
+  /** Number of merged contiguous runs, i.e. of I/O operations per object on
+   * little-endian builds. */
+  size_t numSpans() const { return m_spans.size(); }
+  /** Total number of bytes this schema reads/writes per object. */
+  size_t streamLength() const { return m_streamLength; }
+
+ private:
+  struct FieldEntry
+  {
+    size_t offset = 0, length = 0;
+  };
+  std::vector<FieldEntry> m_fields;  //!< One entry per field, stream order
+  std::vector<FieldEntry> m_spans;   //!< Fields merged into contiguous runs
+  size_t m_streamLength = 0;
+};
+
+}  // namespace mrpt::serialization
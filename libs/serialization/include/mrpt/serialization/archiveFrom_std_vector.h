@@ -47,6 +47,15 @@ class CArchiveStreamBase<std::vector<uint8_t>> : public CArchive
     m_pos_read += n;
     return n;
   };
+  const uint8_t* borrowRead(size_t n, size_t alignment) override
+  {
+    const int avail = static_cast<int>(m_v.size()) - m_pos_read;
+    if (avail < static_cast<int>(n)) return nullptr;
+    const uint8_t* ptr = &m_v[m_pos_read];
+    if (alignment > 1 && (reinterpret_cast<uintptr_t>(ptr) % alignment) != 0) return nullptr;
+    m_pos_read += n;
+    return ptr;
+  }
 };
 /** Read-only version of the wrapper. See archiveFrom() */
 template <>
@@ -72,5 +81,14 @@ class CArchiveStreamBase<const std::vector<uint8_t>> : public CArchive
     m_pos_read += n;
     return n;
   };
+  const uint8_t* borrowRead(size_t n, size_t alignment) override
+  {
+    const int avail = static_cast<int>(m_v.size()) - m_pos_read;
+    if (avail < static_cast<int>(n)) return nullptr;
+    const uint8_t* ptr = &m_v[m_pos_read];
+    if (alignment > 1 && (reinterpret_cast<uintptr_t>(ptr) % alignment) != 0) return nullptr;
+    m_pos_read += n;
+    return ptr;
+  }
 };
 }  // namespace mrpt::serialization
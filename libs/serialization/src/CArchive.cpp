@@ -13,6 +13,7 @@
 #include <mrpt/core/exceptions.h>
 #include <mrpt/serialization/CArchive.h>
 #include <mrpt/serialization/CMessage.h>
+#include <mrpt/serialization/CObjectPool.h>
 #include <mrpt/serialization/CSerializable.h>
 #include <mrpt/serialization/aligned_serialization.h>
 
@@ -168,6 +169,14 @@ CArchive& CArchive::operator>>(CSerializable& obj)
   return *this;
 }
 
+std::shared_ptr<mrpt::rtti::CObject> CArchive::createOrRecycleObject(
+    const mrpt::rtti::TRuntimeClassId* classId)
+{
+  if (m_objectPool)
+    if (auto obj = m_objectPool->acquire(classId); obj) return obj;
+  return classId->createObject();
+}
+
 namespace mrpt
 {
 namespace serialization
@@ -189,6 +198,14 @@ inline CArchive& readStdVectorToStream(CArchive& s, VEC& v)
 {
   uint32_t n;
   s >> n;
+  using T = typename VEC::value_type;
+  if (const T* p = n ? s.ReadBufferBorrowFixEndianness<T>(n) : nullptr; p)
+  {
+    // Borrowed (zero-copy) read from memory-backed archives: a single
+    // copy into the vector, with no zero-initialization pass.
+    v.assign(p, p + n);
+    return s;
+  }
   v.resize(n);
   if (n) s.ReadBufferFixEndianness(&v[0], n);
   return s;
@@ -472,7 +489,7 @@ void CArchive::ReadObject(CSerializable* existingObj)
   ASSERT_(strClassName != "nullptr");
 
   const TRuntimeClassId* id = existingObj->GetRuntimeClass();
-  const TRuntimeClassId* id2 = mrpt::rtti::findRegisteredClass(strClassName);
+  const TRuntimeClassId* id2 = lookupClassId(strClassName);
 
   if (!id2)
     THROW_EXCEPTION_FMT(
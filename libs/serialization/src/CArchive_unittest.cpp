@@ -0,0 +1,116 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/io/CMemoryStream.h>
+#include <mrpt/serialization/CArchive.h>
+#include <mrpt/serialization/archiveFrom_std_vector.h>
+
+using namespace mrpt::serialization;
+
+TEST(CArchive, ReadBufferBorrow)
+{
+  mrpt::io::CMemoryStream f;
+  auto arch = mrpt::serialization::archiveFrom(f);
+  arch << std::string("0123456789");
+
+  f.Seek(0);
+  uint32_t n;
+  arch >> n;
+  EXPECT_EQ(n, 10U);
+
+  // Borrowed reads alias the stream's own buffer:
+  const uint8_t* p = arch.ReadBufferBorrow(4);
+  ASSERT_TRUE(p != nullptr);
+  EXPECT_EQ(p[0], '0');
+  EXPECT_EQ(p[3], '3');
+
+  // ...and can be freely mixed with regular copying reads:
+  char buf[6];
+  EXPECT_EQ(arch.ReadBuffer(buf, 6), 6U);
+  EXPECT_EQ(buf[0], '4');
+  EXPECT_EQ(buf[5], '9');
+
+  // Past the end of the stream => nullptr (no exception):
+  EXPECT_TRUE(arch.ReadBufferBorrow(1) == nullptr);
+}
+
+// The POD vector operators must give identical results whether they take the
+// borrowed (zero-copy) fast path or the copying fallback:
+TEST(CArchive, borrowedVectorRead)
+{
+  const std::vector<float> vf{1.0f, -2.0f, 3.5f, 4.25f};
+  const std::vector<double> vd{10.0, -20.0, 30.5};
+
+  // Via a memory stream:
+  {
+    mrpt::io::CMemoryStream f;
+    auto arch = mrpt::serialization::archiveFrom(f);
+    arch << vf << vd;
+
+    f.Seek(0);
+    std::vector<float> vf2;
+    std::vector<double> vd2;
+    arch >> vf2 >> vd2;
+    EXPECT_EQ(vf, vf2);
+    EXPECT_EQ(vd, vd2);
+  }
+
+  // Via a std::vector<uint8_t> archive:
+  {
+    std::vector<uint8_t> buf;
+    {
+      auto arch = mrpt::serialization::archiveFrom(buf);
+      arch << vf << vd;
+    }
+    auto arch = mrpt::serialization::archiveFrom<const std::vector<uint8_t>>(buf);
+    std::vector<float> vf2;
+    std::vector<double> vd2;
+    arch >> vf2 >> vd2;
+    EXPECT_EQ(vf, vf2);
+    EXPECT_EQ(vd, vd2);
+  }
+}
+
+TEST(CArchive, writeCombiningBuffer)
+{
+  // The same data written buffered and unbuffered must be bit-identical:
+  mrpt::io::CMemoryStream fRef, fBuf;
+  const std::vector<double> bigBlock(1000, 3.14);
+
+  const auto writeAll = [&](CArchive& a)
+  {
+    for (uint32_t i = 0; i < 100; i++) a << i << double(i) << std::string("field");
+    a.WriteBufferFixEndianness(bigBlock.data(), bigBlock.size());
+  };
+
+  {
+    auto arch = mrpt::serialization::archiveFrom(fRef);
+    writeAll(arch);
+  }
+  {
+    // Buffered archive: flushed by its destructor
+    auto arch = CArchiveStreamBase<mrpt::io::CMemoryStream>(fBuf, 4096);
+    writeAll(arch);
+  }
+
+  ASSERT_EQ(fRef.getTotalBytesCount(), fBuf.getTotalBytesCount());
+  EXPECT_EQ(
+      0, memcmp(fRef.getRawBufferData(), fBuf.getRawBufferData(), fRef.getTotalBytesCount()));
+
+  // Explicit flush, then read back through the same archive:
+  mrpt::io::CMemoryStream fRW;
+  auto arch = CArchiveStreamBase<mrpt::io::CMemoryStream>(fRW, 4096);
+  arch << uint32_t(42);
+  arch.flushWriteBuffer();
+  fRW.Seek(0);
+  uint32_t readBack = 0;
+  arch >> readBack;
+  EXPECT_EQ(readBack, 42U);
+}
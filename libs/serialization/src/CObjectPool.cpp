@@ -0,0 +1,56 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include "serialization-precomp.h"  // Precompiled headers
+//
+#include <mrpt/serialization/CObjectPool.h>
+
+using namespace mrpt::serialization;
+
+mrpt::rtti::CObject::Ptr CObjectPool::acquire(const mrpt::rtti::TRuntimeClassId* classId)
+{
+  std::lock_guard<std::mutex> lock(m_mtx);
+  auto it = m_pool.find(classId);
+  if (it == m_pool.end() || it->second.empty()) return {};
+
+  auto obj = std::move(it->second.back());
+  it->second.pop_back();
+  return obj;
+}
+
+void CObjectPool::recycle(mrpt::rtti::CObject::Ptr&& obj)
+{
+  if (!obj) return;
+  // Shared with someone else? Then its buffers cannot be reused:
+  if (obj.use_count() != 1)
+  {
+    obj.reset();
+    return;
+  }
+  std::lock_guard<std::mutex> lock(m_mtx);
+  auto& v = m_pool[obj->GetRuntimeClass()];
+  if (v.size() < m_maxObjectsPerClass)
+    v.emplace_back(std::move(obj));
+  else
+    obj.reset();
+}
+
+size_t CObjectPool::size() const
+{
+  std::lock_guard<std::mutex> lock(m_mtx);
+  size_t n = 0;
+  for (const auto& kv : m_pool) n += kv.second.size();
+  return n;
+}
+
+void CObjectPool::clear()
+{
+  std::lock_guard<std::mutex> lock(m_mtx);
+  m_pool.clear();
+}
@@ -0,0 +1,89 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/io/CMemoryStream.h>
+#include <mrpt/serialization/CArchive.h>
+#include <mrpt/serialization/CObjectPool.h>
+#include <mrpt/serialization/CSerializable.h>
+
+using namespace mrpt::serialization;
+
+namespace MyNS
+{
+class PoolTestObj : public CSerializable
+{
+  DEFINE_SERIALIZABLE(PoolTestObj, MyNS)
+ public:
+  PoolTestObj() = default;
+
+  std::vector<float> data;
+};
+}  // namespace MyNS
+
+IMPLEMENTS_SERIALIZABLE(PoolTestObj, CSerializable, MyNS);
+
+uint8_t MyNS::PoolTestObj::serializeGetVersion() const { return 0; }
+void MyNS::PoolTestObj::serializeTo(CArchive& out) const { out << data; }
+void MyNS::PoolTestObj::serializeFrom(CArchive& in, uint8_t) { in >> data; }
+
+TEST(CObjectPool, recycleThroughArchive)
+{
+  mrpt::rtti::registerClass(CLASS_ID(MyNS::PoolTestObj));
+
+  MyNS::PoolTestObj a;
+  a.data = {1.0f, 2.0f, 3.0f};
+
+  mrpt::io::CMemoryStream buf;
+  auto arch = mrpt::serialization::archiveFrom(buf);
+  arch << a << a;
+
+  CObjectPool pool;
+  arch.setObjectPool(&pool);
+
+  buf.Seek(0);
+  auto b1 = arch.ReadObject<MyNS::PoolTestObj>();
+  ASSERT_TRUE(b1);
+  EXPECT_EQ(b1->data, a.data);
+
+  // Recycle it: the next object of the same class must be the same instance,
+  // read back in place:
+  const auto* rawPtr = b1.get();
+  pool.recycle(std::move(b1));
+  EXPECT_EQ(pool.size(), 1U);
+
+  auto b2 = arch.ReadObject<MyNS::PoolTestObj>();
+  ASSERT_TRUE(b2);
+  EXPECT_EQ(b2.get(), rawPtr);
+  EXPECT_EQ(b2->data, a.data);
+  EXPECT_EQ(pool.size(), 0U);
+}
+
+TEST(CObjectPool, limitsAndSharedOwners)
+{
+  mrpt::rtti::registerClass(CLASS_ID(MyNS::PoolTestObj));
+
+  CObjectPool pool(2 /*maxObjectsPerClass*/);
+
+  // Objects with other owners are not stored:
+  auto shared = std::make_shared<MyNS::PoolTestObj>();
+  auto extraOwner = shared;
+  pool.recycle(std::move(shared));
+  EXPECT_EQ(pool.size(), 0U);
+
+  // The per-class limit is honored:
+  for (int i = 0; i < 4; i++) pool.recycle(std::make_shared<MyNS::PoolTestObj>());
+  EXPECT_EQ(pool.size(), 2U);
+
+  // acquire() for a class with no recycled instances returns nullptr:
+  EXPECT_FALSE(pool.acquire(CLASS_ID(CSerializable)));
+
+  pool.clear();
+  EXPECT_EQ(pool.size(), 0U);
+}
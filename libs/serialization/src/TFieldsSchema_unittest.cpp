@@ -0,0 +1,103 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/io/CMemoryStream.h>
+#include <mrpt/serialization/CArchive.h>
+#include <mrpt/serialization/TFieldsSchema.h>
+
+#include <cstring>  // memcmp
+
+using namespace mrpt::serialization;
+
+namespace
+{
+struct TestPack
+{
+  double a = 0, b = 0;
+  uint32_t n = 0;
+  uint8_t flag = 0;
+  double z = 0;
+};
+
+const TFieldsSchema<TestPack>& testPackSchema()
+{
+  static const auto schema = []
+  {
+    TestPack p;
+    TFieldsSchema<TestPack> s;
+    s.add(p, p.a).add(p, p.b).add(p, p.n).add(p, p.flag).add(p, p.z);
+    return s;
+  }();
+  return schema;
+}
+}  // namespace
+
+TEST(TFieldsSchema, byteCompatibleWithFieldByField)
+{
+  const auto& schema = testPackSchema();
+  EXPECT_EQ(schema.numFields(), 5U);
+  EXPECT_EQ(schema.streamLength(), 8U + 8U + 4U + 1U + 8U);
+  // Adjacent fields must have been merged into fewer I/O spans:
+  EXPECT_LE(schema.numSpans(), schema.numFields());
+
+  TestPack p;
+  p.a = 1.5;
+  p.b = -2.25;
+  p.n = 123456;
+  p.flag = 0x5a;
+  p.z = 1e9;
+
+  // Schema write vs. field-by-field write => identical bytes:
+  mrpt::io::CMemoryStream f1, f2;
+  {
+    auto arch = archiveFrom(f1);
+    schema.writeTo(arch, p);
+  }
+  {
+    auto arch = archiveFrom(f2);
+    arch << p.a << p.b << p.n << p.flag << p.z;
+  }
+  ASSERT_EQ(f1.getTotalBytesCount(), f2.getTotalBytesCount());
+  EXPECT_EQ(
+      0, memcmp(f1.getRawBufferData(), f2.getRawBufferData(), (size_t)f1.getTotalBytesCount()));
+}
+
+TEST(TFieldsSchema, roundTrip)
+{
+  const auto& schema = testPackSchema();
+
+  TestPack p;
+  p.a = -3.75;
+  p.b = 0.125;
+  p.n = 0xdeadbeef;
+  p.flag = 7;
+  p.z = -1e-3;
+
+  mrpt::io::CMemoryStream f;
+  auto arch = archiveFrom(f);
+  schema.writeTo(arch, p);
+
+  f.Seek(0);
+  TestPack q;
+  schema.readFrom(arch, q);
+
+  EXPECT_EQ(q.a, p.a);
+  EXPECT_EQ(q.b, p.b);
+  EXPECT_EQ(q.n, p.n);
+  EXPECT_EQ(q.flag, p.flag);
+  EXPECT_EQ(q.z, p.z);
+
+  // And a schema write can be read back field-by-field:
+  f.Seek(0);
+  TestPack r;
+  arch >> r.a >> r.b >> r.n >> r.flag >> r.z;
+  EXPECT_EQ(r.b, p.b);
+  EXPECT_EQ(r.n, p.n);
+}
@@ -10,6 +10,7 @@
 
 #include <mrpt/bayes/CParticleFilterCapable.h>
 #include <mrpt/config/CLoadableOptions.h>
+#include <mrpt/containers/cow_ptr.h>
 #include <mrpt/maps/CMultiMetricMap.h>
 #include <mrpt/maps/CSimpleMap.h>
 #include <mrpt/poses/CPose3DPDFParticles.h>
@@ -34,11 +35,16 @@ class CRBPFParticleData : public mrpt::serialization::CSerializable
   DEFINE_SERIALIZABLE(CRBPFParticleData, mrpt::maps)
  public:
   CRBPFParticleData() = default;
-  CRBPFParticleData(const TSetOfMetricMapInitializers& mapsInit) : mapTillNow(mapsInit), robotPath()
+  CRBPFParticleData(const TSetOfMetricMapInitializers& mapsInit) :
+      mapTillNow(CMultiMetricMap(mapsInit)), robotPath()
   {
   }
 
-  CMultiMetricMap mapTillNow;
+  /** The metric map built by this particle, with copy-on-write semantics:
+   * duplicating a particle (e.g. at resampling) shares the map storage, and
+   * a private deep copy is made only when a particle actually modifies its
+   * map, i.e. upon the next observation insertion. */
+  mrpt::containers::cow_ptr<CMultiMetricMap> mapTillNow;
   std::deque<mrpt::math::TPose3D> robotPath;
 };
 
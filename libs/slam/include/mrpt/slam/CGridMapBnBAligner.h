@@ -0,0 +1,103 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+#pragma once
+
+#include <mrpt/config/CLoadableOptions.h>
+#include <mrpt/slam/CMetricMapsAlignmentAlgorithm.h>
+
+#include <cstdint>
+
+namespace mrpt::slam
+{
+/** A global (arbitrarily-far-from-the-initial-guess) 2D matcher of a point
+ * cloud (e.g. one lidar scan) against an occupancy grid map, based on a
+ * branch-and-bound search over precomputed multi-resolution max-pooled
+ * occupancy pyramids, in the spirit of the real-time loop closure matcher of
+ * Cartographer (Hess et al., ICRA 2016).
+ *
+ * Unlike mrpt::slam::CICP, which only converges locally, this matcher
+ * exhaustively (but efficiently, thanks to the bounds provided by the
+ * max-pooled pyramid) explores a translational and angular search window
+ * around the initial estimation, so it is well suited for relocalization
+ * after tracking loss or for loop-closure candidate verification.
+ *
+ * Usage: call AlignPDF() with `m1` a mrpt::maps::COccupancyGridMap2D and
+ * `m2` a mrpt::maps::CPointsMap; the returned PDF is a
+ * mrpt::poses::CPosePDFGaussian centered at the best found pose of `m2`
+ * relative to `m1`, with a covariance reflecting the search discretization.
+ *
+ * \note [New in MRPT 2.14.5]
+ * \sa CMetricMapsAlignmentAlgorithm, CICP, CGridMapAligner
+ * \ingroup mrpt_slam_grp
+ */
+class CGridMapBnBAligner : public mrpt::slam::CMetricMapsAlignmentAlgorithm
+{
+ public:
+  CGridMapBnBAligner() = default;
+
+  /** The matcher configuration parameters */
+  class TConfigParams : public mrpt::config::CLoadableOptions
+  {
+   public:
+    TConfigParams() = default;
+
+    void loadFromConfigFile(
+        const mrpt::config::CConfigFileBase& source,
+        const std::string& section) override;                 // See base docs
+    void dumpToTextStream(std::ostream& out) const override;  // See base docs
+
+    /** Half-width of the translational search window around the initial
+     * estimation, in each of x/y (meters) */
+    double searchRangeXY = 5.0;
+    /** Half-width of the angular search window around the initial
+     * estimation (radians). The default (pi) searches all orientations. */
+    double searchRangePhi = M_PI;
+    /** Angular step of the search. The default (0) derives it from the
+     * grid resolution and the scan extent, such that the farthest scan
+     * point moves at most ~one cell between consecutive orientations. */
+    double angularStep = .0;
+    /** Number of max-pooling pyramid levels: the coarsest level pools
+     * 2^pyramidDepth x 2^pyramidDepth cells. */
+    uint32_t pyramidDepth = 6;
+  };
+
+  TConfigParams options;
+
+  /** The specific outcome of the matching, returned by AlignPDF() via the
+   * generic `outInfo` output parameter. */
+  struct TReturnInfo : public TMetricMapAlignmentResult
+  {
+    TReturnInfo() = default;
+    /** Normalized score of the best match, in [0,1]: the mean occupancy
+     * of the grid cells hit by the transformed scan points. */
+    double goodness = 0;
+    /** Number of branch-and-bound nodes whose score was evaluated */
+    size_t nNodesExpanded = 0;
+  };
+
+  /** The virtual method of CMetricMapsAlignmentAlgorithm.
+   * `m1` must be a mrpt::maps::COccupancyGridMap2D, `m2` a
+   * mrpt::maps::CPointsMap. Only the mean of `initialEstimationPDF` is
+   * used, as the center of the search window. */
+  mrpt::poses::CPosePDF::Ptr AlignPDF(
+      const mrpt::maps::CMetricMap* m1,
+      const mrpt::maps::CMetricMap* m2,
+      const mrpt::poses::CPosePDFGaussian& initialEstimationPDF,
+      mrpt::optional_ref<TMetricMapAlignmentResult> outInfo = std::nullopt) override;
+
+  /** Not applicable in this class: this matcher is 2D only (throws). */
+  mrpt::poses::CPose3DPDF::Ptr Align3DPDF(
+      const mrpt::maps::CMetricMap* m1,
+      const mrpt::maps::CMetricMap* m2,
+      const mrpt::poses::CPose3DPDFGaussian& initialEstimationPDF,
+      mrpt::optional_ref<TMetricMapAlignmentResult> outInfo = std::nullopt) override;
+
+};  // End of class def.
+
+}  // namespace mrpt::slam
@@ -19,7 +19,11 @@ namespace mrpt::slam
 enum TICPAlgorithm
 {
   icpClassic = 0,
-  icpLevenbergMarquardt
+  icpLevenbergMarquardt,
+  /** Point-to-plane metric: residuals are projected onto per-point normals
+   * of the reference points map (see mrpt::maps::CPointsMap::pointNormals2D).
+   * Converges in fewer iterations than icpClassic on structured scans. */
+  icpClassicPointToPlane
 };
 
 /** ICP covariance estimation methods, used in mrpt::slam::CICP::options
@@ -170,6 +174,25 @@ class CICP : public mrpt::slam::CMetricMapsAlignmentAlgorithm
      * queries,
      *  the most expensive step in ICP */
     uint32_t corresponding_points_decimation{5};
+
+    /** Number of resolution levels of the built-in coarse-to-fine scheme
+     * of the icpClassic method (default=1, i.e. a single full-resolution
+     * level: the classic behavior). With N>1 levels, and whenever the
+     * reference map is a mrpt::maps::CPointsMap, the initial iterations
+     * run against voxel-decimated copies of the reference map (see
+     * multiresolution_coarsest_voxel) to quickly refine the initial guess,
+     * and only the last iterations are executed against the full map. The
+     * final estimate is always computed at full resolution, so there is no
+     * accuracy loss. */
+    uint32_t multiresolution_levels{1};
+    /** Voxel side length (in meters) of the coarsest decimated level when
+     * multiresolution_levels>1; each finer level halves it (default=0.4)
+     */
+    double multiresolution_coarsest_voxel{0.40};
+
+    /** [icpClassicPointToPlane only] Number of nearest neighbors used to
+     * estimate the per-point normals of the reference map (default=8) */
+    uint32_t pointToPlane_normals_knn{8};
   };
 
   /** The options employed by the ICP align. */
@@ -241,6 +264,11 @@ class CICP : public mrpt::slam::CMetricMapsAlignmentAlgorithm
       const mrpt::maps::CMetricMap* m2,
       const mrpt::poses::CPosePDFGaussian& initialEstimationPDF,
       TReturnInfo& outInfo);
+  mrpt::poses::CPosePDF::Ptr ICP_Method_ClassicPointToPlane(
+      const mrpt::maps::CMetricMap* m1,
+      const mrpt::maps::CMetricMap* m2,
+      const mrpt::poses::CPosePDFGaussian& initialEstimationPDF,
+      TReturnInfo& outInfo);
   mrpt::poses::CPose3DPDF::Ptr ICP3D_Method_Classic(
       const mrpt::maps::CMetricMap* m1,
       const mrpt::maps::CMetricMap* m2,
@@ -252,6 +280,7 @@ MRPT_ENUM_TYPE_BEGIN(mrpt::slam::TICPAlgorithm)
 using namespace mrpt::slam;
 MRPT_FILL_ENUM(icpClassic);
 MRPT_FILL_ENUM(icpLevenbergMarquardt);
+MRPT_FILL_ENUM(icpClassicPointToPlane);
 MRPT_ENUM_TYPE_END()
 
 MRPT_ENUM_TYPE_BEGIN(mrpt::slam::TICPCovarianceMethod)
@@ -203,6 +203,12 @@ class CIncrementalMapPartitioner :
   /** The last partition */
   std::vector<std::vector<uint32_t>> m_last_partition;
 
+  /** Warm start for the iterative spectral solver in updatePartitions():
+   * the top-level Fiedler vector of the last partitioning. Just a
+   * convergence hint, so it is neither serialized nor kept in sync with
+   * removeSetOfNodes(). */
+  std::vector<double> m_top_fiedler;
+
   /** This will be true after adding new observations, and before an
    * "updatePartitions" is invoked. */
   bool m_last_last_partition_are_new_ones{false};
@@ -11,8 +11,16 @@
 #include <mrpt/poses/CRobot2DPoseEstimator.h>
 #include <mrpt/slam/CICP.h>
 #include <mrpt/slam/CMetricMapBuilder.h>
+#include <mrpt/system/CLatencyMonitor.h>
 
+#include <future>
 #include <map>
+#include <memory>
+
+namespace mrpt
+{
+class WorkerThreadsPool;
+}
 
 namespace mrpt::slam
 {
@@ -74,6 +82,16 @@ class CMetricMapBuilderICP : public mrpt::slam::CMetricMapBuilder
      * position (default: 0.40) */
     double minICPgoodnessToAccept;
 
+    /** (default:false) If enabled, map insertions run on a background
+     * worker thread, pipelined with the processing of the next incoming
+     * observations: while scan N-1 is being inserted, processObservation()
+     * can already build the point cloud of scan N, with its pose
+     * extrapolated through mrpt::poses::CRobot2DPoseEstimator. At most one
+     * insertion is in flight at a time, and it is always joined before the
+     * metric map is read again (ICP alignment or any of the map getters),
+     * so observable results are identical to the serial mode. */
+    bool pipelinedMapInsertion{false};
+
     mrpt::system::VerbosityLevel& verbosity_level;
 
     /** What maps to create (at least one points map and/or a grid map are
@@ -153,7 +171,22 @@ class CMetricMapBuilderICP : public mrpt::slam::CMetricMapBuilder
    */
   void saveCurrentEstimationToImage(const std::string& file, bool formatEMF_BMP = true) override;
 
+  /** Access to the latency histogram & deadline watchdog of
+   * processObservation(). Disabled by default; enable it either with
+   * `latencyMonitor().enable()` or, at runtime, by defining the environment
+   * variable `MRPT_SLAM_LATENCY_MONITOR=1` (plus, optionally, a periodic
+   * percentile-table dump period in seconds in
+   * `MRPT_SLAM_LATENCY_MONITOR_DUMP_PERIOD`, default: 10). Use
+   * `latencyMonitor().setDeadline()` to get notified of deadline overruns.
+   * \note [New in MRPT 2.14.5] */
+  mrpt::system::CLatencyMonitor& latencyMonitor() { return m_latencyMonitor; }
+  const mrpt::system::CLatencyMonitor& latencyMonitor() const { return m_latencyMonitor; }
+
  private:
+  /** Latency histograms & deadline watchdog of processObservation()
+   * \sa latencyMonitor() */
+  mrpt::system::CLatencyMonitor m_latencyMonitor{
+      false, "mrpt::slam::CMetricMapBuilderICP"};  // default: disabled
   /** The set of observations that leads to current map: */
   mrpt::maps::CSimpleMap SF_Poses_seq;
 
@@ -190,6 +223,22 @@ class CMetricMapBuilderICP : public mrpt::slam::CMetricMapBuilder
   std::map<std::string, TDist> m_distSinceLastInsertion;
   bool m_there_has_been_an_odometry{false};
 
+  /** Worker thread for TConfigParams::pipelinedMapInsertion (lazy init) */
+  std::shared_ptr<mrpt::WorkerThreadsPool> m_mapUpdatePool;
+  /** The (at most one) map insertion currently running on the worker */
+  mutable std::future<void> m_pendingMapUpdate;
+
+  /** Blocks until any in-flight background map insertion has finished,
+   * rethrowing any exception it raised. No-op if none is pending. */
+  void joinPendingMapUpdate() const;
+
+  /** The map-update stage of processObservation(): inserts the observation
+   * into the metric map and appends the keyframe to SF_Poses_seq. Runs
+   * either inline or on m_mapUpdatePool, depending on
+   * TConfigParams::pipelinedMapInsertion. */
+  void internal_updateMapWithObservation(
+      const mrpt::obs::CObservation::Ptr& obs, const mrpt::poses::CPose2D& robotPose);
+
   void accumulateRobotDisplacementCounters(const mrpt::poses::CPose2D& new_pose);
   void resetRobotDisplacementCounters(const mrpt::poses::CPose2D& new_pose);
 };
@@ -13,6 +13,9 @@
 #include <mrpt/poses/CPosePDFParticles.h>
 #include <mrpt/slam/PF_implementations_data.h>
 #include <mrpt/slam/TMonteCarloLocalizationParams.h>
+#include <mrpt/system/CTimeLogger.h>
+
+#include <memory>
 
 namespace mrpt
 {
@@ -46,6 +49,13 @@ class CMonteCarloLocalization2D :
   /** MCL parameters */
   TMonteCarloLocalizationParams options;
 
+  /** Profiler for the prediction+update steps; disabled by default. It also
+   * collects the user measure `time_per_particle_ms` used by the
+   * deadline-aware controller (see
+   * TMonteCarloLocalizationParams::max_update_time_ms).
+   * \note [New in MRPT 2.14.5] */
+  mrpt::system::CTimeLogger profiler{false, "CMonteCarloLocalization2D"};
+
   /** Constructor
    * \param M The number of m_particles.
    */
@@ -170,6 +180,33 @@ class CMonteCarloLocalization2D :
       const mrpt::poses::CPose3D& x) const override;
   /** @} */
 
+ protected:
+  /** \name Deadline-aware controller (see
+   * TMonteCarloLocalizationParams::max_update_time_ms)
+    @{ */
+
+  /** Measured cost per particle of past update steps (exponential moving
+   * average, in ms); 0 until the first timed update. */
+  double m_avgTimePerParticleMs{0};
+
+  /** Returns a copy of the given KLD parameters, with the maximum sample
+   * size capped and the bins coarsened according to the time budget and the
+   * measured per-particle cost. Returns them unchanged if the controller is
+   * disabled or no timing data is available yet. */
+  TKLDParams internal_adjustKLDForDeadline(const TKLDParams& in) const;
+
+  /** If the controller predicts the update will overrun the budget even
+   * after capping the particle count, returns a copy of the sensory frame
+   * with range-scan rays decimated (every n-th ray kept valid); returns
+   * nullptr when no decimation is needed. */
+  std::shared_ptr<mrpt::obs::CSensoryFrame> internal_decimateObservationsForDeadline(
+      const mrpt::obs::CSensoryFrame* sf) const;
+
+  /** Feeds the controller with the duration of the last update step. */
+  void internal_noteUpdateTime(double dt_ms);
+
+  /** @} */
+
 };  // End of class def.
 
 }  // namespace slam
@@ -14,6 +14,9 @@
 #include <mrpt/slam/PF_implementations_data.h>
 #include <mrpt/slam/TMonteCarloLocalizationParams.h>
 
+#include <array>
+#include <map>
+
 namespace mrpt::slam
 {
 /** Declares a class that represents a Probability Density Function (PDF) over a
@@ -128,6 +131,14 @@ class CMonteCarloLocalization3D :
       const mrpt::poses::CPose3D& x) const override;
   /** @} */
 
+ private:
+  /** Per-update cache for the shared-likelihood binning mode
+   * (options.likelihood_bin_size_XYZ>0): maps quantized pose bins
+   * (x,y,z,yaw,pitch,roll indices) to the likelihood evaluated at the first
+   * pose falling into each bin. Cleared at the start of every
+   * prediction+update step. \sa TMonteCarloLocalizationParams */
+  mutable std::map<std::array<int32_t, 6>, double> m_sharedLikelihoodCache;
+
 };  // End of class def.
 
 }  // namespace mrpt::slam
@@ -13,6 +13,10 @@
 #include <mrpt/system/CObserver.h>
 #include <mrpt/vision/CFeatureExtraction.h>
 
+#include <cstdint>
+#include <map>
+#include <vector>
+
 namespace mrpt::slam
 {
 /**  A class for detecting features from occupancy grid maps.
@@ -22,6 +26,14 @@ namespace mrpt::slam
  * times on the same
  *    occupancy grid maps (unless they changed in the meanwhile).
  *
+ *  The cache is incremental: it tracks the per-tile change counters of
+ * COccupancyGridMap2D (see getTileChangeCounters()), so after new
+ * observations are inserted into an already-seen grid only the image area of
+ * the modified tiles is re-rendered and re-extracted, and the refreshed
+ * features are merged with the cached ones. This makes repeated calls (e.g.
+ * from CGridMapAligner on a live map) much cheaper than a full re-extraction.
+ * [New in MRPT 2.14.5]
+ *
  *  For an uncached version (which is a static method that can be called
  * without instantiating COccupancyGridMapFeatureExtractor)
  *  see COccupancyGridMapFeatureExtractor::uncached_extractFeatures()
@@ -66,7 +78,18 @@ class COccupancyGridMapFeatureExtractor : public mrpt::system::CObserver
  protected:
   /** This will receive the events from maps in order to purge the cache. */
   void OnEvent(const mrpt::system::mrptEvent& e) override;
-  using TCache = std::map<const mrpt::maps::COccupancyGridMap2D*, mrpt::maps::CLandmarksMap::Ptr>;
+
+  /** Cached features of one grid, together with the grid geometry and the
+   * tile-counter snapshot they were extracted for. */
+  struct TCacheEntry
+  {
+    mrpt::maps::CLandmarksMap::Ptr features;
+    /** Snapshot of COccupancyGridMap2D::getTileChangeCounters() */
+    std::vector<uint32_t> tileCounters;
+    float xMin = 0, yMin = 0, resolution = 0;
+    unsigned int sizeX = 0, sizeY = 0;
+  };
+  using TCache = std::map<const mrpt::maps::COccupancyGridMap2D*, TCacheEntry>;
   /** A cache of already computed maps. */
   TCache m_cache;
 
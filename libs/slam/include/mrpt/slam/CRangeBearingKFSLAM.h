@@ -25,6 +25,8 @@
 #include <mrpt/slam/CIncrementalMapPartitioner.h>
 #include <mrpt/slam/data_association.h>
 
+#include <set>
+
 namespace mrpt::slam
 {
 /** An implementation of EKF-based SLAM with range-bearing sensors, odometry, a
@@ -193,6 +195,17 @@ class CRangeBearingKFSLAM :
      */
     int partitioningMethod{0};
 
+    /** If enabled (default=false), the EKF update stage is restricted to the
+     * currently-active submap(s): only the vehicle pose and the landmarks of
+     * the partitions matched by the data association get corrected, leaving
+     * the cross-covariances towards the other submaps frozen until the robot
+     * transits to another submap (which triggers one full dense update).
+     * This turns the per-step update cost from O(N²) on the whole map into
+     * O(local²). Requires doPartitioningExperiment=true and
+     * create_simplemap=true.
+     * \note [New in MRPT 2.14.5] */
+    bool submapConditionalUpdates{false};
+
     // Data association:
     TDataAssociationMethod data_assoc_method{assocNN};
     TDataAssociationMetric data_assoc_metric{metricMaha};
@@ -459,6 +472,16 @@ class CRangeBearingKFSLAM :
    */
   void OnNormalizeStateVector() override;
 
+  /** Implements the submap-restricted ("conditional") EKF updates: when
+   * options.submapConditionalUpdates is enabled, marks as active the vehicle
+   * pose plus the landmarks of the partitions involved in the last data
+   * association, so the generic KF code only corrects that part of the state.
+   * Returns false (=dense update) when disabled, when there are less than two
+   * partitions, or on a submap transition.
+   * \note [New in MRPT 2.14.5]
+   */
+  bool OnGetUpdateStateMask(std::vector<bool>& out_active_mask) const override;
+
   /** @}
    */
 
@@ -481,6 +504,11 @@ class CRangeBearingKFSLAM :
 
   std::vector<std::vector<uint32_t>> m_lastPartitionSet;
 
+  /** The set of partitions active during the last conditional update; used
+   * to detect submap transitions (which force one full dense update).
+   * Only used if options.submapConditionalUpdates=true. */
+  mutable std::set<uint32_t> m_lastActivePartitions;
+
   /** Last data association */
   TDataAssocInfo m_last_data_association;
 
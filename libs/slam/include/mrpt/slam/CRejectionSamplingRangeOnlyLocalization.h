@@ -76,6 +76,8 @@ class CRejectionSamplingRangeOnlyLocalization :
   /** Returns the NORMALIZED observation likelihood (linear, not
    * exponential!!!) at a given point of the state space (values in the range
    * [0,1]).
+   *  This implementation only reads the beacon data, so it is thread-safe
+   * and rejectionSamplingBatched() can be used with multiple threads.
    */
   double RS_observationLikelihood(const mrpt::poses::CPose2D& x) override;
 
@@ -12,6 +12,7 @@
 #include <mrpt/bayes/CParticleFilterCapable.h>
 #include <mrpt/bayes/CParticleFilterData.h>
 #include <mrpt/config.h>
+#include <mrpt/core/WorkerThreadsPool.h>
 #include <mrpt/math/data_utils.h>     // averageLogLikelihood()
 #include <mrpt/math/distributions.h>  // chi2inv
 #include <mrpt/obs/CActionCollection.h>
@@ -22,7 +23,9 @@
 #include <mrpt/slam/TKLDParams.h>
 
 #include <cmath>
+#include <future>
 #include <set>
+#include <vector>
 
 #if MRPT_HAS_TBB
 #include <tbb/tbb.h>
@@ -340,31 +343,56 @@ void PF_implementation<PARTICLE_TYPE, MYSELF, STORAGE>::PF_SLAM_implementation_p
     //	UPDATE STAGE
     // ----------------------------------------------------------------------
     // Compute all the likelihood values & update particles weight:
-#if MRPT_HAS_TBB
-    tbb::parallel_for(
-        tbb::blocked_range<size_t>(0, M),
-        [&](const tbb::blocked_range<size_t>& r)
-        {
-          for (size_t i = r.begin(); i != r.end(); ++i)
-          {
-#else
-    for (size_t i = 0; i < M; i++)
+    const auto updateParticleWeight = [&](size_t i)
+    {
+      bool pose_is_valid;
+      const mrpt::math::TPose3D partPose = getLastPose(i, pose_is_valid);  // Take the particle data
+      auto partPose2 = mrpt::poses::CPose3D(partPose);
+      const double obs_log_lik =
+          PF_SLAM_computeObservationLikelihoodForParticle(PF_options, i, *sf, partPose2);
+      ASSERT_(!std::isnan(obs_log_lik) && std::isfinite(obs_log_lik));
+      me->m_particles[i].log_w += obs_log_lik * PF_options.powFactor;
+    };
+
+    if (PF_options.parallelUpdateNumThreads > 1 && M > 1)
+    {
+      // Shard the (mutually independent) per-particle likelihood
+      // evaluations across the worker pool. Each worker thread has its own
+      // thread_local mrpt::random generator and the sharding is
+      // deterministic, so results are reproducible:
+      const size_t nThreads = std::min<size_t>(PF_options.parallelUpdateNumThreads, M);
+      if (!this->m_weightUpdatePool || this->m_weightUpdatePool->size() < nThreads)
+        this->m_weightUpdatePool = std::make_shared<mrpt::WorkerThreadsPool>(
+            nThreads, mrpt::WorkerThreadsPool::POLICY_FIFO, "PF_weightUpdate");
+
+      const size_t shardSize = (M + nThreads - 1) / nThreads;
+      std::vector<std::future<void>> futs;
+      futs.reserve(nThreads);
+      for (size_t t = 0; t < nThreads; t++)
+      {
+        const size_t i0 = t * shardSize, i1 = std::min(M, i0 + shardSize);
+        if (i0 >= i1) break;
+        futs.emplace_back(this->m_weightUpdatePool->enqueue(
+            [&updateParticleWeight, i0, i1]()
+            {
+              for (size_t i = i0; i < i1; i++) updateParticleWeight(i);
+            }));
+      }
+      for (auto& f : futs) f.get();  // rethrows any worker exception
+    }
+    else
     {
-#endif
-            bool pose_is_valid;
-            const mrpt::math::TPose3D partPose =
-                getLastPose(i, pose_is_valid);  // Take the particle data:
-            auto partPose2 = mrpt::poses::CPose3D(partPose);
-            const double obs_log_lik =
-                PF_SLAM_computeObservationLikelihoodForParticle(PF_options, i, *sf, partPose2);
-            ASSERT_(!std::isnan(obs_log_lik) && std::isfinite(obs_log_lik));
-            me->m_particles[i].log_w += obs_log_lik * PF_options.powFactor;
 #if MRPT_HAS_TBB
-          }  // for each particle "i"
-        });
+      tbb::parallel_for(
+          tbb::blocked_range<size_t>(0, M),
+          [&](const tbb::blocked_range<size_t>& r)
+          {
+            for (size_t i = r.begin(); i != r.end(); ++i) updateParticleWeight(i);
+          });
 #else
-    }  // for each particle "i"
+      for (size_t i = 0; i < M; i++) updateParticleWeight(i);
 #endif
+    }
 
     // Normalization of weights is done outside of this method
     // automatically.
@@ -18,6 +18,13 @@
 #include <mrpt/slam/TKLDParams.h>
 #include <mrpt/system/COutputLogger.h>
 
+#include <memory>
+
+namespace mrpt
+{
+class WorkerThreadsPool;
+}
+
 namespace mrpt::slam
 {
 // Frwd decl:
@@ -60,6 +67,10 @@ class PF_implementation : public mrpt::system::COutputLogger
   mutable std::vector<mrpt::math::TPose3D> m_pfAuxiliaryPFOptimal_maxLikDrawnMovement;
   std::vector<bool> m_pfAuxiliaryPFOptimal_maxLikMovementDrawHasBeenUsed;
 
+  /** Worker threads for the weight-update stage, lazily created when
+   * TParticleFilterOptions::parallelUpdateNumThreads>1 */
+  std::shared_ptr<mrpt::WorkerThreadsPool> m_weightUpdatePool;
+
   /**  Compute w[i]*p(z_t | mu_t^i), with mu_t^i being
    *    the mean of the new robot pose
    *
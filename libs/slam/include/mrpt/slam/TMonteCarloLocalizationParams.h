@@ -8,6 +8,7 @@
    +------------------------------------------------------------------------+ */
 #pragma once
 
+#include <mrpt/core/bits_math.h>
 #include <mrpt/maps/CMetricMap.h>
 #include <mrpt/slam/TKLDParams.h>
 
@@ -34,6 +35,41 @@ struct TMonteCarloLocalizationParams
 
   /** Parameters for dynamic sample size, KLD method. */
   TKLDParams KLD_params;
+
+  /** [update stage] If >0, enables the deadline-aware controller: a soft
+   * budget (in milliseconds) for each prediction+update step. Using the
+   * measured per-particle cost of past steps, the KLD maximum sample size is
+   * capped and the KLD bins are coarsened so the particle count cannot blow
+   * past the budget during relocalization; under heavy overload, range-scan
+   * rays are also decimated (see max_observation_decimation). Default: 0
+   * (disabled).
+   * \note [New in MRPT 2.14.5] */
+  double max_update_time_ms{0};
+
+  /** [update stage] Upper bound for the adaptive range-scan ray decimation
+   * applied by the deadline-aware controller (1=never decimate rays). Only
+   * used if max_update_time_ms>0.
+   * \note [New in MRPT 2.14.5] */
+  unsigned int max_observation_decimation{4};
+
+  /** [update stage] If >0, enables shared-likelihood binning in
+   * CMonteCarloLocalization3D: particles are binned by pose similarity
+   * (XYZ bins of this size, in meters; angles binned by
+   * likelihood_bin_size_PHI) and the observation likelihood is evaluated
+   * once per occupied bin and shared by all particles falling into it,
+   * cutting the update cost by the typical bin occupancy. The shared value
+   * is the likelihood at the first evaluated pose of each bin, so the bin
+   * sizes bound the approximation error: keep them well below the
+   * likelihood model resolution. Only used with a single shared metricMap
+   * (ignored with per-particle metricMaps). Default: 0 (disabled).
+   * \note [New in MRPT 2.14.5] */
+  double likelihood_bin_size_XYZ{0};
+
+  /** [update stage] Angular bin size (in radians) for the shared-likelihood
+   * binning of CMonteCarloLocalization3D. Only used if
+   * likelihood_bin_size_XYZ>0. Default: 2 deg.
+   * \note [New in MRPT 2.14.5] */
+  double likelihood_bin_size_PHI{mrpt::DEG2RAD(2.0)};
 };
 
 }  // namespace mrpt::slam
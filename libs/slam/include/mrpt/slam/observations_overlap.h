@@ -11,6 +11,11 @@
 #include <mrpt/obs/CSensoryFrame.h>
 #include <mrpt/obs/obs_frwds.h>
 
+#include <array>
+#include <cstdint>
+#include <map>
+#include <utility>
+
 namespace mrpt::slam
 {
 /**  \addtogroup mrpt_slam_grp
@@ -65,6 +70,76 @@ inline double observationsOverlap(
   return observationsOverlap(*sf1.get(), *sf2.get(), pose_sf2_wrt_sf1);
 }
 
+/** Caching engine for evaluating observationsOverlap() over many keyframe
+ * pairs, e.g. the O(N²) candidate filtering of a loop-closure / submap
+ * matcher.
+ *
+ *  For each 2D range-scan observation, a coarse 64-byte polar occupancy
+ * signature (16 angular sectors x 4 radial rings, saturating byte counts) is
+ * computed once and cached. Before running the exact point-matching overlap,
+ * the two signatures are compared with a histogram-intersection similarity
+ * (a tight byte-wise loop the compiler vectorizes): pairs below
+ * `minSignatureSimilarity` are reported as zero overlap without ever touching
+ * the exact computation. Exact results for pose-less queries are additionally
+ * memoized, keyed on the observation pair identity.
+ *
+ *  Cached entries are keyed on observation pointers, so a cache instance must
+ * not outlive the observations it has seen; call clear() when keyframes are
+ * discarded.
+ *
+ * \note The signature pre-filter is approximate: marginally-overlapping pairs
+ * may be skipped. Set minSignatureSimilarity=0 to disable it.
+ * \note [New in MRPT 2.14.5]
+ * \sa observationsOverlap
+ * \ingroup mrpt_slam_grp
+ */
+class ObservationsOverlapCache
+{
+ public:
+  ObservationsOverlapCache() = default;
+
+  /** Cached/pre-filtered version of observationsOverlap(o1,o2,pose).
+   *  Results are memoized only for pose-less queries (the exact overlap
+   * depends on the relative pose), but the signature pre-filter and the
+   * per-observation caches apply in all cases. */
+  double overlap(
+      const mrpt::obs::CObservation* o1,
+      const mrpt::obs::CObservation* o2,
+      const mrpt::poses::CPose3D* pose_o2_wrt_o1 = nullptr);
+
+  /** Cached/pre-filtered version of observationsOverlap(sf1,sf2,pose) */
+  double overlap(
+      const mrpt::obs::CSensoryFrame& sf1,
+      const mrpt::obs::CSensoryFrame& sf2,
+      const mrpt::poses::CPose3D* pose_sf2_wrt_sf1 = nullptr);
+
+  /** Forget all cached signatures and memoized results */
+  void clear();
+
+  /** Minimum signature similarity (range [0,1]) for a pair to be evaluated
+   * exactly; below it, overlap()==0 is returned right away. */
+  double minSignatureSimilarity = 0.10;
+
+ private:
+  /** Coarse polar occupancy signature of one 2D range scan */
+  struct TSignature
+  {
+    std::array<uint8_t, 64> bins{};
+    bool valid = false;
+  };
+
+  /** Returns the (possibly cached) signature of an observation; `valid` will
+   * be false for observation classes without a signature implementation. */
+  const TSignature& signatureOf(const mrpt::obs::CObservation* o);
+
+  /** Histogram-intersection similarity of two signatures, range [0,1] */
+  static double signatureSimilarity(const TSignature& s1, const TSignature& s2);
+
+  std::map<const mrpt::obs::CObservation*, TSignature> m_signatures;
+  std::map<std::pair<const mrpt::obs::CObservation*, const mrpt::obs::CObservation*>, double>
+      m_memoizedOverlaps;
+};
+
 /** @} */
 
 /** @} */  // end grouping
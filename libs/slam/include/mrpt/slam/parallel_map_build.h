@@ -0,0 +1,52 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+#pragma once
+
+#include <mrpt/maps/CMultiMetricMap.h>
+#include <mrpt/maps/CSimpleMap.h>
+#include <mrpt/maps/TMetricMapInitializer.h>
+
+namespace mrpt::slam
+{
+/**  \addtogroup mrpt_slam_grp
+ *   @{ */
+
+/** Builds a metric map from a simplemap using several worker threads.
+ *
+ * The keyframes of \a simpleMap are partitioned into contiguous blocks, one
+ * per thread; each thread builds its own partial mrpt::maps::CMultiMetricMap
+ * (created from \a mapInitializers), and the partial maps are finally merged
+ * into \a outMap: occupancy grids by adding their per-cell log-odds, point
+ * maps by concatenation. For these map types the result is equivalent to
+ * `outMap.loadFromSimpleMap(simpleMap)`, up to the saturation order of grid
+ * cells at the log-odds clamping limits.
+ *
+ * If \a mapInitializers declares any map type other than
+ * mrpt::maps::COccupancyGridMap2D or a mrpt::maps::CPointsMap subclass (for
+ * which no well-defined merge operation exists), or if there are too few
+ * keyframes for threading to pay off, the function transparently falls back
+ * to the single-threaded mrpt::maps::CMetricMap::loadFromSimpleMap() path.
+ *
+ * \param[out] outMap The output map; re-created from \a mapInitializers.
+ * \param[in] simpleMap The input set of keyframes (pose + sensory frame).
+ * \param[in] mapInitializers The declaration of metric map types to build.
+ * \param[in] numThreads Number of worker threads; 0 means one per CPU core.
+ *
+ * \note [New in MRPT 2.14.5]
+ * \sa mrpt::maps::CMetricMap::loadFromSimpleMap
+ */
+void buildMetricMapFromSimpleMapParallel(
+    mrpt::maps::CMultiMetricMap& outMap,
+    const mrpt::maps::CSimpleMap& simpleMap,
+    const mrpt::maps::TSetOfMetricMapInitializers& mapInitializers,
+    unsigned int numThreads = 0);
+
+/** @} */
+
+}  // namespace mrpt::slam
@@ -9,6 +9,8 @@
 
 #include "slam-precomp.h"  // Precompiled headers
 //
+#include <mrpt/core/WorkerThreadsPool.h>
+#include <mrpt/core/round.h>
 #include <mrpt/img/CEnhancedMetaFile.h>
 #include <mrpt/maps/CLandmarksMap.h>
 #include <mrpt/maps/CMultiMetricMap.h>
@@ -16,6 +18,7 @@
 #include <mrpt/maps/CSimplePointsMap.h>
 #include <mrpt/math/TPose2D.h>
 #include <mrpt/math/distributions.h>
+#include <mrpt/math/fourier.h>
 #include <mrpt/math/geometry.h>
 #include <mrpt/math/ops_containers.h>
 #include <mrpt/poses/CPoint2DPDFGaussian.h>
@@ -28,7 +31,9 @@
 #include <mrpt/tfest/se2.h>
 
 #include <Eigen/Dense>
+#include <algorithm>
 #include <chrono>
+#include <future>
 #include <thread>
 
 using namespace mrpt::math;
@@ -874,8 +879,6 @@ CPosePDF::Ptr CGridMapAligner::AlignPDF_correlation(
 {
   MRPT_START
 
-  //#define	CORRELATION_SHOW_DEBUG
-
   mrpt::system::CTicTac tictac;
   tictac.Tic();
 
@@ -892,104 +895,163 @@ CPosePDF::Ptr CGridMapAligner::AlignPDF_correlation(
   // ------------------------------------------------------
   CPosePDFGaussian::Ptr PDF = std::make_shared<CPosePDFGaussian>();
 
-  // Determine the extension to compute the correlation into:
+  // Determine the orientation hypotheses to evaluate:
   // ----------------------------------------------------------
-  float phiResolution = DEG2RAD(0.2f);
-  float phiMin = -M_PIf + 0.5f * phiResolution;
-  float phiMax = M_PIf;
-
-  // Compute the difference between maps for each (u,v) pair!
-  // --------------------------------------------------------------
-  float phi;
-  float pivotPt_x = 0.5f * (m1->getXMax() + m1->getXMin());
-  float pivotPt_y = 0.5f * (m1->getYMax() + m1->getYMin());
-  COccupancyGridMap2D map2_mod;
-  CImage map1_img, map2_img;
-  float currentMaxCorr = -1e6f;
-
-  m1->getAsImage(map1_img);
-
-  map2_mod.setSize(m1->getXMin(), m1->getXMax(), m1->getYMin(), m1->getYMax(), m1->getResolution());
-  size_t map2_lx = map2_mod.getSizeX();
-  size_t map2_ly = map2_mod.getSizeY();
-  CMatrixF outCrossCorr, bestCrossCorr;
-  float map2width_2 = 0.5f * (map2_mod.getXMax() - map2_mod.getXMin());
-
-#ifdef CORRELATION_SHOW_DEBUG
-  CDisplayWindow* win = new CDisplayWindow("corr");
-  CDisplayWindow* win2 = new CDisplayWindow("map2_mod");
-#endif
-
-  // --------------------------------------------------------
-  // Use FFT-based correlation for each orientation:
-  // --------------------------------------------------------
-  for (phi = phiMin; phi < phiMax; phi += phiResolution)
+  const float phiResolution = DEG2RAD(0.2f);
+  const float phiMin = -M_PIf + 0.5f * phiResolution;
+  const float phiMax = M_PIf;
+
+  std::vector<float> phis;
+  phis.reserve(1 + static_cast<size_t>((phiMax - phiMin) / phiResolution));
+  for (float phi = phiMin; phi < phiMax; phi += phiResolution) phis.push_back(phi);
+
+  const float pivotPt_x = 0.5f * (m1->getXMax() + m1->getXMin());
+  const float pivotPt_y = 0.5f * (m1->getYMax() + m1->getYMin());
+  const float map2width_2 = 0.5f * (m1->getXMax() - m1->getXMin());
+  const float res = m1->getResolution();
+
+  const size_t sx = m1->getSizeX(), sy = m1->getSizeY();
+  const size_t lx = mrpt::round2up(sx), ly = mrpt::round2up(sy);
+
+  // Rasterize map1 (grayscale levels, bias removed, zero-padded to the
+  // power-of-two FFT size) and compute its spectrum ONCE: it is shared,
+  // read-only, by all the orientation hypotheses below.
+  CMatrixF M1_R, M1_I;
   {
-    // Create the displaced map2 grid, for the size of map1:
-    // --------------------------------------------------------
-    CPose2D v2(
-        pivotPt_x - cos(phi) * map2width_2, pivotPt_y - sin(phi) * map2width_2,
-        phi);  // Rotation point: the centre of img1:
-    CPoint2D v1, v3;
-    v2 = CPose2D(0, 0, 0) - v2;  // Inverse
-
-    for (size_t cy2 = 0; cy2 < map2_ly; cy2++)
+    CMatrixF m1_mat(ly, lx);
+    m1_mat.setZero();
+    for (size_t y = 0; y < sy; y++)
     {
-      COccupancyGridMap2D::cellType* row = map2_mod.getRow(cy2);
-      for (size_t cx2 = 0; cx2 < map2_lx; cx2++)
-      {
-        v3 = v2 + CPoint2D(map2_mod.idx2x(cx2), map2_mod.idx2y(cy2));
-        *row++ = m2->p2l(m2->getPos(v3.x(), v3.y()));
-      }
+      // Same row order as getAsImage(): matrix row 0 <=> top grid row.
+      const COccupancyGridMap2D::cellType* row = m1->getRow(sy - 1 - y);
+      for (size_t x = 0; x < sx; x++)
+        m1_mat(y, x) = COccupancyGridMap2D::l2p_255(row[x]) - 127.0f;
     }
+    const CMatrixF ZEROS(ly, lx);
+    math::dft2_complex(m1_mat, ZEROS, M1_R, M1_I);
+  }
 
-    map2_mod.getAsImage(map2_img);
-    //		map2_img.saveToBMP("__debug_map2mod.bmp");
+  // FFT-based correlation for each orientation, multi-threaded over slices
+  // of the [phiMin,phiMax] range. Each worker keeps its own buffers, and the
+  // FFT plan caches in mrpt::math are thread_local, so no locking is needed.
+  struct TBestPeak
+  {
+    float corrSqr = -1e6f;
+    float phi = 0;
+    size_t u = 0, v = 0;
+  };
 
-    // Compute the correlation:
-    map1_img.cross_correlation_FFT(
-        map2_img, outCrossCorr, -1, -1, -1, -1,
-        127,  // Bias to be subtracted
-        127   // Bias to be subtracted
-    );
+  const size_t nWorkers =
+      std::min<size_t>(phis.size(), std::max(1u, std::thread::hardware_concurrency()));
+  std::vector<TBestPeak> bestPerWorker(nWorkers);
 
-    float corrPeak = outCrossCorr.maxCoeff();
-    MRPT_LOG_INFO_FMT("phi = %fdeg \tmax corr=%f", RAD2DEG(phi), corrPeak);
+  mrpt::WorkerThreadsPool pool(nWorkers, mrpt::WorkerThreadsPool::POLICY_FIFO, "gridmap_corr");
+  std::vector<std::future<void>> futs;
+  futs.reserve(nWorkers);
 
-    // Keep the maximum:
-    if (corrPeak > currentMaxCorr)
-    {
-      currentMaxCorr = corrPeak;
-      bestCrossCorr = outCrossCorr;
-      PDF->mean.phi(phi);
-    }
+  for (size_t widx = 0; widx < nWorkers; widx++)
+  {
+    futs.emplace_back(pool.enqueue(
+        [&, widx]()
+        {
+          const size_t i0 = (phis.size() * widx) / nWorkers;
+          const size_t i1 = (phis.size() * (widx + 1)) / nWorkers;
 
-#ifdef CORRELATION_SHOW_DEBUG
-    outCrossCorr.adjustRange(0, 1);
-    CImage aux(outCrossCorr, true);
-    win->showImage(aux);
-    win2->showImage(map2_img);
-    std::this_thread::sleep_for(5ms);
-#endif
+          CMatrixF i1m(ly, lx), I1_R, I1_I, corr_R, corr_I;
+          const CMatrixF ZEROS(ly, lx);
+          TBestPeak& best = bestPerWorker[widx];
+
+          for (size_t i = i0; i < i1; i++)
+          {
+            const float phi = phis[i];
+
+            // Sample the displaced map2 grid over the extension of map1:
+            // the inverse of v2=(pivot - R(phi)*offset, phi) (rotation
+            // point: the centre of map1), applied incrementally along
+            // each row:
+            const float cphi = cos(phi), sphi = sin(phi);
+            const float tx = pivotPt_x - cphi * map2width_2;
+            const float ty = pivotPt_y - sphi * map2width_2;
+            const float x0 = m1->idx2x(0);
+
+            i1m.setZero();
+            for (size_t cy = 0; cy < sy; cy++)
+            {
+              // Same row order as map1's rasterization above:
+              const float yw = m1->idx2y(sy - 1 - cy);
+              float srcX = cphi * (x0 - tx) + sphi * (yw - ty);
+              float srcY = -sphi * (x0 - tx) + cphi * (yw - ty);
+              for (size_t cx = 0; cx < sx; cx++, srcX += cphi * res, srcY -= sphi * res)
+              {
+                // Same grayscale mapping (and bias removal) as the
+                // rasterization of map1:
+                i1m(cy, cx) =
+                    COccupancyGridMap2D::l2p_255(m2->p2l(m2->getPos(srcX, srcY))) - 127.0f;
+              }
+            }
 
-  }  // end for phi
+            // Correlation in the frequency domain, normalized by the
+            // spectrum of map2 (as in CImage::cross_correlation_FFT):
+            math::dft2_complex(i1m, ZEROS, I1_R, I1_I);
+
+            corr_R.setSize(ly, lx);
+            corr_I.setSize(ly, lx);
+            for (size_t yy = 0; yy < ly; yy++)
+              for (size_t xx = 0; xx < lx; xx++)
+              {
+                const float r1 = I1_R(yy, xx), ii1 = I1_I(yy, xx);
+                const float r2 = M1_R(yy, xx), ii2 = M1_I(yy, xx);
+                const float den = square(r1) + square(ii1);
+                corr_R(yy, xx) = (r1 * r2 + ii1 * ii2) / den;
+                corr_I(yy, xx) = (ii2 * r1 - r2 * ii1) / den;
+              }
+
+            math::idft2_complex(corr_R, corr_I, I1_R, I1_I);  // reuse buffers
+
+            // Peak of |corr| over the valid (non-padded) area:
+            float peakSqr = -1e6f;
+            size_t peakU = 0, peakV = 0;
+            for (size_t yy = 0; yy < sy; yy++)
+              for (size_t xx = 0; xx < sx; xx++)
+              {
+                const float c2 = square(I1_R(yy, xx)) + square(I1_I(yy, xx));
+                if (c2 > peakSqr)
+                {
+                  peakSqr = c2;
+                  peakU = yy;
+                  peakV = xx;
+                }
+              }
+
+            MRPT_LOG_DEBUG_FMT("phi = %fdeg \tmax corr=%f", RAD2DEG(phi), std::sqrt(peakSqr));
+
+            if (peakSqr > best.corrSqr)
+            {
+              best.corrSqr = peakSqr;
+              best.phi = phi;
+              best.u = peakU;
+              best.v = peakV;
+            }
+          }  // end for phi
+        }));
+  }
+  for (auto& f : futs) f.wait();
+
+  // Reduce the per-worker maxima:
+  const auto& best = *std::max_element(
+      bestPerWorker.begin(), bestPerWorker.end(),
+      [](const TBestPeak& a, const TBestPeak& b) { return a.corrSqr < b.corrSqr; });
 
   outInfo.executionTime = tictac.Tac();
 
-#ifdef CORRELATION_SHOW_DEBUG
-  CImage aux;
-  aux.setFromMatrix(bestCrossCorr, false /* do normalization [0,1]*/);
-  aux.saveToFile("_debug_best_corr.png");
-  delete win;
-  delete win2;
-#endif
+  MRPT_LOG_INFO_FMT(
+      "Best correlation: %f at phi=%fdeg (%.03f s)", std::sqrt(best.corrSqr), RAD2DEG(best.phi),
+      outInfo.executionTime);
 
   // Transform the best corr matrix peak into coordinates:
-  std::size_t uMax, vMax;
-  currentMaxCorr = bestCrossCorr.maxCoeff(uMax, vMax);
-
-  PDF->mean.x(m1->idx2x(uMax));
-  PDF->mean.y(m1->idx2y(vMax));
+  PDF->mean.x(m1->idx2x(best.u));
+  PDF->mean.y(m1->idx2y(best.v));
+  PDF->mean.phi(best.phi);
 
   return PDF;
 
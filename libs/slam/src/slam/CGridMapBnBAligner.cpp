@@ -0,0 +1,279 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include "slam-precomp.h"  // Precompiled headers
+//
+#include <mrpt/config/CConfigFileBase.h>
+#include <mrpt/core/round.h>
+#include <mrpt/maps/COccupancyGridMap2D.h>
+#include <mrpt/maps/CPointsMap.h>
+#include <mrpt/poses/CPosePDFGaussian.h>
+#include <mrpt/slam/CGridMapBnBAligner.h>
+#include <mrpt/system/CTicTac.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace mrpt::slam;
+using namespace mrpt::maps;
+using namespace mrpt::poses;
+
+namespace
+{
+/** Multi-resolution max-pooled occupancy scores: level h holds, for each
+ * cell (x,y), the maximum level-0 score over the 2^h x 2^h window whose
+ * lower-left corner is (x,y). This is what provides the admissible upper
+ * bounds of the branch-and-bound search: the score of a coarse node is an
+ * upper bound of the scores of all the finer poses it covers. */
+struct TScorePyramid
+{
+  size_t sx = 0, sy = 0;
+  /** levels[h][x + y*sx], values in [0,255] (255 = surely occupied) */
+  std::vector<std::vector<uint8_t>> levels;
+
+  void build(const COccupancyGridMap2D& grid, unsigned int depth)
+  {
+    sx = grid.getSizeX();
+    sy = grid.getSizeY();
+    levels.resize(depth + 1);
+
+    auto& l0 = levels[0];
+    l0.resize(sx * sy);
+    for (size_t y = 0; y < sy; y++)
+    {
+      const COccupancyGridMap2D::cellType* row = grid.getRow(y);
+      // MRPT cells store "freeness": invert so occupied cells score high.
+      for (size_t x = 0; x < sx; x++)
+        l0[x + y * sx] = 255 - COccupancyGridMap2D::l2p_255(row[x]);
+    }
+
+    // Each level doubles the pooling window of the previous one:
+    for (unsigned int h = 1; h <= depth; h++)
+    {
+      const size_t half = size_t(1) << (h - 1);
+      const auto& prev = levels[h - 1];
+      auto& cur = levels[h];
+      cur.resize(sx * sy);
+      for (size_t y = 0; y < sy; y++)
+      {
+        const size_t y2 = std::min(y + half, sy - 1);
+        for (size_t x = 0; x < sx; x++)
+        {
+          const size_t x2 = std::min(x + half, sx - 1);
+          const uint8_t m1 = std::max(prev[x + y * sx], prev[x2 + y * sx]);
+          const uint8_t m2 = std::max(prev[x + y2 * sx], prev[x2 + y2 * sx]);
+          cur[x + y * sx] = std::max(m1, m2);
+        }
+      }
+    }
+  }
+
+  inline uint8_t at(unsigned int h, int x, int y) const
+  {
+    // A level-h lookup at (x,y) covers the cell window [x,x+2^h)x[y,y+2^h).
+    // Windows entirely out of the grid score 0; windows partially hanging
+    // off the left/bottom borders are clamped to their in-grid anchor,
+    // which keeps the returned value an admissible upper bound.
+    const int w = int(1u << h);
+    if (x <= -w || y <= -w || x >= int(sx) || y >= int(sy)) return 0;
+    x = std::max(x, 0);
+    y = std::max(y, 0);
+    return levels[h][size_t(x) + size_t(y) * sx];
+  }
+};
+
+struct TSearchNode
+{
+  int du = 0, dv = 0;  //!< Translation offset, in level-0 cells
+  unsigned int h = 0;  //!< Pyramid level
+  uint32_t score = 0;  //!< (Upper bound of the) score of this node
+};
+}  // namespace
+
+void CGridMapBnBAligner::TConfigParams::loadFromConfigFile(
+    const mrpt::config::CConfigFileBase& source, const std::string& section)
+{
+  MRPT_LOAD_CONFIG_VAR(searchRangeXY, double, source, section);
+  MRPT_LOAD_CONFIG_VAR_DEGREES(searchRangePhi, source, section);
+  MRPT_LOAD_CONFIG_VAR_DEGREES(angularStep, source, section);
+  MRPT_LOAD_CONFIG_VAR(pyramidDepth, uint64_t, source, section);
+}
+
+void CGridMapBnBAligner::TConfigParams::dumpToTextStream(std::ostream& out) const
+{
+  out << "\n----------- [CGridMapBnBAligner::TConfigParams] ------------ \n\n";
+
+  LOADABLEOPTS_DUMP_VAR(searchRangeXY, double)
+  LOADABLEOPTS_DUMP_VAR_DEG(searchRangePhi)
+  LOADABLEOPTS_DUMP_VAR_DEG(angularStep)
+  LOADABLEOPTS_DUMP_VAR(pyramidDepth, int)
+}
+
+CPosePDF::Ptr CGridMapBnBAligner::AlignPDF(
+    const mrpt::maps::CMetricMap* mm1,
+    const mrpt::maps::CMetricMap* mm2,
+    const CPosePDFGaussian& initialEstimationPDF,
+    mrpt::optional_ref<TMetricMapAlignmentResult> outInfo)
+{
+  MRPT_START
+
+  mrpt::system::CTicTac tictac;
+  tictac.Tic();
+  TReturnInfo infoVal;
+
+  const auto* grid = dynamic_cast<const COccupancyGridMap2D*>(mm1);
+  const auto* pts = dynamic_cast<const CPointsMap*>(mm2);
+  ASSERTMSG_(grid, "m1 must be a mrpt::maps::COccupancyGridMap2D");
+  ASSERTMSG_(pts, "m2 must be a mrpt::maps::CPointsMap");
+  ASSERT_(!pts->empty());
+  ASSERT_GE_(options.pyramidDepth, 1U);
+
+  const double res = grid->getResolution();
+  const unsigned int H = options.pyramidDepth;
+  const auto& xs = pts->getPointsBufferRef_x();
+  const auto& ys = pts->getPointsBufferRef_y();
+  const size_t nPts = xs.size();
+
+  // Precompute the max-pooled pyramid of the reference grid:
+  TScorePyramid pyr;
+  pyr.build(*grid, H);
+
+  // Angular step: by default, make the farthest scan point move at most
+  // ~one cell between consecutive orientation hypotheses:
+  double maxRangeSqr = 0;
+  for (size_t i = 0; i < nPts; i++)
+    maxRangeSqr = std::max(maxRangeSqr, double(xs[i]) * xs[i] + double(ys[i]) * ys[i]);
+  const double maxRange = std::sqrt(maxRangeSqr);
+
+  double dTheta = options.angularStep;
+  if (dTheta <= 0)
+    dTheta = (maxRange > res) ? std::acos(1.0 - mrpt::square(res) / (2.0 * maxRangeSqr))
+                              : mrpt::DEG2RAD(1.0);
+
+  const mrpt::poses::CPose2D t0 = initialEstimationPDF.mean;
+  const int W = std::max(1, mrpt::round(options.searchRangeXY / res));
+  const int rootStep = 1 << H;
+  const int nTheta = std::max(0, int(std::ceil(options.searchRangePhi / dTheta)));
+
+  uint32_t bestScore = 0;
+  TSearchNode bestNode;
+  double bestTheta = t0.phi();
+  bool anySolution = false;
+
+  std::vector<int> baseIx(nPts), baseIy(nPts);
+  std::vector<TSearchNode> stack;
+
+  for (int kTheta = -nTheta; kTheta <= nTheta; kTheta++)
+  {
+    const double theta = t0.phi() + kTheta * dTheta;
+    const double c = std::cos(theta), s = std::sin(theta);
+
+    // Cell indices of each scan point for the zero-offset translation:
+    for (size_t i = 0; i < nPts; i++)
+    {
+      baseIx[i] = grid->x2idx(t0.x() + c * xs[i] - s * ys[i]);
+      baseIy[i] = grid->y2idx(t0.y() + s * xs[i] + c * ys[i]);
+    }
+
+    const auto scoreAt = [&](int du, int dv, unsigned int h)
+    {
+      uint32_t sum = 0;
+      for (size_t i = 0; i < nPts; i++) sum += pyr.at(h, baseIx[i] + du, baseIy[i] + dv);
+      return sum;
+    };
+
+    // Root nodes: the coarsest level, tiling the search window.
+    stack.clear();
+    for (int dv = -W; dv <= W; dv += rootStep)
+      for (int du = -W; du <= W; du += rootStep)
+      {
+        const uint32_t sc = scoreAt(du, dv, H);
+        infoVal.nNodesExpanded++;
+        if (sc > bestScore) stack.push_back({du, dv, H, sc});
+      }
+    // Depth-first, best-child-first search (pop from the back):
+    std::sort(
+        stack.begin(), stack.end(),
+        [](const TSearchNode& a, const TSearchNode& b) { return a.score < b.score; });
+
+    while (!stack.empty())
+    {
+      const TSearchNode node = stack.back();
+      stack.pop_back();
+      if (node.score <= bestScore) continue;  // pruned
+
+      if (node.h == 0)
+      {
+        // A new incumbent solution:
+        bestScore = node.score;
+        bestNode = node;
+        bestTheta = theta;
+        anySolution = true;
+        continue;
+      }
+
+      // Branch: split into the 4 sub-windows of the next finer level.
+      const int step = 1 << (node.h - 1);
+      TSearchNode children[4];
+      int nChildren = 0;
+      for (int b = 0; b < 2; b++)
+        for (int a = 0; a < 2; a++)
+        {
+          const int du = node.du + a * step, dv = node.dv + b * step;
+          const uint32_t sc = scoreAt(du, dv, node.h - 1);
+          infoVal.nNodesExpanded++;
+          if (sc > bestScore) children[nChildren++] = {du, dv, node.h - 1, sc};
+        }
+      std::sort(
+          children, children + nChildren,
+          [](const TSearchNode& a, const TSearchNode& b) { return a.score < b.score; });
+      for (int i = 0; i < nChildren; i++) stack.push_back(children[i]);
+    }
+  }  // end for each theta
+
+  // Build the output PDF:
+  auto pdf = std::make_shared<CPosePDFGaussian>();
+  pdf->mean = t0;
+  if (anySolution)
+  {
+    pdf->mean.x(t0.x() + bestNode.du * res);
+    pdf->mean.y(t0.y() + bestNode.dv * res);
+    pdf->mean.phi(bestTheta);
+    pdf->mean.normalizePhi();
+    infoVal.goodness = bestScore / (255.0 * nPts);
+  }
+  pdf->cov.setZero();
+  pdf->cov(0, 0) = mrpt::square(res);
+  pdf->cov(1, 1) = mrpt::square(res);
+  pdf->cov(2, 2) = mrpt::square(dTheta);
+
+  infoVal.executionTime = tictac.Tac();
+
+  MRPT_LOG_DEBUG_FMT(
+      "[CGridMapBnBAligner] goodness=%.03f pose=%s nodes=%u time=%.03fs", infoVal.goodness,
+      pdf->mean.asString().c_str(), static_cast<unsigned int>(infoVal.nNodesExpanded),
+      infoVal.executionTime);
+
+  if (outInfo)
+    if (auto* o = dynamic_cast<TReturnInfo*>(&outInfo.value().get()); o) *o = infoVal;
+
+  return pdf;
+
+  MRPT_END
+}
+
+CPose3DPDF::Ptr CGridMapBnBAligner::Align3DPDF(
+    [[maybe_unused]] const mrpt::maps::CMetricMap* m1,
+    [[maybe_unused]] const mrpt::maps::CMetricMap* m2,
+    [[maybe_unused]] const CPose3DPDFGaussian& initialEstimationPDF,
+    [[maybe_unused]] mrpt::optional_ref<TMetricMapAlignmentResult> outInfo)
+{
+  THROW_EXCEPTION("Align3D is not applicable to this 2D-only matcher");
+}
@@ -0,0 +1,59 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/maps/COccupancyGridMap2D.h>
+#include <mrpt/maps/CSimplePointsMap.h>
+#include <mrpt/math/wrap2pi.h>
+#include <mrpt/obs/CObservation2DRangeScan.h>
+#include <mrpt/obs/stock_observations.h>
+#include <mrpt/slam/CGridMapBnBAligner.h>
+
+using namespace mrpt;
+using namespace mrpt::maps;
+using namespace mrpt::obs;
+using namespace mrpt::poses;
+using namespace mrpt::slam;
+
+TEST(CGridMapBnBAligner, relocalizeStockScan)
+{
+  CObservation2DRangeScan scan1;
+  stock_observations::example2DRangeScan(scan1);
+
+  // The ground-truth pose of the scan within the reference grid map:
+  const CPose2D gtPose(2.0, -1.5, DEG2RAD(30.0));
+
+  COccupancyGridMap2D grid(-20.0f, 20.0f, -20.0f, 20.0f, 0.10f);
+  grid.insertObservation(scan1, CPose3D(gtPose));
+
+  CSimplePointsMap scanPts;
+  scanPts.insertObservation(scan1);
+
+  CGridMapBnBAligner aligner;
+  aligner.options.searchRangeXY = 6.0;
+  aligner.options.searchRangePhi = M_PI;
+
+  // Search from an uninformative initial guess at the origin:
+  CGridMapBnBAligner::TReturnInfo info;
+  CPosePDFGaussian initGuess;  // (0,0,0)
+  const auto pdf = aligner.AlignPDF(&grid, &scanPts, initGuess, info);
+
+  ASSERT_(pdf);
+  const CPose2D mean = pdf->getMeanVal();
+
+  EXPECT_NEAR(mean.x(), gtPose.x(), 0.2) << "goodness=" << info.goodness;
+  EXPECT_NEAR(mean.y(), gtPose.y(), 0.2) << "goodness=" << info.goodness;
+  EXPECT_NEAR(
+      mrpt::math::angDistance(mean.phi(), gtPose.phi()), .0,
+      DEG2RAD(3.0))
+      << "goodness=" << info.goodness;
+
+  EXPECT_GT(info.goodness, 0.5);
+  EXPECT_GT(info.nNodesExpanded, 100U);
+}
@@ -10,6 +10,7 @@
 #include "slam-precomp.h"  // Precompiled headers
 //
 #include <mrpt/config/CConfigFileBase.h>  // MRPT_LOAD_*()
+#include <mrpt/maps/CSimplePointsMap.h>
 #include <mrpt/math/TPose2D.h>
 #include <mrpt/math/ops_containers.h>
 #include <mrpt/math/wrap2pi.h>
@@ -25,6 +26,7 @@
 #include <mrpt/tfest.h>
 
 #include <Eigen/Dense>
+#include <unordered_set>
 
 using namespace mrpt::slam;
 using namespace mrpt::maps;
@@ -56,6 +58,9 @@ CPosePDF::Ptr CICP::AlignPDF(
     case icpLevenbergMarquardt:
       resultPDF = ICP_Method_LM(m1, mm2, initialEstimationPDF, outInfoVal);
       break;
+    case icpClassicPointToPlane:
+      resultPDF = ICP_Method_ClassicPointToPlane(m1, mm2, initialEstimationPDF, outInfoVal);
+      break;
     default:
       THROW_EXCEPTION_FMT(
           "Invalid value for ICP_algorithm: %i", static_cast<int>(options.ICP_algorithm));
@@ -115,6 +120,9 @@ void CICP::TConfigParams::loadFromConfigFile(
   MRPT_LOAD_CONFIG_VAR(skip_quality_calculation, bool, iniFile, section);
 
   MRPT_LOAD_CONFIG_VAR(corresponding_points_decimation, int, iniFile, section);
+  MRPT_LOAD_CONFIG_VAR(multiresolution_levels, int, iniFile, section);
+  MRPT_LOAD_CONFIG_VAR(multiresolution_coarsest_voxel, float, iniFile, section);
+  MRPT_LOAD_CONFIG_VAR(pointToPlane_normals_knn, int, iniFile, section);
 }
 
 void CICP::TConfigParams::saveToConfigFile(
@@ -159,10 +167,55 @@ void CICP::TConfigParams::saveToConfigFile(
   MRPT_SAVE_CONFIG_VAR_COMMENT(skip_cov_calculation, "");
   MRPT_SAVE_CONFIG_VAR_COMMENT(skip_quality_calculation, "");
   MRPT_SAVE_CONFIG_VAR_COMMENT(corresponding_points_decimation, "");
+  MRPT_SAVE_CONFIG_VAR_COMMENT(
+      multiresolution_levels,
+      "Number of coarse-to-fine levels for icpClassic (1=single, "
+      "full-resolution level)");
+  MRPT_SAVE_CONFIG_VAR_COMMENT(
+      multiresolution_coarsest_voxel, "Voxel size [m] of the coarsest decimated reference map");
+  MRPT_SAVE_CONFIG_VAR_COMMENT(
+      pointToPlane_normals_knn,
+      "Neighbors for reference-map normal estimation (icpClassicPointToPlane)");
 }
 
 float CICP::kernel(float x2, float rho2) { return options.use_kernel ? (x2 / (x2 + rho2)) : x2; }
 
+namespace
+{
+/** Returns a copy of a points map decimated down to (at most) one point per
+ * voxel of side `voxelSize`, for the coarse levels of the multi-resolution
+ * ICP scheme. */
+CSimplePointsMap::Ptr voxelDecimatedCopy(const CPointsMap& pm, const float voxelSize)
+{
+  auto out = CSimplePointsMap::Create();
+
+  const auto& xs = pm.getPointsBufferRef_x();
+  const auto& ys = pm.getPointsBufferRef_y();
+  const auto& zs = pm.getPointsBufferRef_z();
+  const size_t N = xs.size();
+
+  const float inv = 1.0f / voxelSize;
+
+  // 21 bits per coordinate index: exact for |coord| < 2^20 * voxelSize
+  std::unordered_set<uint64_t> usedVoxels;
+  usedVoxels.reserve(N);
+
+  for (size_t i = 0; i < N; i++)
+  {
+    const auto cx = static_cast<int32_t>(std::floor(xs[i] * inv));
+    const auto cy = static_cast<int32_t>(std::floor(ys[i] * inv));
+    const auto cz = static_cast<int32_t>(std::floor(zs[i] * inv));
+
+    const uint64_t key = (static_cast<uint64_t>(static_cast<uint32_t>(cx) & 0x1fffff) << 42) |
+                         (static_cast<uint64_t>(static_cast<uint32_t>(cy) & 0x1fffff) << 21) |
+                         (static_cast<uint64_t>(static_cast<uint32_t>(cz) & 0x1fffff));
+
+    if (usedVoxels.insert(key).second) out->insertPoint(xs[i], ys[i], zs[i]);
+  }
+  return out;
+}
+}  // namespace
+
 /*----------------------------------------------------------------------------
 
           ICP_Method_Classic
@@ -224,6 +277,57 @@ CPosePDF::Ptr CICP::ICP_Method_Classic(
   {
     matchParams.offset_other_map_points = 0;
 
+    // ------------------------------------------------------
+    // Optional coarse-to-fine stage: refine the initial guess
+    // against voxel-decimated copies of the reference map, so
+    // the full-resolution loop below only runs the last
+    // iterations (see options.multiresolution_levels)
+    // ------------------------------------------------------
+    if (options.multiresolution_levels > 1 && IS_DERIVED(*m1, CPointsMap))
+    {
+      const auto* m1pts = static_cast<const CPointsMap*>(m1);
+      unsigned int nCoarseIters = 0;
+
+      for (uint32_t level = 0; level + 1 < options.multiresolution_levels; level++)
+      {
+        const float voxel = static_cast<float>(options.multiresolution_coarsest_voxel) /
+                            static_cast<float>(1u << level);
+        const auto coarseMap = voxelDecimatedCopy(*m1pts, voxel);
+        if (coarseMap->empty()) continue;
+
+        TMatchingParams coarseMatchParams = matchParams;
+        // Enlarge the search radius to account for the decimation:
+        coarseMatchParams.maxDistForCorrespondence = options.thresholdDist + voxel;
+
+        bool keepRefining = true;
+        CPose2D lastCoarsePose = gaussPdf->mean;
+
+        while (keepRefining && nCoarseIters < options.maxIterations)
+        {
+          coarseMatchParams.angularDistPivotPoint =
+              mrpt::math::TPoint3D(gaussPdf->mean.translation());
+
+          coarseMap->determineMatching2D(
+              m2, gaussPdf->mean, correspondences, coarseMatchParams, matchExtraResults);
+          if (correspondences.empty()) break;
+
+          mrpt::math::TPose2D est_mean;
+          mrpt::tfest::se2_l2(correspondences, est_mean);
+          gaussPdf->mean = mrpt::poses::CPose2D(est_mean);
+          nCoarseIters++;
+
+          // Converged at this level?
+          keepRefining =
+              fabs(lastCoarsePose.x() - gaussPdf->mean.x()) > options.minAbsStep_trans ||
+              fabs(lastCoarsePose.y() - gaussPdf->mean.y()) > options.minAbsStep_trans ||
+              fabs(math::wrapToPi(lastCoarsePose.phi() - gaussPdf->mean.phi())) >
+                  options.minAbsStep_rot;
+          lastCoarsePose = gaussPdf->mean;
+        }
+      }
+      outInfo.nIterations += nCoarseIters;
+    }
+
     // ------------------------------------------------------
     //					The ICP loop
     // ------------------------------------------------------
@@ -494,6 +598,216 @@ CPosePDF::Ptr CICP::ICP_Method_Classic(
   MRPT_END
 }
 
+/*----------------------------------------------------------------------------
+
+        ICP_Method_ClassicPointToPlane
+
+  ----------------------------------------------------------------------------*/
+CPosePDF::Ptr CICP::ICP_Method_ClassicPointToPlane(
+    const mrpt::maps::CMetricMap* m1,
+    const mrpt::maps::CMetricMap* mm2,
+    const CPosePDFGaussian& initialEstimationPDF,
+    TReturnInfo& outInfo)
+{
+  MRPT_START
+
+  // The point-to-plane metric needs per-point normals of the reference
+  // map, so it requires a points map there. Fall back to the classic
+  // point-to-point method otherwise (e.g. matching against a grid map):
+  if (!IS_DERIVED(*m1, CPointsMap))
+    return ICP_Method_Classic(m1, mm2, initialEstimationPDF, outInfo);
+
+  const auto* m1pts = static_cast<const CPointsMap*>(m1);
+  const auto& normals = m1pts->pointNormals2D(options.pointToPlane_normals_knn);
+
+  const mrpt::maps::CMetricMap* m2 = mm2;
+
+  size_t nCorrespondences = 0;
+  bool keepApproaching;
+  mrpt::tfest::TMatchingPairList correspondences;
+  CPose2D lastMeanPose;
+
+  ASSERT_(options.ALFA >= 0 && options.ALFA < 1);
+
+  outInfo.nIterations = 0;
+  outInfo.goodness = 1;
+  outInfo.quality = 0;
+
+  auto gaussPdf = std::make_shared<CPosePDFGaussian>();
+  gaussPdf->mean = initialEstimationPDF.mean;
+
+  mrpt::maps::TMatchingParams matchParams;
+  mrpt::maps::TMatchingExtraResults matchExtraResults;
+
+  matchParams.maxDistForCorrespondence = options.thresholdDist;
+  matchParams.maxAngularDistForCorrespondence = options.thresholdAng;
+  matchParams.onlyKeepTheClosest = true;
+  matchParams.onlyUniqueRobust = options.onlyUniqueRobust;
+  matchParams.decimation_other_map_points = options.corresponding_points_decimation;
+
+  // Hessian of the last Gauss-Newton step, reused for the covariance:
+  CMatrixDouble33 H;
+
+  if (!m2->isEmpty())
+  {
+    matchParams.offset_other_map_points = 0;
+
+    // ------------------------------------------------------
+    //					The ICP loop
+    // ------------------------------------------------------
+    do
+    {
+      matchParams.angularDistPivotPoint = mrpt::math::TPoint3D(gaussPdf->mean.translation());
+
+      m1->determineMatching2D(
+          m2,              // The other map
+          gaussPdf->mean,  // The other map pose
+          correspondences, matchParams, matchExtraResults);
+
+      nCorrespondences = correspondences.size();
+
+      if (!nCorrespondences)
+      {
+        // Nothing we can do !!
+        keepApproaching = false;
+      }
+      else
+      {
+        // One Gauss-Newton step on the point-to-plane objective:
+        //   min sum_i [ n_i . ( q (+) p_i - g_i ) ]^2
+        // with residuals projected onto the reference-map normals n_i.
+        // ----------------------------------------------------------------------
+        const TPose2D transf = gaussPdf->mean.asTPose();
+        const double ccos = cos(transf.phi);
+        const double csin = sin(transf.phi);
+
+        H.setZero();
+        double g0 = 0, g1 = 0, g2 = 0;
+        size_t nUsed = 0;
+
+        for (const auto& c : correspondences)
+        {
+          const double nix = normals.nx[c.globalIdx];
+          const double niy = normals.ny[c.globalIdx];
+          if (nix == 0 && niy == 0) continue;  // no valid normal for this point
+
+          const double px = transf.x + ccos * c.local.x - csin * c.local.y;
+          const double py = transf.y + csin * c.local.x + ccos * c.local.y;
+
+          const double r = nix * (px - c.global.x) + niy * (py - c.global.y);
+
+          // Jacobian of the residual wrt (x,y,phi):
+          const double jphi = nix * (-csin * c.local.x - ccos * c.local.y) +
+                              niy * (ccos * c.local.x - csin * c.local.y);
+
+          H(0, 0) += nix * nix;
+          H(0, 1) += nix * niy;
+          H(0, 2) += nix * jphi;
+          H(1, 1) += niy * niy;
+          H(1, 2) += niy * jphi;
+          H(2, 2) += jphi * jphi;
+
+          g0 += nix * r;
+          g1 += niy * r;
+          g2 += jphi * r;
+          nUsed++;
+        }
+        H(1, 0) = H(0, 1);
+        H(2, 0) = H(0, 2);
+        H(2, 1) = H(1, 2);
+
+        if (nUsed < 3)
+        {
+          // Not enough normal-carrying correspondences to constrain the
+          // 3 DOFs:
+          keepApproaching = false;
+        }
+        else
+        {
+          for (int i = 0; i < 3; i++) H(i, i) += 1e-9;  // regularize
+
+          const Eigen::Vector3d g(g0, g1, g2);
+          const Eigen::Vector3d delta = H.asEigen().ldlt().solve(g);
+
+          gaussPdf->mean.x(transf.x - delta[0]);
+          gaussPdf->mean.y(transf.y - delta[1]);
+          gaussPdf->mean.phi(math::wrapToPi(transf.phi - delta[2]));
+
+          // If matching has not changed, decrease the thresholds:
+          // --------------------------------------------------------
+          keepApproaching = true;
+          if (!(fabs(lastMeanPose.x() - gaussPdf->mean.x()) > options.minAbsStep_trans ||
+                fabs(lastMeanPose.y() - gaussPdf->mean.y()) > options.minAbsStep_trans ||
+                fabs(math::wrapToPi(lastMeanPose.phi() - gaussPdf->mean.phi())) >
+                    options.minAbsStep_rot))
+          {
+            matchParams.maxDistForCorrespondence *= options.ALFA;
+            matchParams.maxAngularDistForCorrespondence *= options.ALFA;
+            if (matchParams.maxDistForCorrespondence < options.smallestThresholdDist)
+              keepApproaching = false;
+
+            if (++matchParams.offset_other_map_points >= options.corresponding_points_decimation)
+              matchParams.offset_other_map_points = 0;
+          }
+
+          lastMeanPose = gaussPdf->mean;
+        }
+      }  // end of "else, there are correspondences"
+
+      // Next iteration:
+      outInfo.nIterations++;
+
+      if (outInfo.nIterations >= options.maxIterations &&
+          matchParams.maxDistForCorrespondence > options.smallestThresholdDist)
+      {
+        matchParams.maxDistForCorrespondence *= options.ALFA;
+      }
+
+    } while ((keepApproaching && outInfo.nIterations < options.maxIterations) ||
+             (outInfo.nIterations >= options.maxIterations &&
+              matchParams.maxDistForCorrespondence > options.smallestThresholdDist));
+
+    // -------------------------------------------------
+    //   Obtain the covariance matrix of the estimation:
+    //   Gauss-Newton approximation cov = sigma_p^2 (J^T J)^-1
+    // -------------------------------------------------
+    if (!options.skip_cov_calculation && nCorrespondences && H(0, 0) > 0)
+    {
+      gaussPdf->cov = H.inverse_LLt();
+      gaussPdf->cov *= options.covariance_varPoints;
+    }
+
+    outInfo.goodness = matchExtraResults.correspondencesRatio;
+    outInfo.quality = matchExtraResults.correspondencesRatio;
+
+  }  // end of "if m2 is not empty"
+
+  // RANSAC?
+  if (options.doRANSAC)
+  {
+    mrpt::tfest::TSE2RobustParams params;
+    params.ransac_minSetSize = options.ransac_minSetSize;
+    params.ransac_maxSetSize = options.ransac_maxSetSize;
+    params.ransac_mahalanobisDistanceThreshold = options.ransac_mahalanobisDistanceThreshold;
+    params.ransac_nSimulations = options.ransac_nSimulations;
+    params.ransac_fuseByCorrsMatch = options.ransac_fuseByCorrsMatch;
+    params.ransac_fuseMaxDiffXY = options.ransac_fuseMaxDiffXY;
+    params.ransac_fuseMaxDiffPhi = options.ransac_fuseMaxDiffPhi;
+    params.ransac_algorithmForLandmarks = false;
+
+    mrpt::tfest::TSE2RobustResult results;
+    mrpt::tfest::se2_l2_robust(correspondences, options.normalizationStd, params, results);
+
+    auto SOG = std::make_shared<CPosePDFSOG>();
+    *SOG = results.transformation;
+    return SOG;
+  }
+
+  return gaussPdf;
+
+  MRPT_END
+}
+
 /*----------------------------------------------------------------------------
 
             ICP_Method_LM
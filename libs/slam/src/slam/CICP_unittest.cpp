@@ -37,7 +37,7 @@ class ICPTests : public ::testing::Test
  protected:
   void SetUp() override {}
   void TearDown() override {}
-  void align2scans(const TICPAlgorithm icp_method)
+  void align2scans(const TICPAlgorithm icp_method, const uint32_t multiresolutionLevels = 1)
   {
     CSimplePointsMap m1, m2;
     CICP::TReturnInfo info;
@@ -63,6 +63,8 @@ class ICPTests : public ::testing::Test
     ICP.options.ALFA = 0.5f;
     ICP.options.smallestThresholdDist = 0.05f;
     ICP.options.doRANSAC = false;
+    ICP.options.multiresolution_levels = multiresolutionLevels;
+    ICP.options.multiresolution_coarsest_voxel = 0.40;
     // ICP.options.dumpToConsole();
     // -----------------------------------------------------
     CPose2D initialPose(0.8f, 0.0f, (float)DEG2RAD(0.0f));
@@ -98,6 +100,8 @@ class ICPTests : public ::testing::Test
 };
 
 TEST_F(ICPTests, AlignScans_icpClassic) { align2scans(icpClassic); }
+TEST_F(ICPTests, AlignScans_icpClassicMultiresolution) { align2scans(icpClassic, 3); }
+TEST_F(ICPTests, AlignScans_icpClassicPointToPlane) { align2scans(icpClassicPointToPlane); }
 TEST_F(ICPTests, AlignScans_icpLevenbergMarquardt) { align2scans(icpLevenbergMarquardt); }
 
 TEST_F(ICPTests, RayTracingICP3D)
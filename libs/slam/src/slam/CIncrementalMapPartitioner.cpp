@@ -108,6 +108,7 @@ void CIncrementalMapPartitioner::clear()
   m_individualFrames.clear();  // Free the map...
   m_individualMaps.clear();
   m_last_partition.clear();  // Delete last partitions
+  m_top_fiedler.clear();
 }
 
 uint32_t CIncrementalMapPartitioner::addMapFrame(
@@ -237,8 +238,7 @@ void CIncrementalMapPartitioner::updatePartitions(vector<std::vector<uint32_t>>&
   partitions.clear();
   CGraphPartitioner<CMatrixD>::RecursiveSpectralPartition(
       m_A, partitions, options.partitionThreshold, true, true, !options.forceBisectionOnly,
-      options.minimumNumberElementsEachCluster, false /* verbose */
-  );
+      options.minimumNumberElementsEachCluster, false /* verbose */, &m_top_fiedler);
 
   m_last_partition = partitions;
   m_last_last_partition_are_new_ones = false;
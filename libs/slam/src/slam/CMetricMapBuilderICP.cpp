@@ -10,6 +10,8 @@
 #include "slam-precomp.h"  // Precompiled headers
 //
 #include <mrpt/config/CConfigFileBase.h>
+#include <mrpt/core/WorkerThreadsPool.h>
+#include <mrpt/core/get_env.h>
 #include <mrpt/core/lock_helper.h>
 #include <mrpt/img/CEnhancedMetaFile.h>
 #include <mrpt/maps/COccupancyGridMap2D.h>
@@ -34,6 +36,16 @@ CMetricMapBuilderICP::CMetricMapBuilderICP() : ICP_options(m_min_verbosity_level
 {
   this->setLoggerName("CMetricMapBuilderICP");
   this->initialize(CSimpleMap());
+
+  // Runtime switch for always-on latency monitoring of the SLAM step:
+  static const bool SLAM_LATENCY_MONITOR = mrpt::get_env<bool>("MRPT_SLAM_LATENCY_MONITOR", false);
+  if (SLAM_LATENCY_MONITOR)
+  {
+    static const double SLAM_LATENCY_MONITOR_DUMP_PERIOD =
+        mrpt::get_env<double>("MRPT_SLAM_LATENCY_MONITOR_DUMP_PERIOD", 10.0);
+    m_latencyMonitor.enable();
+    m_latencyMonitor.enablePeriodicDump(SLAM_LATENCY_MONITOR_DUMP_PERIOD);
+  }
 }
 
 /*---------------------------------------------------------------
@@ -41,6 +53,16 @@ CMetricMapBuilderICP::CMetricMapBuilderICP() : ICP_options(m_min_verbosity_level
   ---------------------------------------------------------------*/
 CMetricMapBuilderICP::~CMetricMapBuilderICP()
 {
+  // Wait for any background map insertion still in flight:
+  try
+  {
+    joinPendingMapUpdate();
+  }
+  catch (const std::exception& e)
+  {
+    MRPT_LOG_ERROR_STREAM("Exception in pending background map insertion:\n" << e.what());
+  }
+
   // Ensure, we have exit all critical zones:
   enterCriticalSection();
   leaveCriticalSection();
@@ -74,6 +96,7 @@ CMetricMapBuilderICP::TConfigParams& CMetricMapBuilderICP::TConfigParams::operat
   localizationLinDistance = other.localizationLinDistance;
   localizationAngDistance = other.localizationAngDistance;
   minICPgoodnessToAccept = other.minICPgoodnessToAccept;
+  pipelinedMapInsertion = other.pipelinedMapInsertion;
   //	We can't copy a reference type
   //	verbosity_level         = other.verbosity_level;
   mapInitializers = other.mapInitializers;
@@ -92,6 +115,7 @@ void CMetricMapBuilderICP::TConfigParams::loadFromConfigFile(
       source.read_enum<mrpt::system::VerbosityLevel>(section, "verbosity_level", verbosity_level);
 
   MRPT_LOAD_CONFIG_VAR(minICPgoodnessToAccept, double, source, section)
+  MRPT_LOAD_CONFIG_VAR(pipelinedMapInsertion, bool, source, section)
 
   mapInitializers.loadFromConfigFile(source, section);
 }
@@ -110,6 +134,8 @@ void CMetricMapBuilderICP::TConfigParams::dumpToTextStream(std::ostream& out) co
   out << mrpt::format(
       "verbosity_level                         = %s\n",
       mrpt::typemeta::TEnumType<mrpt::system::VerbosityLevel>::value2name(verbosity_level).c_str());
+  out << mrpt::format(
+      "pipelinedMapInsertion                   = %c\n", pipelinedMapInsertion ? 'Y' : 'N');
 
   out << "  Now showing 'mapsInitializers':\n";
   mapInitializers.dumpToTextStream(out);
@@ -123,6 +149,8 @@ void CMetricMapBuilderICP::TConfigParams::dumpToTextStream(std::ostream& out) co
   ---------------------------------------------------------------*/
 void CMetricMapBuilderICP::processObservation(const CObservation::Ptr& obs)
 {
+  mrpt::system::CLatencyMonitorEntry lme(m_latencyMonitor, "processObservation");
+
   auto lck = mrpt::lockHelper(critZoneChangingMap);
 
   MRPT_START
@@ -279,6 +307,10 @@ void CMetricMapBuilderICP::processObservation(const CObservation::Ptr& obs)
         can_do_icp = sensedPoints.insertObservationPtr(obs);
       }
 
+      // From this point on we read the metric map contents, so any
+      // pipelined insertion of the previous scan must have finished:
+      joinPendingMapUpdate();
+
       if (IS_DERIVED(*matchWith, CPointsMap) && static_cast<CPointsMap*>(matchWith)->empty())
         can_do_icp = false;  // The reference map is empty!
 
@@ -366,6 +398,7 @@ void CMetricMapBuilderICP::processObservation(const CObservation::Ptr& obs)
     //  that actually insert some points into the map used as a
     //  reference, since otherwise we'll not be able to do ICP
     //  against an empty map!!
+    joinPendingMapUpdate();  // (no-op unless ICP was skipped above)
     if (matchWith && matchWith->isEmpty()) update = true;
 
     MRPT_LOG_DEBUG_STREAM(
@@ -374,10 +407,6 @@ void CMetricMapBuilderICP::processObservation(const CObservation::Ptr& obs)
 
     if (options.enableMapUpdating && update)
     {
-      CTicTac tictac;
-
-      tictac.Tic();
-
       // Insert the observation:
       CPose2D currentKnownRobotPose;
       m_lastPoseEst.getLatestRobotPose(currentKnownRobotPose);
@@ -392,27 +421,24 @@ void CMetricMapBuilderICP::processObservation(const CObservation::Ptr& obs)
       MRPT_LOG_INFO(
           mrpt::format("Updating map from pose %s\n", currentKnownRobotPose.asString().c_str()));
 
-      CPose3D estimatedPose3D(currentKnownRobotPose);
-      const bool anymap_update = metricMap.insertObservationPtr(obs, estimatedPose3D);
-      if (!anymap_update)
-        MRPT_LOG_WARN_STREAM(
-            "**No map was updated** after inserting an "
-            "observation of "
-            "type `"
-            << obs->GetRuntimeClass()->className << "`");
-
-      // Add to the vector of "poses"-"SFs" pairs:
-      CPosePDFGaussian posePDF(currentKnownRobotPose);
-      CPose3DPDF::Ptr pose3D = CPose3DPDF::Ptr(CPose3DPDF::createFrom2D(posePDF));
-
-      CSensoryFrame::Ptr sf = std::make_shared<CSensoryFrame>();
-      sf->insert(obs);
-
-      SF_Poses_seq.insert(pose3D, sf);
-
-      MRPT_LOG_INFO_STREAM(
-          "Map updated OK. Done in " << mrpt::system::formatTimeInterval(tictac.Tac())
-                                     << std::endl);
+      if (ICP_options.pipelinedMapInsertion)
+      {
+        // Hand the insertion over to the worker thread, so this method
+        // can return and the next scan be preprocessed while the map is
+        // being updated. joinPendingMapUpdate() above guarantees the
+        // previous insertion (if any) has already finished.
+        if (!m_mapUpdatePool)
+          m_mapUpdatePool = std::make_shared<mrpt::WorkerThreadsPool>(
+              1, mrpt::WorkerThreadsPool::POLICY_FIFO, "CMetricMapBuilderICP_mapUpdate");
+
+        m_pendingMapUpdate = m_mapUpdatePool->enqueue(
+            [this, obs, currentKnownRobotPose]()
+            { this->internal_updateMapWithObservation(obs, currentKnownRobotPose); });
+      }
+      else
+      {
+        this->internal_updateMapWithObservation(obs, currentKnownRobotPose);
+      }
     }
 
   }  // end other observation
@@ -427,6 +453,40 @@ void CMetricMapBuilderICP::processObservation(const CObservation::Ptr& obs)
 
 }  // end processObservation
 
+void CMetricMapBuilderICP::joinPendingMapUpdate() const
+{
+  if (!m_pendingMapUpdate.valid()) return;
+  m_pendingMapUpdate.get();  // rethrows any exception from the worker
+}
+
+void CMetricMapBuilderICP::internal_updateMapWithObservation(
+    const CObservation::Ptr& obs, const CPose2D& robotPose)
+{
+  CTicTac tictac;
+  tictac.Tic();
+
+  const CPose3D estimatedPose3D(robotPose);
+  const bool anymap_update = metricMap.insertObservationPtr(obs, estimatedPose3D);
+  if (!anymap_update)
+    MRPT_LOG_WARN_STREAM(
+        "**No map was updated** after inserting an "
+        "observation of "
+        "type `"
+        << obs->GetRuntimeClass()->className << "`");
+
+  // Add to the vector of "poses"-"SFs" pairs:
+  CPosePDFGaussian posePDF(robotPose);
+  CPose3DPDF::Ptr pose3D = CPose3DPDF::Ptr(CPose3DPDF::createFrom2D(posePDF));
+
+  CSensoryFrame::Ptr sf = std::make_shared<CSensoryFrame>();
+  sf->insert(obs);
+
+  SF_Poses_seq.insert(pose3D, sf);
+
+  MRPT_LOG_INFO_STREAM(
+      "Map updated OK. Done in " << mrpt::system::formatTimeInterval(tictac.Tac()) << std::endl);
+}
+
 /*---------------------------------------------------------------
 
             processActionObservation
@@ -497,6 +557,7 @@ void CMetricMapBuilderICP::initialize(const CSimpleMap& initialMap, const CPoseP
 
   // Init path & map:
   auto lck = mrpt::lockHelper(critZoneChangingMap);
+  joinPendingMapUpdate();
 
   // Create metric maps:
   metricMap.setListOfMaps(ICP_options.mapInitializers);
@@ -527,6 +588,7 @@ void CMetricMapBuilderICP::initialize(const CSimpleMap& initialMap, const CPoseP
 void CMetricMapBuilderICP::getCurrentMapPoints(std::vector<float>& x, std::vector<float>& y)
 {
   auto lck = mrpt::lockHelper(critZoneChangingMap);
+  joinPendingMapUpdate();
 
   auto pPts = metricMap.mapByClass<CPointsMap>(0);
 
@@ -539,18 +601,24 @@ void CMetricMapBuilderICP::getCurrentMapPoints(std::vector<float>& x, std::vecto
   ---------------------------------------------------------------*/
 void CMetricMapBuilderICP::getCurrentlyBuiltMap(CSimpleMap& out_map) const
 {
+  joinPendingMapUpdate();
   out_map = SF_Poses_seq;
 }
 
 const CMultiMetricMap& CMetricMapBuilderICP::getCurrentlyBuiltMetricMap() const
 {
+  joinPendingMapUpdate();
   return metricMap;
 }
 
 /*---------------------------------------------------------------
       getCurrentlyBuiltMapSize
   ---------------------------------------------------------------*/
-unsigned int CMetricMapBuilderICP::getCurrentlyBuiltMapSize() { return SF_Poses_seq.size(); }
+unsigned int CMetricMapBuilderICP::getCurrentlyBuiltMapSize()
+{
+  joinPendingMapUpdate();
+  return SF_Poses_seq.size();
+}
 
 /*---------------------------------------------------------------
         saveCurrentEstimationToImage
@@ -559,6 +627,8 @@ void CMetricMapBuilderICP::saveCurrentEstimationToImage(const std::string& file,
 {
   MRPT_START
 
+  joinPendingMapUpdate();
+
   CImage img;
   const size_t nPoses = m_estRobotPath.size();
 
@@ -251,7 +251,10 @@ void CMetricMapBuilderRBPF::processActionObservation(
   // Added 29/JUN/2007 JLBC: Tell all maps that they can now free aux.
   // variables
   //  (if any) since one PF cycle is over:
-  for (auto& m_particle : mapPDF.m_particles) m_particle.d->mapTillNow.auxParticleFilterCleanUp();
+  // (shared_mutable() avoids materializing copy-on-write shared maps just to
+  // clear caches; calling this more than once on a shared map is harmless)
+  for (auto& m_particle : mapPDF.m_particles)
+    m_particle.d->mapTillNow.shared_mutable().auxParticleFilterCleanUp();
 
   MRPT_END
 }
@@ -9,13 +9,18 @@
 
 #include "slam-precomp.h"  // Precompiled headers
 //
+#include <mrpt/core/bits_math.h>
 #include <mrpt/maps/COccupancyGridMap2D.h>
 #include <mrpt/obs/CActionCollection.h>
+#include <mrpt/obs/CObservation2DRangeScan.h>
 #include <mrpt/obs/CSensoryFrame.h>
 #include <mrpt/random.h>
 #include <mrpt/slam/CMonteCarloLocalization2D.h>
 #include <mrpt/system/CTicTac.h>
 
+#include <cmath>
+#include <limits>
+
 #include "PF_aux_structs.h"
 
 using namespace mrpt;
@@ -72,6 +77,86 @@ CMonteCarloLocalization2D::CMonteCarloLocalization2D(size_t M) : CPosePDFParticl
 }
 
 CMonteCarloLocalization2D::~CMonteCarloLocalization2D() = default;
+
+TKLDParams CMonteCarloLocalization2D::internal_adjustKLDForDeadline(const TKLDParams& in) const
+{
+  if (options.max_update_time_ms <= 0 || m_avgTimePerParticleMs <= 0) return in;
+
+  TKLDParams out = in;
+
+  // Particle budget for this step, from the measured per-particle cost:
+  const double budget =
+      std::max<double>(in.KLD_minSampleSize, options.max_update_time_ms / m_avgTimePerParticleMs);
+
+  mrpt::keep_min(
+      out.KLD_maxSampleSize,
+      static_cast<unsigned int>(
+          std::min<double>(budget, std::numeric_limits<unsigned int>::max())));
+
+  // If even the current particle set exceeds the budget (e.g. during
+  // relocalization bursts), coarsen the KLD bins too: fewer occupied bins
+  // make the adaptive sample size itself converge to a smaller count,
+  // instead of relying only on the hard cap above:
+  const double overload = static_cast<double>(m_particles.size()) / budget;
+  if (overload > 1.0)
+  {
+    const double s = std::min(4.0, std::sqrt(overload));
+    out.KLD_binSize_XY *= s;
+    out.KLD_binSize_PHI *= s;
+  }
+  return out;
+}
+
+std::shared_ptr<CSensoryFrame> CMonteCarloLocalization2D::internal_decimateObservationsForDeadline(
+    const CSensoryFrame* sf) const
+{
+  if (!sf || options.max_update_time_ms <= 0 || m_avgTimePerParticleMs <= 0 ||
+      options.max_observation_decimation <= 1)
+    return nullptr;
+
+  const double budget =
+      std::max<double>(1.0, options.max_update_time_ms / m_avgTimePerParticleMs);
+  const double overload = static_cast<double>(m_particles.size()) / budget;
+  if (overload <= 1.0) return nullptr;
+
+  // The per-particle cost scales with the number of valid rays, so decimating
+  // rays by the overload factor brings the step back near the budget even
+  // when the particle count cannot shrink any further this step:
+  const auto decimation = std::min<unsigned int>(
+      options.max_observation_decimation, static_cast<unsigned int>(std::ceil(overload)));
+  if (decimation <= 1) return nullptr;
+
+  auto out = CSensoryFrame::Create();
+  for (const auto& obs : *sf)
+  {
+    if (auto scan = std::dynamic_pointer_cast<CObservation2DRangeScan>(obs); scan)
+    {
+      auto decimated =
+          std::dynamic_pointer_cast<CObservation2DRangeScan>(scan->duplicateGetSmartPtr());
+      // Invalidate skipped rays instead of resizing, so the angular aperture
+      // and per-ray geometry remain untouched:
+      const size_t n = decimated->getScanSize();
+      for (size_t i = 0; i < n; i++)
+        if ((i % decimation) != 0) decimated->setScanRangeValidity(i, false);
+      out->insert(decimated);
+    }
+    else
+    {
+      out->insert(obs);  // Other observation types are passed through as-is
+    }
+  }
+  return out;
+}
+
+void CMonteCarloLocalization2D::internal_noteUpdateTime(const double dt_ms)
+{
+  const auto N = std::max<size_t>(1, m_particles.size());
+  const double perParticle = dt_ms / static_cast<double>(N);
+  // EMA so a single outlier step does not destabilize the controller:
+  m_avgTimePerParticleMs =
+      m_avgTimePerParticleMs <= 0 ? perParticle : 0.9 * m_avgTimePerParticleMs + 0.1 * perParticle;
+  profiler.registerUserMeasure("time_per_particle_ms", perParticle);
+}
 TPose3D CMonteCarloLocalization2D::getLastPose(size_t i, bool& is_valid_pose) const
 {
   if (i >= m_particles.size()) THROW_EXCEPTION("Particle index out of bounds!");
@@ -97,8 +182,16 @@ void CMonteCarloLocalization2D::prediction_and_update_pfStandardProposal(
     if (!options.metricMap) ASSERT_(options.metricMaps.size() == m_particles.size());
   }
 
+  const TKLDParams kld = internal_adjustKLDForDeadline(options.KLD_params);
+  const auto decimatedSF = internal_decimateObservationsForDeadline(sf);
+
+  mrpt::system::CTimeLoggerEntry tle(profiler, "prediction_and_update_pfStandardProposal");
+  mrpt::system::CTicTac tictac;
+
   PF_SLAM_implementation_pfStandardProposal<mrpt::slam::detail::TPoseBin2D>(
-      actions, sf, PF_options, options.KLD_params);
+      actions, decimatedSF ? decimatedSF.get() : sf, PF_options, kld);
+
+  internal_noteUpdateTime(1e3 * tictac.Tac());
 
   MRPT_END
 }
@@ -121,8 +214,16 @@ void CMonteCarloLocalization2D::prediction_and_update_pfAuxiliaryPFStandard(
     if (!options.metricMap) ASSERT_(options.metricMaps.size() == m_particles.size());
   }
 
+  const TKLDParams kld = internal_adjustKLDForDeadline(options.KLD_params);
+  const auto decimatedSF = internal_decimateObservationsForDeadline(sf);
+
+  mrpt::system::CTimeLoggerEntry tle(profiler, "prediction_and_update_pfAuxiliaryPFStandard");
+  mrpt::system::CTicTac tictac;
+
   PF_SLAM_implementation_pfAuxiliaryPFStandard<mrpt::slam::detail::TPoseBin2D>(
-      actions, sf, PF_options, options.KLD_params);
+      actions, decimatedSF ? decimatedSF.get() : sf, PF_options, kld);
+
+  internal_noteUpdateTime(1e3 * tictac.Tac());
 
   MRPT_END
 }
@@ -145,8 +246,16 @@ void CMonteCarloLocalization2D::prediction_and_update_pfAuxiliaryPFOptimal(
     if (!options.metricMap) ASSERT_(options.metricMaps.size() == m_particles.size());
   }
 
+  const TKLDParams kld = internal_adjustKLDForDeadline(options.KLD_params);
+  const auto decimatedSF = internal_decimateObservationsForDeadline(sf);
+
+  mrpt::system::CTimeLoggerEntry tle(profiler, "prediction_and_update_pfAuxiliaryPFOptimal");
+  mrpt::system::CTicTac tictac;
+
   PF_SLAM_implementation_pfAuxiliaryPFOptimal<mrpt::slam::detail::TPoseBin2D>(
-      actions, sf, PF_options, options.KLD_params);
+      actions, decimatedSF ? decimatedSF.get() : sf, PF_options, kld);
+
+  internal_noteUpdateTime(1e3 * tictac.Tac());
 
   MRPT_END
 }
@@ -101,6 +101,7 @@ void CMonteCarloLocalization3D::prediction_and_update_pfStandardProposal(
     ASSERT_(options.metricMap || options.metricMaps.size() > 0);
     if (!options.metricMap) ASSERT_(options.metricMaps.size() == m_particles.size());
   }
+  m_sharedLikelihoodCache.clear();  // new observation => old bins are stale
 
   PF_SLAM_implementation_pfStandardProposal<mrpt::slam::detail::TPoseBin3D>(
       actions, sf, PF_options, options.KLD_params);
@@ -125,6 +126,7 @@ void CMonteCarloLocalization3D::prediction_and_update_pfAuxiliaryPFStandard(
     ASSERT_(options.metricMap || options.metricMaps.size() > 0);
     if (!options.metricMap) ASSERT_(options.metricMaps.size() == m_particles.size());
   }
+  m_sharedLikelihoodCache.clear();  // new observation => old bins are stale
 
   PF_SLAM_implementation_pfAuxiliaryPFStandard<mrpt::slam::detail::TPoseBin3D>(
       actions, sf, PF_options, options.KLD_params);
@@ -149,6 +151,7 @@ void CMonteCarloLocalization3D::prediction_and_update_pfAuxiliaryPFOptimal(
     ASSERT_(options.metricMap || options.metricMaps.size() > 0);
     if (!options.metricMap) ASSERT_(options.metricMaps.size() == m_particles.size());
   }
+  m_sharedLikelihoodCache.clear();  // new observation => old bins are stale
 
   PF_SLAM_implementation_pfAuxiliaryPFOptimal<mrpt::slam::detail::TPoseBin3D>(
       actions, sf, PF_options, options.KLD_params);
@@ -170,11 +173,29 @@ double CMonteCarloLocalization3D::PF_SLAM_computeObservationLikelihoodForParticl
   // All particles, one map, or one map per particle
   auto map = (options.metricMap) ? options.metricMap : options.metricMaps[particleIndexForMap];
 
+  // Shared-likelihood binning mode: particles within the same pose bin share
+  // one likelihood evaluation, so the scan is transformed and matched against
+  // the map only once per occupied bin. Only applicable with one shared map.
+  const bool useSharedBins = options.likelihood_bin_size_XYZ > 0 && options.metricMap;
+  std::array<int32_t, 6> bin;
+  if (useSharedBins)
+  {
+    const double& sXYZ = options.likelihood_bin_size_XYZ;
+    const double& sPHI = options.likelihood_bin_size_PHI;
+    bin = {
+        round(x.x() / sXYZ),   round(x.y() / sXYZ),     round(x.z() / sXYZ),
+        round(x.yaw() / sPHI), round(x.pitch() / sPHI), round(x.roll() / sPHI)};
+    const auto it = m_sharedLikelihoodCache.find(bin);
+    if (it != m_sharedLikelihoodCache.end()) return it->second;
+  }
+
   // For each observation:
   double ret = 1;
   for (const auto& it : observation)
     ret += map->computeObservationLikelihood(*it, x);  // Compute the likelihood:
 
+  if (useSharedBins) m_sharedLikelihoodCache[bin] = ret;
+
   // Done!
   return ret;
 }
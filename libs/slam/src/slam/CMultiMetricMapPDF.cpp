@@ -83,7 +83,7 @@ void CMultiMetricMapPDF::clear(const CPose3D& initialPose)
   {
     m_particles[i].log_w = 0;
 
-    m_particles[i].d->mapTillNow.clear();
+    m_particles[i].d->mapTillNow.write().clear();
 
     m_particles[i].d->robotPath.resize(1);
     m_particles[i].d->robotPath[0] = initialPose.asTPose();
@@ -110,7 +110,7 @@ void CMultiMetricMapPDF::clear(
     auto& p = m_particles[idxPart];
     p.log_w = 0;
 
-    p.d->mapTillNow.clear();
+    p.d->mapTillNow.write().clear();
 
     p.d->robotPath.resize(nOldKeyframes);
     for (size_t i = 0; i < nOldKeyframes; i++)
@@ -138,7 +138,8 @@ void CMultiMetricMapPDF::clear(
         kf_pose = keyframe_pose->getMeanVal();
       }
       p.d->robotPath[i] = kf_pose.asTPose();
-      for (const auto& obs : *sfkeyframe_sf) p.d->mapTillNow.insertObservation(*obs, kf_pose);
+      for (const auto& obs : *sfkeyframe_sf)
+        p.d->mapTillNow.write().insertObservation(*obs, kf_pose);
     }
   }
 
@@ -202,7 +203,7 @@ void CMultiMetricMapPDF::serializeTo(mrpt::serialization::CArchive& out) const
   for (const auto& part : m_particles)
   {
     out << part.log_w;
-    out << part.d->mapTillNow;
+    out << part.d->mapTillNow.read();
     out.WriteAs<uint32_t>(part.d->robotPath.size());
     for (const auto& p : part.d->robotPath) out << p;
   }
@@ -235,7 +236,7 @@ void CMultiMetricMapPDF::serializeFrom(mrpt::serialization::CArchive& in, uint8_
         m_particles[i].d.reset(new CRBPFParticleData());
 
         // Load
-        in >> m_particles[i].log_w >> m_particles[i].d->mapTillNow;
+        in >> m_particles[i].log_w >> m_particles[i].d->mapTillNow.write();
 
         in >> m;
         m_particles[i].d->robotPath.resize(m);
@@ -282,9 +283,9 @@ void CMultiMetricMapPDF::rebuildAverageMap()
   // ---------------------------------------------------------
   for (auto& p : m_particles)
   {
-    ASSERT_(p.d->mapTillNow.countMapsByClass<COccupancyGridMap2D>() > 0);
+    ASSERT_(p.d->mapTillNow.read().countMapsByClass<COccupancyGridMap2D>() > 0);
 
-    auto grid = p.d->mapTillNow.mapByClass<COccupancyGridMap2D>(0);
+    auto grid = p.d->mapTillNow.read().mapByClass<COccupancyGridMap2D>(0);
 
     min_x = min(min_x, grid->getXMin());
     max_x = max(max_x, grid->getXMax());
@@ -292,17 +293,22 @@ void CMultiMetricMapPDF::rebuildAverageMap()
     max_y = max(max_y, grid->getYMax());
   }
 
-  // Ensure all maps have the same dimensions:
+  // Ensure all maps have the same dimensions. Check the bounds before
+  // requesting mutable access, to avoid needlessly materializing a private
+  // copy of maps shared between particles (copy-on-write):
   for (auto& p : m_particles)
   {
-    auto grid = p.d->mapTillNow.mapByClass<COccupancyGridMap2D>(0);
-    grid->resizeGrid(min_x, max_x, min_y, max_y, 0.5f, false);
+    auto grid = p.d->mapTillNow.read().mapByClass<COccupancyGridMap2D>(0);
+    if (grid->getXMin() > min_x || grid->getXMax() < max_x || grid->getYMin() > min_y ||
+        grid->getYMax() < max_y)
+      p.d->mapTillNow.write().mapByClass<COccupancyGridMap2D>(0)->resizeGrid(
+          min_x, max_x, min_y, max_y, 0.5f, false);
   }
 
   float grid_resolution = 0.1f;
   for (auto& p : m_particles)
   {
-    auto grid = p.d->mapTillNow.mapByClass<COccupancyGridMap2D>(0);
+    auto grid = p.d->mapTillNow.read().mapByClass<COccupancyGridMap2D>(0);
     grid_resolution = grid->getResolution();
 
     min_x = min(min_x, grid->getXMin());
@@ -323,7 +329,7 @@ void CMultiMetricMapPDF::rebuildAverageMap()
   // CHECK:
   for (auto& p : m_particles)
   {
-    auto grid = p.d->mapTillNow.mapByClass<COccupancyGridMap2D>(0);
+    auto grid = p.d->mapTillNow.read().mapByClass<COccupancyGridMap2D>(0);
     ASSERT_(grid->getSizeX() == avrg_grid->getSizeX());
     ASSERT_(grid->getSizeY() == avrg_grid->getSizeY());
   }
@@ -347,7 +353,7 @@ void CMultiMetricMapPDF::rebuildAverageMap()
 
     for (auto& p : m_particles)
     {
-      auto grid = p.d->mapTillNow.mapByClass<COccupancyGridMap2D>(0);
+      auto grid = p.d->mapTillNow.read().mapByClass<COccupancyGridMap2D>(0);
       // Variables:
       std::vector<COccupancyGridMap2D::cellType>::iterator srcCell;
       auto firstSrcCell = grid->m_map.begin();
@@ -404,7 +410,10 @@ bool CMultiMetricMapPDF::insertObservation(CSensoryFrame& sf)
     bool pose_is_valid;
     const CPose3D robotPose = CPose3D(getLastPose(i, pose_is_valid));
     // ASSERT_(pose_is_valid); // if not, use the default (0,0,0)
-    const bool map_modified = sf.insertObservationsInto(m_particles[i].d->mapTillNow, robotPose);
+    // write() materializes a private copy of the map if it is still being
+    // shared with other particles after a resampling step:
+    const bool map_modified =
+        sf.insertObservationsInto(m_particles[i].d->mapTillNow.write(), robotPose);
     anymap = anymap || map_modified;
   }
 
@@ -466,7 +475,7 @@ double CMultiMetricMapPDF::getCurrentJointEntropy()
   // Make sure all grids have the same size
   for (auto& p : m_particles)
   {
-    auto grid = p.d->mapTillNow.mapByClass<COccupancyGridMap2D>(0);
+    auto grid = p.d->mapTillNow.read().mapByClass<COccupancyGridMap2D>(0);
     ASSERT_(grid);
 
     min_x = min(min_x, grid->getXMin());
@@ -475,11 +484,15 @@ double CMultiMetricMapPDF::getCurrentJointEntropy()
     max_y = max(max_y, grid->getYMax());
   }
 
-  // Ensure all maps have the same dimensions:
+  // Ensure all maps have the same dimensions (as in rebuildAverageMap(),
+  // check first to preserve copy-on-write sharing between particles):
   for (auto& p : m_particles)
   {
-    auto grid = p.d->mapTillNow.mapByClass<COccupancyGridMap2D>(0);
-    grid->resizeGrid(min_x, max_x, min_y, max_y, 0.5f, false);
+    auto grid = p.d->mapTillNow.read().mapByClass<COccupancyGridMap2D>(0);
+    if (grid->getXMin() > min_x || grid->getXMax() < max_x || grid->getYMin() > min_y ||
+        grid->getYMax() < max_y)
+      p.d->mapTillNow.write().mapByClass<COccupancyGridMap2D>(0)->resizeGrid(
+          min_x, max_x, min_y, max_y, 0.5f, false);
   }
 
   // Sum of linear weights:
@@ -491,7 +504,7 @@ double CMultiMetricMapPDF::getCurrentJointEntropy()
   H_maps = 0;
   for (auto& p : m_particles)
   {
-    auto grid = p.d->mapTillNow.mapByClass<COccupancyGridMap2D>(0);
+    auto grid = p.d->mapTillNow.read().mapByClass<COccupancyGridMap2D>(0);
 
     grid->computeEntropy(entropy);
     H_maps += exp(p.log_w) * entropy.H / sumLinearWeights;
@@ -519,7 +532,7 @@ const CMultiMetricMap* CMultiMetricMapPDF::getCurrentMostLikelyMetricMap() const
   }
 
   // Return its map:
-  return &m_particles[max_i].d->mapTillNow;
+  return &m_particles[max_i].d->mapTillNow.read();
 }
 
 /*---------------------------------------------------------------
@@ -269,8 +269,10 @@ void CMultiMetricMapPDF::prediction_and_update_pfOptimalProposal(
     {
       CPosePDFGaussian icpEstimation;
 
-      // Configure the matchings that will take place in the ICP process:
-      auto partMap = partIt->d->mapTillNow;
+      // Configure the matchings that will take place in the ICP process.
+      // Note: read-only access; aligning does not modify the map, so this
+      // neither deep-copies it nor breaks copy-on-write sharing:
+      const auto& partMap = partIt->d->mapTillNow.read();
       const auto numPtMaps = partMap.countMapsByClass<CSimplePointsMap>();
 
       ASSERT_(numPtMaps == 0 || numPtMaps == 1);
@@ -375,7 +377,9 @@ void CMultiMetricMapPDF::prediction_and_update_pfOptimalProposal(
       //     Perform optimal sampling with the beacon map:
       //  Described in paper: IROS 2008
       // --------------------------------------------------------
-      auto beacMap = partIt->d->mapTillNow.mapByClass<CBeaconMap>();
+      // This branch may refine the beacon PDFs below, so request mutable
+      // (copy-on-write) access to the map:
+      auto beacMap = partIt->d->mapTillNow.write().mapByClass<CBeaconMap>();
 
       // We'll also update the weight of the particle here
       updateStageAlreadyDone = true;
@@ -856,7 +860,7 @@ bool CMultiMetricMapPDF::PF_SLAM_implementation_doWeHaveValidObservations(
 {
   if (sf == nullptr) return false;
   ASSERT_(!particles.empty());
-  return particles.begin()->d.get()->mapTillNow.canComputeObservationsLikelihood(*sf);
+  return particles.begin()->d.get()->mapTillNow.read().canComputeObservationsLikelihood(*sf);
 }
 
 /** Do not move the particles until the map is populated.  */
@@ -875,8 +879,8 @@ double CMultiMetricMapPDF::PF_SLAM_computeObservationLikelihoodForParticle(
     const CSensoryFrame& observation,
     const CPose3D& x) const
 {
-  auto* map = const_cast<CMultiMetricMap*>(&m_particles[particleIndexForMap].d->mapTillNow);
+  const auto& map = m_particles[particleIndexForMap].d->mapTillNow.read();
   double ret = 0;
-  for (const auto& it : observation) ret += map->computeObservationLikelihood(*it, x);
+  for (const auto& it : observation) ret += map.computeObservationLikelihood(*it, x);
   return ret;
 }
@@ -11,6 +11,8 @@
 //
 #include <mrpt/slam/COccupancyGridMapFeatureExtractor.h>
 
+#include <algorithm>
+
 using namespace mrpt;
 using namespace mrpt::maps;
 using namespace mrpt::slam;
@@ -85,26 +87,149 @@ void COccupancyGridMapFeatureExtractor::extractFeatures(
 	uncached_extractFeatures(grid,outMap,number_of_features,descriptors,feat_options);
 #else
   // Use cache mechanism:
+  MRPT_START
+
+  const std::vector<uint32_t>& tileCnt = grid.getTileChangeCounters();
 
   auto it = m_cache.find(&grid);
-  if (it == m_cache.end())
+
+  // A geometry change (resize, origin shift, different resolution) makes the
+  // tile counters incomparable, so it forces a full re-extraction:
+  const bool fullExtraction = it == m_cache.end() || it->second.xMin != grid.getXMin() ||
+                              it->second.yMin != grid.getYMin() ||
+                              it->second.resolution != grid.getResolution() ||
+                              it->second.sizeX != grid.getSizeX() ||
+                              it->second.sizeY != grid.getSizeY() ||
+                              it->second.tileCounters.size() != tileCnt.size();
+  if (fullExtraction)
+  {
+    TCacheEntry e;
+    e.features = std::make_shared<CLandmarksMap>();
+    uncached_extractFeatures(grid, *e.features, number_of_features, descriptors, feat_options);
+
+    e.tileCounters = tileCnt;
+    e.xMin = grid.getXMin();
+    e.yMin = grid.getYMin();
+    e.resolution = grid.getResolution();
+    e.sizeX = grid.getSizeX();
+    e.sizeY = grid.getSizeY();
+
+    outMap = *e.features;
+    m_cache[&grid] = std::move(e);
+    return;
+  }
+
+  TCacheEntry& e = it->second;
+
+  // Bounding rectangle (in cells) of the tiles modified since the cached
+  // extraction:
+  constexpr int T = COccupancyGridMap2D::CHANGE_COUNTER_TILE_SIZE;
+  const int tilesX = grid.getTileChangeCountX();
+  int dcx0 = 0, dcx1 = -1, dcy0 = 0, dcy1 = -1;
+  for (size_t i = 0; i < tileCnt.size(); i++)
+  {
+    if (tileCnt[i] == e.tileCounters[i]) continue;
+    const int tx = int(i) % tilesX, ty = int(i) / tilesX;
+    if (dcx1 < 0)
+    {
+      dcx0 = tx * T;
+      dcx1 = (tx + 1) * T - 1;
+      dcy0 = ty * T;
+      dcy1 = (ty + 1) * T - 1;
+    }
+    else
+    {
+      dcx0 = std::min(dcx0, tx * T);
+      dcx1 = std::max(dcx1, (tx + 1) * T - 1);
+      dcy0 = std::min(dcy0, ty * T);
+      dcy1 = std::max(dcy1, (ty + 1) * T - 1);
+    }
+  }
+  if (dcx1 < 0)
+  {
+    // Nothing changed: serve from the cache.
+    outMap = *e.features;
+    return;
+  }
+  dcx1 = std::min<int>(grid.getSizeX() - 1, dcx1);
+  dcy1 = std::min<int>(grid.getSizeY() - 1, dcy1);
+
+  // Re-extract only the dirty area, with a margin so features near its
+  // boundary see the same image context as in a full extraction:
+  constexpr int margin = 16;
+  const int px0 = std::max(0, dcx0 - margin), py0 = std::max(0, dcy0 - margin);
+  const int px1 = std::min<int>(grid.getSizeX() - 1, dcx1 + margin);
+  const int py1 = std::min<int>(grid.getSizeY() - 1, dcy1 + margin);
+
+  CImage img, patch;
+  grid.getAsImageFiltered(img, true /*vertical flip*/, false /* force RGB */);
+  img.extract_patch(patch, px0, py0, px1 - px0 + 1, py1 - py0 + 1);
+
+  // Scale the feature budget to the area being refreshed:
+  const size_t totalCells = size_t(grid.getSizeX()) * grid.getSizeY();
+  const size_t patchCells = size_t(px1 - px0 + 1) * (py1 - py0 + 1);
+  const size_t nSubFeats =
+      std::max<size_t>(10, (number_of_features * patchCells + totalCells - 1) / totalCells);
+
+  vision::CFeatureExtraction fExt;
+  vision::CFeatureList lstFeatures;
+  fExt.options = feat_options;
+  fExt.options.patchSize = 0;  // Do NOT extract patch
+  fExt.detectFeatures(patch, lstFeatures, 0 /* Init ID */, nSubFeats);
+  if (descriptors != mrpt::vision::descAny)
+    fExt.computeDescriptors(patch, lstFeatures, descriptors);
+
+  // Merge: cached landmarks outside the dirty rectangle + fresh ones inside
+  // it (fresh features in the margin area are discarded, since their cached
+  // counterparts are still valid):
+  const float res = grid.getResolution();
+  CLandmarksMap::Ptr merged = std::make_shared<CLandmarksMap>();
+
+  for (const auto& lm : e.features->landmarks)
   {
-    // We have to recompute the features:
-    CLandmarksMap::Ptr theMap = std::make_shared<CLandmarksMap>();
+    const int cx = static_cast<int>((lm.pose_mean.x - grid.getXMin()) / res);
+    const int cy = static_cast<int>((lm.pose_mean.y - grid.getYMin()) / res);
+    if (cx >= dcx0 && cx <= dcx1 && cy >= dcy0 && cy <= dcy1) continue;  // outdated
+    merged->landmarks.push_back(lm);
+  }
+
+  for (auto& ft : lstFeatures)
+  {
+    const int cx = px0 + static_cast<int>(ft.keypoint.pt.x);
+    const int cy = py0 + static_cast<int>(ft.keypoint.pt.y);
+    if (cx < dcx0 || cx > dcx1 || cy < dcy0 || cy > dcy1) continue;  // margin-only
+
+    CLandmark lm;
+    lm.features.resize(1);
+    lm.features[0] = ft;
 
-    uncached_extractFeatures(grid, *theMap, number_of_features, descriptors, feat_options);
+    lm.pose_mean.x = grid.getXMin() + (px0 + ft.keypoint.pt.x + 0.5f) * res;
+    lm.pose_mean.y = grid.getYMin() + (py0 + ft.keypoint.pt.y + 0.5f) * res;
+    lm.pose_mean.z = 0;
+
+    lm.pose_cov_11 = lm.pose_cov_22 = lm.pose_cov_33 = square(res);
+    lm.pose_cov_12 = lm.pose_cov_13 = lm.pose_cov_23 = 0;
 
-    outMap = *theMap;
+    lm.seenTimesCount = 1;
 
-    // Insert into the cache:
-    m_cache[&grid] = theMap;
+    merged->landmarks.push_back(lm);
   }
-  else
+
+  // Re-assign unique, consecutive IDs over the merged map:
   {
-    // Already in the cache:
-    outMap = *(it->second);
+    CLandmark::TLandmarkID nextID = 0;
+    for (auto& lm : merged->landmarks)
+    {
+      lm.ID = nextID++;
+      if (!lm.features.empty()) lm.features[0].keypoint.ID = lm.ID;
+    }
   }
 
+  e.features = merged;
+  e.tileCounters = tileCnt;
+  outMap = *e.features;
+
+  MRPT_END
 #endif
 }
 
@@ -120,9 +245,9 @@ void COccupancyGridMapFeatureExtractor::OnEvent(const mrptEvent& e)
   if (e.isOfType<mrptEventMetricMapClear>())
     src = static_cast<const COccupancyGridMap2D*>(
         static_cast<const mrptEventMetricMapClear*>(&e)->source_map);
-  if (e.isOfType<mrptEventMetricMapInsert>())
-    src = static_cast<const COccupancyGridMap2D*>(
-        static_cast<const mrptEventMetricMapClear*>(&e)->source_map);
+  // Note: mrptEventMetricMapInsert does NOT purge the cache anymore; inserted
+  // observations are handled incrementally via the per-tile change counters
+  // in extractFeatures().
 
   if (src)
   {
@@ -693,6 +693,68 @@ void CRangeBearingKFSLAM::OnNormalizeStateVector()
   MRPT_END
 }
 
+/*---------------------------------------------------------------
+            OnGetUpdateStateMask
+  ---------------------------------------------------------------*/
+bool CRangeBearingKFSLAM::OnGetUpdateStateMask(std::vector<bool>& out_active_mask) const
+{
+  MRPT_START
+
+  if (!options.submapConditionalUpdates || !options.doPartitioningExperiment) return false;
+
+  // With less than two submaps the restricted update would be the dense one:
+  if (m_lastPartitionSet.size() < 2 || m_SFs.empty()) return false;
+
+  // Which partitions were matched by the last data association? (the DA runs
+  // before the update stage, so "results" is up to date here)
+  std::vector<std::vector<uint32_t>> membership;
+  getLastPartitionLandmarks(membership);
+
+  std::set<uint32_t> activeParts;
+  for (const auto& assoc : m_last_data_association.results.associations)
+  {
+    const auto lm_idx = static_cast<size_t>(assoc.second);
+    if (lm_idx >= membership.size()) continue;
+    for (uint32_t p : membership[lm_idx]) activeParts.insert(p);
+  }
+  if (activeParts.empty()) return false;
+
+  // On a submap transition, do one full dense update so the correlations
+  // accumulated while inside the previous submap get propagated to the rest
+  // of the map before we freeze its cross-covariances again:
+  if (activeParts != m_lastActivePartitions)
+  {
+    m_lastActivePartitions = activeParts;
+    return false;
+  }
+
+  // Active state: the vehicle plus every landmark of an active partition.
+  // (The landmarks actually observed this step are forced into the active
+  // set by the generic KF code in any case.)
+  const size_t nLMs = getNumberOfLandmarksInTheMap();
+  out_active_mask.assign(get_vehicle_size() + get_feature_size() * nLMs, false);
+  for (size_t k = 0; k < get_vehicle_size(); k++) out_active_mask[k] = true;
+
+  for (size_t i = 0; i < nLMs && i < membership.size(); i++)
+  {
+    bool isActive = false;
+    for (uint32_t p : membership[i])
+    {
+      if (activeParts.count(p) != 0)
+      {
+        isActive = true;
+        break;
+      }
+    }
+    if (!isActive) continue;
+    for (size_t k = 0; k < get_feature_size(); k++)
+      out_active_mask[get_vehicle_size() + i * get_feature_size() + k] = true;
+  }
+  return true;
+
+  MRPT_END
+}
+
 /*---------------------------------------------------------------
             loadOptions
   ---------------------------------------------------------------*/
@@ -723,6 +785,7 @@ void CRangeBearingKFSLAM::TOptions::loadFromConfigFile(
 
   MRPT_LOAD_CONFIG_VAR(doPartitioningExperiment, bool, source, section);
   MRPT_LOAD_CONFIG_VAR(partitioningMethod, int, source, section);
+  MRPT_LOAD_CONFIG_VAR(submapConditionalUpdates, bool, source, section);
 
   MRPT_LOAD_CONFIG_VAR(create_simplemap, bool, source, section);
 
@@ -767,6 +830,8 @@ void CRangeBearingKFSLAM::TOptions::dumpToTextStream(std::ostream& out) const
   out << mrpt::format(
       "doPartitioningExperiment                = %c\n", doPartitioningExperiment ? 'Y' : 'N');
   out << mrpt::format("partitioningMethod                      = %i\n", partitioningMethod);
+  out << mrpt::format(
+      "submapConditionalUpdates                = %c\n", submapConditionalUpdates ? 'Y' : 'N');
   out << mrpt::format(
       "data_assoc_method                       = %s\n",
       TEnumType<TDataAssociationMethod>::value2name(data_assoc_method).c_str());
@@ -354,10 +354,37 @@ void mrpt::slam::data_association_full_covariance(
                            : -1000 /*A very small log-likelihoo   */);
   results.indiv_compatibility.fill(false);
 
-  CMatrixDouble pred_i_cov(length_O, length_O);
-
   Eigen::VectorXd diff_means_i_j(length_O);
 
+  // Lazily-built cache of the Cholesky factor (and log-determinant) of each
+  // per-prediction innovation covariance block. Each block is constant
+  // across all the observations, so factorizing it at most once here
+  // replaces the O(nPredictions x nObservations) factorizations formerly
+  // done inside mahalanobisDistance2AndLogPDF(); with the kd-tree gating,
+  // only the spatially-plausible predictions get factorized at all.
+  std::vector<Eigen::LLT<Eigen::MatrixXd>> pred_cov_llt(nPredictions);
+  std::vector<double> pred_cov_logdet(nPredictions);
+  std::vector<bool> pred_cov_cached(nPredictions, false);
+  Eigen::VectorXd whitened(length_O);
+
+  const auto evalMaha2AndLogPDF = [&](const size_t i, double& d2, double& ml)
+  {
+    if (!pred_cov_cached[i])
+    {
+      const size_t pred_cov_idx = i * length_O;
+      pred_cov_llt[i].compute(
+          Y_predictions_cov.asEigen().block(pred_cov_idx, pred_cov_idx, length_O, length_O));
+      double half_log_det = 0;
+      for (size_t k = 0; k < length_O; k++) half_log_det += std::log(pred_cov_llt[i].matrixLLT()(k, k));
+      pred_cov_logdet[i] = 2.0 * half_log_det;
+      pred_cov_cached[i] = true;
+    }
+    // d2 = diff^t * COV^{-1} * diff = |L^{-1} diff|^2, with COV = L L^t:
+    whitened = pred_cov_llt[i].matrixL().solve(diff_means_i_j);
+    d2 = whitened.squaredNorm();
+    ml = -0.5 * (d2 + length_O * std::log(M_2PI) + pred_cov_logdet[i]);
+  };
+
   for (size_t j = 0; j < nObservations; ++j)
   {
     if (!DAT_ASOC_USE_KDTREE)
@@ -366,18 +393,11 @@ void mrpt::slam::data_association_full_covariance(
       for (size_t i = 0; i < nPredictions; ++i)
       {
         // Evaluate sqr. mahalanobis distance of obs_j -> pred_i:
-        // Extract the submatrix from the diagonal:
-        const size_t pred_cov_idx = i * length_O;
-        pred_i_cov =
-            Y_predictions_cov.asEigen().block(pred_cov_idx, pred_cov_idx, length_O, length_O);
-
         for (size_t k = 0; k < length_O; k++)
           diff_means_i_j[k] = Z_observations_mean(j, k) - Y_predictions_mean(i, k);
 
         double d2, ml;
-        // mrpt::math::productIntegralAndMahalanobisTwoGaussians(diff_means_i_j,pred_i_cov,obs_j_cov,
-        // d2,ml);
-        mrpt::math::mahalanobisDistance2AndLogPDF(diff_means_i_j, pred_i_cov, d2, ml);
+        evalMaha2AndLogPDF(i, d2, ml);
 
         // The distance according to the metric
         double val = (metric == metricMaha) ? d2 : ml;
@@ -406,19 +426,11 @@ void mrpt::slam::data_association_full_covariance(
         // the prediction in
         // "predictions_mean"
 
-        // Build the PDF of the prediction:
-        // Extract the submatrix from the diagonal:
-        const size_t pred_cov_idx = i * length_O;
-        pred_i_cov =
-            Y_predictions_cov.asEigen().block(pred_cov_idx, pred_cov_idx, length_O, length_O);
-
         for (size_t k = 0; k < length_O; k++)
           diff_means_i_j[k] = Z_observations_mean(j, k) - Y_predictions_mean(i, k);
 
         double d2, ml;
-        //				mrpt::math::productIntegralAndMahalanobisTwoGaussians(diff_means_i_j,pred_i_cov,obs_j_cov,
-        // d2,ml);
-        mrpt::math::mahalanobisDistance2AndLogPDF(diff_means_i_j, pred_i_cov, d2, ml);
+        evalMaha2AndLogPDF(i, d2, ml);
 
         if (d2 > 6 * chi2thres) break;  // Since kd-tree returns the landmarks by distance
         // order, we can skip the rest
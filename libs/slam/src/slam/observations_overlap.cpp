@@ -13,6 +13,8 @@
 #include <mrpt/obs/CObservation2DRangeScan.h>
 #include <mrpt/slam/observations_overlap.h>
 
+#include <algorithm>
+
 using namespace mrpt::slam;
 using namespace mrpt::maps;
 using namespace mrpt::obs;
@@ -84,3 +86,106 @@ double mrpt::slam::observationsOverlap(
   }
   return N ? (accum / N) : 0;
 }
+
+// ---------------------------------------------------------------------------
+//                       ObservationsOverlapCache
+// ---------------------------------------------------------------------------
+
+// Signature layout: ANGULAR_BINS sectors x RADIAL_BINS rings = 64 bytes.
+static constexpr size_t SIG_ANGULAR_BINS = 16;
+static constexpr size_t SIG_RADIAL_BINS = 4;
+
+const ObservationsOverlapCache::TSignature& ObservationsOverlapCache::signatureOf(
+    const mrpt::obs::CObservation* o)
+{
+  auto it = m_signatures.find(o);
+  if (it != m_signatures.end()) return it->second;
+
+  TSignature& sig = m_signatures[o];  // default: all-zero, valid=false
+  if (IS_CLASS(*o, CObservation2DRangeScan))
+  {
+    const auto* scan = static_cast<const CObservation2DRangeScan*>(o);
+    const size_t N = scan->getScanSize();
+    const float maxRange = scan->maxRange;
+    if (N && maxRange > 0)
+    {
+      for (size_t i = 0; i < N; i++)
+      {
+        if (!scan->getScanRangeValidity(i)) continue;
+        const size_t a = (i * SIG_ANGULAR_BINS) / N;
+        const size_t r = std::min(
+            SIG_RADIAL_BINS - 1, size_t(SIG_RADIAL_BINS * scan->getScanRange(i) / maxRange));
+        uint8_t& b = sig.bins[a * SIG_RADIAL_BINS + r];
+        if (b != 0xff) b++;  // saturating count
+      }
+      sig.valid = true;
+    }
+  }
+  return sig;
+}
+
+double ObservationsOverlapCache::signatureSimilarity(const TSignature& s1, const TSignature& s2)
+{
+  // Histogram intersection over the 64 byte bins. Written as a plain
+  // element-wise loop so the compiler can vectorize it.
+  uint32_t common = 0, n1 = 0, n2 = 0;
+  for (size_t i = 0; i < s1.bins.size(); i++)
+  {
+    common += std::min(s1.bins[i], s2.bins[i]);
+    n1 += s1.bins[i];
+    n2 += s2.bins[i];
+  }
+  return double(common) / std::max<uint32_t>(1, std::min(n1, n2));
+}
+
+double ObservationsOverlapCache::overlap(
+    const mrpt::obs::CObservation* o1,
+    const mrpt::obs::CObservation* o2,
+    const mrpt::poses::CPose3D* pose_o2_wrt_o1)
+{
+  // Coarse signature pre-filter: clearly dissimilar scans cannot overlap,
+  // so skip the (much more expensive) point matching for them.
+  if (minSignatureSimilarity > 0)
+  {
+    const TSignature& s1 = signatureOf(o1);
+    const TSignature& s2 = signatureOf(o2);
+    if (s1.valid && s2.valid && signatureSimilarity(s1, s2) < minSignatureSimilarity) return 0;
+  }
+
+  // Exact results depend on the relative pose, so only pose-less queries
+  // are memoized:
+  if (pose_o2_wrt_o1) return observationsOverlap(o1, o2, pose_o2_wrt_o1);
+
+  const auto key = std::make_pair(o1, o2);
+  const auto it = m_memoizedOverlaps.find(key);
+  if (it != m_memoizedOverlaps.end()) return it->second;
+
+  const double ov = observationsOverlap(o1, o2);
+  m_memoizedOverlaps[key] = ov;
+  return ov;
+}
+
+double ObservationsOverlapCache::overlap(
+    const mrpt::obs::CSensoryFrame& sf1,
+    const mrpt::obs::CSensoryFrame& sf2,
+    const mrpt::poses::CPose3D* pose_sf2_wrt_sf1)
+{
+  // Average over all the pairs, as in observationsOverlap():
+  size_t N = 0;
+  double accum = 0;
+  for (const auto& i1 : sf1)
+  {
+    for (const auto& i2 : sf2)
+    {
+      accum += overlap(i1.get(), i2.get(), pose_sf2_wrt_sf1);
+      N++;
+    }
+  }
+  return N ? (accum / N) : 0;
+}
+
+void ObservationsOverlapCache::clear()
+{
+  m_signatures.clear();
+  m_memoizedOverlaps.clear();
+}
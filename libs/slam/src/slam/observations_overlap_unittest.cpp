@@ -0,0 +1,53 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/obs/CObservation2DRangeScan.h>
+#include <mrpt/obs/stock_observations.h>
+#include <mrpt/slam/observations_overlap.h>
+
+TEST(ObservationsOverlap, cacheMatchesExactComputation)
+{
+  mrpt::obs::CObservation2DRangeScan s1, s2;
+  mrpt::obs::stock_observations::example2DRangeScan(s1, 0);
+  mrpt::obs::stock_observations::example2DRangeScan(s2, 1);
+
+  const double exact11 = mrpt::slam::observationsOverlap(&s1, &s1);
+  const double exact12 = mrpt::slam::observationsOverlap(&s1, &s2);
+
+  mrpt::slam::ObservationsOverlapCache cache;
+
+  // Identical scans must pass the pre-filter and match the exact result,
+  // both on the first (computed) and second (memoized) query:
+  EXPECT_NEAR(cache.overlap(&s1, &s1), exact11, 1e-9);
+  EXPECT_NEAR(cache.overlap(&s1, &s1), exact11, 1e-9);
+  EXPECT_GT(exact11, 0.9);
+
+  // With the pre-filter disabled, the cache must reproduce the exact
+  // computation for any pair:
+  cache.minSignatureSimilarity = 0;
+  EXPECT_NEAR(cache.overlap(&s1, &s2), exact12, 1e-9);
+
+  // An impossibly-high threshold rejects everything in the pre-filter
+  // (memoized results are not re-used for it since the keys differ):
+  mrpt::slam::ObservationsOverlapCache strictCache;
+  strictCache.minSignatureSimilarity = 1.1;
+  EXPECT_EQ(strictCache.overlap(&s1, &s2), 0.0);
+}
+
+TEST(ObservationsOverlap, clearResetsCaches)
+{
+  mrpt::obs::CObservation2DRangeScan s1;
+  mrpt::obs::stock_observations::example2DRangeScan(s1, 0);
+
+  mrpt::slam::ObservationsOverlapCache cache;
+  const double ov = cache.overlap(&s1, &s1);
+  cache.clear();
+  EXPECT_NEAR(cache.overlap(&s1, &s1), ov, 1e-9);
+}
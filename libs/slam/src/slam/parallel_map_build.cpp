@@ -0,0 +1,147 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include "slam-precomp.h"  // Precompiled headers
+//
+#include <mrpt/core/exceptions.h>
+#include <mrpt/maps/COccupancyGridMap2D.h>
+#include <mrpt/maps/CPointsMap.h>
+#include <mrpt/slam/parallel_map_build.h>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+using namespace mrpt::maps;
+using namespace mrpt::slam;
+
+namespace
+{
+/** Inserts the keyframes [first,last) of `sm` into `m`, mimicking
+ * CMetricMap::loadFromSimpleMap() */
+void insertKeyframeRange(CMultiMetricMap& m, const CSimpleMap& sm, size_t first, size_t last)
+{
+  for (size_t i = first; i < last; i++)
+  {
+    const auto& [pose, sf, twist] = sm.get(i);
+    ASSERTMSG_(pose, "Input map has an empty `CPose3DPDF` ptr");
+    ASSERTMSG_(sf, "Input map has an empty `CSensoryFrame` ptr");
+
+    for (auto& o : *sf) o->load();
+
+    sf->insertObservationsInto(m, pose->getMeanVal());
+
+    for (auto& o : *sf) o->unload();
+  }
+}
+
+/** Adds the per-cell log-odds of `src` into `dst`, extending `dst` as
+ * needed to cover the union of both grids. */
+void mergeGridLogOdds(COccupancyGridMap2D& dst, const COccupancyGridMap2D& src)
+{
+  ASSERT_NEAR_(dst.getResolution(), src.getResolution(), 1e-6f);
+
+  dst.resizeGrid(
+      std::min(dst.getXMin(), src.getXMin()), std::max(dst.getXMax(), src.getXMax()),
+      std::min(dst.getYMin(), src.getYMin()), std::max(dst.getYMax(), src.getYMax()));
+
+  for (unsigned int cy = 0; cy < src.getSizeY(); cy++)
+  {
+    const auto* srcRow = src.getRow(cy);
+    auto* dstRow = dst.getRow(dst.y2idx(src.idx2y(cy)));
+
+    for (unsigned int cx = 0; cx < src.getSizeX(); cx++)
+    {
+      const auto l = srcRow[cx];
+      if (!l) continue;  // p=0.5 (never observed): nothing to add
+
+      auto& dstCell = dstRow[dst.x2idx(src.idx2x(cx))];
+      const auto sum = static_cast<int32_t>(dstCell) + static_cast<int32_t>(l);
+      dstCell = static_cast<COccupancyGridMap2D::cellType>(std::clamp<int32_t>(
+          sum, COccupancyGridMap2D::OCCGRID_CELLTYPE_MIN,
+          COccupancyGridMap2D::OCCGRID_CELLTYPE_MAX));
+    }
+  }
+}
+}  // namespace
+
+void mrpt::slam::buildMetricMapFromSimpleMapParallel(
+    mrpt::maps::CMultiMetricMap& outMap,
+    const mrpt::maps::CSimpleMap& simpleMap,
+    const mrpt::maps::TSetOfMetricMapInitializers& mapInitializers,
+    unsigned int numThreads)
+{
+  MRPT_START
+
+  outMap.setListOfMaps(mapInitializers);
+
+  // Only occupancy grids and point maps have a well-defined merge
+  // operation; anything else must go through the regular serial path:
+  bool mergeable = !outMap.maps.empty();
+  for (const auto& m : outMap.maps)
+    if (!IS_CLASS(*m, COccupancyGridMap2D) && !std::dynamic_pointer_cast<CPointsMap>(m))
+      mergeable = false;
+
+  size_t nThreads = numThreads ? numThreads : std::thread::hardware_concurrency();
+  if (!nThreads) nThreads = 1;
+  nThreads = std::min<size_t>(nThreads, simpleMap.size());
+
+  // Threading overhead is not worth it for tiny maps:
+  if (!mergeable || nThreads <= 1 || simpleMap.size() < 2 * nThreads)
+  {
+    outMap.loadFromSimpleMap(simpleMap);
+    return;
+  }
+
+  // Map phase: each worker builds a partial map from its keyframe block:
+  const size_t N = simpleMap.size();
+  std::vector<CMultiMetricMap> partialMaps(nThreads);
+  std::vector<std::exception_ptr> excps(nThreads);
+  std::vector<std::thread> workers;
+  for (size_t t = 0; t < nThreads; t++)
+  {
+    const size_t idxFirst = (N * t) / nThreads;
+    const size_t idxEnd = (N * (t + 1)) / nThreads;
+    workers.emplace_back(
+        [&, t, idxFirst, idxEnd]()
+        {
+          try
+          {
+            partialMaps[t].setListOfMaps(mapInitializers);
+            insertKeyframeRange(partialMaps[t], simpleMap, idxFirst, idxEnd);
+          }
+          catch (...)
+          {
+            excps[t] = std::current_exception();
+          }
+        });
+  }
+  for (auto& w : workers) w.join();
+  for (const auto& e : excps)
+    if (e) std::rethrow_exception(e);
+
+  // Reduce phase: merge the partial maps into the output one:
+  for (size_t j = 0; j < outMap.maps.size(); j++)
+  {
+    const auto& dst = outMap.maps.at(j);
+    if (auto dstGrid = std::dynamic_pointer_cast<COccupancyGridMap2D>(dst); dstGrid)
+    {
+      for (const auto& p : partialMaps)
+        mergeGridLogOdds(*dstGrid, *std::dynamic_pointer_cast<COccupancyGridMap2D>(p.maps.at(j)));
+    }
+    else if (auto dstPts = std::dynamic_pointer_cast<CPointsMap>(dst); dstPts)
+    {
+      for (const auto& p : partialMaps)
+        dstPts->insertAnotherMap(
+            std::dynamic_pointer_cast<CPointsMap>(p.maps.at(j)).get(), mrpt::poses::CPose3D());
+    }
+  }
+
+  MRPT_END
+}
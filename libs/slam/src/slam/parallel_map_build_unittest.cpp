@@ -0,0 +1,121 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/maps/COccupancyGridMap2D.h>
+#include <mrpt/maps/CSimplePointsMap.h>
+#include <mrpt/obs/CObservation2DRangeScan.h>
+#include <mrpt/obs/stock_observations.h>
+#include <mrpt/poses/CPose3DPDFGaussian.h>
+#include <mrpt/slam/parallel_map_build.h>
+
+using namespace mrpt::maps;
+using namespace mrpt::obs;
+using namespace mrpt::poses;
+
+namespace
+{
+TSetOfMetricMapInitializers mapInitializers()
+{
+  TSetOfMetricMapInitializers map_inits;
+  {
+    COccupancyGridMap2D::TMapDefinition def;
+    def.resolution = 0.10f;
+    map_inits.push_back(def);
+  }
+  {
+    CSimplePointsMap::TMapDefinition def;
+    map_inits.push_back(def);
+  }
+  return map_inits;
+}
+
+CSimpleMap syntheticSimpleMap(size_t numKeyframes)
+{
+  CSimpleMap sm;
+  for (size_t i = 0; i < numKeyframes; i++)
+  {
+    auto scan = CObservation2DRangeScan::Create();
+    stock_observations::example2DRangeScan(*scan, i % 2);
+
+    auto sf = CSensoryFrame::Create();
+    sf->insert(scan);
+
+    auto pose = CPose3DPDFGaussian::Create();
+    pose->mean = CPose3D(0.1 * i, 0.05 * i, 0, 0, 0, 0);
+
+    sm.insert(CSimpleMap::Keyframe(pose, sf));
+  }
+  return sm;
+}
+}  // namespace
+
+TEST(ParallelMapBuild, EquivalentToSerial)
+{
+  const auto sm = syntheticSimpleMap(16);
+  const auto map_inits = mapInitializers();
+
+  CMultiMetricMap serialMap;
+  serialMap.setListOfMaps(map_inits);
+  serialMap.loadFromSimpleMap(sm);
+
+  CMultiMetricMap parallelMap;
+  mrpt::slam::buildMetricMapFromSimpleMapParallel(parallelMap, sm, map_inits, 4);
+
+  ASSERT_EQ(parallelMap.maps.size(), serialMap.maps.size());
+
+  // Grid: occupancy must match cell by cell (log-odds addition is
+  // commutative, and this small map never saturates the cell range).
+  // Extents may differ slightly, but cells outside either grid can only be
+  // unobserved (p=0.5):
+  const auto gSerial = std::dynamic_pointer_cast<COccupancyGridMap2D>(serialMap.maps.at(0));
+  const auto gParallel = std::dynamic_pointer_cast<COccupancyGridMap2D>(parallelMap.maps.at(0));
+  ASSERT_TRUE(gSerial && gParallel);
+
+  for (unsigned int cy = 0; cy < gSerial->getSizeY(); cy++)
+    for (unsigned int cx = 0; cx < gSerial->getSizeX(); cx++)
+    {
+      const float x = gSerial->idx2x(cx), y = gSerial->idx2y(cy);
+      if (x < gParallel->getXMin() || x > gParallel->getXMax() || y < gParallel->getYMin() ||
+          y > gParallel->getYMax())
+      {
+        EXPECT_NEAR(gSerial->getCell(cx, cy), 0.5f, 1e-6f) << "cell: " << cx << "," << cy;
+        continue;
+      }
+      EXPECT_NEAR(gSerial->getCell(cx, cy), gParallel->getPos(x, y), 1e-4f)
+          << "cell: " << cx << "," << cy;
+    }
+
+  // Point map: concatenation in keyframe order reproduces the serial map:
+  const auto pSerial = std::dynamic_pointer_cast<CSimplePointsMap>(serialMap.maps.at(1));
+  const auto pParallel = std::dynamic_pointer_cast<CSimplePointsMap>(parallelMap.maps.at(1));
+  ASSERT_TRUE(pSerial && pParallel);
+  ASSERT_EQ(pSerial->size(), pParallel->size());
+  for (size_t i = 0; i < pSerial->size(); i += 7)
+  {
+    mrpt::math::TPoint3D ptSerial, ptParallel;
+    pSerial->getPoint(i, ptSerial);
+    pParallel->getPoint(i, ptParallel);
+    EXPECT_NEAR(ptSerial.distanceTo(ptParallel), 0, 1e-6) << "point: " << i;
+  }
+}
+
+TEST(ParallelMapBuild, SerialFallbackForSmallMaps)
+{
+  // Too few keyframes for threading: must fall back to the serial path and
+  // still produce a valid map:
+  const auto sm = syntheticSimpleMap(3);
+
+  CMultiMetricMap m;
+  mrpt::slam::buildMetricMapFromSimpleMapParallel(m, sm, mapInitializers(), 8);
+
+  ASSERT_EQ(m.maps.size(), 2U);
+  EXPECT_FALSE(m.isEmpty());
+  EXPECT_GT(std::dynamic_pointer_cast<CSimplePointsMap>(m.maps.at(1))->size(), 0U);
+}
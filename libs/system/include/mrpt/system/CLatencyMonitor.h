@@ -0,0 +1,165 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+#pragma once
+
+#include <mrpt/system/COutputLogger.h>
+#include <mrpt/system/CTicTac.h>
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+namespace mrpt::system
+{
+/** Latency histograms and deadline watchdog for named code sections.
+ *
+ * While CTimeLogger keeps min/mean/max aggregates, this class records each
+ * sample into a per-section logarithmic (HDR-style) histogram, so tail
+ * percentiles (p90/p99/p99.9) can be queried - averages hide exactly the
+ * deadline overruns a real-time deployment cares about. Buckets cover
+ * ~1 microsecond to ~1000 s with a constant ~9% relative error.
+ *
+ * Additionally, a per-section deadline can be set with setDeadline(): every
+ * sample exceeding it increments a miss counter and, if given, invokes a
+ * user callback synchronously from the thread that reported the sample.
+ *
+ * Percentile tables can be dumped on demand (dumpPercentiles(), through the
+ * COutputLogger interface) or periodically via enablePeriodicDump().
+ *
+ * Usage (see also CAbstractPTGBasedReactive and CMetricMapBuilderICP, which
+ * embed one of these around their step functions):
+ * \code
+ *  mrpt::system::CLatencyMonitor lm;
+ *  lm.setDeadline("step", 50e-3, [](const std::string& s, double t, double d)
+ *     { std::cerr << s << " overran: " << t << " s\n"; });
+ *  {
+ *    mrpt::system::CLatencyMonitorEntry e(lm, "step");
+ *    // ... timed code ...
+ *  }
+ *  lm.dumpPercentiles();
+ * \endcode
+ *
+ * All methods are thread-safe.
+ * \sa CTimeLogger, CLatencyMonitorEntry
+ * \note [New in MRPT 2.14.5]
+ * \ingroup mrpt_system_grp
+ */
+class CLatencyMonitor : public mrpt::system::COutputLogger
+{
+ public:
+  /** Called upon each deadline miss: (section, elapsed [s], deadline [s]) */
+  using deadline_callback_t = std::function<void(const std::string&, double, double)>;
+
+  CLatencyMonitor(bool enabled = true, const std::string& name = "");
+  ~CLatencyMonitor() override;
+
+  void enable(bool enabled = true) { m_enabled = enabled; }
+  void disable() { m_enabled = false; }
+  bool isEnabled() const { return m_enabled; }
+
+  const std::string& getName() const noexcept { return m_name; }
+
+  /** Records one sample (in seconds) for the given section, checking its
+   * deadline (if any) and the periodic-dump timer. */
+  void registerSample(const std::string_view& section, double seconds) noexcept;
+
+  /** Sets (or replaces) the deadline of a section, in seconds, with an
+   * optional callback invoked on each miss. A deadline <=0 removes it. */
+  void setDeadline(
+      const std::string& section, double deadline_seconds, deadline_callback_t callback = {});
+
+  /** Returns the given percentile (range [0,100], e.g. 99.9) of the
+   * recorded samples of a section, in seconds, or 0 if it has none.
+   * Exact for the extremes (p0=min, p100=max), ~9% relative error
+   * elsewhere due to the logarithmic bucketing. */
+  double getPercentile(const std::string& section, double percentile) const;
+
+  /** Number of samples recorded for a section so far */
+  std::size_t sampleCount(const std::string& section) const;
+  /** Number of deadline misses of a section so far */
+  std::size_t deadlineMisses(const std::string& section) const;
+
+  /** Returns a multi-line percentile table for all sections \sa
+   * dumpPercentiles */
+  std::string getPercentilesAsText() const;
+  /** Dumps getPercentilesAsText() through the COutputLogger interface, at
+   * verbosity level LVL_INFO */
+  void dumpPercentiles() const;
+
+  /** Enables dumping the percentile table every `period_seconds` (checked,
+   * and dumped, from within registerSample(); 0 disables: the default). */
+  void enablePeriodicDump(double period_seconds);
+
+  /** Resets all histograms and miss counters (deadlines are kept) */
+  void clear();
+
+ private:
+  // ~1 us to ~1091 s in 8 buckets/octave => 9% relative resolution:
+  constexpr static int BUCKETS_PER_OCTAVE = 8;
+  constexpr static int MIN_EXPONT = -20;  // 2^-20 s ~ 0.95 us
+  constexpr static int NUM_OCTAVES = 30;
+  constexpr static int NUM_BUCKETS = NUM_OCTAVES * BUCKETS_PER_OCTAVE;
+
+  struct TSectionData
+  {
+    std::array<uint64_t, NUM_BUCKETS> buckets{};
+    std::size_t count = 0;
+    double min_t = 0, max_t = 0;
+    double deadline = 0;  //!< <=0: none
+    deadline_callback_t callback;
+    std::size_t deadlineMisses = 0;
+  };
+
+  static int bucketOf(double t) noexcept;
+  static double bucketValue(int idx) noexcept;
+  /** Percentile from one section's histogram. Needs m_dataMtx held. */
+  static double percentileOf(const TSectionData& d, double percentile);
+
+  bool m_enabled;
+  std::string m_name;
+
+  mutable std::mutex m_dataMtx;
+  std::map<std::string, TSectionData, std::less<>> m_data;
+
+  double m_dumpPeriod = 0;  //!< 0: disabled
+  CTicTac m_dumpTimer;
+};
+
+/** RAII helper to time a scope and report it to a CLatencyMonitor, safe
+ * against exceptions \sa CLatencyMonitor
+ * \note [New in MRPT 2.14.5]
+ * \ingroup mrpt_system_grp
+ */
+struct CLatencyMonitorEntry
+{
+  CLatencyMonitorEntry(CLatencyMonitor& monitor, const std::string_view& section) noexcept :
+      m_monitor(monitor), m_section(section)
+  {
+    if (m_monitor.isEnabled()) m_tictac.Tic();
+  }
+  ~CLatencyMonitorEntry()
+  {
+    if (m_monitor.isEnabled()) m_monitor.registerSample(m_section, m_tictac.Tac());
+  }
+
+  CLatencyMonitorEntry(const CLatencyMonitorEntry&) = delete;
+  CLatencyMonitorEntry& operator=(const CLatencyMonitorEntry&) = delete;
+
+ private:
+  CLatencyMonitor& m_monitor;
+  // We cannot keep the string_view: no lifetime guarantee on the buffer.
+  const std::string m_section;
+  CTicTac m_tictac;
+};
+
+}  // namespace mrpt::system
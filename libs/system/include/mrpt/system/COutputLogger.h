@@ -270,6 +270,35 @@ class COutputLogger
   bool logDeregisterCallback(output_logger_callback_t userFunc);
   /** @} */
 
+  /** @name Asynchronous console output
+   * @{ */
+
+  /** Enables (or disables) a process-wide asynchronous console output mode,
+   * shared by all COutputLogger instances: messages to be shown on the
+   * console are pushed into a bounded lock-free queue and actually formatted
+   * and written by a single background thread, so real-time threads do not
+   * block on terminal I/O. The semantics of logging_enable_console_output
+   * and verbosity filtering are unchanged; only the moment of the actual
+   * console write is deferred. If the queue is momentarily full, messages
+   * fall back to the regular synchronous write, so none is ever lost.
+   *
+   * Log records kept in the history (logging_enable_keep_record) and user
+   * callbacks are still handled synchronously in the calling thread.
+   *
+   * Disabling the mode flushes all pending messages before returning.
+   * \note [New in MRPT 2.14.5]
+   * \sa flushAsyncConsoleOutput() */
+  static void enableAsyncConsoleOutput(bool enable = true, size_t queue_length = 8192);
+
+  /** Blocks until all console messages queued by enableAsyncConsoleOutput()
+   * mode have been written out. \note [New in MRPT 2.14.5] */
+  static void flushAsyncConsoleOutput();
+
+  /** \sa enableAsyncConsoleOutput() \note [New in MRPT 2.14.5] */
+  static bool isAsyncConsoleOutputEnabled();
+
+  /** @} */
+
  protected:
   /** \brief Provided messages with VerbosityLevel smaller than this value
    * shall be ignored */
@@ -372,7 +401,16 @@ struct COutputLoggerStreamWrapper
   const COutputLogger& m_logger;
 };
 
-#define INTERNAL_MRPT_LOG(_LVL, _STRING) this->logStr(_LVL, _STRING)
+// The guard makes disabled verbosity levels cost a single branch, without
+// even evaluating _STRING (which is often an mrpt::format() expression):
+#define INTERNAL_MRPT_LOG(_LVL, _STRING)                                          \
+  do                                                                              \
+  {                                                                               \
+    if (this->isLoggingLevelVisible(_LVL) || this->logging_enable_keep_record)    \
+    {                                                                             \
+      this->logStr(_LVL, _STRING);                                                \
+    }                                                                             \
+  } while (0)
 
 #define INTERNAL_MRPT_LOG_ONCE(_LVL, _STRING) \
   do                                          \
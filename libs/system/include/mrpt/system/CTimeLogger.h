@@ -43,7 +43,8 @@ namespace mrpt::system
  * the latter case (and, actually, in general since it's safer against
  * exceptions), use the RAII helper class CTimeLoggerEntry.
  *
- * \sa CTimeLoggerEntry
+ * \sa CTimeLoggerEntry, and CTraceProfiler for a lower-overhead alternative
+ * suitable for always-on profiling of hot paths.
  *
  * \note The default behavior is dumping all the information at destruction.
  * \ingroup mrpt_system_grp
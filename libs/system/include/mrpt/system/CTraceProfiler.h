@@ -0,0 +1,192 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace mrpt::system
+{
+class CTimeLogger;  // frwd decl.
+
+/** A low-overhead, always-on event tracer, designed so it can be left enabled
+ * in release builds without perturbing the timed code.
+ *
+ * Differences with mrpt::system::CTimeLogger:
+ * - Sections are keyed by **string literal identity** (the `const char*`
+ *   pointer itself), so there is no string construction, hashing, nor map
+ *   lookup in begin()/end(). Pass only literals (or any buffer outliving the
+ *   profiler).
+ * - Each thread records events into its own lock-free ring buffer; a
+ *   background thread drains them asynchronously, so the hot path never
+ *   takes a lock (events are silently dropped, and counted, if a ring
+ *   overflows faster than it is drained).
+ * - Instead of aggregated min/mean/max stats, the full event timeline is
+ *   kept, and can be exported in Chrome trace format (load the resulting
+ *   JSON file in `chrome://tracing` or https://ui.perfetto.dev/), or
+ *   aggregated a-posteriori into a CTimeLogger via aggregateStatsTo().
+ *
+ * Example:
+ * \code
+ *  mrpt::system::CTraceProfiler tracer;
+ *  {
+ *    mrpt::system::CTraceProfilerEntry tle(tracer, "myCalculation");
+ *    // ... do whatever ...
+ *  }
+ *  tracer.saveToChromeTraceFile("trace.json");
+ * \endcode
+ *
+ * begin()/end() are thread-safe and, unlike CTimeLogger, the *same* section
+ * name may be used concurrently from different threads (each thread gets its
+ * own timeline in the trace).
+ *
+ * \sa CTimeLogger, CTraceProfilerEntry
+ * \note [New in MRPT 2.14.5]
+ * \ingroup mrpt_system_grp
+ */
+class CTraceProfiler
+{
+ public:
+  CTraceProfiler(bool enabled = true, const std::string& name = "");
+  ~CTraceProfiler();
+
+  CTraceProfiler(const CTraceProfiler&) = delete;
+  CTraceProfiler& operator=(const CTraceProfiler&) = delete;
+
+  void enable(bool enabled = true) { m_enabled = enabled; }
+  void disable() { m_enabled = false; }
+  bool isEnabled() const { return m_enabled; }
+
+  const std::string& getName() const noexcept { return m_name; }
+
+  /** Marks the start of a named section. `section` must be a string literal
+   * (or outlive this object): only its pointer is stored. */
+  inline void begin(const char* section) noexcept
+  {
+    if (m_enabled) record(section, 'B');
+  }
+  /** Marks the end of a named section \sa begin */
+  inline void end(const char* section) noexcept
+  {
+    if (m_enabled) record(section, 'E');
+  }
+  /** Records an instantaneous event ("i" phase in the Chrome trace) */
+  inline void instant(const char* name) noexcept
+  {
+    if (m_enabled) record(name, 'i');
+  }
+
+  /** Synchronously drains all per-thread ring buffers into the main event
+   * timeline. Called automatically by the background flusher thread, the
+   * exporters, and the destructor; needed explicitly only before reading
+   * eventCount() or droppedEvents() in tests or diagnostics. */
+  void flushNow();
+
+  /** Number of events drained into the main timeline so far */
+  std::size_t eventCount() const;
+  /** Number of events lost to ring-buffer overflows so far */
+  std::size_t droppedEvents() const noexcept { return m_dropped; }
+
+  /** Discards all recorded (and pending) events */
+  void clear();
+
+  /** Returns the whole timeline in Chrome trace format. Load it in
+   * `chrome://tracing` or https://ui.perfetto.dev/. Timestamps are in
+   * microseconds since this object construction. */
+  std::string getChromeTraceJSON() const;
+  /** Dumps getChromeTraceJSON() to a file \sa getChromeTraceJSON */
+  void saveToChromeTraceFile(const std::string& filename) const;
+
+  /** Matches begin()/end() pairs per thread and feeds the resulting section
+   * durations into the given CTimeLogger (via registerUserMeasure()), so
+   * the usual min/mean/max reports and CSV/m-file exporters can be used on
+   * traced data. */
+  void aggregateStatsTo(CTimeLogger& logger) const;
+
+ private:
+  /** One recorded event. `name` points to the user's string literal. */
+  struct TEvent
+  {
+    const char* name = nullptr;
+    int64_t t_ns = 0;  //!< Since profiler construction
+    char phase = 0;    //!< 'B', 'E', or 'i'
+  };
+
+  /** Single-producer (the owning thread) / single-consumer (the flusher)
+   * lock-free ring buffer */
+  struct TThreadRing
+  {
+    constexpr static std::size_t CAPACITY = 8192;  // events (must be 2^N)
+
+    std::array<TEvent, CAPACITY> events;
+    std::atomic<std::size_t> head{0};  //!< next write pos (producer)
+    std::atomic<std::size_t> tail{0};  //!< next read pos (consumer)
+    std::size_t tid = 0;               //!< registration order of the thread
+    std::thread::id owner;
+  };
+
+  void record(const char* name, char phase) noexcept;
+  /** Slow path of record(): registers this thread's ring (once per thread
+   * and profiler) */
+  TThreadRing* registerThisThread();
+  void drainRingsIntoTimeline();  // needs m_flushMtx held
+
+  bool m_enabled;
+  std::string m_name;
+  const std::chrono::steady_clock::time_point m_t0 = std::chrono::steady_clock::now();
+
+  /** All per-thread rings; shared_ptr so rings outlive their threads */
+  mutable std::mutex m_ringsMtx;
+  std::vector<std::shared_ptr<TThreadRing>> m_rings;
+
+  /** The drained timeline: (event, tid) in flush order */
+  mutable std::mutex m_flushMtx;
+  std::vector<std::pair<TEvent, std::size_t>> m_events;
+
+  std::atomic<std::size_t> m_dropped{0};
+
+  // Background flusher:
+  std::thread m_flusher;
+  std::mutex m_flusherCvMtx;
+  std::condition_variable m_flusherCv;
+  std::atomic_bool m_stopFlusher{false};
+};
+
+/** RAII helper to call CTraceProfiler::begin() and end() upon construction
+ * and destruction, safe against exceptions. The section name must be a string
+ * literal \sa CTraceProfiler
+ * \note [New in MRPT 2.14.5]
+ * \ingroup mrpt_system_grp
+ */
+struct CTraceProfilerEntry
+{
+  CTraceProfilerEntry(CTraceProfiler& profiler, const char* section) noexcept :
+      m_profiler(profiler), m_section(section)
+  {
+    m_profiler.begin(m_section);
+  }
+  ~CTraceProfilerEntry() { m_profiler.end(m_section); }
+
+  CTraceProfilerEntry(const CTraceProfilerEntry&) = delete;
+  CTraceProfilerEntry& operator=(const CTraceProfilerEntry&) = delete;
+
+ private:
+  CTraceProfiler& m_profiler;
+  const char* m_section;
+};
+
+}  // namespace mrpt::system
@@ -14,6 +14,7 @@
 #include <cstdint>
 #include <iosfwd>
 #include <string>
+#include <vector>
 
 namespace mrpt::system
 {
@@ -122,6 +123,40 @@ std::string dateTimeToString(const mrpt::system::TTimeStamp t);
  */
 std::string dateTimeLocalToString(const mrpt::system::TTimeStamp t);
 
+/** Caching version of dateTimeToString() for high-rate formatting of
+ * mostly-increasing timestamps, e.g. naming rawlog entries or log lines per
+ * observation: while the whole second of the input does not change, the
+ * "YEAR/MONTH/DAY,HH:MM:SS." prefix from the previous call is reused and only
+ * the six sub-second digits are rewritten in place, so the gmtime() and
+ * printf-style formatting costs are paid once per second instead of once per
+ * call.
+ * \note [New in MRPT 2.14.5]
+ * \sa dateTimeToString, timestampsToStrings
+ */
+class CTimestampFormatter
+{
+ public:
+  CTimestampFormatter() = default;
+
+  /** Returns the UTC textual form `YEAR/MONTH/DAY,HH:MM:SS.UUUUUU` of the
+   * given timestamp, identical to dateTimeToString(). The returned reference
+   * points into an internal buffer that is overwritten by the next call to
+   * this method; copy the string if it must outlive that. */
+  const std::string& format(const mrpt::system::TTimeStamp t);
+
+ private:
+  std::string m_buffer;
+  uint64_t m_cachedSecond = 0;
+};
+
+/** Bulk version of dateTimeToString(): formats all the given timestamps,
+ * internally reusing one CTimestampFormatter so consecutive entries lying
+ * within the same second share the already-formatted date/time prefix.
+ * \note [New in MRPT 2.14.5]
+ * \sa CTimestampFormatter, dateTimeToString
+ */
+std::vector<std::string> timestampsToStrings(const std::vector<mrpt::system::TTimeStamp>& ts);
+
 /** Convert a timestamp into this textual form: YEAR/MONTH/DAY
  */
 std::string dateToString(const mrpt::system::TTimeStamp t);
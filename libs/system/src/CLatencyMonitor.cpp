@@ -0,0 +1,199 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include "system-precomp.h"  // Precompiled headers
+//
+#include <mrpt/core/exceptions.h>
+#include <mrpt/core/format.h>
+#include <mrpt/system/CLatencyMonitor.h>
+#include <mrpt/system/string_utils.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+using namespace mrpt::system;
+
+CLatencyMonitor::CLatencyMonitor(bool enabled, const std::string& name) :
+    m_enabled(enabled), m_name(name)
+{
+  COutputLogger::setLoggerName(
+      name.empty() ? std::string("CLatencyMonitor") : (name + std::string(" latencyMonitor")));
+  m_dumpTimer.Tic();
+}
+
+CLatencyMonitor::~CLatencyMonitor()
+{
+  bool anyData;
+  {
+    std::lock_guard<std::mutex> lk(m_dataMtx);
+    anyData = !m_data.empty();
+  }
+  if (anyData) dumpPercentiles();
+}
+
+int CLatencyMonitor::bucketOf(double t) noexcept
+{
+  if (!(t > 0)) return 0;
+  const int idx =
+      static_cast<int>(std::floor(std::log2(t) * BUCKETS_PER_OCTAVE)) -
+      MIN_EXPONT * BUCKETS_PER_OCTAVE;
+  return std::clamp(idx, 0, NUM_BUCKETS - 1);
+}
+
+double CLatencyMonitor::bucketValue(int idx) noexcept
+{
+  // Geometric center of the bucket:
+  return std::exp2((idx + 0.5) / double(BUCKETS_PER_OCTAVE) + MIN_EXPONT);
+}
+
+void CLatencyMonitor::registerSample(const std::string_view& section, double seconds) noexcept
+{
+  if (!m_enabled) return;
+
+  try
+  {
+    deadline_callback_t cbToRun;
+    double deadline = 0;
+    bool doDump = false;
+    {
+      std::lock_guard<std::mutex> lk(m_dataMtx);
+
+      auto it = m_data.find(section);
+      if (it == m_data.end()) it = m_data.emplace(std::string(section), TSectionData()).first;
+      auto& d = it->second;
+
+      d.buckets[bucketOf(seconds)]++;
+      if (d.count++ == 0)
+      {
+        d.min_t = seconds;
+        d.max_t = seconds;
+      }
+      else
+      {
+        d.min_t = std::min(d.min_t, seconds);
+        d.max_t = std::max(d.max_t, seconds);
+      }
+      if (d.deadline > 0 && seconds > d.deadline)
+      {
+        d.deadlineMisses++;
+        cbToRun = d.callback;
+        deadline = d.deadline;
+      }
+      if (m_dumpPeriod > 0 && m_dumpTimer.Tac() > m_dumpPeriod)
+      {
+        m_dumpTimer.Tic();
+        doDump = true;
+      }
+    }
+    // Invoke user code and the (locking) dump with m_dataMtx released:
+    if (cbToRun) cbToRun(std::string(section), seconds, deadline);
+    if (doDump) dumpPercentiles();
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "[CLatencyMonitor::registerSample] Exception:\n" << mrpt::exception_to_str(e);
+  }
+}
+
+void CLatencyMonitor::setDeadline(
+    const std::string& section, double deadline_seconds, deadline_callback_t callback)
+{
+  std::lock_guard<std::mutex> lk(m_dataMtx);
+  auto& d = m_data[section];
+  d.deadline = deadline_seconds;
+  d.callback = std::move(callback);
+}
+
+double CLatencyMonitor::percentileOf(const TSectionData& d, double percentile)
+{
+  if (!d.count) return 0;
+  if (percentile <= 0) return d.min_t;
+  if (percentile >= 100) return d.max_t;
+
+  const auto target = static_cast<uint64_t>(std::ceil(percentile * 0.01 * d.count));
+  uint64_t acc = 0;
+  for (int i = 0; i < NUM_BUCKETS; i++)
+  {
+    acc += d.buckets[i];
+    if (acc >= target) return std::clamp(bucketValue(i), d.min_t, d.max_t);
+  }
+  return d.max_t;  // shouldn't happen
+}
+
+double CLatencyMonitor::getPercentile(const std::string& section, double percentile) const
+{
+  std::lock_guard<std::mutex> lk(m_dataMtx);
+  const auto it = m_data.find(section);
+  return it == m_data.end() ? 0 : percentileOf(it->second, percentile);
+}
+
+std::size_t CLatencyMonitor::sampleCount(const std::string& section) const
+{
+  std::lock_guard<std::mutex> lk(m_dataMtx);
+  const auto it = m_data.find(section);
+  return it == m_data.end() ? 0 : it->second.count;
+}
+
+std::size_t CLatencyMonitor::deadlineMisses(const std::string& section) const
+{
+  std::lock_guard<std::mutex> lk(m_dataMtx);
+  const auto it = m_data.find(section);
+  return it == m_data.end() ? 0 : it->second.deadlineMisses;
+}
+
+std::string CLatencyMonitor::getPercentilesAsText() const
+{
+  using namespace std::string_literals;
+
+  std::string s;
+  s += "--------------------- MRPT CLatencyMonitor report ---------------------\n"s;
+  s +=
+      "           SECTION                #SAMPLES  p50    p90    p99    p99.9  "
+      "MAX    MISSES\n"s;
+  s += "-----------------------------------------------------------------------\n"s;
+
+  std::lock_guard<std::mutex> lk(m_dataMtx);
+  for (const auto& [name, d] : m_data)
+  {
+    s += mrpt::format(
+        "%-33s %7u %6ss %6ss %6ss %6ss %6ss %7u\n", name.c_str(),
+        static_cast<unsigned int>(d.count), unitsFormat(percentileOf(d, 50), 1, false).c_str(),
+        unitsFormat(percentileOf(d, 90), 1, false).c_str(),
+        unitsFormat(percentileOf(d, 99), 1, false).c_str(),
+        unitsFormat(percentileOf(d, 99.9), 1, false).c_str(),
+        unitsFormat(d.max_t, 1, false).c_str(), static_cast<unsigned int>(d.deadlineMisses));
+  }
+  s += "-----------------------------------------------------------------------\n"s;
+  return s;
+}
+
+void CLatencyMonitor::dumpPercentiles() const
+{
+  MRPT_LOG_INFO_STREAM("dumpPercentiles:\n" << getPercentilesAsText());
+}
+
+void CLatencyMonitor::enablePeriodicDump(double period_seconds)
+{
+  std::lock_guard<std::mutex> lk(m_dataMtx);
+  m_dumpPeriod = period_seconds;
+  m_dumpTimer.Tic();
+}
+
+void CLatencyMonitor::clear()
+{
+  std::lock_guard<std::mutex> lk(m_dataMtx);
+  for (auto& [name, d] : m_data)
+  {
+    d.buckets.fill(0);
+    d.count = 0;
+    d.min_t = d.max_t = 0;
+    d.deadlineMisses = 0;
+  }
+}
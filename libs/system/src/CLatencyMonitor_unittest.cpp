@@ -0,0 +1,74 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/system/CLatencyMonitor.h>
+
+TEST(CLatencyMonitor, percentiles)
+{
+  mrpt::system::CLatencyMonitor lm;
+
+  // 90 fast samples + 10 slow ones:
+  for (int i = 0; i < 90; i++) lm.registerSample("foo", 1e-3);
+  for (int i = 0; i < 10; i++) lm.registerSample("foo", 100e-3);
+
+  EXPECT_EQ(lm.sampleCount("foo"), 100U);
+
+  // ~9% relative error from the log bucketing:
+  EXPECT_NEAR(lm.getPercentile("foo", 50), 1e-3, 0.2e-3);
+  EXPECT_NEAR(lm.getPercentile("foo", 99), 100e-3, 20e-3);
+  EXPECT_DOUBLE_EQ(lm.getPercentile("foo", 0), 1e-3);      // exact min
+  EXPECT_DOUBLE_EQ(lm.getPercentile("foo", 100), 100e-3);  // exact max
+  EXPECT_EQ(lm.getPercentile("bar", 50), 0);
+
+  const std::string s = lm.getPercentilesAsText();
+  EXPECT_NE(s.find("foo"), std::string::npos);
+
+  lm.clear();
+  EXPECT_EQ(lm.sampleCount("foo"), 0U);
+  lm.disable();  // to silent console output upon dtor
+}
+
+TEST(CLatencyMonitor, deadlineCallback)
+{
+  mrpt::system::CLatencyMonitor lm;
+
+  int misses = 0;
+  double lastElapsed = 0;
+  lm.setDeadline(
+      "step", 10e-3,
+      [&](const std::string& section, double elapsed, double deadline)
+      {
+        EXPECT_EQ(section, "step");
+        EXPECT_GT(elapsed, deadline);
+        lastElapsed = elapsed;
+        misses++;
+      });
+
+  lm.registerSample("step", 5e-3);   // ok
+  lm.registerSample("step", 20e-3);  // miss
+  lm.registerSample("step", 30e-3);  // miss
+
+  EXPECT_EQ(misses, 2);
+  EXPECT_EQ(lm.deadlineMisses("step"), 2U);
+  EXPECT_DOUBLE_EQ(lastElapsed, 30e-3);
+
+  lm.clear();
+  lm.disable();  // to silent console output upon dtor
+}
+
+TEST(CLatencyMonitor, disabled)
+{
+  mrpt::system::CLatencyMonitor lm(false);
+  {
+    mrpt::system::CLatencyMonitorEntry e(lm, "foo");
+  }
+  lm.registerSample("foo", 1e-3);
+  EXPECT_EQ(lm.sampleCount("foo"), 0U);
+}
@@ -15,11 +15,17 @@
 #include <mrpt/system/datetime.h>
 #include <mrpt/system/filesystem.h>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdarg>  // for logFmt
 #include <cstdio>
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <sstream>
+#include <thread>
 #include <vector>
 
 #ifdef _MSC_VER
@@ -67,8 +73,197 @@ std::array<std::string, NUMBER_OF_VERBOSITY_LEVELS>& COutputLogger::logging_leve
 
 COutputLogger::~COutputLogger() = default;
 
+// Asynchronous console output machinery (see enableAsyncConsoleOutput()):
+// a process-wide bounded lock-free MPMC ring buffer (Vyukov's algorithm) of
+// structured log records, drained by a single background writer thread which
+// does the (expensive) timestamp formatting and terminal I/O.
+namespace
+{
+struct TAsyncLogRecord
+{
+  mrpt::Clock::time_point timestamp;
+  VerbosityLevel level = LVL_INFO;
+  std::string name, body;
+};
+
+// Defined below, next to TMsg::dumpToConsole(), which shares it:
+void dumpEntryToConsole(
+    const mrpt::Clock::time_point timestamp,
+    VerbosityLevel level,
+    const std::string& name,
+    const std::string& body);
+
+class AsyncConsoleDispatcher
+{
+ public:
+  static AsyncConsoleDispatcher& Instance()
+  {
+    static AsyncConsoleDispatcher o;
+    return o;
+  }
+  ~AsyncConsoleDispatcher() { stop(); }
+
+  bool enabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+  void start(size_t queueLength)
+  {
+    auto lck = mrpt::lockHelper(m_lifecycleMtx);
+    if (m_enabled) return;
+    // Round up to a power of two, as required by the ring indexing:
+    size_t n = 64;
+    while (n < queueLength) n <<= 1;
+    m_cells = std::make_unique<Cell[]>(n);
+    for (size_t i = 0; i < n; i++) m_cells[i].seq.store(i, std::memory_order_relaxed);
+    m_mask = n - 1;
+    m_head = 0;
+    m_tail = 0;
+    m_quit = false;
+    m_worker = std::thread(&AsyncConsoleDispatcher::workerLoop, this);
+    m_enabled = true;
+  }
+
+  void stop()
+  {
+    auto lck = mrpt::lockHelper(m_lifecycleMtx);
+    if (!m_enabled) return;
+    m_enabled = false;  // new messages go back to the synchronous path
+    m_quit = true;
+    m_cv.notify_one();
+    if (m_worker.joinable()) m_worker.join();  // drains the queue before exiting
+  }
+
+  /** Lock-free; returns false if the mode is off or the ring is full, in
+   * which case the caller must write synchronously. */
+  bool tryEnqueue(TAsyncLogRecord&& rec)
+  {
+    if (!enabled()) return false;
+    size_t pos = m_head.load(std::memory_order_relaxed);
+    for (;;)
+    {
+      Cell& c = m_cells[pos & m_mask];
+      const size_t seq = c.seq.load(std::memory_order_acquire);
+      const auto dif = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+      if (dif == 0)
+      {
+        if (m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        {
+          c.rec = std::move(rec);
+          c.seq.store(pos + 1, std::memory_order_release);
+          m_cv.notify_one();
+          return true;
+        }
+      }
+      else if (dif < 0)
+      {
+        return false;  // full
+      }
+      else
+      {
+        pos = m_head.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  void flush()
+  {
+    while (enabled() &&
+           (m_tail.load(std::memory_order_acquire) != m_head.load(std::memory_order_acquire) ||
+            m_writerBusy.load(std::memory_order_acquire)))
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+ private:
+  AsyncConsoleDispatcher() = default;
+
+  struct Cell
+  {
+    std::atomic<size_t> seq{0};
+    TAsyncLogRecord rec;
+  };
+
+  bool tryDequeue(TAsyncLogRecord& rec)
+  {
+    size_t pos = m_tail.load(std::memory_order_relaxed);
+    for (;;)
+    {
+      Cell& c = m_cells[pos & m_mask];
+      const size_t seq = c.seq.load(std::memory_order_acquire);
+      const auto dif = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+      if (dif == 0)
+      {
+        if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        {
+          rec = std::move(c.rec);
+          c.seq.store(pos + m_mask + 1, std::memory_order_release);
+          return true;
+        }
+      }
+      else if (dif < 0)
+      {
+        return false;  // empty
+      }
+      else
+      {
+        pos = m_tail.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  void workerLoop()
+  {
+    TAsyncLogRecord rec;
+    for (;;)
+    {
+      // Raise the busy flag *before* popping, so that flush() cannot see an
+      // empty queue while a just-popped record is still being written:
+      m_writerBusy.store(true, std::memory_order_release);
+      if (tryDequeue(rec))
+      {
+        dumpEntryToConsole(rec.timestamp, rec.level, rec.name, rec.body);
+        m_writerBusy.store(false, std::memory_order_release);
+        continue;
+      }
+      m_writerBusy.store(false, std::memory_order_release);
+      if (m_quit.load(std::memory_order_acquire)) break;  // queue drained
+      std::unique_lock<std::mutex> lck(m_cvMtx);
+      m_cv.wait_for(lck, std::chrono::milliseconds(50));
+    }
+  }
+
+  std::unique_ptr<Cell[]> m_cells;
+  size_t m_mask = 0;
+  std::atomic<size_t> m_head{0}, m_tail{0};
+  std::atomic<bool> m_enabled{false}, m_quit{false}, m_writerBusy{false};
+  std::mutex m_lifecycleMtx, m_cvMtx;
+  std::condition_variable m_cv;
+  std::thread m_worker;
+};
+}  // namespace
+
+void COutputLogger::enableAsyncConsoleOutput(bool enable, size_t queue_length)
+{
+  if (enable)
+    AsyncConsoleDispatcher::Instance().start(queue_length);
+  else
+    AsyncConsoleDispatcher::Instance().stop();
+}
+
+void COutputLogger::flushAsyncConsoleOutput() { AsyncConsoleDispatcher::Instance().flush(); }
+
+bool COutputLogger::isAsyncConsoleOutputEnabled()
+{
+  return AsyncConsoleDispatcher::Instance().enabled();
+}
+
 void COutputLogger::logStr(const VerbosityLevel level, std::string_view msg_str) const
 {
+  const bool to_console = (level >= m_min_verbosity_level) && logging_enable_console_output;
+  const bool to_callbacks = (level >= m_min_verbosity_level_callbacks);
+
+  // Cheap early-out if the message would go nowhere:
+  if (!to_console && !logging_enable_keep_record && !(to_callbacks && !m_listCallbacks.empty()))
+    return;
+
   // initialize a TMsg object
   TMsg msg(level, msg_str, *this);
   if (logging_enable_keep_record)
@@ -77,10 +272,15 @@ void COutputLogger::logStr(const VerbosityLevel level, std::string_view msg_str)
     m_history.push_back(msg);
   }
 
-  if (level >= m_min_verbosity_level && logging_enable_console_output) msg.dumpToConsole();
+  if (to_console)
+  {
+    auto& async = AsyncConsoleDispatcher::Instance();
+    if (!async.enabled() || !async.tryEnqueue({msg.timestamp, msg.level, msg.name, msg.body}))
+      msg.dumpToConsole();
+  }
 
   // User callbacks:
-  if (level >= m_min_verbosity_level_callbacks)
+  if (to_callbacks)
   {
     for (const auto& c : m_listCallbacks) c(msg.body, msg.level, msg.name, msg.timestamp);
   }
@@ -210,7 +410,13 @@ COutputLogger::TMsg::TMsg(
 
 COutputLogger::TMsg::~TMsg() = default;
 
-std::string COutputLogger::TMsg::getAsString() const
+namespace
+{
+std::string formatLogEntry(
+    const mrpt::Clock::time_point timestamp,
+    VerbosityLevel level,
+    const std::string& name,
+    const std::string& body)
 {
   stringstream out;
   out << "[" << mrpt::system::timeLocalToString(timestamp, 4) << "|"
@@ -219,21 +425,14 @@ std::string COutputLogger::TMsg::getAsString() const
 
   return out.str();
 }
-void COutputLogger::TMsg::getAsString(std::string* contents) const
-{
-  *contents = this->getAsString();
-}
-void COutputLogger::TMsg::writeToStream(std::ostream& out) const
-{
-  const std::string str = getAsString();
-  out << str;
-#ifdef _MSC_VER
-  OutputDebugStringA(str.c_str());
-#endif
-}
-void COutputLogger::TMsg::dumpToConsole() const
+
+void dumpEntryToConsole(
+    const mrpt::Clock::time_point timestamp,
+    VerbosityLevel level,
+    const std::string& name,
+    const std::string& body)
 {
-  const std::string str = getAsString();
+  const std::string str = formatLogEntry(timestamp, level, name, body);
 
   const bool dump_to_cerr = (level == LVL_ERROR);  // LVL_ERROR alternatively
   // dumped to stderr instead
@@ -253,6 +452,28 @@ void COutputLogger::TMsg::dumpToConsole() const
   OutputDebugStringA(str.c_str());  // call benchmarked: avrg 90 us (50-200 us)
 #endif
 }
+}  // namespace
+
+std::string COutputLogger::TMsg::getAsString() const
+{
+  return formatLogEntry(timestamp, level, name, body);
+}
+void COutputLogger::TMsg::getAsString(std::string* contents) const
+{
+  *contents = this->getAsString();
+}
+void COutputLogger::TMsg::writeToStream(std::ostream& out) const
+{
+  const std::string str = getAsString();
+  out << str;
+#ifdef _MSC_VER
+  OutputDebugStringA(str.c_str());
+#endif
+}
+void COutputLogger::TMsg::dumpToConsole() const
+{
+  dumpEntryToConsole(timestamp, level, name, body);
+}
 
 void COutputLogger::logRegisterCallback(output_logger_callback_t userFunc)
 {
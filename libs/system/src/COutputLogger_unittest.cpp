@@ -0,0 +1,71 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/core/format.h>
+#include <mrpt/system/COutputLogger.h>
+
+#include <iostream>
+#include <sstream>
+
+using namespace mrpt::system;
+
+TEST(COutputLogger, asyncConsoleOutput)
+{
+  COutputLogger logger("test_async");
+  logger.setMinLoggingLevel(LVL_DEBUG);
+
+  // Capture std::cout while the async writer drains the queue:
+  std::stringstream capture;
+  auto* oldBuf = std::cout.rdbuf(capture.rdbuf());
+
+  COutputLogger::enableAsyncConsoleOutput(true, 256);
+  EXPECT_TRUE(COutputLogger::isAsyncConsoleOutputEnabled());
+
+  const int N = 50;
+  for (int i = 0; i < N; i++) logger.logFmt(LVL_INFO, "async msg %i", i);
+
+  COutputLogger::flushAsyncConsoleOutput();
+  COutputLogger::enableAsyncConsoleOutput(false);
+  EXPECT_FALSE(COutputLogger::isAsyncConsoleOutputEnabled());
+
+  std::cout.rdbuf(oldBuf);
+
+  // All messages must have reached the console, none lost or duplicated:
+  const std::string all = capture.str();
+  for (int i = 0; i < N; i++)
+  {
+    const std::string needle = mrpt::format("async msg %i", i);
+    EXPECT_NE(all.find(needle), std::string::npos) << "Missing: " << needle;
+  }
+}
+
+TEST(COutputLogger, keepRecordAndCallbacks)
+{
+  COutputLogger logger("test_record");
+  logger.setMinLoggingLevel(LVL_ERROR);
+  logger.logging_enable_console_output = false;
+  logger.logging_enable_keep_record = true;
+
+  int cbCount = 0;
+  logger.logRegisterCallback(
+      [&cbCount](
+          std::string_view, const VerbosityLevel, std::string_view, const mrpt::Clock::time_point)
+      { cbCount++; });
+
+  // Below the visible level: must be kept in the record, but not dispatched:
+  logger.logStr(LVL_DEBUG, "hidden msg");
+  // Visible:
+  logger.logStr(LVL_ERROR, "visible msg");
+
+  EXPECT_EQ(cbCount, 1);
+  const std::string hist = logger.getLogAsString();
+  EXPECT_NE(hist.find("hidden msg"), std::string::npos);
+  EXPECT_NE(hist.find("visible msg"), std::string::npos);
+}
@@ -0,0 +1,208 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include "system-precomp.h"  // Precompiled headers
+//
+#include <mrpt/core/format.h>
+#include <mrpt/system/CTimeLogger.h>
+#include <mrpt/system/CTraceProfiler.h>
+#include <mrpt/system/thread_name.h>
+
+#include <fstream>
+#include <map>
+
+using namespace mrpt::system;
+
+namespace
+{
+// Hot-path cache of the ring of (this thread, the last profiler used by it),
+// so record() touches no lock nor registry in the common case:
+thread_local const void* tl_lastProfiler = nullptr;
+thread_local void* tl_lastRing = nullptr;
+}  // namespace
+
+CTraceProfiler::CTraceProfiler(bool enabled, const std::string& name) :
+    m_enabled(enabled), m_name(name)
+{
+  using namespace std::chrono_literals;
+
+  m_flusher = std::thread(
+      [this]
+      {
+        for (;;)
+        {
+          std::unique_lock<std::mutex> lk(m_flusherCvMtx);
+          m_flusherCv.wait_for(lk, 50ms, [this] { return m_stopFlusher.load(); });
+          if (m_stopFlusher) return;
+          lk.unlock();
+          flushNow();
+        }
+      });
+  mrpt::system::thread_name("traceProfilerFlush", m_flusher);
+}
+
+CTraceProfiler::~CTraceProfiler()
+{
+  m_enabled = false;
+  m_stopFlusher = true;
+  m_flusherCv.notify_all();
+  if (m_flusher.joinable()) m_flusher.join();
+  // Invalidate the thread-local cache of (at least) this thread:
+  if (tl_lastProfiler == this) tl_lastProfiler = nullptr;
+}
+
+void CTraceProfiler::record(const char* name, char phase) noexcept
+{
+  TThreadRing* ring;
+  if (tl_lastProfiler == this) { ring = static_cast<TThreadRing*>(tl_lastRing); }
+  else
+  {
+    try
+    {
+      ring = registerThisThread();
+    }
+    catch (...)
+    {
+      return;
+    }
+    tl_lastProfiler = this;
+    tl_lastRing = ring;
+  }
+
+  // SPSC ring: we are the only writer of head, the flusher the only one of
+  // tail. Both grow monotonically and are masked when indexing.
+  const auto h = ring->head.load(std::memory_order_relaxed);
+  const auto t = ring->tail.load(std::memory_order_acquire);
+  if (h - t >= TThreadRing::CAPACITY)
+  {
+    m_dropped++;  // full: dropping is cheaper than blocking the timed code
+    return;
+  }
+  auto& e = ring->events[h & (TThreadRing::CAPACITY - 1)];
+  e.name = name;
+  e.phase = phase;
+  e.t_ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_t0)
+          .count();
+  ring->head.store(h + 1, std::memory_order_release);
+}
+
+CTraceProfiler::TThreadRing* CTraceProfiler::registerThisThread()
+{
+  const auto myId = std::this_thread::get_id();
+  std::lock_guard<std::mutex> lk(m_ringsMtx);
+  for (auto& r : m_rings)
+    if (r->owner == myId) return r.get();
+
+  auto r = std::make_shared<TThreadRing>();
+  r->owner = myId;
+  r->tid = m_rings.size();
+  m_rings.push_back(r);
+  return r.get();
+}
+
+void CTraceProfiler::drainRingsIntoTimeline()
+{
+  std::vector<std::shared_ptr<TThreadRing>> rings;
+  {
+    std::lock_guard<std::mutex> lk(m_ringsMtx);
+    rings = m_rings;
+  }
+  for (auto& ring : rings)
+  {
+    auto t = ring->tail.load(std::memory_order_relaxed);
+    const auto h = ring->head.load(std::memory_order_acquire);
+    for (; t != h; ++t)
+      m_events.emplace_back(ring->events[t & (TThreadRing::CAPACITY - 1)], ring->tid);
+    ring->tail.store(t, std::memory_order_release);
+  }
+}
+
+void CTraceProfiler::flushNow()
+{
+  std::lock_guard<std::mutex> lk(m_flushMtx);
+  drainRingsIntoTimeline();
+}
+
+std::size_t CTraceProfiler::eventCount() const
+{
+  std::lock_guard<std::mutex> lk(m_flushMtx);
+  return m_events.size();
+}
+
+void CTraceProfiler::clear()
+{
+  std::lock_guard<std::mutex> lk(m_flushMtx);
+  drainRingsIntoTimeline();  // empty the rings too
+  m_events.clear();
+  m_dropped = 0;
+}
+
+std::string CTraceProfiler::getChromeTraceJSON() const
+{
+  const_cast<CTraceProfiler*>(this)->flushNow();
+
+  std::string s;
+  s += "{\"traceEvents\":[\n";
+  if (!m_name.empty())
+    s += "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"" + m_name +
+         "\"}},\n";
+
+  std::lock_guard<std::mutex> lk(m_flushMtx);
+  bool first = true;
+  for (const auto& [e, tid] : m_events)
+  {
+    if (!first) s += ",\n";
+    first = false;
+    // ts is in microseconds in this format:
+    s += mrpt::format(
+        "{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%u", e.name, e.phase,
+        e.t_ns * 1e-3, static_cast<unsigned int>(tid));
+    if (e.phase == 'i') s += ",\"s\":\"t\"";
+    s += "}";
+  }
+  s += "\n],\"displayTimeUnit\":\"ms\"}\n";
+  return s;
+}
+
+void CTraceProfiler::saveToChromeTraceFile(const std::string& filename) const
+{
+  std::ofstream(filename) << getChromeTraceJSON();
+}
+
+void CTraceProfiler::aggregateStatsTo(CTimeLogger& logger) const
+{
+  const_cast<CTraceProfiler*>(this)->flushNow();
+
+  std::lock_guard<std::mutex> lk(m_flushMtx);
+
+  // Match B/E pairs per (thread, section). Events of one thread are in
+  // chronological order in m_events; the per-key stack handles recursion.
+  std::map<std::pair<std::size_t, const char*>, std::vector<int64_t>> openCalls;
+  for (const auto& [e, tid] : m_events)
+  {
+    switch (e.phase)
+    {
+      case 'B':
+        openCalls[{tid, e.name}].push_back(e.t_ns);
+        break;
+      case 'E':
+      {
+        auto& stack = openCalls[{tid, e.name}];
+        if (stack.empty()) break;  // unmatched end()
+        const double dt = (e.t_ns - stack.back()) * 1e-9;
+        stack.pop_back();
+        logger.registerUserMeasure(e.name, dt, true /*is_time*/);
+      }
+      break;
+      default:
+        break;
+    }
+  }
+}
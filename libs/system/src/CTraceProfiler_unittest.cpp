@@ -0,0 +1,91 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/system/CTimeLogger.h>
+#include <mrpt/system/CTraceProfiler.h>
+
+#include <chrono>
+#include <thread>
+
+TEST(CTraceProfiler, recordAndExport)
+{
+  mrpt::system::CTraceProfiler tp(true, "myTrace");
+
+  for (int i = 0; i < 10; i++)
+  {
+    mrpt::system::CTraceProfilerEntry tle(tp, "mySection");
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  tp.instant("myMarker");
+
+  tp.flushNow();
+  EXPECT_EQ(tp.eventCount(), 10U * 2 + 1);
+  EXPECT_EQ(tp.droppedEvents(), 0U);
+
+  const std::string json = tp.getChromeTraceJSON();
+  EXPECT_NE(json.find("\"mySection\""), std::string::npos);
+  EXPECT_NE(json.find("\"myMarker\""), std::string::npos);
+  EXPECT_NE(json.find("\"ph\":\"B\""), std::string::npos);
+  EXPECT_NE(json.find("\"ph\":\"E\""), std::string::npos);
+
+  tp.clear();
+  EXPECT_EQ(tp.eventCount(), 0U);
+}
+
+TEST(CTraceProfiler, disabled)
+{
+  mrpt::system::CTraceProfiler tp(false);
+  tp.begin("foo");
+  tp.end("foo");
+  tp.flushNow();
+  EXPECT_EQ(tp.eventCount(), 0U);
+}
+
+TEST(CTraceProfiler, multithread)
+{
+  mrpt::system::CTraceProfiler tp;
+
+  // Same section from several threads: allowed (unlike CTimeLogger)
+  std::vector<std::thread> ths;
+  for (int i = 0; i < 4; i++)
+    ths.emplace_back(
+        [&tp]()
+        {
+          for (int j = 0; j < 100; j++)
+          {
+            mrpt::system::CTraceProfilerEntry tle(tp, "sharedSection");
+          }
+        });
+  for (auto& t : ths) t.join();
+
+  tp.flushNow();
+  EXPECT_EQ(tp.eventCount() + tp.droppedEvents(), 4U * 100 * 2);
+}
+
+TEST(CTraceProfiler, aggregateStatsTo)
+{
+  mrpt::system::CTraceProfiler tp;
+  for (int i = 0; i < 5; i++)
+  {
+    mrpt::system::CTraceProfilerEntry tle(tp, "foo");
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  mrpt::system::CTimeLogger tl;
+  tp.aggregateStatsTo(tl);
+
+  EXPECT_GT(tl.getMeanTime("foo"), 5e-3);
+  std::map<std::string, mrpt::system::CTimeLogger::TCallStats> stats;
+  tl.getStats(stats);
+  ASSERT_EQ(stats.count("foo"), 1U);
+  EXPECT_EQ(stats["foo"].n_calls, 5U);
+
+  tl.clear(true);  // to silent console output upon dtor
+}
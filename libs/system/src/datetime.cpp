@@ -227,6 +227,56 @@ string mrpt::system::dateTimeToString(const mrpt::system::TTimeStamp t)
       ptm->tm_hour, ptm->tm_min, (unsigned int)ptm->tm_sec, secFractions);
 }
 
+/*---------------------------------------------------------------
+          CTimestampFormatter
+  ---------------------------------------------------------------*/
+const std::string& mrpt::system::CTimestampFormatter::format(const mrpt::system::TTimeStamp t)
+{
+  if (t == INVALID_TIMESTAMP)
+  {
+    static const std::string sInvalid = "INVALID_TIMESTAMP";
+    return sInvalid;
+  }
+
+  const uint64_t tmp = (t.time_since_epoch().count() - ((uint64_t)116444736 * 1000000000));
+  const uint64_t wholeSecond = tmp / (uint64_t)10000000;
+  const unsigned int secFractions = calcSecFractions(tmp);
+
+  if (wholeSecond != m_cachedSecond || m_buffer.empty())
+  {
+    const auto auxTime = static_cast<time_t>(wholeSecond);
+    tm* ptm = gmtime(&auxTime);
+    if (!ptm)
+    {
+      static const std::string sMalformed = "(Malformed timestamp)";
+      return sMalformed;
+    }
+    m_buffer = mrpt::format(
+        "%u/%02u/%02u,%02u:%02u:%02u.%06u", 1900 + ptm->tm_year, ptm->tm_mon + 1, ptm->tm_mday,
+        ptm->tm_hour, ptm->tm_min, (unsigned int)ptm->tm_sec, secFractions);
+    m_cachedSecond = wholeSecond;
+  }
+  else
+  {
+    // Same second as the previous call: rewrite the six sub-second digits
+    // only, keeping the "YEAR/MONTH/DAY,HH:MM:SS." prefix as is.
+    char* p = &m_buffer[m_buffer.size() - 1];
+    unsigned int v = secFractions;
+    for (int i = 0; i < 6; i++, v /= 10) *p-- = static_cast<char>('0' + v % 10);
+  }
+  return m_buffer;
+}
+
+std::vector<std::string> mrpt::system::timestampsToStrings(
+    const std::vector<mrpt::system::TTimeStamp>& ts)
+{
+  CTimestampFormatter fmt;
+  std::vector<std::string> ret;
+  ret.reserve(ts.size());
+  for (const auto& t : ts) ret.emplace_back(fmt.format(t));
+  return ret;
+}
+
 /*---------------------------------------------------------------
   Convert a timestamp into this textual form (in local time):
     YEAR/MONTH/DAY,HH:MM:SS.MMM
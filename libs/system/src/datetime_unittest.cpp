@@ -61,6 +61,43 @@ TEST(DateTime, double_to_from)
   EXPECT_NEAR(mrpt::Clock::toDouble(t1), mrpt::Clock::toDouble(t2), 1e-4);
 }
 
+TEST(DateTime, cachedFormatter)
+{
+  const uint64_t t_raw = 127822463930948526;
+  const auto t = mrpt::Clock::time_point(mrpt::Clock::duration(t_raw));
+
+  mrpt::system::CTimestampFormatter f;
+  EXPECT_EQ(f.format(t), mrpt::system::dateTimeToString(t));
+
+  // Within the same second (only sub-second digits change):
+  for (int i = 0; i < 5; i++)
+  {
+    const auto t2 = t + mrpt::Clock::duration(i * 1234567);  // 0.12 s steps
+    EXPECT_EQ(f.format(t2), mrpt::system::dateTimeToString(t2));
+  }
+  // Crossing second boundaries:
+  for (int i = 0; i < 30; i++)
+  {
+    const auto t2 = t + mrpt::Clock::duration(i * 7000000);  // 0.7 s steps
+    EXPECT_EQ(f.format(t2), mrpt::system::dateTimeToString(t2));
+  }
+
+  EXPECT_EQ(f.format(INVALID_TIMESTAMP), "INVALID_TIMESTAMP");
+  EXPECT_EQ(f.format(t), mrpt::system::dateTimeToString(t));
+}
+
+TEST(DateTime, timestampsToStrings)
+{
+  const uint64_t t_raw = 127822463930948526;
+  std::vector<mrpt::system::TTimeStamp> ts;
+  for (int i = 0; i < 20; i++)
+    ts.push_back(mrpt::Clock::time_point(mrpt::Clock::duration(t_raw + i * 3000000)));
+
+  const auto ss = mrpt::system::timestampsToStrings(ts);
+  ASSERT_EQ(ss.size(), ts.size());
+  for (size_t i = 0; i < ts.size(); i++) EXPECT_EQ(ss[i], mrpt::system::dateTimeToString(ts[i]));
+}
+
 TEST(DateTime, timestampAdd)
 {
   const auto t1 = mrpt::Clock::now();
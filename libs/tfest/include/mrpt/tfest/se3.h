@@ -67,6 +67,48 @@ bool se3_l2(
     double& out_scale,
     bool forceScaleToUnity = false);
 
+/** A non-owning, structure-of-arrays view of one frame of a set of matched 3D
+ * points: three parallel coordinate arrays, optionally indirected through an
+ * index array. The i-th matched point is `(xs[idx],ys[idx],zs[idx])` with
+ * `idx = indices ? indices[i] : i`.
+ *
+ * This matches the internal buffers of mrpt::maps::CPointsMap
+ * (`getPointsBufferRef_x()`, etc.) and the per-pair indices
+ * (TMatchingPair::globalIdx / localIdx) filled in by
+ * mrpt::maps::CPointsMap::determineMatching3D().
+ * \note [New in MRPT 2.14.5]
+ * \sa se3_l2
+ */
+struct TMatchedPointsSoA
+{
+  const float* xs = nullptr;
+  const float* ys = nullptr;
+  const float* zs = nullptr;
+  /** Optional indirection into xs/ys/zs (nullptr: use `i` directly) */
+  const uint32_t* indices = nullptr;
+};
+
+/** \overload Allocation-free, structure-of-arrays variant.
+ *
+ * Coordinates are read directly from the point cloud buffers through the
+ * matched indices, so no intermediate pair objects or point vectors are
+ * built, and the sufficient statistics (centroids and cross-covariance) are
+ * accumulated in a single fused pass over the matches.
+ *
+ * If `weights` is non-null it must point to `nMatches` per-pair weights, and
+ * the weighted least-squares problem is solved instead, reusing the same
+ * accumulators.
+ * \note [New in MRPT 2.14.5]
+ */
+bool se3_l2(
+    size_t nMatches,
+    const TMatchedPointsSoA& pts_this,
+    const TMatchedPointsSoA& pts_other,
+    mrpt::poses::CPose3DQuat& out_transform,
+    double& out_scale,
+    bool forceScaleToUnity = false,
+    const double* weights = nullptr);
+
 /** Parameters for se3_l2_robust(). See function for more details */
 struct TSE3RobustParams
 {
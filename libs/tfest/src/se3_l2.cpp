@@ -69,75 +69,89 @@ using namespace std;
   ---------------------------------------------------------------*/
 namespace
 {
-bool se3_l2_internal(
-    std::vector<mrpt::math::TPoint3D>& points_this,   // IN/OUT: It gets modified!
-    std::vector<mrpt::math::TPoint3D>& points_other,  // IN/OUT: It gets modified!
-    mrpt::poses::CPose3DQuat& out_transform,
-    double& out_scale,
-    bool forceScaleToUnity)
+/** Sufficient statistics of the (optionally weighted) Horn problem, built in
+ * a single pass over the matched pairs without copying or modifying the
+ * inputs: weighted coordinate sums, raw cross products and squared norms.
+ * The centered (centroid-subtracted) quantities the closed form needs are
+ * recovered algebraically in solve(). */
+struct TSe3L2Accums
 {
-  MRPT_START
-
-  ASSERT_EQUAL_(points_this.size(), points_other.size());
-  // Compute the centroids
-  TPoint3D ct_others(0, 0, 0), ct_this(0, 0, 0);
-  const size_t nMatches = points_this.size();
-
-  if (nMatches < 3) return false;  // Nothing we can estimate without 3 points!!
-
-  for (size_t i = 0; i < nMatches; i++)
+  size_t n = 0;  //!< Number of matches
+  double W = 0;  //!< Total weight (=n if unweighted)
+  double sTx = 0, sTy = 0, sTz = 0;  //!< sum w*p_this
+  double sOx = 0, sOy = 0, sOz = 0;  //!< sum w*p_other
+  double S[3][3] = {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}};  //!< sum w*p_other (x) p_this
+  double sqT = 0, sqO = 0;  //!< sum w*|p|^2
+
+  inline void add(double w, double tx, double ty, double tz, double ox, double oy, double oz)
   {
-    ct_others += points_other[i];
-    ct_this += points_this[i];
+    n++;
+    W += w;
+    sTx += w * tx;
+    sTy += w * ty;
+    sTz += w * tz;
+    sOx += w * ox;
+    sOy += w * oy;
+    sOz += w * oz;
+    S[0][0] += w * ox * tx;
+    S[0][1] += w * ox * ty;
+    S[0][2] += w * ox * tz;
+    S[1][0] += w * oy * tx;
+    S[1][1] += w * oy * ty;
+    S[1][2] += w * oy * tz;
+    S[2][0] += w * oz * tx;
+    S[2][1] += w * oz * ty;
+    S[2][2] += w * oz * tz;
+    sqT += w * (tx * tx + ty * ty + tz * tz);
+    sqO += w * (ox * ox + oy * oy + oz * oz);
   }
 
-  const double F = 1.0 / nMatches;
-  ct_others *= F;
-  ct_this *= F;
+  bool solve(mrpt::poses::CPose3DQuat& out_transform, double& out_scale, bool forceScaleToUnity)
+      const;
+};
 
-  CMatrixDouble33 S;  // Zeroed by default
-
-  // Substract the centroid and compute the S matrix of cross products
-  for (size_t i = 0; i < nMatches; i++)
-  {
-    points_this[i] -= ct_this;
-    points_other[i] -= ct_others;
+bool TSe3L2Accums::solve(
+    mrpt::poses::CPose3DQuat& out_transform, double& out_scale, bool forceScaleToUnity) const
+{
+  MRPT_START
 
-    S(0, 0) += points_other[i].x * points_this[i].x;
-    S(0, 1) += points_other[i].x * points_this[i].y;
-    S(0, 2) += points_other[i].x * points_this[i].z;
+  if (n < 3) return false;  // Nothing we can estimate without 3 points!!
+  ASSERT_GT_(W, 0);
 
-    S(1, 0) += points_other[i].y * points_this[i].x;
-    S(1, 1) += points_other[i].y * points_this[i].y;
-    S(1, 2) += points_other[i].y * points_this[i].z;
+  // The centroids:
+  const double F = 1.0 / W;
+  const TPoint3D ct_this(sTx * F, sTy * F, sTz * F);
+  const TPoint3D ct_others(sOx * F, sOy * F, sOz * F);
 
-    S(2, 0) += points_other[i].z * points_this[i].x;
-    S(2, 1) += points_other[i].z * points_this[i].y;
-    S(2, 2) += points_other[i].z * points_this[i].z;
-  }
+  // Centered cross products: sum w*(o-co)(t-ct)^T = S - W*co*ct^T
+  CMatrixDouble33 Sc;
+  const double co[3] = {ct_others.x, ct_others.y, ct_others.z};
+  const double ct[3] = {ct_this.x, ct_this.y, ct_this.z};
+  for (int r = 0; r < 3; r++)
+    for (int c = 0; c < 3; c++) Sc(r, c) = S[r][c] - W * co[r] * ct[c];
 
   // Construct the N matrix
   CMatrixDouble44 N;  // Zeroed by default
 
-  N(0, 0) = S(0, 0) + S(1, 1) + S(2, 2);
-  N(0, 1) = S(1, 2) - S(2, 1);
-  N(0, 2) = S(2, 0) - S(0, 2);
-  N(0, 3) = S(0, 1) - S(1, 0);
+  N(0, 0) = Sc(0, 0) + Sc(1, 1) + Sc(2, 2);
+  N(0, 1) = Sc(1, 2) - Sc(2, 1);
+  N(0, 2) = Sc(2, 0) - Sc(0, 2);
+  N(0, 3) = Sc(0, 1) - Sc(1, 0);
 
   N(1, 0) = N(0, 1);
-  N(1, 1) = S(0, 0) - S(1, 1) - S(2, 2);
-  N(1, 2) = S(0, 1) + S(1, 0);
-  N(1, 3) = S(2, 0) + S(0, 2);
+  N(1, 1) = Sc(0, 0) - Sc(1, 1) - Sc(2, 2);
+  N(1, 2) = Sc(0, 1) + Sc(1, 0);
+  N(1, 3) = Sc(2, 0) + Sc(0, 2);
 
   N(2, 0) = N(0, 2);
   N(2, 1) = N(1, 2);
-  N(2, 2) = -S(0, 0) + S(1, 1) - S(2, 2);
-  N(2, 3) = S(1, 2) + S(2, 1);
+  N(2, 2) = -Sc(0, 0) + Sc(1, 1) - Sc(2, 2);
+  N(2, 3) = Sc(1, 2) + Sc(2, 1);
 
   N(3, 0) = N(0, 3);
   N(3, 1) = N(1, 3);
   N(3, 2) = N(2, 3);
-  N(3, 3) = -S(0, 0) - S(1, 1) + S(2, 2);
+  N(3, 3) = -Sc(0, 0) - Sc(1, 1) + Sc(2, 2);
 
   // q is the quaternion correspondent to the greatest eigenvector of the N
   // matrix (last column in Z)
@@ -170,13 +184,9 @@ bool se3_l2_internal(
   }
   else
   {
-    double num = 0.0;
-    double den = 0.0;
-    for (size_t i = 0; i < nMatches; i++)
-    {
-      num += square(points_other[i].x) + square(points_other[i].y) + square(points_other[i].z);
-      den += square(points_this[i].x) + square(points_this[i].y) + square(points_this[i].z);
-    }  // end-for
+    // Centered squared norms: sum w*|p-c|^2 = sum w*|p|^2 - W*|c|^2
+    const double num = sqO - W * (square(ct_others.x) + square(ct_others.y) + square(ct_others.z));
+    const double den = sqT - W * (square(ct_this.x) + square(ct_this.y) + square(ct_this.z));
 
     // The scale:
     s = std::sqrt(num / den);
@@ -194,7 +204,7 @@ bool se3_l2_internal(
   return true;
 
   MRPT_END
-}  // end se3_l2_internal()
+}  // end TSe3L2Accums::solve()
 }  // namespace
 
 bool tfest::se3_l2(
@@ -204,12 +214,17 @@ bool tfest::se3_l2(
     double& out_scale,
     bool forceScaleToUnity)
 {
-  // make a copy because we need it anyway to substract the centroid and to
-  // provide a unified interface to TMatchingList API
-  std::vector<mrpt::math::TPoint3D> points_this = in_points_this;
-  std::vector<mrpt::math::TPoint3D> points_other = in_points_other;
+  ASSERT_EQUAL_(in_points_this.size(), in_points_other.size());
 
-  return se3_l2_internal(points_this, points_other, out_transform, out_scale, forceScaleToUnity);
+  TSe3L2Accums acc;
+  const size_t N = in_points_this.size();
+  for (size_t i = 0; i < N; i++)
+  {
+    const auto& t = in_points_this[i];
+    const auto& o = in_points_other[i];
+    acc.add(1.0, t.x, t.y, t.z, o.x, o.y, o.z);
+  }
+  return acc.solve(out_transform, out_scale, forceScaleToUnity);
 }
 
 bool tfest::se3_l2(
@@ -218,19 +233,10 @@ bool tfest::se3_l2(
     double& out_scale,
     bool forceScaleToUnity)
 {
-  // Transform data types:
-  const size_t N = corrs.size();
-  std::vector<mrpt::math::TPoint3D> points_this(N), points_other(N);
-  for (size_t i = 0; i < N; i++)
-  {
-    points_this[i].x = corrs[i].global.x;
-    points_this[i].y = corrs[i].global.y;
-    points_this[i].z = corrs[i].global.z;
-    points_other[i].x = corrs[i].local.x;
-    points_other[i].y = corrs[i].local.y;
-    points_other[i].z = corrs[i].local.z;
-  }
-  return se3_l2_internal(points_this, points_other, out_transform, out_scale, forceScaleToUnity);
+  TSe3L2Accums acc;
+  for (const auto& c : corrs)
+    acc.add(1.0, c.global.x, c.global.y, c.global.z, c.local.x, c.local.y, c.local.z);
+  return acc.solve(out_transform, out_scale, forceScaleToUnity);
 }
 
 bool tfest::se3_l2(
@@ -239,17 +245,35 @@ bool tfest::se3_l2(
     double& out_scale,
     bool forceScaleToUnity)
 {
-  // Transform data types:
-  const size_t N = corrs.size();
-  std::vector<mrpt::math::TPoint3D> points_this(N), points_other(N);
-  for (size_t i = 0; i < N; i++)
+  TSe3L2Accums acc;
+  for (const auto& c : corrs)
+    acc.add(1.0, c.global.x, c.global.y, c.global.z, c.local.x, c.local.y, c.local.z);
+  return acc.solve(out_transform, out_scale, forceScaleToUnity);
+}
+
+bool tfest::se3_l2(
+    size_t nMatches,
+    const TMatchedPointsSoA& pts_this,
+    const TMatchedPointsSoA& pts_other,
+    mrpt::poses::CPose3DQuat& out_transform,
+    double& out_scale,
+    bool forceScaleToUnity,
+    const double* weights)
+{
+  MRPT_START
+  ASSERT_(pts_this.xs && pts_this.ys && pts_this.zs);
+  ASSERT_(pts_other.xs && pts_other.ys && pts_other.zs);
+
+  TSe3L2Accums acc;
+  for (size_t i = 0; i < nMatches; i++)
   {
-    points_this[i].x = corrs[i].global.x;
-    points_this[i].y = corrs[i].global.y;
-    points_this[i].z = corrs[i].global.z;
-    points_other[i].x = corrs[i].local.x;
-    points_other[i].y = corrs[i].local.y;
-    points_other[i].z = corrs[i].local.z;
+    const size_t it = pts_this.indices ? pts_this.indices[i] : i;
+    const size_t io = pts_other.indices ? pts_other.indices[i] : i;
+    acc.add(
+        weights ? weights[i] : 1.0,  //
+        pts_this.xs[it], pts_this.ys[it], pts_this.zs[it],  //
+        pts_other.xs[io], pts_other.ys[io], pts_other.zs[io]);
   }
-  return se3_l2_internal(points_this, points_other, out_transform, out_scale, forceScaleToUnity);
+  return acc.solve(out_transform, out_scale, forceScaleToUnity);
+  MRPT_END
 }
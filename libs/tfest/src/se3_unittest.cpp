@@ -188,6 +188,73 @@ TEST(tfest, se3_l2_PtsLists)
   }
 }  // end
 
+TEST(tfest, se3_l2_SoA)
+{
+  TPoints pA, pB;  // The input points
+  generate_points(pA, pB);
+
+  TMatchingPairList list;
+  generate_list_of_points(pA, pB, list);  // Generate a list of matched points
+
+  // Reference solution, from the pair-list API:
+  CPose3DQuat quRef;
+  double scaleRef;
+  EXPECT_TRUE(mrpt::tfest::se3_l2(list, quRef, scaleRef));
+
+  // The same points, as structure-of-arrays buffers indirected through the
+  // matched indices (as in CPointsMap::determineMatching3D output):
+  const size_t N = pA.size();
+  std::vector<float> gx(N), gy(N), gz(N), lx(N), ly(N), lz(N);
+  std::vector<uint32_t> gIdx(N), lIdx(N);
+  for (size_t i = 0; i < N; i++)
+  {
+    // Store in reversed order, to exercise the index indirection:
+    const size_t j = N - 1 - i;
+    gx[j] = d2f(pA[i][0]);
+    gy[j] = d2f(pA[i][1]);
+    gz[j] = d2f(pA[i][2]);
+    lx[j] = d2f(pB[i][0]);
+    ly[j] = d2f(pB[i][1]);
+    lz[j] = d2f(pB[i][2]);
+    gIdx[i] = lIdx[i] = static_cast<uint32_t>(j);
+  }
+
+  TMatchedPointsSoA soaThis, soaOther;
+  soaThis.xs = gx.data();
+  soaThis.ys = gy.data();
+  soaThis.zs = gz.data();
+  soaThis.indices = gIdx.data();
+  soaOther.xs = lx.data();
+  soaOther.ys = ly.data();
+  soaOther.zs = lz.data();
+  soaOther.indices = lIdx.data();
+
+  CPose3DQuat qu;
+  double scale;
+  EXPECT_TRUE(mrpt::tfest::se3_l2(N, soaThis, soaOther, qu, scale));
+
+  for (unsigned int i = 0; i < 7; ++i) EXPECT_NEAR(qu[i], quRef[i], 1e-10) << "i=" << i;
+  EXPECT_NEAR(scale, scaleRef, 1e-10);
+
+  // Uniform weights must give the same solution:
+  const std::vector<double> w(N, 2.5);
+  CPose3DQuat quW;
+  double scaleW;
+  EXPECT_TRUE(mrpt::tfest::se3_l2(N, soaThis, soaOther, quW, scaleW, false, w.data()));
+  for (unsigned int i = 0; i < 7; ++i) EXPECT_NEAR(quW[i], quRef[i], 1e-10) << "i=" << i;
+
+  // Near-zero weights effectively remove a (perturbed) pair:
+  std::vector<float> gzPerturbed = gz;
+  gzPerturbed[gIdx[0]] += 10.0f;  // Break the first match...
+  soaThis.zs = gzPerturbed.data();
+  std::vector<double> w2(N, 1.0);
+  w2[0] = 1e-9;  // ...and give it a negligible weight.
+  CPose3DQuat quW2;
+  double scaleW2;
+  EXPECT_TRUE(mrpt::tfest::se3_l2(N, soaThis, soaOther, quW2, scaleW2, false, w2.data()));
+  for (unsigned int i = 0; i < 7; ++i) EXPECT_NEAR(quW2[i], quRef[i], 1e-4) << "i=" << i;
+}
+
 TEST(tfest, se3_l2_robust)
 {
   TPoints pA, pB;  // The input points
@@ -65,6 +65,40 @@ void geocentricToENU_WGS84(
     std::vector<mrpt::math::TPoint3D>& out_ENU_points,
     const TGeodeticCoords& in_coords_origin);
 
+/** \overload Batch version for many geodetic points sharing one reference
+ * origin: the origin's geocentric position and the rotation terms of the
+ * local tangent plane are computed only once for the whole batch.
+ * \note [New in MRPT 2.14.5] */
+void geodeticToENU_WGS84(
+    const std::vector<TGeodeticCoords>& in_coords,
+    std::vector<mrpt::math::TPoint3D>& out_ENU_points,
+    const TGeodeticCoords& in_coords_origin);
+
+/** A cached local tangent plane (ENU frame) on the WGS84 ellipsoid, for
+ * repeated conversions against one reference origin: the geocentric origin
+ * and the ECEF-to-ENU rotation terms are precomputed at construction, so
+ * each converted point only pays its own trigonometry.
+ * \sa geodeticToENU_WGS84, geocentricToENU_WGS84
+ * \note [New in MRPT 2.14.5] */
+struct TLocalTangentPlaneWGS84
+{
+  TLocalTangentPlaneWGS84() = default;
+  explicit TLocalTangentPlaneWGS84(const TGeodeticCoords& origin);
+
+  /** The reference origin, as geocentric (ECEF) coordinates. */
+  mrpt::math::TPoint3D originGeocentric{0, 0, 0};
+  /** Hoisted sin/cos terms of the ECEF-to-ENU rotation at the origin. */
+  double clat{1}, slat{0}, clon{1}, slon{0};
+
+  /** Geocentric (ECEF) to ENU, using the cached rotation terms. */
+  void geocentricToENU(
+      const mrpt::math::TPoint3D& in_geocentric_point, mrpt::math::TPoint3D& out_ENU_point) const;
+
+  /** Geodetic to ENU, using the cached rotation terms. */
+  void geodeticToENU(
+      const TGeodeticCoords& in_coords, mrpt::math::TPoint3D& out_ENU_point) const;
+};
+
 /** Coordinates transformation from longitude/latitude/height to geocentric
  * X/Y/Z coordinates (with a WGS84 geoid).
  *  The WGS84 ellipsoid is used for the transformation. The coordinates are in
@@ -133,6 +133,54 @@ void mrpt::topography::geodeticToENU_WGS84(
   geocentricToENU_WGS84(P_geocentric, out_ENU_point, in_coords_origin);
 }
 
+void mrpt::topography::geodeticToENU_WGS84(
+    const std::vector<TGeodeticCoords>& in_coords,
+    std::vector<mrpt::math::TPoint3D>& out_ENU_points,
+    const TGeodeticCoords& in_coords_origin)
+{
+  const TLocalTangentPlaneWGS84 ltp(in_coords_origin);
+
+  const size_t N = in_coords.size();
+  out_ENU_points.resize(N);
+  for (size_t i = 0; i < N; i++) ltp.geodeticToENU(in_coords[i], out_ENU_points[i]);
+}
+
+/*---------------------------------------------------------------
+        TLocalTangentPlaneWGS84
+ ---------------------------------------------------------------*/
+mrpt::topography::TLocalTangentPlaneWGS84::TLocalTangentPlaneWGS84(const TGeodeticCoords& origin)
+{
+  geodeticToGeocentric_WGS84(origin, originGeocentric);
+
+  clat = cos(DEG2RAD(origin.lat));
+  slat = sin(DEG2RAD(origin.lat));
+  clon = cos(DEG2RAD(origin.lon));
+  slon = sin(DEG2RAD(origin.lon));
+}
+
+void mrpt::topography::TLocalTangentPlaneWGS84::geocentricToENU(
+    const mrpt::math::TPoint3D& in_geocentric_point, mrpt::math::TPoint3D& out_ENU_point) const
+{
+  // Relative coordinates first, for using smaller numbers:
+  const mrpt::math::TPoint3D P_geocentric = in_geocentric_point - originGeocentric;
+
+  // Transposed rotation matrix from ENU -> ECEF (see
+  // geocentricToENU_WGS84() above):
+  out_ENU_point.x = -slon * P_geocentric.x + clon * P_geocentric.y;
+  out_ENU_point.y =
+      -clon * slat * P_geocentric.x - slon * slat * P_geocentric.y + clat * P_geocentric.z;
+  out_ENU_point.z =
+      clon * clat * P_geocentric.x + slon * clat * P_geocentric.y + slat * P_geocentric.z;
+}
+
+void mrpt::topography::TLocalTangentPlaneWGS84::geodeticToENU(
+    const TGeodeticCoords& in_coords, mrpt::math::TPoint3D& out_ENU_point) const
+{
+  TPoint3D P_geocentric;
+  geodeticToGeocentric_WGS84(in_coords, P_geocentric);
+  geocentricToENU(P_geocentric, out_ENU_point);
+}
+
 /*---------------------------------------------------------------
           ENU_axes_from_WGS84
  ---------------------------------------------------------------*/
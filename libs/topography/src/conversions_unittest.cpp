@@ -70,3 +70,46 @@ TEST(TopographyConversion, geodeticToENU_WGS84)
   EXPECT_NEAR(P.y, 0, 0.1e-3);
   EXPECT_NEAR(P.z, A_height, 0.1e-3);
 }
+
+TEST(TopographyConversion, geodeticToENU_WGS84_batch)
+{
+  mrpt::topography::TGeodeticCoords gps_ref;
+  gps_ref.lon = -4.4789588283333330;
+  gps_ref.lat = 36.714459075;
+  gps_ref.height = 38.8887;
+
+  // A few points around the reference:
+  std::vector<mrpt::topography::TGeodeticCoords> pts;
+  for (int i = -2; i <= 2; i++)
+  {
+    mrpt::topography::TGeodeticCoords c = gps_ref;
+    c.lat = c.lat.getDecimalValue() + 1e-4 * i;
+    c.lon = c.lon.getDecimalValue() - 2e-4 * i;
+    c.height += 0.5 * i;
+    pts.push_back(c);
+  }
+
+  // The batch overload and the cached tangent plane must match the
+  // one-point-at-a-time conversion exactly:
+  std::vector<TPoint3D> enu;
+  mrpt::topography::geodeticToENU_WGS84(pts, enu, gps_ref);
+  ASSERT_EQ(enu.size(), pts.size());
+
+  const mrpt::topography::TLocalTangentPlaneWGS84 ltp(gps_ref);
+
+  for (size_t i = 0; i < pts.size(); i++)
+  {
+    TPoint3D P;
+    mrpt::topography::geodeticToENU_WGS84(pts[i], P, gps_ref);
+
+    EXPECT_NEAR(P.x, enu[i].x, 1e-9);
+    EXPECT_NEAR(P.y, enu[i].y, 1e-9);
+    EXPECT_NEAR(P.z, enu[i].z, 1e-9);
+
+    TPoint3D P2;
+    ltp.geodeticToENU(pts[i], P2);
+    EXPECT_NEAR(P.x, P2.x, 1e-9);
+    EXPECT_NEAR(P.y, P2.y, 1e-9);
+    EXPECT_NEAR(P.z, P2.z, 1e-9);
+  }
+}
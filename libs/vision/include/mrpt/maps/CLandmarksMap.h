@@ -13,6 +13,7 @@
 #include <mrpt/maps/CLandmark.h>
 #include <mrpt/maps/CMetricMap.h>
 #include <mrpt/math/CMatrixF.h>
+#include <mrpt/math/KDTreeCapable.h>
 #include <mrpt/obs/CObservation2DRangeScan.h>
 #include <mrpt/obs/CObservationBearingRange.h>
 #include <mrpt/obs/CObservationGPS.h>
@@ -130,7 +131,8 @@ class CLandmarksMap : public mrpt::maps::CMetricMap
   /** The list of landmarks: the wrapper class is just for maintaining the
    * KD-Tree representation
    */
-  struct TCustomSequenceLandmarks
+  struct TCustomSequenceLandmarks :
+      public mrpt::math::KDTreeCapable<TCustomSequenceLandmarks, float>
   {
    private:
     /** The actual list */
@@ -194,6 +196,29 @@ class CLandmarksMap : public mrpt::maps::CMetricMap
      */
     float getLargestDistanceFromOrigin() const;
 
+    /** @name Interface with the nanoflann library: a KD-tree over the
+     * landmark 3D means, used e.g. for gating in the likelihood
+     * evaluation. \note [New in MRPT 2.14.5]
+     *  @{ */
+    inline size_t kdtree_get_point_count() const { return m_landmarks.size(); }
+    inline float kdtree_get_pt(const size_t idx, int dim) const
+    {
+      const auto& p = m_landmarks[idx].pose_mean;
+      return mrpt::d2f(dim == 0 ? p.x : (dim == 1 ? p.y : p.z));
+    }
+    inline float kdtree_distance(const float* p1, const size_t idx_p2, size_t /*size*/) const
+    {
+      const auto& p = m_landmarks[idx_p2].pose_mean;
+      return mrpt::square(p1[0] - mrpt::d2f(p.x)) + mrpt::square(p1[1] - mrpt::d2f(p.y)) +
+             mrpt::square(p1[2] - mrpt::d2f(p.z));
+    }
+    template <class BBOX>
+    bool kdtree_get_bbox(BBOX&) const
+    {
+      return false;
+    }
+    /** @} */
+
   } landmarks;
 
   CLandmarksMap() = default;
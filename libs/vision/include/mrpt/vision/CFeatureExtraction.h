@@ -173,6 +173,21 @@ class CFeatureExtraction
       bool extract_patch{false};
     } ORBOptions;
 
+    /** Options for detectFeaturesMultiScale() [New in MRPT 2.14.5] */
+    struct TMultiScaleOptions
+    {
+      /** Number of pyramid octaves (each one half the size of the former) */
+      size_t n_octaves{4};
+      /** Use a smooth 2x2 mean filter when halving octaves */
+      bool smooth_halves{true};
+      /** Number of grid cells (per axis, at each octave) for the per-cell
+       * keypoint budget (grid-adaptive non-maximal suppression) */
+      unsigned int grid_cells_x{8}, grid_cells_y{8};
+      /** Number of worker threads for per-octave detection: 0 (default)
+       * uses all hardware threads, 1 disables threading. */
+      unsigned int threads{0};
+    } multiScaleOptions;
+
     /** SIFT Options  */
     struct TSIFTOptions
     {
@@ -333,6 +348,30 @@ class CFeatureExtraction
       CFeatureList& inout_features,
       TDescriptorType in_descriptor_list);
 
+  /** Multi-scale FAST (or FAST+ORB) detection over an image pyramid, with
+   * per-octave detection running in worker threads overlapped with the
+   * construction of the next octave, and a per-grid-cell keypoint budget
+   * (grid-adaptive non-maximal suppression) that bounds descriptor work on
+   * heavily-textured images.
+   *
+   * `options.featsType` must be featFAST (keypoints only) or featORB
+   * (ORB descriptors are computed for the kept keypoints of each octave).
+   * Further parameters are taken from `options.multiScaleOptions` and
+   * `options.FASTOptions.threshold` / `nonmax_suppression`.
+   *
+   * Keypoint coordinates are returned in full-resolution image pixels, with
+   * the source octave in each keypoint's `octave` field. When
+   * `nDesiredFeatures>0` the budget is split across octaves proportionally
+   * to their pixel count.
+   * \note [New in MRPT 2.14.5]
+   * \sa detectFeatures
+   */
+  void detectFeaturesMultiScale(
+      const mrpt::img::CImage& img,
+      CFeatureList& feats,
+      unsigned int init_ID = 0,
+      unsigned int nDesiredFeatures = 0);
+
  private:
   /** Compute the SIFT descriptor of the provided features into the input
   image
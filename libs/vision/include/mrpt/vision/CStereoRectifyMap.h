@@ -12,6 +12,12 @@
 #include <mrpt/img/TStereoCamera.h>
 #include <mrpt/obs/CObservationStereoImages.h>
 #include <mrpt/poses/CPose3DQuat.h>
+#include <mrpt/system/WorkerThreadsPool.h>
+
+namespace mrpt::serialization
+{
+class CArchive;
+}
 
 namespace mrpt::vision
 {
@@ -192,6 +198,53 @@ class CStereoRectifyMap
       std::vector<int16_t>& right_x,
       std::vector<uint16_t>& right_y);
 
+  /** Computes a hash of the given stereo camera parameters together with all
+   * the options that affect map generation (alpha, output resize, principal
+   * points coincidence). Cached rectification maps are only reused when this
+   * key matches, so there is no risk of applying maps built for a different
+   * calibration. \sa saveRectifyMaps(), loadRectifyMaps()
+   * \note [New in MRPT 2.14.5] */
+  uint64_t rectifyMapsCacheKey(const mrpt::img::TStereoCamera& params) const;
+
+  /** Saves the precomputed rectification maps, together with the camera
+   * parameters and options they were built from, so a future process can
+   * skip the expensive map computation in setFromCamParams().
+   * \exception std::exception If the maps have not been computed yet.
+   * \sa loadRectifyMaps(), setFromCamParamsCached()
+   * \note [New in MRPT 2.14.5] */
+  void saveRectifyMaps(mrpt::serialization::CArchive& out) const;
+
+  /** Loads rectification maps previously saved with saveRectifyMaps(),
+   * after verifying that they were built for exactly the given camera
+   * parameters and the current options (see rectifyMapsCacheKey()).
+   * \return false (leaving this object untouched) if the stored key does not
+   * match, true if the maps were loaded and the object is ready to rectify.
+   * \sa saveRectifyMaps(), setFromCamParamsCached()
+   * \note [New in MRPT 2.14.5] */
+  bool loadRectifyMaps(mrpt::serialization::CArchive& in, const mrpt::img::TStereoCamera& params);
+
+  /** Like setFromCamParams(), but first tries to load the maps from the
+   * given cache file (as written by saveRectifyMaps()). On a cache miss (no
+   * such file, corrupt contents, or parameters/options mismatch) the maps
+   * are computed as usual and the cache file is (re)written for the next
+   * run.
+   * \return true if the maps were loaded from the cache file, false if they
+   * had to be recomputed.
+   * \note [New in MRPT 2.14.5] */
+  bool setFromCamParamsCached(
+      const mrpt::img::TStereoCamera& params, const std::string& cache_file);
+
+  /** If enabled, rectify() splits the remapping work by image rows across an
+   * internal worker thread pool (default: disabled, fully sequential).
+   * \param num_threads Number of worker threads; `0` means half the
+   * hardware threads. Passing `enable=false` disables threading again (the
+   * pool threads, if already spawned, remain idle).
+   * \note [New in MRPT 2.14.5] */
+  void enableThreadedRectify(bool enable, unsigned int num_threads = 0);
+
+  /** \sa enableThreadedRectify */
+  bool isEnabledThreadedRectify() const { return m_rectify_threads != 0; }
+
   /** @} */
 
   /** @name Rectify methods
@@ -258,6 +311,14 @@ class CStereoRectifyMap
    * plane is the same after rectification. */
   mrpt::poses::CPose3DQuat m_rot_left, m_rot_right;
 
+  /** Number of row blocks each image is split into by rectify(); `0` means
+   * threading is disabled. \sa enableThreadedRectify */
+  unsigned int m_rectify_threads{0};
+  /** Lazily-spawned pool for the threaded rectify() path, and the number of
+   * threads already added to it (WorkerThreadsPool::resize() adds threads) */
+  mutable mrpt::system::WorkerThreadsPool m_rectify_pool;
+  mutable unsigned int m_rectify_pool_threads{0};
+
   void internal_invalidate();
 
 };  // end class
@@ -11,6 +11,8 @@
 #include <mrpt/img/CImage.h>
 #include <mrpt/img/TCamera.h>
 
+#include <optional>
+
 namespace mrpt::vision
 {
 /** Use this class to undistort monocular images if the same distortion map is
@@ -51,8 +53,15 @@ class CUndistortMap
 
   /** Prepares the mapping from the distortion parameters of a camera.
    * Must be called before invoking \a undistort().
+   *
+   * \param outputSize If provided, rescaling the image to this resolution is
+   * fused into the undistortion map, so undistort() and undistortFused()
+   * directly produce images of this size in a single remap pass.
+   * [New in MRPT 2.14.5]
    */
-  void setFromCamParams(const mrpt::img::TCamera& params);
+  void setFromCamParams(
+      const mrpt::img::TCamera& params,
+      const std::optional<mrpt::img::TImageSize>& outputSize = std::nullopt);
 
   /** Undistort the input image and saves the result in the output one - \a
    * setFromCamParams() must have been set prior to calling this.
@@ -64,6 +73,26 @@ class CUndistortMap
    */
   void undistort(mrpt::img::CImage& in_out_img) const;
 
+  /** Fused, thread-parallel version of undistort() for per-frame pipelines:
+   * in one pass over the image it undistorts, rescales (if an `outputSize`
+   * was given to setFromCamParams()), and optionally converts color to
+   * grayscale, splitting the image into independent row stripes processed by
+   * parallel worker threads.
+   *
+   * Output (and internal scratch) buffers are only reallocated when the
+   * geometry or channel count changes, so repeated calls with the same
+   * camera are allocation-free: reuse the same `out_img` across frames.
+   *
+   * \param numThreads Number of parallel stripes; `0` (default) uses all
+   * hardware threads.
+   * \note [New in MRPT 2.14.5]
+   */
+  void undistortFused(
+      const mrpt::img::CImage& in_img,
+      mrpt::img::CImage& out_img,
+      bool convertToGrayscale = false,
+      unsigned int numThreads = 0) const;
+
   /** Returns the camera parameters which were used to generate the distortion
    * map, as passed by the user to \a setFromCamParams */
   inline const mrpt::img::TCamera& getCameraParams() const { return m_camera_params; }
@@ -79,8 +108,15 @@ class CUndistortMap
   std::vector<int16_t> m_dat_mapx;
   std::vector<uint16_t> m_dat_mapy;
 
+  /** Size of the undistorted output images (may differ from the camera
+   * resolution if an `outputSize` was given to setFromCamParams()) */
+  mrpt::img::TImageSize m_map_size{0, 0};
+
   /** A copy of the data provided by the user */
   mrpt::img::TCamera m_camera_params;
 
+  /** Scratch color buffer reused across undistortFused() calls */
+  mutable mrpt::img::CImage m_fused_tmp_rgb;
+
 };  // end class
 }  // namespace mrpt::vision
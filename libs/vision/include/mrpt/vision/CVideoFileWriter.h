@@ -13,6 +13,13 @@
 #include <mrpt/img/CImage.h>
 #include <mrpt/vision/utils.h>
 
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 namespace mrpt::vision
 {
 /**  An output stream which takes a sequence of images and writes a video file
@@ -76,7 +83,9 @@ class CVideoFileWriter
       const std::string& fourcc = std::string(""),
       bool isColor = true);
 
-  /** Finish the file writing and close the file output
+  /** Finish the file writing and close the file output.
+   * If asynchronous encoding is enabled, blocks until all the queued frames
+   * have been encoded.
    */
   void close();
 
@@ -95,6 +104,75 @@ class CVideoFileWriter
    */
   bool writeImage(const mrpt::img::CImage& img);
 
+  /** Move-in version of writeImage(): with asynchronous encoding enabled,
+   * the frame buffer is handed over to the encode queue without any copy.
+   * \return false on any error
+   * \note [New in MRPT 2.14.5] \sa enableAsyncEncoding */
+  bool writeImageMove(mrpt::img::CImage&& img);
+
+  /** Enables asynchronous encoding: writeImage() then just enqueues the
+   * frame into a bounded queue and returns immediately, and a dedicated
+   * thread feeds the encoder, so slow codecs do not stall the grabbing
+   * loop. When the queue is full the *oldest* pending frame is dropped
+   * (see getAsyncStats()). Call it at any time; it applies to all frames
+   * written afterwards.
+   *
+   * Note that with async mode on, writeImage(const CImage&) enqueues a deep
+   * copy (the caller may reuse its buffer right away); use
+   * writeImageMove() to avoid also that copy.
+   * \note [New in MRPT 2.14.5] \sa writeImageMove, getAsyncStats */
+  void enableAsyncEncoding(size_t maxQueueLength = 8);
+
+  /** Statistics of the asynchronous encode queue.
+   * \sa getAsyncStats \note [New in MRPT 2.14.5] */
+  struct TAsyncStats
+  {
+    /** Frames handed to the encode queue */
+    uint64_t frames_enqueued = 0;
+    /** Frames actually encoded into the file */
+    uint64_t frames_encoded = 0;
+    /** Frames discarded by the drop-oldest policy */
+    uint64_t frames_dropped = 0;
+    /** Encoder time of the last encoded frame [s] */
+    double last_encode_latency_sec = 0;
+    /** Frames currently waiting in the queue */
+    size_t cur_queue_len = 0;
+  };
+
+  /** Returns a snapshot of the asynchronous encoding statistics.
+   * Thread-safe. \note [New in MRPT 2.14.5] */
+  TAsyncStats getAsyncStats() const;
+
+  /** If enabled *before* open(), requests a hardware-accelerated encoder
+   * (VAAPI, NVENC, etc.) from OpenCV, when built with support for them
+   * (cv::VIDEOWRITER_PROP_HW_ACCELERATION, OpenCV >=4.5.2); silently falls
+   * back to software encoding otherwise. \note [New in MRPT 2.14.5] */
+  void enableHardwareAcceleration(bool enable = true) { m_hwAccel = enable; }
+
+ private:
+  /** The actual (synchronous) encoder call behind writeImage() */
+  bool internal_writeImage(const mrpt::img::CImage& img);
+  /** Enqueues a frame for the encode thread, enforcing the drop-oldest
+   * bound */
+  bool internal_enqueueFrame(mrpt::img::CImage&& img);
+  void encodeThread();
+
+  bool m_hwAccel = false;
+
+  /** @name Asynchronous encoding queue (see enableAsyncEncoding())
+   * @{ */
+  mutable std::mutex m_queueMtx;
+  std::condition_variable m_queueCV;       //!< signals "new frame or stop"
+  std::condition_variable m_queueDoneCV;   //!< signals "frame encoded"
+  std::deque<mrpt::img::CImage> m_queue;
+  size_t m_queueMaxLen = 0;  //!< 0 = async encoding disabled
+  bool m_workerShouldEnd = false;
+  std::thread m_worker;
+
+  std::atomic<uint64_t> m_statEnqueued{0}, m_statEncoded{0}, m_statDropped{0};
+  std::atomic<double> m_statLastEncodeLatency{0};
+  /** @} */
+
 };  // end of class
 
 }  // namespace mrpt::vision
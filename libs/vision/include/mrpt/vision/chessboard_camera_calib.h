@@ -56,6 +56,24 @@ struct TImageCalibData
  */
 using TCalibrationImageList = std::map<std::string, TImageCalibData>;
 
+/** Optional input parameters for checkerBoardCameraCalibration()
+ * \note [New in MRPT 2.14.5] */
+struct TCameraCalibParams
+{
+  /** Number of worker threads used to detect the checkerboard corners of
+   * different images in parallel: `0` means half the hardware threads,
+   * `1` runs everything in the calling thread. */
+  unsigned int detect_threads{0};
+
+  /** If enabled, images whose `detected_corners` field already holds a full
+   * set of corners (e.g. from a former call) are not searched again, and the
+   * intrinsics found in `out_camera_params` (if valid, i.e. fx>0) are used
+   * as the initial guess of the optimizer. This allows cheaply refining a
+   * former calibration with a few new frames instead of re-running the whole
+   * process from scratch. */
+  bool use_incremental_calibration{false};
+};
+
 /** Performs a camera calibration (computation of projection and distortion
  * parameters) from a sequence of captured images of a checkerboard.
  * \param input_images [IN/OUT] At input, this list must have one entry for
@@ -95,6 +113,20 @@ bool checkerBoardCameraCalibration(
     double* out_MSE = nullptr,
     bool skipDrawDetectedImgs = false);
 
+/** \overload taking a TCameraCalibParams with extra options (parallel corner
+ * detection, incremental calibration). \note [New in MRPT 2.14.5] */
+bool checkerBoardCameraCalibration(
+    TCalibrationImageList& images,
+    unsigned int check_size_x,
+    unsigned int check_size_y,
+    double check_squares_length_X_meters,
+    double check_squares_length_Y_meters,
+    mrpt::img::TCamera& out_camera_params,
+    const TCameraCalibParams& params,
+    bool normalize_image = true,
+    double* out_MSE = nullptr,
+    bool skipDrawDetectedImgs = false);
+
 /** \overload with matrix of intrinsic params instead of mrpt::img::TCamera
  */
 bool checkerBoardCameraCalibration(
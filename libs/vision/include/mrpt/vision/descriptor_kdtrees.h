@@ -12,6 +12,10 @@
 #include <mrpt/vision/CFeature.h>
 #include <mrpt/vision/types.h>
 
+#include <algorithm>
+#include <thread>
+#include <vector>
+
 namespace mrpt
 {
 namespace vision
@@ -23,6 +27,8 @@ template <typename distance_t, typename element_t = uint8_t>
 struct TSIFTDesc2KDTree_Adaptor;
 template <typename distance_t, typename element_t = float>
 struct TSURFDesc2KDTree_Adaptor;
+template <typename distance_t, typename element_t>
+struct TPackedDescs2KDTree_Adaptor;
 }  // namespace detail
 
 /** \defgroup mrptvision_descr_kdtrees KD-Tree construction of visual
@@ -149,6 +155,219 @@ struct TSURFDescriptorsKDTreeIndex
   const CFeatureList& m_feats;
 };  // end of TSURFDescriptorsKDTreeIndex
 
+/** A dynamic kd-tree index over SIFT or SURF descriptors packed into one
+ * contiguous row-major buffer (one descriptor per row), instead of chasing
+ * per-feature heap allocations: much friendlier to the cache during tree
+ * construction and queries.
+ *
+ * Unlike TSIFTDescriptorsKDTreeIndex / TSURFDescriptorsKDTreeIndex, this
+ * index owns a *copy* of the descriptors, supports incremental append()s of
+ * new feature lists between frames without a full rebuild (via nanoflann's
+ * dynamic adaptor), and answers batched kNN queries with a pool of threads.
+ *
+ *   Example of usage:
+ *  \code
+ *    TPackedDescriptorsKDTreeIndex<uint8_t>  idx(keyframe0_feats, descSIFT);
+ *    idx.append(keyframe1_feats);  // incremental, no rebuild
+ *
+ *    std::vector<size_t> indices;
+ *    std::vector<float>  sqrDists;
+ *    idx.knnSearchBatch(query_feats, 2, indices, sqrDists);  // knn=2
+ *  \endcode
+ *
+ * \tparam element_t Descriptor element type: `uint8_t` for SIFT, `float`
+ * for SURF.
+ * \note [New in MRPT 2.14.5]
+ * \sa CFeatureList, TSIFTDescriptorsKDTreeIndex, TSURFDescriptorsKDTreeIndex
+ */
+template <
+    typename element_t,
+    typename distance_t = float,
+    class metric_t = nanoflann::L2_Simple_Adaptor<
+        element_t,
+        detail::TPackedDescs2KDTree_Adaptor<distance_t, element_t>,
+        distance_t>>
+struct TPackedDescriptorsKDTreeIndex
+{
+ public:
+  using adaptor_t = detail::TPackedDescs2KDTree_Adaptor<distance_t, element_t>;
+  using kdtree_t = typename nanoflann::KDTreeSingleIndexAdaptor<metric_t, adaptor_t>;
+  using dynamic_kdtree_t = typename nanoflann::KDTreeSingleIndexDynamicAdaptor<metric_t, adaptor_t>;
+
+  /** Constructor from an initial list of features; more may be added later
+   * on with append(). The list must NOT be empty or an exception will be
+   * raised. */
+  TPackedDescriptorsKDTreeIndex(const CFeatureList& feats, const TDescriptorType descriptor) :
+      m_desc_type(descriptor), m_adaptor(m_data, m_dim)
+  {
+    ASSERT_(!feats.empty());
+    internal_pack(feats);
+    nanoflann::KDTreeSingleIndexAdaptorParams params;
+    m_kdtree = new dynamic_kdtree_t(m_dim, m_adaptor, params);
+    m_kdtree->addPoints(0, this->size() - 1);
+  }
+
+  ~TPackedDescriptorsKDTreeIndex()
+  {
+    delete m_kdtree;
+    m_kdtree = nullptr;
+  }
+
+  TPackedDescriptorsKDTreeIndex(const TPackedDescriptorsKDTreeIndex&) = delete;
+  TPackedDescriptorsKDTreeIndex& operator=(const TPackedDescriptorsKDTreeIndex&) = delete;
+
+  /** Appends the descriptors of a new batch of features (e.g. the next
+   * keyframe) to the index, without rebuilding the trees for the points
+   * already inserted. */
+  void append(const CFeatureList& feats)
+  {
+    if (feats.empty()) return;
+    const size_t first = this->size();
+    internal_pack(feats);
+    m_kdtree->addPoints(first, this->size() - 1);
+  }
+
+  /** Number of descriptors currently stored in the index */
+  size_t size() const { return m_dim ? m_data.size() / m_dim : 0; }
+  /** Dimensionality (length) of the indexed descriptors */
+  size_t dim() const { return m_dim; }
+  /** Direct read access to the idx-th packed descriptor row */
+  const element_t* descriptor(size_t idx) const { return &m_data[idx * m_dim]; }
+
+  /** kNN search for one query descriptor of dim() elements.
+   * Output vectors are resized to `knn` entries: global indices (in
+   * insertion order across all append()ed batches) and squared L2
+   * distances, sorted by increasing distance. */
+  void knnSearch(
+      const element_t* query,
+      const size_t knn,
+      std::vector<size_t>& out_indices,
+      std::vector<distance_t>& out_sqr_distances) const
+  {
+    out_indices.resize(knn);
+    out_sqr_distances.resize(knn);
+    nanoflann::KNNResultSet<distance_t> results(knn);
+    results.init(&out_indices[0], &out_sqr_distances[0]);
+    m_kdtree->findNeighbors(results, query, nanoflann::SearchParameters());
+  }
+
+  /** Batched kNN search: answers `num_queries` queries (packed row-major,
+   * dim() elements each) splitting the work among `num_threads` threads
+   * (default: all hardware threads). Results for the i-th query are stored
+   * at entries [i*knn, (i+1)*knn) of the output vectors. */
+  void knnSearchBatch(
+      const element_t* queries,
+      const size_t num_queries,
+      const size_t knn,
+      std::vector<size_t>& out_indices,
+      std::vector<distance_t>& out_sqr_distances,
+      size_t num_threads = 0) const
+  {
+    ASSERT_GE_(knn, 1);
+    out_indices.assign(num_queries * knn, 0);
+    out_sqr_distances.assign(num_queries * knn, distance_t(0));
+    if (!num_queries) return;
+
+    const auto run_range = [&](size_t i_first, size_t i_end)
+    {
+      for (size_t i = i_first; i < i_end; i++)
+      {
+        nanoflann::KNNResultSet<distance_t> results(knn);
+        results.init(&out_indices[i * knn], &out_sqr_distances[i * knn]);
+        m_kdtree->findNeighbors(results, queries + i * m_dim, nanoflann::SearchParameters());
+      }
+    };
+
+    if (!num_threads) num_threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+    num_threads = std::min(num_threads, num_queries);
+    if (num_threads == 1)
+    {
+      run_range(0, num_queries);
+      return;
+    }
+    const size_t chunk = (num_queries + num_threads - 1) / num_threads;
+    std::vector<std::thread> workers;
+    workers.reserve(num_threads);
+    for (size_t t = 0; t < num_threads; t++)
+      workers.emplace_back(
+          run_range, t * chunk, std::min(num_queries, (t + 1) * chunk));
+    for (auto& w : workers) w.join();
+  }
+
+  /** Batched kNN search taking the queries from the descriptors of a
+   * feature list (of the same descriptor type given at construction).
+   * \sa knnSearchBatch */
+  void knnSearchBatch(
+      const CFeatureList& queries,
+      const size_t knn,
+      std::vector<size_t>& out_indices,
+      std::vector<distance_t>& out_sqr_distances,
+      size_t num_threads = 0) const
+  {
+    // Pack the queries too: sequential accesses during the search.
+    std::vector<element_t> packed;
+    packed.reserve(queries.size() * m_dim);
+    for (size_t i = 0; i < queries.size(); i++)
+      internal_pack_one(queries[i], m_dim, packed);
+    knnSearchBatch(
+        packed.data(), queries.size(), knn, out_indices, out_sqr_distances, num_threads);
+  }
+
+  /** Access to the underlying (dynamic) kd-tree object */
+  dynamic_kdtree_t& get_kdtree() { return *m_kdtree; }
+  const dynamic_kdtree_t& get_kdtree() const { return *m_kdtree; }
+
+ private:
+  /** Appends the descriptors of `feats` to the packed buffer, learning the
+   * dimensionality from the first descriptor seen. */
+  void internal_pack(const CFeatureList& feats)
+  {
+    if (!m_dim)
+    {
+      const auto& d0 = feats[0].descriptors;
+      if (m_desc_type == descSIFT)
+      {
+        ASSERTMSG_(d0.hasDescriptorSIFT(), "Features have no SIFT descriptors!");
+        m_dim = d0.SIFT->size();
+      }
+      else if (m_desc_type == descSURF)
+      {
+        ASSERTMSG_(d0.hasDescriptorSURF(), "Features have no SURF descriptors!");
+        m_dim = d0.SURF->size();
+      }
+      else
+      {
+        THROW_EXCEPTION("This index only supports SIFT or SURF descriptors");
+      }
+    }
+    m_data.reserve(m_data.size() + feats.size() * m_dim);
+    for (size_t i = 0; i < feats.size(); i++) internal_pack_one(feats[i], m_dim, m_data);
+  }
+
+  void internal_pack_one(const CFeature& f, const size_t dim, std::vector<element_t>& out) const
+  {
+    if (m_desc_type == descSIFT)
+    {
+      const auto& d = *f.descriptors.SIFT;
+      ASSERT_EQUAL_(d.size(), dim);
+      out.insert(out.end(), d.begin(), d.end());
+    }
+    else
+    {
+      const auto& d = *f.descriptors.SURF;
+      ASSERT_EQUAL_(d.size(), dim);
+      out.insert(out.end(), d.begin(), d.end());
+    }
+  }
+
+  const TDescriptorType m_desc_type;
+  /** All descriptors, packed row-major (one per row of m_dim elements) */
+  std::vector<element_t> m_data;
+  size_t m_dim{0};
+  adaptor_t m_adaptor;
+  dynamic_kdtree_t* m_kdtree{nullptr};
+};  // end of TPackedDescriptorsKDTreeIndex
+
 /** @} */
 
 namespace detail
@@ -220,6 +439,39 @@ struct TSURFDesc2KDTree_Adaptor
     return false;
   }
 };
+
+template <typename distance_t, typename element_t>
+struct TPackedDescs2KDTree_Adaptor
+{
+  const std::vector<element_t>& m_data;
+  const size_t& m_dim;
+  TPackedDescs2KDTree_Adaptor(const std::vector<element_t>& data, const size_t& dim) :
+      m_data(data), m_dim(dim)
+  {
+  }
+  // Must return the number of data points
+  inline size_t kdtree_get_point_count() const { return m_dim ? m_data.size() / m_dim : 0; }
+  // Must return the Euclidean (L2) distance between the vector "p1[0:size-1]"
+  // and the data point with index "idx_p2" stored in the class:
+  inline distance_t kdtree_distance(const element_t* p1, size_t idx_p2, size_t size) const
+  {
+    const element_t* p2 = &m_data[idx_p2 * m_dim];
+    distance_t d = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+      const distance_t df = distance_t(p1[i]) - distance_t(p2[i]);
+      d += df * df;
+    }
+    return d;
+  }
+  // Must return the dim'th component of the idx'th point in the class:
+  inline element_t kdtree_get_pt(size_t idx, int dim) const { return m_data[idx * m_dim + dim]; }
+  template <class BBOX>
+  bool kdtree_get_bbox(BBOX& bb) const
+  {
+    return false;
+  }
+};
 }  // namespace detail
 }  // namespace vision
 }  // namespace mrpt
@@ -13,6 +13,7 @@
 
 #include <Eigen/Core>
 #include <Eigen/Dense>
+#include <vector>
 
 namespace mrpt
 {
@@ -217,6 +218,63 @@ class CPnP
       int n,
       const Eigen::Ref<Eigen::MatrixXd> cam_intrinsic,
       Eigen::Ref<Eigen::MatrixXd> pose_mat);
+
+  /** Algorithm selector for solveBatch() \note [New in MRPT 2.14.5] */
+  enum TPnPAlgo
+  {
+    ALGO_P3P = 0,
+    ALGO_RPNP,
+    ALGO_PPNP,
+    ALGO_POSIT,
+    ALGO_LHM,
+    ALGO_DLS,
+    ALGO_EPNP,
+    ALGO_UPNP
+  };
+
+  /** One 2D-3D correspondence set for solveBatch(). Same conventions as the
+   * single-problem methods: either nX3 or 3Xn layouts are accepted.
+   * \note [New in MRPT 2.14.5] */
+  struct TBatchProblem
+  {
+    /** Object points [p_x, p_y, p_z] */
+    Eigen::MatrixXd obj_pts;
+    /** Image points [u, v, 1] */
+    Eigen::MatrixXd img_pts;
+  };
+
+  /** Output of solveBatch() for one problem \note [New in MRPT 2.14.5] */
+  struct TBatchResult
+  {
+    /** false if the solver failed on this problem */
+    bool valid{false};
+    /** pose_mat[0:2]-> Translation, pose_mat[3:5] -> Quaternion vector
+     * component */
+    Eigen::Matrix<double, 6, 1> pose_mat = Eigen::Matrix<double, 6, 1>::Zero();
+  };
+
+  /** Solves many independent PnP problems sharing one camera intrinsic
+   * matrix, e.g. the per-tag poses of a multi-marker tracker.
+   * Compared to looping over the single-problem methods, this entry point
+   * reuses the per-thread Eigen workspace buffers across problems, uses a
+   * heap-allocation-free fixed-size path for the minimal 4-point P3P case,
+   * and distributes the problems over a worker thread pool.
+   *
+   * \param[in] algo The PnP algorithm to run on every problem.
+   * \param[in] problems The input 2D-3D correspondence sets.
+   * \param[in] cam_intrinsic Camera intrinsic matrix, common to all problems.
+   * \param[out] results One entry per problem, in the same order.
+   * \param[in] num_threads Worker threads; `0` means half the hardware
+   * threads, `1` solves everything in the calling thread.
+   * \return The number of successfully solved problems.
+   * \note [New in MRPT 2.14.5]
+   */
+  size_t solveBatch(
+      TPnPAlgo algo,
+      const std::vector<TBatchProblem>& problems,
+      const Eigen::Matrix3d& cam_intrinsic,
+      std::vector<TBatchResult>& results,
+      unsigned int num_threads = 0);
 };
 
 /** @}  */  // end of grouping
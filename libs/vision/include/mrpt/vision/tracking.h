@@ -299,6 +299,18 @@ struct CFeatureTracker_KL : public CGenericFeatureTracker
       const mrpt::img::CImage& old_img,
       const mrpt::img::CImage& new_img,
       FEATLIST& inout_featureList);
+
+  /** Cached LK pyramid (a std::vector<cv::Mat>, held as an opaque pointer
+   * to keep OpenCV out of this header) built from the latest `new_img`.
+   * When the next call's `old_img` is the previous `new_img` (the usual
+   * frame-to-frame chaining), it is reused as the "previous" pyramid, so
+   * only one pyramid is built per frame instead of two.
+   * [New in MRPT 2.14.5] */
+  std::shared_ptr<void> m_cachedPyramid;
+  /** Key identifying the image & parameters m_cachedPyramid was built from */
+  const void* m_cachedPyramidImgData{nullptr};
+  int m_cachedPyramidW{0}, m_cachedPyramidH{0};
+  int m_cachedPyramidLevels{0}, m_cachedPyramidWinW{0}, m_cachedPyramidWinH{0};
 };
 
 /**  @}  */  // end of grouping
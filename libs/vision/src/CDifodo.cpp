@@ -285,17 +285,46 @@ void CDifodo::buildCoordinatesPyramidFast()
     //-----------------------------------------------------------------------------
     else
     {
-      for (unsigned int u = 0; u < cols_i; u++)
-        for (unsigned int v = 0; v < rows_i; v++)
+      // The matrices are row-major: traverse rows in the outer loop and
+      // work through raw row pointers, so the 4x4 neighborhood is read as
+      // four contiguous spans instead of a strided Eigen block copy.
+      const auto& prev = depth[i_1];
+      auto& cur = depth[i];
+
+      // Gaussian mask as a flat row-major array (it is symmetric, so the
+      // pairing with the row-wise gathered block below is the same as with
+      // the previous column-wise indexing):
+      float mask[16];
+      for (unsigned int r = 0; r < 4; r++)
+        for (unsigned int c = 0; c < 4; c++) mask[4 * r + c] = f_mask(r, c);
+
+      for (unsigned int v = 0; v < rows_i; v++)
+      {
+        const int v2 = 2 * v;
+        const bool v_inner = (v > 0) && (v < rows_i - 1);
+        float* cur_row = &cur(v, 0);
+
+        const float* r1 = &prev(v2, 0);
+        const float* r2 = &prev(v2 + 1, 0);
+        const float* r0 = v_inner ? &prev(v2 - 1, 0) : nullptr;
+        const float* r3 = v_inner ? &prev(v2 + 2, 0) : nullptr;
+
+        for (unsigned int u = 0; u < cols_i; u++)
         {
           const int u2 = 2 * u;
-          const int v2 = 2 * v;
 
           // Inner pixels
-          if ((v > 0) && (v < rows_i - 1) && (u > 0) && (u < cols_i - 1))
+          if (v_inner && (u > 0) && (u < cols_i - 1))
           {
-            const Matrix4f d_block = depth[i_1].block<4, 4>(v2 - 1, u2 - 1);
-            float depths[4] = {d_block(5), d_block(6), d_block(9), d_block(10)};
+            // 4x4 block around the source 2x2 cell:
+            const float b[16] = {r0[u2 - 1], r0[u2], r0[u2 + 1], r0[u2 + 2],  //
+                                 r1[u2 - 1], r1[u2], r1[u2 + 1], r1[u2 + 2],  //
+                                 r2[u2 - 1], r2[u2], r2[u2 + 1], r2[u2 + 2],  //
+                                 r3[u2 - 1], r3[u2], r3[u2 + 1], r3[u2 + 2]};
+
+            // Center 2x2, in the same order as the former column-major
+            // indexing so the partial sort picks the same representative:
+            float depths[4] = {b[5], b[9], b[6], b[10]};
             float dcenter;
 
             // Sort the array (try to find a good/representative
@@ -316,31 +345,31 @@ void CDifodo::buildCoordinatesPyramidFast()
 
               for (unsigned char k = 0; k < 16; k++)
               {
-                const float abs_dif = std::abs(d_block(k) - dcenter);
+                const float abs_dif = std::abs(b[k] - dcenter);
                 if (abs_dif < max_depth_dif)
                 {
-                  const float aux_w = f_mask[k] * (max_depth_dif - abs_dif);
+                  const float aux_w = mask[k] * (max_depth_dif - abs_dif);
                   weight += aux_w;
-                  sum += aux_w * d_block(k);
+                  sum += aux_w * b[k];
                 }
               }
-              if (weight > 0) depth[i](v, u) = sum / weight;
+              if (weight > 0) cur_row[u] = sum / weight;
             }
             else
-              depth[i](v, u) = 0.f;
+              cur_row[u] = 0.f;
           }
 
           // Boundary
           else
           {
-            const Matrix2f d_block = depth[i_1].block<2, 2>(v2, u2);
-            const float new_d = 0.25f * d_block.array().sum();
+            const float new_d = 0.25f * (r1[u2] + r1[u2 + 1] + r2[u2] + r2[u2 + 1]);
             if (new_d < 0.4f)
-              depth[i](v, u) = 0.f;
+              cur_row[u] = 0.f;
             else
-              depth[i](v, u) = new_d;
+              cur_row[u] = new_d;
           }
         }
+      }
     }
 
     // Calculate coordinates "xy" of the points
@@ -348,18 +377,21 @@ void CDifodo::buildCoordinatesPyramidFast()
     const float disp_u_i = 0.5f * (cols_i - 1);
     const float disp_v_i = 0.5f * (rows_i - 1);
 
-    for (unsigned int u = 0; u < cols_i; u++)
-      for (unsigned int v = 0; v < rows_i; v++)
-        if (depth[i](v, u) > 0.f)
-        {
-          xx[i](v, u) = (u - disp_u_i) * depth[i](v, u) * inv_f_i;
-          yy[i](v, u) = (v - disp_v_i) * depth[i](v, u) * inv_f_i;
-        }
-        else
-        {
-          xx[i](v, u) = 0.f;
-          yy[i](v, u) = 0.f;
-        }
+    // Branchless row-wise sweep, so the compiler can vectorize it:
+    for (unsigned int v = 0; v < rows_i; v++)
+    {
+      const float* d_row = &depth[i](v, 0);
+      float* xx_row = &xx[i](v, 0);
+      float* yy_row = &yy[i](v, 0);
+      const float vf = (v - disp_v_i) * inv_f_i;
+
+      for (unsigned int u = 0; u < cols_i; u++)
+      {
+        const float d = d_row[u];
+        xx_row[u] = (d > 0.f) ? (u - disp_u_i) * d * inv_f_i : 0.f;
+        yy_row[u] = (d > 0.f) ? vf * d : 0.f;
+      }
+    }
   }
 }
 
@@ -471,8 +503,9 @@ void CDifodo::calculateCoord()
   null.fill(false);
   num_valid_points = 0;
 
-  for (unsigned int u = 0; u < cols_i; u++)
-    for (unsigned int v = 0; v < rows_i; v++)
+  // Row-wise sweep (the matrices are row-major):
+  for (unsigned int v = 0; v < rows_i; v++)
+    for (unsigned int u = 0; u < cols_i; u++)
     {
       if ((depth_old[image_level](v, u)) == 0.f || (depth_warped[image_level](v, u) == 0.f))
       {
@@ -558,8 +591,8 @@ void CDifodo::calculateDepthDerivatives()
   }
 
   // Temporal derivative
-  for (unsigned int u = 0; u < cols_i; u++)
-    for (unsigned int v = 0; v < rows_i; v++)
+  for (unsigned int v = 0; v < rows_i; v++)
+    for (unsigned int u = 0; u < cols_i; u++)
       if (null(v, u) == false)
         dt(v, u) = d2f(fps) * (depth_warped[image_level](v, u) - depth_old[image_level](v, u));
 }
@@ -597,8 +630,8 @@ void CDifodo::computeWeights()
   const float k2dt = 5e-6f;
   const float k2duv = 5e-6f;
 
-  for (unsigned int u = 1; u < cols_i - 1; u++)
-    for (unsigned int v = 1; v < rows_i - 1; v++)
+  for (unsigned int v = 1; v < rows_i - 1; v++)
+    for (unsigned int u = 1; u < cols_i - 1; u++)
       if (null(v, u) == false)
       {
         //					Compute measurment error (simplified)
@@ -696,19 +729,23 @@ void CDifodo::computeWeights()
 
 void CDifodo::solveOneLevel()
 {
-  MatrixXf A(num_valid_points, 6);
-  MatrixXf B(num_valid_points, 1);
-  unsigned int cont = 0;
-
-  // Fill the matrix A and the vector B
-  // The order of the unknowns is (vz, vx, vy, wz, wx, wy)
-  // The points order will be (1,1), (1,2)...(1,cols-1), (2,1),
-  // (2,2)...(row-1,cols-1).
+  // Build the fixed-size 6x6 normal equations (A^t*A, A^t*B) directly while
+  // sweeping the image, instead of materializing the (num_valid_points x 6)
+  // Jacobian and running two dynamic-size products afterwards: no per-level
+  // heap allocation, and the per-point rank-1 updates map onto fused
+  // multiply-adds.
+  // The order of the unknowns is (vz, vx, vy, wz, wx, wy).
 
   const float f_inv = float(cols_i) / (2.f * tan(0.5f * fovh));
 
-  for (unsigned int u = 1; u < cols_i - 1; u++)
-    for (unsigned int v = 1; v < rows_i - 1; v++)
+  Matrix<float, 6, 6> AtA;
+  Matrix<float, 6, 1> AtB;
+  AtA.setZero();
+  AtB.setZero();
+  float BtB = 0.f;
+
+  for (unsigned int v = 1; v < rows_i - 1; v++)
+    for (unsigned int u = 1; u < cols_i - 1; u++)
       if (null(v, u) == false)
       {
         // Precomputed expressions
@@ -720,28 +757,38 @@ void CDifodo::solveOneLevel()
         const float dzcomp = dv(v, u) * f_inv * inv_d;
         const float tw = weights(v, u);
 
-        // Fill the matrix A
-        A(cont, 0) = tw * (1.f + dycomp * x * inv_d + dzcomp * y * inv_d);
-        A(cont, 1) = tw * (-dycomp);
-        A(cont, 2) = tw * (-dzcomp);
-        A(cont, 3) = tw * (dycomp * y - dzcomp * x);
-        A(cont, 4) = tw * (y + dycomp * inv_d * y * x + dzcomp * (y * y * inv_d + d));
-        A(cont, 5) = tw * (-x - dycomp * (x * x * inv_d + d) - dzcomp * inv_d * y * x);
-        B(cont, 0) = tw * (-dt(v, u));
-
-        cont++;
+        // The weighted Jacobian row of this point:
+        const float a[6] = {
+            tw * (1.f + dycomp * x * inv_d + dzcomp * y * inv_d),
+            tw * (-dycomp),
+            tw * (-dzcomp),
+            tw * (dycomp * y - dzcomp * x),
+            tw * (y + dycomp * inv_d * y * x + dzcomp * (y * y * inv_d + d)),
+            tw * (-x - dycomp * (x * x * inv_d + d) - dzcomp * inv_d * y * x)};
+        const float b = tw * (-dt(v, u));
+
+        // Accumulate the (symmetric) normal equations:
+        for (unsigned int r = 0; r < 6; r++)
+        {
+          AtB(r) += a[r] * b;
+          for (unsigned int c = r; c < 6; c++) AtA(r, c) += a[r] * a[c];
+        }
+        BtB += b * b;
       }
 
+  // Mirror the upper triangle:
+  for (unsigned int r = 1; r < 6; r++)
+    for (unsigned int c = 0; c < r; c++) AtA(r, c) = AtA(c, r);
+
   // Solve the linear system of equations using weighted least squares
-  const MatrixXf AtA = A.transpose() * A;
-  const MatrixXf AtB = A.transpose() * B;
-  VectorXf Var = AtA.ldlt().solve(AtB);
+  const Matrix<float, 6, 1> Var = AtA.ldlt().solve(AtB);
 
-  // Covariance matrix calculation
-  MatrixXf res = -B;
-  for (unsigned int k = 0; k < 6; k++) res += Var(k) * A.col(k);
+  // Covariance matrix calculation: the squared norm of the residual
+  // (A*Var - B) expands to Var'*AtA*Var - 2*Var'*AtB + B'*B, so no pass
+  // over the stored Jacobian is needed:
+  const float res_norm2 = std::max(0.f, Var.dot(AtA * Var) - 2.f * Var.dot(AtB) + BtB);
 
-  est_cov = (1.f / float(num_valid_points - 6)) * AtA.inverse() * res.squaredNorm();
+  est_cov = (1.f / float(num_valid_points - 6)) * AtA.inverse() * res_norm2;
 
   // Update last velocity in local coordinates
   // (vx, vy, vz, wx, wy, wz)
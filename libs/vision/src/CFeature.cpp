@@ -21,6 +21,7 @@
 #include <mrpt/vision/types.h>
 #include <mrpt/vision/utils.h>
 
+#include <cstring>  // memcpy
 #include <iostream>
 
 using namespace mrpt;
@@ -33,6 +34,51 @@ using namespace std;
 
 IMPLEMENTS_SERIALIZABLE(CFeature, CSerializable, mrpt::vision)
 
+namespace
+{
+/** Squared L2 distance between two equal-length descriptor vectors.
+ * Plain indexed loop over contiguous storage: compilers auto-vectorize it
+ * (SSE/AVX/NEON depending on build flags), unlike the former iterator-based
+ * element-wise loops. */
+template <typename T>
+float descriptor_L2_sqr(const std::vector<T>& d1, const std::vector<T>& d2)
+{
+  const size_t n = d1.size();
+  const T* p1 = d1.data();
+  const T* p2 = d2.data();
+  float dist = 0.0f;
+  for (size_t i = 0; i < n; i++) dist += mrpt::square(float(p1[i]) - float(p2[i]));
+  return dist;
+}
+
+/** Hamming distance between two equal-length binary descriptors,
+ * XOR + popcount over 64-bit words instead of per-byte bit twiddling. */
+uint32_t descriptor_hamming(const std::vector<uint8_t>& d1, const std::vector<uint8_t>& d2)
+{
+  const size_t n = d1.size();
+  const uint8_t* p1 = d1.data();
+  const uint8_t* p2 = d2.data();
+  uint32_t dist = 0;
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= n; i += sizeof(uint64_t))
+  {
+    uint64_t w1, w2;
+    std::memcpy(&w1, p1 + i, sizeof(uint64_t));
+    std::memcpy(&w2, p2 + i, sizeof(uint64_t));
+    const uint64_t x = w1 ^ w2;
+#if defined(__GNUC__) || defined(__clang__)
+    dist += static_cast<uint32_t>(__builtin_popcountll(x));
+#else
+    // Kernighan's method, for compilers without a popcount builtin:
+    for (uint64_t v = x; v; dist++) v &= v - 1;
+#endif
+  }
+  for (; i < n; i++)  // Tail bytes (descriptor size not a multiple of 8)
+    for (uint8_t v = p1[i] ^ p2[i]; v; dist++) v &= v - 1;
+  return dist;
+}
+}  // namespace
+
 // --------------------------------------------------
 //			loadFromConfigFile
 // --------------------------------------------------
@@ -434,13 +480,7 @@ float CFeature::descriptorSIFTDistanceTo(const CFeature& oFeature, bool normaliz
   ASSERT_(descriptors.SIFT->size() == oFeature.descriptors.SIFT->size());
   ASSERT_(descriptors.hasDescriptorSIFT() && oFeature.descriptors.hasDescriptorSIFT());
 
-  float dist = 0.0f;
-  std::vector<unsigned char>::const_iterator itDesc1, itDesc2;
-  for (itDesc1 = descriptors.SIFT->begin(), itDesc2 = oFeature.descriptors.SIFT->begin();
-       itDesc1 != descriptors.SIFT->end(); itDesc1++, itDesc2++)
-  {
-    dist += square(*itDesc1 - *itDesc2);
-  }
+  float dist = descriptor_L2_sqr(*descriptors.SIFT, *oFeature.descriptors.SIFT);
   if (normalize_distances) dist /= descriptors.SIFT->size();
   dist = sqrt(dist);
   if (normalize_distances) dist /= 64.0f;
@@ -456,13 +496,7 @@ float CFeature::descriptorSURFDistanceTo(const CFeature& oFeature, bool normaliz
   ASSERT_(descriptors.SURF->size() == oFeature.descriptors.SURF->size());
   ASSERT_(descriptors.hasDescriptorSURF() && oFeature.descriptors.hasDescriptorSURF());
 
-  float dist = 0.0f;
-  std::vector<float>::const_iterator itDesc1, itDesc2;
-  for (itDesc1 = descriptors.SURF->begin(), itDesc2 = oFeature.descriptors.SURF->begin();
-       itDesc1 != descriptors.SURF->end(); itDesc1++, itDesc2++)
-  {
-    dist += square(*itDesc1 - *itDesc2);
-  }
+  float dist = descriptor_L2_sqr(*descriptors.SURF, *oFeature.descriptors.SURF);
   if (normalize_distances) dist /= descriptors.SURF->size();
   dist = sqrt(dist);
   if (normalize_distances) dist /= 0.20f;  // JL: Ad-hoc value! Investigate where does this come
@@ -481,13 +515,7 @@ float CFeature::descriptorSpinImgDistanceTo(
   ASSERT_(descriptors.SpinImg->size() == oFeature.descriptors.SpinImg->size());
   ASSERT_(descriptors.hasDescriptorSpinImg() && oFeature.descriptors.hasDescriptorSpinImg());
   ASSERT_(!descriptors.SpinImg->empty());
-  float dist = 0.0f;
-  std::vector<float>::const_iterator itDesc1, itDesc2;
-  for (itDesc1 = descriptors.SpinImg->begin(), itDesc2 = oFeature.descriptors.SpinImg->begin();
-       itDesc1 != descriptors.SpinImg->end(); itDesc1++, itDesc2++)
-  {
-    dist += square(*itDesc1 - *itDesc2);
-  }
+  float dist = descriptor_L2_sqr(*descriptors.SpinImg, *oFeature.descriptors.SpinImg);
 
   if (normalize_by_vector_length) dist /= 0.25f * descriptors.SpinImg->size();
 
@@ -663,24 +691,9 @@ uint8_t CFeature::descriptorORBDistanceTo(const CFeature& oFeature) const
 {
   ASSERT_(descriptors.hasDescriptorORB() && oFeature.descriptors.hasDescriptorORB());
   ASSERT_(descriptors.ORB->size() == oFeature.descriptors.ORB->size());
-  const std::vector<uint8_t>& t_desc = *descriptors.ORB;
-  const std::vector<uint8_t>& o_desc = *oFeature.descriptors.ORB;
-
-  // Descriptors XOR + Hamming weight
-  uint8_t distance = 0;
-  for (uint8_t k = 0; k < t_desc.size(); ++k)
-  {
-    // from : Wegner, Peter (1960), "A technique for counting ones in a
-    // binary computer", Communications of the ACM 3 (5): 322,
-    // doi:10.1145/367236.367286
-    uint8_t x_or = t_desc[k] ^ o_desc[k];
-    uint8_t count;
-    for (count = 0; x_or; count++)  // ...
-      x_or &= x_or - 1;             // ...
-    distance += count;
-  }
-
-  return distance;
+  // Descriptors XOR + Hamming weight, word-wise (the return type keeps the
+  // historical uint8_t, i.e. modulo-256, for API compatibility):
+  return static_cast<uint8_t>(descriptor_hamming(*descriptors.ORB, *oFeature.descriptors.ORB));
 }
 
 // # added by Raghavender Sahdev
@@ -692,13 +705,7 @@ float CFeature::descriptorBLDDistanceTo(const CFeature& oFeature, bool normalize
   ASSERT_(descriptors.BLD->size() == oFeature.descriptors.BLD->size());
   ASSERT_(descriptors.hasDescriptorBLD() && oFeature.descriptors.hasDescriptorBLD());
 
-  float dist = 0.0f;
-  std::vector<unsigned char>::const_iterator itDesc1, itDesc2;
-  for (itDesc1 = descriptors.BLD->begin(), itDesc2 = oFeature.descriptors.BLD->begin();
-       itDesc1 != descriptors.BLD->end(); itDesc1++, itDesc2++)
-  {
-    dist += square(*itDesc1 - *itDesc2);
-  }
+  float dist = descriptor_L2_sqr(*descriptors.BLD, *oFeature.descriptors.BLD);
   if (normalize_distances) dist /= descriptors.BLD->size();
   dist = sqrt(dist);
   if (normalize_distances) dist /= 64.0f;
@@ -713,13 +720,7 @@ float CFeature::descriptorLATCHDistanceTo(const CFeature& oFeature, bool normali
   ASSERT_(descriptors.LATCH->size() == oFeature.descriptors.LATCH->size());
   ASSERT_(descriptors.hasDescriptorLATCH() && oFeature.descriptors.hasDescriptorLATCH());
 
-  float dist = 0.0f;
-  std::vector<unsigned char>::const_iterator itDesc1, itDesc2;
-  for (itDesc1 = descriptors.LATCH->begin(), itDesc2 = oFeature.descriptors.LATCH->begin();
-       itDesc1 != descriptors.LATCH->end(); itDesc1++, itDesc2++)
-  {
-    dist += square(*itDesc1 - *itDesc2);
-  }
+  float dist = descriptor_L2_sqr(*descriptors.LATCH, *oFeature.descriptors.LATCH);
   if (normalize_distances) dist /= descriptors.LATCH->size();
   dist = sqrt(dist);
   if (normalize_distances) dist /= 64.0f;
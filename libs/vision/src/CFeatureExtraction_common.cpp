@@ -177,6 +177,12 @@ void CFeatureExtraction::TOptions::dumpToTextStream(std::ostream& out) const
   LOADABLEOPTS_DUMP_VAR(ORBOptions.n_levels, int)
   LOADABLEOPTS_DUMP_VAR(ORBOptions.extract_patch, bool)
 
+  LOADABLEOPTS_DUMP_VAR(multiScaleOptions.n_octaves, int)
+  LOADABLEOPTS_DUMP_VAR(multiScaleOptions.smooth_halves, bool)
+  LOADABLEOPTS_DUMP_VAR(multiScaleOptions.grid_cells_x, int)
+  LOADABLEOPTS_DUMP_VAR(multiScaleOptions.grid_cells_y, int)
+  LOADABLEOPTS_DUMP_VAR(multiScaleOptions.threads, int)
+
   LOADABLEOPTS_DUMP_VAR(SpinImagesOptions.hist_size_distance, int)
   LOADABLEOPTS_DUMP_VAR(SpinImagesOptions.hist_size_intensity, int)
   LOADABLEOPTS_DUMP_VAR(SpinImagesOptions.radius, int)
@@ -257,6 +263,12 @@ void CFeatureExtraction::TOptions::loadFromConfigFile(
   MRPT_LOAD_CONFIG_VAR(ORBOptions.n_levels, int, iniFile, section)
   MRPT_LOAD_CONFIG_VAR(ORBOptions.scale_factor, float, iniFile, section)
 
+  MRPT_LOAD_CONFIG_VAR(multiScaleOptions.n_octaves, int, iniFile, section)
+  MRPT_LOAD_CONFIG_VAR(multiScaleOptions.smooth_halves, bool, iniFile, section)
+  MRPT_LOAD_CONFIG_VAR(multiScaleOptions.grid_cells_x, int, iniFile, section)
+  MRPT_LOAD_CONFIG_VAR(multiScaleOptions.grid_cells_y, int, iniFile, section)
+  MRPT_LOAD_CONFIG_VAR(multiScaleOptions.threads, int, iniFile, section)
+
   MRPT_LOAD_CONFIG_VAR(SpinImagesOptions.hist_size_distance, int, iniFile, section)
   MRPT_LOAD_CONFIG_VAR(SpinImagesOptions.hist_size_intensity, int, iniFile, section)
   MRPT_LOAD_CONFIG_VAR(SpinImagesOptions.radius, int, iniFile, section)
@@ -0,0 +1,236 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include "vision-precomp.h"  // Precompiled headers
+//
+#include <mrpt/core/WorkerThreadsPool.h>
+#include <mrpt/core/round.h>
+#include <mrpt/vision/CFeatureExtraction.h>
+
+#include <future>
+#include <thread>
+
+// Universal include for all versions of OpenCV
+#include <mrpt/3rdparty/do_opencv_includes.h>
+
+using namespace mrpt;
+using namespace mrpt::vision;
+using namespace mrpt::img;
+using namespace mrpt::system;
+using namespace std;
+
+void CFeatureExtraction::detectFeaturesMultiScale(
+    const mrpt::img::CImage& inImg,
+    CFeatureList& feats,
+    unsigned int init_ID,
+    unsigned int nDesiredFeatures)
+{
+  MRPT_START
+
+  mrpt::system::CTimeLoggerEntry tle(profiler, "detectFeaturesMultiScale");
+
+#if MRPT_HAS_OPENCV
+  using namespace cv;
+
+  ASSERTMSG_(
+      options.featsType == featFAST || options.featsType == featORB,
+      "detectFeaturesMultiScale() supports featsType featFAST or featORB only");
+  const bool computeORBDescs = options.featsType == featORB;
+
+  const auto& msOpts = options.multiScaleOptions;
+  const size_t nOctaves = std::max<size_t>(1, msOpts.n_octaves);
+  const unsigned int gx = std::max(1U, msOpts.grid_cells_x);
+  const unsigned int gy = std::max(1U, msOpts.grid_cells_y);
+
+  // Octave images. images[0] is a shallow reference if the input is already
+  // grayscale, so the source image must outlive this function call:
+  std::vector<CImage> octaves(nOctaves);
+  octaves[0] = CImage(inImg, FAST_REF_OR_CONVERT_TO_GRAY);
+
+  // Per-octave feature budget: proportional to pixel count (4^-o), so the
+  // full-resolution octave dominates like in the single-scale detectors:
+  std::vector<size_t> levelBudget(nOctaves, 0);
+  if (nDesiredFeatures > 0)
+  {
+    double sumW = 0;
+    for (size_t o = 0; o < nOctaves; o++) sumW += std::pow(0.25, static_cast<double>(o));
+    for (size_t o = 0; o < nOctaves; o++)
+      levelBudget[o] = std::max<size_t>(
+          1, mrpt::round(nDesiredFeatures * std::pow(0.25, static_cast<double>(o)) / sumW));
+  }
+
+  struct TLevelResult
+  {
+    std::vector<cv::KeyPoint> kps;
+    cv::Mat descs;
+  };
+
+  // Detect (and describe) one octave; runs on a worker thread:
+  const auto detectOneOctave = [&](const size_t octave) -> TLevelResult
+  {
+    TLevelResult res;
+    const CImage& im = octaves[octave];
+    const Mat m = im.asCvMat<Mat>(SHALLOW_COPY);
+
+    std::vector<KeyPoint> kps;
+    cv::FAST(m, kps, options.FASTOptions.threshold, options.FASTOptions.nonmax_suppression);
+
+    // Grid-adaptive NMS: keep only the strongest keypoints per grid cell,
+    // bounding descriptor work regardless of local texture density and
+    // spreading features over the whole image:
+    if (!kps.empty() && levelBudget[octave] > 0)
+    {
+      const size_t cellBudget = std::max<size_t>(1, levelBudget[octave] / (gx * gy));
+
+      const float cell_w_inv = gx / static_cast<float>(m.cols);
+      const float cell_h_inv = gy / static_cast<float>(m.rows);
+
+      std::vector<std::vector<size_t>> cells(gx * gy);
+      for (size_t i = 0; i < kps.size(); i++)
+      {
+        const auto cx = std::min(gx - 1, static_cast<unsigned int>(kps[i].pt.x * cell_w_inv));
+        const auto cy = std::min(gy - 1, static_cast<unsigned int>(kps[i].pt.y * cell_h_inv));
+        cells[cx + gx * cy].push_back(i);
+      }
+
+      std::vector<KeyPoint> kept;
+      kept.reserve(std::min<size_t>(kps.size(), cellBudget * gx * gy));
+      for (auto& cell : cells)
+      {
+        if (cell.size() > cellBudget)
+        {
+          std::partial_sort(
+              cell.begin(), cell.begin() + cellBudget, cell.end(),
+              [&kps](size_t a, size_t b) { return kps[a].response > kps[b].response; });
+          cell.resize(cellBudget);
+        }
+        for (const auto idx : cell) kept.push_back(kps[idx]);
+      }
+      kps = std::move(kept);
+    }
+
+    if (computeORBDescs && !kps.empty())
+    {
+      // Single-level ORB: the pyramid already provides the scale space.
+      auto orb = cv::ORB::create(
+          static_cast<int>(kps.size()), options.ORBOptions.scale_factor, 1 /*nlevels*/);
+      orb->compute(m, kps, res.descs);
+    }
+    res.kps = std::move(kps);
+    return res;
+  };
+
+  unsigned int nThreads =
+      msOpts.threads != 0 ? msOpts.threads : std::thread::hardware_concurrency();
+  nThreads = std::max(1U, nThreads);
+
+  std::vector<std::future<TLevelResult>> futs(nOctaves);
+  std::vector<TLevelResult> results(nOctaves);
+
+  if (nThreads == 1)
+  {
+    for (size_t o = 0; o < nOctaves; o++)
+    {
+      if (o > 0)
+        octaves[o - 1].scaleHalf(
+            octaves[o], msOpts.smooth_halves ? IMG_INTERP_LINEAR : IMG_INTERP_NN);
+      results[o] = detectOneOctave(o);
+    }
+  }
+  else
+  {
+    static mrpt::WorkerThreadsPool pool(
+        std::thread::hardware_concurrency(), mrpt::WorkerThreadsPool::POLICY_FIFO,
+        "multiScaleDetect");
+
+    // Pipelined: detection of octave "o" overlaps the halving that builds
+    // octave "o+1" (which is the only sequential dependency here):
+    for (size_t o = 0; o < nOctaves; o++)
+    {
+      futs[o] = pool.enqueue(detectOneOctave, o);
+      if (o + 1 < nOctaves)
+        octaves[o].scaleHalf(
+            octaves[o + 1], msOpts.smooth_halves ? IMG_INTERP_LINEAR : IMG_INTERP_NN);
+    }
+
+    // Wait for all octaves, keeping the first error (if any) to rethrow
+    // once no worker can still touch our stack variables:
+    std::exception_ptr firstExcept;
+    for (size_t o = 0; o < nOctaves; o++)
+    {
+      try
+      {
+        results[o] = futs[o].get();
+      }
+      catch (...)
+      {
+        if (!firstExcept) firstExcept = std::current_exception();
+      }
+    }
+    if (firstExcept) std::rethrow_exception(firstExcept);
+  }
+
+  // Merge all octaves into the output list, scaling coordinates back to the
+  // full-resolution image:
+  if (!options.addNewFeatures) feats.clear();
+
+  const int patch_size_2 = static_cast<int>(options.patchSize / 2);
+  TFeatureID nextID = init_ID;
+
+  for (size_t o = 0; o < nOctaves; o++)
+  {
+    const auto& res = results[o];
+    const float scale = static_cast<float>(1u << o);
+    const CImage& im = octaves[o];
+    const int imW = static_cast<int>(im.getWidth()), imH = static_cast<int>(im.getHeight());
+
+    for (size_t k = 0; k < res.kps.size(); k++)
+    {
+      const KeyPoint& kp = res.kps[k];
+
+      CFeature ft;
+      ft.type = options.featsType;
+      ft.keypoint.ID = nextID++;
+      ft.keypoint.pt.x = kp.pt.x * scale;
+      ft.keypoint.pt.y = kp.pt.y * scale;
+      ft.keypoint.octave = static_cast<uint8_t>(o);
+      ft.response = kp.response;
+      ft.orientation = kp.angle;
+      ft.patchSize = 0;
+
+      if (computeORBDescs)
+      {
+        ft.descriptors.ORB.emplace();
+        ft.descriptors.ORB->resize(res.descs.cols);
+        for (int mcol = 0; mcol < res.descs.cols; ++mcol)
+          (*ft.descriptors.ORB)[mcol] = res.descs.at<uchar>(static_cast<int>(k), mcol);
+      }
+
+      if (options.patchSize > 0)
+      {
+        // Patch at the keypoint's own octave (skip if out of bounds):
+        const int x0 = mrpt::round(kp.pt.x) - patch_size_2;
+        const int y0 = mrpt::round(kp.pt.y) - patch_size_2;
+        if (x0 > 0 && y0 > 0 && x0 + static_cast<int>(options.patchSize) < imW &&
+            y0 + static_cast<int>(options.patchSize) < imH)
+        {
+          ft.patchSize = options.patchSize;
+          ft.patch.emplace();
+          im.extract_patch(*ft.patch, x0, y0, options.patchSize, options.patchSize);
+        }
+      }
+
+      feats.emplace_back(std::move(ft));
+    }
+  }
+#else
+  THROW_EXCEPTION("MRPT built without OpenCV!");
+#endif
+  MRPT_END
+}
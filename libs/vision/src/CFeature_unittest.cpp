@@ -0,0 +1,73 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/random.h>
+#include <mrpt/vision/CFeature.h>
+
+using namespace mrpt::vision;
+
+TEST(CFeature, descriptorORBHammingDistance)
+{
+  auto& rnd = mrpt::random::getRandomGenerator();
+  rnd.randomize(333);
+
+  CFeature f1, f2;
+  f1.descriptors.ORB.emplace(32);
+  f2.descriptors.ORB.emplace(32);
+
+  for (int iter = 0; iter < 20; iter++)
+  {
+    for (size_t k = 0; k < 32; k++)
+    {
+      (*f1.descriptors.ORB)[k] = static_cast<uint8_t>(rnd.drawUniform32bit());
+      (*f2.descriptors.ORB)[k] = static_cast<uint8_t>(rnd.drawUniform32bit());
+    }
+
+    // Reference: naive per-bit Hamming distance
+    unsigned int expected = 0;
+    for (size_t k = 0; k < 32; k++)
+    {
+      uint8_t x = (*f1.descriptors.ORB)[k] ^ (*f2.descriptors.ORB)[k];
+      for (; x; expected++) x &= x - 1;
+    }
+
+    EXPECT_EQ(f1.descriptorORBDistanceTo(f2), static_cast<uint8_t>(expected));
+    EXPECT_EQ(f2.descriptorORBDistanceTo(f1), static_cast<uint8_t>(expected));
+  }
+
+  // Identical descriptors => zero distance:
+  *f2.descriptors.ORB = *f1.descriptors.ORB;
+  EXPECT_EQ(f1.descriptorORBDistanceTo(f2), 0);
+}
+
+TEST(CFeature, descriptorSIFTL2Distance)
+{
+  auto& rnd = mrpt::random::getRandomGenerator();
+  rnd.randomize(334);
+
+  CFeature f1, f2;
+  const size_t N = 128;
+  f1.descriptors.SIFT.emplace(N);
+  f2.descriptors.SIFT.emplace(N);
+  for (size_t k = 0; k < N; k++)
+  {
+    (*f1.descriptors.SIFT)[k] = static_cast<uint8_t>(rnd.drawUniform32bit());
+    (*f2.descriptors.SIFT)[k] = static_cast<uint8_t>(rnd.drawUniform32bit());
+  }
+
+  // Reference: naive squared-differences sum
+  float expected = 0;
+  for (size_t k = 0; k < N; k++)
+    expected += mrpt::square(float((*f1.descriptors.SIFT)[k]) - float((*f2.descriptors.SIFT)[k]));
+  expected = std::sqrt(expected / N) / 64.0f;
+
+  EXPECT_NEAR(f1.descriptorSIFTDistanceTo(f2), expected, 1e-4f);
+  EXPECT_NEAR(f1.descriptorSIFTDistanceTo(f1), .0f, 1e-6f);
+}
@@ -10,9 +10,17 @@
 #include "vision-precomp.h"  // Precompiled headers
 //
 #include <mrpt/3rdparty/do_opencv_includes.h>
+#include <mrpt/io/CFileGZInputStream.h>
+#include <mrpt/io/CFileGZOutputStream.h>
+#include <mrpt/io/CMemoryStream.h>
+#include <mrpt/serialization/CArchive.h>
+#include <mrpt/system/filesystem.h>
 #include <mrpt/vision/CStereoRectifyMap.h>
 
 #include <Eigen/Dense>
+#include <algorithm>
+#include <future>
+#include <thread>
 
 using namespace mrpt;
 using namespace mrpt::poses;
@@ -33,7 +41,9 @@ static void do_rectify(
     int16_t* map_xr,
     uint16_t* map_yl,
     uint16_t* map_yr,
-    int interp_method)
+    int interp_method,
+    mrpt::system::WorkerThreadsPool* pool,
+    unsigned int num_row_blocks)
 {
   MRPT_START
   ASSERTMSG_(
@@ -58,8 +68,41 @@ static void do_rectify(
   const cv::Mat mapx2 = cv::cvarrToMat(&mapx_right);
   const cv::Mat mapy2 = cv::cvarrToMat(&mapy_right);
 
-  cv::remap(src_left, out_left, mapx1, mapy1, interp_method, cv::BORDER_CONSTANT, cvScalarAll(0));
-  cv::remap(src_right, out_right, mapx2, mapy2, interp_method, cv::BORDER_CONSTANT, cvScalarAll(0));
+  if (!pool || num_row_blocks <= 1 || nrows_out < static_cast<int>(2 * num_row_blocks))
+  {
+    cv::remap(src_left, out_left, mapx1, mapy1, interp_method, cv::BORDER_CONSTANT, cvScalarAll(0));
+    cv::remap(
+        src_right, out_right, mapx2, mapy2, interp_method, cv::BORDER_CONSTANT, cvScalarAll(0));
+    return;
+  }
+
+  // Each output pixel only depends on the map entry at its own position, so
+  // splitting the *output* (and maps) by row blocks is an exact partition of
+  // the work; every task still reads the whole source image.
+  std::vector<std::future<void>> futs;
+  futs.reserve(2 * num_row_blocks);
+  for (int img = 0; img < 2; img++)
+  {
+    const cv::Mat& src = (img == 0) ? src_left : src_right;
+    cv::Mat& out = (img == 0) ? out_left : out_right;
+    const cv::Mat& mapx = (img == 0) ? mapx1 : mapx2;
+    const cv::Mat& mapy = (img == 0) ? mapy1 : mapy2;
+
+    for (unsigned int b = 0; b < num_row_blocks; b++)
+    {
+      const int r0 = (nrows_out * b) / num_row_blocks;
+      const int r1 = (nrows_out * (b + 1)) / num_row_blocks;
+      futs.emplace_back(pool->enqueue(
+          [&src, &out, &mapx, &mapy, r0, r1, interp_method]()
+          {
+            cv::Mat outBlock = out.rowRange(r0, r1);
+            cv::remap(
+                src, outBlock, mapx.rowRange(r0, r1), mapy.rowRange(r0, r1), interp_method,
+                cv::BORDER_CONSTANT, cvScalarAll(0));
+          }));
+    }
+  }
+  for (auto& f : futs) f.get();  // rethrows any exception from the tasks
   MRPT_END
 }
 #endif
@@ -269,10 +312,24 @@ void CStereoRectifyMap::rectify(
   cv::Mat& out_left = out_left_image.asCvMatRef();
   cv::Mat& out_right = out_right_image.asCvMatRef();
 
+  mrpt::system::WorkerThreadsPool* pool = nullptr;
+  if (m_rectify_threads > 1)
+  {
+    // WorkerThreadsPool::resize() *adds* threads, so only add the missing
+    // ones if the user raised the thread count since the last call:
+    if (m_rectify_pool_threads < m_rectify_threads)
+    {
+      m_rectify_pool.resize(m_rectify_threads - m_rectify_pool_threads);
+      m_rectify_pool_threads = m_rectify_threads;
+    }
+    pool = &m_rectify_pool;
+  }
+
   do_rectify(
       *this, in_left, in_right, out_left, out_right, const_cast<int16_t*>(&m_dat_mapx_left[0]),
       const_cast<int16_t*>(&m_dat_mapx_right[0]), const_cast<uint16_t*>(&m_dat_mapy_left[0]),
-      const_cast<uint16_t*>(&m_dat_mapy_right[0]), static_cast<int>(m_interpolation_method));
+      const_cast<uint16_t*>(&m_dat_mapy_right[0]), static_cast<int>(m_interpolation_method), pool,
+      m_rectify_threads);
 
 #endif
   MRPT_END
@@ -348,6 +405,98 @@ void CStereoRectifyMap::setRectifyMaps(
   std::copy(right_y.begin(), right_y.end(), m_dat_mapy_right.begin());
 }
 
+void CStereoRectifyMap::enableThreadedRectify(bool enable, unsigned int num_threads)
+{
+  if (!enable)
+  {
+    m_rectify_threads = 0;
+    return;
+  }
+  if (num_threads == 0) num_threads = std::max(1u, std::thread::hardware_concurrency() / 2);
+  m_rectify_threads = num_threads;
+}
+
+// Format version of the stream written by saveRectifyMaps():
+static const uint8_t RECTIFY_MAPS_SERIALIZATION_VERSION = 0;
+
+uint64_t CStereoRectifyMap::rectifyMapsCacheKey(const mrpt::img::TStereoCamera& params) const
+{
+  MRPT_START
+  // Serialize everything the generated maps depend on, then hash the bytes
+  // (FNV-1a, 64 bit):
+  mrpt::io::CMemoryStream buf;
+  auto arch = mrpt::serialization::archiveFrom(buf);
+  arch << params << m_alpha << m_resize_output << static_cast<int32_t>(m_resize_output_value.x)
+       << static_cast<int32_t>(m_resize_output_value.y) << m_enable_both_centers_coincide;
+
+  const auto* p = reinterpret_cast<const uint8_t*>(buf.getRawBufferData());
+  uint64_t h = 0xcbf29ce484222325ULL;
+  for (uint64_t i = 0, n = buf.getTotalBytesCount(); i < n; i++)
+  {
+    h ^= p[i];
+    h *= 0x100000001b3ULL;
+  }
+  return h;
+  MRPT_END
+}
+
+void CStereoRectifyMap::saveRectifyMaps(mrpt::serialization::CArchive& out) const
+{
+  MRPT_START
+  ASSERTMSG_(isSet(), "saveRectifyMaps(): no maps computed yet, call setFromCamParams() first");
+
+  out << RECTIFY_MAPS_SERIALIZATION_VERSION;
+  out << rectifyMapsCacheKey(m_camera_params);
+  out << m_camera_params << m_rectified_image_params << m_rot_left << m_rot_right;
+  out << m_dat_mapx_left << m_dat_mapy_left << m_dat_mapx_right << m_dat_mapy_right;
+  MRPT_END
+}
+
+bool CStereoRectifyMap::loadRectifyMaps(
+    mrpt::serialization::CArchive& in, const mrpt::img::TStereoCamera& params)
+{
+  MRPT_START
+  uint8_t version;
+  in >> version;
+  if (version != RECTIFY_MAPS_SERIALIZATION_VERSION) return false;
+
+  uint64_t key;
+  in >> key;
+  if (key != rectifyMapsCacheKey(params)) return false;  // stale cache
+
+  in >> m_camera_params >> m_rectified_image_params >> m_rot_left >> m_rot_right;
+  in >> m_dat_mapx_left >> m_dat_mapy_left >> m_dat_mapx_right >> m_dat_mapy_right;
+  return true;
+  MRPT_END
+}
+
+bool CStereoRectifyMap::setFromCamParamsCached(
+    const mrpt::img::TStereoCamera& params, const std::string& cache_file)
+{
+  MRPT_START
+  if (mrpt::system::fileExists(cache_file))
+  {
+    try
+    {
+      mrpt::io::CFileGZInputStream f(cache_file);
+      auto arch = mrpt::serialization::archiveFrom(f);
+      if (loadRectifyMaps(arch, params)) return true;
+    }
+    catch (const std::exception&)
+    {
+      // Corrupt or truncated cache file: recompute below.
+    }
+  }
+
+  setFromCamParams(params);
+
+  mrpt::io::CFileGZOutputStream f(cache_file);
+  auto arch = mrpt::serialization::archiveFrom(f);
+  saveRectifyMaps(arch);
+  return false;
+  MRPT_END
+}
+
 void CStereoRectifyMap::setRectifyMapsFast(
     std::vector<int16_t>& left_x,
     std::vector<uint16_t>& left_y,
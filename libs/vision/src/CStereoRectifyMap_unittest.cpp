@@ -0,0 +1,66 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/io/CMemoryStream.h>
+#include <mrpt/serialization/CArchive.h>
+#include <mrpt/vision/CStereoRectifyMap.h>
+
+using namespace mrpt::vision;
+
+TEST(CStereoRectifyMap, cacheKeyDependsOnOptions)
+{
+  const mrpt::img::TStereoCamera params;
+
+  CStereoRectifyMap m1, m2;
+  EXPECT_EQ(m1.rectifyMapsCacheKey(params), m2.rectifyMapsCacheKey(params));
+
+  m2.setAlpha(0.5);
+  EXPECT_NE(m1.rectifyMapsCacheKey(params), m2.rectifyMapsCacheKey(params));
+
+  m1.enableBothCentersCoincide(true);
+  EXPECT_NE(m1.rectifyMapsCacheKey(params), m2.rectifyMapsCacheKey(params));
+}
+
+TEST(CStereoRectifyMap, saveLoadRectifyMaps)
+{
+  const mrpt::img::TStereoCamera params;
+
+  // Build an object with (synthetic) maps, without requiring OpenCV:
+  CStereoRectifyMap m1;
+  const std::vector<int16_t> lx(2 * 4 * 3, 7), rx(2 * 4 * 3, -3);
+  const std::vector<uint16_t> ly(4 * 3, 11), ry(4 * 3, 13);
+  m1.setRectifyMaps(lx, ly, rx, ry);
+  ASSERT_TRUE(m1.isSet());
+
+  mrpt::io::CMemoryStream buf;
+  {
+    auto arch = mrpt::serialization::archiveFrom(buf);
+    m1.saveRectifyMaps(arch);
+  }
+
+  // Matching parameters & options => load must succeed:
+  {
+    buf.Seek(0);
+    auto arch = mrpt::serialization::archiveFrom(buf);
+    CStereoRectifyMap m2;
+    EXPECT_TRUE(m2.loadRectifyMaps(arch, params));
+    EXPECT_TRUE(m2.isSet());
+  }
+
+  // Different map-generation options => stale cache, must be rejected:
+  {
+    buf.Seek(0);
+    auto arch = mrpt::serialization::archiveFrom(buf);
+    CStereoRectifyMap m3;
+    m3.setAlpha(0.25);
+    EXPECT_FALSE(m3.loadRectifyMaps(arch, params));
+    EXPECT_FALSE(m3.isSet());
+  }
+}
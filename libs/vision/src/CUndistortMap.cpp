@@ -9,8 +9,12 @@
 
 #include "vision-precomp.h"  // Precompiled headers
 //
+#include <mrpt/core/WorkerThreadsPool.h>
 #include <mrpt/vision/CUndistortMap.h>
 
+#include <future>
+#include <thread>
+
 // Universal include for all versions of OpenCV
 #include <mrpt/3rdparty/do_opencv_includes.h>
 
@@ -23,11 +27,16 @@ CUndistortMap::CUndistortMap() = default;
 /** Prepares the mapping from the distortion parameters of a camera.
  * Must be called before invoking \a undistort().
  */
-void CUndistortMap::setFromCamParams(const mrpt::img::TCamera& campar)
+void CUndistortMap::setFromCamParams(
+    const mrpt::img::TCamera& campar, const std::optional<mrpt::img::TImageSize>& outputSize)
 {
   MRPT_START
 #if MRPT_HAS_OPENCV
   m_camera_params = campar;
+  m_map_size = outputSize.value_or(
+      mrpt::img::TImageSize(static_cast<int>(campar.ncols), static_cast<int>(campar.nrows)));
+  ASSERT_GT_(m_map_size.x, 0);
+  ASSERT_GT_(m_map_size.y, 0);
 
   // Convert to opencv's format:
   double aux1[3][3], aux2[1][5];
@@ -38,13 +47,26 @@ void CUndistortMap::setFromCamParams(const mrpt::img::TCamera& campar)
   const cv::Mat inMat(3, 3, CV_64F, aux1);
   const cv::Mat distM(1, 5, CV_64F, aux2);
 
-  m_dat_mapx.resize(2 * campar.nrows * campar.ncols);
-  m_dat_mapy.resize(campar.nrows * campar.ncols);
-
-  cv::Mat mapx(campar.nrows, campar.ncols, CV_16SC2, &m_dat_mapx[0]);
-  cv::Mat mapy(campar.nrows, campar.ncols, CV_16UC1, &m_dat_mapy[0]);
-
-  cv::initUndistortRectifyMap(inMat, distM, cv::Mat(), inMat, mapx.size(), mapx.type(), mapx, mapy);
+  // If an output size was requested, fuse the rescaling into the map by
+  // building it for intrinsics scaled to the new resolution:
+  double aux3[3][3];
+  const double sx = m_map_size.x / static_cast<double>(campar.ncols);
+  const double sy = m_map_size.y / static_cast<double>(campar.nrows);
+  for (int j = 0; j < 3; j++)
+  {
+    aux3[0][j] = aux1[0][j] * sx;
+    aux3[1][j] = aux1[1][j] * sy;
+    aux3[2][j] = aux1[2][j];
+  }
+  const cv::Mat outMat(3, 3, CV_64F, aux3);
+
+  m_dat_mapx.resize(2 * m_map_size.y * m_map_size.x);
+  m_dat_mapy.resize(m_map_size.y * m_map_size.x);
+
+  cv::Mat mapx(m_map_size.y, m_map_size.x, CV_16SC2, &m_dat_mapx[0]);
+  cv::Mat mapy(m_map_size.y, m_map_size.x, CV_16UC1, &m_dat_mapy[0]);
+
+  cv::initUndistortRectifyMap(inMat, distM, cv::Mat(), outMat, mapx.size(), mapx.type(), mapx, mapy);
 #else
   THROW_EXCEPTION("MRPT built without OpenCV >=2.0.0!");
 #endif
@@ -62,13 +84,10 @@ void CUndistortMap::undistort(const mrpt::img::CImage& in_img, mrpt::img::CImage
 
 #if MRPT_HAS_OPENCV
   using namespace cv;
-  Mat mapx(
-      m_camera_params.nrows, m_camera_params.ncols, CV_16SC2, const_cast<int16_t*>(&m_dat_mapx[0]));
-  Mat mapy(
-      m_camera_params.nrows, m_camera_params.ncols, CV_16UC1,
-      const_cast<uint16_t*>(&m_dat_mapy[0]));
+  Mat mapx(m_map_size.y, m_map_size.x, CV_16SC2, const_cast<int16_t*>(&m_dat_mapx[0]));
+  Mat mapy(m_map_size.y, m_map_size.x, CV_16UC1, const_cast<uint16_t*>(&m_dat_mapy[0]));
 
-  out_img.resize(in_img.getWidth(), in_img.getHeight(), in_img.getChannelCount());
+  out_img.resize(m_map_size.x, m_map_size.y, in_img.getChannelCount());
 
   cv::remap(
       in_img.asCvMat<Mat>(SHALLOW_COPY), out_img.asCvMat<Mat>(SHALLOW_COPY), mapx, mapy,
@@ -87,14 +106,11 @@ void CUndistortMap::undistort(mrpt::img::CImage& in_out_img) const
     THROW_EXCEPTION("Error: setFromCamParams() must be called prior to undistort().");
 
 #if MRPT_HAS_OPENCV
-  cv::Mat mapx(
-      m_camera_params.nrows, m_camera_params.ncols, CV_16SC2, const_cast<int16_t*>(&m_dat_mapx[0]));
-  cv::Mat mapy(
-      m_camera_params.nrows, m_camera_params.ncols, CV_16UC1,
-      const_cast<uint16_t*>(&m_dat_mapy[0]));
+  cv::Mat mapx(m_map_size.y, m_map_size.x, CV_16SC2, const_cast<int16_t*>(&m_dat_mapx[0]));
+  cv::Mat mapy(m_map_size.y, m_map_size.x, CV_16UC1, const_cast<uint16_t*>(&m_dat_mapy[0]));
 
   cv::Mat in = in_out_img.asCvMat<cv::Mat>(SHALLOW_COPY);
-  cv::Mat out(in.size(), in.type());
+  cv::Mat out(mapx.size(), in.type());
 
   cv::remap(in, out, mapx, mapy, cv::INTER_LINEAR);
 
@@ -102,3 +118,94 @@ void CUndistortMap::undistort(mrpt::img::CImage& in_out_img) const
 #endif
   MRPT_END
 }
+
+void CUndistortMap::undistortFused(
+    const mrpt::img::CImage& in_img,
+    mrpt::img::CImage& out_img,
+    bool convertToGrayscale,
+    unsigned int numThreads) const
+{
+  MRPT_START
+  if (m_dat_mapx.empty())
+    THROW_EXCEPTION("Error: setFromCamParams() must be called prior to undistortFused().");
+
+#if MRPT_HAS_OPENCV
+  using namespace cv;
+
+  const Mat mapx(m_map_size.y, m_map_size.x, CV_16SC2, const_cast<int16_t*>(&m_dat_mapx[0]));
+  const Mat mapy(m_map_size.y, m_map_size.x, CV_16UC1, const_cast<uint16_t*>(&m_dat_mapy[0]));
+
+  // Grayscale conversion only applies to color inputs:
+  const bool doCvtGray = convertToGrayscale && in_img.getChannelCount() == mrpt::img::CH_RGB;
+
+  // resize() is a no-op if the buffer already has the right geometry, so
+  // repeated per-frame calls are allocation-free:
+  out_img.resize(
+      m_map_size.x, m_map_size.y,
+      (convertToGrayscale || in_img.getChannelCount() == 1) ? mrpt::img::CH_GRAY
+                                                            : mrpt::img::CH_RGB);
+  if (doCvtGray) m_fused_tmp_rgb.resize(m_map_size.x, m_map_size.y, mrpt::img::CH_RGB);
+
+  const Mat inMat = in_img.asCvMat<Mat>(SHALLOW_COPY);
+  Mat outMat = out_img.asCvMat<Mat>(SHALLOW_COPY);
+  Mat tmpMat = doCvtGray ? m_fused_tmp_rgb.asCvMat<Mat>(SHALLOW_COPY) : Mat();
+
+  // One independent row stripe per worker: remap (and convert to gray)
+  // while the stripe is still hot in cache:
+  const auto processStripe = [&](const int r0, const int r1)
+  {
+    const Mat mapx_s = mapx.rowRange(r0, r1);
+    const Mat mapy_s = mapy.rowRange(r0, r1);
+    Mat out_s = outMat.rowRange(r0, r1);
+    if (doCvtGray)
+    {
+      Mat tmp_s = tmpMat.rowRange(r0, r1);
+      cv::remap(inMat, tmp_s, mapx_s, mapy_s, INTER_LINEAR);
+      cv::cvtColor(tmp_s, out_s, cv::COLOR_BGR2GRAY);
+    }
+    else
+    {
+      cv::remap(inMat, out_s, mapx_s, mapy_s, INTER_LINEAR);
+    }
+  };
+
+  unsigned int nThreads = numThreads != 0 ? numThreads : std::thread::hardware_concurrency();
+  nThreads = std::max(1U, std::min<unsigned int>(nThreads, m_map_size.y));
+
+  if (nThreads == 1)
+  {
+    processStripe(0, m_map_size.y);
+  }
+  else
+  {
+    static mrpt::WorkerThreadsPool pool(
+        std::thread::hardware_concurrency(), mrpt::WorkerThreadsPool::POLICY_FIFO,
+        "undistortFused");
+
+    std::vector<std::future<void>> futs;
+    futs.reserve(nThreads);
+    for (unsigned int i = 0; i < nThreads; i++)
+    {
+      const int r0 = (m_map_size.y * i) / nThreads;
+      const int r1 = (m_map_size.y * (i + 1)) / nThreads;
+      futs.emplace_back(pool.enqueue([&processStripe, r0, r1]() { processStripe(r0, r1); }));
+    }
+    // Wait for all stripes, keeping the first error (if any) to rethrow
+    // once all workers are done with our stack variables:
+    std::exception_ptr firstExcept;
+    for (auto& f : futs)
+    {
+      try
+      {
+        f.get();
+      }
+      catch (...)
+      {
+        if (!firstExcept) firstExcept = std::current_exception();
+      }
+    }
+    if (firstExcept) std::rethrow_exception(firstExcept);
+  }
+#endif
+  MRPT_END
+}
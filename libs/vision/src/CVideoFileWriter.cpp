@@ -14,6 +14,8 @@
 // Universal include for all versions of OpenCV
 #include <mrpt/3rdparty/do_opencv_includes.h>
 
+#include <mrpt/system/CTicTac.h>
+
 using namespace mrpt;
 using namespace mrpt::vision;
 using namespace mrpt::img;
@@ -32,7 +34,19 @@ struct CVideoFileWriter::Impl
 
 CVideoFileWriter::CVideoFileWriter() : m_video(mrpt::make_impl<CVideoFileWriter::Impl>()) {}
 
-CVideoFileWriter::~CVideoFileWriter() { close(); }
+CVideoFileWriter::~CVideoFileWriter()
+{
+  close();
+  if (m_worker.joinable())
+  {
+    {
+      std::lock_guard<std::mutex> lck(m_queueMtx);
+      m_workerShouldEnd = true;
+    }
+    m_queueCV.notify_all();
+    m_worker.join();
+  }
+}
 
 bool CVideoFileWriter::open(
     const std::string& out_file,
@@ -64,6 +78,18 @@ bool CVideoFileWriter::open(
 
   m_img_size = frameSize;
 
+#if defined(CV_VERSION_MAJOR) && (CV_VERSION_MAJOR > 4 || (CV_VERSION_MAJOR == 4 && CV_VERSION_MINOR >= 6))
+  if (m_hwAccel)
+  {
+    // Request a hardware encoder (VAAPI, NVENC, ...) if OpenCV was built
+    // with support for any; fall back to software encoding below if not:
+    const std::vector<int> params = {
+        cv::VIDEOWRITER_PROP_HW_ACCELERATION, cv::VIDEO_ACCELERATION_ANY};
+    if (m_video->obj.open(out_file, cc, fps, cv::Size(frameSize.x, frameSize.y), params))
+      return true;
+  }
+#endif
+
   return m_video->obj.open(out_file, cc, fps, cv::Size(frameSize.x, frameSize.y), isColor);
 
 #else
@@ -76,6 +102,12 @@ bool CVideoFileWriter::open(
 
 void CVideoFileWriter::close()
 {
+  // Let the encode thread drain any pending frames first:
+  if (m_worker.joinable())
+  {
+    std::unique_lock<std::mutex> lck(m_queueMtx);
+    m_queueDoneCV.wait(lck, [this] { return m_queue.empty(); });
+  }
 #if MRPT_HAS_OPENCV
   m_video->obj.release();
 #endif
@@ -100,6 +132,21 @@ const CVideoFileWriter& CVideoFileWriter::operator<<(const mrpt::img::CImage& im
 }
 
 bool CVideoFileWriter::writeImage(const mrpt::img::CImage& img)
+{
+  // Deep copy: the caller may reuse its buffer as soon as we return.
+  if (m_queueMaxLen) return internal_enqueueFrame(img.makeDeepCopy());
+
+  return internal_writeImage(img);
+}
+
+bool CVideoFileWriter::writeImageMove(mrpt::img::CImage&& img)
+{
+  if (m_queueMaxLen) return internal_enqueueFrame(std::move(img));
+
+  return internal_writeImage(img);
+}
+
+bool CVideoFileWriter::internal_writeImage(const mrpt::img::CImage& img)
 {
   if (!m_video.get()) return false;
 
@@ -122,3 +169,67 @@ bool CVideoFileWriter::writeImage(const mrpt::img::CImage& img)
   return false;
 #endif
 }
+
+bool CVideoFileWriter::internal_enqueueFrame(mrpt::img::CImage&& img)
+{
+  if (!m_video.get()) return false;
+
+  std::lock_guard<std::mutex> lck(m_queueMtx);
+  m_queue.emplace_back(std::move(img));
+  m_statEnqueued++;
+  if (m_queue.size() > m_queueMaxLen)
+  {
+    // Drop-oldest policy:
+    m_queue.pop_front();
+    m_statDropped++;
+  }
+  m_queueCV.notify_one();
+  return true;
+}
+
+void CVideoFileWriter::enableAsyncEncoding(size_t maxQueueLength)
+{
+  std::lock_guard<std::mutex> lck(m_queueMtx);
+  m_queueMaxLen = maxQueueLength;
+  if (maxQueueLength && !m_worker.joinable())
+    m_worker = std::thread(&CVideoFileWriter::encodeThread, this);
+}
+
+void CVideoFileWriter::encodeThread()
+{
+  // Raw `this` is safe: the dtor joins this thread before destruction.
+  mrpt::system::CTicTac timer;
+  for (;;)
+  {
+    mrpt::img::CImage frame;
+    {
+      std::unique_lock<std::mutex> lck(m_queueMtx);
+      m_queueCV.wait(lck, [this] { return m_workerShouldEnd || !m_queue.empty(); });
+      if (m_workerShouldEnd && m_queue.empty()) return;
+      frame = std::move(m_queue.front());
+      m_queue.pop_front();
+    }
+
+    timer.Tic();
+    internal_writeImage(frame);
+    m_statLastEncodeLatency = timer.Tac();
+    m_statEncoded++;
+
+    {
+      std::lock_guard<std::mutex> lck(m_queueMtx);
+      if (m_queue.empty()) m_queueDoneCV.notify_all();
+    }
+  }
+}
+
+CVideoFileWriter::TAsyncStats CVideoFileWriter::getAsyncStats() const
+{
+  TAsyncStats s;
+  s.frames_enqueued = m_statEnqueued;
+  s.frames_encoded = m_statEncoded;
+  s.frames_dropped = m_statDropped;
+  s.last_encode_latency_sec = m_statLastEncodeLatency;
+  std::lock_guard<std::mutex> lck(m_queueMtx);
+  s.cur_queue_len = m_queue.size();
+  return s;
+}
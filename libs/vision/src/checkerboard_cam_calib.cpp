@@ -11,12 +11,16 @@
 //
 #include <mrpt/3rdparty/do_opencv_includes.h>
 #include <mrpt/config/CConfigFileMemory.h>
+#include <mrpt/system/WorkerThreadsPool.h>
 #include <mrpt/system/filesystem.h>
 #include <mrpt/vision/chessboard_camera_calib.h>
 #include <mrpt/vision/chessboard_find_corners.h>
 #include <mrpt/vision/pinhole.h>
 
 #include <Eigen/Dense>
+#include <algorithm>
+#include <future>
+#include <thread>
 
 #if MRPT_HAS_OPENCV
 #include <opencv2/core/eigen.hpp>
@@ -68,6 +72,27 @@ bool mrpt::vision::checkerBoardCameraCalibration(
     mrpt::img::TCamera& out_camera_params,
     bool normalize_image,
     double* out_MSE,
+    bool skipDrawDetectedImgs)
+{
+  return checkerBoardCameraCalibration(
+      images, check_size_x, check_size_y, check_squares_length_X_meters,
+      check_squares_length_Y_meters, out_camera_params, TCameraCalibParams(), normalize_image,
+      out_MSE, skipDrawDetectedImgs);
+}
+
+/* -------------------------------------------------------
+        checkerBoardCameraCalibration
+   ------------------------------------------------------- */
+bool mrpt::vision::checkerBoardCameraCalibration(
+    TCalibrationImageList& images,
+    unsigned int check_size_x,
+    unsigned int check_size_y,
+    double check_squares_length_X_meters,
+    double check_squares_length_Y_meters,
+    mrpt::img::TCamera& out_camera_params,
+    const TCameraCalibParams& params,
+    bool normalize_image,
+    double* out_MSE,
     [[maybe_unused]] bool skipDrawDetectedImgs)
 {
 #if MRPT_HAS_OPENCV
@@ -116,6 +141,12 @@ bool mrpt::vision::checkerBoardCameraCalibration(
       dat.projectedPoints_distorted.clear();  // Clear reprojected points.
       dat.projectedPoints_undistorted.clear();
 
+      // In incremental mode, frames with a full set of cached corners don't
+      // need their image again:
+      if (params.use_incremental_calibration && dat.detected_corners.size() == CORNERS_COUNT &&
+          !dat.img_original.isEmpty())
+        continue;
+
       // Skip if images are marked as "externalStorage":
       if (!dat.img_original.isExternallyStored() &&
           !mrpt::system::extractFileExtension(it->first).empty())
@@ -137,122 +168,171 @@ bool mrpt::vision::checkerBoardCameraCalibration(
     vector<string> pointsIdx2imageFile;
     cv::Size imgSize(0, 0);
 
-    unsigned int i;
-    for (i = 0, it = images.begin(); it != images.end(); it++, i++)
-    {
-      TImageCalibData& dat = it->second;
+    // Gather the entries in a vector so worker threads can address them by
+    // index:
+    std::vector<TCalibrationImageList::iterator> imgIts;
+    imgIts.reserve(images.size());
+    for (it = images.begin(); it != images.end(); ++it) imgIts.push_back(it);
 
-      // Make grayscale version:
-      const CImage img_gray(dat.img_original, FAST_REF_OR_CONVERT_TO_GRAY);
+    // Serial pre-pass: check all the images have the same size.
+    if (params.use_incremental_calibration && out_camera_params.ncols > 0 &&
+        out_camera_params.nrows > 0)
+      imgSize = cv::Size(out_camera_params.ncols, out_camera_params.nrows);
+
+    for (const auto& imgIt : imgIts)
+    {
+      const CImage& im = imgIt->second.img_original;
+      if (im.isEmpty()) continue;  // cached corners only (incremental mode)
 
-      if (!i)
+      if (imgSize.width == 0)
       {
-        imgSize = cv::Size(img_gray.getWidth(), img_gray.getHeight());
+        imgSize = cv::Size(im.getWidth(), im.getHeight());
         out_camera_params.ncols = imgSize.width;
         out_camera_params.nrows = imgSize.height;
       }
-      else
+      else if (
+          imgSize.height != (int)im.getHeight() || imgSize.width != (int)im.getWidth())
       {
-        if (imgSize.height != (int)img_gray.getHeight() ||
-            imgSize.width != (int)img_gray.getWidth())
-        {
-          std::cout << "ERROR: All the images must have the same size" << std::endl;
-          return false;
-        }
+        std::cout << "ERROR: All the images must have the same size" << std::endl;
+        return false;
       }
+    }
 
-      // Try with expanded versions of the image if it fails to detect the
-      // checkerboard:
-      unsigned corners_count;
-      bool corners_found = false;
+    // Per-image corner detection, independent between images so it can be
+    // dispatched onto a worker pool. Each task only touches its own entry.
+    struct TDetectResult
+    {
+      bool found = false;
+      bool from_cache = false;
+      vector<cv::Point2f> pts;
+    };
+    std::vector<TDetectResult> detectResults(imgIts.size());
 
-      // Temporary buffer for points, to be added if the points pass the
-      // checks.
-      vector<cv::Point2f> this_img_pts(CORNERS_COUNT);
+    const auto detect_one = [&](size_t idx)
+    {
+      TImageCalibData& dat = imgIts[idx]->second;
+      TDetectResult& res = detectResults[idx];
+      res.pts.resize(CORNERS_COUNT);
+
+      // Reuse corners from a former run?
+      if (params.use_incremental_calibration && dat.detected_corners.size() == CORNERS_COUNT)
+      {
+        for (unsigned int k = 0; k < CORNERS_COUNT; k++)
+        {
+          res.pts[k].x = dat.detected_corners[k].x;
+          res.pts[k].y = dat.detected_corners[k].y;
+        }
+        res.found = true;
+        res.from_cache = true;
+        return;
+      }
 
       dat.detected_corners.clear();
 
+      // Make grayscale version:
+      const CImage img_gray(dat.img_original, FAST_REF_OR_CONVERT_TO_GRAY);
+
       // Do detection (this includes the "refine corners" with
       // cvFindCornerSubPix):
       vector<TPixelCoordf> detectedCoords;
-      corners_found = mrpt::vision::findChessboardCorners(
+      bool corners_found = mrpt::vision::findChessboardCorners(
           img_gray, detectedCoords, check_size_x, check_size_y, normalize_image);
 
-      corners_count = detectedCoords.size();
-
       // Copy the data into the overall array of coords:
       ASSERT_(detectedCoords.size() <= CORNERS_COUNT);
       for (size_t p = 0; p < detectedCoords.size(); p++)
       {
-        this_img_pts[p].x = detectedCoords[p].x;
-        this_img_pts[p].y = detectedCoords[p].y;
+        res.pts[p].x = detectedCoords[p].x;
+        res.pts[p].y = detectedCoords[p].y;
       }
 
-      if (corners_found && corners_count != CORNERS_COUNT) corners_found = false;
-
-      cout << format(
-          "Img %s: %s\n", mrpt::system::extractFileName(it->first).c_str(),
-          corners_found ? "DETECTED" : "NOT DETECTED");
+      if (corners_found && detectedCoords.size() != CORNERS_COUNT) corners_found = false;
+      res.found = corners_found;
 
-      if (corners_found)
+      // Draw the checkerboard in the corresponding image:
+      // ----------------------------------------------------
+      if (corners_found && !dat.img_original.isExternallyStored())
       {
-        // save the corners in the data structure:
-        int x, y;
-        unsigned int k;
-        for (y = 0, k = 0; y < check_size.height; y++)
-          for (x = 0; x < check_size.width; x++, k++)
-            dat.detected_corners.emplace_back(this_img_pts[k].x, this_img_pts[k].y);
-
-        // Draw the checkerboard in the corresponding image:
-        // ----------------------------------------------------
-        if (!dat.img_original.isExternallyStored())
+        const int r = 4;
+        cv::Point prev_pt = cvPoint(0, 0);
+        const int line_max = 8;
+        cv::Scalar line_colors[8];
+
+        line_colors[0] = CV_RGB(255, 0, 0);
+        line_colors[1] = CV_RGB(255, 128, 0);
+        line_colors[2] = CV_RGB(255, 128, 0);
+        line_colors[3] = CV_RGB(200, 200, 0);
+        line_colors[4] = CV_RGB(0, 255, 0);
+        line_colors[5] = CV_RGB(0, 200, 200);
+        line_colors[6] = CV_RGB(0, 0, 255);
+        line_colors[7] = CV_RGB(255, 0, 255);
+
+        // Checkboad as color image:
+        dat.img_original.colorImage(dat.img_checkboard);
+
+        cv::Mat rgb_img = dat.img_checkboard.asCvMat<cv::Mat>(SHALLOW_COPY);
+
+        unsigned int k = 0;
+        for (int y = 0; y < check_size.height; y++)
         {
-          const int r = 4;
-          cv::Point prev_pt = cvPoint(0, 0);
-          const int line_max = 8;
-          cv::Scalar line_colors[8];
-
-          line_colors[0] = CV_RGB(255, 0, 0);
-          line_colors[1] = CV_RGB(255, 128, 0);
-          line_colors[2] = CV_RGB(255, 128, 0);
-          line_colors[3] = CV_RGB(200, 200, 0);
-          line_colors[4] = CV_RGB(0, 255, 0);
-          line_colors[5] = CV_RGB(0, 200, 200);
-          line_colors[6] = CV_RGB(0, 0, 255);
-          line_colors[7] = CV_RGB(255, 0, 255);
-
-          // Checkboad as color image:
-          dat.img_original.colorImage(dat.img_checkboard);
-
-          cv::Mat rgb_img = dat.img_checkboard.asCvMat<cv::Mat>(SHALLOW_COPY);
-
-          for (y = 0, k = 0; y < check_size.height; y++)
+          cv::Scalar color = line_colors[y % line_max];
+          for (int x = 0; x < check_size.width; x++, k++)
           {
-            cv::Scalar color = line_colors[y % line_max];
-            for (x = 0; x < check_size.width; x++, k++)
-            {
-              cv::Point pt{cvRound(this_img_pts[k].x), cvRound(this_img_pts[k].y)};
-
-              if (k != 0) cv::line(rgb_img, prev_pt, pt, color);
-
-              cv::line(
-                  rgb_img, cv::Point(pt.x - r, pt.y - r), cv::Point(pt.x + r, pt.y + r), color);
-              cv::line(
-                  rgb_img, cv::Point(pt.x - r, pt.y + r), cv::Point(pt.x + r, pt.y - r), color);
-              cv::circle(rgb_img, pt, r + 1, color);
-              prev_pt = pt;
-            }
+            cv::Point pt{cvRound(res.pts[k].x), cvRound(res.pts[k].y)};
+
+            if (k != 0) cv::line(rgb_img, prev_pt, pt, color);
+
+            cv::line(rgb_img, cv::Point(pt.x - r, pt.y - r), cv::Point(pt.x + r, pt.y + r), color);
+            cv::line(rgb_img, cv::Point(pt.x - r, pt.y + r), cv::Point(pt.x + r, pt.y - r), color);
+            cv::circle(rgb_img, pt, r + 1, color);
+            prev_pt = pt;
           }
         }
+      }
+    };
 
-        // Accept this image as good:
-        pointsIdx2imageFile.push_back(it->first);
-        imagePoints.push_back(this_img_pts);
-        objectPoints.push_back(pattern_obj_points);
+    unsigned int nThreads = params.detect_threads;
+    if (nThreads == 0) nThreads = std::max(1u, std::thread::hardware_concurrency() / 2);
+    nThreads = std::min<unsigned int>(nThreads, static_cast<unsigned int>(imgIts.size()));
 
-        valid_detected_imgs++;
-      }
+    if (nThreads > 1)
+    {
+      mrpt::system::WorkerThreadsPool pool(nThreads);
+      std::vector<std::future<void>> futs;
+      futs.reserve(imgIts.size());
+      for (size_t idx = 0; idx < imgIts.size(); idx++)
+        futs.emplace_back(pool.enqueue(detect_one, idx));
+      for (auto& f : futs) f.get();  // rethrows any exception from the tasks
+    }
+    else
+    {
+      for (size_t idx = 0; idx < imgIts.size(); idx++) detect_one(idx);
+    }
+
+    // Serial accumulation of the per-image results, in the original order:
+    for (size_t idx = 0; idx < imgIts.size(); idx++)
+    {
+      it = imgIts[idx];
+      TImageCalibData& dat = it->second;
+      const TDetectResult& res = detectResults[idx];
+
+      cout << format(
+          "Img %s: %s\n", mrpt::system::extractFileName(it->first).c_str(),
+          res.from_cache ? "CACHED" : (res.found ? "DETECTED" : "NOT DETECTED"));
 
+      if (!res.found) continue;
+
+      // save the corners in the data structure:
+      if (!res.from_cache)
+        for (unsigned int k = 0; k < CORNERS_COUNT; k++)
+          dat.detected_corners.emplace_back(res.pts[k].x, res.pts[k].y);
+
+      // Accept this image as good:
+      pointsIdx2imageFile.push_back(it->first);
+      imagePoints.push_back(res.pts);
+      objectPoints.push_back(pattern_obj_points);
+
+      valid_detected_imgs++;
     }  // end find corners
 
     std::cout << valid_detected_imgs << " valid images." << std::endl;
@@ -271,8 +351,18 @@ bool mrpt::vision::checkerBoardCameraCalibration(
     cv::Mat cameraMatrix, distCoeffs(1, 5, CV_64F, cv::Scalar::all(0));
     vector<cv::Mat> rvecs, tvecs;
 
+    int calib_flags = 0;
+    if (params.use_incremental_calibration && out_camera_params.intrinsicParams(0, 0) > 0)
+    {
+      // Start the optimizer at the former solution instead of from scratch:
+      calib_flags |= cv::CALIB_USE_INTRINSIC_GUESS;
+      const Eigen::Matrix3d M = out_camera_params.intrinsicParams.asEigen();
+      cv::eigen2cv(M, cameraMatrix);
+      for (int k = 0; k < 5; k++) distCoeffs.ptr<double>()[k] = out_camera_params.dist[k];
+    }
+
     const double cv_calib_err = cv::calibrateCamera(
-        objectPoints, imagePoints, imgSize, cameraMatrix, distCoeffs, rvecs, tvecs, 0 /*flags*/);
+        objectPoints, imagePoints, imgSize, cameraMatrix, distCoeffs, rvecs, tvecs, calib_flags);
 
     // Load matrix:
     {
@@ -286,6 +376,7 @@ bool mrpt::vision::checkerBoardCameraCalibration(
     for (int k = 0; k < 5; k++) out_camera_params.dist[k] = distCoeffs.ptr<double>()[k];
 
     // Load camera poses:
+    unsigned int i;
     for (i = 0; i < valid_detected_imgs; i++)
     {
       CMatrixDouble44 HM;
@@ -328,7 +419,7 @@ bool mrpt::vision::checkerBoardCameraCalibration(
     for (it = images.begin(); it != images.end(); ++it)
     {
       TImageCalibData& dat = it->second;
-      if (!dat.img_original.isExternallyStored())
+      if (!dat.img_original.isExternallyStored() && !dat.img_original.isEmpty())
       {
         mrpt::img::CImage im;
         dat.img_original.undistort(im, out_camera_params);
@@ -383,7 +474,7 @@ bool mrpt::vision::checkerBoardCameraCalibration(
         const double py_d = projectedPoints_distorted[p].y;
 
         // Only draw if the img is NOT external:
-        if (!dat.img_original.isExternallyStored())
+        if (!dat.img_original.isExternallyStored() && !dat.img_original.isEmpty())
         {
           if (px >= 0 && px < imgSize.width && py >= 0 && py < imgSize.height)
             cv::circle(dat.img_rectified.asCvMatRef(), cv::Point(px, py), 4, CV_RGB(0, 0, 255));
@@ -0,0 +1,92 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+#include <gtest/gtest.h>
+#include <mrpt/random.h>
+#include <mrpt/vision/descriptor_kdtrees.h>
+
+#include <cstdint>
+#include <limits>
+
+using namespace mrpt::vision;
+
+static CFeatureList makeRandomSIFTFeats(size_t num, size_t dim)
+{
+  auto& rnd = mrpt::random::getRandomGenerator();
+  CFeatureList feats;
+  for (size_t i = 0; i < num; i++)
+  {
+    CFeature f;
+    f.descriptors.SIFT.emplace(dim);
+    for (size_t k = 0; k < dim; k++)
+      (*f.descriptors.SIFT)[k] = static_cast<uint8_t>(rnd.drawUniform32bit());
+    feats.emplace_back(std::move(f));
+  }
+  return feats;
+}
+
+TEST(TPackedDescriptorsKDTreeIndex, appendAndBatchedKnn)
+{
+  mrpt::random::getRandomGenerator().randomize(42);
+  const size_t DIM = 128;
+  const auto feats1 = makeRandomSIFTFeats(60, DIM);
+  const auto feats2 = makeRandomSIFTFeats(40, DIM);
+
+  TPackedDescriptorsKDTreeIndex<uint8_t> idx(feats1, descSIFT);
+  EXPECT_EQ(idx.size(), 60U);
+  EXPECT_EQ(idx.dim(), DIM);
+
+  // Incremental append (no rebuild):
+  idx.append(feats2);
+  EXPECT_EQ(idx.size(), 100U);
+
+  // Batched kNN (2 worker threads), querying with features from both
+  // batches: the nearest neighbor of each must be itself, at distance 0.
+  CFeatureList queries;
+  queries.push_back(feats1[3]);
+  queries.push_back(feats1[59]);
+  queries.push_back(feats2[0]);
+  queries.push_back(feats2[39]);
+  const std::vector<size_t> expected_idx = {3, 59, 60, 99};
+
+  const size_t knn = 2;
+  std::vector<size_t> indices;
+  std::vector<float> sqrDists;
+  idx.knnSearchBatch(queries, knn, indices, sqrDists, 2 /* threads */);
+  ASSERT_EQ(indices.size(), queries.size() * knn);
+  ASSERT_EQ(sqrDists.size(), queries.size() * knn);
+
+  for (size_t i = 0; i < queries.size(); i++)
+  {
+    EXPECT_EQ(indices[i * knn + 0], expected_idx[i]) << "query #" << i;
+    EXPECT_EQ(sqrDists[i * knn + 0], .0f) << "query #" << i;
+    // 2nd neighbor: not the query itself, and farther away:
+    EXPECT_NE(indices[i * knn + 1], expected_idx[i]) << "query #" << i;
+    EXPECT_GT(sqrDists[i * knn + 1], .0f) << "query #" << i;
+  }
+
+  // Brute-force check of the 2nd neighbor of query #0:
+  const uint8_t* q = idx.descriptor(3);
+  float bestDist = std::numeric_limits<float>::max();
+  size_t bestIdx = 0;
+  for (size_t j = 0; j < idx.size(); j++)
+  {
+    if (j == 3) continue;
+    const uint8_t* p = idx.descriptor(j);
+    float d = 0;
+    for (size_t k = 0; k < DIM; k++) d += mrpt::square(float(q[k]) - float(p[k]));
+    if (d < bestDist)
+    {
+      bestDist = d;
+      bestIdx = j;
+    }
+  }
+  EXPECT_EQ(indices[1], bestIdx);
+  EXPECT_NEAR(sqrDists[1], bestDist, 1e-3f);
+}
@@ -29,6 +29,8 @@
 #include <mrpt/system/os.h>
 
 #include <Eigen/Dense>
+#include <mutex>
+#include <thread>
 
 using namespace mrpt;
 using namespace mrpt::math;
@@ -1661,6 +1663,7 @@ void CLandmarksMap::TCustomSequenceLandmarks::clear()
   m_grid.clear();
 
   m_largestDistanceFromOriginIsUpdated = false;
+  kdtree_mark_as_outdated();
 }
 
 void CLandmarksMap::TCustomSequenceLandmarks::push_back(const CLandmark& l)
@@ -1681,6 +1684,7 @@ void CLandmarksMap::TCustomSequenceLandmarks::push_back(const CLandmark& l)
   cell->push_back(m_landmarks.size() - 1);
 
   m_largestDistanceFromOriginIsUpdated = false;
+  kdtree_mark_as_outdated();
 }
 
 CLandmark* CLandmarksMap::TCustomSequenceLandmarks::get(unsigned int indx)
@@ -1704,17 +1708,20 @@ void CLandmarksMap::TCustomSequenceLandmarks::isToBeModified(unsigned int indx)
     if (*it == static_cast<int>(indx))
     {
       cell->erase(it);
+      kdtree_mark_as_outdated();
       return;
     }
   }
 
   m_largestDistanceFromOriginIsUpdated = false;
+  kdtree_mark_as_outdated();
 }
 
 void CLandmarksMap::TCustomSequenceLandmarks::erase(unsigned int indx)
 {
   m_landmarks.erase(m_landmarks.begin() + indx);
   m_largestDistanceFromOriginIsUpdated = false;
+  kdtree_mark_as_outdated();
 }
 
 void CLandmarksMap::TCustomSequenceLandmarks::hasBeenModified(unsigned int indx)
@@ -1733,6 +1740,7 @@ void CLandmarksMap::TCustomSequenceLandmarks::hasBeenModified(unsigned int indx)
       m_grid.cellByPos(m_landmarks[indx].pose_mean.x, m_landmarks[indx].pose_mean.y);
   cell->push_back(indx);
   m_largestDistanceFromOriginIsUpdated = false;
+  kdtree_mark_as_outdated();
 }
 
 void CLandmarksMap::TCustomSequenceLandmarks::hasBeenModifiedAll()
@@ -1766,6 +1774,7 @@ void CLandmarksMap::TCustomSequenceLandmarks::hasBeenModifiedAll()
   }
 
   m_largestDistanceFromOriginIsUpdated = false;
+  kdtree_mark_as_outdated();
   MRPT_END
 }
 
@@ -1800,15 +1809,9 @@ double CLandmarksMap::computeLikelihood_SIFT_LandmarkMap(
     std::vector<bool>* otherCorrespondences) const
 {
   double lik = 0;  // For 'traditional'
-  double lik_i;
-  unsigned long distDesc;
-  double likByDist, likByDesc;
-
-  std::vector<unsigned char>::const_iterator it1, it2;
   double K_dist = -0.5 / square(likelihoodOptions.SIFTs_mahaDist_std);
   double K_desc = -0.5 / square(likelihoodOptions.SIFTs_sigma_descriptor_dist);
 
-  unsigned int idx1, idx2;
   CPointPDFGaussian lm1_pose, lm2_pose;
   CMatrixD dij(1, 3), Cij(3, 3), Cij_1;
   double distMahaFlik2;
@@ -1822,93 +1825,154 @@ double CLandmarksMap::computeLikelihood_SIFT_LandmarkMap(
       // lik = 1e-9;		// For consensus
       lik = 1.0;  // For traditional
 
-      TSequenceLandmarks::const_iterator lm1, lm2;
-      for (idx1 = 0, lm1 = theMap->landmarks.begin(); lm1 < theMap->landmarks.end();
-           lm1 += decimation, idx1 += decimation)  // Other theMap LM1
+      // Gather the (decimated) SIFT landmarks of the observed map:
+      std::vector<const CLandmark*> obsLMs;
+      obsLMs.reserve(theMap->size() / decimation + 1);
+      for (size_t i = 0; i < theMap->size(); i += decimation)
       {
-        if (lm1->getType() == featSIFT)
-        {
-          // Get the pose of lm1 as an object:
-          lm1->getPose(lm1_pose);
+        const CLandmark* lm = theMap->landmarks.get(i);
+        if (lm->getType() == featSIFT) obsLMs.push_back(lm);
+      }
 
-          lik_i = 0;  // Counter
+      // Stats of this map, needed for the gating radius below: with
+      // likByDist > 1e-2  <=>  distMaha^2 < 2*sigma_maha^2*ln(100), and
+      // distMaha^2 >= |dij|^2/lambda_max(Cij), lambda_max(Cij) <=
+      // trace(cov1)+trace(cov2), gating by that Euclidean radius cannot
+      // discard any candidate that the full evaluation would have kept:
+      size_t nSIFTsInMap = 0;
+      double maxCovTraceMap = 0;
+      for (const auto& lm : landmarks)
+      {
+        if (lm.getType() != featSIFT) continue;
+        nSIFTsInMap++;
+        mrpt::keep_max(maxCovTraceMap, double(lm.pose_cov_11) + lm.pose_cov_22 + lm.pose_cov_33);
+      }
+      const double mahaThres2 =
+          2.0 * square(likelihoodOptions.SIFTs_mahaDist_std) * std::log(100.0);
 
-          for (idx2 = 0, lm2 = landmarks.begin(); lm2 != landmarks.end();
-               lm2++, idx2++)  // This theMap LM2
-          {
-            if (lm2->getType() == featSIFT)
-            {
-              // Get the pose of lm2 as an object:
-              lm2->getPose(lm2_pose);
+      // Build the KD-tree over the landmark means now, so the worker
+      // threads below only run read-only queries against it:
+      landmarks.kdTreeEnsureIndexBuilt3D();
 
-              // Compute the likelihood according to mahalanobis
-              // distance:
-              // Distance between means:
-              dij(0, 0) = lm1->pose_mean.x - lm2->pose_mean.x;
-              dij(0, 1) = lm1->pose_mean.y - lm2->pose_mean.y;
-              dij(0, 2) = lm1->pose_mean.z - lm2->pose_mean.z;
+      std::vector<double> lik_i_all(obsLMs.size(), .0);
+      std::mutex eddMtx;  // protects the static _mEDD cache
 
-              // std::cout << "ED POSICION: " << sqrt(
-              // dij(0,0)*dij(0,0) + dij(0,1)*dij(0,1) +
-              // dij(0,2)*dij(0,2) ) << std::endl;
-              // Equivalent covariance from "i" to "j":
-              Cij = CMatrixDouble(lm1_pose.cov + lm2_pose.cov);
-              Cij_1 = Cij.inverse_LLt();
+      const auto eval_range = [&](size_t i_first, size_t i_end)
+      {
+        std::vector<nanoflann::ResultItem<size_t, float>> candidates;
+        for (size_t i = i_first; i < i_end; i++)
+        {
+          const CLandmark& lm1 = *obsLMs[i];
+          const double trace1 = double(lm1.pose_cov_11) + lm1.pose_cov_22 + lm1.pose_cov_33;
+          const float radiusSqr = d2f(mahaThres2 * (trace1 + maxCovTraceMap));
 
-              distMahaFlik2 = mrpt::math::multiply_HCHt_scalar(dij, Cij_1);
+          landmarks.kdTreeRadiusSearch3D(
+              d2f(lm1.pose_mean.x), d2f(lm1.pose_mean.y), d2f(lm1.pose_mean.z), radiusSqr,
+              candidates);
 
-              likByDist = exp(K_dist * distMahaFlik2);
+          double lik_i = 0;
+          size_t nEvaluated = 0;
+          for (const auto& cand : candidates)
+          {
+            const CLandmark& lm2 = *landmarks.get(cand.first);
+            if (lm2.getType() != featSIFT) continue;
+            nEvaluated++;
+
+            // Mahalanobis distance between means, with the closed-form
+            // inverse of the symmetric 3x3 Cij = cov1+cov2 taken straight
+            // from the inline covariance fields (no matrix temporaries):
+            const double c11 = double(lm1.pose_cov_11) + lm2.pose_cov_11;
+            const double c22 = double(lm1.pose_cov_22) + lm2.pose_cov_22;
+            const double c33 = double(lm1.pose_cov_33) + lm2.pose_cov_33;
+            const double c12 = double(lm1.pose_cov_12) + lm2.pose_cov_12;
+            const double c13 = double(lm1.pose_cov_13) + lm2.pose_cov_13;
+            const double c23 = double(lm1.pose_cov_23) + lm2.pose_cov_23;
+
+            const double i11 = c22 * c33 - c23 * c23;
+            const double i12 = c13 * c23 - c12 * c33;
+            const double i13 = c12 * c23 - c13 * c22;
+            const double i22 = c11 * c33 - c13 * c13;
+            const double i23 = c12 * c13 - c11 * c23;
+            const double i33 = c11 * c22 - c12 * c12;
+            const double det = c11 * i11 + c12 * i12 + c13 * i13;
+
+            const double dx = lm1.pose_mean.x - lm2.pose_mean.x;
+            const double dy = lm1.pose_mean.y - lm2.pose_mean.y;
+            const double dz = lm1.pose_mean.z - lm2.pose_mean.z;
+
+            const double distMahaFlik2 =
+                (dx * (i11 * dx + i12 * dy + i13 * dz) + dy * (i12 * dx + i22 * dy + i23 * dz) +
+                 dz * (i13 * dx + i23 * dy + i33 * dz)) /
+                det;
+
+            const double likByDist = exp(K_dist * distMahaFlik2);
+
+            if (likByDist > 1e-2)
+            {
+              // If the EUCLIDEAN distance is not too large,
+              // we compute the Descriptor distance.
+              // IF the EDD has been already computed, we skip this step!
+              const std::pair<mrpt::maps::CLandmark::TLandmarkID, mrpt::maps::CLandmark::TLandmarkID>
+                  mPair(lm2.ID, lm1.ID);
 
-              if (likByDist > 1e-2)
+              double distDesc;
               {
-                // If the EUCLIDEAN distance is not too large,
-                // we compute the Descriptor distance
-                // Compute Likelihood by descriptor
-                // Compute distance between descriptors
-
-                // IF the EDD has been already computed, we skip
-                // this step!
-                std::pair<mrpt::maps::CLandmark::TLandmarkID, mrpt::maps::CLandmark::TLandmarkID>
-                    mPair(lm2->ID, lm1->ID);
-                // std::cout << "Par: (" << lm2->ID << "," <<
-                // lm1->ID << ") -> ";
-
-                if (CLandmarksMap::_mEDD[mPair] == 0)
-                {
-                  distDesc = 0;
-                  ASSERT_(!lm1->features.empty() && !lm2->features.empty());
-                  ASSERT_(
-                      lm1->features[0].descriptors.SIFT->size() ==
-                      lm2->features[0].descriptors.SIFT->size());
-
-                  for (it1 = lm1->features[0].descriptors.SIFT->begin(),
-                      it2 = lm2->features[0].descriptors.SIFT->begin();
-                       it1 != lm1->features[0].descriptors.SIFT->end(); it1++, it2++)
-                    distDesc += square(*it1 - *it2);
-
-                  // Insert into the vector of Euclidean
-                  // distances
-                  CLandmarksMap::_mEDD[mPair] = distDesc;
-                }  // end if
-                else
-                {
-                  distDesc = (unsigned long)CLandmarksMap::_mEDD[mPair];
-                }
-                likByDesc = exp(K_desc * distDesc);
-                lik_i += likByDist * likByDesc;  // Cumulative Likelihood
+                std::lock_guard<std::mutex> lck(eddMtx);
+                distDesc = CLandmarksMap::_mEDD[mPair];
               }
-              else
+              if (distDesc == 0)
               {
-                // If the EUCLIDEAN distance is too large, we
-                // assume that the cumulative likelihood is
-                // (almost) zero.
-                lik_i += 1e-10f;
+                ASSERT_(!lm1.features.empty() && !lm2.features.empty());
+                const auto& desc1 = *lm1.features[0].descriptors.SIFT;
+                const auto& desc2 = *lm2.features[0].descriptors.SIFT;
+                ASSERT_(desc1.size() == desc2.size());
+
+                unsigned long dd = 0;
+                for (size_t k = 0; k < desc1.size(); k++)
+                  dd += square(int(desc1[k]) - int(desc2[k]));
+                distDesc = dd;
+
+                // Insert into the map of Euclidean distances:
+                std::lock_guard<std::mutex> lck(eddMtx);
+                CLandmarksMap::_mEDD[mPair] = distDesc;
               }
-            }                          // end if
-          }                            // end for "lm2"
-          lik *= (0.1 + 0.9 * lik_i);  // (TRADITIONAL) Total
-        }
-      }  // end for "lm1"
+              const double likByDesc = exp(K_desc * distDesc);
+              lik_i += likByDist * likByDesc;  // Cumulative Likelihood
+            }
+            else
+            {
+              // If the EUCLIDEAN distance is too large, we assume
+              // that the cumulative likelihood is (almost) zero.
+              lik_i += 1e-10;
+            }
+          }  // end for each gated candidate "lm2"
+
+          // The landmarks discarded by the kd-tree gate would all have
+          // fallen in the "almost zero" branch above:
+          lik_i += 1e-10 * double(nSIFTsInMap - nEvaluated);
+
+          lik_i_all[i] = lik_i;
+        }  // end for "lm1"
+      };
+
+      size_t nThreads = std::max<size_t>(1, std::thread::hardware_concurrency());
+      nThreads = std::min(nThreads, obsLMs.size());
+      if (nThreads <= 1)
+      {
+        eval_range(0, obsLMs.size());
+      }
+      else
+      {
+        const size_t chunk = (obsLMs.size() + nThreads - 1) / nThreads;
+        std::vector<std::thread> workers;
+        workers.reserve(nThreads);
+        for (size_t t = 0; t < nThreads; t++)
+          workers.emplace_back(eval_range, t * chunk, std::min(obsLMs.size(), (t + 1) * chunk));
+        for (auto& w : workers) w.join();
+      }
+
+      for (const double lik_i : lik_i_all)  // (TRADITIONAL) Total
+        lik *= (0.1 + 0.9 * lik_i);
     }
     break;
 
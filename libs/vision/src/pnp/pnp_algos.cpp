@@ -14,9 +14,14 @@
 #include <mrpt/vision/pnp_algos.h>
 #include <mrpt/vision/utils.h>
 
+#include <mrpt/system/WorkerThreadsPool.h>
+
 #include <Eigen/Core>
 #include <Eigen/Dense>
+#include <algorithm>
+#include <future>
 #include <iostream>
+#include <thread>
 #if MRPT_HAS_OPENCV
 #include <opencv2/core/eigen.hpp>
 #endif
@@ -582,3 +587,128 @@ bool mrpt::vision::pnp::CPnP::lhm(
     return false;
   }
 }
+
+size_t mrpt::vision::pnp::CPnP::solveBatch(
+    TPnPAlgo algo,
+    const std::vector<TBatchProblem>& problems,
+    const Eigen::Matrix3d& cam_intrinsic,
+    std::vector<TBatchResult>& results,
+    unsigned int num_threads)
+{
+  results.assign(problems.size(), TBatchResult());
+  if (problems.empty()) return 0;
+
+  const auto solve_range = [&](size_t i0, size_t i1)
+  {
+    CPnP solver;
+
+    // Per-thread workspace, reused across problems so the Eigen buffers are
+    // only (re)allocated when a problem is larger than all the former ones:
+    Eigen::MatrixXd cam_buf(cam_intrinsic);
+    Eigen::MatrixXd obj_buf, img_buf;
+    Eigen::MatrixXd pose_buf(6, 1);
+
+    // The minimal 4-point P3P fast path only needs the intrinsics once:
+    mrpt::vision::pnp::p3p p3p_minimal(
+        cam_intrinsic(0, 0), cam_intrinsic(1, 1), cam_intrinsic(0, 2), cam_intrinsic(1, 2));
+    const double fx = cam_intrinsic(0, 0), fy = cam_intrinsic(1, 1);
+    const double cx = cam_intrinsic(0, 2), cy = cam_intrinsic(1, 2);
+
+    for (size_t i = i0; i < i1; i++)
+    {
+      const TBatchProblem& prb = problems[i];
+      TBatchResult& res = results[i];
+
+      const int n = static_cast<int>(std::max(prb.obj_pts.rows(), prb.obj_pts.cols()));
+
+      // Minimal P3P case: go straight to the fixed-size, heap-free C entry
+      // point of the solver, skipping the dynamic-matrix wrapper:
+      if (algo == ALGO_P3P && prb.obj_pts.rows() == 4 && prb.obj_pts.cols() == 3)
+      {
+        const auto& o = prb.obj_pts;
+        const auto& im = prb.img_pts;
+        double R[3][3], t[3];
+        const bool ok = p3p_minimal.solve(
+            R, t,  //
+            im(0, 0) * fx + cx, im(0, 1) * fy + cy, o(0, 0), o(0, 1), o(0, 2),  //
+            im(1, 0) * fx + cx, im(1, 1) * fy + cy, o(1, 0), o(1, 1), o(1, 2),  //
+            im(2, 0) * fx + cx, im(2, 1) * fy + cy, o(2, 0), o(2, 1), o(2, 2),  //
+            im(3, 0) * fx + cx, im(3, 1) * fy + cy, o(3, 0), o(3, 1), o(3, 2));
+        if (ok)
+        {
+          Eigen::Matrix3d Re;
+          for (int r = 0; r < 3; r++)
+            for (int c = 0; c < 3; c++) Re(r, c) = R[r][c];
+          const Eigen::Quaterniond q(Re);
+          res.pose_mat << t[0], t[1], t[2], q.vec();
+          res.valid = true;
+        }
+        continue;
+      }
+
+      obj_buf = prb.obj_pts;
+      img_buf = prb.img_pts;
+
+      bool ok = false;
+      switch (algo)
+      {
+        case ALGO_P3P:
+          ok = solver.p3p(obj_buf, img_buf, n, cam_buf, pose_buf);
+          break;
+        case ALGO_RPNP:
+          ok = solver.rpnp(obj_buf, img_buf, n, cam_buf, pose_buf);
+          break;
+        case ALGO_PPNP:
+          ok = solver.ppnp(obj_buf, img_buf, n, cam_buf, pose_buf);
+          break;
+        case ALGO_POSIT:
+          ok = solver.posit(obj_buf, img_buf, n, cam_buf, pose_buf);
+          break;
+        case ALGO_LHM:
+          ok = solver.lhm(obj_buf, img_buf, n, cam_buf, pose_buf);
+          break;
+        case ALGO_DLS:
+          ok = solver.dls(obj_buf, img_buf, n, cam_buf, pose_buf);
+          break;
+        case ALGO_EPNP:
+          ok = solver.epnp(obj_buf, img_buf, n, cam_buf, pose_buf);
+          break;
+        case ALGO_UPNP:
+          ok = solver.upnp(obj_buf, img_buf, n, cam_buf, pose_buf);
+          break;
+      }
+      if (ok)
+      {
+        res.pose_mat = pose_buf;
+        res.valid = true;
+      }
+    }
+  };
+
+  unsigned int nThreads = num_threads;
+  if (nThreads == 0) nThreads = std::max(1u, std::thread::hardware_concurrency() / 2);
+  nThreads = std::min<unsigned int>(nThreads, static_cast<unsigned int>(problems.size()));
+
+  if (nThreads > 1)
+  {
+    mrpt::system::WorkerThreadsPool pool(nThreads);
+    std::vector<std::future<void>> futs;
+    futs.reserve(nThreads);
+    for (unsigned int b = 0; b < nThreads; b++)
+    {
+      const size_t i0 = (problems.size() * b) / nThreads;
+      const size_t i1 = (problems.size() * (b + 1)) / nThreads;
+      futs.emplace_back(pool.enqueue(solve_range, i0, i1));
+    }
+    for (auto& f : futs) f.get();  // rethrows any exception from the tasks
+  }
+  else
+  {
+    solve_range(0, problems.size());
+  }
+
+  size_t num_valid = 0;
+  for (const auto& r : results)
+    if (r.valid) num_valid++;
+  return num_valid;
+}
@@ -145,4 +145,36 @@ TEST_F(CPnPTest, DISABLED_upnp_TEST)
   EXPECT_LE(err_t, 2);
 }
 
+TEST_F(CPnPTest, solveBatch_TEST)
+{
+  using mrpt::vision::pnp::CPnP;
+
+  // Several copies of the same problem, to be solved in parallel:
+  std::vector<CPnP::TBatchProblem> problems(10);
+  for (auto& p : problems)
+  {
+    p.obj_pts = obj_pts;
+    p.img_pts = img_pts;
+  }
+  // And one minimal 4-point problem (nX3 layout) for the P3P fast path:
+  {
+    CPnP::TBatchProblem p;
+    p.obj_pts = obj_pts.transpose().topRows(4);
+    p.img_pts = img_pts.transpose().topRows(4);
+    problems.push_back(p);
+  }
+
+  std::vector<CPnP::TBatchResult> results;
+  const size_t num_valid = cpnp.solveBatch(CPnP::ALGO_P3P, problems, I3, results);
+
+  EXPECT_EQ(num_valid, problems.size());
+  ASSERT_EQ(results.size(), problems.size());
+  for (const auto& r : results)
+  {
+    ASSERT_TRUE(r.valid);
+    t_est << r.pose_mat(0), r.pose_mat(1), r.pose_mat(2);
+    EXPECT_LE((t - t_est).norm(), 2);
+  }
+}
+
 #endif
@@ -9,10 +9,14 @@
 
 #include "vision-precomp.h"  // Precompiled headers
 //
+#include <mrpt/core/WorkerThreadsPool.h>
 #include <mrpt/system/memory.h>
 #include <mrpt/vision/CFeatureExtraction.h>
 #include <mrpt/vision/tracking.h>
 
+#include <future>
+#include <thread>
+
 // Universal include for all versions of OpenCV
 #include <mrpt/3rdparty/do_opencv_includes.h>
 
@@ -30,6 +34,12 @@ using namespace std;
  *  Optional parameters that can be passed in "extra_params":
  *		- "window_width"  (Default=15)
  *		- "window_height" (Default=15)
+ *		- "LK_threads"    (Default=1) If >1, split the feature list into that
+ *many chunks tracked by parallel worker threads over the shared pyramids.
+ *
+ *  The LK pyramid of each frame is cached and reused as the "previous"
+ *  pyramid of the next call when frames chain (old_img == last new_img),
+ *  so only one pyramid is built per frame in video sequences.
  *
  *  \sa OpenCV's method cvCalcOpticalFlowPyrLK
  */
@@ -77,11 +87,115 @@ void CFeatureTracker_KL::trackFeatures_impl_templ(
     const cv::Mat& prev = prev_gray.asCvMatRef();
     const cv::Mat& cur = cur_gray.asCvMatRef();
 
-    cv::calcOpticalFlowPyrLK(
-        prev, cur, points_prev, points_cur, status, track_error,
-        cv::Size(window_width, window_height), LK_levels,
-        cv::TermCriteria(
-            cv::TermCriteria::MAX_ITER | cv::TermCriteria::EPS, LK_max_iters, LK_epsilon));
+    using pyramid_t = std::vector<cv::Mat>;
+    const cv::Size winSize(window_width, window_height);
+
+    // Pyramid of the "previous" image: reuse the one cached from the last
+    // call if old_img is the image we then built it for (note: cached
+    // pyramids own their data, so this stays valid even if the caller
+    // recycles image buffers, see tryReuseInputImage=false below):
+    const bool cacheHit = m_cachedPyramid &&
+        m_cachedPyramidImgData == old_img.asCvMatRef().data &&
+        m_cachedPyramidW == static_cast<int>(img_width) &&
+        m_cachedPyramidH == static_cast<int>(img_height) &&
+        m_cachedPyramidLevels == LK_levels && m_cachedPyramidWinW == window_width &&
+        m_cachedPyramidWinH == window_height;
+
+    std::shared_ptr<void> prevPyrHolder;
+    if (cacheHit)
+    {
+      prevPyrHolder = m_cachedPyramid;
+    }
+    else
+    {
+      m_timlog.enter("KL.buildPyramid_prev");
+      auto pyr = std::make_shared<pyramid_t>();
+      cv::buildOpticalFlowPyramid(
+          prev, *pyr, winSize, LK_levels, true /*withDerivatives*/, cv::BORDER_REFLECT_101,
+          cv::BORDER_CONSTANT, false /*tryReuseInputImage: pyramid must own its data*/);
+      prevPyrHolder = std::move(pyr);
+      m_timlog.leave("KL.buildPyramid_prev");
+    }
+    const auto& prevPyr = *static_cast<const pyramid_t*>(prevPyrHolder.get());
+
+    // Pyramid of the "current" image: always built, then cached for the
+    // next call:
+    m_timlog.enter("KL.buildPyramid_cur");
+    auto curPyrHolder = std::make_shared<pyramid_t>();
+    cv::buildOpticalFlowPyramid(
+        cur, *curPyrHolder, winSize, LK_levels, true /*withDerivatives*/, cv::BORDER_REFLECT_101,
+        cv::BORDER_CONSTANT, false /*tryReuseInputImage*/);
+    const auto& curPyr = *curPyrHolder;
+    m_timlog.leave("KL.buildPyramid_cur");
+
+    const auto criteria = cv::TermCriteria(
+        cv::TermCriteria::MAX_ITER | cv::TermCriteria::EPS, LK_max_iters, LK_epsilon);
+
+    const int LK_threads = extra_params.getOrDefault<int>("LK_threads", 1);
+
+    m_timlog.enter("KL.calcOpticalFlowPyrLK");
+    if (LK_threads <= 1 || nFeatures < 2 * static_cast<size_t>(LK_threads))
+    {
+      cv::calcOpticalFlowPyrLK(
+          prevPyr, curPyr, points_prev, points_cur, status, track_error, winSize, LK_levels,
+          criteria);
+    }
+    else
+    {
+      // Per-chunk LK over the shared (read-only) pyramids:
+      static mrpt::WorkerThreadsPool pool(
+          std::thread::hardware_concurrency(), mrpt::WorkerThreadsPool::POLICY_FIFO, "trackerKL");
+
+      points_cur.resize(nFeatures);
+      const size_t nChunks = LK_threads;
+
+      std::vector<std::future<void>> futs;
+      futs.reserve(nChunks);
+      for (size_t c = 0; c < nChunks; c++)
+      {
+        const size_t i0 = (nFeatures * c) / nChunks;
+        const size_t i1 = (nFeatures * (c + 1)) / nChunks;
+        futs.emplace_back(pool.enqueue(
+            [&, i0, i1]()
+            {
+              std::vector<cv::Point2f> p_prev(
+                  points_prev.begin() + i0, points_prev.begin() + i1);
+              std::vector<cv::Point2f> p_cur;
+              std::vector<uchar> st;
+              std::vector<float> err;
+              cv::calcOpticalFlowPyrLK(
+                  prevPyr, curPyr, p_prev, p_cur, st, err, winSize, LK_levels, criteria);
+              std::copy(p_cur.begin(), p_cur.end(), points_cur.begin() + i0);
+              std::copy(st.begin(), st.end(), status.begin() + i0);
+              std::copy(err.begin(), err.end(), track_error.begin() + i0);
+            }));
+      }
+      // Join all chunks before anything on this stack can go away,
+      // keeping the first error (if any) to rethrow afterwards:
+      std::exception_ptr firstExcept;
+      for (auto& f : futs)
+      {
+        try
+        {
+          f.get();
+        }
+        catch (...)
+        {
+          if (!firstExcept) firstExcept = std::current_exception();
+        }
+      }
+      if (firstExcept) std::rethrow_exception(firstExcept);
+    }
+    m_timlog.leave("KL.calcOpticalFlowPyrLK");
+
+    // Hand the current pyramid over to the next call:
+    m_cachedPyramid = std::move(curPyrHolder);
+    m_cachedPyramidImgData = new_img.asCvMatRef().data;
+    m_cachedPyramidW = static_cast<int>(img_width);
+    m_cachedPyramidH = static_cast<int>(img_height);
+    m_cachedPyramidLevels = LK_levels;
+    m_cachedPyramidWinW = window_width;
+    m_cachedPyramidWinH = window_height;
 
     for (size_t i = 0; i < nFeatures; ++i)
     {
@@ -0,0 +1,174 @@
+/* +------------------------------------------------------------------------+
+   |                     Mobile Robot Programming Toolkit (MRPT)            |
+   |                          https://www.mrpt.org/                         |
+   |                                                                        |
+   | Copyright (c) 2005-2024, Individual contributors, see AUTHORS file     |
+   | See: https://www.mrpt.org/Authors - All rights reserved.               |
+   | Released under BSD License. See: https://www.mrpt.org/License          |
+   +------------------------------------------------------------------------+ */
+
+// Manually-crafted NumPy interop for the point-map classes and pose
+// interpolators: zero-copy column views and batch ndarray insert/query
+// methods, attached to the binder-generated classes at module init time.
+
+#include <mrpt/core/Clock.h>
+#include <mrpt/maps/CPointsMapXYZI.h>
+#include <mrpt/maps/CSimplePointsMap.h>
+#include <mrpt/poses/CPose3DInterpolator.h>
+
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#ifndef BINDER_PYBIND11_TYPE_CASTER
+	#define BINDER_PYBIND11_TYPE_CASTER
+	PYBIND11_DECLARE_HOLDER_TYPE(T, std::shared_ptr<T>)
+	PYBIND11_DECLARE_HOLDER_TYPE(T, T*)
+	PYBIND11_MAKE_OPAQUE(std::shared_ptr<void>)
+#endif
+
+namespace py = pybind11;
+
+namespace
+{
+// Read-only, zero-copy NumPy view over one SoA point-map column. The map
+// object is installed as the array base, so the view keeps the map alive and
+// the buffer stays valid for as long as the map is not resized.
+// Views are deliberately read-only: writes must go through the map API so the
+// cached bounding box and KD-tree get invalidated correctly.
+py::array make_float_view(const mrpt::aligned_std_vector<float>& v, const py::object& owner)
+{
+	py::array a(
+		py::dtype::of<float>(), {static_cast<py::ssize_t>(v.size())},
+		{static_cast<py::ssize_t>(sizeof(float))}, v.data(), owner);
+	py::detail::array_proxy(a.ptr())->flags &= ~py::detail::npy_api::NPY_ARRAY_WRITEABLE_;
+	return a;
+}
+
+using f64arr = py::array_t<double, py::array::c_style | py::array::forcecast>;
+
+void check_1d_same_len(const f64arr& a, const f64arr& b, const f64arr& c, const char* who)
+{
+	if (a.ndim() != 1 || b.ndim() != 1 || c.ndim() != 1 || a.size() != b.size() ||
+		a.size() != c.size())
+		throw std::invalid_argument(
+			std::string(who) + ": expected three 1-D arrays of equal length");
+}
+
+// Appends N points in one go: a single resize() (which also marks the map as
+// modified) followed by plain column writes, instead of one insertPoint()
+// call per element.
+void bulk_append_xyz(
+	mrpt::maps::CPointsMap& m, const f64arr& xs, const f64arr& ys, const f64arr& zs)
+{
+	check_1d_same_len(xs, ys, zs, "insert_xyz()");
+	const size_t n0 = m.size(), n = static_cast<size_t>(xs.size());
+	m.resize(n0 + n);
+	const double *px = xs.data(), *py_ = ys.data(), *pz = zs.data();
+	for (size_t i = 0; i < n; i++)
+		m.setPointFast(
+			n0 + i, static_cast<float>(px[i]), static_cast<float>(py_[i]),
+			static_cast<float>(pz[i]));
+}
+}  // namespace
+
+void bind_manual_numpy(std::function<pybind11::module&(std::string const& namespace_)>& M)
+{
+	using mrpt::maps::CPointsMap;
+	using mrpt::maps::CPointsMapXYZI;
+
+	pybind11::module m_maps = M("mrpt::maps");
+
+	pybind11::handle clPts = m_maps.attr("CPointsMap");
+	clPts.attr("x_view") = py::cpp_function(
+		[](py::object self)
+		{ return make_float_view(self.cast<CPointsMap&>().getPointsBufferRef_x(), self); },
+		py::is_method(clPts),
+		"Read-only zero-copy numpy view of the X coordinates. Invalidated by any resize of the map.");
+	clPts.attr("y_view") = py::cpp_function(
+		[](py::object self)
+		{ return make_float_view(self.cast<CPointsMap&>().getPointsBufferRef_y(), self); },
+		py::is_method(clPts),
+		"Read-only zero-copy numpy view of the Y coordinates. Invalidated by any resize of the map.");
+	clPts.attr("z_view") = py::cpp_function(
+		[](py::object self)
+		{ return make_float_view(self.cast<CPointsMap&>().getPointsBufferRef_z(), self); },
+		py::is_method(clPts),
+		"Read-only zero-copy numpy view of the Z coordinates. Invalidated by any resize of the map.");
+	clPts.attr("insert_xyz") = py::cpp_function(
+		[](py::object self, const f64arr& xs, const f64arr& ys, const f64arr& zs)
+		{ bulk_append_xyz(self.cast<CPointsMap&>(), xs, ys, zs); }, py::is_method(clPts),
+		py::arg("xs"), py::arg("ys"), py::arg("zs"),
+		"Appends points from three 1-D ndarrays (any dtype castable to float64) in one batch.");
+
+	pybind11::handle clXYZI = m_maps.attr("CPointsMapXYZI");
+	clXYZI.attr("intensity_view") = py::cpp_function(
+		[](py::object self)
+		{
+			return make_float_view(
+				*self.cast<CPointsMapXYZI&>().getPointsBufferRef_intensity(), self);
+		},
+		py::is_method(clXYZI),
+		"Read-only zero-copy numpy view of the intensity channel. Invalidated by any resize of the map.");
+	clXYZI.attr("insert_xyzi") = py::cpp_function(
+		[](py::object self, const f64arr& xs, const f64arr& ys, const f64arr& zs,
+		   const f64arr& intensities)
+		{
+			auto& m = self.cast<CPointsMapXYZI&>();
+			if (intensities.ndim() != 1 || intensities.size() != xs.size())
+				throw std::invalid_argument(
+					"insert_xyzi(): intensity array must be 1-D and of the same length as xs");
+			const size_t n0 = m.size(), n = static_cast<size_t>(xs.size());
+			bulk_append_xyz(m, xs, ys, zs);  // resize() also sizes the intensity column
+			float* pi = m.getPointsBufferRef_intensity()->data() + n0;
+			const double* src = intensities.data();
+			for (size_t i = 0; i < n; i++) pi[i] = static_cast<float>(src[i]);
+		},
+		py::is_method(clXYZI), py::arg("xs"), py::arg("ys"), py::arg("zs"), py::arg("intensities"),
+		"Appends points plus intensities from four 1-D ndarrays in one batch.");
+
+	pybind11::module m_poses = M("mrpt::poses");
+
+	pybind11::handle clInterp = m_poses.attr("CPose3DInterpolator");
+	clInterp.attr("interpolate_many") = py::cpp_function(
+		[](py::object self, const f64arr& ts)
+		{
+			if (ts.ndim() != 1)
+				throw std::invalid_argument(
+					"interpolate_many(): expected a 1-D array of UNIX timestamps");
+			const auto& interp = self.cast<const mrpt::poses::CPose3DInterpolator&>();
+			const size_t n = static_cast<size_t>(ts.size());
+
+			std::vector<mrpt::Clock::time_point> tps(n);
+			const double* pt = ts.data();
+			for (size_t i = 0; i < n; i++) tps[i] = mrpt::Clock::fromDouble(pt[i]);
+
+			std::vector<mrpt::math::TPose3D> poses;
+			std::vector<bool> valid;
+			interp.interpolateMany(tps, poses, valid);
+
+			py::array_t<double> out({static_cast<py::ssize_t>(n), static_cast<py::ssize_t>(6)});
+			py::array_t<bool> ok(static_cast<py::ssize_t>(n));
+			auto o = out.mutable_unchecked<2>();
+			auto v = ok.mutable_unchecked<1>();
+			for (py::ssize_t i = 0; i < static_cast<py::ssize_t>(n); i++)
+			{
+				o(i, 0) = poses[i].x;
+				o(i, 1) = poses[i].y;
+				o(i, 2) = poses[i].z;
+				o(i, 3) = poses[i].yaw;
+				o(i, 4) = poses[i].pitch;
+				o(i, 5) = poses[i].roll;
+				v(i) = valid[i];
+			}
+			return py::make_tuple(out, ok);
+		},
+		py::is_method(clInterp), py::arg("timestamps"),
+		"Vectorized interpolate(): takes a 1-D array of UNIX timestamps (float64 seconds) and "
+		"returns a tuple (poses, valid) with an (N,6) [x y z yaw pitch roll] float64 array and an "
+		"(N,) bool array.");
+}
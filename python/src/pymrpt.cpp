@@ -362,6 +362,9 @@ void bind_mrpt_math_TPoint3D_1(std::function< pybind11::module &(std::string con
 void bind_mrpt_math_TTwist2D(std::function< pybind11::module &(std::string const &namespace_) > &M);
 void bind_mrpt_math_CVectorDynamic(std::function< pybind11::module &(std::string const &namespace_) > &M);
 
+// -- manually crafted bindings (see ../pymrpt_numpy.cpp) --
+void bind_manual_numpy(std::function< pybind11::module &(std::string const &namespace_) > &M);
+
 
 PYBIND11_MODULE(pymrpt, root_module) {
 	root_module.doc() = "pymrpt module";
@@ -789,4 +792,7 @@ PYBIND11_MODULE(pymrpt, root_module) {
 	bind_mrpt_math_TTwist2D(M);
 	bind_mrpt_math_CVectorDynamic(M);
 
+	// -- manually crafted bindings --
+	bind_manual_numpy(M);
+
 }